@@ -12,7 +12,7 @@
 #define IMAGE_COMPRESS_TEST_WIDTH		160
 #define IMAGE_COMPRESS_TEST_HEIGHT		128
 #define IMAGE_COMPRESS_TEST_CMD_LEN		12727	/*  Number of command bytes  */
-#define IMAGE_COMPRESS_TEST_PALETTE_LEN		508	/*  Number of colors  */
+#define IMAGE_COMPRESS_TEST_PALETTE_LEN		508	/*  Number of bytes (2 * colors)  */
 #define IMAGE_COMPRESS_TEST_TOTAL_LEN		13236	/*  Total array size  */
 
 #define IMAGE_COMPRESS_TEST_PAL		\
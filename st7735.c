@@ -1,5 +1,44 @@
 #include "st7735.h"
 
+//	Data pin direction, for a bidirectional SDA line (see beginRead())
+#ifndef SPI_SDA_IN
+#define SPI_SDA_IN()
+#define SPI_SDA_OUT()
+#endif // SPI_SDA_IN
+
+//	Section markers: benchmark hook, and instrumentation (see ST7735_Stats)
+#ifdef ST7735_STATS
+static void statsMark(uint8_t tag);
+#define ST7735_MARK(tag)	do { ST7735_BENCH(tag); ST7735_TRACE(ST7735_TRACE_MARK, tag); \
+		statsMark(tag); } while (0)
+#define ST7735_COUNT(stmt)	stmt
+#else
+#define ST7735_MARK(tag)	do { ST7735_BENCH(tag); ST7735_TRACE(ST7735_TRACE_MARK, tag); } while (0)
+#define ST7735_COUNT(stmt)
+#endif // ST7735_STATS
+
+//	Sprite recording (see drawSprite()): windows and pixel data are copied
+//	into the cache as they're sent
+#ifdef ST7735_SPRITES
+static ST7735_SpriteCache* capture;	//	Cache recording a sprite, or NULL
+static bool captureData;			//	In a RAMWR: bytes sent are pixel data
+static void captureWindow(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2);
+static void captureByte(uint8_t b);
+#endif // ST7735_SPRITES
+
+//	Pin control for the current panel
+#ifdef ST7735_MULTI_PANEL
+#define ST7735_CSON()		(*ST7735_panel->csPort &= ~ST7735_panel->csMask)
+#define ST7735_CSOFF()		(*ST7735_panel->csPort |= ST7735_panel->csMask)
+#define ST7735_DC_DATA()	(*ST7735_panel->dcPort |= ST7735_panel->dcMask)
+#define ST7735_DC_CMD()		(*ST7735_panel->dcPort &= ~ST7735_panel->dcMask)
+#else
+#define ST7735_CSON()		SPI_CSON()
+#define ST7735_CSOFF()		SPI_CSOFF()
+#define ST7735_DC_DATA()	SPI_DC_DATA()
+#define ST7735_DC_CMD()		SPI_DC_CMD()
+#endif // ST7735_MULTI_PANEL
+
 //	Rather than a bazillion writecommand() and writedata() calls, screen
 //	initialization commands and arguments are organized in these tables
 //	stored in PROGMEM.	The table may look bulky, but that's mostly the
@@ -76,9 +115,247 @@ const uint8_t ST7735_Rcmd3[] PROGMEM = {
 		100								//		100 ms delay
 };
 
+//	Init for 7735S 0.96" 80x160 "mini", part 2 (with Rcmd1, Rcmd3)
+const uint8_t ST7735_Rcmd2mini[] PROGMEM = {
+	3,									//	3 commands in list:
+	ST7735_CASET,	4,					//	1: Column addr set, 4 args, no delay:
+		0x00, 0x00,						//		XSTART = 0
+		0x00, 0x4F,						//		XEND = 79
+	ST7735_RASET,	4,					//	2: Row addr set, 4 args, no delay:
+		0x00, 0x00,						//		XSTART = 0
+		0x00, 0x9F,						//		XEND = 159
+	ST7735_INVON,	0					//	3: Invert display (this glass is inverted)
+};
+
+//	Init for 7789 240x240 (one part)
+const uint8_t ST7789_cmd[] PROGMEM = {
+	8,									//	8 commands in list:
+	ST7735_SWRESET,	ST_CMD_DELAY,		//	1: Software reset, 0 args, w/delay
+		150,							//		150 ms delay
+	ST7735_SLPOUT,	ST_CMD_DELAY,		//	2: Out of sleep mode, 0 args, w/delay
+		255,							//		500 ms delay
+	ST7735_COLMOD,	1 + ST_CMD_DELAY,	//	3: set color mode, 1 arg + delay:
+		0x55,							//		16-bit color (RGB and SPI interfaces)
+		10,								//		10 ms delay
+	ST7735_CASET,	4,					//	4: Column addr set, 4 args, no delay:
+		0x00, 0x00,						//		XSTART = 0
+		0x00, 0xEF,						//		XEND = 239
+	ST7735_RASET,	4,					//	5: Row addr set, 4 args, no delay:
+		0x00, 0x00,						//		YSTART = 0
+		0x01, 0x3F,						//		YEND = 319
+	ST7735_INVON,	ST_CMD_DELAY,		//	6: Invert display (IPS glass), w/delay
+		10,								//		10 ms delay
+	ST7735_NORON,	ST_CMD_DELAY,		//	7: Normal display on, no args, w/delay
+		10,								//		10 ms delay
+	ST7735_DISPON,	ST_CMD_DELAY,		//	8: Main screen turn on, no args, w/delay
+		100								//		100 ms delay
+};
+
+//	Init for ILI9163 128x128 (one part; values per sumotoy's TFT_ILI9163C)
+const uint8_t ILI9163_cmd[] PROGMEM = {
+	18,									//	18 commands in list:
+	ST7735_SWRESET,	ST_CMD_DELAY,		//	1: Software reset, 0 args, w/delay
+		255,							//		500 ms delay
+	ST7735_SLPOUT,	ST_CMD_DELAY,		//	2: Out of sleep mode, 0 args, w/delay
+		5,								//		5 ms delay
+	ST7735_COLMOD,	1,					//	3: set color mode, 1 arg, no delay:
+		0x05,							//		16-bit color
+	ST7735_GAMSET,	1,					//	4: Gamma curve, 1 arg:
+		0x04,							//		Curve 3
+	ILI9163_GAMRSEL, 1,					//	5: Gamma adjustment enable, 1 arg:
+		0x01,
+	ST7735_NORON,	0,					//	6: Normal display on, no args
+	ST7735_DISSET5,	2,					//	7: Display function, 2 args:
+		0xFF, 0x06,
+	ST7735_GMCTRP1,	15,					//	8: Positive gamma, 15 args:
+		0x36, 0x29, 0x12, 0x22, 0x1C,
+		0x15, 0x42, 0xB7, 0x2F, 0x13,
+		0x12, 0x0A, 0x11, 0x0B, 0x06,
+	ST7735_GMCTRN1,	15,					//	9: Negative gamma, 15 args:
+		0x09, 0x16, 0x2D, 0x0D, 0x13,
+		0x15, 0x40, 0x48, 0x53, 0x0C,
+		0x1D, 0x25, 0x2E, 0x34, 0x39,
+	ST7735_FRMCTR1,	2,					//	10: Frame rate ctrl, 2 args:
+		0x08, 0x02,
+	ST7735_INVCTR,	1,					//	11: Display inversion ctrl, 1 arg:
+		0x07,
+	ST7735_PWCTR1,	2,					//	12: Power control, 2 args:
+		0x0A, 0x02,
+	ST7735_PWCTR2,	1,					//	13: Power control, 1 arg:
+		0x02,
+	ST7735_VMCTR1,	2,					//	14: VCOM control, 2 args:
+		0x50, 0x5B,
+	ILI9163_VCOMOFFS, 1,				//	15: VCOM offset, 1 arg:
+		0x40,
+	ST7735_CASET,	4,					//	16: Column addr set, 4 args:
+		0x00, 0x00, 0x00, 0x7F,			//		0 to 127
+	ST7735_RASET,	4,					//	17: Row addr set, 4 args:
+		0x00, 0x00, 0x00, 0x7F,			//		0 to 127
+	ST7735_DISPON,	ST_CMD_DELAY,		//	18: Main screen turn on, no args w/delay
+		100								//		100 ms delay
+};
+
+#define ST7735_COLMODS_ALL	((1 << ST7735_COLMOD_12BIT) | (1 << ST7735_COLMOD_16BIT) \
+				| (1 << ST7735_COLMOD_18BIT))
+
+const ST7735_Variant ST7735_variants[ST7735_VARIANT_COUNT] PROGMEM = {
+	{	//	ST7735R, 1.8" 128x160, green tab
+		.init = { ST7735_Rcmd1, ST7735_Rcmd2green, ST7735_Rcmd3 },
+		.cols = 128, .rows = 160, .gramCols = 132, .gramRows = 162,
+		.colOffset = 2, .rowOffset = 1,
+		.madctl = 0, .colorModes = ST7735_COLMODS_ALL,
+		.id = { ST7735_ID_7735 }
+	},
+	{	//	ST7735S, 0.96" 80x160 "mini" (same ID as the 7735R)
+		.init = { ST7735_Rcmd1, ST7735_Rcmd2mini, ST7735_Rcmd3 },
+		.cols = 80, .rows = 160, .gramCols = 132, .gramRows = 162,
+		.colOffset = 26, .rowOffset = 1,
+		.madctl = 0, .colorModes = ST7735_COLMODS_ALL,
+		.id = { 0, 0, 0 }
+	},
+	{	//	ST7789, 1.3" 240x240 (top of a 240x320 GRAM)
+		.init = { ST7789_cmd, NULL, NULL },
+		.cols = 240, .rows = 240, .gramCols = 240, .gramRows = 320,
+		.colOffset = 0, .rowOffset = 0,
+		.madctl = 0, .colorModes = ST7735_COLMODS_ALL,
+		.id = { ST7735_ID_7789 }
+	},
+	{	//	ILI9163, 1.44" 128x128 (top of a 128x160 GRAM)
+		.init = { ILI9163_cmd, NULL, NULL },
+		.cols = 128, .rows = 128, .gramCols = 128, .gramRows = 160,
+		.colOffset = 0, .rowOffset = 0,
+		.madctl = ST7735_MADCTL_BGR,
+		.colorModes = ST7735_COLMODS_ALL,
+		.id = { 0, 0, 0 }
+	}
+};
+
+//	MADCTL values for each rotation (ST7735_ORIENT_ROTx).  ROT0 is the
+//	original (empirical) 0x50; the rest follow from the datasheet's
+//	mirror-then-exchange order.  CASET always addresses logical Y, so the
+//	RAMWR stream runs down columns (Y fastest) in every orientation --
+//	drawImage() bitmaps depend on this.  Left-right mirroring toggles MY.
+const uint8_t ST7735_orientMadctl[] PROGMEM = {
+	ST7735_MADCTL_MX | ST7735_MADCTL_ML,										//	ROT0
+	ST7735_MADCTL_MY | ST7735_MADCTL_MX | ST7735_MADCTL_MV | ST7735_MADCTL_ML,	//	ROT90
+	ST7735_MADCTL_MY | ST7735_MADCTL_ML,										//	ROT180
+	ST7735_MADCTL_MV | ST7735_MADCTL_ML											//	ROT270
+};
+
+//	Nesting depth of ST7735_beginBatch()
+static uint8_t batchDepth;
+
+#ifdef ST7735_STATS
+ST7735_Stats ST7735_stats;
+static uint8_t statsSection;	//	Section being timed (ST7735_STATS_SECTION())...
+static uint32_t statsBytes;		//	  and ST7735_stats.bytes...
+static uint16_t statsTime;		//	  and ST7735_STATS_CLOCK() at its start
+
+/**
+ *	Ends the current section (crediting it with the bytes and time since
+ *	it began), and starts the one for tag.
+ *	@param tag	ST7735_BENCH_xxx, or image command byte
+ */
+static void statsMark(uint8_t tag) {
+
+	uint16_t now = ST7735_STATS_CLOCK();
+
+	ST7735_stats.section[statsSection].bytes += ST7735_stats.bytes - statsBytes;
+	ST7735_stats.section[statsSection].time += (uint16_t)(now - statsTime);
+	statsSection = ST7735_STATS_SECTION(tag);
+	ST7735_stats.section[statsSection].count++;
+	statsBytes = ST7735_stats.bytes;
+	statsTime = now;
+
+}
+
+/**
+ *	Clears the counters, e.g. at the start of each frame.
+ */
+void ST7735_resetStats(void) {
+
+	uint8_t* p = (uint8_t*)&ST7735_stats;
+	uint16_t n = sizeof(ST7735_stats);
+
+	do {
+		*p++ = 0;
+	} while (--n);
+	statsSection = ST7735_STATS_SECTION(ST7735_BENCH_IDLE);
+	statsBytes = 0;
+	statsTime = ST7735_STATS_CLOCK();
+
+}
+
+static void dumpNumber(void (*put)(char c), uint32_t n) {
+
+	char buf[10];
+	uint8_t i = 0;
+
+	do {
+		buf[i++] = '0' + n % 10;
+		n /= 10;
+	} while (n);
+	do {
+		put(buf[--i]);
+	} while (i);
+
+}
+
+/**
+ *	Writes the counters as a compact text report, e.g. once per frame
+ *	(then ST7735_resetStats()):
+ *		B<bytes> P<pixels> R<runs> T<transactions> W<windows>/<cached> S<wait>
+ *	then one line per section entered, by tag (hex: image command, or
+ *	ST7735_BENCH_xxx; current color flats are counted with the others):
+ *		<tag>:<count>,<bytes>,<time>
+ *	and a blank line.  Times are ST7735_STATS_CLOCK() ticks.
+ *	@param put	writes one character (to a UART, say)
+ */
+void ST7735_dumpStats(void (*put)(char c)) {
+
+	ST7735_Stats* s = &ST7735_stats;
+	uint8_t i, t;
+
+	statsMark(ST7735_BENCH_IDLE);	//	Close the section in progress
+	s->section[statsSection].count--;
+	put('B'); dumpNumber(put, s->bytes);
+	put(' '); put('P'); dumpNumber(put, s->pixels);
+	put(' '); put('R'); dumpNumber(put, s->runs);
+	put(' '); put('T'); dumpNumber(put, s->transactions);
+	put(' '); put('W'); dumpNumber(put, s->windows);
+	put('/'); dumpNumber(put, s->windowsCached);
+	put(' '); put('S'); dumpNumber(put, s->waitTime);
+	put('\n');
+	for (i = 0; i < ST7735_STATS_SECTIONS; i++) {
+		if (!s->section[i].count) continue;
+		if (i >= 16) {
+			t = ST7735_BENCH_IDLE + i - 16;
+		} else if (i == 0x08 || i == 0x09 || i == 0x0f) {
+			t = (i == 0x0f) ? 0xff : i;	//	Skip, Pattern, Terminate
+		} else {
+			t = (i & 0x07) | ((i & 0x08) << 1);
+		}
+		put("0123456789abcdef"[t >> 4]);
+		put("0123456789abcdef"[t & 0x0f]);
+		put(':'); dumpNumber(put, s->section[i].count);
+		put(','); dumpNumber(put, s->section[i].bytes);
+		put(','); dumpNumber(put, s->section[i].time);
+		put('\n');
+	}
+	put('\n');
+
+}
+#endif // ST7735_STATS
+
+#ifdef ST7735_MULTI_PANEL
+ST7735_Panel* ST7735_panel;
+#else
+ST7735_Panel ST7735_panel0 = { ST7735_PANEL_RAW };
+#endif // ST7735_MULTI_PANEL
+
 #ifdef IMAGE_COMPRESS_TEST_H_INCLUDED
 const uint8_t ImageData[] PROGMEM = {
-	(IMAGE_COMPRESS_TEST_PALETTE_LEN & 0x00ff),
+	((IMAGE_COMPRESS_TEST_PALETTE_LEN / 2) & 0x00ff),
 	IMAGE_COMPRESS_TEST_PAL,
 	IMAGE_COMPRESS_TEST_CMDS
 };
@@ -92,6 +369,7 @@ void ST7735_displayInit(const uint8_t* addr) {
 	if (addr == 0) {
 		return;
 	}
+	ST7735_MARK(ST7735_BENCH_INIT);
 	numCommands = pgm_read_byte(addr++);	//	Number of commands to follow
 	ST7735_beginCommand();
 	while (numCommands--) {					//	For each command...
@@ -113,6 +391,7 @@ void ST7735_displayInit(const uint8_t* addr) {
 		}
 	}
 	ST7735_endTransaction();
+	ST7735_MARK(ST7735_BENCH_IDLE);
 }
 
 void delay_ms(uint16_t ms) {
@@ -125,34 +404,81 @@ void delay_ms(uint16_t ms) {
 
 inline void ST7735_beginCommand(void) {
 	SPI_TXWAIT();
-	SPI_DC_CMD();
-	SPI_CSON();
+	ST7735_DC_CMD();
+	ST7735_CSON();
+	ST7735_TRACE(ST7735_TRACE_DC, 0);
+	ST7735_TRACE(ST7735_TRACE_CS, 1);
 }
 inline void ST7735_beginData(void) {
 	SPI_TXWAIT();
-	SPI_DC_DATA();
-	SPI_CSON();
+	ST7735_DC_DATA();
+	ST7735_CSON();
+	ST7735_TRACE(ST7735_TRACE_DC, 1);
+	ST7735_TRACE(ST7735_TRACE_CS, 1);
 }
 
 inline void ST7735_commandToData(void) {
 	SPI_TXWAIT();
-	SPI_DC_DATA();
+	ST7735_DC_DATA();
+	ST7735_TRACE(ST7735_TRACE_DC, 1);
 }
 
 inline void ST7735_dataToCommand(void) {
 	SPI_TXWAIT();
-	SPI_DC_CMD();
+	ST7735_DC_CMD();
+	ST7735_TRACE(ST7735_TRACE_DC, 0);
 }
 
 uint8_t ST7735_sendByte(uint8_t b) {
+#ifdef ST7735_STATS
+	uint16_t t = ST7735_STATS_CLOCK();
+	SPI_TXWAIT();
+	ST7735_stats.waitTime += (uint16_t)(ST7735_STATS_CLOCK() - t);
+	ST7735_stats.bytes++;
+#else
 	SPI_TXWAIT();
+#endif // ST7735_STATS
+	ST7735_TRACE(ST7735_TRACE_BYTE, b);
+#ifdef ST7735_SPRITES
+	if (captureData) {
+		captureByte(b);
+	}
+#endif // ST7735_SPRITES
 	SPI_DATA = b;
 	return SPI_DATA;
 }
 
 inline void ST7735_endTransaction(void) {
+	if (batchDepth) {				//	Batch holds CS until ST7735_endBatch()
+		return;
+	}
 	SPI_TXWAIT();
-	SPI_CSOFF();
+	ST7735_CSOFF();
+	ST7735_TRACE(ST7735_TRACE_CS, 0);
+	ST7735_COUNT(ST7735_stats.transactions++);
+}
+
+/**
+ *	Opens a batch: until the matching ST7735_endBatch(), CS stays
+ *	asserted across drawing calls, so each primitive costs only its
+ *	command and data bytes (and the D/C edges between them).  Batches
+ *	nest, and carry over to another panel (see ST7735_selectPanel()).
+ */
+void ST7735_beginBatch(void) {
+
+	batchDepth++;
+
+}
+
+void ST7735_endBatch(void) {
+
+	if (--batchDepth == 0) {
+		SPI_TXWAIT();
+		ST7735_CSOFF();
+		ST7735_TRACE(ST7735_TRACE_CS, 0);
+		ST7735_COUNT(ST7735_stats.transactions++);
+	}
+
 }
 
 void ST7735_sendCommand(uint8_t cmd) {
@@ -171,22 +497,367 @@ void ST7735_sendData(uint8_t cmd) {
 
 }
 
-void initLcd(void) {
+#ifdef ST7735_MULTI_PANEL
+/**
+ *	Selects the panel that subsequent calls draw to.  Inside a batch,
+ *	the old panel's CS is released, and the batch goes on with the new
+ *	one (ST7735_endBatch() releases that).
+ */
+void ST7735_selectPanel(ST7735_Panel* p) {
+
+	SPI_TXWAIT();
+	if (batchDepth && p != ST7735_panel) {
+		ST7735_CSOFF();
+		ST7735_TRACE(ST7735_TRACE_CS, 0);
+		ST7735_COUNT(ST7735_stats.transactions++);
+	}
+	ST7735_panel = p;
+
+}
+#endif // ST7735_MULTI_PANEL
 
-	PORT_SPI_RS.OUTCLR = BIT_SPI_RS;	//	Reset display
+/**
+ *	Pulses the current panel's hardware reset line.
+ */
+static void resetPanel(void) {
+
+#ifdef ST7735_MULTI_PANEL
+	if (ST7735_panel->rsPort) {
+		*ST7735_panel->rsPort &= ~ST7735_panel->rsMask;	//	Reset display
+		_delay_ms(5);
+		*ST7735_panel->rsPort |= ST7735_panel->rsMask;
+		_delay_ms(10);
+	}
+#else
+	SPI_RS_LOW();					//	Reset display
 	_delay_ms(5);
-	PORT_SPI_RS.OUTSET = BIT_SPI_RS;
+	SPI_RS_HIGH();
 	_delay_ms(10);
-	ST7735_displayInit(ST7735_Rcmd1);
-	ST7735_displayInit(ST7735_Rcmd2green);
-	ST7735_displayInit(ST7735_Rcmd3);
+#endif // ST7735_MULTI_PANEL
+
+}
+
+/**
+ *	Sends a read command (CS asserted, D/C at command) and turns the
+ *	bus around: after this, each
+ *	ST7735_sendByte(0) returns the byte received during the previous
+ *	transfer, so reads run one byte behind.  The dummy byte is consumed
+ *	here; the trailing extra transfer is dropped when CS ends the read
+ *	(endRead() releases CS even within a batch).
+ *	For a bidirectional SDA line, the project header supplies SPI_SDA_IN()
+ *	and SPI_SDA_OUT() to switch the MCU's pin direction.
+ */
+static void beginRead(uint8_t cmd) {
+
+	ST7735_sendByte(cmd);
+	ST7735_commandToData();
+	SPI_SDA_IN();
+	ST7735_sendByte(0);			//	Clock dummy byte...
+	ST7735_sendByte(0);			//	  (discard it: received during this one)
+
+}
+
+static void endRead(void) {
+
+	SPI_TXWAIT();
+	ST7735_CSOFF();
+	ST7735_TRACE(ST7735_TRACE_CS, 0);
+	ST7735_COUNT(ST7735_stats.transactions++);
+	SPI_SDA_OUT();
+
+}
+
+/**
+ *	Reads a register into buf (len bytes, after the dummy byte).
+ *	Requires MISO (or SDA, see beginRead()) to be wired.
+ */
+void ST7735_readRegister(uint8_t cmd, uint8_t* buf, uint8_t len) {
+
+	ST7735_beginCommand();
+	beginRead(cmd);
+	while (len--) {
+		*buf++ = ST7735_sendByte(0);
+	}
+	endRead();
+
+}
+
+/**
+ *	Reads display status (RDDST).
+ *	@return status, first byte received in the LSB (see ST7735_RDDST_ bits)
+ */
+uint32_t ST7735_readStatus(void) {
+
+	uint8_t b[ST7735_RDDST_RDB];
+
+	ST7735_readRegister(ST7735_RDDST, b, ST7735_RDDST_RDB);
+	return b[0] | ((uint16_t)b[1] << 8) | ((uint32_t)b[2] << 16) | ((uint32_t)b[3] << 24);
+
+}
+
+/**
+ *	Reads display ID (RDDID).
+ *	@return ID1 | ID2 << 8 | ID3 << 16
+ */
+uint32_t ST7735_readId(void) {
+
+	uint8_t b[ST7735_RDDID_RDB];
+
+	ST7735_readRegister(ST7735_RDDID, b, ST7735_RDDID_RDB);
+	return b[0] | ((uint16_t)b[1] << 8) | ((uint32_t)b[2] << 16);
+
+}
+
+/**
+ *	Identifies the current panel by its RDDID response.
+ *	@return matching entry of ST7735_variants[], or NULL if none
+ *	(including when MISO isn't wired, and reads all 0 or 0xff).
+ */
+const ST7735_Variant* ST7735_detectVariant(void) {
+
+	uint8_t id[ST7735_RDDID_RDB];
+	uint8_t i, j;
+
+	ST7735_readRegister(ST7735_RDDID, id, ST7735_RDDID_RDB);
+	for (i = 0; i < ST7735_VARIANT_COUNT; i++) {
+		if (pgm_read_byte(&ST7735_variants[i].id[0]) == 0) {
+			continue;
+		}
+		for (j = 0; j < ST7735_RDDID_RDB; j++) {
+			if (pgm_read_byte(&ST7735_variants[i].id[j]) != id[j]) {
+				break;
+			}
+		}
+		if (j == ST7735_RDDID_RDB) {
+			return &ST7735_variants[i];
+		}
+	}
+	return NULL;
+
+}
+
+/**
+ *	Initializes the current panel, per its variant (if set).
+ */
+void initLcd(void) {
+
+	ST7735_Panel* p = ST7735_panel;
+	const ST7735_Variant* v = p->variant;
+	uint8_t i;
+
+	resetPanel();
+	if (v == NULL) {
+		ST7735_displayInit(ST7735_Rcmd1);
+		ST7735_displayInit(ST7735_Rcmd2green);
+		ST7735_displayInit(ST7735_Rcmd3);
+	} else {
+		for (i = 0; i < 3; i++) {
+			ST7735_displayInit(pgm_read_ptr(&v->init[i]));
+		}
+		p->cols = pgm_read_word(&v->cols);
+		p->rows = pgm_read_word(&v->rows);
+		p->gramCols = pgm_read_word(&v->gramCols);
+		p->gramRows = pgm_read_word(&v->gramRows);
+		p->colOffset = pgm_read_byte(&v->colOffset);
+		p->rowOffset = pgm_read_byte(&v->rowOffset);
+		p->madctl = pgm_read_byte(&v->madctl);
+		p->colorModes = pgm_read_byte(&v->colorModes);
+	}
+	p->colorMode = ST7735_COLMOD_16BIT;		//	As set by every init table
+	setOrientation(ST7735_ORIENT_ROT0);
+}
+
+/**
+ *	Resets and identifies the current panel (see ST7735_detectVariant()),
+ *	then initializes it.  If not recognized, the panel's variant is
+ *	left as-is.
+ *	@return the detected variant, or NULL
+ */
+const ST7735_Variant* initLcdAuto(void) {
+
+	const ST7735_Variant* v;
+
+	resetPanel();
+	v = ST7735_detectVariant();
+	if (v) {
+		ST7735_panel->variant = v;
+	}
+	initLcd();
+	return v;
+
+}
+
+/**
+ *	Writes MADCTL for the given orientation, without changing
+ *	the logical screen state.  Window offsets follow the new
+ *	address mapping (mirroring measures from the far end of
+ *	GRAM), and the cached window is invalidated.
+ */
+static void writeMadctl(uint8_t orient) {
+
+	ST7735_Panel* p = ST7735_panel;
+	uint16_t colOfs, rowOfs;
+	uint8_t m;
+
+	m = pgm_read_byte(&ST7735_orientMadctl[orient & ST7735_ORIENT_ROT_gm]);
+	if (orient & ST7735_ORIENT_MIRROR) {
+		m ^= ST7735_MADCTL_MY;
+	}
+	m |= p->madctl;
+	colOfs = p->colOffset;
+	if (m & ST7735_MADCTL_MX) {
+		colOfs = p->gramCols - p->cols - colOfs;
+	}
+	rowOfs = p->rowOffset;
+	if (m & ST7735_MADCTL_MY) {
+		rowOfs = p->gramRows - p->rows - rowOfs;
+	}
+	if (m & ST7735_MADCTL_MV) {		//	CASET addresses rows
+		p->caOffset = rowOfs;
+		p->raOffset = colOfs;
+	} else {
+		p->caOffset = colOfs;
+		p->raOffset = rowOfs;
+	}
+	p->winX1 = 0xffff;
+	p->winY1 = 0xffff;
+
+	ST7735_beginCommand();
+	ST7735_sendByte(ST7735_MADCTL);
+	ST7735_commandToData();
+	ST7735_sendByte(m);
+	ST7735_endTransaction();
+
+}
+
+/**
+ *	Combines two orientations: the result maps b's frame to the
+ *	display, when b is drawn within a screen oriented as a.
+ */
+static uint8_t composeOrientation(uint8_t a, uint8_t b) {
+
+	uint8_t rot;
+
+	if (b & ST7735_ORIENT_MIRROR) {
+		rot = b - a;
+	} else {
+		rot = b + a;
+	}
+	return (rot & ST7735_ORIENT_ROT_gm) | ((a ^ b) & ST7735_ORIENT_MIRROR);
+
+}
+
+/**
+ *	Transforms a rectangle, in place, from a frame of size fw * fh
+ *	to the same frame rotated and/or mirrored per orient.
+ */
+static void transformRect(uint8_t orient, uint16_t* x, uint16_t* y,
+				uint16_t* w, uint16_t* h, uint16_t fw, uint16_t fh) {
+
+	uint16_t t;
+	uint8_t rot;
+
+	for (rot = orient & ST7735_ORIENT_ROT_gm; rot; rot--) {
+		//	Clockwise: (x, y) --> (fh - 1 - y, x)
+		t = *x; *x = fh - *y - *h; *y = t;
+		t = *w; *w = *h; *h = t;
+		t = fw; fw = fh; fh = t;
+	}
+	if (orient & ST7735_ORIENT_MIRROR) {
+		*x = fw - *x - *w;
+	}
+
+}
+
+/**
+ *	Sets the display orientation.  Subsequent drawing uses
+ *	the rotated (and/or mirrored) coordinates; the panel's
+ *	width and height are updated to match.
+ *	@param orient	ST7735_ORIENT_ROTx, optionally | ST7735_ORIENT_MIRROR
+ */
+void setOrientation(uint8_t orient) {
+
+	ST7735_Panel* p = ST7735_panel;
+
+	p->orientation = orient;
+	if (orient & 0x01) {
+		p->width = p->cols;
+		p->height = p->rows;
+	} else {
+		p->width = p->rows;
+		p->height = p->cols;
+	}
+	writeMadctl(orient);
+
+}
+
+/**
+ *	Sends the window (RASET, CASET) for a region, inclusive.
+ *	X goes to RASET and Y to CASET in every orientation (see
+ *	ST7735_orientMadctl), so RAM data runs top-to-bottom, then
+ *	left-to-right, in logical coordinates.  Only the half that
+ *	differs from the panel's cached window is sent.
+ *	Expects CS asserted and D/C at command.
+ *	@return true if anything was sent (D/C left at data)
+ */
+static bool sendRegion(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2) {
+
+	ST7735_Panel* p = ST7735_panel;
+	bool newX, newY;
+
+#ifdef ST7735_SPRITES
+	if (capture) {
+		captureWindow(x1, y1, x2, y2);
+	}
+#endif // ST7735_SPRITES
+	newX = (x1 != p->winX1 || x2 != p->winX2);
+	newY = (y1 != p->winY1 || y2 != p->winY2);
+	ST7735_COUNT(ST7735_stats.windows += newX + newY);
+	ST7735_COUNT(ST7735_stats.windowsCached += 2 - newX - newY);
+	if (newX) {
+		p->winX1 = x1; p->winX2 = x2;
+		x1 += p->raOffset; x2 += p->raOffset;
+		ST7735_sendByte(ST7735_RASET);
+		ST7735_commandToData();
+		ST7735_sendByte(x1 >> 8);
+		ST7735_sendByte(x1 & 0xff);
+		ST7735_sendByte(x2 >> 8);
+		ST7735_sendByte(x2 & 0xff);
+		if (newY) {
+			ST7735_dataToCommand();
+		}
+	}
+	if (newY) {
+		p->winY1 = y1; p->winY2 = y2;
+		y1 += p->caOffset; y2 += p->caOffset;
+		ST7735_sendByte(ST7735_CASET);
+		ST7735_commandToData();
+		ST7735_sendByte(y1 >> 8);
+		ST7735_sendByte(y1 & 0xff);
+		ST7735_sendByte(y2 >> 8);
+		ST7735_sendByte(y2 & 0xff);
+	}
+	return newX || newY;
+
+}
+
+/**
+ *	Opens a transaction (or continues a batch) for a region: sends
+ *	its window, leaving D/C at command for RAMWR or RAMRD.  Window and
+ *	memory access thus share one CS assertion.
+ */
+static void openRegion(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2) {
+
+	ST7735_beginCommand();
+	if (sendRegion(x1, y1, x2, y2)) {
+		ST7735_dataToCommand();
+	}
+
 }
 
 /**
  *	Sets the active (drawing) screen region, inclusive.
- *	Region wraps bottom-to-top and right-to-left,
- *	Or horizontal than vertical, depending on
- *	orientation state (MADCTL).
+ *	See sendRegion() for orientation and caching.
  *	@param x1	Left edge
  *	@param y1	Top edge
  *	@param x2	Right edge
@@ -194,99 +865,850 @@ void initLcd(void) {
  */
 void setScreenRegion(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2) {
 
+	ST7735_MARK(ST7735_BENCH_REGION);
 	ST7735_beginCommand();
-	ST7735_sendByte(ST7735_RASET);
-	ST7735_commandToData();
-	ST7735_sendByte(x1 >> 8);
-	ST7735_sendByte(x1 & 0xff);
-	ST7735_sendByte(x2 >> 8);
-	ST7735_sendByte(x2 & 0xff);
-
-	ST7735_dataToCommand();
-	ST7735_sendByte(ST7735_CASET);
-	ST7735_commandToData();
-	ST7735_sendByte(y1 >> 8);
-	ST7735_sendByte(y1 & 0xff);
-	ST7735_sendByte(y2 >> 8);
-	ST7735_sendByte(y2 & 0xff);
+	sendRegion(x1, y1, x2, y2);
 	ST7735_endTransaction();
+	ST7735_MARK(ST7735_BENCH_IDLE);
 
 }
 
-void writePixel(uint16_t c) {
+/**
+ *	Sets the interface pixel format (COLMOD) of the current panel.
+ *	Colors passed to drawing functions are always 5-6-5; they are
+ *	converted on the way out.  12-bit mode sends three bytes per two
+ *	pixels, 18-bit mode three bytes per pixel.
+ *	@param mode	ST7735_COLMOD_12BIT, _16BIT or _18BIT
+ *	@return false if the panel doesn't support mode (unchanged)
+ */
+bool setColorMode(uint8_t mode) {
 
+	if (!(ST7735_panel->colorModes & (1 << mode))) {
+		return false;
+	}
+	ST7735_panel->colorMode = mode;
 	ST7735_beginCommand();
-	ST7735_sendByte(ST7735_RAMWR);
+	ST7735_sendByte(ST7735_COLMOD);
 	ST7735_commandToData();
-	ST7735_sendByte(c >> 8);
-	ST7735_sendByte(c & 0xff);
+	ST7735_sendByte(mode);
 	ST7735_endTransaction();
+	return true;
 
 }
 
 /**
- * Draws a filled rectangle at the specified location, in the
- * specified color.
+ *	Converts a 5-6-5 color to the current panel's pixel word:
+ *	0x0RGB in 12-bit mode, else 5-6-5 (18-bit mode expands it
+ *	on the way out).
  */
-void drawfillRectangle(uint16_t colr, uint16_t xStart, uint16_t yStart,
-				uint16_t width, uint16_t height) {
+static uint16_t convertColor(uint16_t c) {
 
-	uint16_t area;
+	if (ST7735_panel->colorMode == ST7735_COLMOD_12BIT) {
+		return ((c >> 4) & 0x0f00) | ((c >> 3) & 0x00f0) | ((c >> 1) & 0x000f);
+	}
+	return c;
+
+}
 
-	area = width * height;
+//	RAMWR stream state: 12-bit mode pairs pixels across sendPixel() calls
+static uint8_t pixelMode;	//	Color mode of the stream
+static uint8_t pixelHeld;	//	Unpaired pixel's last nibble (blue)...
+static bool pixelOdd;		//	  when set
 
-	//	Set column (X) address start and end
-	setScreenRegion(xStart, yStart, xStart + width - 1, yStart + height - 1);
+/**
+ *	Starts a RAMWR pixel stream, in the panel's current color mode.
+ *	Expects CS asserted and D/C at command.
+ */
+static void startPixels(void) {
 
-	ST7735_beginCommand();
+	pixelMode = ST7735_panel->colorMode;
+	pixelOdd = false;
+	ST7735_COUNT(ST7735_stats.runs++);
 	ST7735_sendByte(ST7735_RAMWR);
 	ST7735_commandToData();
+#ifdef ST7735_SPRITES
+	captureData = (capture != NULL);
+#endif // ST7735_SPRITES
 
-	do {
-		ST7735_sendByte(colr >> 8);
-		ST7735_sendByte(colr & 0xff);
-	} while (--area);
-	ST7735_endTransaction();
+}
+
+/**
+ *	Sets the window and starts a RAMWR pixel stream into it, in
+ *	one transaction.
+ */
+static void beginPixels(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2) {
+
+	openRegion(x1, y1, x2, y2);
+	startPixels();
 
 }
 
 /**
- *	Draw image starting at the specified location.
- *	(Use the ST7735 Compressor tool to generate code.)
- *	Overdraw past the edge of the screen is discarded.
- *	@param img	PROGMEM image (encoded) buffer to draw
- *	@param x	x and...
- *	@param y	y coordinate to draw image at, referenced to top-left corner
+ *	Sends one pixel (word from convertColor()) in a RAMWR stream.
  */
-void drawImage(const uint8_t* img, const uint8_t x, const uint8_t y) {
+static inline void sendPixel(uint16_t c) {
 
-	const uint8_t* palette;
-	uint8_t cmd;	//	Command/instruction byte
-	uint8_t xStart, yStart, width, height;	//	Location (or length) parameters
-	uint16_t area;	//	number of bitmap pixels to read
-	uint16_t colr;	//	Color to draw (5-6-5 format)
+	uint8_t b;
 
-	palette = img + 1;			//	get palette offset and
-	area = pgm_read_byte(img);	//	  (borrow area for this calculation)
-	if (area == 0) area = 256;
-	img += 1 + 2 * area;		//	skip over palette
+	ST7735_COUNT(ST7735_stats.pixels++);
+	if (pixelMode == ST7735_COLMOD_16BIT) {
+		ST7735_sendByte(c >> 8);
+		ST7735_sendByte(c & 0xff);
+	} else if (pixelMode == ST7735_COLMOD_12BIT) {
+		if (pixelOdd) {		//	B1 R2, G2 B2
+			ST7735_sendByte((pixelHeld << 4) | (c >> 8));
+			ST7735_sendByte(c & 0xff);
+		} else {			//	R1 G1
+			ST7735_sendByte(c >> 4);
+			pixelHeld = c & 0x0f;
+		}
+		pixelOdd = !pixelOdd;
+	} else {
+		//	6 bits per byte, left justified; replicate MSBs into the LSB
+		b = (c >> 8) & 0xf8;
+		ST7735_sendByte(b | (b >> 5));
+		b = (c >> 3) & 0xfc;
+		ST7735_sendByte(b | (b >> 6));
+		b = c << 3;
+		ST7735_sendByte(b | (b >> 5));
+	}
 
+}
+
+/**
+ *	Ends a RAMWR pixel stream.  An unpaired 12-bit pixel is sent
+ *	padded; the partial pixel that follows it is dropped by the
+ *	controller when CS goes high.
+ */
+static void endPixels(void) {
+
+	if (pixelOdd) {
+		ST7735_sendByte(pixelHeld << 4);
+	}
+	ST7735_endTransaction();
+
+}
+
+void writePixel(uint16_t c) {
+
+	ST7735_beginCommand();
+	startPixels();
+	sendPixel(convertColor(c));
+	endPixels();
+
+}
+
+/**
+ *	Draws a filled rectangle at the specified location, in the
+ *	specified color.
+ */
+void drawfillRectangle(uint16_t colr, uint16_t xStart, uint16_t yStart,
+				uint16_t width, uint16_t height) {
+
+	uint16_t count;
+
+	ST7735_MARK(ST7735_BENCH_FILL);
+	colr = convertColor(colr);
+	beginPixels(xStart, yStart, xStart + width - 1, yStart + height - 1);
+	//	Column at a time, as width * height can exceed 16 bits on larger panels
+	if (pixelMode == ST7735_COLMOD_16BIT) {
+		ST7735_COUNT(ST7735_stats.pixels += (uint32_t)width * height);
+		do {
+			count = height;
+			do {
+				ST7735_sendByte(colr >> 8);
+				ST7735_sendByte(colr & 0xff);
+			} while (--count);
+		} while (--width);
+	} else {
+		do {
+			count = height;
+			do {
+				sendPixel(colr);
+			} while (--count);
+		} while (--width);
+	}
+	endPixels();
+	ST7735_MARK(ST7735_BENCH_IDLE);
+
+}
+
+//	4x4 ordered dither thresholds (Bayer), by (row & 3) * 4 + (column & 3)
+static const uint8_t PROGMEM patternDither[16] = {
+	 0,  8,  2, 10,
+	12,  4, 14,  6,
+	 3, 11,  1,  9,
+	15,  7, 13,  5
+};
+
+/**
+ *	Rounds gradient channels (8.8 fixed point) to a 5-6-5 color, with
+ *	dither offset t added (threshold * 16 + 8).  Channels stay within
+ *	the gradient's ends, so no clamping is needed.
+ */
+static inline uint16_t ditherColor(int16_t r, int16_t g, int16_t b, uint8_t t) {
+
+	return ((uint16_t)((r + t) >> 8) << 11) | ((uint16_t)((g + t) >> 8) << 5) | ((b + t) >> 8);
+
+}
+
+/**
+ *	Sends part of a pattern (see drawPatternRectangle()) into a RAMWR
+ *	stream: the w x h pixels at (xOff, yOff) of a width x height
+ *	pattern, column by column, so clipped parts match the whole.
+ *	Gradients step each channel in 8.8 fixed point, one add per pixel
+ *	along the gradient, then dither to 5-6-5 with a 4x4 Bayer matrix.
+ *	A horizontal gradient has only four colors per column, worked out
+ *	at its top, so it streams as fast as a fill; a vertical one costs
+ *	three adds and shifts per pixel.  Checkers go out in runs.
+ */
+static void sendPattern(uint8_t kind, uint16_t colr1, uint16_t colr2,
+				uint16_t width, uint16_t height, uint16_t xOff, uint16_t yOff, uint16_t w, uint16_t h) {
+
+	int16_t r, g, b, dr, dg, db;	//	Channels at the current column, and steps, 8.8
+	int16_t r1, g1, b1;			//	  and down the column (vertical)
+	uint16_t c[4];			//	Colors (horizontal), or dither offsets, by row & 3
+	uint16_t i, j, n, size, cell, colr;
+	uint8_t k;
+	bool odd, oddCol, oddRow;
+
+	if ((kind & ST7735_PATTERN_TYPE_gm) == ST7735_PATTERN_CHECKER) {
+		size = (kind >> 2) + 1;
+		colr1 = convertColor(colr1);
+		colr2 = convertColor(colr2);
+		oddCol = (xOff / size) & 1;
+		oddRow = (yOff / size) & 1;
+		cell = size - xOff % size;	//	Columns left in the current square
+		do {
+			odd = oddCol ^ oddRow;
+			n = size - yOff % size;	//	Rows left in the current square
+			j = h;
+			do {
+				if (n > j) n = j;
+				j -= n;
+				colr = odd ? colr2 : colr1;
+				do {
+					sendPixel(colr);
+				} while (--n);
+				odd = !odd;
+				n = size;
+			} while (j);
+			if (--cell == 0) {
+				cell = size;
+				oddCol = !oddCol;
+			}
+		} while (--w);
+		return;
+	}
+
+	//	Steps over the length of the gradient, and the start of the part
+	n = (((kind & ST7735_PATTERN_TYPE_gm) == ST7735_PATTERN_HGRADIENT) ? width : height) - 1;
+	if (n == 0) n = 1;
+	r = colr1 >> 11; g = (colr1 >> 5) & 0x3f; b = colr1 & 0x1f;
+	dr = (int32_t)((colr2 >> 11) - r) * 256 / n;
+	dg = (int32_t)(((colr2 >> 5) & 0x3f) - g) * 256 / n;
+	db = (int32_t)((colr2 & 0x1f) - b) * 256 / n;
+	n = ((kind & ST7735_PATTERN_TYPE_gm) == ST7735_PATTERN_HGRADIENT) ? xOff : yOff;
+	r = r * 256 + (int32_t)dr * n;
+	g = g * 256 + (int32_t)dg * n;
+	b = b * 256 + (int32_t)db * n;
+
+	for (i = xOff; w; i++, w--) {
+		for (k = 0; k < 4; k++) {
+			c[k] = pgm_read_byte(&patternDither[k * 4 + (i & 3)]) * 16 + 8;
+		}
+		k = yOff;
+		j = h;
+		if ((kind & ST7735_PATTERN_TYPE_gm) == ST7735_PATTERN_HGRADIENT) {
+			for (n = 0; n < 4; n++) {
+				c[n] = convertColor(ditherColor(r, g, b, c[n]));
+			}
+			do {
+				sendPixel(c[k++ & 3]);
+			} while (--j);
+			r += dr; g += dg; b += db;
+		} else {
+			r1 = r; g1 = g; b1 = b;
+			do {
+				sendPixel(convertColor(ditherColor(r1, g1, b1, c[k++ & 3])));
+				r1 += dr; g1 += dg; b1 += db;
+			} while (--j);
+		}
+	}
+
+}
+
+/**
+ *	Fills a rectangle with a pattern, generated as it's sent (one
+ *	window, one RAMWR):
+ *	ST7735_PATTERN_HGRADIENT, colr1 in the left column to colr2 in the
+ *	right; ST7735_PATTERN_VGRADIENT, top row to bottom row; or
+ *	ST7735_PATTERN_CHECKER_SIZE(n), squares of n x n pixels (1-64),
+ *	colr1 at the top left.  Gradients are dithered, so they show no
+ *	5-6-5 banding.  Image command 0x09 draws the same patterns.
+ *	@param kind	ST7735_PATTERN_xxx
+ *	@param colr1	5-6-5 color to start, and...
+ *	@param colr2	to end the gradient, or the other squares
+ */
+void drawPatternRectangle(uint8_t kind, uint16_t colr1, uint16_t colr2,
+				uint16_t xStart, uint16_t yStart, uint16_t width, uint16_t height) {
+
+	ST7735_MARK(ST7735_BENCH_PATTERN);
+	beginPixels(xStart, yStart, xStart + width - 1, yStart + height - 1);
+	sendPattern(kind, colr1, colr2, width, height, 0, 0, width, height);
+	endPixels();
+	ST7735_MARK(ST7735_BENCH_IDLE);
+
+}
+
+/**
+ *	Fills a rectangle with a tile, repeated across and down from its
+ *	top-left corner, in one window.
+ *	@param tile	PROGMEM 5-6-5 colors (little-endian words, as a
+ *				palette), tileWidth * tileHeight in column order
+ */
+void drawTileRectangle(const uint8_t* tile, uint8_t tileWidth, uint8_t tileHeight,
+				uint16_t xStart, uint16_t yStart, uint16_t width, uint16_t height) {
+
+	const uint8_t* column = tile;	//	Tile column being drawn
+	const uint8_t* p;
+	uint16_t j;
+	uint8_t i = tileWidth, k;
+
+	ST7735_MARK(ST7735_BENCH_PATTERN);
+	beginPixels(xStart, yStart, xStart + width - 1, yStart + height - 1);
+	do {
+		p = column;
+		k = tileHeight;
+		j = height;
+		do {
+			sendPixel(convertColor(pgm_read_word(p)));
+			p += 2;
+			if (--k == 0) {
+				k = tileHeight;
+				p = column;
+			}
+		} while (--j);
+		column += 2 * tileHeight;
+		if (--i == 0) {
+			i = tileWidth;
+			column = tile;
+		}
+	} while (--width);
+	endPixels();
+	ST7735_MARK(ST7735_BENCH_IDLE);
+
+}
+
+/**
+ *	Reads back a region of display memory (RAMRD), as 5-6-5 colors,
+ *	column by column (top to bottom, then left to right).  The controller
+ *	always returns 18-bit pixels (three bytes), whatever the color mode.
+ *	@param buf	width * height colors
+ */
+void readPixels(uint16_t* buf, uint16_t xStart, uint16_t yStart,
+				uint16_t width, uint16_t height) {
+
+	uint16_t count;
+	uint8_t r, g;
+
+	openRegion(xStart, yStart, xStart + width - 1, yStart + height - 1);
+	beginRead(ST7735_RAMRD);
+	do {
+		count = height;
+		do {
+			r = ST7735_sendByte(0);
+			g = ST7735_sendByte(0);
+			*buf++ = ((r & 0xf8) << 8) | ((g & 0xfc) << 3) | (ST7735_sendByte(0) >> 3);
+		} while (--count);
+	} while (--width);
+	endRead();
+
+}
+
+/**
+ *	Blends one 5-6-5 color over another.
+ *	@param a	opacity of fg, 0 (bg) to 255 (almost fg)
+ */
+static uint16_t blendColor(uint16_t fg, uint16_t bg, uint8_t a) {
+
+	int16_t r, g, b;
+
+	r = (int16_t)(fg >> 11) - (int16_t)(bg >> 11);
+	g = (int16_t)((fg >> 5) & 0x3f) - (int16_t)((bg >> 5) & 0x3f);
+	b = (int16_t)(fg & 0x1f) - (int16_t)(bg & 0x1f);
+	r = (bg >> 11) + ((r * a) >> 8);
+	g = ((bg >> 5) & 0x3f) + ((g * a) >> 8);
+	b = (bg & 0x1f) + ((b * a) >> 8);
+	return (r << 11) | (g << 5) | b;
+
+}
+
+/**
+ *	Draws a color over a rectangle, alpha blended with what's already on
+ *	screen: strips of up to ST7735_BLEND_STRIP pixels are read back,
+ *	blended in RAM and written again.  Requires the display read path
+ *	(see beginRead()).
+ *	@param colr	5-6-5 color to draw
+ *	@param alpha	overall opacity, 0 to 255
+ *	@param mask	PROGMEM per-pixel opacity (coverage), width * height
+ *				bytes in column order, scaled by alpha; or NULL
+ *				for uniform alpha.  An 8-bit antialiased glyph or
+ *				shape, for example.
+ */
+void blendRectangle(uint16_t colr, uint8_t alpha, const uint8_t* mask,
+				uint16_t xStart, uint16_t yStart, uint16_t width, uint16_t height) {
+
+	static uint16_t strip[ST7735_BLEND_STRIP];
+	uint16_t x, y, w, h, i, j, n;
+	uint8_t a;
+
+	h = (height < ST7735_BLEND_STRIP) ? height : ST7735_BLEND_STRIP;
+	for (x = 0; x < width; x += w) {
+		w = (h == height) ? ST7735_BLEND_STRIP / h : 1;
+		if (w > width - x) {
+			w = width - x;
+		}
+		for (y = 0; y < height; y += h) {
+			if (h > height - y) {
+				h = height - y;
+			}
+			readPixels(strip, xStart + x, yStart + y, w, h);
+			n = 0;
+			for (i = 0; i < w; i++) {
+				for (j = 0; j < h; j++) {
+					a = alpha;
+					if (mask) {
+						a = ((uint16_t)pgm_read_byte(mask + (x + i) * height + y + j)
+								* (alpha + 1u)) >> 8;
+					}
+					strip[n] = blendColor(colr, strip[n], a);
+					n++;
+				}
+			}
+			//	Same window as the readback: only RAMWR is sent
+			beginPixels(xStart + x, yStart + y, xStart + x + w - 1, yStart + y + h - 1);
+			for (i = 0; i < n; i++) {
+				sendPixel(convertColor(strip[i]));
+			}
+			endPixels();
+		}
+		h = (height < ST7735_BLEND_STRIP) ? height : ST7735_BLEND_STRIP;
+	}
+
+}
+
+#if ST7735_PALETTE_CACHE
+//	Image palette, converted to the current pixel format
+static uint16_t paletteCache[ST7735_PALETTE_CACHE];
+#endif // ST7735_PALETTE_CACHE
+
+//	Palette remapping for drawImage() and friends (see setPaletteMap())
+static const uint8_t* paletteSubst;	//	PROGMEM palette used instead, or NULL
+static ST7735_ColorMap paletteMap;	//	Transform per palette entry, or NULL
+
+/**
+ *	Remaps the colors of subsequently drawn images (drawImage(),
+ *	drawImageRegion(), drawImageScaled(), drawHuffImage() and animations),
+ *	without re-encoding them: themes, night mode, blinking or highlighted
+ *	states cost only the redraw.
+ *	palette replaces the image's own palette outright; it's in the same
+ *	format (little-endian 5-6-5 words, PROGMEM), with at least as many
+ *	entries as the image uses.  map is then applied to each entry, once
+ *	per draw, as the palette is loaded into RAM; it needs the palette
+ *	cache (ST7735_PALETTE_CACHE, at least the palette's size), and is
+ *	ignored for palettes that don't fit.  The cache is used in 16-bit
+ *	mode too, while a map is set.
+ *	Pass NULL for either to turn it off.
+ *	@param palette	PROGMEM substitute palette, or NULL
+ *	@param map	color transform (5-6-5 in and out), or NULL
+ */
+void setPaletteMap(const uint8_t* palette, ST7735_ColorMap map) {
+
+	paletteSubst = palette;
+	paletteMap = map;
+
+}
+
+/**
+ *	Color maps for setPaletteMap().  Invert: photographic negative.
+ */
+uint16_t ST7735_mapInvert(uint16_t c) {
+
+	return ~c;
+
+}
+
+/**
+ *	Gray: luma (approximately 0.25 R + 0.625 G + 0.125 B), as 5-6-5 gray.
+ */
+uint16_t ST7735_mapGray(uint16_t c) {
+
+	uint8_t y;
+
+	//	Expand each channel to 6 bits
+	y = (((c >> 10) & 0x3e) * 2 + ((c >> 5) & 0x3f) * 5 + ((c << 1) & 0x3e)) >> 3;
+	return ((uint16_t)(y >> 1) << 11) | ((uint16_t)y << 5) | (y >> 1);
+
+}
+
+/**
+ *	Dim: every channel at half brightness.
+ */
+uint16_t ST7735_mapDim(uint16_t c) {
+
+	return (c >> 1) & 0x7bef;
+
+}
+
+/**
+ *	Looks up palette entry idx, as a pixel word.
+ */
+static inline uint16_t paletteColor(const uint8_t* palette, uint8_t idx, bool cached) {
+
+#if ST7735_PALETTE_CACHE
+	if (cached) {
+		return paletteCache[idx];
+	}
+#else
+	(void)cached;
+#endif // ST7735_PALETTE_CACHE
+	return convertColor(pgm_read_word(palette + 2 * idx));
+
+}
+
+/**
+ *	Looks up palette entry idx as a 5-6-5 color, mapped as for
+ *	paletteColor() (patterns work on the channels).
+ */
+static uint16_t paletteEntry(const uint8_t* palette, uint8_t idx, bool cached) {
+
+	uint16_t c = pgm_read_word(palette + 2 * idx);
+
+	if (cached && paletteMap) {
+		c = paletteMap(c);
+	}
+	return c;
+
+}
+
+/**
+ *	Prepares a palette for paletteColor(): substitutes it, if
+ *	setPaletteMap() says so; outside 16-bit mode, or with a color map
+ *	set, converts it into RAM (if it fits in ST7735_PALETTE_CACHE entries).
+ *	@param palette	PROGMEM palette; updated to the one to use
+ *	@param count	entries (1-256)
+ *	@return cached flag for paletteColor()
+ */
+static bool loadPalette(const uint8_t** palette, uint16_t count) {
+
+	if (paletteSubst) {
+		*palette = paletteSubst;
+	}
+#if ST7735_PALETTE_CACHE
+	if ((paletteMap || ST7735_panel->colorMode != ST7735_COLMOD_16BIT)
+			&& count <= ST7735_PALETTE_CACHE) {
+		uint16_t c;
+
+		do {
+			count--;
+			c = pgm_read_word(*palette + 2 * count);
+			if (paletteMap) {
+				c = paletteMap(c);
+			}
+			paletteCache[count] = convertColor(c);
+		} while (count);
+		return true;
+	}
+#else
+	(void)count;
+#endif // ST7735_PALETTE_CACHE
+	return false;
+
+}
+
+//	Clipping and scaling for drawCommands() (see drawImageRegion(),
+//	drawImageScaled())
+typedef struct {
+	int16_t x1, y1, x2, y2;	//	Visible part of the image, inclusive
+	const uint8_t* end;		//	Stop here (NULL: at the terminator)
+	uint8_t up, down;		//	Scale factor, up / down
+} ImageClip;
+
+/**
+ *	Screen offset of image coordinate i, scaled by clip->up / clip->down.
+ */
+static uint16_t scaleCoord(uint16_t i, const ImageClip* clip) {
+
+	uint32_t s = (uint32_t)i * clip->up / clip->down;
+
+	return (s > 0xffff) ? 0xffff : s;
+
+}
+
+/**
+ *	Draws one command scaled (see drawImageScaled()), nearest neighbour:
+ *	image pixel i covers screen pixels scaleCoord(i) up to scaleCoord(i + 1),
+ *	so pixels repeat (scaling up) or drop out (down), and neighbouring
+ *	commands still tile exactly.  Flats stay one window.  Bitmap columns
+ *	are read again from flash for each screen column they cover.
+ *	Clipped to the screen.
+ *	@param img	bitmap data (bitmap commands)
+ *	@return address following the command's data
+ */
+static const uint8_t* drawScaled(const uint8_t* palette, const uint8_t* img, uint8_t cmd,
+				uint8_t xStart, uint8_t yStart, uint8_t width, uint8_t height,
+				uint16_t x, uint16_t y, uint16_t colr, bool cached, const ImageClip* clip) {
+
+	uint16_t x1, y1, x2, y2;	//	Screen window, from (x, y); x2, y2 exclusive
+	uint16_t sx, sy, n, m, accX, accY;
+	uint8_t i, j;
+
+	x1 = scaleCoord(xStart, clip); x2 = scaleCoord(xStart + width, clip);
+	y1 = scaleCoord(yStart, clip); y2 = scaleCoord(yStart + height, clip);
+	if (x >= ST7735_panel->width || y >= ST7735_panel->height) {
+		x2 = 0; y2 = 0;
+	} else {
+		if (x2 > ST7735_panel->width - x) x2 = ST7735_panel->width - x;
+		if (y2 > ST7735_panel->height - y) y2 = ST7735_panel->height - y;
+	}
+	if (x1 < x2 && y1 < y2) {
+		beginPixels(x + x1, y + y1, x + x2 - 1, y + y2 - 1);
+		if (!(cmd & 0x10)) {
+			for (sx = x1; sx < x2; sx++) {
+				for (sy = y1; sy < y2; sy++) {
+					sendPixel(colr);
+				}
+			}
+		} else {
+			//	Columns, then rows: screen pixels each covers, by remainder
+			sx = x1;
+			accX = (uint32_t)xStart * clip->up % clip->down;
+			for (i = 0; i < width && sx < x2; i++) {
+				accX += clip->up;
+				for (; accX >= clip->down && sx < x2; accX -= clip->down, sx++) {
+					sy = y1;
+					accY = (uint32_t)yStart * clip->up % clip->down;
+					for (j = 0; j < height && sy < y2; j++) {
+						accY += clip->up;
+						for (n = 0; accY >= clip->down; n++) {
+							accY -= clip->down;
+						}
+						if (n) {
+							colr = paletteColor(palette, pgm_read_byte(img + (uint16_t)i * height + j), cached);
+							m = (sy + n > y2) ? y2 - sy : n;
+							sy += n;
+							do {
+								sendPixel(colr);
+							} while (--m);
+						}
+					}
+				}
+				accX %= clip->down;
+			}
+		}
+		endPixels();
+	}
+	if (cmd & 0x10) {
+		img += (uint16_t)width * height;
+	}
+	return img;
+
+}
+
+/**
+ *	Draws the part of one command inside clip: flats as their
+ *	intersection, bitmaps a column segment at a time, straight from
+ *	flash.  Scaled images go to drawScaled().
+ *	@param img	bitmap data (bitmap commands)
+ *	@return address following the command's data
+ */
+static const uint8_t* drawClipped(const uint8_t* palette, const uint8_t* img, uint8_t cmd,
+				uint8_t xStart, uint8_t yStart, uint8_t width, uint8_t height,
+				uint16_t x, uint16_t y, uint16_t colr, bool cached, const ImageClip* clip) {
+
+	int16_t x1, y1, x2, y2;	//	Part to draw, in the image; inclusive
+	uint8_t i, j;
+	uint16_t area;
+	const uint8_t* p;
+	const uint8_t* q;
+
+	if (clip->up != clip->down) {
+		return drawScaled(palette, img, cmd, xStart, yStart, width, height, x, y, colr, cached, clip);
+	}
+	x1 = (xStart > clip->x1) ? xStart : clip->x1;
+	y1 = (yStart > clip->y1) ? yStart : clip->y1;
+	x2 = (xStart + width - 1 < clip->x2) ? (int16_t)xStart + width - 1 : clip->x2;
+	y2 = (yStart + height - 1 < clip->y2) ? (int16_t)yStart + height - 1 : clip->y2;
+	if (x1 <= x2 && y1 <= y2) {
+		beginPixels(x + x1, y + y1, x + x2, y + y2);
+		if (cmd & 0x10) {			//	Columns, top to bottom
+			p = img + (uint16_t)(x1 - xStart) * height + (y1 - yStart);
+			i = x2 - x1;
+			do {
+				q = p;
+				j = y2 - y1;
+				do {
+					sendPixel(paletteColor(palette, pgm_read_byte(q++), cached));
+				} while (j--);
+				p += height;
+			} while (i--);
+		} else {
+			area = (uint16_t)(x2 - x1 + 1) * (y2 - y1 + 1);
+			do {
+				sendPixel(colr);
+			} while (--area);
+		}
+		endPixels();
+	}
+	if (cmd & 0x10) {
+		img += (uint16_t)width * height;
+	}
+	return img;
+
+}
+
+/**
+ *	Draws a pattern command (0x09; see drawPatternRectangle()), from
+ *	its parameters: kind, two colors (palette indices), xStart, yStart,
+ *	width and height.  Clipped as drawClipped() does; scaled, the
+ *	pattern is generated at the new size (checker squares scale too),
+ *	clipped to the screen.
+ *	@return address following the parameters
+ */
+static const uint8_t* drawPatternCommand(const uint8_t* palette, const uint8_t* img,
+				uint16_t x, uint16_t y, bool cached, const ImageClip* clip) {
+
+	uint8_t kind;
+	uint16_t colr1, colr2, n;
+	uint16_t xStart, yStart, width, height;	//	Location and size (scaled)
+	uint16_t x1, y1, x2, y2;	//	Part to draw, in the pattern; inclusive
+
+	kind = pgm_read_byte(img++);
+	colr1 = paletteEntry(palette, pgm_read_byte(img++), cached);
+	colr2 = paletteEntry(palette, pgm_read_byte(img++), cached);
+	xStart = pgm_read_byte(img++);
+	yStart = pgm_read_byte(img++);
+	width = pgm_read_byte(img++);
+	if (width == 0) width = 1;
+	height = pgm_read_byte(img++);
+	if (height == 0) height = 1;
+	x1 = 0; y1 = 0;
+	x2 = width - 1; y2 = height - 1;
+	if (clip && clip->up != clip->down) {
+		width = scaleCoord(xStart + width, clip) - scaleCoord(xStart, clip);
+		height = scaleCoord(yStart + height, clip) - scaleCoord(yStart, clip);
+		xStart = scaleCoord(xStart, clip);
+		yStart = scaleCoord(yStart, clip);
+		if ((kind & ST7735_PATTERN_TYPE_gm) == ST7735_PATTERN_CHECKER) {
+			n = (uint16_t)((kind >> 2) + 1) * clip->up / clip->down;
+			kind = ST7735_PATTERN_CHECKER_SIZE((n < 1) ? 1 : (n > 64) ? 64 : n);
+		}
+		x2 = width - 1; y2 = height - 1;
+		if (width == 0 || height == 0 || x >= ST7735_panel->width || y >= ST7735_panel->height
+				|| xStart >= ST7735_panel->width - x || yStart >= ST7735_panel->height - y) {
+			return img;
+		}
+		if (x2 > ST7735_panel->width - x - xStart - 1) x2 = ST7735_panel->width - x - xStart - 1;
+		if (y2 > ST7735_panel->height - y - yStart - 1) y2 = ST7735_panel->height - y - yStart - 1;
+	} else if (clip) {
+		if (clip->x2 < (int16_t)xStart || clip->y2 < (int16_t)yStart) {
+			return img;
+		}
+		if ((int16_t)xStart < clip->x1) x1 = clip->x1 - xStart;
+		if ((int16_t)yStart < clip->y1) y1 = clip->y1 - yStart;
+		if ((int16_t)(xStart + x2) > clip->x2) x2 = clip->x2 - xStart;
+		if ((int16_t)(yStart + y2) > clip->y2) y2 = clip->y2 - yStart;
+		if (x1 > x2 || y1 > y2) {
+			return img;
+		}
+	}
+	beginPixels(x + xStart + x1, y + yStart + y1, x + xStart + x2, y + yStart + y2);
+	sendPattern(kind, colr1, colr2, width, height, x1, y1, x2 - x1 + 1, y2 - y1 + 1);
+	endPixels();
+	return img;
+
+}
+
+/**
+ *	Draws an image's command stream, up to and including its
+ *	terminator, as one batch.  A copy command (0x16) draws its source
+ *	command's bitmap straight from flash, then carries on after itself.
+ *	Flat commands with 0x20 set draw in the current color (the last
+ *	color parameter read) and carry none; Repeat (0x07, count) runs the
+ *	previous instruction again on each of the next count parameter
+ *	blocks (count 0 = 256).  Skip (0x08, length WORD) passes over an
+ *	index section.  Pattern (0x09) is generated (drawPatternCommand()),
+ *	and leaves the current color alone.
+ *	@param palette	PROGMEM palette
+ *	@param img	PROGMEM commands
+ *	@param x	x and...
+ *	@param y	y coordinate to draw at
+ *	@param cached	from loadPalette()
+ *	@param clip	part of the image to draw, where to stop, and scale (NULL: all, 1:1)
+ *	@return address following the terminator
+ */
+static const uint8_t* drawCommands(const uint8_t* palette, const uint8_t* img,
+				uint16_t x, uint16_t y, bool cached, const ImageClip* clip) {
+
+	uint8_t cmd;	//	Command/instruction byte
+	uint8_t op = 0;	//	Instruction being run (kept for Repeat)
+	uint16_t repeat = 0;	//	Parameter blocks left to run it on
+	uint8_t xStart, yStart, width, height;	//	Location (or length) parameters
+	uint16_t area;	//	number of bitmap pixels to read
+	uint16_t colr = 0;	//	Current color (pixel word, see convertColor())
+	const uint8_t* resume = NULL;	//	Where to continue after a copy
+
+	ST7735_beginBatch();
 	do {
+		if (clip && img == clip->end) {
+			ST7735_endBatch();
+			ST7735_MARK(ST7735_BENCH_IDLE);
+			return img;
+		}
 		//	Get instruction
-		cmd = pgm_read_byte(img++);
+		if (repeat) {
+			repeat--;				//	Repeating: parameters only
+		} else if ((cmd = pgm_read_byte(img++)) == 0x07) {
+			repeat = pgm_read_byte(img++);	//	Repeat: count, then that many parameter blocks
+			if (repeat == 0) repeat = 256;
+			repeat--;
+		} else {
+			op = cmd;
+		}
+		cmd = op;
+		ST7735_MARK(cmd);
 		//	Process single-byte commands
 		if ((cmd & 0x0f) == 0) {			//	No Operation
 			width = 0;
 		} else if (cmd == 0xff) {		//	Terminate
-			return;
+			ST7735_endBatch();
+			ST7735_MARK(ST7735_BENCH_IDLE);
+			return img;
+		} else if (cmd == 0x08) {		//	Skip: index section
+			img += 2 + pgm_read_word(img);
+			width = 0;
+		} else if (cmd == 0x09) {		//	Pattern: generated as it's sent
+			img = drawPatternCommand(palette, img, x, y, cached, clip);
+			width = 0;
 		} else {
 			//	Read multi-byte command parameters
-			if (!(cmd & 0x10)) {		//	No bitmap flag, read color
-				colr = pgm_read_word(palette + 2 * pgm_read_byte(img++));
+			if (cmd == 0x16) {			//	Copy: redraw an earlier bitmap command here
+				area = pgm_read_word(img);	//	  (borrow area for the offset)
+				xStart = pgm_read_byte(img + 2);
+				yStart = pgm_read_byte(img + 3);
+				resume = img + 4;
+				img -= 1 + area;		//	Source command: take its size and data
+				cmd = pgm_read_byte(img);
+				img += 3;
+			} else {
+				if (!(cmd & 0x30)) {		//	No bitmap or current color flag, read color
+					colr = paletteColor(palette, pgm_read_byte(img++), cached);
+				}
+				//	Get xStart, yStart
+				xStart = pgm_read_byte(img++);
+				yStart = pgm_read_byte(img++);
 			}
-			//	Get xStart, yStart
-			xStart = pgm_read_byte(img++);
-			yStart = pgm_read_byte(img++);
 			width = 1; height = 1;		//	Assume pixel (implicit width and height)...
 			if ((cmd & 0x0f) != 1) {		//	Not pixel: Get width or more
 				width = pgm_read_byte(img++);	//	Assume horizontal line...
@@ -302,22 +1724,1272 @@ void drawImage(const uint8_t* img, const uint8_t x, const uint8_t y) {
 		}
 
 		//	Decoded something?  Write to display
-		if (width) {
+		if (width && clip && (clip->up != clip->down || xStart < clip->x1 || yStart < clip->y1
+				|| xStart + width - 1 > clip->x2 || yStart + height - 1 > clip->y2)) {
+			img = drawClipped(palette, img, cmd, xStart, yStart, width, height, x, y, colr, cached, clip);
+			if (resume) {
+				img = resume;
+				resume = NULL;
+			}
+		} else if (width) {
 			//	Draw Bitmap Rectangle
 			area = width * height;
-			setScreenRegion(x + xStart, y + yStart, x + xStart + width - 1, y + yStart + height - 1);
-			ST7735_beginCommand();
-			ST7735_sendByte(ST7735_RAMWR);
-			ST7735_commandToData();
-			do {
-				if (cmd & 0x10) {	//	Bitmap flag, gotta get pixel data
-					colr = pgm_read_word(palette + 2 * pgm_read_byte(img++));
-				}
-				ST7735_sendByte(colr >> 8);
-				ST7735_sendByte(colr & 0xff);
-			} while (--area);
-			ST7735_endTransaction();
+			beginPixels(x + xStart, y + yStart, x + xStart + width - 1, y + yStart + height - 1);
+			if (cmd & 0x10) {		//	Bitmap flag, gotta get pixel data
+				do {
+					sendPixel(paletteColor(palette, pgm_read_byte(img++), cached));
+				} while (--area);
+			} else {
+				do {
+					sendPixel(colr);
+				} while (--area);
+			}
+			endPixels();
+			if (resume) {
+				img = resume;
+				resume = NULL;
+			}
 		}
 	} while (1);
 
 }
+
+/**
+ *	Draw image starting at the specified location.
+ *	(Use the ST7735 Compressor tool to generate code.)
+ *	Overdraw past the edge of the screen is discarded.
+ *	Outside 16-bit mode, the palette is converted into RAM once per
+ *	call (if it fits in ST7735_PALETTE_CACHE entries); else, colors
+ *	are converted as they're read.
+ *	The whole image is drawn as one batch (one CS assertion).
+ *	@param img	PROGMEM image (encoded) buffer to draw
+ *	@param x	x and...
+ *	@param y	y coordinate to draw image at, referenced to top-left corner
+ */
+void drawImage(const uint8_t* img, uint16_t x, uint16_t y) {
+
+	uint16_t count;
+	const uint8_t* palette = img + 1;
+	bool cached;
+
+	count = pgm_read_byte(img);
+	if (count == 0) count = 256;
+	cached = loadPalette(&palette, count);
+	drawCommands(palette, img + 1 + 2 * count, x, y, cached, NULL);
+
+}
+
+/**
+ *	Draw part of an image: the width x height pixels at (xSrc, ySrc) in
+ *	the image, with that corner at (x, y) on screen.  Commands are
+ *	clipped to it.  If the image starts with a band index (compr.html,
+ *	"Band index"), only the bands the part overlaps are read, so
+ *	panning a viewport over a large image costs about as much as the
+ *	rows it shows; otherwise the whole stream is read.
+ *	Index: Skip (0x08), length WORD, then band height BYTE, band count
+ *	BYTE (0 = 256), and for each band the offset (WORD, from the end of
+ *	the index) of its first command, and the first band (BYTE) whose
+ *	commands reach down into it.  Commands are sorted by band (of their
+ *	top edge), and each band starts from a clean state (its own
+ *	instruction, and a color).
+ *	@param img	PROGMEM image (encoded) buffer to draw
+ *	@param xSrc	x and...
+ *	@param ySrc	y of the part to draw, in the image
+ *	@param width	width and...
+ *	@param height	height of the part to draw
+ *	@param x	x and...
+ *	@param y	y coordinate to draw it at
+ */
+void drawImageRegion(const uint8_t* img, uint8_t xSrc, uint8_t ySrc,
+				uint16_t width, uint16_t height, uint16_t x, uint16_t y) {
+
+	uint16_t count;
+	uint8_t band, b1, b2, last;	//	Band height, first and last band drawn, last band
+	const uint8_t* cmds;
+	const uint8_t* index;
+	const uint8_t* palette;
+	bool cached;
+	ImageClip clip;
+
+	if (width == 0 || height == 0) return;
+	clip.x1 = xSrc; clip.y1 = ySrc;
+	clip.x2 = (xSrc + width - 1 > 0xff) ? 0xff : xSrc + width - 1;
+	clip.y2 = (ySrc + height - 1 > 0xff) ? 0xff : ySrc + height - 1;
+	clip.end = NULL;
+	clip.up = 1; clip.down = 1;
+	count = pgm_read_byte(img);
+	if (count == 0) count = 256;
+	cmds = img + 1 + 2 * count;
+	if (pgm_read_byte(cmds) == 0x08) {
+		index = cmds + 3;
+		cmds = index + pgm_read_word(cmds + 1);
+		band = pgm_read_byte(index);
+		last = pgm_read_byte(index + 1) - 1;	//	(count 0 = 256)
+		index += 2;
+		b1 = clip.y1 / band;
+		b2 = clip.y2 / band;
+		if (b1 > last) return;
+		if (b2 < last) {
+			clip.end = cmds + pgm_read_word(index + 3 * (b2 + 1));
+		}
+		b1 = pgm_read_byte(index + 3 * b1 + 2);	//	Start where commands reach into it
+		cmds += pgm_read_word(index + 3 * b1);
+	}
+	palette = img + 1;
+	cached = loadPalette(&palette, count);
+	drawCommands(palette, cmds, x - xSrc, y - ySrc, cached, &clip);
+
+}
+
+/**
+ *	Draw image scaled by up / down, nearest neighbour, with its top-left
+ *	corner at the specified location: integer scaling up (down = 1),
+ *	decimating down (up = 1), or any ratio.  Flat commands stay one
+ *	window each, so scale at no extra SPI cost beyond their pixels;
+ *	bitmaps repeat (or skip) pixels and columns as they're sent.  Nothing
+ *	is buffered.  Clipped to the screen.
+ *	@param img	PROGMEM image (encoded) buffer to draw
+ *	@param x	x and...
+ *	@param y	y coordinate to draw image at
+ *	@param up	scale factor numerator and...
+ *	@param down	denominator (1-255)
+ */
+void drawImageScaled(const uint8_t* img, uint16_t x, uint16_t y, uint8_t up, uint8_t down) {
+
+	uint16_t count;
+	const uint8_t* palette = img + 1;
+	bool cached;
+	ImageClip clip;
+
+	if (up == 0 || down == 0) return;
+	clip.x1 = 0; clip.y1 = 0; clip.x2 = 0xff; clip.y2 = 0xff;
+	clip.end = NULL;
+	clip.up = up; clip.down = down;
+	count = pgm_read_byte(img);
+	if (count == 0) count = 256;
+	cached = loadPalette(&palette, count);
+	drawCommands(palette, img + 1 + 2 * count, x, y, cached, &clip);
+
+}
+
+//	Huffman code table (see drawHuffImage()), with its lookup table:
+//	symbol and code length, indexed by the next ST7735_HUFF_FAST_BITS
+//	bits; length 0 if the code is longer
+typedef struct {
+	const uint8_t* counts;	//	Codes per length (PROGMEM)
+	const uint8_t* symbols;	//	Symbols in code order (PROGMEM)
+	uint16_t first;			//	First code longer than the lookup table, and...
+	uint16_t index;			//	  its symbol's index
+	uint8_t sym[1 << ST7735_HUFF_FAST_BITS];
+	uint8_t len[1 << ST7735_HUFF_FAST_BITS];
+} HuffTable;
+
+//	Tables: instructions, geometry (coordinates, sizes), palette indices
+static HuffTable huffCmd, huffGeom, huffIndex;
+
+//	Huffman bitstream reader
+typedef struct {
+	const uint8_t* src;		//	Bitstream (PROGMEM), next byte
+	uint16_t bits;			//	Bit buffer, MSB first
+	uint8_t nbits;			//	Valid bits in buffer
+} HuffStream;
+
+/**
+ *	Reads a code table and fills its lookup table.
+ *	@param t	table
+ *	@param p	PROGMEM code table (counts, symbols)
+ *	@return address following the code table
+ */
+static const uint8_t* huffTable(HuffTable* t, const uint8_t* p) {
+
+	uint16_t code = 0, total = 0;
+	uint8_t len, count, n, i;
+	const uint8_t* sym;
+
+	t->counts = p;
+	for (len = 0; len < ST7735_HUFF_MAX_BITS; len++) {
+		total += pgm_read_byte(p + len);
+	}
+	t->symbols = p + ST7735_HUFF_MAX_BITS;
+
+	for (code = 0; code < sizeof(t->len); code++) {
+		t->len[code] = 0;
+	}
+	code = 0;
+	sym = t->symbols;
+	for (len = 1; len <= ST7735_HUFF_FAST_BITS; len++) {
+		count = pgm_read_byte(t->counts + len - 1);
+		while (count--) {
+			//	Every index starting with this code
+			i = code << (ST7735_HUFF_FAST_BITS - len);
+			n = 1 << (ST7735_HUFF_FAST_BITS - len);
+			do {
+				t->sym[i] = pgm_read_byte(sym);
+				t->len[i] = len;
+				i++;
+			} while (--n);
+			sym++;
+			code++;
+		}
+		code <<= 1;
+	}
+	t->first = code;
+	t->index = sym - t->symbols;
+	return t->symbols + total;
+
+}
+
+/**
+ *	Decodes one byte.  Codes up to ST7735_HUFF_FAST_BITS long take one
+ *	table lookup; longer ones are decoded canonically, a bit at a time,
+ *	from where the table leaves off.
+ *	@param h	bitstream
+ *	@param t	code table for this byte
+ *	@return decoded byte (0xff, terminate, on an invalid code)
+ */
+static uint8_t huffByte(HuffStream* h, const HuffTable* t) {
+
+	uint8_t i, len;
+	uint16_t code, first, index, count;
+
+	if (h->nbits <= 8) {
+		h->bits |= (uint16_t)pgm_read_byte(h->src++) << (8 - h->nbits);
+		h->nbits += 8;
+	}
+	i = h->bits >> (16 - ST7735_HUFF_FAST_BITS);
+	len = t->len[i];
+	if (len) {
+		h->bits <<= len;
+		h->nbits -= len;
+		return t->sym[i];
+	}
+
+	code = i;
+	h->bits <<= ST7735_HUFF_FAST_BITS;
+	h->nbits -= ST7735_HUFF_FAST_BITS;
+	first = t->first; index = t->index;
+	for (len = ST7735_HUFF_FAST_BITS + 1; len <= ST7735_HUFF_MAX_BITS; len++) {
+		if (h->nbits == 0) {
+			h->bits = (uint16_t)pgm_read_byte(h->src++) << 8;
+			h->nbits = 8;
+		}
+		code = (code << 1) | (h->bits >> 15);
+		h->bits <<= 1;
+		h->nbits--;
+		count = pgm_read_byte(t->counts + len - 1);
+		if (code < first + count) {
+			return pgm_read_byte(t->symbols + index + code - first);
+		}
+		index += count;
+		first = (first + count) << 1;
+	}
+	return 0xff;
+
+}
+
+/**
+ *	Draw Huffman coded image starting at the specified location.
+ *	(compr.html, "Huffman" output.)  Same as drawImage(), but the
+ *	command stream is entropy coded, byte by byte, with code tables
+ *	made for the image: one for instruction bytes, one for coordinates
+ *	and sizes, and one for palette indices (colors and bitmap data).
+ *	Format: palette as for drawImage(); the three code tables, each
+ *	code lengths (ST7735_HUFF_MAX_BITS bytes: number of codes 1, 2, ...
+ *	bits long) then the symbols in canonical code order; then the
+ *	bitstream, MSB first, and a byte of padding (huffByte() reads a
+ *	byte ahead, which may be past the last code).  Repeat counts are
+ *	coded as geometry, and so is a pattern's kind.
+ *	Copy commands are not allowed (the stream can't be read backwards).
+ *	@param img	PROGMEM image (encoded) buffer to draw
+ *	@param x	x and...
+ *	@param y	y coordinate to draw image at, referenced to top-left corner
+ */
+void drawHuffImage(const uint8_t* img, uint16_t x, uint16_t y) {
+
+	const uint8_t* palette;
+	HuffStream h;
+	uint8_t cmd;	//	Command/instruction byte
+	uint8_t op = 0;	//	Instruction being run (kept for Repeat)
+	uint16_t repeat = 0;	//	Parameter blocks left to run it on
+	uint8_t xStart, yStart, width, height;	//	Location (or length) parameters
+	uint16_t area;	//	number of bitmap pixels to read
+	uint16_t colr = 0;	//	Current color (pixel word, see convertColor())
+	uint16_t colr2;	//	Pattern colors (5-6-5)
+	uint8_t kind;	//	  and kind
+	bool cached;
+
+	palette = img + 1;
+	area = pgm_read_byte(img);
+	if (area == 0) area = 256;
+	img = huffTable(&huffCmd, palette + 2 * area);
+	img = huffTable(&huffGeom, img);
+	h.src = huffTable(&huffIndex, img);
+	h.bits = 0; h.nbits = 0;
+	cached = loadPalette(&palette, area);
+
+	ST7735_beginBatch();
+	do {
+		if (repeat) {
+			repeat--;
+		} else if ((cmd = huffByte(&h, &huffCmd)) == 0x07) {
+			repeat = huffByte(&h, &huffGeom);
+			if (repeat == 0) repeat = 256;
+			repeat--;
+		} else {
+			op = cmd;
+		}
+		cmd = op;
+		ST7735_MARK(cmd);
+		if ((cmd & 0x0f) == 0) {			//	No Operation
+			width = 0;
+		} else if (cmd == 0xff) {		//	Terminate
+			ST7735_endBatch();
+			ST7735_MARK(ST7735_BENCH_IDLE);
+			return;
+		} else if (cmd == 0x09) {		//	Pattern (unclipped, so drawn here)
+			kind = huffByte(&h, &huffGeom);
+			area = paletteEntry(palette, huffByte(&h, &huffIndex), cached);	//	  (borrow area for the first color)
+			colr2 = paletteEntry(palette, huffByte(&h, &huffIndex), cached);
+			xStart = huffByte(&h, &huffGeom);
+			yStart = huffByte(&h, &huffGeom);
+			width = huffByte(&h, &huffGeom);
+			if (width == 0) width = 1;
+			height = huffByte(&h, &huffGeom);
+			if (height == 0) height = 1;
+			beginPixels(x + xStart, y + yStart, x + xStart + width - 1, y + yStart + height - 1);
+			sendPattern(kind, area, colr2, width, height, 0, 0, width, height);
+			endPixels();
+			width = 0;
+		} else {
+			if (!(cmd & 0x30)) {		//	No bitmap or current color flag, read color
+				colr = paletteColor(palette, huffByte(&h, &huffIndex), cached);
+			}
+			xStart = huffByte(&h, &huffGeom);
+			yStart = huffByte(&h, &huffGeom);
+			width = 1; height = 1;
+			if ((cmd & 0x0f) != 1) {
+				width = huffByte(&h, &huffGeom);
+				if (width == 0) width = 1;
+				if ((cmd & 0x0f) == 3) {
+					height = width;
+					width = 1;
+				} else if ((cmd & 0x0f) == 5) {
+					height = huffByte(&h, &huffGeom);
+					if (height == 0) height = 1;
+				}
+			}
+		}
+
+		if (width) {
+			area = width * height;
+			beginPixels(x + xStart, y + yStart, x + xStart + width - 1, y + yStart + height - 1);
+			if (cmd & 0x10) {
+				do {
+					sendPixel(paletteColor(palette, huffByte(&h, &huffIndex), cached));
+				} while (--area);
+			} else {
+				do {
+					sendPixel(colr);
+				} while (--area);
+			}
+			endPixels();
+		}
+	} while (1);
+
+}
+
+/**
+ *	Draw image rotated and/or mirrored, with its top-left corner (after
+ *	transformation) at the specified location.  Rather than transforming
+ *	pixels, MADCTL is temporarily set so the controller's address order
+ *	does the work; the cost is two MADCTL writes per image.
+ *	The transformed image must lie within the screen.
+ *	@param img	PROGMEM image (encoded) buffer to draw
+ *	@param x	x and...
+ *	@param y	y coordinate to draw image at
+ *	@param width	width and...
+ *	@param height	height of the image, untransformed (HEADER_NAME_WIDTH/_HEIGHT)
+ *	@param orient	ST7735_ORIENT_ROTx, optionally | ST7735_ORIENT_MIRROR
+ */
+void drawImageOriented(const uint8_t* img, uint16_t x, uint16_t y,
+				uint16_t width, uint16_t height, uint8_t orient) {
+
+	uint16_t t;
+	uint8_t inverse;
+
+	//	Screen area covered by the transformed image
+	if (orient & 0x01) {
+		t = width; width = height; height = t;
+	}
+	//	Map that area back into the image's own frame
+	if (orient & ST7735_ORIENT_MIRROR) {
+		inverse = orient;
+	} else {
+		inverse = (-orient) & ST7735_ORIENT_ROT_gm;
+	}
+	transformRect(inverse, &x, &y, &width, &height,
+			ST7735_panel->width, ST7735_panel->height);
+
+	ST7735_beginBatch();
+	writeMadctl(composeOrientation(ST7735_panel->orientation, orient));
+	drawImage(img, x, y);
+	writeMadctl(ST7735_panel->orientation);
+	ST7735_endBatch();
+
+}
+
+/**
+ *	Starts an animation (compr.html, multiple frames, C Header output):
+ *	frame 0 is drawn now, the rest by updateAnimation().
+ *	Animation format: palette as for drawImage(), a frame count byte N,
+ *	then N + 1 frame records, each a delay byte (in 10 ms units, 0 =
+ *	2.56 s) and commands (as for drawImage(), through the terminator).
+ *	Record 0 is the full first frame; records 1 to N-1 draw only what
+ *	changed from the previous frame; record N changes the last frame
+ *	back into the first, so the animation loops through records
+ *	1 to N.
+ *	@param a	animation state
+ *	@param anim	PROGMEM animation
+ *	@param x	x and...
+ *	@param y	y coordinate to draw at, referenced to top-left corner
+ *	@param now	current time, in ms
+ */
+void startAnimation(ST7735_Animation* a, const uint8_t* anim,
+				uint16_t x, uint16_t y, uint16_t now) {
+
+	uint16_t count;
+
+	count = pgm_read_byte(anim);
+	if (count == 0) count = 256;
+	a->palette = anim + 1;
+	a->paletteCount = count;
+	anim += 1 + 2 * count;
+	a->count = pgm_read_byte(anim);
+	a->frame = anim + 1;
+	a->index = 0;
+	a->x = x; a->y = y;
+	a->due = now;
+	updateAnimation(a, now);
+	a->loop = a->frame;
+
+}
+
+/**
+ *	Draws the next frame of an animation, if it's due.  Call often;
+ *	frames are timed from when each was due, not when it was drawn,
+ *	so late calls don't accumulate drift.
+ *	@param a	animation state, from startAnimation()
+ *	@param now	current time, in ms (wraps at 65.536 s)
+ *	@return true if a frame was drawn
+ */
+bool updateAnimation(ST7735_Animation* a, uint16_t now) {
+
+	uint8_t delay;
+	const uint8_t* palette = a->palette;
+	bool cached;
+
+	if ((int16_t)(now - a->due) < 0) {
+		return false;
+	}
+	delay = pgm_read_byte(a->frame);
+	a->due += (delay ? delay : 256) * 10u;
+	cached = loadPalette(&palette, a->paletteCount);
+	a->frame = drawCommands(palette, a->frame + 1, a->x, a->y, cached, NULL);
+	if (a->index++ == a->count) {
+		a->index = 1;
+		a->frame = a->loop;
+	}
+	return true;
+
+}
+
+/**
+ *	Plays an animation through once, ending on its last frame.
+ *	Blocks for the duration (see delay_ms()).
+ *	@param anim	PROGMEM animation
+ *	@param x	x and...
+ *	@param y	y coordinate to draw at, referenced to top-left corner
+ */
+void playAnimation(const uint8_t* anim, uint16_t x, uint16_t y) {
+
+	ST7735_Animation a;
+	uint16_t now = 0;
+
+	startAnimation(&a, anim, x, y, now);
+	while (a.index < a.count) {
+		delay_ms(a.due - now);
+		now = a.due;
+		updateAnimation(&a, now);
+	}
+
+}
+
+/**
+ *	Starts recording a display list: a frame's fills and images, kept
+ *	(in the caller's array) so drawDisplayList() can send only what
+ *	stays visible.  Items are in drawing order: later ones cover
+ *	earlier ones.
+ *	@param dl	list to start
+ *	@param items	array to record into...
+ *	@param size	  of this many items
+ */
+void startDisplayList(ST7735_DisplayList* dl, ST7735_DrawItem* items, uint8_t size) {
+
+	dl->items = items;
+	dl->size = size;
+	dl->count = 0;
+	dl->area = 0;
+	dl->drawn = 0;
+
+}
+
+/**
+ *	Records a fill (see drawfillRectangle()).
+ *	@return false if the list is full (nothing recorded)
+ */
+bool addFillRectangle(ST7735_DisplayList* dl, uint16_t colr, uint16_t xStart, uint16_t yStart,
+				uint16_t width, uint16_t height) {
+
+	ST7735_DrawItem* d;
+
+	if (dl->count >= dl->size) {
+		return false;
+	}
+	d = dl->items + dl->count++;
+	d->img = NULL;
+	d->colr = colr;
+	d->x = xStart; d->y = yStart;
+	d->width = width; d->height = height;
+	d->opaque = true;
+	dl->area += (uint32_t)width * height;
+	return true;
+
+}
+
+/**
+ *	Records an image (see drawImage()).  The list needs its size, which
+ *	the image doesn't carry.
+ *	@param img	PROGMEM image (encoded)
+ *	@param width	width and...
+ *	@param height	height of the image (HEADER_NAME_WIDTH/_HEIGHT)
+ *	@param opaque	true if it covers its whole rectangle (no transparent
+ *			pixels), so hides what's under it
+ *	@return false if the list is full (nothing recorded)
+ */
+bool addImage(ST7735_DisplayList* dl, const uint8_t* img, uint16_t x, uint16_t y,
+				uint16_t width, uint16_t height, bool opaque) {
+
+	ST7735_DrawItem* d;
+
+	if (dl->count >= dl->size) {
+		return false;
+	}
+	d = dl->items + dl->count++;
+	d->img = img;
+	d->x = x; d->y = y;
+	d->width = width; d->height = height;
+	d->opaque = opaque;
+	dl->area += (uint32_t)width * height;
+	return true;
+
+}
+
+/**
+ *	Draws the part of item i within (x1, y1)-(x2, y2) (inclusive) that
+ *	no opaque item from j on covers: finds the first that overlaps it,
+ *	and recurses on the (up to four) pieces around it.  At depth
+ *	ST7735_DISPLAY_DEPTH, draws the piece whole: items above it still
+ *	paint over it afterwards.
+ */
+static void drawVisible(ST7735_DisplayList* dl, uint8_t i, uint8_t j, uint8_t depth,
+				uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2) {
+
+	const ST7735_DrawItem* d = dl->items + i;
+	const ST7735_DrawItem* o = NULL;
+	uint16_t ox1, oy1, ox2, oy2;
+
+	if (depth >= ST7735_DISPLAY_DEPTH) {
+		j = dl->count;
+	}
+	for (; j < dl->count; j++) {
+		o = dl->items + j;
+		if (o->opaque && o->width && o->height
+				&& o->x <= x2 && o->x + o->width - 1 >= x1
+				&& o->y <= y2 && o->y + o->height - 1 >= y1) {
+			break;
+		}
+	}
+	if (j >= dl->count) {
+		dl->drawn += (uint32_t)(x2 - x1 + 1) * (y2 - y1 + 1);
+		if (d->img) {
+			drawImageRegion(d->img, x1 - d->x, y1 - d->y, x2 - x1 + 1, y2 - y1 + 1, x1, y1);
+		} else {
+			drawfillRectangle(d->colr, x1, y1, x2 - x1 + 1, y2 - y1 + 1);
+		}
+		return;
+	}
+	ox1 = (o->x > x1) ? o->x : x1;
+	oy1 = (o->y > y1) ? o->y : y1;
+	ox2 = (o->x + o->width - 1 < x2) ? o->x + o->width - 1 : x2;
+	oy2 = (o->y + o->height - 1 < y2) ? o->y + o->height - 1 : y2;
+	//	Full height strips left and right of the occluder (columns are
+	//	the RAM order), then what's above and below it
+	if (ox1 > x1) {
+		drawVisible(dl, i, j + 1, depth + 1, x1, y1, ox1 - 1, y2);
+	}
+	if (ox2 < x2) {
+		drawVisible(dl, i, j + 1, depth + 1, ox2 + 1, y1, x2, y2);
+	}
+	if (oy1 > y1) {
+		drawVisible(dl, i, j + 1, depth + 1, ox1, y1, ox2, oy1 - 1);
+	}
+	if (oy2 < y2) {
+		drawVisible(dl, i, j + 1, depth + 1, ox1, oy2 + 1, ox2, y2);
+	}
+
+}
+
+/**
+ *	Draws a display list, back to front, in one batch, sending only the
+ *	visible parts of each item (on screen): fills split into rectangles around the
+ *	opaque items over them, images clipped the same way (through
+ *	drawImageRegion(), which reads only the bands needed if the image
+ *	has a band index).  dl->area against dl->drawn is the overdraw saved.
+ *	Recursion takes a stack frame per covering item, up to
+ *	ST7735_DISPLAY_DEPTH deep; past that, pieces are drawn and then
+ *	overdrawn.
+ */
+void drawDisplayList(ST7735_DisplayList* dl) {
+
+	uint8_t i;
+	const ST7735_DrawItem* d;
+	uint16_t x2, y2;
+
+	dl->drawn = 0;
+	ST7735_beginBatch();
+	for (i = 0; i < dl->count; i++) {
+		d = dl->items + i;
+		if (d->width == 0 || d->height == 0
+				|| d->x >= ST7735_panel->width || d->y >= ST7735_panel->height) {
+			continue;
+		}
+		//	Clipped to the screen
+		x2 = d->x + d->width - 1;
+		if (x2 >= ST7735_panel->width) x2 = ST7735_panel->width - 1;
+		y2 = d->y + d->height - 1;
+		if (y2 >= ST7735_panel->height) y2 = ST7735_panel->height - 1;
+		drawVisible(dl, i, i + 1, 0, d->x, d->y, x2, y2);
+	}
+	ST7735_endBatch();
+
+}
+
+/**
+ *	Sets up a text widget: len characters of font, in fixed cells,
+ *	initially blank.  Only characters that change are repainted.
+ *	@param font	glyphs (each an image, filling its cell)
+ *	@param len	characters (up to ST7735_WIDGET_TEXT)
+ *	@param back	color for blank cells (characters not in the font)
+ */
+void initTextWidget(ST7735_Widget* w, uint16_t x, uint16_t y,
+				const ST7735_Font* font, uint8_t len, uint16_t back) {
+
+	uint8_t i;
+
+	if (len > ST7735_WIDGET_TEXT) len = ST7735_WIDGET_TEXT;
+	w->type = ST7735_WIDGET_TEXTBOX;
+	w->x = x; w->y = y;
+	w->width = (uint16_t)font->width * len;
+	w->height = font->height;
+	w->font = font;
+	w->len = len;
+	w->back = back;
+	for (i = 0; i < len; i++) {
+		w->text[i] = ' ';
+		w->shown[i] = 0;		//	Nothing drawn yet: paint every cell
+	}
+	w->dirty = true;
+
+}
+
+/**
+ *	Sets up a bar graph widget: filled from the left in proportion to
+ *	its value (0 to max), the rest in the background color.  Changes
+ *	repaint only the part between the old and new ends.
+ */
+void initBarWidget(ST7735_Widget* w, uint16_t x, uint16_t y, uint16_t width, uint16_t height,
+				uint16_t max, uint16_t colr, uint16_t back) {
+
+	w->type = ST7735_WIDGET_BAR;
+	w->x = x; w->y = y;
+	w->width = width; w->height = height;
+	w->max = max ? max : 1;
+	w->value = 0;
+	w->colr = colr;
+	w->back = back;
+	w->drawn = 0xffff;		//	Nothing drawn yet: paint it all
+	w->dirty = true;
+
+}
+
+/**
+ *	Sets up an icon widget: an image (see drawImage()), repainted
+ *	whole when it's changed.
+ */
+void initIconWidget(ST7735_Widget* w, uint16_t x, uint16_t y, const uint8_t* img) {
+
+	w->type = ST7735_WIDGET_ICON;
+	w->x = x; w->y = y;
+	w->img = img;
+	w->dirty = true;
+
+}
+
+/**
+ *	Sets a text widget's text (padded with spaces, or cut, to its
+ *	length); invalidates it if that changed anything.
+ */
+void setWidgetText(ST7735_Widget* w, const char* s) {
+
+	uint8_t i;
+	char c;
+
+	for (i = 0; i < w->len; i++) {
+		c = *s ? *s++ : ' ';
+		if (w->text[i] != c) {
+			w->text[i] = c;
+			w->dirty = true;
+		}
+	}
+
+}
+
+/**
+ *	Sets a text widget to a number, right justified; too long to fit,
+ *	it shows as all '#'.  A zero length widget shows nothing.
+ */
+void setWidgetNumber(ST7735_Widget* w, int16_t n) {
+
+	char buf[ST7735_WIDGET_TEXT + 1];
+	uint8_t i = w->len;
+	uint16_t u = (n < 0) ? -(uint16_t)n : n;
+
+	if (i == 0) {
+		return;
+	}
+	buf[i] = 0;
+	do {
+		buf[--i] = '0' + u % 10;
+		u /= 10;
+	} while (u && i);
+	if (n < 0 && i) {
+		buf[--i] = '-';
+	} else if (n < 0 || u) {
+		i = w->len;
+		while (i) buf[--i] = '#';
+	}
+	while (i) {
+		buf[--i] = ' ';
+	}
+	setWidgetText(w, buf);
+
+}
+
+/**
+ *	Filled length of a bar graph widget, in pixels, at value.
+ */
+static uint16_t barLength(const ST7735_Widget* w, uint16_t value) {
+
+	return (uint32_t)value * w->width / w->max;
+
+}
+
+/**
+ *	Sets a bar graph widget's value (clamped to its max); invalidates
+ *	it if the filled length changes.
+ */
+void setWidgetValue(ST7735_Widget* w, uint16_t value) {
+
+	if (value > w->max) value = w->max;
+	if (barLength(w, value) != barLength(w, w->value)) {
+		w->dirty = true;
+	}
+	w->value = value;
+
+}
+
+/**
+ *	Sets an icon widget's image; invalidates it if it's a different one.
+ */
+void setWidgetImage(ST7735_Widget* w, const uint8_t* img) {
+
+	if (w->img != img) {
+		w->img = img;
+		w->dirty = true;
+	}
+
+}
+
+/**
+ *	Repaints whatever changed in a set of widgets (a screen), in one
+ *	batch: call once per frame, after setting their properties.  Text
+ *	widgets repaint the cells that changed; bars, the span between old
+ *	and new ends; icons, the whole image.
+ *	@param w	array of widgets...
+ *	@param count	  this many
+ */
+void updateWidgets(ST7735_Widget* w, uint8_t count) {
+
+	uint8_t i;
+	uint16_t len, x;
+	char c;
+
+	ST7735_beginBatch();
+	for (; count; count--, w++) {
+		if (!w->dirty) {
+			continue;
+		}
+		w->dirty = false;
+		if (w->type == ST7735_WIDGET_TEXTBOX) {
+			for (i = 0, x = w->x; i < w->len; i++, x += w->font->width) {
+				c = w->text[i];
+				if (c == w->shown[i]) continue;
+				w->shown[i] = c;
+				if ((uint8_t)(c - w->font->first) < w->font->count) {
+					drawImage(w->font->glyphs[(uint8_t)(c - w->font->first)], x, w->y);
+				} else {
+					drawfillRectangle(w->back, x, w->y, w->font->width, w->font->height);
+				}
+			}
+		} else if (w->type == ST7735_WIDGET_BAR) {
+			len = barLength(w, w->value);
+			if (w->drawn > w->width) {
+				//	First paint
+				if (len) drawfillRectangle(w->colr, w->x, w->y, len, w->height);
+				if (len < w->width) drawfillRectangle(w->back, w->x + len, w->y, w->width - len, w->height);
+			} else if (len > w->drawn) {
+				drawfillRectangle(w->colr, w->x + w->drawn, w->y, len - w->drawn, w->height);
+			} else if (len < w->drawn) {
+				drawfillRectangle(w->back, w->x + len, w->y, w->drawn - len, w->height);
+			}
+			w->drawn = len;
+		} else if (w->img) {
+			drawImage(w->img, w->x, w->y);
+		}
+	}
+	ST7735_endBatch();
+
+}
+
+/**
+ *	Sends a block of PROGMEM bytes as data.  Default for
+ *	ST7735_SEND_BLOCK_P().
+ */
+void ST7735_sendBlock_P(const uint8_t* p, uint16_t len) {
+
+	do {
+		ST7735_sendByte(pgm_read_byte(p++));
+	} while (--len);
+
+}
+
+/**
+ *	Sends a block of RAM bytes as data.  Default for ST7735_SEND_BLOCK().
+ */
+void ST7735_sendBlock(const uint8_t* p, uint16_t len) {
+
+	do {
+		ST7735_sendByte(*p++);
+	} while (--len);
+
+}
+
+/**
+ *	Plays a wire stream image: the exact command and data bytes
+ *	drawImage() would have sent, prepared by compr.html ("Wire Stream"
+ *	output).  Nothing is decoded, so this runs at SPI speed, at the
+ *	cost of ~2 bytes of flash per pixel.
+ *	Stream format is a list of segments, each a header byte and its
+ *	bytes:
+ *		0x00:		end of stream
+ *		0x01-0x7f:	that many command bytes (D/C low) follow
+ *		0x80 | n_hi, n_lo:	n (1-0x7fff) data bytes (D/C high) follow
+ *	The stream has its position and window addresses built in, and
+ *	assumes the orientation, offsets and color mode (16-bit) it was
+ *	encoded for.
+ *	@param wire	PROGMEM wire stream
+ */
+void drawWireImage(const uint8_t* wire) {
+
+	uint8_t h;
+	uint16_t len;
+
+	ST7735_beginCommand();
+	while ((h = pgm_read_byte(wire++))) {
+		if (h & 0x80) {
+			len = ((uint16_t)(h & 0x7f) << 8) | pgm_read_byte(wire++);
+			ST7735_commandToData();
+			ST7735_SEND_BLOCK_P(wire, len);
+			ST7735_dataToCommand();
+			wire += len;
+		} else {
+			do {
+				ST7735_sendByte(pgm_read_byte(wire++));
+			} while (--h);
+		}
+	}
+	ST7735_endTransaction();
+	//	Window registers were written behind sendRegion()'s back
+	ST7735_panel->winX1 = 0xffff;
+	ST7735_panel->winY1 = 0xffff;
+
+}
+
+#ifdef ST7735_SPRITES
+/**
+ *	Sprite record, in a cache's buffer: this header, then the runs
+ *	drawImage() sent, each a window (x1, y1, x2, y2 BYTE, inclusive,
+ *	relative to where the sprite is drawn), a length WORD, and the bytes
+ *	sent after RAMWR.  A length with SPRITE_FLAT set is a flat run: only
+ *	its first pixel's bytes are kept (see capturePeriod), repeated to
+ *	the length when drawn; in 12-bit mode, a length of 3n + 2 ends with
+ *	the pad of an odd pixel count (see endPixels()).
+ */
+typedef struct {
+	const uint8_t* img;			//	Image drawn (PROGMEM)
+	uint16_t len;				//	Record length, header included (not padding)
+	uint16_t stamp;				//	cache->clock when last drawn
+	uint8_t mode;				//	Color mode the data is packed for
+} SpriteHeader;
+
+#define SPRITE_FLAT		0x8000
+#define SPRITE_UNRECORDED	0xff	//	mode of a record with room made, not recorded yet
+//	Records start aligned for the header (no padding on AVR)
+#define SPRITE_ALIGN	__alignof__(SpriteHeader)
+#define SPRITE_PADDED(len)	(((len) + SPRITE_ALIGN - 1) & ~(SPRITE_ALIGN - 1))
+
+static uint16_t captureX, captureY;	//	Where the sprite is drawn
+static uint16_t captureLen;		//	Record length so far
+static uint16_t captureRun;		//	Current run's offset in the record (0: none yet)
+static uint16_t captureCount;	//	Bytes sent in that run...
+static bool captureFlat;		//	  all repeating its first pixel...
+static bool capturePad;			//	  (but for the last byte, if 12-bit padding)...
+static uint8_t capturePeriod;	//	  of this many bytes (2 in 16-bit mode, else 3:
+								//	  two pixels in 12-bit mode)...
+static uint8_t captureFirst[3];	//	  which were these
+
+static SpriteHeader* findSprite(ST7735_SpriteCache* cache, const uint8_t* img) {
+
+	uint16_t i;
+	SpriteHeader* h;
+
+	for (i = 0; i < cache->used; i += SPRITE_PADDED(h->len)) {
+		h = (SpriteHeader*)(cache->buf + i);
+		if (h->img == img) {
+			return h;
+		}
+	}
+	return NULL;
+
+}
+
+/**
+ *	Removes a sprite, moving those after it down, and extra bytes past
+ *	them (the record being made).
+ */
+static void removeSprite(ST7735_SpriteCache* cache, SpriteHeader* h, uint16_t extra) {
+
+	uint8_t* d = (uint8_t*)h;
+	uint8_t* s = d + SPRITE_PADDED(h->len);
+	uint8_t* end = cache->buf + cache->used + extra;
+
+	cache->used -= SPRITE_PADDED(h->len);
+	while (s < end) {
+		*d++ = *s++;
+	}
+
+}
+
+/**
+ *	Finds the least recently drawn sprite (cache not empty).
+ */
+static SpriteHeader* oldestSprite(ST7735_SpriteCache* cache) {
+
+	uint16_t i, age, oldest = 0;
+	SpriteHeader* h;
+	SpriteHeader* o = (SpriteHeader*)cache->buf;
+
+	for (i = 0; i < cache->used; i += SPRITE_PADDED(h->len)) {
+		h = (SpriteHeader*)(cache->buf + i);
+		age = cache->clock - h->stamp;
+		if (age > oldest) {
+			oldest = age;
+			o = h;
+		}
+	}
+	return o;
+
+}
+
+/**
+ *	Gives up recording: the sprite can't be kept (larger than the
+ *	whole buffer, or than the format allows).  Nothing has been
+ *	dropped for it.
+ */
+static void stopCapture(void) {
+
+	capture = NULL;
+	captureData = false;
+
+}
+
+/**
+ *	Stores a record byte, if it falls in the free space; past that, it's
+ *	only counted (see drawSprite()).
+ */
+static void captureStore(uint16_t i, uint8_t b) {
+
+	if (i < capture->size - capture->used) {
+		capture->buf[capture->used + i] = b;
+	}
+
+}
+
+/**
+ *	Fills in the current run's length.
+ */
+static void finishRun(void) {
+
+	uint16_t len = captureCount;
+
+	if (captureRun) {
+		if (captureFlat && captureCount > capturePeriod) {
+			len |= SPRITE_FLAT;
+		}
+		captureStore(captureRun + 4, len & 0xff);
+		captureStore(captureRun + 5, len >> 8);
+	}
+
+}
+
+/**
+ *	Starts a run, from sendRegion().
+ */
+static void captureWindow(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2) {
+
+	finishRun();
+	captureData = false;
+	x1 -= captureX; y1 -= captureY;
+	x2 -= captureX; y2 -= captureY;
+	if ((x1 | y1 | x2 | y2) > 0xff || captureLen + 6 > capture->size) {
+		stopCapture();
+		return;
+	}
+	captureRun = captureLen;
+	captureStore(captureLen++, x1);
+	captureStore(captureLen++, y1);
+	captureStore(captureLen++, x2);
+	captureStore(captureLen++, y2);
+	captureLen += 2;				//	Length: see finishRun()
+	captureCount = 0;
+	captureFlat = true;
+	capturePad = false;
+
+}
+
+/**
+ *	Records a pixel data byte, from ST7735_sendByte().
+ */
+static void captureByte(uint8_t b) {
+
+	uint16_t data = captureRun + 6;
+	uint16_t i;
+	uint8_t expect;
+
+	if (captureFlat && captureCount >= capturePeriod) {
+		expect = captureFirst[captureCount % capturePeriod];
+		if (!capturePad && b != expect && pixelMode == ST7735_COLMOD_12BIT
+				&& captureCount % 3 == 1 && b == (expect & 0xf0)) {
+			//	Likely the pad after an odd pixel: flat, if it's the last byte
+			capturePad = true;
+			captureCount++;
+			return;
+		}
+		if (capturePad || b != expect) {
+			//	Not flat after all: write out the repeats so far
+			captureFlat = false;
+			captureLen = data + captureCount;
+			if (captureLen > capture->size) {
+				stopCapture();
+				return;
+			}
+			for (i = capturePeriod; i < captureCount; i++) {
+				captureStore(data + i, captureFirst[i % capturePeriod]);
+			}
+			if (capturePad) {
+				captureStore(data + captureCount - 1, captureFirst[1] & 0xf0);
+				capturePad = false;
+			}
+		}
+	}
+	if (captureCount < capturePeriod) {
+		captureFirst[captureCount] = b;
+	}
+	if (!captureFlat || captureCount < capturePeriod) {
+		captureStore(captureLen++, b);
+	}
+	if (++captureCount > 0x7fff || captureLen > capture->size) {
+		stopCapture();
+	}
+
+}
+
+/**
+ *	Sets up a sprite cache in the caller's buffer, initially empty.
+ *	@param buf	RAM to keep sprites in (aligned for a pointer, where
+ *			that matters: not on AVR)...
+ *	@param size	  this many bytes of it (the budget)
+ */
+void initSpriteCache(ST7735_SpriteCache* cache, uint8_t* buf, uint16_t size) {
+
+	cache->buf = buf;
+	cache->size = size;
+	cache->used = 0;
+	cache->clock = 0;
+	cache->hits = 0;
+	cache->misses = 0;
+	cache->big = NULL;
+
+}
+
+/**
+ *	Empties a sprite cache.  Call it after setPaletteMap(), or anything
+ *	else that changes how images draw, as sprites keep the pixels they
+ *	were first drawn with.
+ */
+void flushSprites(ST7735_SpriteCache* cache) {
+
+	cache->used = 0;
+	cache->big = NULL;
+
+}
+
+/**
+ *	Draws an image (see drawImage()) through a sprite cache.  The first
+ *	time, it's drawn from flash, and the windows and pixel bytes it
+ *	sends are recorded into the cache as they go; after that, it's
+ *	drawn from RAM, anywhere on screen: no commands to parse and no
+ *	palette lookups, only the bytes to send.  SPI traffic is the same.
+ *	A sprite takes 7 bytes (on AVR), plus 6 per window and its pixel
+ *	data: 2 bytes per pixel in 16-bit mode (1.5 in 12-bit, 3 in 18-bit),
+ *	except that flat runs keep one pixel.
+ *	A sprite is recorded into the free space only; if it doesn't fit
+ *	there, its length is known after the first draw, the least recently
+ *	drawn ones are dropped to make room for it, and it's recorded the
+ *	next time.  One that can't be kept at all (larger than the whole
+ *	buffer, 256 pixels across, or with a run of over 32k bytes) drops
+ *	nothing, and is drawn straight from flash from then on.
+ *	@param cache	sprite cache (see initSpriteCache())
+ *	@param img	PROGMEM image (encoded) buffer to draw; it's the key
+ *	@param x	x and...
+ *	@param y	y coordinate to draw image at, referenced to top-left corner
+ */
+void drawSprite(ST7735_SpriteCache* cache, const uint8_t* img, uint16_t x, uint16_t y) {
+
+	SpriteHeader* h = findSprite(cache, img);
+	const uint8_t* p;
+	const uint8_t* end;
+	uint16_t len, size;
+	uint8_t i, period, mode;
+	bool pad;
+
+	cache->clock++;
+	if (img == cache->big && cache->bigMode == ST7735_panel->colorMode) {
+		cache->misses++;			//	Known not to fit
+		drawImage(img, x, y);
+		return;
+	}
+	if (h && h->mode != ST7735_panel->colorMode) {
+		removeSprite(cache, h, 0);	//	Packed for another color mode, or not recorded yet
+		h = NULL;
+	}
+	if (!h) {
+		cache->misses++;
+		capture = cache;
+		captureX = x; captureY = y;
+		captureLen = sizeof(SpriteHeader);
+		captureRun = 0;
+		capturePeriod = (ST7735_panel->colorMode == ST7735_COLMOD_16BIT) ? 2 : 3;
+		drawImage(img, x, y);
+		if (!capture) {
+			cache->big = img;		//	Given up: don't try again
+			cache->bigMode = ST7735_panel->colorMode;
+			return;
+		}
+		if (!captureRun) {
+			capture = NULL;			//	Nothing drawn
+			return;
+		}
+		finishRun();
+		capture = NULL;
+		captureData = false;
+		size = SPRITE_PADDED(captureLen);
+		if (size > cache->size) {
+			cache->big = img;		//	Fits only without its padding
+			cache->bigMode = ST7735_panel->colorMode;
+			return;
+		}
+		mode = ST7735_panel->colorMode;
+		if (size > cache->size - cache->used) {
+			//	Recorded in part: now that its length is known (and within
+			//	the buffer), make room, to record it next time
+			while (size > cache->size - cache->used) {
+				removeSprite(cache, oldestSprite(cache), 0);
+			}
+			mode = SPRITE_UNRECORDED;
+		}
+		h = (SpriteHeader*)(cache->buf + cache->used);
+		h->img = img;
+		h->len = captureLen;
+		h->stamp = cache->clock;
+		h->mode = mode;
+		cache->used += size;
+		return;
+	}
+
+	cache->hits++;
+	h->stamp = cache->clock;
+	period = (h->mode == ST7735_COLMOD_16BIT) ? 2 : 3;
+	ST7735_MARK(ST7735_BENCH_SPRITE);
+	ST7735_beginBatch();
+	p = (const uint8_t*)(h + 1);
+	end = (const uint8_t*)h + h->len;
+	while (p < end) {
+		beginPixels(x + p[0], y + p[1], x + p[2], y + p[3]);
+		ST7735_COUNT(ST7735_stats.pixels += (uint16_t)(p[2] - p[0] + 1) * (p[3] - p[1] + 1));
+		len = p[4] | ((uint16_t)p[5] << 8);
+		p += 6;
+		if (len & SPRITE_FLAT) {
+			len &= ~SPRITE_FLAT;
+			pad = (h->mode == ST7735_COLMOD_12BIT && len % 3 == 2);
+			len -= pad;
+			i = 0;
+			do {
+				ST7735_sendByte(p[i]);
+				if (++i == period) i = 0;
+			} while (--len);
+			if (pad) {
+				ST7735_sendByte(p[1] & 0xf0);
+			}
+			p += period;
+		} else if (len) {
+			ST7735_SEND_BLOCK(p, len);
+			p += len;
+		}
+		endPixels();
+	}
+	ST7735_endBatch();
+	ST7735_MARK(ST7735_BENCH_IDLE);
+
+}
+#endif // ST7735_SPRITES
@@ -4,6 +4,7 @@
 #define ST7735_H_INCLUDED
 
 #include <inttypes.h>
+#include <stddef.h>
 #include <stdbool.h>
 #include <avr/pgmspace.h>
 #include <avr/io.h>
@@ -33,6 +34,15 @@
 #define WIDTH				SCREEN_WIDTH
 #define HEIGHT				SCREEN_HEIGHT
 
+//	Physical geometry of the 7735R: visible columns/rows (ROT0 puts X along
+//	rows), GRAM size, and green tab GRAM offsets of the visible area
+#define ST7735_COLS			SCREEN_HEIGHT
+#define ST7735_ROWS			SCREEN_WIDTH
+#define ST7735_GRAM_COLS	132
+#define ST7735_GRAM_ROWS	162
+#define ST7735_GREENTAB_COL_OFFSET	2
+#define ST7735_GREENTAB_ROW_OFFSET	1
+
 #define ST_CMD_DELAY		0x80	//	special signifier for command lists
 
 /*	Command Description
@@ -407,9 +417,23 @@
 #define INITR_GREENTAB		0x0
 #define INITR_18GREENTAB	INITR_GREENTAB
 
+#define ST7735_MADCTL_MY	0x80
+#define ST7735_MADCTL_MX	0x40
+#define ST7735_MADCTL_MV	0x20
+#define ST7735_MADCTL_ML	0x10
 #define ST7735_MADCTL_BGR	0x08
 #define ST7735_MADCTL_MH	0x04
 
+//	Orientation flags for setOrientation() and drawImageOriented().
+//	Rotation is clockwise, in 90 degree steps, applied before mirroring
+//	(left-right).  Vertical mirroring is ROT180 | MIRROR.
+#define ST7735_ORIENT_ROT0		0x00
+#define ST7735_ORIENT_ROT90		0x01
+#define ST7735_ORIENT_ROT180	0x02
+#define ST7735_ORIENT_ROT270	0x03
+#define ST7735_ORIENT_ROT_gm	0x03
+#define ST7735_ORIENT_MIRROR	0x04
+
 #define ST7735_FRMCTR1		0xB1
 #define ST7735_FRMCTR2		0xB2
 #define ST7735_FRMCTR3		0xB3
@@ -428,6 +452,332 @@
 #define ST7735_GMCTRP1		0xE0
 #define ST7735_GMCTRN1		0xE1
 
+//	ILI9163 extras (not in the ST77xx set)
+#define ILI9163_VCOMOFFS	0xC7
+#define ILI9163_GAMRSEL		0xF2
+
+//	COLMOD interface pixel formats (IFPF[2:0])
+#define ST7735_COLMOD_12BIT	0x03
+#define ST7735_COLMOD_16BIT	0x05
+#define ST7735_COLMOD_18BIT	0x06
+
+//	RAM palette for drawImage() in 12- and 18-bit modes, in entries
+//	(2 bytes each); 0 converts colors per pixel instead
+#ifndef ST7735_PALETTE_CACHE
+#define ST7735_PALETTE_CACHE	0
+#endif // ST7735_PALETTE_CACHE
+
+//	Color transform for setPaletteMap(): 5-6-5 in, 5-6-5 out
+typedef uint16_t (*ST7735_ColorMap)(uint16_t c);
+
+//	RAM buffer for blendRectangle() read-modify-write strips, in pixels
+//	(2 bytes each)
+#ifndef ST7735_BLEND_STRIP
+#define ST7735_BLEND_STRIP		64
+#endif // ST7735_BLEND_STRIP
+
+//	Display lists: occluders drawDisplayList() cuts an item around before
+//	drawing the rest of it anyway (overdraw, but still correct); bounds its
+//	recursion, at about 20 bytes of stack per level
+#ifndef ST7735_DISPLAY_DEPTH
+#define ST7735_DISPLAY_DEPTH	8
+#endif // ST7735_DISPLAY_DEPTH
+
+//	Patterns for drawPatternRectangle() and image command 0x09: kind byte
+#define ST7735_PATTERN_TYPE_gm		0x03
+#define ST7735_PATTERN_HGRADIENT	0x00	//	colr1 at the left to colr2 at the right
+#define ST7735_PATTERN_VGRADIENT	0x01	//	colr1 at the top to colr2 at the bottom
+#define ST7735_PATTERN_CHECKER		0x02	//	Squares, (kind >> 2) + 1 pixels across
+#define ST7735_PATTERN_CHECKER_SIZE(n)	(ST7735_PATTERN_CHECKER | (((n) - 1) << 2))	//	n: 1-64
+
+//	Text widgets: longest text, in characters (2 bytes RAM each)
+#ifndef ST7735_WIDGET_TEXT
+#define ST7735_WIDGET_TEXT		8
+#endif // ST7735_WIDGET_TEXT
+#define ST7735_WIDGET_TEXTBOX	1
+#define ST7735_WIDGET_BAR		2
+#define ST7735_WIDGET_ICON		3
+
+//	Sprite cache (drawSprite()): define ST7735_SPRITES to compile it, with
+//	the hooks that record what drawImage() sends; undefined, it costs nothing
+
+//	Huffman images (drawHuffImage()): longest code, in bits (fixed by the
+//	format), and bits resolved by lookup table (three tables of 2 << bits
+//	bytes RAM, 1 to 8 bits: table indices are bytes); longer codes are
+//	decoded a bit at a time
+#define ST7735_HUFF_MAX_BITS	12
+#ifndef ST7735_HUFF_FAST_BITS
+#define ST7735_HUFF_FAST_BITS	6
+#endif // ST7735_HUFF_FAST_BITS
+#if ST7735_HUFF_FAST_BITS < 1 || ST7735_HUFF_FAST_BITS > 8
+#error "ST7735_HUFF_FAST_BITS must be 1 to 8"
+#endif
+
+//	Block send for drawWireImage() data segments (PROGMEM source); may be
+//	replaced by a DMA transfer that can read flash, which must finish
+//	before returning
+#ifndef ST7735_SEND_BLOCK_P
+#define ST7735_SEND_BLOCK_P(p, len)	ST7735_sendBlock_P(p, len)
+#endif // ST7735_SEND_BLOCK_P
+
+//	Ditto from RAM, for drawSprite()
+#ifndef ST7735_SEND_BLOCK
+#define ST7735_SEND_BLOCK(p, len)	ST7735_sendBlock(p, len)
+#endif // ST7735_SEND_BLOCK
+
+//	Reset pin of the single panel build: XMega PORT_SPI_RS/BIT_SPI_RS,
+//	unless the project header drives it some other way (an ATmega port)
+#ifndef SPI_RS_LOW
+#define SPI_RS_LOW()		PORT_SPI_RS.OUTCLR = BIT_SPI_RS
+#define SPI_RS_HIGH()		PORT_SPI_RS.OUTSET = BIT_SPI_RS
+#endif // SPI_RS_LOW
+
+//	Benchmark markers: the project header may define ST7735_BENCH(tag) to
+//	record where the driver is, e.g. by writing tag to a GPIOR register
+//	traced by a simulator, or to a port for a logic analyzer.  Time runs
+//	against a tag until the next one.  Image commands are tagged with
+//	their command byte (0x00-0x25, 0xff); the rest use these.
+#ifndef ST7735_BENCH
+#define ST7735_BENCH(tag)
+#endif // ST7735_BENCH
+#define ST7735_BENCH_IDLE	0xf0	//	Returned to the caller
+#define ST7735_BENCH_INIT	0xf1	//	ST7735_displayInit()
+#define ST7735_BENCH_REGION	0xf2	//	setScreenRegion()
+#define ST7735_BENCH_FILL	0xf3	//	drawfillRectangle()
+#define ST7735_BENCH_PATTERN	0xf4	//	drawPatternRectangle(), drawTileRectangle()
+#define ST7735_BENCH_SPRITE		0xf5	//	drawSprite(), drawn from RAM
+
+//	Bus trace: the project header (of a host build, say) may define
+//	ST7735_TRACE(kind, value) to log every CS and D/C change, byte sent and
+//	section marker; e.g. as 4-byte records (kind, value, time since the
+//	last record as a little-endian word) for trace.html to analyze.
+#ifndef ST7735_TRACE
+#define ST7735_TRACE(kind, value)
+#endif // ST7735_TRACE
+#define ST7735_TRACE_BYTE	0	//	Byte sent
+#define ST7735_TRACE_CS		1	//	1: CS asserted, 0: released
+#define ST7735_TRACE_DC		2	//	1: data, 0: command
+#define ST7735_TRACE_MARK	3	//	Section entered: ST7735_BENCH() tag
+#define ST7735_TRACE_FRAME	4	//	(From the application) start of a frame
+
+//	Instrumentation: define ST7735_STATS to count what the driver sends
+//	(ST7735_stats; see ST7735_dumpStats()), by section as marked for
+//	ST7735_BENCH(); with it undefined, there's no code or RAM for it.  The
+//	project header may define ST7735_STATS_CLOCK() as a free-running 16-bit
+//	timer count (TCC0.CNT, say), to time sections and SPI_TXWAIT().
+#ifdef ST7735_STATS
+#ifndef ST7735_STATS_CLOCK
+#define ST7735_STATS_CLOCK()	0
+#endif // ST7735_STATS_CLOCK
+//	Sections: image commands by type (flats 1-5, Skip 8, pattern 9, bitmaps 0x0a-0x0d,
+//	copy 0x0e, terminate 0x0f), then ST7735_BENCH_xxx from 16
+#define ST7735_STATS_SECTIONS	22
+#define ST7735_STATS_SECTION(tag)	(((tag) >= ST7735_BENCH_IDLE && (tag) <= ST7735_BENCH_SPRITE) \
+		? 16 + ((tag) - ST7735_BENCH_IDLE) : ((tag) & 0x0f) | (((tag) >> 1) & 0x08))
+#endif // ST7735_STATS
+
+//	Expected RDDID (ID1, ID2, ID3) responses
+#define ST7735_ID_7735		0x7c, 0x89, 0xf0
+#define ST7735_ID_7789		0x85, 0x85, 0x52
+
+
+/**
+ *	Panel variant (controller + glass + tab).  Lives in PROGMEM; see
+ *	ST7735_variants[].  Geometry as for ST7735_Panel; init lists are in
+ *	ST7735_displayInit() format (NULL for unused slots).  colorModes has
+ *	bit n set for each supported COLMOD value n.  id is the RDDID response
+ *	used by ST7735_detectVariant(); all zeroes excludes the variant from
+ *	auto-detection (ID not distinctive or not known).
+ */
+typedef struct ST7735_Variant_s {
+	const uint8_t* init[3];
+	uint16_t cols, rows;
+	uint16_t gramCols, gramRows;
+	uint8_t colOffset, rowOffset;
+	uint8_t madctl;				//	Extra MADCTL bits (RGB/BGR order)
+	uint8_t colorModes;
+	uint8_t id[ST7735_RDDID_RDB];
+} ST7735_Variant;
+
+//	Indices into ST7735_variants[]
+#define ST7735_VARIANT_7735R_GREENTAB	0
+#define ST7735_VARIANT_7735S_MINI160X80	1
+#define ST7735_VARIANT_7789_240X240		2
+#define ST7735_VARIANT_ILI9163_128X128	3
+#define ST7735_VARIANT_COUNT			4
+
+extern const ST7735_Variant ST7735_variants[ST7735_VARIANT_COUNT] PROGMEM;
+
+/**
+ *	Display context.  All drawing goes to the current panel, ST7735_panel.
+ *
+ *	In the default (single panel) build, there is exactly one, bound to the
+ *	SPI_ macros at compile time; ST7735_panel is the address of a static
+ *	instance, so every access resolves to a fixed location and the CS/DC
+ *	macros are used directly -- no indirection.
+ *
+ *	Define ST7735_MULTI_PANEL to drive several panels on one SPI bus: each
+ *	panel then carries its own CS, D/C (and optionally reset) pin bindings,
+ *	and ST7735_selectPanel() switches between them.  Transactions never span
+ *	drawing calls, so calls to different panels can be freely interleaved.
+ *
+ *	Geometry is physical: cols, rows (visible area) within the GRAM, and the
+ *	visible area's GRAM offset (non-mirrored).  width, height and orientation
+ *	are the current logical screen; the rest is cached controller state.
+ *	variant selects the init tables and geometry used by initLcd(); NULL
+ *	keeps the original 7735R green tab init and the geometry given here.
+ */
+typedef struct ST7735_Panel_s {
+#ifdef ST7735_MULTI_PANEL
+	volatile uint8_t* csPort;	//	Port output register, and...
+	uint8_t csMask;				//	  pin bit mask, for CS
+	volatile uint8_t* dcPort;	//	Ditto for D/C
+	uint8_t dcMask;
+	volatile uint8_t* rsPort;	//	Ditto for reset (NULL if not connected or shared)
+	uint8_t rsMask;
+#endif // ST7735_MULTI_PANEL
+	const ST7735_Variant* variant;	//	PROGMEM
+	uint16_t cols, rows;		//	Visible area
+	uint16_t gramCols, gramRows;	//	Controller memory size
+	uint8_t colOffset, rowOffset;	//	Visible area offset in GRAM
+	uint8_t madctl;				//	Extra MADCTL bits
+	uint8_t colorModes;			//	Supported COLMOD values (bit mask)
+	uint8_t colorMode;			//	Current COLMOD value
+	uint16_t width, height;		//	Logical screen size, per orientation
+	uint8_t orientation;		//	ST7735_ORIENT_ flags
+	uint16_t caOffset, raOffset;	//	CASET, RASET offsets for current MADCTL
+	uint16_t winX1, winX2;		//	Current window (RASET, CASET), logical
+	uint16_t winY1, winY2;
+} ST7735_Panel;
+
+//	Initializers for the geometry fields of an ST7735_Panel (7735R, ROT0).
+//	RAW addresses GRAM directly, as the original single-panel driver did.
+#define ST7735_PANEL_GEOMETRY(gcols, grows, colofs, rowofs) \
+	.cols = ST7735_COLS, .rows = ST7735_ROWS, \
+	.gramCols = (gcols), .gramRows = (grows), \
+	.colOffset = (colofs), .rowOffset = (rowofs), \
+	.colorModes = (1 << ST7735_COLMOD_12BIT) | (1 << ST7735_COLMOD_16BIT) \
+			| (1 << ST7735_COLMOD_18BIT), \
+	.colorMode = ST7735_COLMOD_16BIT, \
+	.width = SCREEN_WIDTH, .height = SCREEN_HEIGHT, \
+	.winX1 = 0xffff, .winY1 = 0xffff
+#define ST7735_PANEL_RAW		ST7735_PANEL_GEOMETRY(ST7735_COLS, ST7735_ROWS, 0, 0)
+#define ST7735_PANEL_GREENTAB	ST7735_PANEL_GEOMETRY(ST7735_GRAM_COLS, ST7735_GRAM_ROWS, \
+				ST7735_GREENTAB_COL_OFFSET, ST7735_GREENTAB_ROW_OFFSET)
+
+#ifdef ST7735_MULTI_PANEL
+extern ST7735_Panel* ST7735_panel;
+void ST7735_selectPanel(ST7735_Panel* p);
+#else
+extern ST7735_Panel ST7735_panel0;
+#define ST7735_panel		(&ST7735_panel0)
+#endif // ST7735_MULTI_PANEL
+
+/**
+ *	Animation player state; see startAnimation().
+ */
+typedef struct ST7735_Animation_s {
+	const uint8_t* palette;		//	PROGMEM palette
+	const uint8_t* frame;		//	Next frame record
+	const uint8_t* loop;		//	Record 1, where looping resumes
+	uint16_t paletteCount;
+	uint16_t x, y;				//	Position
+	uint16_t due;				//	Time the next frame is due (ms)
+	uint8_t count;				//	Frames (N)
+	uint8_t index;				//	Next frame record (0 to N)
+} ST7735_Animation;
+
+/**
+ *	Display list item; see startDisplayList().
+ */
+typedef struct ST7735_DrawItem_s {
+	const uint8_t* img;			//	PROGMEM image, or NULL for a fill
+	uint16_t colr;				//	Fill color (5-6-5)
+	uint16_t x, y;				//	Position
+	uint16_t width, height;		//	Size
+	bool opaque;				//	Hides what's under it (fills always do)
+} ST7735_DrawItem;
+
+/**
+ *	Display list state; see startDisplayList().
+ */
+typedef struct ST7735_DisplayList_s {
+	ST7735_DrawItem* items;		//	Caller's array...
+	uint8_t size;				//	  of this many items
+	uint8_t count;				//	Items recorded
+	uint32_t area;				//	Pixels recorded (sent if drawn directly)
+	uint32_t drawn;				//	Pixels sent by drawDisplayList()
+} ST7735_DisplayList;
+
+/**
+ *	Font for text widgets: fixed size cells, each character an image
+ *	(see drawImage()) that fills its cell, background included.
+ */
+typedef struct ST7735_Font_s {
+	const uint8_t* const* glyphs;	//	Images (PROGMEM), from character first on
+	uint8_t first, count;			//	Characters covered
+	uint8_t width, height;			//	Cell size
+} ST7735_Font;
+
+/**
+ *	Retained widget; see initTextWidget(), initBarWidget(),
+ *	initIconWidget() and updateWidgets().
+ */
+typedef struct ST7735_Widget_s {
+	uint8_t type;				//	ST7735_WIDGET_xxx
+	bool dirty;					//	Changed since the last updateWidgets()
+	uint16_t x, y;				//	Position
+	uint16_t width, height;		//	Size (text, bar)
+	uint16_t back;				//	Background color (text, bar)
+	const ST7735_Font* font;	//	Text: font...
+	uint8_t len;				//	  and length
+	char text[ST7735_WIDGET_TEXT];	//	  set...
+	char shown[ST7735_WIDGET_TEXT];	//	  and on screen
+	uint16_t value, max;		//	Bar: value, of max...
+	uint16_t colr;				//	  color filled...
+	uint16_t drawn;				//	  and length on screen
+	const uint8_t* img;			//	Icon: image (PROGMEM)
+} ST7735_Widget;
+
+#ifdef ST7735_SPRITES
+/**
+ *	Sprite cache: images drawn by drawSprite(), kept as the bytes they
+ *	sent, in the caller's buffer.  See initSpriteCache().
+ */
+typedef struct ST7735_SpriteCache_s {
+	uint8_t* buf;				//	Caller's buffer...
+	uint16_t size;				//	  of this many bytes (the budget)
+	uint16_t used;				//	Bytes holding sprites
+	uint16_t clock;				//	drawSprite() calls, to find the least recently used
+	uint16_t hits, misses;		//	Sprites drawn from RAM, and from flash
+	const uint8_t* big;			//	Last image found not to fit (drawn from flash)...
+	uint8_t bigMode;			//	  in this color mode
+} ST7735_SpriteCache;
+#endif // ST7735_SPRITES
+
+#ifdef ST7735_STATS
+/**
+ *	Instrumentation counters (ST7735_STATS); see ST7735_dumpStats().
+ */
+typedef struct ST7735_Stats_s {
+	uint32_t bytes;				//	SPI bytes sent
+	uint32_t pixels;			//	Pixels sent (RAMWR)
+	uint32_t waitTime;			//	Clock ticks spent in SPI_TXWAIT() sending
+	uint16_t runs;				//	RAMWR streams started
+	uint16_t transactions;		//	CS releases
+	uint16_t windows;			//	Window halves (RASET, CASET) sent...
+	uint16_t windowsCached;		//	  and skipped, as already set
+	struct {
+		uint16_t count;			//	Times entered
+		uint32_t bytes;			//	SPI bytes sent in it
+		uint32_t time;			//	Clock ticks spent in it
+	} section[ST7735_STATS_SECTIONS];	//	See ST7735_STATS_SECTION()
+} ST7735_Stats;
+
+extern ST7735_Stats ST7735_stats;
+void ST7735_resetStats(void);
+void ST7735_dumpStats(void (*put)(char c));
+#endif // ST7735_STATS
 
 void ST7735_displayInit(const uint8_t* addr);
 void delay_ms(uint16_t ms);
@@ -437,16 +787,71 @@ void ST7735_commandToData(void);
 void ST7735_dataToCommand(void);
 uint8_t ST7735_sendByte(uint8_t b);
 void ST7735_endTransaction(void);
+void ST7735_beginBatch(void);
+void ST7735_endBatch(void);
 void ST7735_sendCommand(uint8_t cmd);
 void ST7735_sendData(uint8_t cmd);
+void ST7735_readRegister(uint8_t cmd, uint8_t* buf, uint8_t len);
+uint32_t ST7735_readStatus(void);
+uint32_t ST7735_readId(void);
+const ST7735_Variant* ST7735_detectVariant(void);
 void initLcd(void);
+const ST7735_Variant* initLcdAuto(void);
+void setOrientation(uint8_t orient);
 void setScreenRegion(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2);
+bool setColorMode(uint8_t mode);
 void writePixel(uint16_t c);
 void drawfillRectangle(uint16_t colr, uint16_t xStart, uint16_t yStart,
 				uint16_t width, uint16_t height);
+void readPixels(uint16_t* buf, uint16_t xStart, uint16_t yStart,
+				uint16_t width, uint16_t height);
+void blendRectangle(uint16_t colr, uint8_t alpha, const uint8_t* mask,
+				uint16_t xStart, uint16_t yStart, uint16_t width, uint16_t height);
+void drawPatternRectangle(uint8_t kind, uint16_t colr1, uint16_t colr2,
+				uint16_t xStart, uint16_t yStart, uint16_t width, uint16_t height);
+void drawTileRectangle(const uint8_t* tile, uint8_t tileWidth, uint8_t tileHeight,
+				uint16_t xStart, uint16_t yStart, uint16_t width, uint16_t height);
 #ifdef IMAGE_COMPRESS_TEST_H_INCLUDED
-const uint8_t PROGMEM ImageData[1 + IMAGE_COMPRESS_TEST_PALETTE_LEN * 2 + IMAGE_COMPRESS_TEST_CMD_LEN];
+const uint8_t PROGMEM ImageData[IMAGE_COMPRESS_TEST_TOTAL_LEN];
 #endif // IMAGE_COMPRESS_TEST_H_INCLUDED
-void drawImage(const uint8_t* img, const uint8_t x, const uint8_t y);
+void setPaletteMap(const uint8_t* palette, ST7735_ColorMap map);
+uint16_t ST7735_mapInvert(uint16_t c);
+uint16_t ST7735_mapGray(uint16_t c);
+uint16_t ST7735_mapDim(uint16_t c);
+void drawImage(const uint8_t* img, uint16_t x, uint16_t y);
+void drawImageRegion(const uint8_t* img, uint8_t xSrc, uint8_t ySrc,
+				uint16_t width, uint16_t height, uint16_t x, uint16_t y);
+void drawImageScaled(const uint8_t* img, uint16_t x, uint16_t y, uint8_t up, uint8_t down);
+void drawImageOriented(const uint8_t* img, uint16_t x, uint16_t y,
+				uint16_t width, uint16_t height, uint8_t orient);
+void startAnimation(ST7735_Animation* a, const uint8_t* anim,
+				uint16_t x, uint16_t y, uint16_t now);
+bool updateAnimation(ST7735_Animation* a, uint16_t now);
+void playAnimation(const uint8_t* anim, uint16_t x, uint16_t y);
+void drawHuffImage(const uint8_t* img, uint16_t x, uint16_t y);
+void startDisplayList(ST7735_DisplayList* dl, ST7735_DrawItem* items, uint8_t size);
+bool addFillRectangle(ST7735_DisplayList* dl, uint16_t colr, uint16_t xStart, uint16_t yStart,
+				uint16_t width, uint16_t height);
+bool addImage(ST7735_DisplayList* dl, const uint8_t* img, uint16_t x, uint16_t y,
+				uint16_t width, uint16_t height, bool opaque);
+void drawDisplayList(ST7735_DisplayList* dl);
+void initTextWidget(ST7735_Widget* w, uint16_t x, uint16_t y,
+				const ST7735_Font* font, uint8_t len, uint16_t back);
+void initBarWidget(ST7735_Widget* w, uint16_t x, uint16_t y, uint16_t width, uint16_t height,
+				uint16_t max, uint16_t colr, uint16_t back);
+void initIconWidget(ST7735_Widget* w, uint16_t x, uint16_t y, const uint8_t* img);
+void setWidgetText(ST7735_Widget* w, const char* s);
+void setWidgetNumber(ST7735_Widget* w, int16_t n);
+void setWidgetValue(ST7735_Widget* w, uint16_t value);
+void setWidgetImage(ST7735_Widget* w, const uint8_t* img);
+void updateWidgets(ST7735_Widget* w, uint8_t count);
+void ST7735_sendBlock_P(const uint8_t* p, uint16_t len);
+void ST7735_sendBlock(const uint8_t* p, uint16_t len);
+void drawWireImage(const uint8_t* wire);
+#ifdef ST7735_SPRITES
+void initSpriteCache(ST7735_SpriteCache* cache, uint8_t* buf, uint16_t size);
+void flushSprites(ST7735_SpriteCache* cache);
+void drawSprite(ST7735_SpriteCache* cache, const uint8_t* img, uint16_t x, uint16_t y);
+#endif // ST7735_SPRITES
 
 #endif // ST7735_H_INCLUDED
@@ -0,0 +1,67 @@
+/*
+ *	Host benchmark of transactions and batches: what Image_Compress_Test
+ *	and a run of small fills (unbatched, then in a batch) cost on the bus,
+ *	per command.  The counts are measured by the model; the overhead in
+ *	microseconds is an estimate from them, at an 8 MHz SCK (1 us per
+ *	byte), 0.5 us per SPI_TXWAIT() drained before a pin change, and 0.25
+ *	us per CS pulse:  bytes other than pixel data, drains and CS cycles,
+ *	over commands.
+ */
+
+#include <stdio.h>
+#include "st7735.h"
+
+#define FILLS				100
+
+static SpiModel before;
+
+static void reset(void) {
+
+	spiModelReset();
+	ST7735_panel0 = (ST7735_Panel){ ST7735_PANEL_RAW };
+	initLcd();
+	before = spiModel;
+
+}
+
+static void report(const char* name, uint32_t commands) {
+
+	uint32_t bytes = spiModel.bytes - before.bytes;
+	uint32_t drains = spiModel.drains - before.drains;
+	uint32_t transactions = spiModel.transactions - before.transactions;
+	uint32_t pixels = spiModel.pixels - before.pixels;
+
+	printf("batch/%s\t%lu\t%lu\t%lu\t%lu\t%lu\t%lu\t%.1f\n", name,
+			(unsigned long)commands, (unsigned long)bytes,
+			(unsigned long)transactions,
+			(unsigned long)(spiModel.dcEdges - before.dcEdges),
+			(unsigned long)drains, (unsigned long)pixels,
+			((bytes - 2 * pixels) + 0.5 * drains + 0.25 * transactions) / commands);
+
+}
+
+int main(void) {
+
+	unsigned i;
+
+	printf("#batch\tcommands\tbytes\ttransactions\tdc_edges\tdrains\tpixels\toverhead_us\n");
+	reset();
+	drawImage(ImageData, 0, 0);
+	report("Image_Compress_Test", spiModel.marks - before.marks);
+
+	reset();
+	for (i = 0; i < FILLS; i++) {
+		drawfillRectangle(i * 0x0841, (i % 20) * 8, (i / 20) * 8, 4, 4);
+	}
+	report("fills/unbatched", FILLS);
+
+	reset();
+	ST7735_beginBatch();
+	for (i = 0; i < FILLS; i++) {
+		drawfillRectangle(i * 0x0841, (i % 20) * 8, (i / 20) * 8, 4, 4);
+	}
+	ST7735_endBatch();
+	report("fills/batched", FILLS);
+	return 0;
+
+}
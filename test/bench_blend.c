@@ -0,0 +1,54 @@
+/*
+ *	Host benchmark of blendRectangle() against strip size: built once per
+ *	ST7735_BLEND_STRIP (see the Makefile), it blends a few rectangles over
+ *	a background and prints, per rectangle, what the readback and rewrite
+ *	sent, in the same columns as bench_images.  The GRAM hash must not
+ *	depend on the strip size; the bytes, windows and transactions do.
+ */
+
+#include <stdio.h>
+#include "st7735.h"
+
+#define STR(x)				#x
+#define XSTR(x)				STR(x)
+
+static const struct {
+	const char* name;
+	uint16_t x, y, w, h;
+	bool mask;
+} work[] = {
+	{ "screen", 0, 0, 160, 128, false },
+	{ "64x64", 10, 10, 64, 64, false },
+	{ "glyph12x16", 30, 40, 12, 16, true },
+	{ "bar160x8", 0, 100, 160, 8, false },
+};
+
+static uint8_t mask[160 * 128];
+
+int main(void) {
+
+	SpiModel before;
+	unsigned i;
+
+	for (i = 0; i < sizeof(mask); i++) {
+		mask[i] = (i * 37) & 0xff;
+	}
+	for (i = 0; i < sizeof(work) / sizeof(work[0]); i++) {
+		spiModelReset();
+		ST7735_panel0 = (ST7735_Panel){ ST7735_PANEL_RAW };
+		initLcd();
+		drawPatternRectangle(ST7735_PATTERN_VGRADIENT, 0x001f, 0xf800, 0, 0, 160, 128);
+		before = spiModel;
+		blendRectangle(0xffff, 96, work[i].mask ? mask : NULL,
+				work[i].x, work[i].y, work[i].w, work[i].h);
+		printf("blend/%s/strip%s\t16\t%lu\t%lu\t%lu\t%lu\t%08lx\n",
+				work[i].name, XSTR(ST7735_BLEND_STRIP),
+				(unsigned long)(spiModel.bytes - before.bytes),
+				(unsigned long)(spiModel.windows - before.windows),
+				(unsigned long)(spiModel.transactions - before.transactions),
+				(unsigned long)(spiModel.pixels - before.pixels),
+				(unsigned long)spiModelScreenHash());
+	}
+	return 0;
+
+}
@@ -0,0 +1,213 @@
+/*
+ *	Host benchmark of drawImage(): decodes each corpus image through the
+ *	driver, in 12, 16 and 18-bit color, and prints its encoded size and
+ *	what reached the (model) panel: SPI bytes, windows (CASET and RASET
+ *	commands), transactions and pixels written; and how the screen
+ *	compares with the image's source pixels: PSNR (as compr.html reports
+ *	it, 5-6-5 against the 8-bit original) and pixels whose 5-6-5 color
+ *	differs from the source's.  One line per image and mode; make bench
+ *	compares this with bench_baseline.txt.
+ *
+ *	Decode time varies from run to run, so it goes to the file given as
+ *	the argument (make bench: bench_times.txt) rather than the baseline:
+ *	microseconds per draw on the host, the best of REPEAT, model included
+ *	-- for comparing formats and decoder changes, not AVR cycles (make
+ *	cycles).
+ *
+ *	The corpus is the checked-in Image_Compress_Test (ImageData), and the
+ *	headers in corpus/, made by compr.html (see corpus/encode.js) with
+ *	their sources (name.ppm): each image in the command format
+ *	(drawImage()), and Huffman coded (name_huff, drawHuffImage()), which
+ *	must send the same bytes.
+ */
+
+#include <stdio.h>
+#include <math.h>
+#include <time.h>
+#include "st7735.h"
+#include "corpus/ict.h"
+#include "corpus/ui.h"
+#include "corpus/uipat.h"
+#include "corpus/photo.h"
+#include "corpus/photodither.h"
+#include "corpus/lineart.h"
+#include "corpus/text.h"
+#include "corpus/ict_huff.h"
+#include "corpus/ui_huff.h"
+#include "corpus/uipat_huff.h"
+#include "corpus/photo_huff.h"
+#include "corpus/photodither_huff.h"
+#include "corpus/lineart_huff.h"
+#include "corpus/text_huff.h"
+
+#define REPEAT				5
+
+#define IMAGE(name, NAME)	const uint8_t name[] PROGMEM = { \
+		(NAME##_PALETTE_LEN / 2) & 0xff, NAME##_PAL, NAME##_CMDS }
+
+IMAGE(Ict, ICT);
+IMAGE(Ui, UI);
+IMAGE(UiPat, UIPAT);
+IMAGE(Photo, PHOTO);
+IMAGE(PhotoDither, PHOTODITHER);
+IMAGE(LineArt, LINEART);
+IMAGE(Text, TEXT);
+const uint8_t IctHuff[] PROGMEM = { ICT_HUFF };
+const uint8_t UiHuff[] PROGMEM = { UI_HUFF };
+const uint8_t UiPatHuff[] PROGMEM = { UIPAT_HUFF };
+const uint8_t PhotoHuff[] PROGMEM = { PHOTO_HUFF };
+const uint8_t PhotoDitherHuff[] PROGMEM = { PHOTODITHER_HUFF };
+const uint8_t LineArtHuff[] PROGMEM = { LINEART_HUFF };
+const uint8_t TextHuff[] PROGMEM = { TEXT_HUFF };
+
+static const struct {
+	const char* name;
+	const uint8_t* img;
+	size_t size;				//	Encoded, bytes
+	const char* source;			//	Source pixels (PPM)
+	void (*draw)(const uint8_t* img, uint16_t x, uint16_t y);
+} corpus[] = {
+	{ "Image_Compress_Test", ImageData, sizeof(ImageData), "corpus/ict.ppm", drawImage },
+	{ "corpus/ict", Ict, sizeof(Ict), "corpus/ict.ppm", drawImage },
+	{ "corpus/ui", Ui, sizeof(Ui), "corpus/ui.ppm", drawImage },
+	{ "corpus/uipat", UiPat, sizeof(UiPat), "corpus/uipat.ppm", drawImage },
+	{ "corpus/photo", Photo, sizeof(Photo), "corpus/photo.ppm", drawImage },
+	{ "corpus/photodither", PhotoDither, sizeof(PhotoDither), "corpus/photodither.ppm", drawImage },
+	{ "corpus/lineart", LineArt, sizeof(LineArt), "corpus/lineart.ppm", drawImage },
+	{ "corpus/text", Text, sizeof(Text), "corpus/text.ppm", drawImage },
+	{ "corpus/ict_huff", IctHuff, sizeof(IctHuff), "corpus/ict.ppm", drawHuffImage },
+	{ "corpus/ui_huff", UiHuff, sizeof(UiHuff), "corpus/ui.ppm", drawHuffImage },
+	{ "corpus/uipat_huff", UiPatHuff, sizeof(UiPatHuff), "corpus/uipat.ppm", drawHuffImage },
+	{ "corpus/photo_huff", PhotoHuff, sizeof(PhotoHuff), "corpus/photo.ppm", drawHuffImage },
+	{ "corpus/photodither_huff", PhotoDitherHuff, sizeof(PhotoDitherHuff),
+			"corpus/photodither.ppm", drawHuffImage },
+	{ "corpus/lineart_huff", LineArtHuff, sizeof(LineArtHuff), "corpus/lineart.ppm", drawHuffImage },
+	{ "corpus/text_huff", TextHuff, sizeof(TextHuff), "corpus/text.ppm", drawHuffImage },
+};
+
+static const struct {
+	uint8_t mode;
+	uint8_t bits;
+} modes[] = {
+	{ ST7735_COLMOD_12BIT, 12 },
+	{ ST7735_COLMOD_16BIT, 16 },
+	{ ST7735_COLMOD_18BIT, 18 },
+};
+
+static uint8_t source[SCREEN_WIDTH * SCREEN_HEIGHT][3];
+static unsigned sourceWidth, sourceHeight;
+
+//	GRAM as logical (x, y): raw addressing at ROT0 puts X on RASET
+#define SCREEN(x, y)		spiModelPixel565((y), (x))
+
+/**
+ *	Reads a binary PPM (as encode.js writes them) into source[].
+ *	@return false if it can't be read, or doesn't fit the screen
+ */
+static bool loadSource(const char* path) {
+
+	FILE* f = fopen(path, "rb");
+	unsigned max;
+	bool ok;
+
+	if (!f) {
+		return false;
+	}
+	ok = fscanf(f, "P6 %u %u %u", &sourceWidth, &sourceHeight, &max) == 3 && max == 255
+			&& fgetc(f) != EOF && sourceWidth <= SCREEN_WIDTH && sourceHeight <= SCREEN_HEIGHT
+			&& fread(source, 3, sourceWidth * sourceHeight, f) == sourceWidth * sourceHeight;
+	fclose(f);
+	return ok;
+
+}
+
+/**
+ *	Compares the screen with source[], as compr.html computes PSNR: each
+ *	5-6-5 channel widened by bit replication, against the 8-bit original.
+ *	@param off	set to the pixels whose 5-6-5 color isn't the source's
+ *	@return PSNR, dB (INFINITY if equal)
+ */
+static double compare(unsigned* off) {
+
+	unsigned x, y, c;
+	uint16_t p;
+	const uint8_t* s;
+	uint8_t shown[3];
+	double sum = 0, d;
+
+	*off = 0;
+	for (y = 0; y < sourceHeight; y++) {
+		for (x = 0; x < sourceWidth; x++) {
+			p = SCREEN(x, y);
+			s = source[x + y * sourceWidth];
+			shown[0] = ((p >> 11) << 3) | (p >> 13);
+			shown[1] = (((p >> 5) & 0x3f) << 2) | ((p >> 9) & 0x03);
+			shown[2] = ((p & 0x1f) << 3) | ((p >> 2) & 0x07);
+			for (c = 0; c < 3; c++) {
+				d = s[c] - shown[c];
+				sum += d * d;
+			}
+			*off += p != (((s[0] >> 3) << 11) | ((s[1] >> 2) << 5) | (s[2] >> 3));
+		}
+	}
+	return sum ? 10 * log10(255.0 * 255 * 3 * sourceWidth * sourceHeight / sum) : INFINITY;
+
+}
+
+static double now(void) {
+
+	struct timespec t;
+
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return t.tv_sec * 1e6 + t.tv_nsec / 1e3;
+
+}
+
+int main(int argc, char** argv) {
+
+	SpiModel before;
+	unsigned i, j, k, off;
+	double psnr, t, best;
+	FILE* times = (argc > 1) ? fopen(argv[1], "w") : NULL;
+
+	printf("#image\tbits\tsize\tbytes\twindows\ttransactions\tpixels\tpsnr\toff\n");
+	if (times) {
+		fprintf(times, "#image\tbits\tsize\thost_us\n");
+	}
+	for (i = 0; i < sizeof(corpus) / sizeof(corpus[0]); i++) {
+		if (!loadSource(corpus[i].source)) {
+			fprintf(stderr, "bench_images: can't read %s\n", corpus[i].source);
+			return 1;
+		}
+		for (j = 0; j < sizeof(modes) / sizeof(modes[0]); j++) {
+			spiModelReset();
+			ST7735_panel0 = (ST7735_Panel){ ST7735_PANEL_RAW };
+			initLcd();
+			setColorMode(modes[j].mode);
+			before = spiModel;
+			corpus[i].draw(corpus[i].img, 0, 0);
+			psnr = compare(&off);
+			printf("%s\t%u\t%lu\t%lu\t%lu\t%lu\t%lu\t%.2f\t%u\n", corpus[i].name, modes[j].bits,
+					(unsigned long)corpus[i].size,
+					(unsigned long)(spiModel.bytes - before.bytes),
+					(unsigned long)(spiModel.windows - before.windows),
+					(unsigned long)(spiModel.transactions - before.transactions),
+					(unsigned long)(spiModel.pixels - before.pixels), psnr, off);
+			for (k = 0, best = INFINITY; times && k < REPEAT; k++) {
+				t = now();
+				corpus[i].draw(corpus[i].img, 0, 0);
+				t = now() - t;
+				best = (t < best) ? t : best;
+			}
+			if (times) {
+				fprintf(times, "%s\t%u\t%lu\t%.0f\n", corpus[i].name, modes[j].bits,
+						(unsigned long)corpus[i].size, best);
+			}
+		}
+	}
+	if (times) {
+		fclose(times);
+	}
+	return 0;
+
+}
@@ -0,0 +1,214 @@
+// Regenerates the corpus headers with compr.html's encoder, run under node
+// with just enough DOM for it:  node encode.js [../../compr.html]
+// The images are made here (deterministically), encoded with a 256 color
+// palette (some with a band index), and written as C headers (less the
+// "Encoded on" date line); the unbanded ones also as Huffman headers
+// (name_huff.h, for drawHuffImage()), and their source pixels as PPM
+// (name.ppm), which bench_images compares the decoded screen with.
+"use strict";
+const fs = require("fs");
+const path = require("path");
+
+const page = fs.readFileSync(process.argv[2] || path.join(__dirname, "../../compr.html"), "utf8");
+const src = page.match(/<script[^>]*>\s*<!--([\s\S]*?)--><\/script>/)[1];
+
+const els = {};
+function el(id) {
+	if (!els[id]) {
+		els[id] = { innerHTML: "", value: "", checked: false, disabled: false, files: [],
+				width: 0, height: 0, addEventListener() {},
+				getContext() { return { canvas: els[id], putImageData() {}, clearRect() {}, drawImage() {} }; } };
+	}
+	return els[id];
+}
+const OUTPUT_HEADER = 1, OUTPUT_HUFFMAN = 4;
+const outputs = [0, 1, 2, 3, 4, 5, 6, 7].map(i => el("outputtype" + i));
+const dithers = [0, 1, 2].map(i => el("dither" + i));
+global.document = { getElementById: el, getElementsByName: n => n == "dither" ? dithers : outputs,
+		getElementsByClassName: () => [{}] };
+global.window = { getComputedStyle: () => ({ getPropertyValue: () => "rgb(0, 0, 0)" }), setTimeout() {} };
+global.ImageData = function (w, h) { this.data = new Uint8ClampedArray(w * h * 4); };
+global.saveAs = () => {};
+(0, eval)(src + "\n;global.encoderScope = { get: n => eval(n), set: (n, v) => eval(n + ' = v') };");
+const g = global.encoderScope;
+
+const rgb = (r, gr, b) => (r & 0xff) | (gr & 0xff) << 8 | (b & 0xff) << 16;
+function random(seed) {
+	return () => (seed = (seed * 1103515245 + 12345) & 0x7fffffff) / 0x7fffffff;
+}
+
+//	Image_Compress_Test, decoded from the checked-in header (whose
+//	commands are all flat fills), to compare against the page's encoding
+function ict() {
+	const h = fs.readFileSync(path.join(__dirname, "../../Image_Compress_Test.h"), "utf8");
+	const bytes = name => h.match(new RegExp("#define IMAGE_COMPRESS_TEST_" + name + "\\s+\\\\\\r?\\n([^#]*)"))[1]
+			.split(/[\s,\\]+/).filter(s => s).map(Number);
+	const pal = bytes("PAL"), cmds = bytes("CMDS");
+	const w = 160, ht = 128, img = new Uint32Array(w * ht);
+	const colr = i => { const c = pal[2 * i] | pal[2 * i + 1] << 8;
+			return rgb((c >> 11) << 3, ((c >> 5) & 0x3f) << 2, (c & 0x1f) << 3); };
+	for (let p = 0; ; ) {
+		const c = cmds[p++];
+		if (c == 0xff) break;
+		if (!(c & 0x0f)) continue;
+		let k, dx = 1, dy = 1;
+		if (!(c & 0x10)) k = cmds[p++];
+		const x = cmds[p++], y = cmds[p++];
+		if ((c & 0x0f) != 1) {
+			dx = cmds[p++];
+			if ((c & 0x0f) == 3) { dy = dx; dx = 1; }
+			else if ((c & 0x0f) == 5) dy = cmds[p++];
+		}
+		for (let i = 0; i < dx; i++) for (let j = 0; j < dy; j++)
+			img[x + i + (y + j) * w] = colr((c & 0x10) ? cmds[p++] : k);
+	}
+	return { w, h: ht, img };
+}
+
+//	Flat UI: rectangles of 40 colors, and scattered single pixels
+function ui(w, h, seed) {
+	const rnd = random(seed), img = new Uint32Array(w * h), pal = [];
+	for (let i = 0; i < 40; i++) pal.push(rgb(rnd() * 255, rnd() * 255, rnd() * 255));
+	img.fill(pal[0]);
+	for (let k = 0; k < w * h / 400; k++) {
+		const x = Math.floor(rnd() * w), y = Math.floor(rnd() * h), c = pal[Math.floor(rnd() * 40)];
+		const x2 = Math.min(w, x + 1 + Math.floor(rnd() * 40)), y2 = Math.min(h, y + 1 + Math.floor(rnd() * 30));
+		for (let j = y; j < y2; j++) for (let i = x; i < x2; i++) img[i + j * w] = c;
+	}
+	for (let k = 0; k < w * h / 50; k++) img[Math.floor(rnd() * w * h)] = pal[Math.floor(rnd() * 40)];
+	return { w, h, img };
+}
+
+//	Noisy gradients, standing in for a photo
+function photo(w, h) {
+	const rnd = random(3), img = new Uint32Array(w * h);
+	for (let y = 0; y < h; y++) for (let x = 0; x < w; x++)
+		img[x + y * w] = rgb(x * 2 + rnd() * 20, y * 2 + rnd() * 20, x + y + rnd() * 20);
+	return { w, h, img };
+}
+
+//	Line art: 1-pixel lines, box and circle outlines, in 6 colors on white
+function lineart(w, h) {
+	const rnd = random(11), img = new Uint32Array(w * h).fill(rgb(255, 255, 255));
+	const ink = [rgb(0, 0, 0), rgb(200, 30, 30), rgb(30, 60, 200), rgb(20, 140, 40),
+			rgb(120, 120, 120), rgb(230, 140, 0)];
+	const plot = (x, y, c) => { if (x >= 0 && y >= 0 && x < w && y < h) img[x + y * w] = c; };
+	const pick = () => ink[Math.floor(rnd() * ink.length)];
+	for (let k = 0; k < 30; k++) {			//	Bresenham
+		let x0 = Math.floor(rnd() * w), y0 = Math.floor(rnd() * h);
+		const x1 = Math.floor(rnd() * w), y1 = Math.floor(rnd() * h), c = pick();
+		const dx = Math.abs(x1 - x0), dy = -Math.abs(y1 - y0), sx = x0 < x1 ? 1 : -1, sy = y0 < y1 ? 1 : -1;
+		for (let e = dx + dy; ; ) {
+			plot(x0, y0, c);
+			if (x0 == x1 && y0 == y1) break;
+			const e2 = 2 * e;
+			if (e2 >= dy) { e += dy; x0 += sx; }
+			if (e2 <= dx) { e += dx; y0 += sy; }
+		}
+	}
+	for (let k = 0; k < 12; k++) {
+		const x = Math.floor(rnd() * w), y = Math.floor(rnd() * h), c = pick();
+		const bw = 5 + Math.floor(rnd() * 50), bh = 5 + Math.floor(rnd() * 40);
+		for (let i = 0; i <= bw; i++) { plot(x + i, y, c); plot(x + i, y + bh, c); }
+		for (let j = 0; j <= bh; j++) { plot(x, y + j, c); plot(x + bw, y + j, c); }
+	}
+	for (let k = 0; k < 8; k++) {			//	Midpoint circles
+		const cx = Math.floor(rnd() * w), cy = Math.floor(rnd() * h), c = pick();
+		for (let r = 4 + Math.floor(rnd() * 30), x = r, y = 0, e = 1 - r; x >= y; y++) {
+			for (const [i, j] of [[x, y], [y, x], [-y, x], [-x, y], [-x, -y], [-y, -x], [y, -x], [x, -y]]) {
+				plot(cx + i, cy + j, c);
+			}
+			if (e < 0) e += 2 * y + 3;
+			else { e += 2 * (y - x) + 5; x--; }
+		}
+	}
+	return { w, h, img };
+}
+
+//	Text: lines of made-up 5x7 glyphs, dark on paper, with partly inked
+//	(grey) pixels beside strokes, as smoothed fonts have; a colored,
+//	double size heading
+function text(w, h) {
+	const rnd = random(13), img = new Uint32Array(w * h), glyphs = [];
+	const paper = [244, 240, 228], ink = [24, 24, 40], head = [40, 70, 160];
+	const mix = (a, b, t) => rgb(a[0] + (b[0] - a[0]) * t, a[1] + (b[1] - a[1]) * t, a[2] + (b[2] - a[2]) * t);
+	img.fill(mix(paper, ink, 0));
+	for (let i = 0; i < 26; i++) {
+		const g = [];
+		for (let j = 0; j < 35; j++) g.push(rnd() < 0.42 ? 3 : 0);
+		for (let j = 0; j < 35; j++) {
+			if (!g[j] && ((j % 5 && g[j - 1] == 3) || (j % 5 < 4 && g[j + 1] == 3)) && rnd() < 0.5) {
+				g[j] = 1 + Math.floor(rnd() * 2);
+			}
+		}
+		glyphs.push(g);
+	}
+	const glyph = (x, y, g, color, scale) => {
+		for (let j = 0; j < 35; j++) {
+			for (let s = 0; g[j] && s < scale * scale; s++) {
+				const px = x + (j % 5) * scale + s % scale, py = y + Math.floor(j / 5) * scale + Math.floor(s / scale);
+				if (px < w && py < h) img[px + py * w] = mix(paper, color, g[j] / 3);
+			}
+		}
+	};
+	for (let x = 4; x + 12 <= w - 4; x += 12) glyph(x, 3, glyphs[Math.floor(rnd() * 26)], head, 2);
+	for (let y = 22; y + 7 <= h; y += 10) {
+		for (let x = 4; x + 5 <= w - 4; ) {
+			const len = 2 + Math.floor(rnd() * 7);
+			for (let i = 0; i < len && x + 5 <= w - 4; i++, x += 6) glyph(x, y, glyphs[Math.floor(rnd() * 26)], ink, 1);
+			x += 4;
+		}
+	}
+	return { w, h, img };
+}
+
+//	Binary PPM (P6) of an image, for the source pixels
+function ppm(im) {
+	const head = Buffer.from("P6\n" + im.w + " " + im.h + "\n255\n"), px = Buffer.alloc(3 * im.w * im.h);
+	for (let i = 0; i < im.w * im.h; i++) {
+		px[3 * i] = im.img[i] & 0xff; px[3 * i + 1] = (im.img[i] >> 8) & 0xff; px[3 * i + 2] = (im.img[i] >> 16) & 0xff;
+	}
+	return Buffer.concat([head, px]);
+}
+
+const corpus = [
+	{ name: "ict", im: ict() },
+	{ name: "ui", im: ui(160, 128, 7) },
+	{ name: "uipat", im: ui(160, 128, 5), patterns: true },
+	{ name: "photo", im: photo(120, 90) },
+	{ name: "photodither", im: photo(100, 80), dither: 2 },
+	{ name: "uiband", im: ui(160, 128, 7), band: 16 },
+	{ name: "uipatband", im: ui(160, 128, 5), patterns: true, band: 10 },
+	{ name: "lineart", im: lineart(160, 128) },
+	{ name: "text", im: text(160, 128) }
+];
+
+for (const c of corpus) {
+	if (!c.band) {			//	(Before quantizing, which is done in place)
+		fs.writeFileSync(path.join(__dirname, c.name + ".ppm"), ppm(c.im));
+	}
+	g.set("imgWidth", c.im.w); g.set("imgHeight", c.im.h);
+	g.set("imgArray", c.im.img); g.set("imgMask", new Array(c.im.w * c.im.h).fill(0));
+	g.set("fileName", c.name + ".png"); g.set("aniFrames", []);
+	el("palettesize").value = "256";
+	el("patterns").checked = !!c.patterns;
+	dithers.forEach((d, i) => d.checked = i == (c.dither || 0));
+	g.get("processImgArray")(true);
+	el("bandheight").value = String(c.band || 0);
+	write(c.name + ".h", OUTPUT_HEADER);
+	if (!c.band) {
+		write(c.name + "_huff.h", OUTPUT_HUFFMAN);
+	}
+}
+
+function write(file, output) {
+	el("outputmessage").innerHTML = "";
+	outputs.forEach((r, i) => r.checked = i == output);
+	g.get("setOutputData")();
+	if (!/#endif/.test(el("output").innerHTML)) {
+		throw new Error(file + ": " + el("output").innerHTML);
+	}
+	fs.writeFileSync(path.join(__dirname, file),
+			el("output").innerHTML.replace(/ \*  Encoded on:.*\n/, "") + "\n");
+	console.log(file + ": " + el("outputmessage").innerHTML.replace(/<br>\s*/g, "; ").replace(/\s+/g, " "));
+}
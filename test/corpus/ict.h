@@ -0,0 +1,1706 @@
+/*
+ *  ST7735 Command Set Encoded Image
+ *  Encoder by Tim Williams, 2018-12-29
+ *  Original: ict.png
+ */
+
+#ifndef ICT_H_INCLUDED
+#define ICT_H_INCLUDED
+
+#define ICT_MAGIC_NUMBER	0x371e5453
+#define ICT_WIDTH		160
+#define ICT_HEIGHT		128
+#define ICT_CMD_LEN		11469	/*  Number of command bytes  */
+#define ICT_PALETTE_LEN		508	/*  Number of bytes (2 * colors)  */
+#define ICT_TOTAL_LEN		11978	/*  Total array size  */
+
+#define ICT_PAL		\
+	0xbd, 0x9f,	0x9d, 0xb7,	0x5c, 0xbf,	0x5d, 0xc7,		\
+	0x5d, 0xd7,	0x9c, 0xdf,	0x1c, 0xe7,	0xdc, 0xee,		\
+	0x7c, 0xf6,	0xdd, 0xe6,	0x9c, 0xee,	0x1c, 0xf6,		\
+	0xfd, 0xf5,	0xdd, 0xed,	0xbd, 0xed,	0x7d, 0xe5,		\
+	0x5c, 0xe5,	0x1c, 0xe5,	0xfb, 0xdc,	0x7a, 0xdc,		\
+	0xf9, 0xdb,	0x78, 0xdb,	0x9d, 0xa7,	0x7c, 0xe7,		\
+	0xdd, 0xde,	0xbd, 0xe6,	0xfc, 0xf5,	0x9a, 0xdc,		\
+	0x19, 0xdc,	0xb8, 0xdb,	0x9b, 0xf6,	0xdb, 0xf6,		\
+	0xbb, 0xdc,	0x3a, 0xdc,	0xfa, 0xf6,	0x1a, 0xf7,		\
+	0xbd, 0xc6,	0x9d, 0xe5,	0x39, 0xf7,	0x5a, 0xbf,		\
+	0xbb, 0xbe,	0x5d, 0xc6,	0xfb, 0xe6,	0xdb, 0xee,		\
+	0x39, 0xb7,	0xb8, 0xb6,	0x79, 0xbe,	0x3b, 0xbe,		\
+	0xdd, 0xc5,	0x1b, 0xef,	0x17, 0xb7,	0xf7, 0xb6,		\
+	0x7d, 0xee,	0x7c, 0xee,	0x7c, 0xaf,	0x3b, 0xe7,		\
+	0x3a, 0xe7,	0x39, 0xef,	0x18, 0xef,	0x7b, 0xe7,		\
+	0x3d, 0xde,	0x3d, 0xee,	0x7b, 0xa7,	0x5b, 0xd7,		\
+	0x5a, 0xe7,	0xf7, 0xee,	0x1a, 0xef,	0x5a, 0xef,		\
+	0x5d, 0xe6,	0x39, 0xaf,	0x39, 0xe7,	0xd6, 0xee,		\
+	0xb6, 0xee,	0x59, 0xef,	0x3d, 0xe6,	0xfd, 0xe5,		\
+	0x5a, 0xcf,	0xd8, 0xde,	0x97, 0xe6,	0xbd, 0xd5,		\
+	0x5c, 0xe6,	0xba, 0xd6,	0x58, 0xde,	0x3a, 0xd6,		\
+	0xf6, 0xb6,	0x3a, 0xce,	0x9f, 0x00,	0x39, 0xc7,		\
+	0x17, 0xc7,	0x36, 0xc7,	0xf6, 0xc6,	0x98, 0xc6,		\
+	0xb7, 0xd6,	0xd6, 0xde,	0xb6, 0xe6,	0xd6, 0xbe,		\
+	0xb6, 0xc6,	0x58, 0xce,	0xdb, 0xdd,	0x39, 0xd7,		\
+	0x57, 0xd7,	0x36, 0xd7,	0xd6, 0xd6,	0xf7, 0xde,		\
+	0x42, 0xfd,	0xd7, 0xc6,	0xf6, 0xce,	0x95, 0xc6,		\
+	0x55, 0xd6,	0x76, 0xce,	0xd8, 0xd5,	0x7a, 0xe5,		\
+	0x58, 0xe7,	0x57, 0xe7,	0x76, 0xe7,	0x16, 0xe7,		\
+	0xf6, 0xe6,	0xd7, 0xe6,	0x17, 0xbf,	0xb7, 0xde,		\
+	0x75, 0xce,	0x34, 0xde,	0x15, 0xde,	0xd7, 0xdd,		\
+	0x79, 0xe5,	0x5b, 0xe5,	0x58, 0xef,	0xf6, 0xdd,		\
+	0x78, 0xdd,	0x3b, 0xe5,	0x57, 0xef,	0x16, 0xef,		\
+	0x59, 0xc6,	0x77, 0xe6,	0x59, 0xdd,	0x1b, 0xdd,		\
+	0x97, 0xdd,	0x5a, 0xdd,	0x18, 0xe7,	0x98, 0xdd,		\
+	0xbb, 0xce,	0x97, 0xc6,	0x17, 0xce,	0xd9, 0xdd,		\
+	0xfc, 0xe6,	0x16, 0xbf,	0xd7, 0xbe,	0xbb, 0xe5,		\
+	0x9c, 0xe5,	0x39, 0xe6,	0xfa, 0xee,	0xf9, 0xee,		\
+	0x97, 0xee,	0x77, 0xee,	0xfa, 0xe5,	0x9a, 0xee,		\
+	0x99, 0xee,	0xf8, 0xe6,	0x58, 0xee,	0x16, 0xcf,		\
+	0x37, 0xd7,	0x17, 0xdf,	0x98, 0xee,	0x56, 0xdf,		\
+	0x7b, 0xee,	0x5a, 0xee,	0xba, 0xf6,	0x5b, 0xf6,		\
+	0x1b, 0xee,	0x79, 0xee,	0x56, 0xcf,	0x1c, 0xee,		\
+	0x98, 0xe6,	0xdb, 0xe5,	0x59, 0xce,	0x56, 0xd7,		\
+	0x59, 0xe6,	0x3a, 0xee,	0xba, 0xe5,	0xd8, 0xdd,		\
+	0x57, 0xce,	0xfc, 0xe5,	0x1a, 0xe6,	0x39, 0xee,		\
+	0x35, 0xd6,	0xfa, 0xe6,	0x9c, 0xe6,	0xf9, 0xe5,		\
+	0x37, 0xe6,	0x1b, 0xe6,	0x95, 0xe6,	0x75, 0xe6,		\
+	0xd8, 0xee,	0x55, 0xde,	0x78, 0xe6,	0x37, 0xef,		\
+	0xb6, 0xde,	0x95, 0xd6,	0xb6, 0xce,	0xb7, 0xbe,		\
+	0x36, 0xd6,	0x39, 0xce,	0x77, 0xc6,	0x38, 0xce,		\
+	0xf7, 0xd5,	0xf8, 0xcd,	0x98, 0xd5,	0x19, 0xc6,		\
+	0x99, 0xd5,	0x1a, 0xdd,	0x58, 0xc6,	0xd9, 0xcd,		\
+	0x5a, 0xd5,	0x38, 0xc6,	0x99, 0xdd,	0x96, 0xd6,		\
+	0x95, 0xde,	0x7c, 0xcd,	0x56, 0xe6,	0xba, 0xcd,		\
+	0x3c, 0xd5,	0x16, 0xde,	0x16, 0xe6,	0x18, 0xe6,		\
+	0xd8, 0xe5,	0xd7, 0xce,	0x56, 0xd6,	0xf7, 0xd6,		\
+	0x77, 0xdf,	0x36, 0xdf,	0xf9, 0xc5,	0x5b, 0xd5,		\
+	0x59, 0xe7,	0x5b, 0xe6,	0x19, 0xdd,	0x99, 0xdc,		\
+	0x38, 0xdd,	0x95, 0xef,	0xf5, 0xdd,	0x76, 0xdd,		\
+	0xd8, 0xdc,	0x59, 0xdc,	0x95, 0xf7,	0x55, 0xdd,		\
+	0x77, 0xdc,	0x18, 0xdc,	0x56, 0xdc,	0xb7, 0xdb,		\
+	0xda, 0xdc,	0x95, 0xdd,	0xb6, 0xdc,	0xb9, 0xe5,		\
+	0xf6, 0xdc,	0x17, 0xdc
+
+#define ICT_CMDS		\
+	0x05, 0, 0, 0, 19, 6,		\
+	0x25, 4, 6, 13, 2,		\
+	0x05, 4, 24, 6, 2, 7,		\
+	0x25, 25, 0, 2, 6,		\
+	0x07, 4, 26, 12, 5, 2,		\
+	75, 11, 5, 2,		\
+	80, 10, 4, 2,		\
+	158, 83, 2, 4,		\
+	0x05, 3, 132, 55, 28, 20,		\
+	0x25, 80, 12, 15, 9,		\
+	0x07, 42, 105, 76, 8, 16,		\
+	121, 63, 11, 11,		\
+	27, 14, 7, 17,		\
+	7, 94, 9, 13,		\
+	95, 0, 22, 4,		\
+	137, 41, 5, 14,		\
+	113, 71, 6, 11,		\
+	151, 75, 9, 7,		\
+	74, 98, 7, 8,		\
+	34, 11, 6, 9,		\
+	0, 95, 7, 6,		\
+	90, 6, 7, 6,		\
+	16, 10, 8, 5,		\
+	86, 21, 10, 4,		\
+	116, 63, 5, 5,		\
+	76, 13, 4, 6,		\
+	75, 108, 11, 2,		\
+	102, 81, 3, 7,		\
+	73, 94, 5, 4,		\
+	81, 102, 4, 5,		\
+	92, 4, 10, 2,		\
+	22, 1, 2, 9,		\
+	124, 74, 6, 3,		\
+	27, 31, 4, 4,		\
+	109, 72, 4, 4,		\
+	136, 37, 4, 4,		\
+	142, 47, 2, 8,		\
+	154, 82, 4, 4,		\
+	0, 10, 5, 3,		\
+	119, 75, 3, 5,		\
+	40, 10, 2, 7,		\
+	34, 20, 2, 6,		\
+	126, 61, 6, 2,		\
+	107, 92, 5, 2,		\
+	113, 82, 2, 5,		\
+	4, 101, 3, 3,		\
+	13, 91, 3, 3,		\
+	24, 14, 3, 3,		\
+	87, 9, 3, 3,		\
+	135, 34, 3, 3,		\
+	148, 75, 3, 3,		\
+	115, 4, 4, 2,		\
+	0x05, 24, 120, 7, 4, 2,		\
+	0x05, 12, 0, 48, 10, 11,		\
+	0x25, 0, 68, 7, 6,		\
+	0x07, 10, 70, 113, 3, 9,		\
+	127, 11, 4, 5,		\
+	0, 45, 6, 3,		\
+	79, 60, 2, 8,		\
+	10, 48, 3, 5,		\
+	81, 56, 2, 6,		\
+	85, 77, 6, 2,		\
+	132, 4, 2, 5,		\
+	83, 54, 2, 4,		\
+	133, 0, 2, 4,		\
+	0x05, 48, 73, 81, 13, 9,		\
+	0x25, 11, 59, 4, 29,		\
+	0x07, 40, 130, 78, 17, 5,		\
+	125, 19, 9, 9,		\
+	67, 91, 4, 13,		\
+	146, 46, 7, 7,		\
+	86, 82, 11, 3,		\
+	112, 9, 8, 4,		\
+	138, 105, 8, 4,		\
+	62, 44, 10, 3,		\
+	117, 85, 4, 7,		\
+	5, 87, 6, 4,		\
+	80, 90, 4, 6,		\
+	15, 51, 3, 7,		\
+	75, 74, 3, 7,		\
+	50, 50, 4, 5,		\
+	145, 40, 3, 6,		\
+	24, 38, 4, 4,		\
+	0, 90, 5, 3,		\
+	18, 47, 3, 5,		\
+	70, 86, 3, 5,		\
+	135, 24, 3, 5,		\
+	147, 82, 3, 5,		\
+	118, 59, 7, 2,		\
+	58, 47, 6, 2,		\
+	110, 7, 6, 2,		\
+	119, 13, 3, 4,		\
+	121, 82, 2, 6,		\
+	138, 29, 3, 4,		\
+	153, 48, 3, 4,		\
+	9, 82, 2, 5,		\
+	115, 89, 2, 5,		\
+	123, 17, 2, 5,		\
+	123, 81, 5, 2,		\
+	141, 32, 2, 5,		\
+	143, 36, 2, 5,		\
+	12, 56, 3, 3,		\
+	22, 43, 3, 3,		\
+	39, 106, 3, 3,		\
+	68, 107, 2, 4,		\
+	68, 104, 4, 2,		\
+	128, 28, 4, 2,		\
+	0x05, 79, 65, 92, 2, 10,		\
+	0x25, 149, 90, 2, 9,		\
+	0x07, 3, 38, 109, 4, 2,		\
+	139, 83, 4, 2,		\
+	148, 99, 2, 4,		\
+	0x05, 15, 58, 51, 20, 6,		\
+	0x25, 110, 21, 12, 10,		\
+	0x07, 25, 74, 40, 6, 11,		\
+	0, 76, 7, 9,		\
+	70, 57, 5, 9,		\
+	137, 0, 2, 22,		\
+	65, 109, 2, 17,		\
+	112, 15, 5, 6,		\
+	61, 90, 4, 7,		\
+	153, 42, 7, 4,		\
+	72, 66, 2, 9,		\
+	107, 23, 3, 6,		\
+	147, 91, 2, 8,		\
+	7, 75, 2, 7,		\
+	67, 49, 7, 2,		\
+	112, 31, 7, 2,		\
+	135, 9, 2, 7,		\
+	54, 55, 4, 3,		\
+	67, 122, 2, 6,		\
+	74, 36, 3, 4,		\
+	0, 85, 5, 2,		\
+	65, 57, 5, 2,		\
+	122, 25, 2, 5,		\
+	139, 21, 2, 5,		\
+	150, 40, 3, 3,		\
+	63, 97, 2, 4,		\
+	117, 17, 2, 4,		\
+	0x05, 5, 63, 0, 23, 9,		\
+	0x25, 0, 105, 4, 23,		\
+	0x07, 6, 27, 0, 11, 8,		\
+	65, 9, 15, 2,		\
+	158, 97, 2, 13,		\
+	26, 8, 7, 3,		\
+	59, 0, 4, 5,		\
+	86, 0, 4, 5,		\
+	0x05, 8, 84, 62, 18, 14,		\
+	0x25, 102, 63, 7, 7,		\
+	0x07, 11, 122, 0, 8, 5,		\
+	0, 33, 4, 9,		\
+	43, 0, 12, 3,		\
+	154, 90, 2, 16,		\
+	0, 61, 5, 5,		\
+	74, 113, 5, 4,		\
+	4, 37, 3, 6,		\
+	82, 67, 2, 7,		\
+	7, 41, 3, 4,		\
+	124, 5, 5, 2,		\
+	102, 70, 3, 3,		\
+	0x05, 18, 54, 62, 13, 17,		\
+	0x25, 45, 107, 16, 12,		\
+	0x07, 28, 47, 95, 12, 11,		\
+	127, 91, 8, 6,		\
+	143, 13, 3, 11,		\
+	139, 88, 4, 8,		\
+	56, 79, 7, 4,		\
+	132, 97, 7, 4,		\
+	141, 4, 2, 14,		\
+	53, 90, 5, 5,		\
+	34, 115, 11, 2,		\
+	54, 119, 7, 3,		\
+	109, 121, 3, 7,		\
+	134, 86, 5, 4,		\
+	56, 60, 9, 2,		\
+	67, 66, 2, 9,		\
+	146, 22, 2, 8,		\
+	59, 101, 3, 5,		\
+	19, 67, 2, 6,		\
+	61, 107, 2, 6,		\
+	101, 118, 6, 2,		\
+	148, 30, 3, 4,		\
+	45, 101, 2, 5,		\
+	50, 92, 3, 3,		\
+	135, 94, 3, 3,		\
+	43, 111, 2, 4,		\
+	105, 120, 4, 2,		\
+	129, 89, 4, 2,		\
+	151, 33, 2, 4,		\
+	154, 37, 4, 2,		\
+	0x05, 38, 56, 14, 16, 15,		\
+	0x25, 88, 52, 15, 7,		\
+	0x07, 31, 100, 36, 8, 13,		\
+	8, 111, 5, 17,		\
+	93, 30, 7, 10,		\
+	55, 29, 11, 6,		\
+	18, 18, 4, 16,		\
+	0, 18, 6, 10,		\
+	156, 117, 4, 11,		\
+	10, 35, 8, 5,		\
+	91, 47, 8, 5,		\
+	152, 110, 4, 7,		\
+	55, 9, 5, 5,		\
+	22, 25, 3, 8,		\
+	45, 5, 8, 3,		\
+	58, 35, 4, 5,		\
+	104, 49, 5, 4,		\
+	90, 28, 8, 2,		\
+	96, 40, 4, 4,		\
+	72, 21, 3, 5,		\
+	92, 42, 3, 5,		\
+	100, 33, 5, 3,		\
+	108, 53, 3, 5,		\
+	7, 32, 3, 4,		\
+	53, 26, 2, 6,		\
+	103, 55, 3, 4,		\
+	53, 6, 2, 5,		\
+	3, 28, 3, 3,		\
+	18, 34, 3, 3,		\
+	0, 16, 4, 2,		\
+	12, 40, 4, 2,		\
+	66, 29, 2, 4,		\
+	91, 30, 2, 4,		\
+	0x05, 21, 151, 0, 9, 27,		\
+	0x25, 27, 121, 20, 7,		\
+	0x07, 8, 91, 124, 14, 4,		\
+	146, 0, 5, 9,		\
+	47, 125, 10, 3,		\
+	155, 27, 5, 6,		\
+	149, 9, 2, 11,		\
+	93, 122, 9, 2,		\
+	24, 124, 3, 4,		\
+	47, 123, 5, 2,		\
+	0x05, 50, 115, 102, 15, 15,		\
+	0x25, 88, 90, 14, 15,		\
+	0x07, 36, 33, 35, 11, 14,		\
+	33, 92, 10, 10,		\
+	127, 36, 6, 16,		\
+	118, 117, 5, 11,		\
+	114, 97, 11, 5,		\
+	38, 25, 5, 10,		\
+	44, 47, 4, 12,		\
+	130, 104, 5, 9,		\
+	92, 108, 7, 5,		\
+	101, 10, 3, 11,		\
+	107, 112, 8, 4,		\
+	118, 52, 10, 3,		\
+	28, 44, 5, 5,		\
+	43, 19, 2, 11,		\
+	89, 105, 11, 2,		\
+	26, 84, 10, 2,		\
+	39, 49, 5, 4,		\
+	102, 95, 4, 5,		\
+	104, 8, 4, 5,		\
+	31, 102, 9, 2,		\
+	36, 90, 9, 2,		\
+	46, 16, 2, 9,		\
+	123, 117, 3, 6,		\
+	90, 88, 8, 2,		\
+	8, 11, 4, 3,		\
+	30, 98, 3, 4,		\
+	36, 29, 2, 6,		\
+	86, 93, 2, 6,		\
+	125, 32, 4, 3,		\
+	43, 92, 2, 5,		\
+	44, 42, 2, 5,		\
+	119, 95, 5, 2,		\
+	19, 82, 3, 3,		\
+	40, 22, 3, 3,		\
+	31, 40, 2, 4,		\
+	121, 55, 4, 2,		\
+	0x05, 114, 135, 116, 15, 3,		\
+	0x25, 19, 99, 6, 6,		\
+	0x07, 6, 49, 32, 3, 10,		\
+	148, 119, 4, 3,		\
+	52, 35, 2, 5,		\
+	128, 123, 2, 5,		\
+	48, 29, 3, 3,		\
+	131, 119, 3, 3,		\
+	0x05, 72, 83, 35, 7, 11,		\
+	0x25, 18, 88, 12, 5,		\
+	0x07, 24, 21, 108, 10, 6,		\
+	111, 36, 4, 14,		\
+	9, 18, 5, 11,		\
+	78, 28, 7, 6,		\
+	15, 117, 3, 11,		\
+	107, 103, 5, 6,		\
+	18, 111, 3, 8,		\
+	84, 46, 4, 5,		\
+	12, 29, 4, 4,		\
+	51, 44, 5, 3,		\
+	113, 51, 3, 5,		\
+	42, 83, 3, 4,		\
+	48, 11, 4, 3,		\
+	54, 42, 6, 2,		\
+	77, 124, 3, 4,		\
+	99, 26, 6, 2,		\
+	103, 107, 4, 3,		\
+	85, 30, 2, 5,		\
+	143, 111, 5, 2,		\
+	79, 121, 3, 3,		\
+	81, 118, 3, 3,		\
+	108, 100, 3, 3,		\
+	31, 109, 2, 4,		\
+	81, 34, 2, 4,		\
+	0x05, 242, 134, 122, 14, 6,		\
+	0x25, 148, 125, 3, 3,		\
+	0x05, 121, 25, 63, 23, 17,		\
+	0x25, 25, 52, 10, 11,		\
+	0x07, 10, 118, 37, 6, 11,		\
+	49, 63, 2, 26,		\
+	35, 57, 5, 6,		\
+	25, 80, 7, 2,		\
+	21, 75, 4, 3,		\
+	51, 82, 2, 6,		\
+	83, 124, 3, 4,		\
+	86, 119, 3, 4,		\
+	23, 55, 2, 5,		\
+	40, 61, 4, 2,		\
+	0x02, 86, 43, 106, 33,		\
+	0x22, 76, 107, 27,		\
+	0x22, 26, 104, 10,		\
+	0x22, 36, 105, 7,		\
+	0x02, 0, 7, 8, 8,		\
+	0x07, 3, 4, 34, 9, 7,		\
+	3, 111, 70, 7,		\
+	36, 135, 75, 9,		\
+	0x22, 145, 54, 9,		\
+	0x07, 3, 105, 4, 8,		\
+	0, 94, 7,		\
+	118, 62, 7,		\
+	0x02, 41, 135, 76, 9,		\
+	0x22, 146, 53, 8,		\
+	0x22, 0, 93, 7,		\
+	0x22, 118, 61, 7,		\
+	0x02, 75, 89, 80, 7,		\
+	0x02, 48, 135, 77, 9,		\
+	0x22, 78, 80, 7,		\
+	0x22, 132, 83, 7,		\
+	0x02, 79, 59, 49, 8,		\
+	0x22, 64, 48, 7,		\
+	0x02, 8, 96, 61, 10,		\
+	0x22, 93, 76, 9,		\
+	0x02, 11, 84, 76, 9,		\
+	0x07, 3, 62, 6, 9, 7,		\
+	63, 90, 26, 7,		\
+	30, 87, 61, 9,		\
+	0x22, 97, 60, 8,		\
+	0x02, 47, 90, 85, 7,		\
+	0x02, 18, 135, 101, 7,		\
+	0x02, 34, 87, 60, 9,		\
+	0x22, 97, 59, 8,		\
+	0x02, 38, 87, 59, 9,		\
+	0x22, 60, 13, 7,		\
+	0x22, 75, 23, 7,		\
+	0x02, 134, 98, 117, 8,		\
+	0x07, 5, 21, 29, 120, 14,		\
+	114, 136, 115, 9,		\
+	115, 138, 114, 7,		\
+	102, 32, 88, 7,		\
+	95, 91, 113, 11,		\
+	0x22, 24, 83, 9,		\
+	0x22, 26, 49, 8,		\
+	0x02, 242, 136, 121, 10,		\
+	0x02, 120, 93, 114, 8,		\
+	0x22, 25, 82, 7,		\
+	0x02, 121, 93, 115, 8,		\
+	0x03, 86, 134, 13, 40,		\
+	0x03, 36, 95, 14, 7,		\
+	0x23, 144, 47, 7,		\
+	0x03, 41, 96, 14, 7,		\
+	0x03, 12, 7, 59, 9,		\
+	0x23, 73, 119, 9,		\
+	0x23, 131, 6, 9,		\
+	0x03, 75, 78, 58, 17,		\
+	0x23, 151, 87, 12,		\
+	0x03, 48, 10, 62, 14,		\
+	0x23, 15, 75, 13,		\
+	0x23, 76, 65, 9,		\
+	0x03, 79, 77, 59, 15,		\
+	0x23, 74, 67, 12,		\
+	0x07, 3, 72, 38, 10,		\
+	75, 63, 10,		\
+	9, 74, 8,		\
+	0x03, 15, 64, 113, 11,		\
+	0x23, 80, 42, 11,		\
+	0x03, 5, 4, 106, 12,		\
+	0x23, 159, 87, 10,		\
+	0x23, 4, 121, 7,		\
+	0x03, 6, 157, 96, 11,		\
+	0x03, 7, 156, 97, 9,		\
+	0x23, 157, 89, 7,		\
+	0x03, 8, 153, 97, 9,		\
+	0x07, 6, 11, 153, 90, 7,		\
+	16, 139, 0, 18,		\
+	17, 140, 0, 18,		\
+	59, 5, 113, 11,		\
+	63, 26, 25, 8,		\
+	47, 15, 64, 11,		\
+	0x23, 84, 92, 8,		\
+	0x03, 18, 53, 62, 15,		\
+	0x23, 143, 90, 10,		\
+	0x23, 57, 83, 7,		\
+	0x03, 67, 6, 113, 11,		\
+	0x07, 3, 76, 16, 100, 8,		\
+	39, 136, 42, 7,		\
+	38, 6, 22, 13,		\
+	0x23, 55, 19, 10,		\
+	0x07, 3, 7, 114, 9,		\
+	108, 40, 9,		\
+	13, 110, 7,		\
+	0x03, 44, 135, 42, 7,		\
+	0x03, 134, 52, 62, 15,		\
+	0x03, 58, 13, 117, 11,		\
+	0x23, 109, 41, 9,		\
+	0x23, 17, 26, 8,		\
+	0x23, 91, 39, 8,		\
+	0x03, 77, 17, 88, 7,		\
+	0x03, 228, 17, 101, 7,		\
+	0x03, 50, 133, 38, 13,		\
+	0x23, 100, 12, 8,		\
+	0x03, 65, 14, 116, 12,		\
+	0x23, 110, 41, 10,		\
+	0x07, 3, 16, 25, 9,		\
+	90, 39, 9,		\
+	8, 23, 7,		\
+	0x03, 123, 51, 62, 15,		\
+	0x07, 7, 114, 18, 101, 7,		\
+	95, 126, 38, 10,		\
+	72, 115, 37, 11,		\
+	190, 116, 37, 11,		\
+	120, 125, 39, 8,		\
+	193, 117, 38, 10,		\
+	121, 48, 71, 14,		\
+	0x23, 124, 39, 8,		\
+	0x03, 104, 48, 36, 35,		\
+	0x15, 141, 0, 4, 4,		\
+		18, 18, 18, 18, 19, 19, 27, 32, 20, 20, 28, 33, 21, 21, 29, 29,		\
+	0x16, 0x15, 0x00, 142, 4,		\
+	0x16, 0x1a, 0x00, 145, 13,		\
+	0x16, 0x1f, 0x00, 146, 18,		\
+	0x16, 0x24, 0x00, 147, 22,		\
+	0x15, 143, 89, 4, 4,		\
+		135, 18, 18, 18, 16, 17, 135, 18, 15, 16, 16, 17, 15, 15, 15, 16,		\
+	0x16, 0x15, 0x00, 59, 96,		\
+	0x16, 0x1a, 0x00, 61, 100,		\
+	0x16, 0x1f, 0x00, 61, 121,		\
+	0x15, 93, 39, 4, 4,		\
+		38, 104, 38, 38, 38, 38, 104, 38, 38, 38, 38, 104, 38, 38, 38, 38,		\
+	0x16, 0x15, 0x00, 96, 43,		\
+	0x16, 0x1a, 0x00, 100, 48,		\
+	0x16, 0x1f, 0x00, 104, 52,		\
+	0x16, 0x24, 0x00, 108, 57,		\
+	0x15, 35, 117, 4, 4,		\
+		19, 20, 21, 21, 19, 20, 21, 21, 27, 28, 29, 21, 32, 33, 29, 21,		\
+	0x16, 0x15, 0x00, 41, 118,		\
+	0x16, 0x1a, 0x00, 45, 119,		\
+	0x16, 0x1f, 0x00, 97, 119,		\
+	0x15, 51, 121, 4, 4,		\
+		19, 20, 21, 21, 27, 28, 29, 21, 32, 33, 29, 21, 18, 27, 28, 29,		\
+	0x16, 0x15, 0x00, 56, 123,		\
+	0x15, 21, 46, 4, 4,		\
+		48, 48, 48, 48, 48, 48, 47, 47, 48, 47, 46, 45, 47, 45, 51, 50,		\
+	0x16, 0x15, 0x00, 122, 84,		\
+	0x16, 0x1a, 0x00, 85, 87,		\
+	0x15, 68, 37, 4, 4,		\
+		12, 12, 13, 75, 75, 75, 75, 79, 79, 79, 48, 48, 48, 48, 48, 48,		\
+	0x16, 0x15, 0x00, 12, 51,		\
+	0x16, 0x1a, 0x00, 9, 57,		\
+	0x16, 0x1f, 0x00, 7, 66,		\
+	0x15, 125, 16, 4, 4,		\
+		75, 79, 48, 48, 13, 75, 48, 48, 12, 75, 79, 48, 12, 75, 79, 48,		\
+	0x16, 0x15, 0x00, 79, 77,		\
+	0x16, 0x1a, 0x00, 83, 78,		\
+	0x16, 0x1f, 0x00, 88, 79,		\
+	0x15, 142, 27, 4, 4,		\
+		15, 15, 15, 79, 16, 15, 15, 15, 17, 16, 16, 15, 18, 135, 17, 16,		\
+	0x16, 0x15, 0x00, 144, 31,		\
+	0x15, 153, 51, 4, 4,		\
+		48, 48, 41, 36, 48, 41, 36, 3, 48, 41, 36, 3, 48, 41, 36, 3,		\
+	0x16, 0x15, 0x00, 73, 89,		\
+	0x16, 0x1a, 0x00, 8, 90,		\
+	0x15, 37, 20, 4, 4,		\
+		3, 3, 3, 2, 3, 2, 39, 39, 2, 39, 44, 44, 39, 44, 50, 50,		\
+	0x16, 0x15, 0x00, 31, 31,		\
+	0x15, 138, 25, 4, 4,		\
+		79, 48, 48, 48, 15, 79, 79, 48, 15, 15, 79, 79, 15, 15, 15, 15,		\
+	0x16, 0x15, 0x00, 145, 36,		\
+	0x15, 29, 37, 4, 4,		\
+		48, 48, 47, 47, 47, 47, 46, 45, 46, 45, 51, 50, 51, 50, 50, 50,		\
+	0x16, 0x15, 0x00, 121, 88,		\
+	0x15, 143, 96, 4, 4,		\
+		18, 18, 18, 18, 18, 135, 17, 17, 17, 16, 16, 16, 16, 15, 15, 15,		\
+	0x16, 0x15, 0x00, 61, 112,		\
+	0x16, 0x1a, 0x00, 60, 116,		\
+	0x15, 2, 31, 4, 4,		\
+		30, 8, 8, 8, 34, 30, 8, 8, 38, 34, 31, 30, 38, 38, 35, 34,		\
+	0x16, 0x15, 0x00, 5, 35,		\
+	0x16, 0x1a, 0x00, 9, 40,		\
+	0x15, 36, 49, 4, 4,		\
+		50, 84, 95, 120, 50, 50, 84, 95, 50, 50, 50, 84, 50, 50, 50, 50,		\
+	0x16, 0x15, 0x00, 40, 53,		\
+	0x15, 66, 117, 4, 4,		\
+		15, 15, 15, 15, 14, 37, 15, 15, 13, 14, 14, 14, 12, 12, 13, 13,		\
+	0x16, 0x15, 0x00, 69, 124,		\
+	0x15, 57, 56, 4, 4,		\
+		15, 15, 16, 17, 15, 15, 16, 17, 15, 15, 16, 135, 15, 16, 17, 18,		\
+	0x16, 0x15, 0x00, 37, 111,		\
+	0x15, 30, 91, 4, 4,		\
+		72, 94, 93, 102, 93, 102, 106, 145, 106, 145, 118, 50, 118, 50, 50, 50,		\
+	0x16, 0x15, 0x00, 28, 95,		\
+	0x15, 79, 110, 12, 8,		\
+		4, 24, 10, 8, 8, 8, 30, 150, 4, 24, 10, 8, 8, 30, 155, 192, 3, 4, 9, 53, 8, 164, 156, 65, 3, 4, 24, 52, 171, 165, 162, 72, 3, 3, 24, 186, 177, 162, 152, 72, 3, 3, 36, 186, 176, 152, 72, 72, 3, 36, 81, 82, 172, 72, 72, 72, 36, 140, 83, 133, 78, 94, 94, 216, 85, 82, 133, 72, 94, 102, 215, 197, 201, 133, 78, 94, 102, 106, 198, 108, 92, 94, 94, 102, 106, 96, 120, 108, 90, 102, 102, 90, 95, 107, 108, 121,		\
+	0x07, 218, 16, 58, 3, 30,		\
+		48, 48, 48, 47, 47, 47, 46, 45, 45, 46, 132, 207, 210, 207, 207, 132, 46, 47, 47, 47, 47, 47, 48, 48, 48, 48, 48, 48, 85, 83, 47, 47, 47, 46, 45, 45, 46, 210, 210, 207, 205, 205, 142, 205, 205, 205, 213, 210, 46, 45, 45, 46, 47, 47, 47, 47, 47, 174, 201, 82, 46, 45, 146, 202, 202, 207, 205, 211, 211, 212, 137, 137, 134, 137, 137, 134, 204, 109, 96, 95, 84, 51, 45, 45, 45, 45, 45, 91, 119, 72,		\
+	48, 14, 7, 12,		\
+		93, 106, 118, 50, 50, 51, 45, 45, 45, 44, 44, 44, 94, 102, 105, 45, 45, 46, 47, 47, 40, 39, 39, 76, 72, 94, 119, 91, 132, 47, 48, 41, 36, 3, 3, 3, 72, 72, 78, 82, 83, 83, 85, 36, 36, 3, 3, 76, 72, 72, 72, 78, 133, 82, 81, 140, 76, 63, 63, 63, 72, 72, 72, 72, 72, 71, 138, 64, 63, 64, 64, 57, 65, 65, 65, 65, 65, 65, 57, 57, 57, 38, 38, 38,		\
+	58, 83, 12, 7,		\
+		18, 209, 209, 209, 209, 209, 209, 18, 209, 209, 209, 137, 137, 137, 18, 209, 137, 134, 136, 128, 124, 18, 209, 134, 136, 127, 224, 178, 209, 134, 123, 122, 122, 179, 147, 134, 123, 122, 122, 123, 178, 148, 123, 122, 121, 221, 143, 148, 15, 122, 121, 121, 222, 149, 147, 148, 122, 122, 218, 218, 223, 154, 173, 123, 188, 188, 78, 194, 182, 98, 178, 154, 154, 149, 98, 98, 48, 148, 148, 173, 98, 79, 48, 48,		\
+	21, 114, 13, 6,		\
+		72, 72, 72, 72, 190, 193, 72, 72, 72, 190, 193, 121, 72, 72, 190, 193, 121, 122, 72, 190, 191, 121, 122, 123, 72, 191, 193, 122, 123, 236, 190, 191, 121, 127, 128, 235, 190, 193, 122, 136, 234, 33, 190, 193, 127, 128, 235, 28, 190, 221, 136, 137, 19, 20, 218, 123, 134, 209, 19, 20, 222, 128, 209, 18, 19, 20, 224, 137, 18, 32, 33, 29, 124, 209, 18, 27, 28, 29,		\
+	68, 29, 10, 7,		\
+		38, 38, 35, 150, 166, 167, 11, 38, 35, 34, 30, 167, 11, 12, 35, 34, 167, 11, 12, 12, 13, 150, 30, 11, 12, 12, 13, 75, 166, 167, 12, 12, 13, 75, 79, 167, 168, 171, 168, 181, 181, 79, 168, 165, 165, 176, 182, 173, 79, 169, 153, 172, 78, 149, 154, 15, 152, 72, 72, 72, 153, 154, 148, 72, 72, 72, 72, 152, 158, 154,		\
+	112, 117, 6, 11,		\
+		95, 109, 204, 128, 137, 209, 18, 18, 18, 18, 18, 84, 96, 200, 127, 136, 128, 137, 209, 18, 18, 18, 50, 95, 107, 108, 122, 127, 136, 128, 134, 134, 134, 50, 84, 95, 107, 108, 108, 200, 142, 142, 142, 142, 50, 50, 84, 95, 96, 96, 96, 95, 95, 95, 95, 50, 50, 50, 50, 84, 84, 84, 50, 50, 50, 50,		\
+	104, 13, 8, 8,		\
+		50, 50, 50, 50, 84, 95, 95, 84, 50, 84, 95, 95, 96, 107, 107, 96, 84, 95, 107, 120, 108, 108, 108, 108, 84, 96, 108, 121, 121, 121, 122, 127, 84, 96, 108, 122, 127, 123, 136, 139, 50, 95, 109, 123, 128, 134, 137, 129, 45, 97, 110, 124, 129, 17, 16, 16, 85, 98, 111, 125, 16, 16, 15, 15,		\
+	109, 61, 7, 9,		\
+		38, 34, 30, 30, 30, 8, 8, 10, 10, 104, 35, 34, 34, 34, 43, 7, 9, 24, 38, 104, 38, 38, 38, 49, 144, 4, 4, 38, 38, 104, 38, 38, 56, 63, 4, 3, 57, 38, 38, 104, 104, 57, 56, 4, 4, 63, 64, 64, 64, 64, 104, 63, 63, 3, 76, 63, 63, 63, 63, 63, 104, 76, 3,		\
+	19, 52, 4, 15,		\
+		48, 48, 47, 46, 45, 146, 202, 202, 202, 180, 142, 208, 134, 209, 209, 47, 47, 45, 146, 95, 96, 203, 205, 110, 206, 128, 137, 137, 209, 209, 46, 146, 199, 96, 107, 200, 204, 136, 128, 128, 134, 137, 209, 18, 18, 199, 96, 107, 108, 108, 122, 127, 127, 136, 134, 18, 18, 209, 209, 137,		\
+	4, 15, 20, 3,		\
+		63, 57, 38, 63, 112, 126, 99, 113, 113, 100, 114, 115, 100, 115, 115, 101, 116, 71, 102, 71, 71, 103, 71, 72, 99, 117, 72, 99, 103, 72, 76, 99, 117, 76, 64, 58, 76, 63, 57, 104, 104, 104, 63, 56, 38, 4, 56, 38, 4, 56, 38, 4, 55, 57, 4, 4, 55, 3, 4, 4,		\
+	18, 93, 10, 6,		\
+		72, 72, 117, 161, 99, 99, 72, 72, 71, 71, 115, 115, 72, 72, 72, 72, 116, 115, 72, 71, 71, 116, 116, 115, 72, 71, 116, 115, 115, 115, 71, 116, 115, 114, 114, 114, 71, 116, 115, 114, 114, 114, 71, 116, 115, 115, 115, 114, 72, 71, 71, 116, 116, 115, 72, 72, 72, 72, 71, 116,		\
+	97, 6, 3, 20,		\
+		3, 3, 3, 3, 36, 36, 41, 41, 41, 48, 47, 48, 48, 48, 48, 41, 41, 41, 140, 140, 3, 3, 3, 36, 36, 47, 47, 47, 47, 47, 46, 47, 47, 47, 47, 48, 48, 85, 82, 77, 3, 3, 2, 40, 40, 46, 45, 45, 45, 45, 51, 45, 45, 45, 46, 47, 85, 83, 133, 78,		\
+	105, 33, 20, 3,		\
+		58, 38, 38, 162, 151, 35, 169, 155, 151, 177, 169, 162, 183, 153, 152, 149, 152, 72, 154, 153, 72, 147, 149, 152, 148, 154, 153, 15, 154, 158, 15, 147, 149, 15, 148, 154, 15, 148, 187, 148, 178, 188, 178, 123, 122, 123, 122, 121, 184, 121, 121, 120, 108, 121, 95, 107, 108, 84, 95, 96,		\
+	97, 77, 5, 11,		\
+		8, 11, 26, 12, 75, 79, 48, 48, 48, 47, 45, 8, 8, 53, 80, 60, 41, 48, 48, 48, 47, 46, 8, 8, 52, 9, 24, 36, 41, 41, 41, 41, 47, 10, 10, 9, 24, 3, 3, 36, 36, 36, 41, 40, 10, 25, 24, 4, 3, 3, 3, 3, 3, 36, 2,		\
+	62, 35, 6, 9,		\
+		38, 38, 38, 35, 150, 166, 164, 189, 79, 38, 38, 35, 34, 30, 167, 11, 75, 79, 38, 35, 34, 167, 11, 12, 12, 75, 79, 35, 34, 167, 11, 12, 12, 12, 75, 79, 34, 167, 11, 12, 12, 12, 13, 75, 48, 167, 11, 12, 12, 12, 13, 75, 79, 48,		\
+	148, 103, 4, 13,		\
+		79, 79, 79, 104, 79, 75, 233, 156, 65, 65, 131, 115, 114, 75, 75, 75, 75, 104, 171, 166, 151, 58, 58, 195, 113, 114, 13, 12, 26, 11, 167, 104, 150, 35, 38, 38, 38, 126, 113, 11, 11, 11, 167, 31, 35, 104, 38, 38, 38, 38, 38, 126,		\
+	19, 105, 17, 3,		\
+		114, 114, 115, 115, 115, 116, 115, 116, 71, 115, 116, 71, 115, 116, 71, 115, 116, 71, 116, 71, 72, 71, 71, 72, 72, 72, 72, 72, 72, 72, 93, 94, 72, 106, 102, 94, 118, 106, 93, 50, 145, 102, 50, 118, 90, 50, 50, 118, 50, 50, 51,		\
+	45, 25, 3, 17,		\
+		104, 104, 104, 118, 145, 89, 170, 175, 175, 175, 175, 175, 175, 170, 89, 145, 118, 50, 50, 118, 104, 104, 104, 104, 104, 114, 114, 114, 114, 114, 163, 175, 170, 89, 118, 88, 159, 101, 163, 114, 114, 114, 104, 104, 104, 114, 114, 114, 114, 163, 175,		\
+	69, 66, 3, 17,		\
+		17, 17, 17, 17, 135, 18, 18, 209, 137, 128, 128, 139, 214, 179, 179, 143, 147, 16, 16, 16, 16, 16, 17, 17, 129, 111, 214, 143, 143, 178, 178, 147, 148, 15, 15, 15, 15, 15, 15, 16, 16, 125, 111, 178, 147, 148, 15, 15, 15, 15, 15,		\
+	18, 120, 6, 8,		\
+		72, 72, 72, 190, 190, 218, 188, 223, 190, 190, 191, 218, 221, 224, 251, 124, 191, 193, 221, 123, 128, 137, 248, 27, 121, 122, 123, 134, 248, 27, 33, 28, 122, 123, 236, 235, 33, 28, 29, 29, 123, 236, 235, 28, 29, 29, 21, 21,		\
+	36, 80, 6, 8,		\
+		120, 95, 50, 50, 50, 118, 90, 102, 120, 95, 50, 50, 118, 90, 102, 94, 120, 95, 118, 145, 106, 102, 94, 94, 120, 95, 145, 106, 93, 94, 94, 102, 120, 96, 106, 93, 72, 72, 94, 102, 108, 215, 102, 94, 72, 72, 94, 102,		\
+	42, 3, 3, 16,		\
+		8, 8, 31, 35, 38, 57, 63, 4, 3, 3, 3, 36, 2, 40, 44, 51, 8, 30, 34, 38, 38, 38, 64, 63, 76, 36, 36, 41, 40, 40, 51, 51, 8, 31, 35, 38, 38, 38, 57, 70, 77, 81, 41, 41, 47, 45, 50, 50,		\
+	106, 94, 8, 6,		\
+		39, 44, 118, 145, 90, 90, 39, 44, 88, 106, 102, 102, 2, 39, 87, 227, 94, 72, 3, 39, 44, 225, 93, 72, 3, 2, 39, 88, 102, 94, 3, 39, 44, 118, 90, 102, 36, 40, 44, 50, 118, 145, 41, 40, 45, 50, 50, 50,		\
+	13, 42, 5, 9,		\
+		38, 38, 166, 167, 12, 12, 12, 12, 13, 38, 35, 166, 167, 12, 12, 12, 13, 75, 35, 34, 167, 11, 12, 12, 13, 75, 79, 151, 155, 165, 168, 171, 75, 75, 79, 48, 162, 162, 162, 169, 182, 181, 48, 48, 48,		\
+	45, 80, 3, 15,		\
+		121, 193, 191, 190, 72, 72, 72, 72, 102, 90, 50, 51, 45, 91, 210, 121, 121, 193, 191, 190, 72, 72, 72, 102, 225, 45, 174, 83, 98, 219, 121, 121, 121, 121, 193, 191, 190, 190, 197, 215, 97, 98, 148, 16, 17,		\
+	75, 25, 15, 3,		\
+		35, 34, 155, 150, 155, 155, 151, 156, 162, 151, 157, 152, 70, 157, 72, 70, 77, 72, 70, 77, 72, 70, 77, 72, 64, 138, 72, 63, 99, 117, 63, 63, 157, 3, 63, 138, 3, 63, 70, 76, 63, 57, 63, 64, 38,		\
+	116, 48, 11, 4,		\
+		196, 102, 102, 102, 197, 198, 90, 90, 108, 107, 95, 50, 121, 108, 96, 84, 121, 108, 107, 95, 121, 121, 120, 95, 121, 108, 107, 95, 108, 120, 95, 84, 120, 95, 84, 50, 95, 84, 50, 50, 84, 50, 50, 50,		\
+	152, 117, 4, 11,		\
+		126, 113, 113, 114, 114, 114, 114, 114, 114, 237, 237, 38, 126, 130, 113, 113, 113, 114, 114, 114, 114, 114, 38, 38, 38, 126, 126, 130, 113, 113, 113, 113, 113, 38, 38, 38, 38, 38, 38, 126, 126, 126, 126, 126,		\
+	125, 55, 7, 6,		\
+		50, 51, 46, 47, 48, 41, 51, 45, 47, 48, 41, 36, 45, 47, 48, 48, 41, 36, 46, 47, 48, 41, 36, 3, 47, 41, 41, 36, 3, 3, 47, 41, 36, 3, 3, 3, 36, 36, 3, 3, 3, 3,		\
+	100, 29, 10, 4,		\
+		65, 58, 38, 38, 71, 65, 58, 38, 72, 71, 65, 38, 72, 72, 65, 58, 72, 72, 71, 65, 153, 152, 72, 65, 154, 158, 152, 152, 148, 154, 158, 158, 15, 148, 154, 177, 15, 15, 148, 154,		\
+	126, 84, 8, 5,		\
+		46, 51, 50, 50, 51, 45, 50, 50, 51, 210, 45, 50, 84, 202, 211, 45, 50, 199, 205, 137, 104, 45, 213, 208, 209, 46, 104, 211, 209, 18, 47, 219, 104, 104, 18, 85, 219, 209, 18, 104,		\
+	135, 109, 8, 5,		\
+		50, 50, 50, 50, 145, 51, 50, 50, 118, 89, 45, 51, 50, 145, 159, 47, 45, 118, 106, 229, 47, 46, 105, 102, 116, 48, 174, 92, 94, 116, 48, 83, 133, 72, 116, 85, 82, 78, 72, 116,		\
+	135, 102, 13, 3,		\
+		219, 210, 50, 212, 230, 45, 209, 219, 132, 135, 220, 48, 135, 217, 48, 220, 217, 48, 220, 217, 48, 16, 79, 48, 15, 79, 79, 104, 79, 79, 15, 104, 79, 15, 79, 104, 79, 79, 48,		\
+	18, 37, 4, 9,		\
+		38, 58, 58, 65, 65, 152, 152, 72, 172, 38, 58, 65, 71, 72, 72, 72, 78, 82, 151, 192, 152, 72, 72, 78, 133, 82, 83, 151, 192, 152, 72, 78, 82, 83, 85, 48,		\
+	38, 0, 4, 9,		\
+		5, 5, 5, 5, 5, 23, 23, 6, 4, 5, 5, 5, 23, 23, 6, 42, 49, 23, 5, 23, 23, 6, 7, 7, 43, 34, 55, 6, 6, 7, 10, 10, 30, 34, 38, 56,		\
+	55, 0, 4, 9,		\
+		7, 10, 10, 8, 8, 31, 35, 38, 38, 6, 6, 7, 10, 10, 30, 34, 38, 38, 5, 23, 23, 6, 7, 7, 43, 34, 38, 5, 5, 5, 23, 23, 6, 7, 43, 34,		\
+	81, 38, 2, 18,		\
+		152, 153, 149, 154, 154, 154, 154, 154, 147, 148, 15, 15, 15, 15, 79, 79, 75, 13, 72, 72, 152, 153, 158, 158, 158, 158, 149, 154, 154, 154, 154, 173, 181, 75, 13, 12,		\
+	91, 116, 6, 6,		\
+		121, 121, 121, 121, 238, 243, 121, 121, 121, 122, 239, 244, 121, 121, 122, 123, 240, 245, 121, 122, 123, 236, 241, 29, 121, 127, 128, 235, 28, 29, 122, 136, 137, 19, 20, 21,		\
+	22, 18, 5, 7,		\
+		66, 34, 34, 34, 34, 35, 38, 42, 43, 30, 30, 31, 34, 38, 24, 9, 25, 7, 43, 34, 35, 4, 4, 24, 24, 144, 42, 55, 3, 3, 3, 4, 4, 24, 4,		\
+	49, 55, 5, 7,		\
+		46, 45, 50, 50, 50, 95, 107, 47, 47, 45, 45, 146, 109, 108, 48, 47, 85, 85, 201, 110, 204, 48, 79, 79, 79, 173, 111, 124, 79, 15, 15, 15, 15, 16, 135,		\
+	74, 117, 5, 7,		\
+		11, 11, 26, 12, 12, 12, 12, 8, 11, 26, 12, 12, 171, 168, 8, 8, 11, 12, 171, 177, 169, 8, 167, 167, 167, 165, 162, 152, 30, 31, 150, 156, 162, 152, 72,		\
+	100, 21, 7, 5,		\
+		45, 91, 119, 72, 72, 51, 105, 119, 72, 72, 50, 145, 102, 94, 72, 50, 146, 92, 133, 152, 51, 91, 83, 149, 153, 141, 83, 148, 147, 154, 142, 98, 15, 148, 147,		\
+	102, 100, 5, 7,		\
+		50, 50, 50, 118, 145, 106, 102, 50, 50, 118, 90, 102, 93, 86, 118, 145, 106, 102, 94, 86, 72, 145, 159, 93, 94, 72, 86, 72, 159, 93, 71, 72, 86, 72, 72,		\
+	102, 110, 5, 7,		\
+		102, 145, 50, 84, 96, 108, 123, 93, 106, 118, 50, 95, 107, 204, 93, 106, 118, 50, 84, 96, 204, 93, 106, 118, 50, 50, 95, 203, 102, 90, 50, 50, 50, 84, 213,		\
+	122, 9, 5, 7,		\
+		25, 74, 75, 75, 75, 79, 48, 24, 68, 61, 61, 13, 75, 79, 24, 24, 80, 80, 12, 13, 75, 24, 24, 80, 80, 12, 12, 13, 24, 68, 61, 61, 12, 12, 12,		\
+	125, 97, 7, 5,		\
+		45, 51, 50, 50, 50, 205, 202, 95, 84, 50, 137, 110, 96, 95, 50, 209, 134, 204, 96, 84, 18, 209, 134, 203, 199, 18, 18, 209, 208, 213, 18, 18, 18, 209, 211,		\
+	19, 86, 17, 2,		\
+		102, 72, 102, 72, 102, 94, 102, 94, 102, 94, 102, 94, 106, 93, 90, 102, 90, 102, 90, 102, 90, 102, 145, 102, 118, 106, 50, 90, 50, 90, 50, 90, 118, 106,		\
+	5, 107, 11, 3,		\
+		5, 5, 5, 4, 5, 23, 4, 4, 59, 3, 4, 59, 4, 63, 56, 4, 55, 57, 63, 56, 38, 63, 64, 38, 76, 63, 57, 3, 63, 64, 2, 63, 232,		\
+	53, 79, 3, 11,		\
+		134, 128, 123, 122, 121, 121, 121, 122, 127, 128, 137, 18, 209, 134, 136, 127, 122, 121, 127, 136, 137, 209, 18, 18, 209, 137, 128, 136, 123, 128, 137, 18, 18,		\
+	21, 67, 4, 8,		\
+		18, 18, 18, 209, 209, 137, 128, 127, 209, 209, 18, 137, 134, 136, 123, 122, 128, 128, 134, 136, 123, 122, 122, 121, 127, 127, 123, 127, 122, 121, 121, 121,		\
+	54, 47, 4, 8,		\
+		133, 83, 48, 48, 48, 48, 48, 79, 82, 83, 48, 48, 48, 79, 79, 15, 82, 85, 48, 48, 79, 79, 15, 15, 83, 48, 48, 79, 79, 15, 15, 15,		\
+	72, 13, 4, 8,		\
+		55, 66, 57, 38, 38, 38, 38, 38, 6, 42, 56, 57, 57, 57, 57, 38, 4, 24, 4, 55, 55, 55, 56, 57, 4, 4, 4, 4, 4, 4, 63, 56,		\
+	122, 77, 8, 4,		\
+		3, 3, 36, 41, 3, 3, 36, 41, 104, 36, 41, 48, 3, 104, 41, 48, 3, 36, 104, 48, 36, 41, 48, 104, 36, 41, 48, 48, 36, 41, 48, 48,		\
+	19, 0, 3, 10,		\
+		0, 0, 0, 0, 22, 1, 1, 2, 3, 3, 0, 22, 22, 1, 1, 2, 2, 3, 3, 3, 1, 1, 1, 2, 2, 3, 3, 3, 3, 3,		\
+	21, 50, 15, 2,		\
+		47, 47, 46, 146, 146, 95, 95, 107, 96, 108, 107, 108, 120, 121, 120, 121, 120, 121, 120, 121, 120, 121, 120, 121, 107, 108, 96, 108, 95, 107,		\
+	60, 11, 15, 2,		\
+		38, 38, 38, 38, 73, 38, 67, 73, 59, 67, 59, 67, 59, 67, 59, 67, 23, 59, 5, 59, 5, 59, 5, 59, 5, 6, 5, 6, 5, 6,		\
+	70, 107, 5, 6,		\
+		48, 48, 79, 75, 75, 13, 79, 75, 75, 13, 12, 12, 60, 68, 74, 61, 12, 12, 24, 24, 24, 68, 61, 11, 3, 3, 4, 24, 52, 8,		\
+	112, 102, 3, 10,		\
+		102, 93, 94, 94, 93, 102, 102, 106, 145, 50, 90, 106, 102, 102, 106, 90, 90, 145, 118, 50, 50, 118, 145, 145, 118, 50, 50, 50, 50, 50,		\
+	112, 56, 6, 5,		\
+		192, 151, 35, 38, 38, 65, 192, 151, 70, 64, 152, 172, 82, 81, 63, 72, 133, 83, 41, 36, 119, 82, 85, 48, 41, 91, 201, 48, 48, 41,		\
+	117, 92, 10, 3,		\
+		48, 48, 47, 48, 47, 46, 48, 47, 45, 47, 45, 51, 45, 51, 50, 51, 50, 50, 50, 50, 50, 51, 45, 202, 207, 211, 211, 212, 209, 209,		\
+	126, 117, 5, 6,		\
+		50, 50, 50, 50, 118, 145, 50, 50, 50, 118, 89, 170, 50, 50, 118, 89, 175, 163, 118, 145, 89, 175, 163, 114, 89, 170, 175, 163, 114, 114,		\
+	129, 30, 5, 6,		\
+		47, 46, 51, 50, 50, 50, 48, 47, 45, 51, 50, 50, 41, 41, 40, 44, 50, 50, 36, 36, 2, 39, 44, 44, 3, 3, 3, 2, 39, 39,		\
+	14, 18, 4, 7,		\
+		65, 65, 65, 65, 71, 72, 72, 58, 58, 58, 104, 65, 65, 65, 38, 38, 104, 104, 38, 58, 58, 104, 104, 38, 38, 38, 38, 38,		\
+	54, 35, 4, 7,		\
+		113, 113, 114, 114, 114, 115, 116, 126, 130, 113, 114, 114, 115, 71, 38, 38, 126, 113, 113, 116, 71, 38, 38, 38, 126, 195, 65, 72,		\
+	134, 119, 14, 2,		\
+		114, 114, 114, 237, 114, 237, 114, 237, 237, 237, 237, 242, 237, 242, 237, 242, 237, 242, 237, 237, 114, 237, 114, 237, 114, 237, 114, 114,		\
+	153, 33, 7, 4,		\
+		27, 32, 18, 18, 28, 19, 32, 18, 29, 28, 27, 18, 21, 29, 33, 32, 21, 29, 28, 27, 21, 21, 29, 33, 21, 21, 29, 28,		\
+	156, 110, 4, 7,		\
+		67, 73, 38, 38, 38, 38, 38, 59, 67, 67, 67, 73, 38, 38, 23, 59, 59, 59, 67, 67, 73, 5, 5, 5, 23, 59, 67, 67,		\
+	79, 68, 3, 9,		\
+		12, 12, 12, 12, 12, 12, 13, 75, 75, 26, 26, 11, 11, 26, 26, 12, 12, 12, 11, 11, 8, 8, 11, 11, 26, 12, 12,		\
+	157, 46, 3, 9,		\
+		15, 37, 75, 75, 75, 60, 36, 3, 3, 15, 14, 13, 12, 13, 68, 24, 3, 3, 37, 14, 12, 12, 12, 68, 24, 3, 3,		\
+	71, 91, 2, 13,		\
+		48, 48, 48, 41, 41, 41, 41, 41, 41, 48, 48, 48, 48, 48, 41, 41, 36, 36, 36, 36, 36, 36, 41, 41, 41, 41,		\
+	102, 5, 13, 2,		\
+		2, 39, 39, 44, 39, 44, 40, 45, 40, 46, 41, 47, 41, 47, 41, 48, 41, 48, 41, 48, 41, 48, 36, 41, 36, 41,		\
+	22, 33, 5, 5,		\
+		38, 35, 34, 166, 164, 35, 34, 167, 171, 189, 66, 185, 186, 60, 79, 63, 63, 24, 41, 48, 76, 3, 36, 41, 48,		\
+	25, 99, 5, 5,		\
+		114, 114, 114, 114, 114, 114, 114, 114, 115, 115, 229, 175, 101, 229, 116, 159, 89, 89, 106, 102, 118, 50, 50, 118, 90,		\
+	86, 123, 5, 5,		\
+		121, 121, 121, 238, 249, 121, 238, 249, 252, 250, 238, 243, 250, 253, 247, 243, 246, 247, 21, 21, 246, 247, 21, 21, 21,		\
+	123, 123, 5, 5,		\
+		50, 50, 118, 145, 90, 50, 118, 90, 102, 102, 118, 90, 102, 116, 116, 89, 101, 229, 115, 115, 175, 163, 114, 114, 114,		\
+	14, 110, 4, 6,		\
+		38, 38, 126, 126, 126, 58, 126, 130, 130, 195, 131, 65, 195, 131, 115, 116, 71, 71, 115, 116, 71, 71, 72, 72,		\
+	19, 78, 6, 4,		\
+		95, 84, 50, 50, 120, 95, 84, 50, 108, 120, 95, 84, 121, 108, 120, 95, 121, 121, 108, 120, 121, 121, 121, 108,		\
+	33, 108, 4, 6,		\
+		102, 94, 72, 72, 152, 223, 90, 102, 78, 153, 149, 178, 45, 91, 82, 182, 147, 125, 47, 85, 98, 148, 15, 16,		\
+	45, 8, 3, 8,		\
+		38, 58, 65, 78, 82, 83, 85, 46, 38, 58, 65, 72, 78, 82, 91, 45, 38, 65, 71, 72, 72, 78, 92, 105,		\
+	63, 79, 6, 4,		\
+		18, 18, 18, 209, 18, 18, 209, 134, 209, 209, 134, 136, 209, 137, 136, 127, 134, 136, 127, 127, 136, 123, 123, 179,		\
+	85, 51, 3, 8,		\
+		72, 162, 165, 167, 167, 167, 167, 30, 72, 192, 156, 166, 166, 34, 34, 150, 65, 58, 151, 35, 35, 38, 38, 38,		\
+	85, 99, 3, 8,		\
+		46, 40, 40, 39, 2, 3, 3, 3, 51, 45, 45, 44, 39, 39, 2, 3, 50, 50, 50, 50, 44, 44, 39, 39,		\
+	102, 73, 3, 8,		\
+		8, 8, 10, 10, 24, 24, 4, 4, 8, 10, 25, 24, 4, 4, 3, 3, 10, 25, 24, 4, 3, 3, 3, 3,		\
+	105, 70, 4, 6,		\
+		8, 8, 10, 25, 24, 4, 8, 10, 25, 24, 4, 3, 10, 25, 24, 4, 3, 3, 10, 24, 4, 3, 3, 3,		\
+	105, 122, 4, 6,		\
+		27, 28, 29, 21, 21, 21, 32, 19, 28, 29, 29, 21, 18, 32, 27, 33, 28, 20, 18, 18, 18, 32, 27, 19,		\
+	131, 113, 4, 6,		\
+		50, 50, 50, 145, 170, 163, 50, 50, 118, 89, 175, 114, 50, 118, 89, 175, 163, 114, 118, 89, 175, 163, 114, 114,		\
+	139, 85, 8, 3,		\
+		16, 135, 18, 16, 17, 18, 15, 16, 135, 15, 16, 17, 15, 15, 16, 79, 15, 15, 79, 15, 15, 48, 79, 15,		\
+	143, 9, 6, 4,		\
+		18, 18, 18, 18, 27, 32, 18, 18, 28, 33, 27, 32, 29, 29, 28, 33, 21, 21, 29, 29, 21, 21, 21, 21,		\
+	151, 27, 4, 6,		\
+		29, 20, 33, 27, 32, 18, 21, 29, 29, 28, 19, 32, 21, 21, 21, 29, 20, 33, 21, 21, 21, 21, 29, 29,		\
+	75, 21, 11, 2,		\
+		38, 38, 57, 38, 56, 57, 63, 56, 4, 56, 4, 56, 4, 56, 4, 63, 4, 4, 3, 3, 3, 3,		\
+	6, 45, 7, 3,		\
+		26, 12, 12, 11, 26, 12, 11, 26, 12, 8, 11, 26, 8, 11, 26, 8, 11, 26, 11, 26, 12,		\
+	25, 42, 3, 7,		\
+		48, 48, 48, 47, 45, 51, 50, 48, 47, 47, 45, 51, 50, 50, 47, 47, 45, 51, 50, 50, 50,		\
+	67, 59, 3, 7,		\
+		15, 16, 16, 17, 18, 18, 18, 15, 15, 15, 16, 17, 17, 135, 15, 15, 15, 15, 16, 16, 16,		\
+	87, 28, 3, 7,		\
+		65, 72, 104, 104, 72, 72, 72, 58, 65, 65, 71, 104, 104, 72, 38, 58, 58, 65, 65, 71, 104,		\
+	102, 88, 3, 7,		\
+		2, 39, 44, 50, 50, 50, 50, 3, 2, 39, 44, 44, 50, 50, 3, 3, 2, 39, 39, 44, 50,		\
+	119, 0, 3, 7,		\
+		10, 25, 24, 24, 4, 4, 3, 8, 10, 10, 25, 9, 24, 4, 8, 8, 8, 8, 10, 25, 24,		\
+	153, 39, 7, 3,		\
+		16, 15, 15, 17, 16, 15, 135, 16, 15, 18, 17, 16, 18, 17, 16, 18, 17, 16, 18, 17, 16,		\
+	12, 10, 4, 5,		\
+		69, 50, 44, 44, 87, 62, 44, 39, 39, 2, 2, 39, 2, 3, 3, 2, 3, 3, 3, 3,		\
+	35, 53, 5, 4,		\
+		121, 121, 121, 121, 108, 121, 121, 121, 120, 108, 121, 121, 95, 120, 108, 121, 84, 95, 120, 108,		\
+	45, 3, 10, 2,		\
+		30, 34, 31, 35, 31, 35, 31, 35, 30, 34, 30, 34, 30, 34, 30, 34, 8, 31, 8, 30,		\
+	90, 0, 5, 4,		\
+		5, 5, 5, 5, 5, 5, 4, 4, 5, 4, 4, 4, 4, 4, 3, 3, 4, 3, 3, 3,		\
+	107, 116, 5, 4,		\
+		202, 211, 209, 18, 199, 205, 137, 18, 95, 180, 206, 209, 84, 96, 110, 137, 50, 95, 142, 128,		\
+	132, 9, 2, 10,		\
+		13, 75, 75, 75, 75, 75, 75, 79, 48, 48, 13, 75, 79, 79, 79, 79, 79, 48, 48, 48,		\
+	130, 123, 4, 5,		\
+		114, 114, 114, 237, 237, 114, 237, 237, 242, 242, 237, 237, 242, 242, 242, 242, 242, 242, 242, 242,		\
+	139, 96, 4, 5,		\
+		104, 104, 18, 18, 18, 18, 18, 104, 18, 18, 18, 18, 18, 104, 18, 18, 18, 18, 18, 104,		\
+	5, 59, 2, 9,		\
+		26, 11, 11, 11, 11, 11, 11, 26, 12, 12, 26, 26, 26, 26, 26, 26, 12, 12,		\
+	43, 97, 2, 9,		\
+		50, 50, 51, 45, 210, 230, 219, 217, 220, 51, 45, 207, 211, 219, 212, 231, 135, 135,		\
+	56, 44, 6, 3,		\
+		72, 72, 78, 72, 78, 82, 78, 82, 83, 133, 83, 48, 83, 85, 48, 83, 48, 48,		\
+	60, 5, 3, 6,		\
+		5, 23, 6, 49, 66, 38, 5, 5, 23, 59, 67, 73, 5, 5, 5, 23, 59, 67,		\
+	67, 111, 3, 6,		\
+		79, 15, 15, 15, 15, 37, 79, 79, 37, 14, 14, 14, 79, 75, 13, 13, 13, 12,		\
+	78, 34, 3, 6,		\
+		152, 158, 154, 148, 15, 15, 72, 152, 158, 154, 147, 148, 72, 72, 152, 153, 149, 154,		\
+	81, 96, 3, 6,		\
+		48, 41, 36, 3, 3, 3, 48, 48, 41, 36, 3, 3, 48, 48, 48, 41, 36, 3,		\
+	115, 82, 6, 3,		\
+		3, 3, 3, 3, 3, 36, 3, 36, 41, 36, 41, 48, 41, 48, 48, 41, 48, 48,		\
+	128, 52, 6, 3,		\
+		50, 50, 51, 50, 50, 45, 50, 51, 45, 51, 45, 40, 44, 40, 2, 39, 2, 3,		\
+	135, 0, 2, 9,		\
+		13, 13, 13, 13, 14, 14, 14, 14, 37, 14, 14, 14, 14, 37, 15, 15, 15, 15,		\
+	142, 41, 3, 6,		\
+		36, 36, 36, 3, 3, 3, 41, 41, 41, 36, 36, 36, 48, 48, 48, 41, 41, 41,		\
+	0, 6, 4, 4,		\
+		22, 1, 3, 3, 22, 1, 2, 3, 0, 1, 2, 3, 0, 22, 1, 2,		\
+	0, 101, 4, 4,		\
+		4, 4, 5, 5, 3, 4, 4, 5, 3, 4, 4, 5, 3, 3, 4, 4,		\
+	0, 13, 8, 2,		\
+		63, 64, 63, 64, 76, 63, 3, 63, 3, 76, 3, 76, 39, 76, 44, 87,		\
+	40, 57, 4, 4,		\
+		108, 121, 121, 121, 107, 108, 108, 121, 95, 96, 120, 108, 50, 84, 96, 108,		\
+	44, 59, 4, 4,		\
+		95, 107, 108, 121, 84, 96, 108, 121, 50, 95, 107, 108, 50, 84, 96, 108,		\
+	49, 42, 2, 8,		\
+		115, 116, 72, 94, 102, 106, 91, 45, 115, 116, 72, 72, 94, 93, 97, 174,		\
+	78, 90, 2, 8,		\
+		48, 41, 41, 36, 36, 36, 3, 3, 48, 48, 48, 41, 41, 41, 36, 3,		\
+	86, 5, 4, 4,		\
+		5, 5, 5, 4, 5, 5, 4, 4, 5, 4, 4, 3, 4, 4, 3, 3,		\
+	89, 86, 8, 2,		\
+		47, 45, 46, 51, 45, 50, 45, 50, 45, 50, 45, 50, 45, 50, 46, 51,		\
+	108, 9, 4, 4,		\
+		51, 50, 50, 50, 45, 51, 50, 50, 47, 46, 45, 45, 48, 47, 47, 47,		\
+	119, 17, 4, 4,		\
+		79, 79, 15, 15, 48, 79, 79, 15, 48, 48, 79, 79, 48, 48, 48, 79,		\
+	124, 28, 4, 4,		\
+		79, 79, 85, 45, 79, 85, 132, 51, 48, 47, 45, 50, 48, 47, 46, 51,		\
+	127, 7, 4, 4,		\
+		52, 25, 68, 61, 53, 61, 61, 12, 11, 26, 12, 12, 26, 12, 12, 12,		\
+	135, 16, 2, 8,		\
+		79, 79, 79, 79, 48, 48, 48, 48, 15, 15, 15, 79, 79, 79, 48, 48,		\
+	135, 90, 4, 4,		\
+		18, 104, 18, 18, 18, 18, 104, 18, 18, 18, 18, 104, 18, 18, 18, 18,		\
+	147, 78, 4, 4,		\
+		41, 48, 48, 48, 36, 41, 41, 48, 3, 36, 36, 41, 3, 3, 3, 36,		\
+	153, 86, 4, 4,		\
+		24, 25, 53, 8, 4, 24, 25, 10, 4, 24, 25, 10, 3, 4, 9, 10,		\
+	153, 106, 4, 4,		\
+		31, 35, 38, 104, 31, 35, 38, 38, 30, 34, 38, 38, 43, 49, 67, 67,		\
+	0, 87, 5, 3,		\
+		15, 79, 79, 15, 79, 79, 15, 79, 48, 79, 79, 48, 79, 48, 48,		\
+	12, 88, 5, 3,		\
+		48, 48, 41, 48, 41, 36, 41, 36, 3, 41, 36, 3, 81, 140, 76,		\
+	48, 8, 5, 3,		\
+		58, 65, 72, 58, 65, 72, 38, 65, 71, 38, 58, 65, 38, 38, 58,		\
+	48, 26, 5, 3,		\
+		87, 160, 163, 99, 161, 115, 76, 99, 113, 63, 70, 130, 64, 57, 38,		\
+	48, 89, 5, 3,		\
+		226, 179, 111, 121, 123, 124, 122, 136, 137, 123, 134, 209, 128, 209, 18,		\
+	58, 90, 3, 5,		\
+		18, 18, 135, 135, 18, 135, 17, 16, 16, 17, 16, 16, 15, 15, 16,		\
+	60, 125, 5, 3,		\
+		19, 20, 29, 32, 19, 28, 18, 32, 27, 135, 18, 18, 16, 17, 17,		\
+	78, 53, 3, 5,		\
+		15, 15, 15, 37, 37, 15, 79, 79, 75, 75, 79, 79, 75, 75, 13,		\
+	81, 62, 3, 5,		\
+		12, 12, 12, 26, 26, 26, 26, 11, 11, 11, 11, 11, 8, 8, 8,		\
+	90, 34, 3, 5,		\
+		65, 104, 104, 71, 71, 58, 58, 65, 104, 65, 38, 38, 38, 38, 104,		\
+	92, 77, 5, 3,		\
+		26, 12, 12, 11, 12, 12, 11, 26, 12, 11, 26, 12, 8, 11, 26,		\
+	99, 108, 3, 5,		\
+		118, 118, 118, 50, 50, 106, 90, 145, 50, 50, 93, 102, 106, 118, 50,		\
+	107, 109, 5, 3,		\
+		72, 102, 90, 94, 102, 145, 94, 102, 145, 93, 106, 118, 93, 106, 118,		\
+	130, 75, 5, 3,		\
+		3, 36, 41, 3, 36, 41, 3, 36, 41, 3, 36, 41, 3, 36, 41,		\
+	135, 29, 3, 5,		\
+		41, 36, 3, 3, 3, 48, 41, 36, 36, 3, 48, 48, 41, 41, 36,		\
+	148, 43, 5, 3,		\
+		48, 48, 48, 48, 48, 48, 79, 48, 48, 15, 79, 48, 15, 15, 79,		\
+	0, 43, 7, 2,		\
+		12, 12, 12, 12, 12, 12, 26, 12, 11, 26, 11, 26, 8, 11,		\
+	0, 74, 7, 2,		\
+		13, 14, 13, 14, 13, 14, 13, 14, 13, 14, 13, 14, 14, 37,		\
+	23, 60, 2, 7,		\
+		127, 136, 134, 134, 128, 128, 136, 122, 127, 123, 123, 127, 127, 122,		\
+	106, 56, 2, 7,		\
+		38, 38, 38, 38, 34, 30, 8, 104, 104, 38, 38, 35, 31, 8,		\
+	113, 87, 2, 7,		\
+		3, 3, 36, 36, 36, 41, 41, 36, 36, 41, 41, 41, 48, 48,		\
+	112, 13, 7, 2,		\
+		79, 15, 79, 15, 79, 79, 48, 79, 48, 79, 48, 48, 48, 48,		\
+	119, 68, 2, 7,		\
+		3, 3, 3, 104, 3, 3, 3, 3, 3, 3, 3, 104, 104, 3,		\
+	118, 57, 7, 2,		\
+		85, 48, 47, 48, 46, 47, 45, 47, 45, 47, 45, 47, 45, 47,		\
+	141, 18, 2, 7,		\
+		135, 17, 17, 16, 16, 16, 15, 18, 18, 18, 135, 17, 17, 16,		\
+	5, 124, 3, 4,		\
+		23, 5, 5, 5, 59, 59, 59, 59, 67, 67, 67, 67,		\
+	7, 70, 3, 4,		\
+		75, 75, 75, 14, 79, 79, 79, 79, 48, 48, 48, 48,		\
+	10, 29, 2, 6,		\
+		72, 72, 65, 58, 38, 38, 72, 72, 72, 65, 58, 38,		\
+	24, 120, 3, 4,		\
+		236, 235, 20, 29, 235, 20, 29, 21, 28, 29, 21, 21,		\
+	27, 35, 6, 2,		\
+		36, 41, 36, 41, 36, 41, 36, 41, 40, 40, 44, 51,		\
+	32, 80, 4, 3,		\
+		121, 108, 107, 121, 108, 96, 108, 107, 95, 108, 96, 84,		\
+	34, 26, 4, 3,		\
+		3, 3, 2, 2, 39, 39, 39, 44, 44, 44, 50, 50,		\
+	42, 107, 3, 4,		\
+		217, 217, 217, 220, 220, 220, 220, 135, 18, 18, 18, 18,		\
+	45, 95, 2, 6,		\
+		210, 210, 207, 211, 212, 209, 219, 219, 212, 209, 18, 18,		\
+	61, 57, 4, 3,		\
+		16, 17, 18, 16, 17, 18, 15, 16, 135, 15, 16, 17,		\
+	62, 104, 6, 2,		\
+		18, 18, 17, 17, 16, 16, 15, 15, 79, 79, 79, 79,		\
+	68, 41, 4, 3,		\
+		79, 48, 48, 48, 48, 48, 48, 48, 48, 79, 79, 48,		\
+	72, 75, 2, 6,		\
+		15, 15, 15, 15, 15, 15, 79, 79, 79, 79, 79, 79,		\
+	75, 57, 2, 6,		\
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 79, 79, 79,		\
+	74, 124, 3, 4,		\
+		171, 168, 177, 177, 165, 169, 162, 162, 153, 152, 72, 72,		\
+	75, 110, 4, 3,		\
+		24, 25, 8, 24, 25, 8, 4, 9, 10, 4, 9, 10,		\
+	80, 124, 3, 4,		\
+		72, 72, 72, 190, 190, 190, 191, 191, 191, 193, 193, 121,		\
+	82, 121, 4, 3,		\
+		72, 190, 191, 190, 191, 193, 193, 121, 121, 121, 121, 121,		\
+	83, 59, 4, 3,		\
+		26, 26, 11, 11, 8, 8, 30, 30, 8, 34, 31, 8,		\
+	88, 46, 2, 6,		\
+		72, 72, 72, 71, 65, 58, 72, 71, 65, 65, 58, 38,		\
+	86, 108, 6, 2,		\
+		3, 36, 36, 36, 40, 174, 45, 91, 50, 118, 50, 50,		\
+	100, 7, 4, 3,		\
+		2, 40, 45, 40, 45, 51, 44, 51, 50, 50, 50, 50,		\
+	102, 120, 3, 4,		\
+		27, 28, 29, 21, 32, 19, 20, 29, 18, 32, 33, 29,		\
+	108, 36, 3, 4,		\
+		65, 58, 58, 58, 71, 65, 65, 65, 72, 72, 72, 72,		\
+	111, 50, 2, 6,		\
+		71, 65, 65, 58, 58, 58, 72, 72, 71, 65, 65, 65,		\
+	130, 0, 2, 6,		\
+		8, 8, 8, 8, 11, 11, 8, 8, 11, 11, 26, 26,		\
+	135, 49, 2, 6,		\
+		39, 39, 2, 3, 3, 3, 2, 3, 3, 3, 3, 3,		\
+	135, 105, 3, 4,		\
+		51, 51, 51, 50, 45, 45, 46, 45, 47, 47, 47, 47,		\
+	138, 33, 3, 4,		\
+		41, 36, 36, 3, 48, 41, 41, 36, 48, 48, 48, 41,		\
+	140, 37, 3, 4,		\
+		36, 36, 3, 3, 41, 41, 36, 36, 48, 48, 41, 41,		\
+	144, 75, 4, 3,		\
+		3, 36, 41, 3, 36, 41, 3, 36, 41, 3, 3, 36,		\
+	146, 105, 2, 6,		\
+		104, 48, 48, 48, 83, 82, 48, 104, 48, 48, 83, 194,		\
+	148, 26, 3, 4,		\
+		18, 18, 18, 18, 19, 27, 32, 18, 20, 28, 19, 32,		\
+	149, 34, 2, 6,		\
+		18, 17, 16, 15, 15, 15, 18, 18, 17, 16, 15, 15,		\
+	147, 87, 4, 3,		\
+		79, 79, 15, 48, 79, 79, 48, 48, 48, 79, 79, 79,		\
+	148, 122, 4, 3,		\
+		237, 242, 242, 237, 237, 242, 114, 237, 237, 114, 114, 237,		\
+	0, 28, 2, 5,		\
+		35, 31, 8, 8, 8, 38, 34, 30, 8, 8,		\
+	0, 59, 5, 2,		\
+		26, 11, 26, 11, 26, 11, 26, 11, 26, 11,		\
+	0, 66, 5, 2,		\
+		8, 11, 8, 11, 8, 11, 11, 26, 11, 26,		\
+	7, 82, 2, 5,		\
+		15, 79, 79, 48, 48, 79, 79, 48, 48, 48,		\
+	8, 61, 2, 5,		\
+		12, 13, 75, 75, 75, 75, 75, 79, 79, 79,		\
+	16, 95, 2, 5,		\
+		76, 2, 3, 3, 2, 99, 99, 76, 76, 76,		\
+	19, 73, 2, 5,		\
+		137, 136, 184, 108, 107, 134, 123, 121, 121, 108,		\
+	16, 108, 5, 2,		\
+		99, 113, 163, 115, 115, 116, 116, 71, 71, 72,		\
+	22, 38, 2, 5,		\
+		156, 194, 133, 82, 83, 83, 83, 83, 85, 48,		\
+	46, 42, 2, 5,		\
+		89, 145, 118, 50, 50, 101, 159, 106, 145, 118,		\
+	51, 77, 2, 5,		\
+		127, 122, 121, 121, 121, 128, 136, 123, 127, 122,		\
+	49, 119, 5, 2,		\
+		18, 27, 18, 32, 18, 18, 18, 18, 18, 18,		\
+	63, 107, 2, 5,		\
+		17, 17, 17, 17, 17, 16, 16, 16, 16, 16,		\
+	89, 118, 2, 5,		\
+		121, 121, 121, 121, 238, 121, 121, 121, 238, 243,		\
+	114, 95, 5, 2,		\
+		47, 45, 46, 51, 45, 50, 45, 50, 51, 50,		\
+	119, 31, 5, 2,		\
+		15, 148, 148, 178, 173, 179, 83, 180, 174, 146,		\
+	130, 102, 5, 2,		\
+		51, 50, 45, 50, 210, 50, 207, 51, 211, 45,		\
+	134, 84, 5, 2,		\
+		217, 220, 217, 220, 217, 220, 217, 220, 217, 17,		\
+	143, 100, 5, 2,		\
+		17, 104, 16, 15, 15, 15, 15, 15, 15, 15,		\
+	150, 82, 2, 5,		\
+		41, 60, 60, 79, 79, 24, 24, 60, 60, 74,		\
+	5, 10, 3, 3,		\
+		39, 39, 2, 44, 44, 39, 69, 50, 44,		\
+	5, 110, 3, 3,		\
+		5, 5, 23, 59, 59, 59, 67, 67, 67,		\
+	28, 41, 3, 3,		\
+		47, 46, 45, 46, 45, 51, 51, 50, 50,		\
+	0x15, 31, 11, 3, 3,		\
+		4, 4, 3, 4, 4, 3, 4, 3, 3,		\
+	0x07, 7, 40, 102, 3, 3,		\
+		50, 51, 46, 51, 45, 47, 45, 47, 48,		\
+	42, 80, 3, 3,		\
+		193, 216, 94, 193, 191, 72, 121, 191, 190,		\
+	51, 47, 3, 3,		\
+		72, 82, 83, 72, 82, 83, 78, 82, 85,		\
+	52, 11, 3, 3,		\
+		65, 71, 72, 58, 65, 65, 38, 38, 58,		\
+	52, 32, 3, 3,		\
+		113, 113, 114, 126, 130, 113, 38, 38, 126,		\
+	70, 83, 3, 3,		\
+		15, 79, 79, 79, 79, 48, 48, 48, 48,		\
+	72, 26, 3, 3,		\
+		38, 38, 35, 38, 35, 34, 35, 34, 164,		\
+	0x16, 0x6b, 0x00, 84, 9,		\
+	0x15, 116, 6, 3, 3,		\
+		36, 41, 48, 3, 36, 41, 3, 36, 41,		\
+	0x07, 90, 122, 22, 3, 3,		\
+		79, 15, 15, 79, 79, 79, 48, 48, 79,		\
+	129, 16, 3, 3,		\
+		12, 75, 79, 13, 75, 48, 75, 79, 48,		\
+	143, 24, 3, 3,		\
+		135, 17, 16, 18, 18, 135, 18, 18, 18,		\
+	144, 93, 3, 3,		\
+		18, 18, 18, 17, 17, 17, 16, 16, 16,		\
+	145, 113, 3, 3,		\
+		71, 116, 115, 71, 116, 115, 71, 115, 114,		\
+	10, 53, 2, 4,		\
+		12, 12, 12, 13, 12, 13, 75, 75,		\
+	14, 25, 2, 4,		\
+		72, 72, 72, 72, 71, 72, 72, 72,		\
+	12, 33, 4, 2,		\
+		65, 58, 65, 58, 65, 58, 65, 58,		\
+	15, 8, 4, 2,		\
+		22, 1, 1, 2, 1, 2, 2, 3,		\
+	22, 82, 2, 4,		\
+		84, 50, 50, 145, 95, 84, 50, 145,		\
+	41, 111, 2, 4,		\
+		16, 17, 135, 18, 17, 135, 18, 18,		\
+	52, 40, 2, 4,		\
+		115, 115, 116, 71, 115, 116, 71, 71,		\
+	54, 58, 2, 4,		\
+		15, 16, 17, 18, 15, 16, 135, 18,		\
+	58, 40, 4, 2,		\
+		65, 71, 58, 65, 58, 65, 151, 151,		\
+	67, 75, 2, 4,		\
+		18, 18, 18, 209, 209, 137, 134, 128,		\
+	69, 122, 4, 2,		\
+		14, 37, 13, 14, 12, 12, 12, 12,		\
+	76, 19, 4, 2,		\
+		4, 55, 4, 4, 3, 4, 3, 3,		\
+	98, 88, 4, 2,		\
+		51, 50, 45, 50, 45, 50, 39, 44,		\
+	115, 85, 2, 4,		\
+		36, 36, 41, 41, 41, 41, 48, 48,		\
+	116, 52, 2, 4,		\
+		102, 102, 102, 93, 90, 90, 90, 106,		\
+	117, 0, 2, 4,		\
+		4, 4, 3, 3, 9, 24, 4, 3,		\
+	120, 9, 2, 4,		\
+		60, 48, 48, 48, 60, 60, 79, 79,		\
+	125, 89, 4, 2,		\
+		51, 45, 210, 211, 219, 209, 209, 18,		\
+	143, 83, 4, 2,		\
+		48, 79, 48, 79, 48, 48, 48, 48,		\
+	150, 99, 2, 4,		\
+		75, 75, 75, 75, 13, 12, 26, 26,		\
+	153, 46, 4, 2,		\
+		79, 48, 79, 48, 15, 79, 15, 79,		\
+	4, 104, 3, 2,		\
+		4, 4, 3, 4, 3, 3,		\
+	5, 91, 3, 2,		\
+		48, 48, 48, 48, 48, 41,		\
+	23, 52, 2, 3,		\
+		107, 108, 108, 108, 121, 121,		\
+	36, 106, 3, 2,		\
+		51, 45, 46, 47, 47, 48,		\
+	39, 117, 2, 3,		\
+		18, 19, 20, 18, 19, 20,		\
+	40, 17, 2, 3,		\
+		2, 39, 39, 39, 39, 44,		\
+	48, 92, 2, 3,		\
+		16, 17, 18, 17, 18, 18,		\
+	51, 29, 2, 3,		\
+		113, 113, 113, 126, 126, 130,		\
+	65, 59, 2, 3,		\
+		16, 135, 18, 16, 16, 135,		\
+	65, 107, 3, 2,		\
+		15, 15, 79, 79, 79, 79,		\
+	79, 118, 2, 3,		\
+		58, 65, 65, 65, 71, 72,		\
+	82, 74, 2, 3,		\
+		11, 26, 26, 8, 11, 26,		\
+	84, 118, 2, 3,		\
+		72, 190, 191, 190, 191, 193,		\
+	86, 85, 3, 2,		\
+		48, 48, 48, 48, 48, 48,		\
+	107, 21, 3, 2,		\
+		143, 147, 111, 148, 16, 15,		\
+	111, 100, 3, 2,		\
+		93, 94, 106, 102, 118, 145,		\
+	116, 68, 3, 2,		\
+		104, 3, 3, 104, 3, 3,		\
+	118, 55, 3, 2,		\
+		118, 45, 50, 45, 50, 51,		\
+	119, 80, 3, 2,		\
+		3, 36, 3, 36, 36, 41,		\
+	122, 74, 2, 3,		\
+		3, 104, 3, 3, 3, 104,		\
+	124, 7, 3, 2,		\
+		25, 24, 25, 24, 25, 24,		\
+	124, 95, 3, 2,		\
+		199, 84, 205, 213, 137, 208,		\
+	139, 18, 2, 3,		\
+		15, 15, 15, 16, 16, 16,		\
+	143, 109, 3, 2,		\
+		83, 82, 83, 82, 83, 82,		\
+	148, 40, 2, 3,		\
+		79, 79, 48, 15, 79, 79,		\
+	150, 116, 2, 3,		\
+		113, 114, 114, 130, 113, 114,		\
+	151, 37, 2, 3,		\
+		17, 16, 15, 18, 17, 16,		\
+	4, 8, 2, 2,		\
+		1, 2, 54, 54,		\
+	5, 85, 2, 2,		\
+		15, 79, 79, 79,		\
+	7, 39, 2, 2,		\
+		8, 8, 30, 8,		\
+	8, 30, 2, 2,		\
+		58, 38, 65, 58,		\
+	16, 40, 2, 2,		\
+		38, 151, 58, 192,		\
+	17, 6, 2, 2,		\
+		0, 22, 22, 1,		\
+	24, 84, 2, 2,		\
+		50, 145, 50, 118,		\
+	28, 93, 2, 2,		\
+		72, 72, 72, 94,		\
+	41, 20, 2, 2,		\
+		44, 50, 50, 50,		\
+	49, 121, 2, 2,		\
+		28, 29, 33, 29,		\
+	60, 42, 2, 2,		\
+		78, 133, 176, 182,		\
+	63, 9, 2, 2,		\
+		23, 59, 5, 23,		\
+	65, 102, 2, 2,		\
+		15, 15, 79, 79,		\
+	65, 126, 2, 2,		\
+		16, 16, 15, 15,		\
+	66, 33, 2, 2,		\
+		38, 35, 35, 34,		\
+	78, 51, 2, 2,		\
+		15, 15, 15, 15,		\
+	79, 58, 2, 2,		\
+		13, 13, 12, 12,		\
+	85, 28, 2, 2,		\
+		104, 72, 104, 104,		\
+	86, 91, 2, 2,		\
+		45, 51, 51, 50,		\
+	90, 4, 2, 2,		\
+		4, 4, 4, 3,		\
+	91, 114, 2, 2,		\
+		96, 108, 107, 108,		\
+	91, 122, 2, 2,		\
+		246, 247, 247, 21,		\
+	95, 12, 2, 2,		\
+		3, 3, 36, 36,		\
+	100, 105, 2, 2,		\
+		50, 118, 118, 90,		\
+	105, 26, 2, 2,		\
+		158, 158, 154, 154,		\
+	105, 92, 2, 2,		\
+		2, 39, 3, 2,		\
+	109, 51, 2, 2,		\
+		38, 38, 58, 38,		\
+	109, 70, 2, 2,		\
+		24, 4, 4, 4,		\
+	110, 31, 2, 2,		\
+		15, 147, 15, 148,		\
+	116, 61, 2, 2,		\
+		36, 3, 36, 3,		\
+	117, 15, 2, 2,		\
+		79, 15, 79, 79,		\
+	122, 5, 2, 2,		\
+		10, 25, 10, 10,		\
+	124, 37, 2, 2,		\
+		108, 108, 96, 107,		\
+	128, 81, 2, 2,		\
+		104, 104, 48, 48,		\
+	132, 28, 2, 2,		\
+		48, 41, 41, 36,		\
+	137, 22, 2, 2,		\
+		79, 79, 15, 15,		\
+	158, 37, 2, 2,		\
+		32, 18, 27, 18,		\
+	0x12, 30, 89, 15,		\
+		72, 72, 94, 93, 102, 106, 90, 90, 145, 118, 50, 50, 50, 118, 145,		\
+	0x07, 62, 115, 36, 12,		\
+		152, 153, 188, 122, 121, 121, 121, 121, 108, 107, 95, 50,		\
+	75, 24, 11,		\
+		35, 35, 35, 57, 64, 64, 64, 63, 63, 63, 76,		\
+	58, 50, 9,		\
+		79, 79, 79, 79, 15, 15, 15, 15, 15,		\
+	90, 27, 9,		\
+		57, 64, 64, 64, 64, 64, 64, 70, 117,		\
+	98, 28, 9,		\
+		58, 65, 71, 72, 72, 72, 72, 158, 154,		\
+	123, 83, 9,		\
+		48, 48, 48, 47, 47, 47, 104, 47, 47,		\
+	64, 47, 8,		\
+		48, 48, 48, 48, 48, 79, 79, 79,		\
+	33, 10, 7,		\
+		4, 4, 4, 3, 3, 3, 3,		\
+	90, 25, 7,		\
+		76, 3, 3, 3, 3, 3, 2,		\
+	30, 90, 6,		\
+		72, 94, 102, 106, 145, 118,		\
+	39, 88, 6,		\
+		90, 145, 145, 90, 106, 102,		\
+	55, 122, 6,		\
+		32, 18, 18, 18, 18, 18,		\
+	104, 7, 6,		\
+		50, 50, 51, 45, 47, 47,		\
+	143, 35, 6,		\
+		48, 79, 79, 15, 15, 16,		\
+	8, 110, 5,		\
+		73, 38, 38, 38, 38,		\
+	26, 11, 5,		\
+		5, 5, 5, 5, 5,		\
+	33, 8, 5,		\
+		5, 5, 5, 4, 4,		\
+	65, 90, 5,		\
+		15, 79, 79, 48, 48,		\
+	67, 13, 5,		\
+		73, 67, 67, 67, 67,		\
+	68, 36, 5,		\
+		12, 13, 75, 79, 48,		\
+	73, 93, 5,		\
+		36, 3, 3, 3, 3,		\
+	76, 106, 5,		\
+		3, 3, 3, 3, 3,		\
+	92, 81, 5,		\
+		79, 79, 79, 79, 75,		\
+	97, 116, 5,		\
+		127, 123, 123, 123, 123,		\
+	0, 15, 4,		\
+		38, 38, 57, 64,		\
+	0, 42, 4,		\
+		11, 11, 11, 11,		\
+	8, 10, 4,		\
+		69, 69, 69, 69,		\
+	8, 14, 4,		\
+		88, 89, 90, 88,		\
+	36, 104, 4,		\
+		50, 51, 45, 45,		\
+	41, 117, 4,		\
+		18, 18, 18, 18,		\
+	80, 9, 4,		\
+		5, 5, 5, 5,		\
+	82, 23, 4,		\
+		56, 63, 63, 76,		\
+	97, 118, 4,		\
+		209, 18, 18, 18,		\
+	102, 62, 4,		\
+		8, 8, 8, 8,		\
+	125, 35, 4,		\
+		84, 50, 50, 50,		\
+	143, 88, 4,		\
+		17, 16, 15, 15,		\
+	10, 44, 3,		\
+		8, 8, 30,		\
+	12, 55, 3,		\
+		79, 48, 48,		\
+	15, 116, 3,		\
+		71, 72, 72,		\
+	18, 46, 3,		\
+		83, 83, 48,		\
+	18, 110, 3,		\
+		71, 71, 72,		\
+	18, 119, 3,		\
+		72, 72, 190,		\
+	19, 85, 3,		\
+		90, 90, 145,		\
+	24, 17, 3,		\
+		4, 3, 3,		\
+	33, 83, 3,		\
+		84, 50, 50,		\
+	34, 114, 3,		\
+		129, 17, 17,		\
+	37, 24, 3,		\
+		39, 44, 50,		\
+	42, 87, 3,		\
+		102, 93, 94,		\
+	57, 127, 3,		\
+		21, 21, 21,		\
+	61, 120, 3,		\
+		17, 16, 15,		\
+	67, 121, 3,		\
+		15, 37, 14,		\
+	75, 28, 3,		\
+		165, 162, 152,		\
+	86, 118, 3,		\
+		193, 121, 121,		\
+	102, 4, 3,		\
+		3, 3, 3,		\
+	109, 120, 3,		\
+		18, 18, 209,		\
+	112, 116, 3,		\
+		50, 50, 50,		\
+	113, 50, 3,		\
+		72, 72, 94,		\
+	114, 94, 3,		\
+		48, 47, 47,		\
+	122, 16, 3,		\
+		48, 48, 79,		\
+	131, 122, 3,		\
+		114, 114, 237,		\
+	132, 101, 3,		\
+		219, 212, 209,		\
+	135, 114, 3,		\
+		170, 175, 229,		\
+	0x12, 143, 8, 3,		\
+		18, 19, 20,		\
+	0x16, 0x07, 0x00, 146, 17,		\
+	0x12, 5, 106, 2,		\
+		4, 4,		\
+	0x07, 5, 7, 74, 2,		\
+		14, 37,		\
+	13, 9, 2,		\
+		54, 54,		\
+	16, 34, 2,		\
+		58, 38,		\
+	17, 100, 2,		\
+		99, 163,		\
+	22, 0, 2,		\
+		2, 3,		\
+	0x12, 24, 13, 2,		\
+		3, 4,		\
+	0x07, 11, 27, 120, 2,		\
+		29, 29,		\
+	30, 88, 2,		\
+		94, 93,		\
+	31, 108, 2,		\
+		72, 94,		\
+	31, 113, 2,		\
+		190, 218,		\
+	34, 49, 2,		\
+		84, 50,		\
+	34, 91, 2,		\
+		50, 50,		\
+	49, 62, 2,		\
+		108, 121,		\
+	51, 88, 2,		\
+		122, 127,		\
+	53, 5, 2,		\
+		35, 34,		\
+	59, 95, 2,		\
+		17, 16,		\
+	59, 100, 2,		\
+		18, 18,		\
+	0x12, 65, 91, 2,		\
+		15, 79,		\
+	0x07, 9, 71, 48, 2,		\
+		15, 15,		\
+	83, 34, 2,		\
+		72, 72,		\
+	83, 58, 2,		\
+		12, 11,		\
+	83, 77, 2,		\
+		12, 12,		\
+	97, 26, 2,		\
+		138, 117,		\
+	98, 29, 2,		\
+		38, 58,		\
+	100, 6, 2,		\
+		3, 2,		\
+	108, 8, 2,		\
+		45, 47,		\
+	109, 40, 2,		\
+		65, 71,		\
+	0x12, 111, 71, 2,		\
+		3, 3,		\
+	0x16, 0x06, 0x00, 113, 4,		\
+	0x12, 122, 30, 2,		\
+		148, 98,		\
+	0x12, 124, 47, 2,		\
+		108, 107,		\
+	0x12, 125, 91, 2,		\
+		210, 219,		\
+	0x16, 0x1d, 0x00, 130, 74,		\
+	0x12, 134, 121, 2,		\
+		237, 237,		\
+	0x12, 143, 113, 2,		\
+		116, 71,		\
+	0x12, 146, 30, 2,		\
+		135, 18,		\
+	0x16, 0x12, 0x00, 146, 121,		\
+	0x16, 0x6e, 0x00, 147, 90,		\
+	0x16, 0xb2, 0x00, 158, 82,		\
+	0x13, 152, 82, 28,		\
+		3, 4, 24, 24, 68, 80, 61, 11, 26, 26, 12, 12, 12, 26, 26, 11, 11, 11, 11, 11, 11, 8, 8, 8, 31, 35, 38, 104,		\
+	0x07, 56, 7, 18, 14,		\
+		131, 65, 65, 65, 65, 58, 58, 58, 58, 58, 58, 38, 38, 38,		\
+	73, 36, 13,		\
+		79, 79, 79, 15, 15, 15, 15, 15, 15, 79, 15, 15, 15,		\
+	44, 30, 12,		\
+		118, 145, 89, 89, 89, 89, 89, 89, 145, 118, 50, 50,		\
+	158, 87, 10,		\
+		4, 23, 6, 6, 6, 6, 6, 6, 23, 23,		\
+	45, 16, 9,		\
+		51, 50, 50, 50, 50, 50, 104, 104, 104,		\
+	134, 4, 9,		\
+		12, 13, 13, 13, 14, 37, 37, 79, 79,		\
+	25, 25, 8,		\
+		56, 56, 64, 64, 64, 64, 64, 64,		\
+	73, 98, 8,		\
+		3, 3, 3, 36, 36, 36, 36, 36,		\
+	83, 46, 8,		\
+		152, 153, 158, 158, 158, 149, 182, 171,		\
+	85, 91, 8,		\
+		47, 46, 45, 45, 45, 45, 45, 45,		\
+	145, 46, 8,		\
+		48, 41, 41, 41, 41, 41, 41, 36,		\
+	56, 83, 7,		\
+		209, 137, 134, 137, 209, 18, 18,		\
+	156, 90, 7,		\
+		8, 8, 8, 8, 8, 10, 10,		\
+	10, 76, 6,		\
+		79, 79, 79, 79, 48, 48,		\
+	15, 58, 6,		\
+		48, 48, 48, 48, 48, 48,		\
+	18, 52, 6,		\
+		48, 48, 48, 47, 47, 47,		\
+	24, 0, 6,		\
+		3, 3, 3, 3, 3, 3,		\
+	35, 29, 6,		\
+		44, 44, 44, 50, 50, 50,		\
+	36, 20, 6,		\
+		3, 3, 3, 3, 2, 39,		\
+	73, 113, 6,		\
+		11, 11, 11, 11, 26, 26,		\
+	8, 18, 5,		\
+		71, 71, 72, 72, 71,		\
+	43, 30, 5,		\
+		50, 50, 118, 118, 118,		\
+	49, 50, 5,		\
+		47, 47, 47, 47, 47,		\
+	55, 14, 5,		\
+		58, 58, 58, 58, 58,		\
+	78, 75, 5,		\
+		79, 79, 48, 48, 48,		\
+	99, 47, 5,		\
+		104, 104, 38, 38, 38,		\
+	135, 37, 5,		\
+		2, 39, 39, 39, 39,		\
+	6, 18, 4,		\
+		130, 58, 58, 58,		\
+	9, 36, 4,		\
+		38, 38, 38, 34,		\
+	16, 91, 4,		\
+		76, 76, 76, 76,		\
+	28, 37, 4,		\
+		48, 48, 48, 48,		\
+	48, 32, 4,		\
+		114, 114, 114, 114,		\
+	48, 85, 4,		\
+		193, 193, 193, 193,		\
+	59, 5, 4,		\
+		23, 6, 43, 34,		\
+	77, 36, 4,		\
+		148, 15, 15, 15,		\
+	90, 30, 4,		\
+		38, 38, 58, 65,		\
+	90, 48, 4,		\
+		58, 38, 38, 38,		\
+	95, 43, 4,		\
+		104, 38, 38, 38,		\
+	96, 21, 4,		\
+		36, 36, 36, 2,		\
+	130, 113, 4,		\
+		50, 50, 50, 118,		\
+	132, 0, 4,		\
+		11, 11, 26, 26,		\
+	143, 31, 4,		\
+		15, 79, 79, 48,		\
+	145, 0, 4,		\
+		21, 21, 21, 21,		\
+	153, 82, 4,		\
+		3, 3, 3, 4,		\
+	2, 28, 3,		\
+		38, 38, 34,		\
+	4, 118, 3,		\
+		23, 23, 23,		\
+	12, 91, 3,		\
+		36, 3, 3,		\
+	21, 34, 3,		\
+		35, 150, 150,		\
+	32, 95, 3,		\
+		50, 50, 50,		\
+	34, 117, 3,		\
+		19, 20, 21,		\
+	37, 108, 3,		\
+		48, 48, 79,		\
+	42, 0, 3,		\
+		7, 10, 10,		\
+	77, 90, 3,		\
+		41, 41, 36,		\
+	84, 51, 3,		\
+		152, 169, 168,		\
+	87, 79, 3,		\
+		75, 79, 48,		\
+	91, 110, 3,		\
+		118, 145, 145,		\
+	0x13, 92, 39, 3,		\
+		104, 38, 38,		\
+	0x16, 0x07, 0x00, 103, 52,		\
+	0x13, 107, 100, 3,		\
+		93, 94, 71,		\
+	0x13, 124, 25, 3,		\
+		79, 79, 79,		\
+	0x13, 138, 94, 3,		\
+		104, 104, 18,		\
+	0x13, 141, 29, 3,		\
+		79, 79, 48,		\
+	0x13, 151, 125, 3,		\
+		237, 242, 242,		\
+	0x16, 0x0e, 0x00, 156, 48,		\
+	0x13, 157, 86, 3,		\
+		3, 4, 144,		\
+	0x07, 3, 157, 107, 3,		\
+		59, 59, 59,		\
+	4, 35, 2,		\
+		8, 8,		\
+	8, 59, 2,		\
+		12, 12,		\
+	0x13, 11, 88, 2,		\
+		48, 48,		\
+	0x07, 8, 26, 6, 2,		\
+		5, 5,		\
+	30, 102, 2,		\
+		50, 118,		\
+	34, 29, 2,		\
+		39, 39,		\
+	51, 42, 2,		\
+		115, 116,		\
+	53, 77, 2,		\
+		209, 137,		\
+	55, 123, 2,		\
+		33, 29,		\
+	56, 58, 2,		\
+		16, 17,		\
+	60, 123, 2,		\
+		18, 32,		\
+	0x13, 67, 109, 2,		\
+		79, 79,		\
+	0x16, 0x06, 0x00, 72, 81,		\
+	0x13, 72, 104, 2,		\
+		41, 41,		\
+	0x16, 0x41, 0x00, 74, 79,		\
+	0x16, 0x16, 0x00, 76, 63,		\
+	0x13, 77, 57, 2,		\
+		15, 37,		\
+	0x13, 80, 40, 2,		\
+		147, 148,		\
+	0x13, 80, 96, 2,		\
+		41, 36,		\
+	0x16, 0x5d, 0x00, 84, 90,		\
+	0x16, 0x0b, 0x00, 84, 100,		\
+	0x13, 88, 105, 2,		\
+		44, 44,		\
+	0x13, 89, 88, 2,		\
+		51, 50,		\
+	0x13, 91, 77, 2,		\
+		26, 12,		\
+	0x13, 96, 59, 2,		\
+		35, 31,		\
+	0x07, 4, 100, 10, 2,		\
+		45, 51,		\
+	101, 114, 2,		\
+		107, 108,		\
+	101, 120, 2,		\
+		19, 20,		\
+	102, 108, 2,		\
+		72, 94,		\
+	0x16, 0x1c, 0x00, 105, 59,		\
+	0x13, 108, 61, 2,		\
+		34, 30,		\
+	0x07, 6, 112, 92, 2,		\
+		36, 36,		\
+	115, 48, 2,		\
+		94, 94,		\
+	119, 7, 2,		\
+		24, 60,		\
+	125, 61, 2,		\
+		36, 3,		\
+	128, 30, 2,		\
+		47, 45,		\
+	129, 5, 2,		\
+		8, 11,		\
+	0x16, 0x59, 0x00, 133, 36,		\
+	0x13, 133, 89, 2,		\
+		104, 18,		\
+	0x07, 4, 134, 53, 2,		\
+		3, 3,		\
+	142, 25, 2,		\
+		16, 15,		\
+	150, 20, 2,		\
+		21, 21,		\
+	153, 37, 2,		\
+		18, 135,		\
+	0x01, 2, 136, 41,		\
+	0x01, 3, 75, 107,		\
+	0x21, 144, 54,		\
+	0x01, 5, 33, 9,		\
+	0x01, 11, 81, 67,		\
+	0x01, 13, 96, 80,		\
+	0x21, 131, 15,		\
+	0x01, 15, 74, 66,		\
+	0x21, 147, 99,		\
+	0x01, 17, 142, 101,		\
+	0x21, 148, 34,		\
+	0x01, 22, 6, 8,		\
+	0x07, 3, 26, 130, 6,		\
+	36, 7, 93,		\
+	38, 17, 25,		\
+	0x21, 109, 50,		\
+	0x21, 111, 56,		\
+	0x01, 41, 115, 6,		\
+	0x01, 44, 37, 25,		\
+	0x21, 105, 94,		\
+	0x21, 133, 51,		\
+	0x01, 48, 24, 42,		\
+	0x21, 27, 37,		\
+	0x07, 6, 38, 108,		\
+	58, 49,		\
+	72, 37,		\
+	75, 73,		\
+	89, 85,		\
+	122, 81,		\
+	0x01, 50, 42, 19,		\
+	0x21, 124, 32,		\
+	0x21, 125, 88,		\
+	0x01, 51, 100, 20,		\
+	0x07, 4, 63, 41, 9,		\
+	71, 9, 29,		\
+	72, 111, 102,		\
+	73, 7, 113,		\
+	0x21, 7, 123,		\
+	0x01, 79, 10, 61,		\
+	0x21, 122, 21,		\
+	0x21, 138, 24,		\
+	0x21, 142, 31,		\
+	0x01, 84, 25, 49,		\
+	0x21, 126, 37,		\
+	0x01, 104, 118, 70,		\
+	0x21, 121, 74,		\
+	0x21, 134, 90,		\
+	0x01, 107, 24, 82,		\
+	0x07, 8, 108, 35, 52,		\
+	115, 25, 104,		\
+	128, 97, 117,		\
+	163, 135, 115,		\
+	191, 117, 37,		\
+	208, 106, 117,		\
+	217, 42, 106,		\
+	228, 18, 99,		\
+	0xff
+
+#endif  //  ICT_H_INCLUDED
+
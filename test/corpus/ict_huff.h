@@ -0,0 +1,720 @@
+/*
+ *  ST7735 Huffman Coded Image (draw with drawHuffImage())
+ *  Original: ict.png
+ *  Commands: 11967 bytes, coded: 10196 (code tables and bitstream); total 10705 vs. 11978 bytes
+ */
+
+#ifndef ICT_HUFF_H_INCLUDED
+#define ICT_HUFF_H_INCLUDED
+
+#define ICT_WIDTH		160
+#define ICT_HEIGHT		128
+#define ICT_HUFF_LEN		10705	/*  Total array size  */
+
+#define ICT_HUFF		\
+	254,		\
+	0xbd, 0x9f,	0x9d, 0xb7,	0x5c, 0xbf,	0x5d, 0xc7,		\
+	0x5d, 0xd7,	0x9c, 0xdf,	0x1c, 0xe7,	0xdc, 0xee,		\
+	0x7c, 0xf6,	0xdd, 0xe6,	0x9c, 0xee,	0x1c, 0xf6,		\
+	0xfd, 0xf5,	0xdd, 0xed,	0xbd, 0xed,	0x7d, 0xe5,		\
+	0x5c, 0xe5,	0x1c, 0xe5,	0xfb, 0xdc,	0x7a, 0xdc,		\
+	0xf9, 0xdb,	0x78, 0xdb,	0x9d, 0xa7,	0x7c, 0xe7,		\
+	0xdd, 0xde,	0xbd, 0xe6,	0xfc, 0xf5,	0x9a, 0xdc,		\
+	0x19, 0xdc,	0xb8, 0xdb,	0x9b, 0xf6,	0xdb, 0xf6,		\
+	0xbb, 0xdc,	0x3a, 0xdc,	0xfa, 0xf6,	0x1a, 0xf7,		\
+	0xbd, 0xc6,	0x9d, 0xe5,	0x39, 0xf7,	0x5a, 0xbf,		\
+	0xbb, 0xbe,	0x5d, 0xc6,	0xfb, 0xe6,	0xdb, 0xee,		\
+	0x39, 0xb7,	0xb8, 0xb6,	0x79, 0xbe,	0x3b, 0xbe,		\
+	0xdd, 0xc5,	0x1b, 0xef,	0x17, 0xb7,	0xf7, 0xb6,		\
+	0x7d, 0xee,	0x7c, 0xee,	0x7c, 0xaf,	0x3b, 0xe7,		\
+	0x3a, 0xe7,	0x39, 0xef,	0x18, 0xef,	0x7b, 0xe7,		\
+	0x3d, 0xde,	0x3d, 0xee,	0x7b, 0xa7,	0x5b, 0xd7,		\
+	0x5a, 0xe7,	0xf7, 0xee,	0x1a, 0xef,	0x5a, 0xef,		\
+	0x5d, 0xe6,	0x39, 0xaf,	0x39, 0xe7,	0xd6, 0xee,		\
+	0xb6, 0xee,	0x59, 0xef,	0x3d, 0xe6,	0xfd, 0xe5,		\
+	0x5a, 0xcf,	0xd8, 0xde,	0x97, 0xe6,	0xbd, 0xd5,		\
+	0x5c, 0xe6,	0xba, 0xd6,	0x58, 0xde,	0x3a, 0xd6,		\
+	0xf6, 0xb6,	0x3a, 0xce,	0x9f, 0x00,	0x39, 0xc7,		\
+	0x17, 0xc7,	0x36, 0xc7,	0xf6, 0xc6,	0x98, 0xc6,		\
+	0xb7, 0xd6,	0xd6, 0xde,	0xb6, 0xe6,	0xd6, 0xbe,		\
+	0xb6, 0xc6,	0x58, 0xce,	0xdb, 0xdd,	0x39, 0xd7,		\
+	0x57, 0xd7,	0x36, 0xd7,	0xd6, 0xd6,	0xf7, 0xde,		\
+	0x42, 0xfd,	0xd7, 0xc6,	0xf6, 0xce,	0x95, 0xc6,		\
+	0x55, 0xd6,	0x76, 0xce,	0xd8, 0xd5,	0x7a, 0xe5,		\
+	0x58, 0xe7,	0x57, 0xe7,	0x76, 0xe7,	0x16, 0xe7,		\
+	0xf6, 0xe6,	0xd7, 0xe6,	0x17, 0xbf,	0xb7, 0xde,		\
+	0x75, 0xce,	0x34, 0xde,	0x15, 0xde,	0xd7, 0xdd,		\
+	0x79, 0xe5,	0x5b, 0xe5,	0x58, 0xef,	0xf6, 0xdd,		\
+	0x78, 0xdd,	0x3b, 0xe5,	0x57, 0xef,	0x16, 0xef,		\
+	0x59, 0xc6,	0x77, 0xe6,	0x59, 0xdd,	0x1b, 0xdd,		\
+	0x97, 0xdd,	0x5a, 0xdd,	0x18, 0xe7,	0x98, 0xdd,		\
+	0xbb, 0xce,	0x97, 0xc6,	0x17, 0xce,	0xd9, 0xdd,		\
+	0xfc, 0xe6,	0x16, 0xbf,	0xd7, 0xbe,	0xbb, 0xe5,		\
+	0x9c, 0xe5,	0x39, 0xe6,	0xfa, 0xee,	0xf9, 0xee,		\
+	0x97, 0xee,	0x77, 0xee,	0xfa, 0xe5,	0x9a, 0xee,		\
+	0x99, 0xee,	0xf8, 0xe6,	0x58, 0xee,	0x16, 0xcf,		\
+	0x37, 0xd7,	0x17, 0xdf,	0x98, 0xee,	0x56, 0xdf,		\
+	0x7b, 0xee,	0x5a, 0xee,	0xba, 0xf6,	0x5b, 0xf6,		\
+	0x1b, 0xee,	0x79, 0xee,	0x56, 0xcf,	0x1c, 0xee,		\
+	0x98, 0xe6,	0xdb, 0xe5,	0x59, 0xce,	0x56, 0xd7,		\
+	0x59, 0xe6,	0x3a, 0xee,	0xba, 0xe5,	0xd8, 0xdd,		\
+	0x57, 0xce,	0xfc, 0xe5,	0x1a, 0xe6,	0x39, 0xee,		\
+	0x35, 0xd6,	0xfa, 0xe6,	0x9c, 0xe6,	0xf9, 0xe5,		\
+	0x37, 0xe6,	0x1b, 0xe6,	0x95, 0xe6,	0x75, 0xe6,		\
+	0xd8, 0xee,	0x55, 0xde,	0x78, 0xe6,	0x37, 0xef,		\
+	0xb6, 0xde,	0x95, 0xd6,	0xb6, 0xce,	0xb7, 0xbe,		\
+	0x36, 0xd6,	0x39, 0xce,	0x77, 0xc6,	0x38, 0xce,		\
+	0xf7, 0xd5,	0xf8, 0xcd,	0x98, 0xd5,	0x19, 0xc6,		\
+	0x99, 0xd5,	0x1a, 0xdd,	0x58, 0xc6,	0xd9, 0xcd,		\
+	0x5a, 0xd5,	0x38, 0xc6,	0x99, 0xdd,	0x96, 0xd6,		\
+	0x95, 0xde,	0x7c, 0xcd,	0x56, 0xe6,	0xba, 0xcd,		\
+	0x3c, 0xd5,	0x16, 0xde,	0x16, 0xe6,	0x18, 0xe6,		\
+	0xd8, 0xe5,	0xd7, 0xce,	0x56, 0xd6,	0xf7, 0xd6,		\
+	0x77, 0xdf,	0x36, 0xdf,	0xf9, 0xc5,	0x5b, 0xd5,		\
+	0x59, 0xe7,	0x5b, 0xe6,	0x19, 0xdd,	0x99, 0xdc,		\
+	0x38, 0xdd,	0x95, 0xef,	0xf5, 0xdd,	0x76, 0xdd,		\
+	0xd8, 0xdc,	0x59, 0xdc,	0x95, 0xf7,	0x55, 0xdd,		\
+	0x77, 0xdc,	0x18, 0xdc,	0x56, 0xdc,	0xb7, 0xdb,		\
+	0xda, 0xdc,	0x95, 0xdd,	0xb6, 0xdc,	0xb9, 0xe5,		\
+	0xf6, 0xdc,	0x17, 0xdc,		\
+	0x00, 0x00, 0x06, 0x03, 0x01, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x05, 0x07, 0x21,	\
+	0x22, 0x23, 0x01, 0x02, 0x25, 0x15, 0x12, 0x13, 0xff, 0x00, 0x00, 0x01, 0x03, 0x03, 0x04, 0x0f,	\
+	0x56, 0x22, 0x0a, 0x04, 0x00, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x00, 0x09, 0x0a, 0x0b,	\
+	0x0c, 0x0d, 0x0e, 0x0f, 0x12, 0x19, 0x24, 0x25, 0x28, 0x2a, 0x4b, 0x5a, 0x5b, 0x66, 0x75, 0x10,	\
+	0x11, 0x13, 0x15, 0x16, 0x18, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f, 0x21, 0x22, 0x23, 0x27, 0x29,	\
+	0x2b, 0x2d, 0x2e, 0x2f, 0x30, 0x31, 0x33, 0x34, 0x35, 0x37, 0x38, 0x39, 0x3a, 0x3b, 0x3c, 0x3d,	\
+	0x3e, 0x3f, 0x41, 0x43, 0x46, 0x49, 0x4a, 0x4c, 0x4d, 0x4e, 0x4f, 0x50, 0x51, 0x52, 0x53, 0x54,	\
+	0x55, 0x56, 0x57, 0x58, 0x59, 0x5c, 0x5d, 0x5f, 0x60, 0x61, 0x64, 0x65, 0x68, 0x69, 0x6a, 0x6b,	\
+	0x6c, 0x6d, 0x6e, 0x6f, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7c,	\
+	0x7d, 0x87, 0x8f, 0x94, 0x99, 0x14, 0x17, 0x20, 0x26, 0x2c, 0x32, 0x36, 0x42, 0x44, 0x47, 0x48,	\
+	0x5e, 0x62, 0x63, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x85, 0x86, 0x88, 0x8a, 0x8b, 0x8d, 0x8e, 0x90,	\
+	0x91, 0x92, 0x93, 0x96, 0x97, 0x9c, 0x9d, 0x40, 0x45, 0x67, 0x7e, 0x81, 0x89, 0x95, 0x98, 0x9a,	\
+	0x9e, 0x01, 0x8c, 0x9b, 0x9f, 0x00, 0x00, 0x00, 0x01, 0x07, 0x0d, 0x1b, 0x29, 0x1e, 0x3c, 0x25,	\
+	0x26, 0x30, 0x03, 0x0f, 0x12, 0x26, 0x32, 0x48, 0x4f, 0x04, 0x08, 0x0b, 0x0c, 0x10, 0x15, 0x24,	\
+	0x29, 0x2d, 0x2f, 0x4b, 0x68, 0x79, 0x02, 0x05, 0x0d, 0x11, 0x18, 0x1a, 0x1d, 0x22, 0x23, 0x27,	\
+	0x2c, 0x2e, 0x33, 0x3a, 0x3f, 0x41, 0x47, 0x54, 0x5e, 0x5f, 0x66, 0x6c, 0x72, 0x73, 0x76, 0x91,	\
+	0xd1, 0x0a, 0x0e, 0x13, 0x14, 0x17, 0x1b, 0x1c, 0x1e, 0x20, 0x21, 0x39, 0x3b, 0x40, 0x43, 0x4c,	\
+	0x52, 0x53, 0x5a, 0x5d, 0x60, 0x6a, 0x6b, 0x71, 0x74, 0x78, 0x7a, 0x7b, 0x7e, 0x7f, 0x80, 0x86,	\
+	0x87, 0x88, 0x89, 0x94, 0x98, 0x9a, 0xa7, 0xbe, 0xc1, 0xed, 0x01, 0x06, 0x07, 0x19, 0x1f, 0x25,	\
+	0x28, 0x38, 0x3c, 0x4e, 0x55, 0x59, 0x63, 0x85, 0x93, 0x95, 0x97, 0x99, 0x9e, 0xa2, 0xa3, 0xaf,	\
+	0xbf, 0xcd, 0xd2, 0xd3, 0xd9, 0xdb, 0xdc, 0xf2, 0x00, 0x09, 0x16, 0x2b, 0x37, 0x3d, 0x44, 0x45,	\
+	0x46, 0x49, 0x4d, 0x50, 0x51, 0x56, 0x58, 0x5b, 0x62, 0x65, 0x6e, 0x6f, 0x75, 0x77, 0x7c, 0x82,	\
+	0x84, 0x8c, 0x8e, 0x8f, 0x92, 0x96, 0x9b, 0x9c, 0x9f, 0xa5, 0xa6, 0xa8, 0xa9, 0xaa, 0xab, 0xad,	\
+	0xae, 0xb1, 0xb2, 0xb3, 0xb6, 0xbc, 0xc0, 0xc7, 0xca, 0xcc, 0xcf, 0xd0, 0xd4, 0xd5, 0xda, 0xe5,	\
+	0xeb, 0xec, 0xee, 0xf7, 0x2a, 0x31, 0x34, 0x35, 0x36, 0x3e, 0x42, 0x4a, 0x57, 0x5c, 0x61, 0x69,	\
+	0x6d, 0x7d, 0x81, 0x83, 0x8a, 0x90, 0x9d, 0xa4, 0xac, 0xb0, 0xb4, 0xb5, 0xba, 0xc2, 0xc3, 0xc5,	\
+	0xc8, 0xc9, 0xcb, 0xd7, 0xdd, 0xdf, 0xe0, 0xf3, 0xf6, 0x64, 0x67, 0x70, 0x8b, 0x8d, 0xa0, 0xa1,	\
+	0xb7, 0xb8, 0xb9, 0xbb, 0xbd, 0xc4, 0xc6, 0xce, 0xd6, 0xd8, 0xde, 0xe1, 0xe2, 0xe3, 0xe4, 0xe6,	\
+	0xe7, 0xe8, 0xe9, 0xea, 0xef, 0xf0, 0xf1, 0xf4, 0xf5, 0xf8, 0xf9, 0xfa, 0xfb, 0xfc, 0xfd, 0x3d,	\
+	0x43, 0x4d, 0x4c, 0x2b, 0x8d, 0x4f, 0x41, 0x4a, 0x6d, 0x41, 0x7d, 0x05, 0xa0, 0xa4, 0x73, 0x8f,	\
+	0x10, 0x46, 0x75, 0x06, 0x13, 0x86, 0x3f, 0xdc, 0x50, 0x64, 0x5e, 0xab, 0x09, 0xee, 0xc7, 0x61,	\
+	0x3c, 0x7e, 0xda, 0x8b, 0xa9, 0x7c, 0xc9, 0x6e, 0x3b, 0x87, 0x5d, 0x9d, 0x7c, 0xb9, 0x75, 0xf8,	\
+	0xdb, 0x7b, 0x9c, 0xd4, 0xd1, 0xff, 0x34, 0xc8, 0xfb, 0x73, 0xc2, 0xa7, 0x7e, 0xf1, 0x9b, 0x5d,	\
+	0xef, 0x91, 0x6c, 0xa3, 0x75, 0x4d, 0xb5, 0x9c, 0xb5, 0x47, 0x52, 0xd5, 0x2c, 0xe3, 0x13, 0x22,	\
+	0x65, 0xc3, 0xdf, 0xb8, 0x44, 0xbe, 0x7a, 0x6a, 0x8d, 0xae, 0xe8, 0x93, 0x86, 0x4b, 0xbc, 0xf1,	\
+	0xa1, 0xe1, 0xc9, 0x34, 0xcc, 0x37, 0x04, 0xd7, 0xfc, 0x0d, 0xf3, 0x5e, 0xa8, 0xa7, 0x68, 0x4c,	\
+	0xf6, 0x3c, 0x46, 0x7e, 0xd8, 0x66, 0x7f, 0x1a, 0xa0, 0xcf, 0xf3, 0x10, 0xcd, 0xa7, 0x10, 0xb8,	\
+	0x63, 0x12, 0x44, 0x70, 0x2e, 0x8f, 0xb0, 0x15, 0xfb, 0xdb, 0x28, 0x6b, 0x66, 0x20, 0xdc, 0xc4,	\
+	0x08, 0x7a, 0x44, 0x4f, 0x64, 0x11, 0x4d, 0xbe, 0x22, 0xc9, 0x6c, 0x8b, 0xa2, 0x8c, 0x8b, 0xaa,	\
+	0x31, 0x16, 0xf1, 0x98, 0x30, 0xb8, 0x96, 0x60, 0xaa, 0xd5, 0x5b, 0x8e, 0xf3, 0x5e, 0x05, 0xa9,	\
+	0x39, 0x77, 0xb8, 0x4d, 0xf9, 0x9d, 0x34, 0x6a, 0xa1, 0x45, 0x83, 0x6a, 0x18, 0xe5, 0x59, 0x26,	\
+	0x1d, 0x88, 0x56, 0x3d, 0xfa, 0x87, 0xa8, 0xc2, 0x62, 0xf7, 0x81, 0xfa, 0xda, 0x06, 0x42, 0xf3,	\
+	0x0d, 0xeb, 0x7c, 0xed, 0xa1, 0xcf, 0xa8, 0x9e, 0x8c, 0x09, 0x74, 0xe7, 0x98, 0x6d, 0xbb, 0xa9,	\
+	0x06, 0xf7, 0xe9, 0x52, 0xb5, 0xe4, 0x62, 0x3a, 0x5b, 0x6d, 0xb0, 0xfd, 0xda, 0x8c, 0x3b, 0x7e,	\
+	0xe3, 0x85, 0x2b, 0x1c, 0xd6, 0x99, 0x2a, 0x3c, 0x28, 0xe6, 0xa7, 0xf5, 0xa4, 0xb8, 0xd7, 0xa4,	\
+	0xbe, 0xef, 0x74, 0xd3, 0xe7, 0x10, 0x95, 0x37, 0xdb, 0x33, 0x6a, 0x3a, 0x14, 0x0a, 0xa2, 0x4b,	\
+	0xbc, 0x82, 0x4e, 0x89, 0xb2, 0x4f, 0xae, 0x21, 0x27, 0x05, 0xa2, 0xc5, 0x9d, 0x52, 0x86, 0xca,	\
+	0xd4, 0x38, 0x5e, 0x91, 0xf1, 0xe2, 0x05, 0x7b, 0xa7, 0xc8, 0xfa, 0xea, 0xc8, 0xdb, 0xc4, 0x09,	\
+	0xbd, 0x96, 0x13, 0x96, 0x5c, 0x27, 0x2e, 0x1a, 0x0f, 0x87, 0x68, 0x27, 0x4c, 0x20, 0x8f, 0x2c,	\
+	0x48, 0xa6, 0xa9, 0xc8, 0xa9, 0x75, 0x48, 0xbc, 0x1a, 0xc0, 0xfc, 0x1a, 0x66, 0x3c, 0xf3, 0xc6,	\
+	0x0a, 0x2e, 0x73, 0x03, 0x9d, 0xfd, 0x47, 0x0d, 0xa2, 0xed, 0xec, 0x18, 0xf7, 0xe2, 0x98, 0xea,	\
+	0xf2, 0x83, 0x23, 0xb3, 0xad, 0xec, 0x2b, 0xb6, 0x66, 0x5e, 0x38, 0xa0, 0xde, 0xc4, 0x53, 0xad,	\
+	0x5f, 0x2d, 0xbb, 0xbb, 0x24, 0x6f, 0xf9, 0x68, 0x4d, 0x5c, 0xec, 0x09, 0x7d, 0xb7, 0xe8, 0xab,	\
+	0x68, 0xe6, 0xbe, 0xb8, 0xab, 0x3f, 0x17, 0x7c, 0x37, 0xad, 0xd9, 0x25, 0x7d, 0x64, 0x06, 0x2e,	\
+	0x30, 0x5d, 0xd5, 0x62, 0xc6, 0xdd, 0x0a, 0xc7, 0x43, 0x61, 0x7d, 0xeb, 0x03, 0x2b, 0xae, 0x40,	\
+	0xab, 0xd8, 0x44, 0x6d, 0x63, 0xa0, 0xb9, 0xb2, 0x41, 0xc9, 0x04, 0x27, 0xbe, 0x64, 0x27, 0xda,	\
+	0x21, 0x15, 0xc6, 0x80, 0x39, 0x52, 0xe0, 0xcb, 0xfb, 0x86, 0xbb, 0x2d, 0xf3, 0x5a, 0x87, 0xd9,	\
+	0x4a, 0x9d, 0x69, 0xd6, 0x5c, 0xb6, 0xfc, 0x7f, 0xba, 0x01, 0xec, 0xe3, 0x16, 0x56, 0x8d, 0x1a,	\
+	0x64, 0x34, 0x68, 0x53, 0xc6, 0xb7, 0x80, 0xfb, 0xa4, 0xdc, 0x2d, 0x69, 0xde, 0x46, 0x98, 0x8d,	\
+	0x51, 0x1b, 0x74, 0xed, 0x3c, 0x2f, 0xf2, 0x38, 0x96, 0x6a, 0xd9, 0x12, 0xf7, 0x71, 0x0c, 0xe1,	\
+	0x92, 0xb1, 0x2e, 0x82, 0xd7, 0x4c, 0x47, 0xcc, 0x88, 0x24, 0xdd, 0x91, 0x12, 0x77, 0xad, 0xde,	\
+	0xcb, 0xf5, 0x46, 0xb4, 0xb3, 0xc5, 0x3d, 0x55, 0x9c, 0xf1, 0xdf, 0x34, 0x86, 0x2b, 0xa5, 0xe9,	\
+	0x3b, 0xef, 0xca, 0x36, 0x58, 0xe0, 0xac, 0xfd, 0x5a, 0x0b, 0x3f, 0x81, 0x87, 0xd5, 0xf1, 0xd1,	\
+	0x28, 0xf7, 0x9d, 0x1d, 0xee, 0x15, 0x96, 0xc7, 0x19, 0x2f, 0xd9, 0x90, 0x87, 0x63, 0x6a, 0xd8,	\
+	0xba, 0xef, 0x86, 0xfe, 0x93, 0x41, 0x96, 0x9a, 0x44, 0x93, 0x17, 0x41, 0x56, 0xda, 0xc1, 0x5a,	\
+	0x5c, 0x0a, 0x1d, 0x54, 0x04, 0x75, 0x1a, 0x41, 0x3b, 0xb9, 0x84, 0x5d, 0x1e, 0x32, 0x2a, 0x7d,	\
+	0xa0, 0x7a, 0x9c, 0x46, 0x3f, 0x8c, 0xb3, 0x1f, 0x7a, 0x20, 0x7f, 0xe4, 0x33, 0x04, 0xb6, 0x2f,	\
+	0xa5, 0x9f, 0xf6, 0x55, 0x73, 0xf5, 0xaa, 0x1d, 0x18, 0x4c, 0x7a, 0xcd, 0xa4, 0x97, 0xcd, 0xa0,	\
+	0x5b, 0x96, 0x13, 0xee, 0xaa, 0x04, 0x03, 0x96, 0x6a, 0x02, 0x9c, 0xfc, 0x4a, 0x37, 0x5c, 0xa4,	\
+	0x62, 0x48, 0xaa, 0x62, 0x7f, 0x7b, 0x26, 0xbb, 0x06, 0xd1, 0x26, 0xa0, 0x93, 0x2a, 0x11, 0x85,	\
+	0x67, 0x48, 0x69, 0xa7, 0x58, 0x87, 0x1e, 0x79, 0x83, 0x3e, 0x21, 0x9f, 0x8a, 0x64, 0x93, 0x32,	\
+	0x29, 0x26, 0x8d, 0x12, 0x16, 0xbd, 0x79, 0x22, 0xfb, 0x44, 0x75, 0xf3, 0x81, 0x5f, 0xb5, 0x81,	\
+	0x1d, 0x7a, 0x82, 0x14, 0xf1, 0x14, 0x0a, 0x32, 0x26, 0xa5, 0x8c, 0x3c, 0x88, 0x63, 0xbf, 0x3e,	\
+	0x0e, 0x45, 0x00, 0x32, 0xbf, 0xdd, 0xa6, 0xe7, 0x7a, 0x77, 0x8f, 0xb0, 0xb4, 0xc9, 0x1c, 0xcf,	\
+	0x8f, 0xe8, 0xd2, 0x37, 0x55, 0xce, 0xe1, 0x7f, 0xe9, 0xd4, 0x57, 0xf4, 0xd8, 0x77, 0x37, 0x91,	\
+	0xb1, 0x37, 0xcc, 0x47, 0x55, 0xca, 0x80, 0x9b, 0x7a, 0x4b, 0xf7, 0xfd, 0x95, 0x1d, 0xf3, 0xf5,	\
+	0x0a, 0x8a, 0x91, 0xd7, 0xd4, 0x59, 0x8e, 0x39, 0xe6, 0x84, 0xa9, 0x6e, 0x09, 0x48, 0xee, 0xee,	\
+	0x83, 0xa9, 0xdb, 0x82, 0x8e, 0x77, 0x2a, 0x8d, 0xe7, 0xa3, 0x4d, 0x1b, 0xcc, 0xd7, 0x5a, 0x69,	\
+	0x38, 0x4e, 0xeb, 0x6d, 0xb0, 0xf8, 0x2b, 0x9c, 0x29, 0xee, 0xe2, 0x25, 0x3c, 0xc0, 0x77, 0x2f,	\
+	0x51, 0xd1, 0x39, 0x8c, 0xe0, 0xa5, 0xac, 0x43, 0x93, 0x9c, 0x69, 0xa6, 0xc3, 0x4a, 0x19, 0x2d,	\
+	0x88, 0x51, 0xdb, 0x15, 0x32, 0xc1, 0xbe, 0x59, 0x44, 0xa8, 0xf9, 0x4c, 0x0c, 0x74, 0xca, 0x83,	\
+	0xc8, 0x47, 0x0a, 0x7c, 0x2b, 0x23, 0x34, 0x2b, 0x9f, 0xb4, 0x65, 0x4f, 0x98, 0x13, 0xb9, 0x14,	\
+	0x27, 0x0e, 0x72, 0x09, 0x8c, 0x42, 0x28, 0x93, 0x44, 0x54, 0x31, 0x01, 0xf1, 0xd8, 0x18, 0x35,	\
+	0x3a, 0x37, 0xdf, 0x97, 0x4c, 0x79, 0x54, 0xa4, 0xaa, 0xce, 0xd1, 0x39, 0xd5, 0xc2, 0x65, 0x5d,	\
+	0x48, 0x13, 0xcf, 0xca, 0x12, 0xae, 0x7c, 0x8b, 0xd3, 0xc2, 0x44, 0x4f, 0x8b, 0x48, 0xb7, 0x7a,	\
+	0x06, 0x53, 0xc4, 0x53, 0x73, 0x3a, 0xee, 0x2b, 0x6a, 0x11, 0xbe, 0x6e, 0x02, 0x3b, 0x81, 0x3c,	\
+	0xb5, 0x3f, 0x94, 0x4e, 0xeb, 0x7e, 0xc8, 0xa8, 0x1b, 0x44, 0xcc, 0x6a, 0x93, 0x47, 0x93, 0xe6,	\
+	0x75, 0xbd, 0xc4, 0x2d, 0xca, 0xd2, 0x48, 0xb8, 0xa4, 0x75, 0x6e, 0x99, 0x77, 0xa2, 0xa8, 0x5f,	\
+	0xf3, 0x11, 0xf9, 0x67, 0x14, 0x3f, 0x6d, 0x63, 0x2c, 0x7a, 0x00, 0x9d, 0x3b, 0x48, 0x30, 0x78,	\
+	0xc8, 0xb0, 0xf8, 0x08, 0xb5, 0xf4, 0x48, 0xa8, 0x76, 0x01, 0xe1, 0xd1, 0x83, 0x3d, 0x3f, 0x67,	\
+	0x23, 0xe5, 0x77, 0x57, 0x39, 0x11, 0x7a, 0x0d, 0xc7, 0x66, 0x5f, 0xa0, 0xd7, 0x38, 0xea, 0x73,	\
+	0x82, 0x1a, 0x9d, 0xac, 0xb8, 0x13, 0x94, 0x96, 0x48, 0xa8, 0x38, 0x4b, 0x13, 0x31, 0x8c, 0xab,	\
+	0x71, 0x02, 0xb1, 0x79, 0x88, 0xf2, 0x38, 0x48, 0xfb, 0x36, 0x01, 0x22, 0x5b, 0x18, 0xde, 0xd6,	\
+	0x9f, 0x56, 0x8a, 0x5f, 0x6b, 0x4e, 0xc9, 0xcd, 0x37, 0x24, 0x2d, 0x45, 0xef, 0x50, 0xb6, 0x31,	\
+	0x12, 0x54, 0x6d, 0xac, 0x5b, 0x57, 0x6b, 0x63, 0xa2, 0x33, 0x73, 0xe7, 0xde, 0x6d, 0x16, 0xa1,	\
+	0xb1, 0xaf, 0x1a, 0xf8, 0x2d, 0xd7, 0xac, 0xf4, 0x5f, 0x37, 0x3e, 0x95, 0xec, 0x8d, 0x66, 0xae,	\
+	0x70, 0x5b, 0x2f, 0x5c, 0xcb, 0xc2, 0x5e, 0x87, 0x45, 0xfb, 0x73, 0x03, 0x09, 0x73, 0xd5, 0x8a,	\
+	0xbd, 0x45, 0xa5, 0x63, 0x27, 0xe9, 0x56, 0xbd, 0x4f, 0x3e, 0xd9, 0xc9, 0x9b, 0x7c, 0xde, 0xa9,	\
+	0x8d, 0x7c, 0xda, 0x2f, 0x9a, 0xa6, 0xd7, 0x32, 0x3c, 0xe2, 0xee, 0x72, 0x6d, 0x9b, 0x9a, 0x16,	\
+	0xac, 0xd6, 0xe3, 0xe3, 0xaf, 0x49, 0xd1, 0xa4, 0xbd, 0x8b, 0x93, 0x6a, 0xdc, 0xd0, 0xb4, 0x66,	\
+	0x97, 0x26, 0xd1, 0xb9, 0x6a, 0xf5, 0x72, 0x37, 0x65, 0x7b, 0xa1, 0xe4, 0x94, 0xc4, 0x8b, 0xcf,	\
+	0xf1, 0x3e, 0xa9, 0xed, 0xde, 0x6e, 0xaf, 0xbb, 0x75, 0x74, 0xbb, 0x59, 0x4b, 0xa3, 0x23, 0x71,	\
+	0xd9, 0x37, 0x8a, 0xdc, 0x9c, 0xac, 0x66, 0xf4, 0xfd, 0xbc, 0x6e, 0x6e, 0x56, 0x6e, 0xeb, 0x24,	\
+	0x1c, 0x45, 0xeb, 0xd9, 0xbb, 0xcc, 0x1d, 0xaf, 0xb1, 0xec, 0x40, 0xc6, 0x73, 0xe5, 0xdf, 0x95,	\
+	0x52, 0xc3, 0x39, 0xef, 0x96, 0x15, 0x5d, 0xa3, 0x76, 0xf3, 0x85, 0xbb, 0xe9, 0x53, 0x61, 0xcc,	\
+	0x0b, 0x39, 0x7b, 0xf7, 0xc9, 0x78, 0x01, 0xcb, 0x77, 0xd5, 0xfc, 0x67, 0xb6, 0xfa, 0xe5, 0xb0,	\
+	0x8b, 0xfb, 0x47, 0xf6, 0xf6, 0xe9, 0xe2, 0x2f, 0x17, 0x6d, 0xc8, 0xd7, 0x0e, 0x37, 0x7a, 0xc0,	\
+	0x3f, 0xd3, 0x71, 0xdb, 0x85, 0x15, 0xd0, 0xfc, 0xf5, 0x5e, 0x5f, 0xff, 0x92, 0xe5, 0x3e, 0x35,	\
+	0x8d, 0xbf, 0xe7, 0x3d, 0xd1, 0xb8, 0xfc, 0x68, 0x37, 0x7f, 0x39, 0x6b, 0x09, 0xf5, 0xe8, 0x36,	\
+	0x94, 0xa7, 0x5c, 0x75, 0xad, 0xef, 0x6a, 0x04, 0x1f, 0xfa, 0xd4, 0x0b, 0xd4, 0xdc, 0x76, 0x64,	\
+	0xe4, 0x16, 0x36, 0xff, 0xf4, 0x76, 0xe3, 0x66, 0x30, 0x12, 0xbe, 0xdd, 0xfd, 0xe9, 0x8e, 0xe5,	\
+	0xb2, 0xc5, 0x58, 0xbf, 0x56, 0xe3, 0xa8, 0xb0, 0x25, 0xb4, 0x59, 0x1f, 0xdb, 0x15, 0x65, 0x54,	\
+	0xd3, 0xdb, 0x61, 0x30, 0xe2, 0x25, 0xee, 0xb7, 0xaf, 0x11, 0xb7, 0xbb, 0x2b, 0x12, 0x3a, 0x22,	\
+	0xac, 0x68, 0x57, 0x5b, 0xbf, 0x12, 0xde, 0xca, 0x76, 0xec, 0x53, 0x37, 0x65, 0xe7, 0x19, 0x64,	\
+	0x52, 0xb0, 0x76, 0x52, 0xf9, 0x4b, 0x1f, 0xdf, 0x2f, 0xa4, 0xb0, 0x6f, 0x5f, 0x6d, 0xed, 0xd1,	\
+	0x78, 0xc1, 0x35, 0xf6, 0xfb, 0xcb, 0xb3, 0x4c, 0xe2, 0x29, 0x68, 0x2d, 0xc7, 0xa5, 0x6d, 0x9d,	\
+	0x95, 0x8c, 0xca, 0xdb, 0x77, 0xe9, 0x75, 0x20, 0x69, 0x2e, 0x8f, 0xef, 0xdb, 0x70, 0xfb, 0xd0,	\
+	0xdd, 0xd8, 0xdf, 0x86, 0xee, 0x57, 0x3d, 0x2b, 0x36, 0x65, 0x76, 0xdc, 0x7a, 0xaf, 0xc2, 0xfa,	\
+	0xf3, 0x52, 0xb0, 0x3b, 0x57, 0x0a, 0x93, 0xdf, 0x06, 0x8c, 0xc8, 0x42, 0x12, 0xd2, 0xd2, 0xde,	\
+	0xea, 0xd6, 0xd6, 0xe2, 0xed, 0x75, 0xe2, 0x44, 0x4d, 0x7c, 0x4c, 0xcc, 0x84, 0x21, 0x2d, 0x2d,	\
+	0x2d, 0xee, 0xad, 0x6d, 0x6e, 0x2e, 0xd7, 0x5e, 0x24, 0x4f, 0x9b, 0xd3, 0x32, 0x10, 0x84, 0xb4,	\
+	0xb4, 0xb7, 0xba, 0xb5, 0xb5, 0xb8, 0xbb, 0x5d, 0x78, 0x91, 0x3e, 0x90, 0x0c, 0xc8, 0x42, 0x12,	\
+	0xd2, 0xd2, 0xde, 0xea, 0xd6, 0xd6, 0xe2, 0xed, 0x75, 0xe2, 0x44, 0xfa, 0xcd, 0x19, 0x90, 0x84,	\
+	0x25, 0xa5, 0xa5, 0xbd, 0xd5, 0xad, 0xad, 0xc5, 0xda, 0xeb, 0xc4, 0x89, 0xd3, 0x96, 0x67, 0xa2,	\
+	0x42, 0x11, 0x68, 0x3a, 0x24, 0x1a, 0xcb, 0x41, 0x18, 0xc6, 0xb5, 0xa6, 0x79, 0x9e, 0x89, 0x08,	\
+	0x45, 0xa0, 0xe8, 0x90, 0x6b, 0x2d, 0x04, 0x63, 0x1a, 0xd6, 0xda, 0x26, 0x7a, 0x24, 0x21, 0x16,	\
+	0x83, 0xa2, 0x41, 0xac, 0xb4, 0x11, 0x8c, 0x6b, 0x5b, 0x71, 0x99, 0xe8, 0x90, 0x84, 0x5a, 0x0e,	\
+	0x89, 0x06, 0xb2, 0xd0, 0x46, 0x31, 0xad, 0x9b, 0x4a, 0x66, 0x57, 0x4a, 0x52, 0x95, 0xd2, 0x94,	\
+	0xa5, 0x74, 0xa5, 0x29, 0x73, 0xe9, 0xcc, 0xca, 0xe9, 0x4a, 0x52, 0xba, 0x52, 0x94, 0xae, 0x94,	\
+	0xa5, 0x2e, 0x8d, 0x59, 0x99, 0x5d, 0x29, 0x4a, 0x57, 0x4a, 0x52, 0x95, 0xd2, 0x94, 0xa5, 0xd3,	\
+	0xae, 0x33, 0x2b, 0xa5, 0x29, 0x4a, 0xe9, 0x4a, 0x52, 0xba, 0x52, 0x94, 0xba, 0xf6, 0x46, 0x65,	\
+	0x74, 0xa5, 0x29, 0x5d, 0x29, 0x4a, 0x57, 0x4a, 0x52, 0x96, 0x92, 0x51, 0x9d, 0xa5, 0xaa, 0xeb,	\
+	0xda, 0x5a, 0xae, 0xbd, 0xbd, 0xc4, 0x45, 0xee, 0xae, 0xe2, 0x2f, 0x4d, 0xc0, 0x67, 0x69, 0x6a,	\
+	0xba, 0xf6, 0x96, 0xab, 0xaf, 0x6f, 0x71, 0x11, 0x7b, 0xab, 0xb8, 0x8b, 0xd4, 0x70, 0x99, 0xda,	\
+	0x5a, 0xae, 0xbd, 0xa5, 0xaa, 0xeb, 0xdb, 0xdc, 0x44, 0x5e, 0xea, 0xee, 0x22, 0xfa, 0x1c, 0x26,	\
+	0x76, 0x96, 0xab, 0xaf, 0x69, 0x6a, 0xba, 0xf6, 0xf7, 0x11, 0x17, 0xba, 0xbb, 0x88, 0xbd, 0x6f,	\
+	0x19, 0x9d, 0xa5, 0xaa, 0xeb, 0xdb, 0xdc, 0x44, 0x5e, 0xea, 0xee, 0x22, 0xe4, 0xb7, 0xb8, 0x89,	\
+	0x63, 0xca, 0x67, 0x69, 0x6a, 0xba, 0xf6, 0xf7, 0x11, 0x17, 0xba, 0xbb, 0x88, 0xb9, 0x2d, 0xee,	\
+	0x22, 0x4c, 0xd4, 0x99, 0x80, 0x00, 0x00, 0x36, 0xd8, 0x37, 0x25, 0xa6, 0xda, 0x94, 0x6e, 0x4c,	\
+	0x63, 0x30, 0x00, 0x00, 0x06, 0xdb, 0x06, 0xe4, 0xb4, 0xdb, 0x52, 0x8d, 0x8f, 0x92, 0x66, 0x00,	\
+	0x00, 0x00, 0xdb, 0x60, 0xdc, 0x96, 0x9b, 0x6a, 0x51, 0xbc, 0x10, 0xcc, 0xd5, 0x56, 0x03, 0x8e,	\
+	0x38, 0xe2, 0x10, 0x80, 0x00, 0x00, 0x07, 0x95, 0xa6, 0x6a, 0xab, 0x01, 0xc7, 0x1c, 0x71, 0x08,	\
+	0x40, 0x00, 0x00, 0x03, 0x76, 0x46, 0x6a, 0xab, 0x01, 0xc7, 0x1c, 0x71, 0x08, 0x40, 0x00, 0x00,	\
+	0x02, 0xfb, 0xe6, 0x6a, 0xab, 0x01, 0xc7, 0x1c, 0x71, 0x08, 0x40, 0x00, 0x00, 0x07, 0x3c, 0xb1,	\
+	0x9b, 0x88, 0x00, 0x80, 0xe0, 0x02, 0xae, 0x20, 0x15, 0x71, 0x01, 0x83, 0x7e, 0x66, 0xe2, 0x00,	\
+	0x20, 0x38, 0x00, 0xab, 0x88, 0x05, 0x5c, 0x40, 0x62, 0xe0, 0x19, 0xb8, 0x80, 0x08, 0x0e, 0x00,	\
+	0x2a, 0xe2, 0x01, 0x57, 0x10, 0x19, 0x58, 0x26, 0x6e, 0x20, 0x02, 0x03, 0x80, 0x0a, 0xb8, 0x80,	\
+	0x55, 0xc4, 0x07, 0xc6, 0x74, 0xcc, 0x63, 0x1a, 0x16, 0x18, 0xc7, 0x05, 0x65, 0x86, 0x4d, 0x18,	\
+	0x2b, 0x7c, 0xa8, 0x4c, 0xc6, 0x31, 0xa1, 0x61, 0x8c, 0x70, 0x56, 0x58, 0x64, 0xd1, 0x82, 0xb7,	\
+	0x5d, 0x69, 0x98, 0x03, 0x2c, 0x03, 0x2c, 0x08, 0x19, 0x60, 0x40, 0xcb, 0x02, 0xbc, 0xcb, 0x33,	\
+	0x00, 0x65, 0x80, 0x65, 0x81, 0x03, 0x2c, 0x08, 0x19, 0x60, 0x4c, 0x8e, 0x66, 0x00, 0xcb, 0x00,	\
+	0xcb, 0x02, 0x06, 0x58, 0x10, 0x32, 0xc0, 0xa1, 0xf6, 0x0c, 0xc4, 0x21, 0x3e, 0x13, 0xe8, 0xf1,	\
+	0xdf, 0x47, 0x91, 0x22, 0x3c, 0x83, 0x1a, 0x86, 0x84, 0xcc, 0x42, 0x13, 0xe1, 0x3e, 0x8f, 0x1d,	\
+	0xf4, 0x79, 0x12, 0x23, 0xc8, 0x31, 0xbd, 0xd0, 0x4c, 0xd0, 0x00, 0x03, 0x42, 0x00, 0x63, 0x42,	\
+	0x06, 0x31, 0x8f, 0xe7, 0x08, 0xcd, 0x00, 0x00, 0x34, 0x20, 0x06, 0x34, 0x20, 0x63, 0x18, 0xe7,	\
+	0xe1, 0x99, 0x80, 0x36, 0xdb, 0x6d, 0xc9, 0x6a, 0x4b, 0x52, 0x8d, 0x28, 0xc6, 0x37, 0x1e, 0x51,	\
+	0x98, 0x03, 0x6d, 0xb6, 0xdc, 0x96, 0xa4, 0xb5, 0x28, 0xd2, 0x8c, 0x63, 0x74, 0xe7, 0x99, 0x90,	\
+	0x84, 0x21, 0x34, 0x60, 0xc1, 0x82, 0xb2, 0xcb, 0x2c, 0x31, 0x8e, 0xdb, 0x6c, 0xcc, 0x84, 0x21,	\
+	0x09, 0xa3, 0x06, 0x0c, 0x15, 0x96, 0x59, 0x61, 0x8c, 0x76, 0xbb, 0xe6, 0x64, 0x21, 0x08, 0x4d,	\
+	0x18, 0x30, 0x60, 0xac, 0xb2, 0xcb, 0x0c, 0x63, 0x14, 0x26, 0x77, 0x29, 0xa6, 0x9c, 0x5b, 0x94,	\
+	0xd3, 0x2c, 0x5d, 0xd5, 0xc9, 0x4b, 0x1a, 0x2a, 0x52, 0x19, 0xdc, 0xa6, 0x9a, 0x71, 0x6e, 0x53,	\
+	0x4c, 0xb1, 0x77, 0x57, 0x25, 0x2c, 0x68, 0xad, 0xc4, 0x33, 0xb9, 0x4d, 0x34, 0xe2, 0xdc, 0xa6,	\
+	0x99, 0x62, 0xee, 0xae, 0x4a, 0x58, 0xd1, 0x61, 0x56, 0x19, 0x9a, 0x7d, 0x1c, 0xa3, 0x1a, 0x7d,	\
+	0x13, 0x18, 0xd3, 0xcc, 0x63, 0x1a, 0x25, 0x79, 0x99, 0xa7, 0xd1, 0xca, 0x31, 0xa7, 0xd1, 0x31,	\
+	0x8d, 0x3c, 0xc6, 0x31, 0xbb, 0xf2, 0x8c, 0xc6, 0x31, 0x8e, 0xcf, 0x76, 0x31, 0xc0, 0xb3, 0xb3,	\
+	0xb3, 0x55, 0x58, 0x10, 0x3f, 0x5e, 0x63, 0x31, 0x8c, 0x63, 0xb3, 0xdd, 0x8c, 0x70, 0x2c, 0xec,	\
+	0xec, 0xd5, 0x56, 0x04, 0x0b, 0x2b, 0x13, 0x31, 0x8d, 0x68, 0x23, 0x1a, 0xd0, 0x46, 0x35, 0xb4,	\
+	0x46, 0xb4, 0x12, 0x43, 0xda, 0x33, 0x18, 0xd6, 0x82, 0x31, 0xad, 0x04, 0x63, 0x5b, 0x44, 0x6b,	\
+	0x41, 0x25, 0x04, 0x83, 0x33, 0xd0, 0xc4, 0xa5, 0x89, 0x4b, 0x1a, 0xbe, 0x35, 0x7a, 0xc6, 0xac,	\
+	0x63, 0x1a, 0x7b, 0x38, 0xcc, 0xf4, 0x31, 0x29, 0x62, 0x52, 0xc6, 0xaf, 0x8d, 0x5e, 0xb1, 0xab,	\
+	0x18, 0xc6, 0xc1, 0xd9, 0x78, 0xc4, 0xa1, 0x59, 0x26, 0x9a, 0x77, 0x3e, 0x2a, 0x50, 0xac, 0x93,	\
+	0x4e, 0xe7, 0xc6, 0xf5, 0x84, 0x97, 0x53, 0xf2, 0xd3, 0xfb, 0x7e, 0x3c, 0xd1, 0x25, 0x0b, 0xe5,	\
+	0x79, 0xde, 0x4f, 0x24, 0xe2, 0x14, 0x2f, 0xc1, 0xe8, 0xf2, 0x75, 0x4e, 0x21, 0x31, 0xf8, 0x3e,	\
+	0xee, 0xa9, 0xce, 0x26, 0x3b, 0x4c, 0x1f, 0xb8, 0x73, 0x9d, 0x8f, 0x07, 0x0b, 0x87, 0xbf, 0xa1,	\
+	0x43, 0xfa, 0xb8, 0x18, 0x3c, 0x33, 0xd0, 0xa5, 0xf9, 0xff, 0x1f, 0xe5, 0xe1, 0xef, 0xe8, 0x52,	\
+	0xc6, 0xfe, 0x7a, 0x7f, 0x46, 0x85, 0x0a, 0x58, 0xd8, 0xb9, 0x54, 0xf0, 0xe9, 0x52, 0xc3, 0xa3,	\
+	0x8f, 0x4d, 0xe9, 0x6b, 0x32, 0xa0, 0x00, 0x06, 0xdb, 0x6e, 0x4b, 0x4d, 0x49, 0xf0, 0x3d, 0xae,	\
+	0x77, 0xb5, 0xed, 0x78, 0x12, 0x5b, 0x6d, 0xb6, 0xdb, 0x00, 0x00, 0x00, 0xe0, 0x61, 0x36, 0xdb,	\
+	0x72, 0x5a, 0x6a, 0x4f, 0x3b, 0x9d, 0xed, 0x73, 0x79, 0xbe, 0x17, 0x37, 0x9b, 0xcd, 0xf7, 0x79,	\
+	0xd2, 0x5a, 0x6a, 0x4b, 0x6d, 0xb6, 0xdb, 0x7e, 0x87, 0xe5, 0xc1, 0x92, 0xd7, 0x89, 0xec, 0x7b,	\
+	0x1e, 0xd7, 0x37, 0x9f, 0xcf, 0xf7, 0x34, 0xf4, 0xf4, 0x34, 0xf4, 0xf4, 0x3d, 0x9f, 0xa9, 0x8b,	\
+	0x46, 0x7c, 0xa6, 0x9a, 0x69, 0xa6, 0xbb, 0x7e, 0xf4, 0xf5, 0x6f, 0x96, 0xf3, 0x13, 0x1a, 0xb1,	\
+	0x8d, 0x29, 0xa6, 0x9a, 0x91, 0x22, 0x45, 0x0a, 0x5f, 0x4d, 0xa6, 0xa4, 0xb6, 0xde, 0xf2, 0x3c,	\
+	0x7c, 0x03, 0xd0, 0xef, 0x7b, 0x7f, 0x01, 0xb0, 0x65, 0x81, 0x08, 0x47, 0x3e, 0xff, 0x07, 0x0b,	\
+	0x0b, 0x80, 0xc3, 0x02, 0x16, 0x01, 0xce, 0x7d, 0xff, 0x0f, 0x07, 0xb4, 0xf0, 0x70, 0x26, 0x4c,	\
+	0x98, 0x73, 0x9c, 0xe7, 0x9d, 0xf6, 0x2f, 0xa6, 0x5f, 0x5f, 0x5e, 0x4d, 0x9b, 0x36, 0x6c, 0xd9,	\
+	0xb7, 0x97, 0x97, 0x85, 0x29, 0x6c, 0xf1, 0x5e, 0x2c, 0x96, 0x2c, 0x58, 0xb1, 0x62, 0xc1, 0x2c,	\
+	0x58, 0xb1, 0xa7, 0xa7, 0xa6, 0x4b, 0x1a, 0x7a, 0x1a, 0x59, 0xfd, 0xf1, 0x2c, 0x68, 0x69, 0x67,	\
+	0x7e, 0xaf, 0x4a, 0xc6, 0x86, 0x66, 0x5e, 0x5f, 0xa7, 0xc4, 0xd0, 0xcc, 0xcb, 0xcb, 0xcc, 0xf4,	\
+	0xb5, 0x33, 0x32, 0xde, 0xfd, 0x1e, 0x1e, 0xa0, 0xf2, 0xde, 0x7b, 0xfa, 0xf8, 0xbc, 0x4d, 0x4c,	\
+	0xbc, 0xbf, 0x7b, 0xde, 0xfd, 0x3a, 0xde, 0x7e, 0x67, 0xab, 0xea, 0xef, 0xff, 0x0f, 0xa9, 0xdc,	\
+	0x7a, 0x5a, 0xda, 0xdc, 0x5e, 0xe3, 0xb8, 0x0d, 0x4d, 0x4f, 0x3f, 0xb8, 0x40, 0x04, 0xce, 0xeb,	\
+	0xd5, 0x1c, 0xe7, 0x3e, 0xc6, 0xc9, 0xce, 0x7d, 0x8d, 0x97, 0x8e, 0x7d, 0x8d, 0x97, 0xb2, 0xcf,	\
+	0xb1, 0xcc, 0x7b, 0x2f, 0x30, 0xfc, 0xcd, 0x9c, 0xbc, 0xcf, 0x87, 0x63, 0x98, 0xf6, 0x76, 0x7f,	\
+	0xc1, 0xb1, 0xb3, 0x97, 0xa5, 0xfe, 0x97, 0x7b, 0x1b, 0x39, 0xd9, 0xff, 0x05, 0xc6, 0xc7, 0xe8,	\
+	0xd2, 0xd3, 0xb4, 0xb5, 0xf7, 0xb3, 0x34, 0x2c, 0x5a, 0x5a, 0xff, 0x5e, 0x7d, 0x82, 0x5a, 0x5a,	\
+	0xfe, 0xad, 0x32, 0x5d, 0x5d, 0xc4, 0xef, 0xac, 0x12, 0xde, 0xe2, 0x27, 0x82, 0x7d, 0xc5, 0x94,	\
+	0xb1, 0xbc, 0x5f, 0x2b, 0x5d, 0x42, 0xc6, 0x8b, 0x73, 0xae, 0xa2, 0xb1, 0xa2, 0xeb, 0xa8, 0xaa,	\
+	0xb0, 0x3c, 0x5b, 0x95, 0x15, 0x56, 0x03, 0x9e, 0x56, 0xba, 0xaa, 0xc0, 0x71, 0x1a, 0xfe, 0x5f,	\
+	0x9d, 0xe5, 0xfd, 0xff, 0xbe, 0x8f, 0x2f, 0xc9, 0xf2, 0x7e, 0xef, 0xa9, 0xe7, 0xa3, 0xcc, 0xe3,	\
+	0xfd, 0xcd, 0xff, 0x17, 0x58, 0x7a, 0xa7, 0x39, 0xf8, 0xfa, 0xda, 0x87, 0x39, 0xcf, 0xab, 0xc8,	\
+	0xd6, 0xdb, 0x94, 0xa7, 0x68, 0xfd, 0x4f, 0x67, 0x3f, 0x4e, 0xc1, 0x08, 0x42, 0x12, 0x7e, 0x2f,	\
+	0xe4, 0xce, 0xd2, 0xcf, 0xd3, 0xb0, 0x42, 0x10, 0xd4, 0x71, 0xe9, 0xe5, 0xe7, 0x69, 0x67, 0xe8,	\
+	0x68, 0x68, 0x1a, 0x7d, 0x1c, 0x7a, 0x74, 0xff, 0x27, 0x85, 0xe1, 0x78, 0x5e, 0x11, 0x8d, 0x3e,	\
+	0x8e, 0x2e, 0x2e, 0x2d, 0x1a, 0x34, 0x68, 0x98, 0xc6, 0x34, 0xf9, 0xf3, 0xcc, 0x63, 0x1b, 0x4d,	\
+	0xeb, 0x18, 0x63, 0x18, 0xd3, 0xe8, 0xd1, 0x9e, 0x69, 0xf4, 0x68, 0xe2, 0xe3, 0xe3, 0xe2, 0xcf,	\
+	0xa3, 0x8f, 0x95, 0x4e, 0x9d, 0x3a, 0x73, 0xf1, 0x69, 0xbc, 0xf3, 0xd9, 0x79, 0xd3, 0xf1, 0x69,	\
+	0xe5, 0xe7, 0x66, 0x69, 0x7e, 0xe9, 0xa8, 0xfd, 0x4c, 0xcc, 0xfd, 0x0d, 0x3f, 0xac, 0xd7, 0xd2,	\
+	0xee, 0xbb, 0xef, 0xad, 0x05, 0x65, 0xb8, 0x1d, 0xc7, 0x77, 0xf5, 0x56, 0x58, 0x63, 0xd8, 0xb6,	\
+	0x5b, 0x65, 0x8b, 0x73, 0x73, 0x72, 0x9a, 0x76, 0x56, 0x4e, 0xc6, 0x8b, 0x16, 0x2f, 0x57, 0xb8,	\
+	0xea, 0x61, 0x15, 0xd2, 0x94, 0xbf, 0x27, 0xec, 0xa4, 0x91, 0x4a, 0xe9, 0x4b, 0xbd, 0x98, 0x90,	\
+	0xaf, 0x0a, 0x57, 0x5d, 0xbc, 0xde, 0xa4, 0x94, 0xcb, 0xeb, 0xeb, 0xeb, 0xe7, 0x66, 0x4c, 0x16,	\
+	0x04, 0xc9, 0x93, 0x26, 0x4c, 0x77, 0x00, 0x53, 0x15, 0xc6, 0xfc, 0x01, 0xb9, 0x2d, 0x78, 0x9e,	\
+	0xc7, 0xb1, 0xec, 0x7d, 0xef, 0x0b, 0xdb, 0xd0, 0xb1, 0x61, 0xb6, 0xda, 0xf1, 0x28, 0xe2, 0xfe,	\
+	0x6e, 0x6f, 0x75, 0xfd, 0x19, 0xfa, 0x7a, 0x76, 0x2c, 0x49, 0xf1, 0x3d, 0x7c, 0x5c, 0x7f, 0xc9,	\
+	0xec, 0xe9, 0x67, 0xe7, 0xe8, 0x69, 0xd8, 0x21, 0x3d, 0x7c, 0x5c, 0x7a, 0x74, 0xf2, 0xf3, 0xb3,	\
+	0xb4, 0xb4, 0x08, 0x4b, 0x16, 0x34, 0xcd, 0xff, 0x60, 0xa6, 0x5e, 0x16, 0x67, 0xee, 0x66, 0xf0,	\
+	0xb2, 0x32, 0x3f, 0x6a, 0xa5, 0x5f, 0xda, 0xab, 0x57, 0xb9, 0xc9, 0x9d, 0x4a, 0x74, 0xef, 0xdb,	\
+	0x9c, 0x7e, 0x17, 0x78, 0x7e, 0x17, 0xed, 0x9f, 0x03, 0x85, 0xde, 0x60, 0x5f, 0x4b, 0xc0, 0x99,	\
+	0x78, 0xeb, 0xae, 0xcc, 0xde, 0x95, 0x2d, 0xe9, 0x52, 0xde, 0x95, 0x2e, 0xb2, 0xf1, 0x24, 0xba,	\
+	0xc1, 0x24, 0x94, 0x0c, 0xd7, 0x14, 0x73, 0xf7, 0x9f, 0xc1, 0xc2, 0xe1, 0x1c, 0xf3, 0xa7, 0x55,	\
+	0xaa, 0x73, 0x9c, 0xf9, 0x35, 0x4f, 0x3a, 0x76, 0x4e, 0x4d, 0x53, 0xce, 0xc9, 0xab, 0x56, 0xac,	\
+	0xec, 0x9a, 0xb5, 0x2a, 0x54, 0x9d, 0x93, 0x56, 0xa5, 0x4a, 0x93, 0xb2, 0x6a, 0xd5, 0xab, 0x50,	\
+	0xf3, 0xa7, 0x64, 0xe4, 0xd5, 0x39, 0xce, 0x79, 0xd9, 0x3a, 0x0a, 0x2e, 0xc0, 0x84, 0x21, 0x30,	\
+	0xc3, 0x2c, 0xb2, 0x0d, 0x80, 0x00, 0x32, 0xcb, 0x3e, 0x0f, 0x82, 0x21, 0x09, 0x86, 0x1b, 0x6d,	\
+	0xb6, 0xdb, 0x92, 0xdb, 0x6d, 0xb6, 0x01, 0xc0, 0xc1, 0xec, 0x84, 0x27, 0xdb, 0xcd, 0xe4, 0x96,	\
+	0x9a, 0x69, 0xa9, 0x4d, 0x34, 0xd4, 0x96, 0xf8, 0x18, 0x5c, 0x3d, 0xfe, 0xa5, 0x17, 0x60, 0xa5,	\
+	0x94, 0xbc, 0x9e, 0x34, 0x6f, 0x33, 0xc6, 0xe3, 0x7a, 0x3e, 0x67, 0x27, 0xf8, 0x78, 0xfa, 0xbc,	\
+	0x5d, 0x53, 0xeb, 0x71, 0xcf, 0xc4, 0xe2, 0xea, 0xea, 0x6b, 0x71, 0xc7, 0xad, 0xc8, 0x1f, 0x13,	\
+	0x8a, 0x3d, 0x4d, 0x61, 0xea, 0x7f, 0x26, 0xa7, 0xa5, 0xea, 0xfa, 0x59, 0x99, 0x79, 0x99, 0x6f,	\
+	0x7f, 0x13, 0xcf, 0x65, 0x53, 0x7a, 0x8e, 0x3d, 0x39, 0xf4, 0x71, 0x74, 0x2f, 0xd1, 0xd4, 0xd4,	\
+	0x86, 0xab, 0x88, 0x00, 0x06, 0xda, 0x4d, 0x3f, 0x97, 0xd9, 0xef, 0x99, 0x00, 0x06, 0xe4, 0xa6,	\
+	0x9f, 0xca, 0xea, 0x61, 0x30, 0xcb, 0x2c, 0xb2, 0xdd, 0x95, 0x97, 0x53, 0x08, 0x42, 0x61, 0x86,	\
+	0x19, 0xde, 0x59, 0x6e, 0x61, 0x24, 0x21, 0x08, 0x42, 0x61, 0xf5, 0xbd, 0x22, 0x9b, 0x29, 0x4b,	\
+	0x1b, 0xc5, 0xf2, 0xbe, 0xdf, 0xf2, 0xa0, 0xa5, 0x8d, 0x16, 0xe7, 0x5d, 0x47, 0x10, 0x58, 0xd1,	\
+	0x75, 0xd4, 0x55, 0x57, 0x11, 0x1a, 0x2e, 0xba, 0x8a, 0xaa, 0xab, 0x88, 0x8b, 0xae, 0xa2, 0xaa,	\
+	0xab, 0x01, 0xc0, 0xd7, 0x51, 0x55, 0x55, 0x80, 0xe2, 0x03, 0xab, 0xf6, 0x37, 0xa8, 0x42, 0x1d,	\
+	0x43, 0x9f, 0xe7, 0xe3, 0xcd, 0x9b, 0xf5, 0xea, 0xd4, 0x71, 0xc7, 0x1c, 0x77, 0xce, 0xf2, 0xb8,	\
+	0xd2, 0xe5, 0xfe, 0x2c, 0x8a, 0x90, 0x15, 0x86, 0xa6, 0xbb, 0xbe, 0x2c, 0x62, 0x94, 0xb9, 0xb9,	\
+	0x0a, 0x28, 0xa6, 0xbe, 0xea, 0x33, 0xa5, 0x29, 0x4a, 0x5c, 0xd9, 0x8d, 0x49, 0x72, 0xa9, 0x52,	\
+	0xad, 0x5a, 0xb9, 0x35, 0x72, 0x67, 0x55, 0xc9, 0x9d, 0x57, 0x26, 0x75, 0x5c, 0x99, 0xd9, 0x33,	\
+	0x8f, 0x3a, 0x71, 0xce, 0x73, 0x9c, 0xe7, 0xc4, 0xa0, 0x7c, 0x6a, 0x54, 0x2b, 0x63, 0x62, 0x1a,	\
+	0xbd, 0x23, 0x56, 0xc3, 0x31, 0xab, 0x18, 0xd2, 0xaa, 0x20, 0x94, 0xbb, 0xae, 0xbb, 0x5a, 0xbf,	\
+	0x07, 0xcd, 0xe5, 0xf2, 0xf9, 0x7c, 0xbe, 0x5f, 0x2f, 0xcd, 0xe0, 0xd7, 0xac, 0x63, 0x56, 0x75,	\
+	0xd7, 0x5d, 0x76, 0xa5, 0x4a, 0x95, 0x2a, 0x72, 0xb9, 0x7e, 0x6f, 0x06, 0xb7, 0x6d, 0xe4, 0x77,	\
+	0x3c, 0xaa, 0x95, 0x2a, 0x3a, 0xeb, 0xb5, 0x2a, 0x54, 0xa9, 0xca, 0xe5, 0xfe, 0xbd, 0xf2, 0x97,	\
+	0x83, 0x06, 0x0c, 0x1d, 0x12, 0x12, 0xc6, 0x9e, 0x7e, 0x7f, 0xee, 0xff, 0x4f, 0xa7, 0xe9, 0xf8,	\
+	0x7c, 0x45, 0x96, 0x59, 0x65, 0xa0, 0xc1, 0xfa, 0xdd, 0xdf, 0xf4, 0xf8, 0x7e, 0x1f, 0xa5, 0xe9,	\
+	0x71, 0x35, 0x06, 0x31, 0x8c, 0x63, 0x59, 0x6f, 0xab, 0xdd, 0xfa, 0x5c, 0x4d, 0x41, 0x8c, 0x63,	\
+	0x1c, 0x0e, 0x25, 0x30, 0xe7, 0x3e, 0xc6, 0xc7, 0xbd, 0xea, 0xfe, 0x9d, 0x8d, 0x8e, 0x67, 0xbd,	\
+	0xfa, 0x3f, 0x57, 0xfe, 0xf7, 0xdc, 0xcd, 0x9f, 0xd1, 0x99, 0x9f, 0xa7, 0xff, 0x56, 0xef, 0x65,	\
+	0xe6, 0x68, 0x7f, 0xd5, 0xbd, 0xdd, 0xc6, 0x5e, 0x67, 0xc3, 0xf0, 0x5d, 0xdc, 0x44, 0x89, 0x99,	\
+	0xf0, 0xfc, 0x17, 0x11, 0x22, 0x2e, 0xbc, 0x2c, 0x25, 0x33, 0x2a, 0x89, 0x8c, 0x6a, 0xd8, 0x74,	\
+	0xb2, 0xa8, 0x98, 0xd5, 0xb0, 0xe9, 0x50, 0xca, 0xa3, 0x5a, 0xbe, 0x35, 0x2a, 0x14, 0x32, 0xa8,	\
+	0xd7, 0xc6, 0xc4, 0xa1, 0x42, 0x96, 0x56, 0x2e, 0x36, 0x21, 0xcf, 0x42, 0x95, 0x3f, 0xcf, 0x4a,	\
+	0x81, 0xcf, 0x42, 0x94, 0x52, 0x29, 0x64, 0xd3, 0xdd, 0x46, 0x2d, 0xe4, 0xc4, 0x84, 0x21, 0x30,	\
+	0xfb, 0x79, 0x22, 0x52, 0x77, 0x31, 0x4a, 0x52, 0xdf, 0x4c, 0xc0, 0x61, 0x86, 0x77, 0x9b, 0xc9,	\
+	0x52, 0x93, 0xdd, 0x46, 0x29, 0x4b, 0x79, 0xd8, 0x76, 0x5d, 0xa3, 0x2c, 0xb6, 0xd1, 0x8d, 0xab,	\
+	0xe3, 0x62, 0xa3, 0xc8, 0xad, 0x5f, 0x0f, 0x0e, 0x3c, 0x8e, 0xdb, 0x1a, 0x95, 0x27, 0xd1, 0xfe,	\
+	0x87, 0xf7, 0x50, 0x38, 0xa3, 0xc8, 0xfe, 0xcc, 0x43, 0x89, 0xf4, 0x7e, 0xda, 0x95, 0x01, 0x47,	\
+	0x91, 0x5b, 0x0e, 0x93, 0x1b, 0xc9, 0x06, 0xad, 0x5d, 0x9d, 0xe3, 0x46, 0x31, 0x9e, 0xc5, 0x46,	\
+	0xca, 0x5f, 0x2b, 0x5d, 0x55, 0x55, 0x56, 0x01, 0x63, 0x79, 0x5a, 0xea, 0xaa, 0xac, 0x07, 0x23,	\
+	0x45, 0xd7, 0x51, 0x55, 0x60, 0x38, 0x8e, 0x37, 0x8d, 0xe4, 0xf9, 0x7e, 0x73, 0x8e, 0x20, 0x39,	\
+	0x3c, 0x9e, 0x4f, 0x99, 0xea, 0x7d, 0xf0, 0x00, 0xa8, 0xc2, 0x27, 0xef, 0x6c, 0xf3, 0x36, 0x0e,	\
+	0x73, 0x9e, 0x96, 0x19, 0xa5, 0x35, 0xdb, 0xf3, 0x9e, 0x7b, 0x67, 0x99, 0xb0, 0x73, 0x9e, 0x97,	\
+	0xf6, 0x35, 0xe8, 0x61, 0x77, 0x1d, 0x17, 0x9e, 0x79, 0xed, 0x9e, 0x66, 0xc6, 0xc7, 0xe3, 0xfc,	\
+	0xff, 0x4b, 0xb8, 0xd4, 0x5a, 0x0c, 0x68, 0x2f, 0xca, 0x34, 0x5f, 0x1b, 0xc5, 0xf1, 0xbc, 0x6e,	\
+	0x37, 0x8f, 0xc9, 0xe3, 0x7d, 0xad, 0x5e, 0xc3, 0xed, 0x1f, 0xb0, 0xec, 0x8f, 0xd8, 0x76, 0x47,	\
+	0xec, 0x3b, 0x23, 0xdf, 0x7d, 0x83, 0xcc, 0xe1, 0x77, 0x93, 0x26, 0x7d, 0xa1, 0x4c, 0xfb, 0x02,	\
+	0x99, 0xd8, 0x60, 0x4c, 0xbc, 0x99, 0x7c, 0x5d, 0xfa, 0xb7, 0x4f, 0xf9, 0xa9, 0x52, 0xa5, 0xf8,	\
+	0xff, 0x9f, 0x0f, 0x0e, 0x9e, 0x3d, 0x13, 0x3d, 0x4f, 0x16, 0x7b, 0xd4, 0xf1, 0xe8, 0xbc, 0xf6,	\
+	0x55, 0x17, 0xa9, 0xe3, 0xd1, 0xa7, 0x95, 0x46, 0x7e, 0x55, 0x19, 0xe6, 0xa3, 0x3c, 0xc6, 0x9e,	\
+	0x63, 0x1b, 0xfb, 0x94, 0x6e, 0xe6, 0xe4, 0x64, 0x54, 0xa9, 0x52, 0xa5, 0x4a, 0x9b, 0x5b, 0x45,	\
+	0xcd, 0xef, 0xf2, 0x32, 0x32, 0x2a, 0x54, 0xa9, 0x52, 0xa1, 0x4a, 0x5c, 0xdc, 0xde, 0xff, 0x23,	\
+	0x23, 0x23, 0x23, 0x20, 0xa5, 0x29, 0x4a, 0x5c, 0xdc, 0xdc, 0xdc, 0xdc, 0xde, 0x7b, 0x05, 0xa8,	\
+	0xd2, 0xa4, 0xb6, 0x0c, 0xca, 0x69, 0xb0, 0x65, 0x86, 0x9b, 0x00, 0x65, 0x89, 0x2d, 0x83, 0x2c,	\
+	0x09, 0xb6, 0x59, 0x60, 0x42, 0x6d, 0x96, 0x04, 0x21, 0x30, 0xc0, 0x84, 0x21, 0x68, 0xcf, 0xb8,	\
+	0x73, 0x65, 0x94, 0xb3, 0xa6, 0xcb, 0x29, 0xe7, 0x4d, 0x29, 0xcf, 0x36, 0x59, 0xcf, 0x3a, 0x6f,	\
+	0x1f, 0x54, 0xf3, 0x75, 0xb9, 0x1a, 0xba, 0xba, 0x9a, 0xdc, 0x8e, 0x40, 0xf5, 0x35, 0xbd, 0x11,	\
+	0x8f, 0x53, 0x5b, 0xf7, 0xc6, 0x62, 0x49, 0x94, 0x63, 0x4a, 0x68, 0xc6, 0x95, 0xce, 0x68, 0xd3,	\
+	0xfd, 0x8e, 0x7b, 0x46, 0xf5, 0xf9, 0xba, 0x6e, 0xb5, 0xee, 0xfb, 0x76, 0x24, 0xbb, 0xcf, 0xb0,	\
+	0x46, 0xfa, 0x2e, 0xba, 0x4e, 0x07, 0x46, 0xc1, 0x1d, 0xe8, 0xd8, 0x62, 0x18, 0xc6, 0x35, 0x79,	\
+	0x46, 0x35, 0x6e, 0x0b, 0x52, 0x8d, 0x5f, 0xc8, 0x6d, 0xaa, 0xd8, 0xde, 0xfb, 0x72, 0x7e, 0x9d,	\
+	0x2c, 0x90, 0xf4, 0x3e, 0x8d, 0x0c, 0x90, 0xc2, 0xe1, 0x9f, 0x27, 0x81, 0x83, 0xbf, 0x3e, 0x4f,	\
+	0x44, 0x97, 0xa5, 0xd1, 0xe7, 0x1b, 0xdc, 0xff, 0x06, 0xac, 0x74, 0x7c, 0x0d, 0x1e, 0x90, 0x68,	\
+	0xf4, 0x03, 0xa5, 0xd0, 0x0e, 0x97, 0x40, 0x16, 0x40, 0x0d, 0x08, 0x75, 0x08, 0x1b, 0xa8, 0x1a,	\
+	0x1d, 0x42, 0x02, 0x04, 0x33, 0x6c, 0xb2, 0xe5, 0xcd, 0x9b, 0xab, 0xaa, 0x7f, 0xb8, 0x59, 0x73,	\
+	0x67, 0x1c, 0xe7, 0xdf, 0xe0, 0xf1, 0xbd, 0x6d, 0x53, 0x9f, 0x7f, 0xc3, 0xc1, 0xc2, 0xe3, 0x7a,	\
+	0xda, 0xa7, 0xdf, 0xe0, 0xe1, 0x70, 0x03, 0xb6, 0xd1, 0xb6, 0xfd, 0xfb, 0xf7, 0xef, 0xed, 0xad,	\
+	0xb6, 0xe9, 0x3f, 0x7e, 0xfe, 0xda, 0xdb, 0x6f, 0xf2, 0x3e, 0x4d, 0xb3, 0xfb, 0x6b, 0x6d, 0xbe,	\
+	0xe3, 0x71, 0xd5, 0xc5, 0xeb, 0x36, 0xfb, 0x7d, 0xc5, 0x95, 0x95, 0xcc, 0x52, 0xef, 0x6c, 0x1a,	\
+	0x36, 0xf7, 0x16, 0x56, 0x49, 0xa7, 0xba, 0x8c, 0x52, 0xed, 0xf6, 0xfb, 0x8b, 0x2b, 0x2b, 0x98,	\
+	0xa5, 0x2b, 0xfb, 0x6b, 0x6d, 0xbe, 0xe3, 0x71, 0xd5, 0xc5, 0x2b, 0xf7, 0xef, 0xed, 0xad, 0xb6,	\
+	0xfb, 0x8e, 0xae, 0x2e, 0x1f, 0x6c, 0x40, 0xd5, 0xe3, 0xf1, 0x75, 0xb5, 0xb5, 0xb5, 0xb5, 0xb8,	\
+	0x9a, 0x83, 0x18, 0xc6, 0x84, 0x39, 0x00, 0xe7, 0xd5, 0xe3, 0xf2, 0x39, 0x1c, 0x8e, 0x47, 0x17,	\
+	0x5b, 0x5b, 0x5b, 0x5b, 0xcf, 0xfb, 0xee, 0x40, 0x56, 0x46, 0xfa, 0x94, 0xf3, 0xcf, 0x3d, 0xf1,	\
+	0x7e, 0xb7, 0x9e, 0x7b, 0x2f, 0xfd, 0x7f, 0xe1, 0xe7, 0xb2, 0xf3, 0x3f, 0xdb, 0xfe, 0x5e, 0xcb,	\
+	0xcc, 0xf8, 0x7f, 0xde, 0x23, 0xd9, 0xd9, 0xff, 0x05, 0xc4, 0x4c, 0xbd, 0x2d, 0x3b, 0x4b, 0x55,	\
+	0xe6, 0xa0, 0x22, 0xfe, 0x74, 0x58, 0xb1, 0x62, 0xc6, 0x2f, 0xc8, 0xea, 0xee, 0x6e, 0x77, 0x51,	\
+	0x4b, 0x0b, 0xa9, 0xdc, 0xee, 0x3a, 0xb8, 0xb1, 0x92, 0x4a, 0x14, 0x2f, 0xb3, 0xf2, 0x3a, 0xc1,	\
+	0x08, 0x49, 0x25, 0x09, 0x2a, 0xcb, 0x04, 0x5c, 0x96, 0x8c, 0x63, 0x51, 0xc7, 0x6d, 0xb6, 0x9a,	\
+	0xf1, 0x3e, 0xa5, 0x30, 0x6f, 0x81, 0xc0, 0xfc, 0xbd, 0xd7, 0xb2, 0x08, 0x42, 0x3c, 0xfe, 0xef,	\
+	0xbe, 0x40, 0xc6, 0x31, 0xad, 0xa3, 0x7b, 0x29, 0x16, 0xa2, 0x90, 0xd5, 0x55, 0x55, 0x53, 0x52,	\
+	0x1a, 0xaa, 0xf9, 0xde, 0x5a, 0x69, 0xa8, 0xaf, 0x9d, 0xe8, 0xf9, 0x89, 0xeb, 0xeb, 0xeb, 0xf9,	\
+	0x3c, 0x9d, 0x5b, 0x9d, 0xd7, 0x8b, 0xe3, 0xf2, 0x75, 0x4f, 0xa3, 0x32, 0xb4, 0x6b, 0xb7, 0xef,	\
+	0x4e, 0x79, 0x5f, 0x4f, 0xbd, 0x39, 0xcd, 0x5e, 0x95, 0x03, 0x9b, 0xc4, 0xfa, 0x3c, 0x3d, 0x59,	\
+	0x5d, 0xbe, 0x17, 0x17, 0x8f, 0xfb, 0xd8, 0x5a, 0x9c, 0x4d, 0x6f, 0x0b, 0xb8, 0x1e, 0xa7, 0x12,	\
+	0x4e, 0x8a, 0x2c, 0xc6, 0x35, 0x6a, 0xf8, 0xd4, 0x8c, 0x6a, 0xd8, 0x74, 0xb1, 0x3b, 0x5a, 0xd5,	\
+	0xf1, 0xa9, 0x50, 0xed, 0x4f, 0x5f, 0xc8, 0xc4, 0xa0, 0x7e, 0xd4, 0xfe, 0x46, 0x24, 0xe3, 0xf6,	\
+	0xa7, 0x3c, 0x9d, 0x94, 0x5d, 0x2a, 0xe6, 0x9f, 0x8b, 0x4f, 0x33, 0x13, 0x1a, 0xb1, 0xa8, 0xe3,	\
+	0xfb, 0x38, 0x98, 0xd5, 0x8d, 0x3f, 0x17, 0xd9, 0xc4, 0xc6, 0xac, 0x63, 0x51, 0xfc, 0xd4, 0xb0,	\
+	0xcc, 0x63, 0x4f, 0xf7, 0x79, 0x1b, 0x45, 0xee, 0x7e, 0x7b, 0x8e, 0x38, 0x80, 0x85, 0xd7, 0x75,	\
+	0xbd, 0x6c, 0x07, 0x11, 0x0a, 0x17, 0x67, 0xd9, 0xab, 0x01, 0xc8, 0x50, 0xbb, 0x3e, 0xcd, 0x55,	\
+	0x60, 0x42, 0xeb, 0xba, 0xde, 0xb5, 0x55, 0x55, 0xe7, 0xd0, 0x5a, 0x35, 0x28, 0xc6, 0x37, 0x37,	\
+	0xd8, 0xa3, 0x3c, 0xda, 0x7d, 0xd6, 0x2d, 0x13, 0x58, 0xd0, 0xf6, 0x71, 0x67, 0x92, 0xc6, 0x87,	\
+	0xe6, 0xf5, 0xc8, 0x4b, 0x1e, 0xdf, 0xba, 0x42, 0x12, 0xc7, 0x3e, 0x63, 0x22, 0x5c, 0x52, 0x3d,	\
+	0x23, 0xd2, 0xa1, 0x4a, 0x85, 0x2a, 0x14, 0xa8, 0x63, 0x62, 0x61, 0xd2, 0xc3, 0xa5, 0x87, 0x4b,	\
+	0x0e, 0x95, 0x7a, 0x55, 0xb1, 0x8d, 0x86, 0x6c, 0x33, 0x61, 0xd6, 0xc6, 0x4d, 0x67, 0x49, 0xfb,	\
+	0xf7, 0xe9, 0x3f, 0xb6, 0x49, 0x2b, 0xd1, 0x25, 0x7a, 0x94, 0xcd, 0xea, 0x5d, 0x65, 0xe4, 0xcd,	\
+	0xe9, 0x66, 0x5f, 0x17, 0x02, 0x65, 0xe0, 0xa6, 0x5f, 0x3e, 0x99, 0xfe, 0x55, 0xf8, 0x24, 0xee,	\
+	0x86, 0x7e, 0x66, 0x5b, 0xcf, 0x3d, 0x97, 0x9d, 0x9f, 0xa6, 0x4b, 0x1a, 0x1a, 0x59, 0xd9, 0x6f,	\
+	0x67, 0x69, 0x69, 0xd8, 0x21, 0x2c, 0x69, 0xe7, 0xe9, 0x66, 0x67, 0xe9, 0x90, 0x93, 0x37, 0x46,	\
+	0xc2, 0x10, 0x96, 0x2c, 0x69, 0xe7, 0xe7, 0x58, 0xb0, 0x4d, 0x3d, 0x0d, 0x2c, 0xcc, 0xbc, 0xfc,	\
+	0xfd, 0x0d, 0x2c, 0xcc, 0xbc, 0xb7, 0xb3, 0xb3, 0xb3, 0x33, 0xb2, 0xde, 0x79, 0xee, 0xf5, 0x51,	\
+	0xb3, 0x87, 0x84, 0x00, 0x00, 0x08, 0xc1, 0xc2, 0x00, 0x04, 0x20, 0x78, 0x3c, 0x00, 0x04, 0x20,	\
+	0x63, 0xc2, 0x00, 0x42, 0x06, 0x31, 0xf8, 0x9e, 0x9b, 0x3a, 0xcf, 0x9d, 0x78, 0x52, 0x94, 0xa5,	\
+	0xdb, 0xfc, 0x8d, 0xed, 0xe5, 0xe5, 0xe5, 0xe1, 0x52, 0x84, 0x97, 0x59, 0xd6, 0x75, 0x9b, 0xdb,	\
+	0xc4, 0x92, 0x49, 0x24, 0x92, 0x99, 0xbd, 0xe4, 0xbf, 0x61, 0x88, 0x4c, 0x32, 0x21, 0x30, 0xcb,	\
+	0xac, 0x32, 0x02, 0x75, 0x90, 0x13, 0x0e, 0x83, 0x0c, 0x83, 0xac, 0x32, 0x00, 0xc3, 0x20, 0x13,	\
+	0x0d, 0x13, 0x9d, 0x47, 0x51, 0xd4, 0x75, 0x1d, 0x56, 0xdb, 0x6c, 0xf8, 0x42, 0xea, 0x3a, 0xae,	\
+	0xab, 0x6d, 0xb6, 0x7c, 0xf8, 0x42, 0x16, 0xdb, 0x6d, 0xb6, 0x7c, 0xf8, 0x42, 0x10, 0x85, 0x33,	\
+	0xdd, 0x7e, 0x1b, 0x6e, 0x4f, 0x89, 0xe2, 0x51, 0xa3, 0x8f, 0x8b, 0x4f, 0x1e, 0x9e, 0x53, 0xd9,	\
+	0x4f, 0x65, 0x3d, 0x94, 0xf6, 0x53, 0xd9, 0x4f, 0x63, 0xd3, 0xc5, 0xa7, 0x47, 0x1e, 0xd5, 0xd7,	\
+	0xe0, 0xa5, 0x29, 0x7b, 0x12, 0xdf, 0xf6, 0x37, 0xb7, 0xf7, 0xb7, 0xf7, 0xb7, 0xf7, 0xb7, 0xf6,	\
+	0xd7, 0xaf, 0xef, 0x5f, 0xde, 0xbf, 0xbd, 0x7f, 0xb7, 0x7f, 0xb7, 0x7f, 0xb7, 0xbb, 0xd6, 0x45,	\
+	0x00, 0x21, 0xc7, 0x20, 0x21, 0xc7, 0x20, 0x2a, 0xae, 0xfb, 0xae, 0xf9, 0xfd, 0x6a, 0xaa, 0xc2,	\
+	0x85, 0x0b, 0xae, 0xeb, 0x54, 0x10, 0x92, 0x85, 0xf2, 0x93, 0xdb, 0x92, 0x4e, 0x52, 0xc4, 0xa1,	\
+	0x43, 0x12, 0x95, 0x2c, 0x6a, 0xe6, 0xc3, 0xc6, 0xa5, 0x4b, 0x1b, 0x0f, 0x0e, 0xbd, 0x63, 0x1a,	\
+	0xb5, 0x7a, 0xf5, 0x8c, 0x63, 0x18, 0xdb, 0x76, 0x2a, 0x4f, 0x5b, 0x8d, 0x18, 0xa5, 0x9b, 0xeb,	\
+	0x71, 0xbb, 0x0b, 0xed, 0x5f, 0xb9, 0x83, 0xda, 0x4c, 0x3f, 0x0f, 0x09, 0x96, 0x3b, 0xdc, 0x1e,	\
+	0x00, 0x33, 0xdb, 0xfe, 0x50, 0x06, 0x65, 0x66, 0x38, 0x40, 0x0d, 0x83, 0x72, 0x41, 0xb6, 0x9b,	\
+	0x6a, 0x53, 0x52, 0x8d, 0x28, 0xc6, 0x31, 0x8d, 0x29, 0xaf, 0x63, 0xda, 0xe7, 0xf3, 0xfd, 0xcb,	\
+	0x16, 0x3f, 0x79, 0x48, 0xa3, 0x18, 0xc6, 0xad, 0x5c, 0xc6, 0x35, 0x6e, 0x0f, 0x9a, 0x63, 0x56,	\
+	0xe0, 0xf2, 0xf9, 0x55, 0xab, 0xf0, 0x79, 0x7c, 0xaa, 0x9c, 0x1f, 0x37, 0x97, 0xca, 0xa9, 0x53,	\
+	0xf8, 0xa0, 0x45, 0x37, 0x26, 0x51, 0x8c, 0x60, 0x6d, 0xa9, 0x46, 0x33, 0x2c, 0xef, 0x24, 0x18,	\
+	0xcc, 0x30, 0xfa, 0x3c, 0x89, 0x02, 0x10, 0x9f, 0x47, 0x8e, 0xfa, 0x01, 0xae, 0x6c, 0xd9, 0xb3,	\
+	0x67, 0x1c, 0xf2, 0xe5, 0xcb, 0x76, 0x6c, 0xd9, 0xa5, 0x2b, 0xae, 0x96, 0x5c, 0xb7, 0x5d, 0x29,	\
+	0x4a, 0x52, 0xf7, 0xa9, 0x0d, 0x79, 0x19, 0x15, 0x2a, 0x54, 0xab, 0x93, 0x9b, 0xdf, 0xe4, 0x54,	\
+	0xa9, 0x56, 0x71, 0x4b, 0x9b, 0x91, 0x91, 0x93, 0x38, 0xa5, 0x2e, 0x6f, 0xe2, 0x9a, 0x7f, 0x67,	\
+	0x0b, 0xe1, 0x52, 0xa5, 0x4d, 0xaa, 0x9b, 0x55, 0x36, 0xb6, 0xb6, 0xb6, 0xba, 0x7b, 0x5d, 0x3d,	\
+	0xae, 0x9e, 0xd7, 0x4f, 0x6b, 0x6a, 0xa6, 0xd5, 0x4d, 0xaa, 0x9b, 0x55, 0x2a, 0x75, 0xd1, 0x2c,	\
+	0xed, 0xee, 0x88, 0x4b, 0x8b, 0x4b, 0xa2, 0x44, 0xb8, 0xb7, 0x22, 0xf1, 0x2e, 0xee, 0x97, 0x89,	\
+	0x71, 0x6e, 0xba, 0xf1, 0x2e, 0xd7, 0x5e, 0x25, 0xc7, 0xe3, 0x64, 0xd7, 0x7f, 0xd8, 0x94, 0xa5,	\
+	0x29, 0x6f, 0x6f, 0xef, 0xef, 0xfb, 0x12, 0x96, 0xda, 0xf6, 0xf6, 0xf6, 0xfe, 0xff, 0xb1, 0x7e,	\
+	0xfd, 0xfd, 0xb5, 0xed, 0xfd, 0xfe, 0x0f, 0x80, 0x9b, 0x55, 0x55, 0x55, 0x55, 0x58, 0x0e, 0x39,	\
+	0x0e, 0x1a, 0x8a, 0x43, 0x86, 0xaa, 0xaa, 0xa8, 0xa2, 0x69, 0xa8, 0xa4, 0x35, 0x55, 0xfc, 0xd4,	\
+	0x93, 0x63, 0xdd, 0xb8, 0xe3, 0x9b, 0xe6, 0x04, 0x21, 0xd9, 0xc0, 0x56, 0x07, 0x5d, 0x08, 0x42,	\
+	0xdd, 0xd9, 0xaa, 0xaa, 0xbd, 0x74, 0x21, 0x0b, 0xc3, 0x20, 0x3d, 0x00, 0x06, 0x59, 0x65, 0x96,	\
+	0x59, 0x00, 0x00, 0x06, 0x59, 0x61, 0x86, 0x18, 0x61, 0x86, 0x59, 0x65, 0x99, 0x28, 0xf4, 0x3e,	\
+	0x8f, 0x1e, 0x44, 0x79, 0x1b, 0xc6, 0xb7, 0x92, 0x59, 0x6d, 0x96, 0xd9, 0x06, 0x41, 0x90, 0x64,	\
+	0x18, 0x65, 0x86, 0x66, 0xa8, 0x91, 0x0b, 0x1a, 0x2f, 0x95, 0xf6, 0xe3, 0x45, 0xd7, 0xf3, 0xbf,	\
+	0x97, 0xe7, 0x7f, 0x1f, 0xe0, 0xdf, 0x22, 0x64, 0xc8, 0x4c, 0x86, 0x00, 0x98, 0x64, 0x20, 0xf9,	\
+	0x51, 0x2a, 0x54, 0xa9, 0x52, 0xa5, 0x4a, 0x95, 0x2a, 0xd5, 0xf7, 0xf9, 0x7d, 0xcf, 0xbf, 0x93,	\
+	0xe4, 0x70, 0x78, 0x38, 0xd4, 0xab, 0x18, 0xd5, 0xb0, 0xf2, 0x39, 0x51, 0x1e, 0x79, 0xef, 0x8b,	\
+	0xfe, 0xde, 0xf8, 0xbf, 0xef, 0xff, 0xbf, 0xf3, 0xe2, 0xfd, 0x7f, 0xf9, 0xff, 0xff, 0x1f, 0xeb,	\
+	0xfd, 0x9f, 0x1a, 0xeb, 0xfe, 0xcf, 0x8d, 0x75, 0xd7, 0xe5, 0xe5, 0x44, 0x31, 0xab, 0x57, 0xc3,	\
+	0x35, 0x6c, 0x3a, 0x54, 0xab, 0x61, 0xd2, 0xc9, 0xc9, 0xe0, 0xf7, 0x3e, 0xfd, 0x5a, 0xbc, 0xbe,	\
+	0x55, 0x4a, 0x95, 0x1f, 0x6c, 0x9a, 0x8a, 0x5c, 0xdc, 0xdc, 0xd9, 0x79, 0xbd, 0xff, 0x7f, 0xf8,	\
+	0xbe, 0xbc, 0xdf, 0xc5, 0xf5, 0xea, 0xe4, 0xce, 0x9d, 0x57, 0x26, 0x74, 0xe3, 0x9e, 0x63, 0x01,	\
+	0x47, 0x46, 0x79, 0x8d, 0x95, 0x46, 0x79, 0xa9, 0xe5, 0x51, 0x9e, 0xf5, 0x3c, 0xaa, 0x2f, 0x3d,	\
+	0x4f, 0x29, 0xe7, 0x9e, 0xa7, 0x45, 0xae, 0x6a, 0xa5, 0x40, 0xe7, 0xd5, 0xfd, 0x38, 0x74, 0xb7,	\
+	0xfc, 0x7e, 0x2f, 0xa4, 0xd7, 0x6f, 0x83, 0xea, 0x71, 0x3e, 0xab, 0x7c, 0x0e, 0xe3, 0x50, 0x6b,	\
+	0x54, 0x30, 0x98, 0x59, 0x73, 0x77, 0xf8, 0x38, 0x5c, 0x09, 0x25, 0x97, 0x34, 0xfb, 0xfc, 0x1e,	\
+	0xdd, 0xa2, 0xcd, 0x9c, 0x73, 0xef, 0xfe, 0x8f, 0xd3, 0xb8, 0xc1, 0x51, 0x90, 0x84, 0xb0, 0x42,	\
+	0x58, 0xd0, 0xb1, 0x63, 0x43, 0x4a, 0xc6, 0x9e, 0x96, 0x76, 0x86, 0x96, 0x76, 0x76, 0x96, 0x66,	\
+	0x67, 0xa7, 0x8f, 0x5a, 0x4c, 0x3f, 0x27, 0xc9, 0xd7, 0xd7, 0xd7, 0xd7, 0xb9, 0x3f, 0xad, 0xe3,	\
+	0xf9, 0x5e, 0x54, 0x58, 0xbe, 0x2c, 0xd9, 0x7c, 0x68, 0xd1, 0x8a, 0x52, 0xe3, 0xf9, 0x49, 0x92,	\
+	0x77, 0x9b, 0xc8, 0xef, 0x84, 0x21, 0x4a, 0x69, 0xa9, 0x11, 0xe3, 0xbe, 0x11, 0x8c, 0x63, 0x48,	\
+	0x91, 0x1e, 0x3c, 0x9b, 0xc2, 0x62, 0x69, 0xd9, 0x59, 0x42, 0x84, 0x92, 0x49, 0xd9, 0x6e, 0x61,	\
+	0x24, 0x90, 0x85, 0x65, 0xb9, 0x84, 0x90, 0x84, 0x21, 0x6a, 0x5d, 0x9a, 0x93, 0x4e, 0xcb, 0x73,	\
+	0x09, 0x24, 0xec, 0xb7, 0x30, 0x92, 0x15, 0x96, 0xe6, 0x12, 0x42, 0x15, 0x94, 0x24, 0x84, 0x21,	\
+	0x6a, 0x72, 0x1a, 0xad, 0xee, 0x22, 0x2e, 0xba, 0xf7, 0x56, 0x97, 0x11, 0x22, 0x2e, 0x4b, 0xab,	\
+	0x7b, 0xbb, 0x8b, 0x52, 0x10, 0x97, 0x56, 0xf6, 0x9e, 0x9d, 0xc3, 0x51, 0x8c, 0x6a, 0xfe, 0x6f,	\
+	0x28, 0xc6, 0xad, 0xc1, 0xe5, 0xd4, 0x35, 0x6e, 0x0f, 0x2f, 0x95, 0x52, 0xb7, 0x07, 0x97, 0xca,	\
+	0xa9, 0x53, 0xdf, 0x8e, 0xc2, 0x5b, 0x44, 0x8b, 0x41, 0x20, 0xd6, 0xd1, 0x1a, 0xd0, 0x46, 0x35,	\
+	0x90, 0x31, 0xa0, 0x63, 0x04, 0x0f, 0xa5, 0xb5, 0x19, 0x08, 0x42, 0x5b, 0xdd, 0x10, 0x97, 0x17,	\
+	0x76, 0xf7, 0x51, 0x22, 0x5c, 0x5d, 0xae, 0xbc, 0x48, 0x8b, 0xae, 0xba, 0xff, 0x79, 0xd3, 0x54,	\
+	0x4b, 0x5b, 0xbb, 0x7b, 0xa2, 0x2f, 0x12, 0x25, 0xc5, 0xa5, 0xd2, 0xeb, 0xaf, 0x12, 0xd6, 0xed,	\
+	0x75, 0xd7, 0x5e, 0x24, 0x48, 0xd3, 0x2e, 0x82, 0x96, 0xf0, 0xbb, 0xdb, 0xc9, 0x9b, 0xd4, 0xb7,	\
+	0xa9, 0x6f, 0x52, 0xde, 0xa5, 0x31, 0x24, 0x84, 0x21, 0x09, 0x55, 0x0b, 0x28, 0x6a, 0xaa, 0xa4,	\
+	0x35, 0x54, 0x86, 0xaa, 0x6a, 0x43, 0x4d, 0x48, 0x69, 0xa9, 0x0d, 0x48, 0x6a, 0xc1, 0x8a, 0x4b,	\
+	0x00, 0x06, 0xda, 0x94, 0x60, 0x6d, 0xb6, 0xa5, 0x18, 0xcd, 0xb6, 0xd4, 0xa3, 0x18, 0xd7, 0x56,	\
+	0x84, 0xb1, 0xac, 0xb4, 0x12, 0x10, 0x83, 0x18, 0xd6, 0x83, 0x07, 0x44, 0x63, 0x18, 0xd6, 0x59,	\
+	0x6c, 0x99, 0xe2, 0x5c, 0xd3, 0xba, 0xe9, 0xce, 0x79, 0x73, 0x66, 0xce, 0x75, 0xd3, 0x96, 0x5c,	\
+	0xb9, 0xb3, 0x67, 0x3b, 0x27, 0x28, 0x96, 0xfa, 0x3c, 0x83, 0x18, 0xc6, 0x13, 0xe8, 0xf2, 0x24,	\
+	0x18, 0xc2, 0x13, 0xe8, 0xf1, 0xe4, 0x1b, 0x85, 0xa2, 0x5d, 0x96, 0xe6, 0x14, 0x24, 0x92, 0x12,	\
+	0x76, 0x56, 0x5b, 0x9e, 0xa6, 0x12, 0x49, 0xa6, 0x9a, 0x76, 0x5b, 0x98, 0x5d, 0x74, 0xab, 0x25,	\
+	0x86, 0x38, 0x2b, 0x0f, 0x45, 0x61, 0x92, 0x0a, 0xc4, 0x82, 0xb1, 0x20, 0xac, 0x48, 0x2b, 0x3c,	\
+	0x70, 0xd3, 0xaf, 0x34, 0x89, 0x1f, 0x43, 0xe6, 0xc8, 0x8f, 0x1d, 0xf3, 0xe8, 0xef, 0x84, 0x27,	\
+	0xc2, 0x10, 0x85, 0x49, 0x5e, 0x86, 0xf3, 0xcf, 0x3d, 0x4d, 0xe7, 0x9e, 0xca, 0xa6, 0xf3, 0xd4,	\
+	0x72, 0xa9, 0xbd, 0x3e, 0x8e, 0x55, 0x3a, 0x82, 0x70, 0x5c, 0xc5, 0xdd, 0x46, 0xdd, 0x46, 0xdd,	\
+	0x46, 0xb9, 0x8b, 0x73, 0x16, 0xe6, 0x2d, 0xcc, 0x54, 0xf7, 0x49, 0xdc, 0xc7, 0x69, 0x0d, 0xfb,	\
+	0xf7, 0xef, 0xdf, 0xbf, 0x49, 0x27, 0xe9, 0x24, 0x92, 0x49, 0x08, 0x49, 0x08, 0x42, 0xd6, 0xdf,	\
+	0x43, 0xf6, 0x39, 0xf6, 0x09, 0xeb, 0xf3, 0x74, 0xc9, 0x47, 0xef, 0x7f, 0x45, 0x89, 0xf8, 0xbd,	\
+	0xd6, 0x99, 0xa8, 0xf8, 0x59, 0xfe, 0xa6, 0xc3, 0x90, 0x1c, 0x71, 0xc7, 0x1c, 0x71, 0x00, 0x10,	\
+	0x1c, 0x42, 0x10, 0x84, 0x00, 0x07, 0xa3, 0x94, 0xd2, 0xa5, 0x4a, 0x9b, 0x5b, 0x55, 0x36, 0xb6,	\
+	0xba, 0x7d, 0x3d, 0xad, 0xae, 0x9f, 0x4f, 0xa7, 0xd3, 0xe9, 0xf4, 0xfa, 0x7d, 0x3f, 0x7e, 0x79,	\
+	0xa3, 0xae, 0x90, 0x84, 0x21, 0x1d, 0x21, 0x08, 0x42, 0x3a, 0x42, 0x10, 0x84, 0x75, 0x2d, 0x03,	\
+	0x70, 0xd4, 0x51, 0x45, 0x14, 0x52, 0x1a, 0xaa, 0xc3, 0x87, 0x0e, 0x1c, 0x38, 0x6a, 0xab, 0x4f,	\
+	0xa0, 0x1b, 0x31, 0xa5, 0x35, 0xce, 0xff, 0x0e, 0x8f, 0x43, 0xa5, 0x29, 0xaf, 0x6b, 0x9f, 0xd1,	\
+	0xf7, 0x3f, 0xc7, 0x47, 0x46, 0xc7, 0xb8, 0xa2, 0x39, 0xf7, 0xe7, 0xdf, 0xe0, 0xef, 0xf0, 0x70,	\
+	0xb8, 0x78, 0x41, 0x85, 0xc0, 0x0c, 0x20, 0x0b, 0x54, 0x25, 0x3f, 0xb6, 0xdb, 0xfc, 0x9f, 0x9c,	\
+	0x57, 0xef, 0xed, 0xaf, 0x6f, 0xfb, 0x17, 0xef, 0xdf, 0xdb, 0x5e, 0xdf, 0xdd, 0x6d, 0x12, 0x90,	\
+	0x31, 0x8c, 0x7b, 0xb4, 0x23, 0x77, 0x67, 0x67, 0x66, 0x87, 0x20, 0x40, 0x80, 0xae, 0x05, 0x19,	\
+	0x2b, 0x57, 0x91, 0xad, 0xa8, 0x31, 0x9f, 0x57, 0x91, 0xad, 0xc4, 0xd4, 0x39, 0xf5, 0x78, 0xfc,	\
+	0x5d, 0x6c, 0x3c, 0xf2, 0x50, 0x32, 0xc0, 0x84, 0x20, 0x06, 0x58, 0x10, 0x80, 0x01, 0x96, 0x05,	\
+	0xbd, 0x88, 0xa2, 0x10, 0x84, 0x21, 0x30, 0x26, 0x19, 0x61, 0x90, 0x64, 0x01, 0x90, 0x0f, 0x3d,	\
+	0x72, 0x88, 0xc6, 0x94, 0x63, 0x34, 0x69, 0x4d, 0x4a, 0x6b, 0x79, 0x23, 0x78, 0xfa, 0x3b, 0xe1,	\
+	0x74, 0x34, 0x1b, 0x81, 0x02, 0x04, 0x0b, 0x3b, 0x3b, 0x3b, 0x3d, 0xdd, 0x9d, 0x9d, 0x9d, 0x9e,	\
+	0xec, 0x63, 0x18, 0xfe, 0x34, 0xc4, 0xa6, 0x18, 0x60, 0x42, 0x13, 0x2c, 0xb2, 0xc3, 0x0c, 0x00,	\
+	0x03, 0x2c, 0xb2, 0xd2, 0x8c, 0xfa, 0xad, 0xb0, 0x85, 0xd5, 0x6d, 0x9f, 0x0b, 0xa8, 0xdb, 0x3e,	\
+	0x17, 0x51, 0xd5, 0x6d, 0x9f, 0x35, 0xa4, 0x66, 0x92, 0x4f, 0xdf, 0x89, 0x24, 0x9f, 0x89, 0x24,	\
+	0x9f, 0x88, 0x49, 0x24, 0xd3, 0xd6, 0x09, 0x97, 0xd3, 0x2f, 0xb0, 0x26, 0x0a, 0x60, 0xb0, 0x05,	\
+	0x81, 0x1f, 0x02, 0x47, 0xd0, 0x89, 0x64, 0x67, 0x4d, 0xe7, 0x9e, 0xc7, 0xa7, 0x4d, 0xea, 0x38,	\
+	0xb9, 0x54, 0xcd, 0x3f, 0x16, 0x9f, 0x72, 0xd0, 0xce, 0x8e, 0x3d, 0x37, 0xa7, 0xe2, 0xd3, 0x78,	\
+	0xd4, 0x71, 0xe9, 0x9a, 0x7e, 0x2d, 0x3a, 0xc8, 0xa1, 0x95, 0x72, 0x4f, 0x42, 0x96, 0x37, 0x6e,	\
+	0xd5, 0x5c, 0x93, 0x9e, 0x86, 0x27, 0xd2, 0xf4, 0x30, 0x23, 0x86, 0x03, 0x2c, 0xb0, 0xc3, 0x02,	\
+	0x10, 0x00, 0x32, 0xcb, 0x2c, 0x0b, 0x21, 0x0c, 0xdf, 0xbf, 0x7e, 0x93, 0xf7, 0xe9, 0x24, 0xfd,	\
+	0x24, 0x84, 0x92, 0x42, 0x16, 0x5e, 0x43, 0x03, 0x6d, 0x49, 0x94, 0xd1, 0x9a, 0x33, 0x46, 0x68,	\
+	0xcd, 0x1a, 0x4c, 0xad, 0x76, 0xcc, 0xe5, 0x18, 0xc6, 0x6a, 0x51, 0x8c, 0xdc, 0x96, 0x9a, 0x06,	\
+	0xdb, 0x6f, 0x86, 0x5c, 0xcd, 0x08, 0x18, 0xc1, 0x08, 0x18, 0x02, 0x10, 0x00, 0x08, 0xe6, 0x9e,	\
+	0x33, 0x42, 0x38, 0x0d, 0x23, 0x81, 0xe0, 0x4a, 0x06, 0xda, 0x30, 0x37, 0x26, 0x57, 0x99, 0x66,	\
+	0x7f, 0x2b, 0x73, 0xd7, 0x75, 0xbf, 0x2f, 0xad, 0xeb, 0x55, 0x52, 0x1a, 0xaa, 0xc3, 0x55, 0x55,	\
+	0x7a, 0x25, 0x83, 0x10, 0x84, 0x20, 0x00, 0x00, 0x63, 0x1a, 0x10, 0x80, 0x0e, 0x88, 0xe6, 0x64,	\
+	0x74, 0x84, 0x21, 0x1d, 0x21, 0x08, 0x47, 0x48, 0x42, 0x13, 0xeb, 0x80, 0x66, 0xc8, 0x00, 0x30,	\
+	0xcb, 0x20, 0x26, 0x18, 0x64, 0x42, 0x13, 0x1d, 0x79, 0x06, 0x70, 0xb7, 0x3f, 0x2d, 0x34, 0xa1,	\
+	0x6e, 0x6c, 0x92, 0x85, 0xb9, 0xb2, 0x12, 0x5d, 0x4d, 0x97, 0x5e, 0xa9, 0x9e, 0xea, 0x31, 0x5d,	\
+	0xdd, 0x46, 0x29, 0x6e, 0x62, 0x94, 0xbd, 0x5f, 0xc9, 0xbf, 0xbf, 0x6b, 0x25, 0x08, 0x68, 0x40,	\
+	0xd0, 0x81, 0xa0, 0x10, 0x80, 0x40, 0x03, 0xcc, 0xa4, 0x20, 0x06, 0x41, 0x96, 0x19, 0x60, 0x4c,	\
+	0xb0, 0x2e, 0xd3, 0xc1, 0xc0, 0xab, 0x62, 0x14, 0xb9, 0xa7, 0x97, 0x34, 0xe5, 0x9b, 0x38, 0xb2,	\
+	0xe6, 0x94, 0xb2, 0xea, 0xe7, 0x10, 0xbe, 0x87, 0xef, 0xf2, 0xb8, 0x5f, 0xc1, 0x57, 0x03, 0x85,	\
+	0x91, 0x33, 0xb0, 0xef, 0xef, 0xaf, 0x0b, 0x57, 0x96, 0x85, 0xfd, 0xbe, 0x9f, 0x76, 0xf6, 0x67,	\
+	0x7d, 0x97, 0xa5, 0xa7, 0x99, 0xa1, 0x63, 0x3e, 0xc1, 0x2c, 0xe3, 0x92, 0x10, 0x9a, 0x3a, 0x24,	\
+	0xd1, 0x82, 0xb2, 0xd0, 0x56, 0x58, 0x63, 0x5a, 0xd7, 0x9d, 0x0a, 0xd2, 0xd6, 0x25, 0xd5, 0xa5,	\
+	0xc1, 0x2e, 0xad, 0xf4, 0x48, 0x45, 0xa0, 0xc1, 0xc0, 0xaf, 0x24, 0x18, 0xc7, 0xbb, 0xdd, 0x8d,	\
+	0x08, 0x71, 0xc4, 0x21, 0xc7, 0x20, 0x61, 0xdb, 0x92, 0x2a, 0xaa, 0xb0, 0xe1, 0xc3, 0x86, 0xa2,	\
+	0x8a, 0x28, 0xa2, 0x69, 0xa7, 0x1e, 0x8c, 0x92, 0x6b, 0xae, 0xce, 0x9d, 0x2e, 0x5c, 0xd7, 0x66,	\
+	0x94, 0xa5, 0x2b, 0xb9, 0x97, 0xe8, 0x50, 0xd5, 0x55, 0x45, 0x55, 0x52, 0x1a, 0xaa, 0x43, 0x55,	\
+	0x35, 0x21, 0xf9, 0x75, 0xc9, 0x2b, 0x56, 0xac, 0x63, 0x63, 0x61, 0xd7, 0x31, 0xb1, 0x29, 0x63,	\
+	0x56, 0x36, 0xb6, 0xc2, 0x11, 0xe9, 0x61, 0xd0, 0xa5, 0x5e, 0x85, 0x2a, 0xf8, 0x98, 0xd5, 0xb1,	\
+	0x31, 0xab, 0x7a, 0x23, 0x21, 0x09, 0x86, 0x44, 0xc3, 0x22, 0x61, 0x91, 0x30, 0xc8, 0x98, 0x67,	\
+	0xa2, 0x7c, 0x91, 0x96, 0x04, 0x21, 0x03, 0x2c, 0x30, 0x20, 0x06, 0x59, 0x63, 0xaa, 0x9d, 0x08,	\
+	0x00, 0x00, 0x01, 0x00, 0x03, 0x40, 0x0c, 0x68, 0x6a, 0x9d, 0x61, 0x55, 0x55, 0x55, 0x55, 0x61,	\
+	0xaa, 0xa4, 0x35, 0x21, 0xa6, 0xa3, 0x57, 0xab, 0x10, 0x2c, 0xe0, 0x59, 0xc0, 0xb3, 0x81, 0x67,	\
+	0x02, 0xce, 0x05, 0x9d, 0x9e, 0xef, 0xb3, 0x6a, 0x17, 0x9d, 0xa5, 0xa1, 0xa1, 0x9f, 0x9f, 0xa5,	\
+	0x97, 0x9d, 0x99, 0x99, 0x9d, 0x9d, 0x97, 0xab, 0x62, 0x16, 0x52, 0x94, 0xb1, 0x6e, 0x53, 0x75,	\
+	0xd2, 0x96, 0x36, 0xe9, 0x3d, 0xcc, 0x90, 0xb1, 0x09, 0x86, 0x18, 0x65, 0x96, 0x18, 0x65, 0x96,	\
+	0x40, 0x36, 0xde, 0xac, 0x20, 0x68, 0x1a, 0x10, 0x08, 0x04, 0x00, 0x00, 0x70, 0xf8, 0x02, 0xc4,	\
+	0x21, 0x3a, 0x21, 0x08, 0x42, 0x10, 0x9d, 0x74, 0x5c, 0x16, 0x4b, 0x1c, 0x00, 0x6c, 0x24, 0xb6,	\
+	0xd3, 0x6d, 0x36, 0xd3, 0x6d, 0x37, 0xf0, 0x80, 0x17, 0xa3, 0x06, 0x0a, 0xcb, 0x2c, 0x32, 0x10,	\
+	0x9a, 0x30, 0x60, 0xac, 0x9c, 0xc4, 0x76, 0xcf, 0xdf, 0xbf, 0xbd, 0xbd, 0xbd, 0xbd, 0xbf, 0xbf,	\
+	0xbf, 0xbf, 0x5d, 0xd9, 0x1b, 0x8e, 0x39, 0x66, 0x84, 0x21, 0x00, 0x00, 0x0e, 0x4f, 0x85, 0x1c,	\
+	0xf3, 0x65, 0x94, 0xa7, 0x39, 0xe6, 0xcb, 0x2c, 0xdf, 0x11, 0x1f, 0xc3, 0xf0, 0x5a, 0xc4, 0xf8,	\
+	0x2d, 0x62, 0x2f, 0x71, 0x11, 0x75, 0xe7, 0x69, 0x14, 0x18, 0x65, 0x86, 0x58, 0x65, 0x86, 0x77,	\
+	0x9b, 0xc9, 0x12, 0xbb, 0x58, 0x46, 0x4f, 0x53, 0xc7, 0x7a, 0x9e, 0x2d, 0x3c, 0x7a, 0x34, 0xf1,	\
+	0x67, 0xd1, 0xce, 0x19, 0x08, 0x4f, 0x9f, 0x47, 0x8f, 0x1e, 0x44, 0x89, 0x06, 0x34, 0x5d, 0x62,	\
+	0x3e, 0x87, 0x43, 0xa1, 0xd2, 0xe9, 0x74, 0xba, 0x5a, 0x24, 0x21, 0x09, 0x51, 0x9c, 0x15, 0xce,	\
+	0xe7, 0x7b, 0x5c, 0xff, 0x72, 0xc7, 0x47, 0xa3, 0xee, 0x58, 0x21, 0x2d, 0xac, 0x8c, 0x96, 0x82,	\
+	0x45, 0xa0, 0x90, 0x6b, 0x68, 0x8d, 0x68, 0x36, 0xfa, 0x6a, 0x04, 0x24, 0x18, 0x2b, 0x2c, 0x31,	\
+	0xa1, 0x08, 0x47, 0x82, 0x98, 0xc9, 0x00, 0x00, 0x00, 0x00, 0x08, 0x40, 0x78, 0xa3, 0x05, 0x0c,	\
+	0x63, 0x18, 0xc6, 0x84, 0x21, 0x08, 0x44, 0x6b, 0x20, 0xa1, 0x8c, 0x63, 0x18, 0xc6, 0x31, 0xa1,	\
+	0x08, 0xbd, 0xe6, 0x23, 0xf3, 0xbc, 0xbf, 0x47, 0xd1, 0xf2, 0x7c, 0xce, 0x4f, 0x27, 0x8f, 0xaa,	\
+	0x73, 0xc6, 0xd9, 0x32, 0x85, 0xb9, 0x4e, 0x16, 0xe5, 0x34, 0xba, 0x9b, 0x24, 0xba, 0x9b, 0x2c,	\
+	0x2e, 0x62, 0x33, 0x9c, 0xfb, 0x1b, 0x1b, 0x1c, 0xce, 0x67, 0x33, 0x67, 0x65, 0xec, 0x4e, 0x33,	\
+	0x23, 0xec, 0x73, 0x36, 0x39, 0x9b, 0x3b, 0x2f, 0x3c, 0xf3, 0xcf, 0x62, 0xda, 0x19, 0x43, 0x86,	\
+	0xa2, 0x89, 0xa7, 0x73, 0x72, 0x9c, 0x5d, 0xd2, 0x79, 0x55, 0x21, 0x47, 0x39, 0xe7, 0x4d, 0x96,	\
+	0x79, 0xd3, 0x66, 0xcb, 0x2e, 0x46, 0xba, 0x80, 0x98, 0x61, 0x8d, 0xe7, 0xa0, 0xd7, 0x6e, 0x6a,	\
+	0xc6, 0x36, 0x8a, 0xcc, 0x9f, 0x6f, 0x1a, 0xde, 0x35, 0x2a, 0x44, 0xa3, 0x18, 0xc6, 0x93, 0xc4,	\
+	0x47, 0x6f, 0x71, 0x11, 0x7b, 0xab, 0x4b, 0x58, 0x84, 0xba, 0xbb, 0x89, 0xaf, 0x08, 0x8e, 0x6c,	\
+	0xb9, 0x72, 0xe7, 0x4d, 0x9b, 0x34, 0xe7, 0x39, 0xf6, 0xbb, 0xa1, 0x53, 0xa6, 0xcd, 0x97, 0x2e,	\
+	0x59, 0xcf, 0x3a, 0x6c, 0xd9, 0xbe, 0x86, 0x82, 0x93, 0x4d, 0x34, 0xd4, 0x51, 0x34, 0xd4, 0x52,	\
+	0x1c, 0x3e, 0x8a, 0xc0, 0xa8, 0xf1, 0xdf, 0x08, 0x42, 0x7c, 0x21, 0x08, 0x42, 0xe8, 0xd4, 0x23,	\
+	0x95, 0x2a, 0x51, 0x9a, 0x6a, 0x4b, 0x4d, 0xb6, 0xdb, 0x7e, 0xea, 0x22, 0x36, 0x58, 0x60, 0x40,	\
+	0xcb, 0x2c, 0x00, 0x03, 0x3f, 0xf6, 0x19, 0x1b, 0x0c, 0x08, 0x4c, 0xb2, 0xc3, 0x00, 0x0c, 0xb3,	\
+	0xf2, 0x8c, 0x64, 0x26, 0x19, 0x13, 0x0c, 0x89, 0x86, 0x44, 0x26, 0x3e, 0x9a, 0x81, 0x4e, 0x80,	\
+	0x06, 0x16, 0x08, 0x3a, 0x01, 0x85, 0xf8, 0x7a, 0xa7, 0x08, 0xc8, 0x42, 0x12, 0xd2, 0xde, 0xe8,	\
+	0x96, 0xb7, 0x16, 0x97, 0x5f, 0xd5, 0x18, 0x51, 0x20, 0xac, 0x31, 0x8c, 0x84, 0x82, 0xb0, 0xc7,	\
+	0xf5, 0xc9, 0x32, 0x42, 0x06, 0x08, 0x40, 0x00, 0x21, 0x08, 0xea, 0xe4, 0x32, 0xda, 0xe9, 0xf4,	\
+	0xf6, 0xb6, 0xba, 0x75, 0x36, 0xb6, 0xaa, 0x54, 0xda, 0x6a, 0x78, 0x24, 0x6d, 0xd2, 0x69, 0xa6,	\
+	0x58, 0xb7, 0x29, 0xa6, 0xd5, 0xa2, 0x08, 0x6a, 0x43, 0x52, 0x1a, 0x90, 0xd4, 0x86, 0xa3, 0x5d,	\
+	0xf4, 0x09, 0xa8, 0x9a, 0x89, 0xa8, 0xa4, 0x35, 0x21, 0xaf, 0x10, 0x20, 0xd0, 0x80, 0x04, 0x20,	\
+	0x00, 0x19, 0x6c, 0x11, 0x58, 0x0e, 0x38, 0xe3, 0x8e, 0x21, 0x08, 0xf4, 0xb6, 0x70, 0x4c, 0x07,	\
+	0xc2, 0x13, 0xee, 0x17, 0x0b, 0x03, 0x03, 0x01, 0x4a, 0x98, 0xbc, 0x09, 0xa7, 0xa5, 0xfc, 0x54,	\
+	0xf1, 0xf4, 0x33, 0x1e, 0x7a, 0x9c, 0xb6, 0xba, 0x0e, 0x16, 0x47, 0x2a, 0xad, 0x5c, 0x9c, 0x99,	\
+	0xd3, 0x8f, 0x35, 0xdb, 0x09, 0xe3, 0xfe, 0x1e, 0x1e, 0x0e, 0x16, 0x16, 0x16, 0x17, 0x00, 0x2a,	\
+	0x62, 0x84, 0xe0, 0xd7, 0xac, 0x63, 0x77, 0x3e, 0x46, 0x35, 0x7a, 0xd5, 0xb7, 0xe1, 0x33, 0xb2,	\
+	0xde, 0x79, 0xec, 0xfd, 0x2c, 0xcc, 0xec, 0xba, 0xce, 0x14, 0x04, 0xb7, 0x25, 0xd1, 0x08, 0x42,	\
+	0x10, 0x97, 0x1a, 0xc1, 0x20, 0xc1, 0x83, 0x06, 0x0a, 0xcb, 0x2c, 0xb2, 0xd9, 0x7c, 0x01, 0x1e,	\
+	0x79, 0xe7, 0xbe, 0x27, 0x9e, 0x7b, 0xe2, 0xfd, 0x7b, 0xb9, 0xc8, 0x1b, 0x6a, 0x4c, 0xa6, 0x8c,	\
+	0xd1, 0xa5, 0x1b, 0x86, 0x85, 0x00, 0xf5, 0x35, 0x3d, 0x2f, 0x3f, 0xd3, 0xc2, 0xfb, 0xde, 0x87,	\
+	0x89, 0xe8, 0x92, 0x82, 0x51, 0x9a, 0x37, 0x38, 0xde, 0xd4, 0xae, 0x7b, 0x5e, 0xcc, 0x64, 0x1d,	\
+	0x0e, 0x97, 0x43, 0xa5, 0xd0, 0xe9, 0x74, 0x3a, 0x5d, 0x08, 0x3d, 0x3a, 0x28, 0x20, 0xba, 0xb0,	\
+	0xc6, 0x31, 0x8c, 0x63, 0xfb, 0x62, 0x04, 0x67, 0x7d, 0xbe, 0x42, 0x21, 0x42, 0xdf, 0x6f, 0xbe,	\
+	0x7a, 0x38, 0x45, 0x1e, 0x3b, 0xe9, 0x12, 0x23, 0xf5, 0xe6, 0x90, 0x9b, 0x24, 0x4f, 0xdf, 0xdb,	\
+	0x5e, 0xde, 0xde, 0xdf, 0xdf, 0xdf, 0xcf, 0x53, 0x11, 0x37, 0x25, 0xa9, 0x2d, 0x4a, 0x94, 0x63,	\
+	0x50, 0xba, 0x44, 0x92, 0x42, 0x49, 0x21, 0x24, 0x21, 0x44, 0x92, 0x44, 0x69, 0x52, 0x65, 0x34,	\
+	0xdb, 0x4d, 0x84, 0x5c, 0x22, 0x2d, 0x9f, 0xea, 0xa1, 0xb3, 0xcc, 0x3b, 0xdc, 0xcd, 0x8a, 0xda,	\
+	0xa2, 0x23, 0xe0, 0xe1, 0x1f, 0x07, 0x0b, 0x7f, 0x83, 0xc0, 0xae, 0x74, 0x8a, 0x6c, 0xe3, 0xcb,	\
+	0x9b, 0x34, 0xa5, 0x97, 0x5d, 0xda, 0x22, 0xc8, 0xc8, 0xa9, 0x9b, 0xdf, 0xe4, 0x14, 0xb9, 0xb7,	\
+	0x78, 0xa4, 0x43, 0x42, 0x10, 0x80, 0x00, 0x0f, 0x14, 0xe1, 0x11, 0x4b, 0x18, 0xb1, 0xa2, 0xc6,	\
+	0x8b, 0xf6, 0xf1, 0x9b, 0x22, 0x49, 0x21, 0x24, 0x90, 0x92, 0x10, 0xb7, 0xd4, 0x44, 0xc3, 0x20,	\
+	0x26, 0x19, 0x13, 0x0c, 0xf2, 0x4d, 0x11, 0x20, 0x63, 0x42, 0x10, 0x00, 0x8f, 0xe2, 0x58, 0x89,	\
+	0x57, 0x11, 0x01, 0xc0, 0x71, 0x01, 0xd3, 0x36, 0x45, 0xa3, 0x05, 0x62, 0x13, 0x44, 0x84, 0x27,	\
+	0xcb, 0x34, 0x88, 0x84, 0x24, 0x18, 0x30, 0x56, 0x59, 0x6f, 0x9e, 0xe1, 0x14, 0xec, 0x9a, 0xb3,	\
+	0xb2, 0x6a, 0xce, 0xab, 0x51, 0xca, 0xf0, 0x6a, 0xaa, 0xac, 0x05, 0x60, 0x38, 0xe3, 0xe8, 0x20,	\
+	0xce, 0x73, 0x9e, 0x71, 0xce, 0x77, 0x94, 0x46, 0x26, 0xcb, 0x9b, 0x2e, 0x6c, 0xb9, 0xb2, 0xdf,	\
+	0xb0, 0xc7, 0x55, 0xb6, 0xdb, 0x3e, 0xdb, 0x3e, 0x7c, 0x29, 0xac, 0x40, 0x73, 0xcc, 0x6a, 0xf4,	\
+	0x67, 0x9a, 0xbd, 0x36, 0xd0, 0x35, 0xa0, 0xe8, 0x92, 0x0e, 0x89, 0x09, 0x5d, 0x10, 0x1d, 0x5a,	\
+	0xb9, 0x33, 0xaa, 0xe4, 0xce, 0x9d, 0xde, 0xb3, 0x06, 0x35, 0xa0, 0x90, 0x6b, 0x68, 0x92, 0xce,	\
+	0x21, 0x89, 0xb3, 0xa5, 0xcd, 0x97, 0x37, 0x8d, 0xc6, 0xba, 0x8c, 0x0c, 0x84, 0x25, 0x8b, 0x1a,	\
+	0x7a, 0x19, 0xff, 0xaf, 0x21, 0x8b, 0x3d, 0xdc, 0x0b, 0x35, 0x55, 0x55, 0x5b, 0xe9, 0x83, 0x09,	\
+	0x75, 0x89, 0x24, 0x24, 0x84, 0x2f, 0x26, 0x51, 0x89, 0x46, 0x68, 0xcd, 0x1a, 0x3c, 0x8d, 0xec,	\
+	0x70, 0x6c, 0x30, 0xcb, 0x2c, 0xb2, 0x01, 0xbf, 0x5c, 0x0e, 0x95, 0x2a, 0x58, 0x98, 0x78, 0x78,	\
+	0x78, 0xd2, 0x9a, 0x06, 0x92, 0x42, 0x17, 0x53, 0x09, 0x21, 0x71, 0x36, 0x0f, 0x7c, 0x00, 0x1b,	\
+	0xed, 0xf2, 0x11, 0xcf, 0x96, 0x62, 0x53, 0x5c, 0xee, 0x7f, 0x46, 0xc5, 0x82, 0x74, 0xe2, 0x98,	\
+	0x04, 0x02, 0x00, 0x00, 0x3e, 0xde, 0x50, 0x6e, 0x38, 0xe3, 0x90, 0x15, 0x87, 0x0f, 0xae, 0xa4,	\
+	0xc2, 0x01, 0x00, 0x34, 0x0d, 0x07, 0xa6, 0x41, 0x24, 0x84, 0x90, 0x84, 0x92, 0x08, 0x00, 0x00,	\
+	0x03, 0x3d, 0x9a, 0xe0, 0x58, 0xf4, 0xe9, 0xd3, 0x79, 0xe8, 0x5a, 0xa4, 0x25, 0x35, 0x25, 0xb6,	\
+	0xc2, 0x96, 0x50, 0x22, 0x5a, 0x5a, 0x92, 0xd2, 0xd6, 0x24, 0xb8, 0x27, 0xd1, 0xe3, 0xc7, 0x8f,	\
+	0x22, 0xaf, 0x30, 0x12, 0xd0, 0x49, 0x04, 0x84, 0xad, 0x9f, 0x05, 0x91, 0x91, 0x91, 0x9b, 0x9b,	\
+	0xdf, 0xdc, 0xda, 0x02, 0x5b, 0x44, 0x8b, 0x2d, 0xa3, 0x73, 0xac, 0x40, 0x63, 0x42, 0x10, 0x8c,	\
+	0x1e, 0x00, 0x52, 0xe6, 0xcd, 0x9b, 0x38, 0xf8, 0x97, 0xa0, 0x94, 0x87, 0x0d, 0x35, 0x21, 0xe3,	\
+	0x70, 0x02, 0x3e, 0xc7, 0x33, 0x63, 0x99, 0xb3, 0x91, 0x8e, 0x40, 0x00, 0x00, 0x03, 0x5a, 0x64,	\
+	0x87, 0x87, 0xc4, 0xee, 0xf5, 0x16, 0x1e, 0xd6, 0x89, 0x0c, 0x4a, 0x18, 0xd4, 0xab, 0x57, 0xdf,	\
+	0xf0, 0x10, 0x74, 0x42, 0x74, 0x42, 0xe0, 0xb0, 0x21, 0x59, 0xa3, 0x34, 0x69, 0x5c, 0x38, 0x44,	\
+	0x04, 0xc0, 0x98, 0x61, 0x9e, 0x4b, 0xd0, 0x42, 0x74, 0x42, 0x13, 0xbc, 0xcb, 0x21, 0xb9, 0x85,	\
+	0xb9, 0x85, 0xb9, 0x85, 0xcd, 0x9c, 0x43, 0xd7, 0x9f, 0xcd, 0xf7, 0x74, 0xfd, 0xbf, 0x7c, 0x00,	\
+	0x43, 0x18, 0xd6, 0x59, 0x6e, 0x9d, 0x82, 0x18, 0x58, 0x38, 0x58, 0x38, 0x58, 0x3d, 0x51, 0x01,	\
+	0x21, 0x00, 0x34, 0x23, 0xed, 0xbe, 0x0b, 0x22, 0xa5, 0x4e, 0xff, 0x22, 0xa7, 0xde, 0x18, 0x28,	\
+	0x2b, 0x0c, 0x90, 0x56, 0x36, 0x01, 0xb6, 0x7d, 0xf3, 0x3e, 0x62, 0x63, 0x80, 0x34, 0x21, 0x0b,	\
+	0xa5, 0x01, 0x34, 0xee, 0x53, 0x65, 0x00, 0x12, 0xcb, 0x36, 0x5c, 0xb4, 0x40, 0x0b, 0xc6, 0x97,	\
+	0xeb, 0x4b, 0xa8, 0x0e, 0xa3, 0xaa, 0xea, 0xb6, 0xd3, 0x78, 0xc0, 0x1a, 0xb9, 0xab, 0x4f, 0x66,	\
+	0x80, 0x73, 0x9e, 0x85, 0x37, 0x60, 0x09, 0x06, 0x31, 0xab, 0x38, 0xc0, 0xb8, 0x89, 0x77, 0x12,	\
+	0xd6, 0x28, 0x1b, 0xfe, 0x1f, 0xdd, 0xf5, 0x2e, 0x1b, 0x02, 0xda, 0xf5, 0xfd, 0xb5, 0xcc, 0x90,	\
+	0x06, 0x34, 0x22, 0xe7, 0xf7, 0x01, 0x65, 0x86, 0x3e, 0xfd, 0x10, 0x05, 0x8d, 0x1a, 0x2e, 0x05,	\
+	0x68, 0x03, 0x18, 0xc7, 0x83, 0x66, 0x04, 0x08, 0x0a, 0xab, 0x8f, 0x3c, 0x03, 0xa7, 0x75, 0xdc,	\
+	0x89, 0x00, 0x35, 0x2a, 0x51, 0xa3, 0x98, 0x09, 0x24, 0x90, 0xa4, 0x6e, 0x81, 0x8b, 0x4f, 0x1e,	\
+	0x9c, 0x8e, 0x40, 0x3f, 0x67, 0xc7, 0xf1, 0xaf, 0x9c, 0xf0, 0x01, 0x09, 0x86, 0x34, 0x75, 0x00,	\
+	0x35, 0x6a, 0xd8, 0x7a, 0x93, 0x80, 0x72, 0x39, 0x1a, 0xda, 0xda, 0x99, 0x80, 0x3e, 0x8e, 0x27,	\
+	0xdb, 0x15, 0xa0, 0x14, 0xb2, 0xcb, 0xb1, 0x76, 0x04, 0x24, 0x92, 0x4b, 0x66, 0x84, 0x01, 0xf1,	\
+	0x07, 0xa9, 0xbf, 0x6c, 0x03, 0x02, 0x60, 0x52, 0x9f, 0x80, 0x81, 0xa1, 0x1c, 0x88, 0x05, 0x96,	\
+	0xe6, 0xca, 0xcb, 0x9a, 0x18, 0x14, 0xe9, 0xe2, 0xe3, 0xf9, 0xf0, 0xc0, 0x75, 0xd0, 0x0f, 0x54,	\
+	0xf0, 0x00, 0xcb, 0x2c, 0x7f, 0x33, 0x40, 0x21, 0x03, 0x1f, 0xfb, 0x0c, 0x0b, 0xa2, 0x5b, 0x93,	\
+	0xea, 0x0c, 0xb7, 0xe7, 0x3d, 0x0c, 0x4a, 0x58, 0xd8, 0x78, 0x75, 0xeb, 0x18, 0xc6, 0xad, 0x5d,	\
+	0x69, 0xef, 0x42, 0x79, 0xab, 0xc7, 0xf5, 0x72, 0xde, 0x79, 0xe7, 0xa9, 0xe3, 0xd1, 0x34, 0x69,	\
+	0xb7, 0x63, 0x46, 0x8d, 0x79, 0x7d, 0x7d, 0x7d, 0x32, 0x64, 0xcc, 0x0b, 0x3e, 0xeb, 0x68, 0x42,	\
+	0x10, 0x31, 0x8c, 0x63, 0x8f, 0x3a, 0xdd, 0xe5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf5, 0xf7, 0x61, 0xde,	\
+	0x79, 0x27, 0x9b, 0x97, 0x36, 0x71, 0xce, 0x73, 0xf2, 0x35, 0xb9, 0x71, 0x5b, 0x00, 0x06, 0xdb,	\
+	0x6d, 0xd6, 0xdb, 0xfd, 0x2a, 0x98, 0x00, 0x00, 0x08, 0x42, 0x28, 0x9c, 0x5a, 0x49, 0x24, 0x21,	\
+	0x08, 0x51, 0xe0, 0xaf, 0x00, 0x42, 0x10, 0x84, 0xfa, 0x82, 0x3a, 0x8f, 0x42, 0x96, 0x35, 0x7a,	\
+	0xd4, 0xb9, 0x4a, 0xc3, 0xaf, 0x5f, 0x0f, 0x1a, 0x95, 0x87, 0x22, 0xae, 0x88, 0x42, 0x10, 0x9a,	\
+	0x6b, 0x51, 0x8d, 0x29, 0xa6, 0xdb, 0xe9, 0xa4, 0x50, 0x21, 0x03, 0x1a, 0xcc, 0xd9, 0x4e, 0xc4,	\
+	0xa5, 0x29, 0x67, 0x1d, 0x47, 0xef, 0xdf, 0xbf, 0x7f, 0x44, 0xc4, 0x7e, 0xfd, 0xfa, 0x49, 0x5c,	\
+	0xc7, 0x41, 0xa1, 0x00, 0x17, 0x4f, 0x53, 0xb1, 0xbf, 0xbf, 0xbf, 0xbf, 0xf0, 0x42, 0x45, 0x60,	\
+	0x38, 0x80, 0xbc, 0xcd, 0x46, 0x04, 0x21, 0x0a, 0xfb, 0x55, 0x04, 0x21, 0x08, 0x59, 0x98, 0x68,	\
+	0x84, 0x21, 0x0e, 0x68, 0x6f, 0xa6, 0x76, 0x66, 0x66, 0x66, 0x63, 0x4f, 0xcc, 0xa5, 0xbc, 0xbe,	\
+	0x6a, 0x29, 0xa8, 0xa2, 0x8a, 0x31, 0xc3, 0xeb, 0xfa, 0xfe, 0xbf, 0xaf, 0x63, 0xe3, 0xed, 0xb8,	\
+	0x38, 0x7d, 0xb4, 0x2d, 0x33, 0x34, 0xa6, 0x9a, 0xa6, 0x94, 0x64, 0x21, 0x09, 0x84, 0xd9, 0xbf,	\
+	0x7e, 0xfd, 0xfe, 0x27, 0x64, 0xf7, 0xb3, 0x26, 0x60, 0x68, 0x70, 0x1d, 0x82, 0x10, 0x92, 0x6d,	\
+	0xcd, 0x34, 0xd3, 0x4f, 0x9e, 0x90, 0xe7, 0x98, 0xc6, 0xe9, 0xca, 0x38, 0x2b, 0x0c, 0x6e, 0x77,	\
+	0x09, 0x34, 0xee, 0x5e, 0x58, 0x12, 0x00, 0x1f, 0xef, 0x94, 0xe3, 0x9e, 0x05, 0x49, 0x61, 0x61,	\
+	0x04, 0x0d, 0x92, 0x9d, 0x38, 0xf0, 0x38, 0x48, 0xe7, 0xd8, 0x98, 0xc7, 0x2c, 0x3c, 0x3a, 0xf3,	\
+	0x72, 0xe4, 0x90, 0x85, 0x45, 0x8a, 0x53, 0xcc, 0x6a, 0x3d, 0xd2, 0xfa, 0xd0, 0x60, 0xc3, 0x9b,	\
+	0x28, 0xf2, 0x0d, 0x17, 0x24, 0xa9, 0x62, 0x50, 0xb2, 0xf3, 0x12, 0xeb, 0xaf, 0x6d, 0xc4, 0x50,	\
+	0x56, 0x1d, 0xd7, 0x19, 0x0f, 0x77, 0x67, 0x1a, 0x78, 0xbc, 0x9e, 0x4e, 0xae, 0x47, 0x01, 0x6c,	\
+	0xbc, 0xf4, 0x93, 0x21, 0x08, 0x5b, 0x1c, 0x44, 0x42, 0x58, 0xdb, 0xdf, 0x23, 0x18, 0xdb, 0x9d,	\
+	0xd2, 0x39, 0xe8, 0x6e, 0xf8, 0xc8, 0x1b, 0x6f, 0x92, 0x58, 0x80, 0x11, 0xe9, 0xe4, 0x2a, 0x95,	\
+	0x36, 0xbd, 0x5a, 0x45, 0xd1, 0xf7, 0x2c, 0x74, 0x6e, 0x97, 0x9b, 0xcb, 0xf7, 0xfa, 0x58, 0x44,	\
+	0xb4, 0xb5, 0xfa, 0x4b, 0x91, 0x2d, 0x2d, 0x53, 0x54, 0x24, 0x92, 0xef, 0x45, 0x9e, 0xed, 0xeb,	\
+	0x63, 0xe6, 0x7c, 0xc9, 0x6a, 0x31, 0x2c, 0xb2, 0xfa, 0x23, 0x85, 0xca, 0x9a, 0x68, 0x3e, 0x14,	\
+	0xdb, 0xd0, 0x24, 0xa7, 0x78, 0x84, 0x48, 0x94, 0x19, 0x42, 0x86, 0x25, 0x0e, 0xb8, 0x3d, 0x0a,	\
+	0x1d, 0xc1, 0xb1, 0xef, 0x51, 0xd6, 0x09, 0xe6, 0xa3, 0x90, 0x0c, 0x6a, 0xcb, 0x71, 0x4d, 0xea,	\
+	0xdc, 0xa1, 0x97, 0x9d, 0x5e, 0x82, 0x34, 0x5b, 0x4c, 0xe1, 0x05, 0x6b, 0x4d, 0x10, 0x42, 0x5c,	\
+	0xc8, 0x03, 0x47, 0x86, 0xac, 0x0c, 0x78, 0xb4, 0x60, 0xe7, 0xc5, 0xb3, 0x0a, 0xa9, 0x8b, 0x7e,	\
+	0x15, 0x57, 0x42, 0x70, 0x7d, 0x8e, 0xf3, 0xc9, 0x3e, 0x0b, 0x2f, 0x45, 0x40, 0x4f, 0xb5, 0xd8,	\
+	0x1a, 0x6f, 0x62, 0x20, 0x9b, 0x3b, 0x6b, 0xc2, 0x04, 0x2d, 0xc3, 0x02, 0x17, 0x25, 0x00, 0xd4,	\
+	0xee, 0x39, 0xaa, 0x85, 0x3c, 0x7e, 0x79, 0x03, 0x9d, 0xd1, 0xf4, 0x5e, 0x81, 0x0b, 0xd9, 0xc6,	\
+	0x36, 0xb6, 0xba, 0x77, 0x06, 0x4c, 0xef, 0xa5, 0x00, 0xd1, 0x27, 0xd3, 0x8c, 0x6d, 0x6d, 0x7d,	\
+	0x63, 0x81, 0xa3, 0xfd, 0xc4, 0x02, 0x4b, 0xf7, 0xf7, 0x89, 0x3c, 0x24, 0xa1, 0x42, 0xeb, 0xbb,	\
+	0x3e, 0xb5, 0x48, 0x70, 0xd5, 0x55, 0x58, 0x70, 0xd4, 0x51, 0x45, 0x14, 0x51, 0x34, 0xd3, 0xdd,	\
+	0x46, 0x2b, 0xab, 0x61, 0x70, 0x1f, 0x7d, 0x79, 0xb3, 0x66, 0xcd, 0x97, 0x2e, 0x5c, 0xb9, 0x72,	\
+	0xca, 0x52, 0xde, 0x42, 0x7a, 0x84, 0x20, 0x63, 0x18, 0xc6, 0x34, 0x0c, 0x63, 0xee, 0x50, 0x3c,	\
+	0xad, 0x5f, 0x83, 0xc1, 0xe0, 0xf0, 0x78, 0x3c, 0x1a, 0xf5, 0x8c, 0x6f, 0xf7, 0x25, 0xc4, 0xad,	\
+	0xb6, 0xfb, 0x7d, 0xbe, 0xdf, 0x6f, 0xb7, 0xb6, 0xb6, 0xa8, 0x96, 0x6e, 0x51, 0x8c, 0x63, 0x19,	\
+	0xd7, 0x5d, 0xf6, 0x1b, 0x6a, 0xc0, 0x81, 0x02, 0xcf, 0x77, 0xbb, 0x42, 0x20, 0xc1, 0x66, 0xf7,	\
+	0x7b, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x79, 0xe4, 0x60, 0x84, 0x26, 0x18, 0x61, 0x86, 0x31,	\
+	0x6a, 0x59, 0xab, 0xc7, 0xe4, 0x72, 0x39, 0x1c, 0x5f, 0x53, 0xce, 0xc7, 0x90, 0xc6, 0xe4, 0xb4,	\
+	0xd3, 0x4d, 0x34, 0xd7, 0xce, 0xa5, 0x80, 0xcb, 0x2c, 0xb2, 0xcb, 0x2c, 0x58, 0xe2, 0xae, 0xc6,	\
+	0x9e, 0x86, 0x9d, 0x82, 0x13, 0xf1, 0x1d, 0x69, 0xa6, 0x9a, 0x69, 0xd9, 0x59, 0x39, 0x7c, 0xa4,	\
+	0x21, 0x08, 0x00, 0x7f, 0x66, 0xa0, 0x00, 0x00, 0x08, 0x15, 0xca, 0x00, 0x06, 0xdb, 0x6e, 0x6d,	\
+	0xa5, 0x08, 0x42, 0x10, 0x85, 0x49, 0x3e, 0xa9, 0x12, 0x24, 0x18, 0xc6, 0x85, 0xd8, 0x50, 0x84,	\
+	0x21, 0x3e, 0x8f, 0x79, 0xb8, 0xa5, 0x14, 0x51, 0x48, 0x70, 0xd9, 0x01, 0x27, 0x4e, 0x39, 0xe7,	\
+	0x53, 0xd0, 0x21, 0x8d, 0x5a, 0xb5, 0x6a, 0xce, 0xea, 0x36, 0xdb, 0x6d, 0xb7, 0x60, 0xf9, 0x25,	\
+	0xcb, 0x97, 0x2e, 0x5e, 0x04, 0x64, 0x42, 0x00, 0x03, 0xcb, 0x54, 0x8e, 0xba, 0x52, 0x97, 0xa2,	\
+	0x1a, 0x3e, 0x8f, 0x1e, 0x3c, 0x75, 0x40, 0x3e, 0xfe, 0x5c, 0xb9, 0x6d, 0xc2, 0x32, 0x94, 0xb1,	\
+	0x65, 0xa4, 0x1e, 0x06, 0x06, 0x06, 0x04, 0xf4, 0x33, 0x00, 0x00, 0xab, 0xed, 0x1d, 0x4a, 0x95,	\
+	0x2a, 0x55, 0xe3, 0x9e, 0xce, 0xce, 0xce, 0xcd, 0xa2, 0x1d, 0xb6, 0xdf, 0xab, 0x8b, 0x7f, 0x08,	\
+	0xf5, 0x06, 0x31, 0xc7, 0xa0, 0x32, 0x96, 0x5c, 0xd8, 0xf5, 0x67, 0x2c, 0xa5, 0x2e, 0x75, 0x39,	\
+	0xba, 0x52, 0x97, 0x3e, 0x64, 0xd8, 0x61, 0x87, 0xde, 0x8d, 0xc3, 0x31, 0x8d, 0x5b, 0xd4, 0xd1,	\
+	0xa8, 0xa4, 0x38, 0x7d, 0x34, 0x26, 0x34, 0x20, 0x3e, 0x6d, 0x1a, 0xeb, 0xae, 0xbf, 0x5e, 0x21,	\
+	0x88, 0x42, 0x48, 0x4f, 0x11, 0x4b, 0x14, 0xf8, 0x0a, 0xda, 0xda, 0xd9, 0xe4, 0x82, 0x60, 0x42,	\
+	0x99, 0xa3, 0x28, 0xde, 0x2f, 0x8b, 0xda, 0xce, 0x23, 0x18, 0xd4, 0x72, 0x8a, 0xd2, 0xd5, 0x78,	\
+	0x7a, 0xe4, 0x00, 0x88, 0xad, 0x16, 0xe2, 0xca, 0xca, 0xfe, 0x39, 0x32, 0xcb, 0x18, 0xd5, 0xa5,	\
+	0xab, 0xe6, 0x79, 0x79, 0x38, 0x24, 0xe2, 0x02, 0x46, 0xc9, 0x56, 0xaf, 0x5f, 0x32, 0x94, 0x9d,	\
+	0x29, 0x7f, 0x6a, 0xe2, 0x74, 0xa5, 0xd6, 0xd1, 0x2c, 0x4a, 0x13, 0xb9, 0xa0, 0x92, 0x10, 0x8f,	\
+	0x77, 0x8c, 0x9d, 0x74, 0x9f, 0x09, 0xf2, 0x42, 0x03, 0xef, 0xce, 0x5b, 0x5d, 0x3e, 0x9f, 0xe2,	\
+	0xac, 0x90, 0x80, 0xfc, 0xe4, 0x10, 0x92, 0xfb, 0x3f, 0x9d, 0x62, 0xbd, 0xbd, 0xbd, 0x3a, 0x40,	\
+	0x9a, 0x6c, 0xb4, 0x0a, 0xaa, 0xee, 0x50, 0x00, 0x9c, 0x50, 0x7e, 0xfe, 0x82, 0x48, 0x35, 0x6a,	\
+	0x39, 0xf1, 0x1e, 0x3d, 0x6c, 0x51, 0x57, 0x26, 0xbe, 0xfc, 0x58, 0xd3, 0xb0, 0xe5, 0x17, 0x71,	\
+	0x2c, 0x6c, 0xc2, 0xd0, 0x6d, 0x79, 0x41, 0x2e, 0xae, 0xb6, 0x02, 0x11, 0xe2, 0xc3, 0x08, 0x47,	\
+	0x8b, 0x4c, 0x32, 0xcd, 0xee, 0x08, 0x00, 0xbe, 0xb8, 0x08, 0x45, 0xfd, 0x90, 0x1e, 0xef, 0x0a,	\
+	0x20, 0xe2, 0x6a, 0x61, 0x67, 0x86, 0x58, 0xc6, 0x8e, 0x00, 0x31, 0xb4, 0x43, 0x2c, 0x65, 0x6a,	\
+	0x09, 0x12, 0x32, 0xf2, 0x84, 0xa3, 0x48, 0xbf, 0x10, 0xd5, 0xcf, 0xb4, 0x11, 0xb7, 0x5a, 0x2e,	\
+	0x06, 0xa5, 0x69, 0x6e, 0x8c, 0x7a, 0x7a, 0x5c, 0x42, 0xd2, 0xd6, 0x4e, 0xb8, 0x3d, 0x0d, 0x4b,	\
+	0x41, 0x1b, 0x75, 0xaf, 0x6c, 0x22, 0xdc, 0xed, 0xe6, 0x06, 0x18, 0xde, 0xab, 0x14, 0x28, 0x70,	\
+	0xac, 0x42, 0xdf, 0x73, 0xdb, 0x06, 0x05, 0xe7, 0xa0, 0x0d, 0xb5, 0xfc, 0x20, 0x4d, 0x4f, 0x5c,	\
+	0x21, 0x22, 0x47, 0xaf, 0x2c, 0x3a, 0x4f, 0x65, 0x78, 0x10, 0xbe, 0x30, 0x42, 0xc3, 0xfb, 0x76,	\
+	0x02, 0xeb, 0xf5, 0xc3, 0x04, 0xd1, 0xc7, 0xde, 0xda, 0x6c, 0x14, 0x6d, 0x67, 0xf2, 0xef, 0x63,	\
+	0xfa, 0x26, 0xf1, 0x4c, 0x3b, 0xac, 0x81, 0x9f, 0x84, 0xfd, 0x2f, 0xf0, 0x77, 0xbd, 0xf7, 0xf5,	\
+	0xf2, 0xe4, 0x1f, 0x8e, 0x93, 0xea, 0xa3, 0xce, 0xa9, 0x4c, 0x45, 0x0f, 0xd0, 0xa6, 0x17, 0x9a,	\
+	0x59, 0x78, 0x2f, 0x63, 0xba, 0xf6, 0xac, 0x71, 0x9d, 0xe5, 0x64, 0x88, 0x70, 0x5e, 0xa7, 0x8d,	\
+	0xfa, 0xeb, 0x70, 0x26, 0xe2, 0xb9, 0xd8, 0x69, 0x5d, 0xbd, 0x7b, 0x3a, 0xcf, 0x14, 0x38, 0xd7,	\
+	0x99, 0x78, 0xfc, 0x98, 0x78, 0x68, 0xb3, 0x0f, 0x9b, 0xb4, 0xf9, 0xf2, 0xb2, 0x56, 0x8f, 0x61,	\
+	0x1c, 0xca, 0x66, 0xe7, 0x37, 0x3e, 0x7d, 0xa9, 0x3d, 0x8a, 0xf7, 0x1a, 0xf9, 0x71, 0x0e, 0x5b,	\
+	0x3e, 0x49, 0x97, 0xee, 0x9b, 0x7f, 0x1a, 0x1c, 0x9f, 0x06, 0xb1, 0xfe, 0xf0, 0xf1, 0xde, 0x0b,	\
+	0xb7, 0xc7, 0x7a, 0xfd, 0x91, 0xf3, 0x1e, 0x6f, 0x11, 0x32, 0x9d, 0x25, 0x75, 0x58, 0x3a, 0x79,	\
+	0xfa, 0x12, 0xb9, 0x5d, 0x1b, 0xdc, 0xc9, 0x50, 0xfd, 0xbd, 0x59, 0x5d, 0x08, 0xba, 0xbf, 0xdf,	\
+	0x03, 0xcb, 0xfc, 0x00
+
+#endif  //  ICT_HUFF_H_INCLUDED
+
@@ -0,0 +1,1285 @@
+/*
+ *  ST7735 Command Set Encoded Image
+ *  Encoder by Tim Williams, 2018-12-29
+ *  Original: lineart.png
+ */
+
+#ifndef LINEART_H_INCLUDED
+#define LINEART_H_INCLUDED
+
+#define LINEART_MAGIC_NUMBER	0x371e5453
+#define LINEART_WIDTH		160
+#define LINEART_HEIGHT		128
+#define LINEART_CMD_LEN		6578	/*  Number of command bytes  */
+#define LINEART_PALETTE_LEN		14	/*  Number of bytes (2 * colors)  */
+#define LINEART_TOTAL_LEN		6593	/*  Total array size  */
+
+#define LINEART_PAL		\
+	0xff, 0xff,	0x00, 0x00,	0xcf, 0x7b,	0x60, 0xe4,		\
+	0xf9, 0x19,	0x65, 0x14,	0xe3, 0xc8
+
+#define LINEART_CMDS		\
+	0x05, 0, 126, 64, 29, 24,		\
+	0x25, 0, 53, 20, 34,		\
+	0x07, 0, 55, 113, 52, 13,		\
+	108, 113, 29, 15,		\
+	140, 108, 20, 20,		\
+	48, 91, 26, 13,		\
+	21, 97, 25, 13,		\
+	112, 74, 14, 23,		\
+	0, 116, 24, 12,		\
+	30, 0, 39, 7,		\
+	80, 0, 21, 13,		\
+	126, 88, 14, 18,		\
+	119, 0, 11, 21,		\
+	145, 88, 12, 19,		\
+	142, 10, 17, 13,		\
+	0, 87, 10, 22,		\
+	82, 75, 22, 10,		\
+	41, 34, 14, 14,		\
+	8, 32, 9, 20,		\
+	19, 21, 15, 12,		\
+	46, 81, 19, 9,		\
+	134, 50, 12, 13,		\
+	0, 9, 13, 11,		\
+	134, 0, 26, 5,		\
+	0, 21, 4, 32,		\
+	98, 15, 14, 9,		\
+	40, 120, 15, 8,		\
+	86, 98, 19, 6,		\
+	95, 61, 15, 7,		\
+	134, 28, 19, 5,		\
+	88, 43, 18, 5,		\
+	158, 64, 2, 44,		\
+	84, 30, 14, 6,		\
+	11, 107, 9, 9,		\
+	18, 40, 9, 9,		\
+	54, 56, 9, 9,		\
+	74, 90, 8, 10,		\
+	110, 98, 13, 6,		\
+	64, 56, 7, 11,		\
+	98, 87, 11, 7,		\
+	91, 69, 19, 4,		\
+	31, 11, 15, 5,		\
+	48, 104, 15, 5,		\
+	50, 7, 15, 5,		\
+	20, 73, 6, 12,		\
+	70, 5, 6, 12,		\
+	114, 53, 8, 9,		\
+	21, 62, 7, 10,		\
+	131, 13, 5, 14,		\
+	61, 110, 22, 3,		\
+	16, 15, 13, 5,		\
+	27, 111, 13, 5,		\
+	83, 53, 16, 4,		\
+	84, 105, 21, 3,		\
+	0, 0, 30, 2,		\
+	33, 84, 12, 5,		\
+	66, 81, 6, 10,		\
+	69, 37, 12, 5,		\
+	154, 33, 6, 10,		\
+	10, 87, 4, 14,		\
+	49, 51, 14, 4,		\
+	120, 64, 6, 9,		\
+	127, 55, 6, 9,		\
+	136, 36, 17, 3,		\
+	24, 118, 10, 5,		\
+	31, 64, 10, 5,		\
+	4, 37, 3, 16,		\
+	18, 7, 12, 4,		\
+	71, 105, 12, 4,		\
+	146, 57, 8, 6,		\
+	115, 0, 4, 11,		\
+	0, 109, 6, 7,		\
+	13, 21, 6, 7,		\
+	55, 28, 7, 6,		\
+	84, 110, 21, 2,		\
+	24, 33, 8, 5,		\
+	100, 27, 10, 4,		\
+	84, 13, 13, 3,		\
+	158, 44, 2, 19,		\
+	4, 21, 4, 9,		\
+	43, 28, 6, 6,		\
+	55, 39, 4, 9,		\
+	49, 71, 12, 3,		\
+	82, 57, 6, 6,		\
+	84, 88, 4, 9,		\
+	86, 18, 12, 3,		\
+	89, 85, 9, 4,		\
+	118, 32, 9, 4,		\
+	33, 91, 7, 5,		\
+	40, 73, 5, 7,		\
+	41, 59, 7, 5,		\
+	135, 5, 7, 5,		\
+	28, 50, 2, 17,		\
+	65, 33, 11, 3,		\
+	80, 27, 11, 3,		\
+	85, 49, 11, 3,		\
+	106, 105, 11, 3,		\
+	145, 7, 11, 3,		\
+	24, 93, 8, 4,		\
+	32, 124, 8, 4,		\
+	72, 56, 4, 8,		\
+	102, 11, 8, 4,		\
+	8, 4, 10, 3,		\
+	14, 101, 5, 6,		\
+	21, 50, 3, 10,		\
+	34, 36, 3, 10,		\
+	124, 21, 6, 5,		\
+	48, 116, 7, 4,		\
+	77, 51, 4, 7,		\
+	122, 50, 4, 7,		\
+	124, 111, 14, 2,		\
+	101, 58, 9, 3,		\
+	142, 98, 3, 9,		\
+	143, 44, 9, 3,		\
+	33, 73, 5, 5,		\
+	48, 14, 5, 5,		\
+	0, 2, 12, 2,		\
+	13, 12, 8, 3,		\
+	18, 2, 12, 2,		\
+	45, 111, 6, 4,		\
+	64, 49, 4, 6,		\
+	74, 69, 6, 4,		\
+	77, 45, 6, 4,		\
+	92, 95, 8, 3,		\
+	104, 74, 4, 6,		\
+	113, 19, 3, 8,		\
+	121, 44, 8, 3,		\
+	124, 106, 12, 2,		\
+	137, 116, 2, 12,		\
+	91, 25, 11, 2,		\
+	111, 57, 2, 11,		\
+	130, 0, 2, 11,		\
+	136, 33, 11, 2,		\
+	14, 89, 3, 7,		\
+	37, 30, 3, 7,		\
+	37, 56, 7, 3,		\
+	55, 22, 7, 3,		\
+	67, 9, 3, 7,		\
+	73, 75, 3, 7,		\
+	76, 11, 3, 7,		\
+	77, 0, 3, 7,		\
+	122, 37, 7, 3,		\
+	146, 40, 7, 3,		\
+	21, 88, 5, 4,		\
+	33, 59, 4, 5,		\
+	38, 69, 10, 2,		\
+	46, 75, 4, 5,		\
+	49, 56, 5, 4,		\
+	50, 25, 5, 4,		\
+	58, 34, 5, 4,		\
+	59, 78, 10, 2,		\
+	100, 37, 10, 2,		\
+	106, 40, 4, 5,		\
+	105, 83, 5, 4,		\
+	106, 50, 5, 4,		\
+	114, 62, 4, 5,		\
+	114, 40, 5, 4,		\
+	118, 104, 5, 4,		\
+	136, 21, 4, 5,		\
+	140, 88, 2, 10,		\
+	40, 16, 6, 3,		\
+	73, 87, 6, 3,		\
+	79, 77, 3, 6,		\
+	78, 24, 6, 3,		\
+	80, 101, 6, 3,		\
+	98, 33, 6, 3,		\
+	103, 94, 6, 3,		\
+	106, 98, 3, 6,		\
+	124, 97, 2, 9,		\
+	148, 24, 6, 3,		\
+	155, 54, 3, 6,		\
+	0, 7, 8, 2,		\
+	18, 36, 4, 4,		\
+	29, 18, 8, 2,		\
+	30, 9, 8, 2,		\
+	39, 40, 2, 8,		\
+	49, 64, 4, 4,		\
+	59, 43, 4, 4,		\
+	59, 65, 4, 4,		\
+	68, 22, 4, 4,		\
+	72, 25, 4, 4,		\
+	73, 49, 4, 4,		\
+	79, 15, 4, 4,		\
+	88, 91, 4, 4,		\
+	86, 23, 8, 2,		\
+	116, 69, 4, 4,		\
+	123, 60, 4, 4,		\
+	126, 48, 4, 4,		\
+	25, 57, 3, 5,		\
+	26, 11, 5, 3,		\
+	27, 81, 5, 3,		\
+	27, 86, 5, 3,		\
+	45, 23, 5, 3,		\
+	77, 63, 5, 3,		\
+	108, 0, 5, 3,		\
+	112, 29, 5, 3,		\
+	151, 48, 3, 5,		\
+	56, 49, 7, 2,		\
+	64, 31, 7, 2,		\
+	82, 92, 2, 7,		\
+	101, 3, 2, 7,		\
+	100, 126, 7, 2,		\
+	140, 13, 2, 7,		\
+	9, 28, 4, 3,		\
+	17, 96, 3, 4,		\
+	19, 92, 3, 4,		\
+	23, 110, 4, 3,		\
+	24, 123, 4, 3,		\
+	34, 21, 2, 6,		\
+	34, 118, 4, 3,		\
+	38, 7, 6, 2,		\
+	46, 91, 2, 6,		\
+	53, 19, 6, 2,		\
+	58, 15, 4, 3,		\
+	58, 12, 6, 2,		\
+	63, 24, 3, 4,		\
+	64, 38, 2, 6,		\
+	63, 104, 4, 3,		\
+	69, 0, 4, 3,		\
+	85, 44, 3, 4,		\
+	91, 65, 4, 3,		\
+	92, 57, 4, 3,		\
+	94, 89, 4, 3,		\
+	107, 4, 3, 4,		\
+	105, 31, 6, 2,		\
+	106, 24, 6, 2,		\
+	130, 36, 3, 4,		\
+	132, 7, 2, 6,		\
+	130, 29, 4, 3,		\
+	134, 47, 4, 3,		\
+	137, 10, 2, 6,		\
+	153, 28, 4, 3,		\
+	8, 21, 2, 5,		\
+	9, 111, 2, 5,		\
+	13, 7, 5, 2,		\
+	20, 111, 2, 5,		\
+	24, 50, 2, 5,		\
+	26, 78, 5, 2,		\
+	30, 56, 2, 5,		\
+	27, 91, 5, 2,		\
+	31, 50, 2, 5,		\
+	33, 81, 5, 2,		\
+	40, 26, 2, 5,		\
+	38, 22, 5, 2,		\
+	40, 50, 5, 2,		\
+	41, 115, 5, 2,		\
+	43, 53, 5, 2,		\
+	53, 68, 5, 2,		\
+	69, 51, 2, 5,		\
+	67, 72, 5, 2,		\
+	71, 46, 2, 5,		\
+	76, 27, 2, 5,		\
+	74, 22, 5, 2,		\
+	81, 21, 5, 2,		\
+	89, 40, 5, 2,		\
+	95, 27, 5, 2,		\
+	101, 41, 5, 2,		\
+	116, 23, 2, 5,		\
+	0x25, 114, 46, 5, 2,		\
+	0x07, 58, 114, 49, 5, 2,		\
+	131, 50, 2, 5,		\
+	132, 41, 5, 2,		\
+	140, 26, 5, 2,		\
+	147, 47, 2, 5,		\
+	28, 38, 3, 3,		\
+	40, 93, 3, 3,		\
+	40, 111, 3, 3,		\
+	41, 66, 3, 3,		\
+	45, 64, 3, 3,		\
+	49, 31, 3, 3,		\
+	66, 42, 3, 3,		\
+	74, 65, 3, 3,		\
+	81, 86, 3, 3,		\
+	83, 17, 3, 3,		\
+	103, 53, 3, 3,		\
+	104, 8, 3, 3,		\
+	111, 69, 3, 3,		\
+	146, 54, 3, 3,		\
+	155, 44, 3, 3,		\
+	157, 5, 3, 3,		\
+	157, 25, 3, 3,		\
+	4, 30, 2, 4,		\
+	6, 109, 2, 4,		\
+	10, 101, 2, 4,		\
+	15, 28, 4, 2,		\
+	17, 88, 2, 4,		\
+	18, 49, 2, 4,		\
+	18, 5, 4, 2,		\
+	30, 73, 2, 4,		\
+	28, 126, 4, 2,		\
+	36, 122, 4, 2,		\
+	38, 117, 4, 2,		\
+	44, 118, 4, 2,		\
+	50, 75, 4, 2,		\
+	51, 111, 4, 2,		\
+	55, 126, 4, 2,		\
+	59, 75, 4, 2,		\
+	66, 27, 4, 2,		\
+	67, 107, 4, 2,		\
+	70, 42, 4, 2,		\
+	76, 75, 2, 4,		\
+	74, 100, 4, 2,		\
+	77, 84, 4, 2,		\
+	81, 37, 2, 4,		\
+	85, 38, 4, 2,		\
+	96, 49, 4, 2,		\
+	98, 85, 4, 2,		\
+	106, 56, 4, 2,		\
+	110, 7, 2, 4,		\
+	112, 34, 4, 2,		\
+	117, 11, 2, 4,		\
+	120, 41, 4, 2,		\
+	120, 47, 4, 2,		\
+	126, 26, 4, 2,		\
+	136, 44, 4, 2,		\
+	140, 39, 4, 2,		\
+	143, 94, 2, 4,		\
+	0x05, 6, 32, 71, 6, 2,		\
+	0x25, 40, 71, 5, 2,		\
+	0x02, 0, 60, 127, 39,		\
+	0x22, 86, 74, 18,		\
+	0x07, 20, 124, 109, 15,		\
+	84, 108, 11,		\
+	94, 39, 11,		\
+	106, 109, 11,		\
+	95, 109, 10,		\
+	74, 104, 9,		\
+	22, 4, 8,		\
+	37, 89, 8,		\
+	47, 109, 8,		\
+	90, 21, 8,		\
+	150, 23, 8,		\
+	27, 110, 7,		\
+	30, 116, 7,		\
+	38, 83, 7,		\
+	84, 72, 7,		\
+	87, 16, 7,		\
+	89, 37, 7,		\
+	96, 52, 7,		\
+	147, 6, 7,		\
+	147, 35, 7,		\
+	0x02, 2, 33, 48, 36,		\
+	0x22, 35, 55, 34,		\
+	0x07, 6, 46, 80, 20,		\
+	46, 90, 20,		\
+	124, 110, 15,		\
+	33, 80, 12,		\
+	107, 110, 10,		\
+	87, 17, 7,		\
+	0x02, 5, 70, 68, 44,		\
+	0x22, 84, 36, 31,		\
+	0x07, 7, 86, 73, 26,		\
+	85, 48, 19,		\
+	66, 36, 17,		\
+	46, 74, 13,		\
+	113, 73, 13,		\
+	30, 89, 7,		\
+	30, 117, 7,		\
+	0x02, 6, 59, 126, 41,		\
+	0x22, 31, 49, 18,		\
+	0x07, 5, 32, 96, 13,		\
+	53, 18, 11,		\
+	53, 70, 11,		\
+	21, 49, 9,		\
+	21, 72, 8,		\
+	0x02, 3, 83, 104, 35,		\
+	0x22, 83, 112, 35,		\
+	0x07, 11, 133, 43, 27,		\
+	133, 63, 27,		\
+	13, 20, 25,		\
+	47, 21, 15,		\
+	136, 35, 11,		\
+	2, 20, 10,		\
+	8, 31, 9,		\
+	8, 52, 9,		\
+	63, 21, 7,		\
+	147, 5, 7,		\
+	147, 27, 7,		\
+	0x02, 1, 55, 109, 28,		\
+	0x22, 95, 108, 22,		\
+	0x07, 8, 136, 107, 21,		\
+	105, 97, 19,		\
+	118, 108, 18,		\
+	105, 111, 12,		\
+	34, 110, 11,		\
+	84, 109, 11,		\
+	85, 52, 11,		\
+	46, 110, 9,		\
+	0x03, 0, 157, 64, 24,		\
+	0x23, 111, 76, 21,		\
+	0x07, 10, 155, 74, 14,		\
+	157, 95, 13,		\
+	159, 11, 11,		\
+	156, 64, 10,		\
+	110, 88, 9,		\
+	27, 41, 8,		\
+	20, 100, 7,		\
+	33, 39, 7,		\
+	46, 100, 7,		\
+	114, 2, 7,		\
+	0x03, 4, 71, 51, 16,		\
+	0x23, 72, 69, 16,		\
+	0x03, 2, 139, 110, 18,		\
+	0x23, 130, 11, 17,		\
+	0x07, 7, 107, 113, 15,		\
+	26, 80, 11,		\
+	65, 81, 9,		\
+	30, 48, 8,		\
+	76, 0, 7,		\
+	104, 0, 7,		\
+	129, 36, 7,		\
+	0x03, 5, 113, 41, 27,		\
+	0x23, 156, 74, 14,		\
+	0x07, 14, 63, 56, 13,		\
+	119, 36, 13,		\
+	63, 36, 12,		\
+	112, 14, 12,		\
+	110, 57, 11,		\
+	110, 77, 11,		\
+	83, 39, 10,		\
+	155, 64, 10,		\
+	109, 88, 9,		\
+	111, 45, 8,		\
+	19, 100, 7,		\
+	47, 100, 7,		\
+	154, 47, 7,		\
+	157, 88, 7,		\
+	0x03, 6, 45, 71, 25,		\
+	0x23, 20, 49, 24,		\
+	0x07, 4, 48, 56, 17,		\
+	84, 39, 11,		\
+	32, 39, 10,		\
+	32, 80, 9,		\
+	0x03, 3, 7, 31, 22,		\
+	0x23, 17, 31, 22,		\
+	0x07, 5, 133, 44, 19,		\
+	113, 2, 11,		\
+	83, 105, 7,		\
+	117, 105, 7,		\
+	139, 13, 7,		\
+	0x03, 1, 62, 19, 11,		\
+	0x23, 123, 98, 10,		\
+	0x15, 7, 6, 8, 8,		\
+		5, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0,		\
+	0x16, 0x45, 0x00, 20, 11,		\
+	0x16, 0x4a, 0x00, 80, 22,		\
+	0x16, 0x4f, 0x00, 54, 24,		\
+	0x16, 0x54, 0x00, 94, 28,		\
+	0x15, 88, 93, 8, 8,		\
+		0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0,		\
+	0x16, 0x45, 0x00, 74, 100,		\
+	0x16, 0x4a, 0x00, 51, 111,		\
+	0x16, 0x4f, 0x00, 42, 115,		\
+	0x16, 0x54, 0x00, 34, 119,		\
+	0x15, 65, 23, 4, 4,		\
+		4, 0, 0, 0, 0, 4, 0, 0, 0, 0, 4, 0, 0, 0, 0, 4,		\
+	0x16, 0x15, 0x00, 10, 25,		\
+	0x16, 0x1a, 0x00, 69, 26,		\
+	0x16, 0x1f, 0x00, 18, 32,		\
+	0x16, 0x24, 0x00, 22, 36,		\
+	0x16, 0x29, 0x00, 26, 39,		\
+	0x16, 0x2e, 0x00, 49, 60,		\
+	0x16, 0x33, 0x00, 53, 64,		\
+	0x16, 0x38, 0x00, 68, 77,		\
+	0x16, 0x3d, 0x00, 78, 86,		\
+	0x15, 45, 14, 4, 4,		\
+		0, 0, 0, 0, 0, 0, 6, 6, 6, 6, 0, 0, 0, 0, 0, 0,		\
+	0x16, 0x15, 0x00, 41, 26,		\
+	0x16, 0x1a, 0x00, 39, 32,		\
+	0x16, 0x1f, 0x00, 37, 38,		\
+	0x16, 0x24, 0x00, 35, 44,		\
+	0x16, 0x29, 0x00, 80, 54,		\
+	0x16, 0x2e, 0x00, 31, 56,		\
+	0x16, 0x33, 0x00, 29, 62,		\
+	0x16, 0x38, 0x00, 25, 74,		\
+	0x16, 0x3d, 0x00, 18, 88,		\
+	0x16, 0x42, 0x00, 16, 92,		\
+	0x16, 0x47, 0x00, 14, 96,		\
+	0x16, 0x4c, 0x00, 11, 101,		\
+	0x16, 0x51, 0x00, 9, 105,		\
+	0x16, 0x56, 0x00, 7, 109,		\
+	0x15, 102, 50, 4, 4,		\
+		0, 0, 0, 2, 0, 0, 2, 0, 0, 2, 0, 0, 2, 0, 0, 0,		\
+	0x16, 0x15, 0x00, 127, 51,		\
+	0x16, 0x1a, 0x00, 123, 56,		\
+	0x16, 0x1f, 0x00, 119, 61,		\
+	0x16, 0x24, 0x00, 89, 63,		\
+	0x16, 0x29, 0x00, 116, 65,		\
+	0x16, 0x2e, 0x00, 36, 76,		\
+	0x16, 0x33, 0x00, 105, 79,		\
+	0x15, 12, 1, 4, 4,		\
+		0, 2, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 0, 0, 2, 0,		\
+	0x16, 0x15, 0x00, 16, 2,		\
+	0x16, 0x1a, 0x00, 20, 3,		\
+	0x16, 0x1f, 0x00, 24, 4,		\
+	0x16, 0x24, 0x00, 28, 5,		\
+	0x16, 0x29, 0x00, 32, 6,		\
+	0x16, 0x2e, 0x00, 36, 7,		\
+	0x16, 0x33, 0x00, 40, 8,		\
+	0x16, 0x38, 0x00, 56, 12,		\
+	0x16, 0x3d, 0x00, 85, 15,		\
+	0x16, 0x42, 0x00, 80, 18,		\
+	0x16, 0x47, 0x00, 88, 20,		\
+	0x16, 0x4c, 0x00, 92, 21,		\
+	0x16, 0x51, 0x00, 96, 22,		\
+	0x16, 0x56, 0x00, 100, 23,		\
+	0x16, 0x5b, 0x00, 104, 24,		\
+	0x16, 0x60, 0x00, 112, 26,		\
+	0x16, 0x65, 0x00, 77, 81,		\
+	0x16, 0x6a, 0x00, 82, 84,		\
+	0x16, 0x6f, 0x00, 89, 88,		\
+	0x16, 0x74, 0x00, 101, 95,		\
+	0x15, 2, 4, 4, 4,		\
+		5, 0, 0, 0, 0, 5, 0, 0, 0, 5, 0, 0, 0, 0, 5, 0,		\
+	0x16, 0x15, 0x00, 15, 9,		\
+	0x16, 0x1a, 0x00, 28, 14,		\
+	0x16, 0x1f, 0x00, 76, 20,		\
+	0x16, 0x24, 0x00, 49, 22,		\
+	0x16, 0x29, 0x00, 90, 26,		\
+	0x16, 0x2e, 0x00, 137, 46,		\
+	0x16, 0x33, 0x00, 40, 91,		\
+	0x16, 0x38, 0x00, 23, 113,		\
+	0x15, 145, 22, 4, 4,		\
+		0, 0, 3, 0, 0, 0, 3, 0, 0, 0, 3, 0, 0, 3, 0, 0,		\
+	0x16, 0x15, 0x00, 137, 24,		\
+	0x16, 0x1a, 0x00, 151, 25,		\
+	0x16, 0x1f, 0x00, 112, 31,		\
+	0x16, 0x24, 0x00, 148, 32,		\
+	0x16, 0x29, 0x00, 144, 33,		\
+	0x16, 0x2e, 0x00, 141, 39,		\
+	0x16, 0x33, 0x00, 78, 40,		\
+	0x16, 0x38, 0x00, 126, 45,		\
+	0x16, 0x3d, 0x00, 121, 47,		\
+	0x16, 0x42, 0x00, 116, 49,		\
+	0x16, 0x47, 0x00, 42, 50,		\
+	0x16, 0x4c, 0x00, 106, 53,		\
+	0x16, 0x51, 0x00, 101, 55,		\
+	0x16, 0x56, 0x00, 79, 64,		\
+	0x16, 0x5b, 0x00, 64, 70,		\
+	0x15, 106, 7, 4, 4,		\
+		3, 0, 0, 0, 0, 3, 0, 0, 0, 0, 3, 0, 0, 0, 0, 3,		\
+	0x16, 0x15, 0x00, 121, 23,		\
+	0x16, 0x1a, 0x00, 133, 36,		\
+	0x15, 51, 17, 4, 4,		\
+		0, 0, 6, 0, 0, 0, 6, 0, 0, 6, 0, 0, 0, 6, 0, 0,		\
+	0x16, 0x15, 0x00, 61, 75,		\
+	0x16, 0x1a, 0x00, 57, 76,		\
+	0x16, 0x1f, 0x00, 36, 81,		\
+	0x16, 0x24, 0x00, 27, 83,		\
+	0x16, 0x29, 0x00, 84, 96,		\
+	0x16, 0x2e, 0x00, 69, 103,		\
+	0x16, 0x33, 0x00, 65, 105,		\
+	0x16, 0x38, 0x00, 30, 122,		\
+	0x16, 0x3d, 0x00, 26, 124,		\
+	0x15, 78, 12, 4, 4,		\
+		0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0,		\
+	0x16, 0x15, 0x00, 46, 26,		\
+	0x16, 0x1a, 0x00, 50, 30,		\
+	0x16, 0x1f, 0x00, 56, 37,		\
+	0x16, 0x24, 0x00, 72, 53,		\
+	0x15, 67, 4, 4, 4,		\
+		0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 1, 0, 1, 0, 0, 0,		\
+	0x16, 0x15, 0x00, 64, 8,		\
+	0x16, 0x1a, 0x00, 12, 15,		\
+	0x16, 0x1f, 0x00, 9, 21,		\
+	0x16, 0x24, 0x00, 6, 27,		\
+	0x16, 0x29, 0x00, 3, 33,		\
+	0x15, 35, 22, 4, 4,		\
+		0, 0, 0, 0, 0, 0, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0,		\
+	0x16, 0x15, 0x00, 27, 44,		\
+	0x16, 0x1a, 0x00, 25, 50,		\
+	0x16, 0x1f, 0x00, 23, 55,		\
+	0x16, 0x24, 0x00, 108, 86,		\
+	0x16, 0x29, 0x00, 142, 88,		\
+	0x16, 0x2e, 0x00, 141, 92,		\
+	0x16, 0x33, 0x00, 140, 96,		\
+	0x16, 0x38, 0x00, 18, 98,		\
+	0x16, 0x3d, 0x00, 139, 100,		\
+	0x16, 0x42, 0x00, 45, 105,		\
+	0x15, 80, 30, 4, 4,		\
+		6, 0, 0, 0, 0, 6, 6, 0, 0, 0, 0, 6, 0, 0, 0, 0,		\
+	0x16, 0x15, 0x00, 37, 59,		\
+	0x15, 138, 10, 4, 4,		\
+		0, 0, 0, 0, 0, 0, 0, 3, 0, 3, 3, 0, 3, 0, 0, 0,		\
+	0x16, 0x15, 0x00, 88, 57,		\
+	0x16, 0x1a, 0x00, 76, 76,		\
+	0x15, 117, 28, 13, 4,		\
+		2, 0, 1, 1, 1, 1, 0, 3, 0, 2, 0, 3, 0, 2, 0, 3, 0, 2, 0, 3, 3, 0, 3, 0, 3, 0, 3, 0, 0, 3, 3, 0, 0, 0, 3, 0, 3, 3, 0, 3, 0, 3, 3, 3, 0, 3, 0, 2, 3, 2, 2, 2,		\
+	0x07, 130, 64, 17, 12, 4,		\
+		0, 0, 6, 0, 0, 0, 6, 0, 0, 0, 6, 0, 5, 0, 0, 6, 5, 0, 0, 6, 5, 0, 0, 6, 2, 5, 0, 0, 2, 5, 0, 0, 2, 0, 5, 0, 2, 0, 5, 0, 0, 2, 0, 5, 0, 2, 0, 5,		\
+	33, 50, 7, 5,		\
+		6, 6, 6, 0, 0, 0, 0, 6, 6, 6, 6, 6, 0, 0, 3, 0, 0, 0, 0, 3, 0, 0, 0, 3, 0, 4, 0, 0, 3, 0, 0, 4, 0, 3, 0,		\
+	80, 69, 11, 3,		\
+		0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 2, 0, 2, 6, 2, 0, 6, 0, 0, 6, 0, 6, 0, 0, 6, 0, 0, 6, 0,		\
+	76, 58, 6, 5,		\
+		0, 0, 0, 0, 0, 2, 0, 0, 0, 6, 0, 2, 6, 6, 0, 0, 6, 2, 0, 0, 6, 0, 0, 2, 0, 0, 0, 0, 0, 2,		\
+	83, 63, 6, 5,		\
+		0, 2, 3, 0, 0, 0, 3, 2, 0, 0, 0, 3, 0, 3, 3, 0, 3, 3, 0, 2, 3, 3, 0, 0, 0, 3, 0, 0, 0, 2,		\
+	46, 7, 4, 7,		\
+		0, 0, 4, 0, 2, 0, 0, 0, 0, 4, 0, 2, 0, 6, 0, 0, 0, 6, 6, 6, 0, 0, 6, 6, 0, 4, 0, 0,		\
+	127, 32, 7, 4,		\
+		0, 0, 0, 4, 3, 0, 0, 4, 3, 2, 2, 4, 2, 3, 0, 4, 2, 3, 3, 4, 2, 0, 3, 4, 2, 0, 3, 0,		\
+	34, 27, 3, 9,		\
+		0, 0, 0, 5, 5, 5, 6, 6, 6, 5, 5, 5, 0, 6, 6, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0,		\
+	38, 19, 9, 3,		\
+		5, 5, 5, 5, 0, 3, 5, 0, 3, 5, 0, 3, 0, 5, 3, 0, 5, 3, 0, 0, 5, 6, 6, 6, 0, 0, 6,		\
+	110, 37, 9, 3,		\
+		0, 4, 0, 5, 4, 5, 0, 4, 0, 5, 5, 5, 5, 1, 1, 1, 4, 0, 4, 0, 0, 4, 5, 0, 4, 5, 0,		\
+	73, 73, 13, 2,		\
+		0, 6, 0, 6, 0, 6, 6, 5, 6, 5, 6, 5, 6, 5, 0, 3, 3, 5, 0, 5, 0, 5, 0, 5, 0, 5,		\
+	106, 45, 5, 5,		\
+		0, 0, 1, 5, 2, 0, 1, 4, 5, 0, 1, 0, 2, 5, 0, 1, 2, 4, 5, 0, 2, 4, 0, 5, 0,		\
+	104, 33, 8, 3,		\
+		0, 0, 3, 5, 0, 3, 5, 0, 3, 0, 3, 0, 0, 3, 0, 0, 3, 0, 0, 3, 5, 3, 5, 5,		\
+	113, 13, 4, 6,		\
+		0, 3, 0, 0, 0, 0, 3, 3, 3, 3, 0, 0, 0, 0, 0, 3, 3, 3, 1, 1, 0, 0, 3, 3,		\
+	118, 109, 6, 4,		\
+		0, 2, 1, 0, 0, 2, 1, 0, 0, 2, 1, 0, 0, 2, 1, 0, 0, 2, 1, 0, 1, 1, 1, 0,		\
+	50, 77, 7, 3,		\
+		0, 3, 6, 0, 3, 6, 3, 0, 6, 3, 0, 6, 0, 0, 6, 0, 6, 0, 0, 6, 0,		\
+	64, 45, 7, 3,		\
+		0, 3, 0, 2, 3, 0, 0, 3, 0, 3, 0, 2, 3, 4, 0, 3, 4, 0, 0, 4, 0,		\
+	65, 74, 7, 3,		\
+		5, 4, 6, 5, 0, 4, 5, 6, 0, 5, 6, 0, 5, 6, 0, 5, 6, 0, 6, 0, 0,		\
+	74, 42, 3, 7,		\
+		0, 3, 0, 4, 0, 1, 0, 0, 3, 0, 4, 0, 0, 1, 0, 3, 0, 4, 0, 0, 1,		\
+	94, 40, 7, 3,		\
+		5, 4, 0, 5, 4, 0, 5, 4, 0, 0, 4, 0, 0, 4, 0, 4, 0, 5, 4, 0, 5,		\
+	118, 21, 3, 7,		\
+		1, 1, 3, 1, 1, 1, 1, 3, 0, 0, 3, 0, 0, 0, 0, 3, 0, 0, 3, 3, 0,		\
+	130, 43, 3, 7,		\
+		5, 0, 0, 3, 0, 0, 0, 0, 5, 3, 0, 0, 0, 2, 0, 5, 3, 0, 0, 2, 0,		\
+	155, 47, 3, 7,		\
+		3, 0, 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 3, 3, 0, 0, 3, 3, 3, 0, 0,		\
+	28, 69, 10, 2,		\
+		0, 6, 6, 0, 0, 0, 0, 2, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 0, 2,		\
+	73, 82, 4, 5,		\
+		4, 0, 0, 3, 3, 0, 4, 3, 0, 0, 3, 3, 4, 0, 0, 0, 0, 0, 4, 0,		\
+	96, 57, 5, 4,		\
+		0, 0, 2, 3, 0, 2, 3, 0, 2, 0, 3, 0, 0, 3, 0, 0, 0, 3, 0, 0,		\
+	124, 40, 5, 4,		\
+		0, 5, 4, 0, 0, 5, 4, 0, 0, 0, 5, 0, 0, 0, 5, 0, 0, 4, 0, 5,		\
+	149, 47, 2, 10,		\
+		0, 0, 3, 3, 3, 0, 0, 3, 0, 0, 3, 3, 0, 0, 0, 3, 3, 0, 3, 0,		\
+	20, 85, 6, 3,		\
+		0, 0, 6, 0, 6, 6, 6, 6, 0, 0, 6, 0, 0, 6, 0, 6, 0, 0,		\
+	64, 67, 6, 3,		\
+		0, 5, 6, 0, 5, 6, 0, 5, 6, 0, 6, 0, 0, 6, 0, 0, 6, 0,		\
+	78, 27, 2, 9,		\
+		6, 6, 0, 0, 0, 0, 4, 5, 0, 0, 0, 6, 0, 0, 0, 0, 5, 0,		\
+	141, 47, 6, 3,		\
+		0, 5, 0, 0, 0, 5, 3, 0, 5, 0, 3, 0, 0, 0, 3, 0, 0, 0,		\
+	32, 16, 8, 2,		\
+		5, 0, 5, 0, 0, 5, 0, 5, 0, 5, 0, 0, 0, 0, 0, 5,		\
+	76, 7, 4, 4,		\
+		0, 0, 0, 0, 2, 2, 2, 0, 0, 0, 0, 2, 0, 0, 0, 0,		\
+	53, 12, 3, 5,		\
+		2, 0, 4, 0, 0, 0, 2, 0, 4, 0, 0, 2, 0, 0, 4,		\
+	60, 38, 3, 5,		\
+		0, 0, 2, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 2,		\
+	62, 14, 5, 3,		\
+		5, 2, 0, 0, 1, 1, 1, 5, 0, 0, 2, 5, 0, 0, 5,		\
+	66, 37, 3, 5,		\
+		0, 1, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1,		\
+	73, 0, 3, 5,		\
+		0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0,		\
+	71, 30, 5, 3,		\
+		0, 5, 0, 0, 5, 0, 4, 0, 5, 4, 0, 5, 0, 4, 5,		\
+	136, 16, 3, 5,		\
+		0, 0, 0, 0, 0, 4, 4, 4, 0, 0, 0, 0, 0, 4, 4,		\
+	142, 5, 3, 5,		\
+		0, 0, 0, 3, 3, 0, 0, 0, 3, 0, 0, 0, 3, 0, 0,		\
+	157, 28, 3, 5,		\
+		0, 0, 3, 0, 0, 0, 3, 0, 0, 0, 3, 0, 0, 0, 0,		\
+	49, 49, 7, 2,		\
+		0, 3, 0, 3, 0, 3, 3, 0, 3, 0, 3, 0, 3, 0,		\
+	77, 49, 7, 2,		\
+		1, 0, 1, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 6,		\
+	88, 61, 7, 2,		\
+		3, 3, 0, 3, 0, 3, 0, 3, 3, 0, 3, 2, 2, 0,		\
+	105, 0, 2, 7,		\
+		1, 0, 0, 0, 0, 3, 0, 0, 1, 0, 0, 0, 0, 3,		\
+	132, 0, 2, 7,		\
+		0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4,		\
+	32, 33, 2, 6,		\
+		0, 0, 5, 5, 5, 0, 5, 5, 0, 6, 6, 6,		\
+	37, 26, 3, 4,		\
+		0, 0, 0, 6, 0, 6, 6, 0, 6, 0, 0, 0,		\
+	39, 24, 6, 2,		\
+		0, 0, 0, 6, 6, 0, 6, 0, 0, 6, 6, 0,		\
+	44, 56, 4, 3,		\
+		4, 0, 0, 0, 4, 0, 0, 0, 4, 0, 0, 4,		\
+	49, 68, 4, 3,		\
+		6, 0, 0, 0, 6, 0, 0, 6, 0, 0, 6, 0,		\
+	61, 71, 3, 4,		\
+		4, 0, 0, 3, 0, 4, 3, 5, 0, 0, 4, 5,		\
+	63, 29, 6, 2,		\
+		0, 1, 0, 0, 5, 0, 5, 0, 5, 0, 0, 5,		\
+	85, 40, 3, 4,		\
+		3, 0, 0, 4, 3, 0, 0, 4, 3, 0, 0, 4,		\
+	110, 3, 3, 4,		\
+		0, 1, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0,		\
+	114, 67, 2, 6,		\
+		0, 0, 0, 0, 2, 0, 0, 0, 2, 2, 0, 0,		\
+	117, 15, 2, 6,		\
+		1, 1, 1, 1, 3, 0, 0, 0, 0, 0, 1, 1,		\
+	137, 39, 3, 4,		\
+		0, 0, 2, 2, 0, 2, 0, 3, 2, 0, 0, 3,		\
+	141, 23, 4, 3,		\
+		0, 0, 3, 3, 3, 3, 0, 3, 3, 0, 3, 3,		\
+	151, 53, 3, 4,		\
+		3, 0, 0, 3, 0, 3, 0, 0, 0, 3, 0, 0,		\
+	154, 60, 4, 3,		\
+		0, 0, 0, 5, 5, 5, 0, 0, 0, 0, 0, 0,		\
+	22, 92, 2, 5,		\
+		0, 0, 5, 5, 0, 0, 5, 0, 0, 0,		\
+	31, 78, 5, 2,		\
+		2, 0, 6, 2, 0, 2, 0, 2, 0, 2,		\
+	38, 71, 2, 5,		\
+		2, 6, 0, 0, 0, 6, 2, 2, 2, 2,		\
+	40, 81, 5, 2,		\
+		0, 6, 0, 6, 6, 0, 6, 0, 6, 0,		\
+	97, 13, 5, 2,		\
+		0, 0, 0, 2, 0, 2, 2, 0, 0, 0,		\
+	108, 74, 2, 5,		\
+		0, 0, 0, 0, 2, 0, 0, 0, 2, 0,		\
+	110, 26, 2, 5,		\
+		0, 2, 0, 0, 0, 5, 2, 5, 5, 5,		\
+	110, 40, 2, 5,		\
+		0, 0, 0, 0, 1, 5, 5, 1, 1, 2,		\
+	116, 32, 2, 5,		\
+		3, 0, 1, 1, 5, 1, 1, 0, 0, 5,		\
+	114, 44, 5, 2,		\
+		0, 4, 0, 4, 0, 4, 4, 0, 4, 0,		\
+	120, 36, 2, 5,		\
+		0, 4, 0, 5, 0, 0, 4, 0, 0, 5,		\
+	6, 113, 3, 3,		\
+		0, 0, 6, 6, 6, 0, 0, 0, 0,		\
+	46, 50, 3, 3,		\
+		0, 3, 0, 0, 3, 0, 6, 6, 6,		\
+	55, 34, 3, 3,		\
+		2, 0, 0, 0, 2, 0, 0, 0, 2,		\
+	86, 85, 3, 3,		\
+		0, 0, 2, 0, 0, 2, 0, 0, 0,		\
+	110, 11, 3, 3,		\
+		3, 0, 0, 0, 3, 0, 5, 5, 3,		\
+	134, 10, 3, 3,		\
+		0, 0, 0, 4, 4, 4, 0, 0, 0,		\
+	152, 44, 3, 3,		\
+		0, 0, 3, 5, 5, 3, 0, 0, 3,		\
+	21, 60, 4, 2,		\
+		0, 0, 0, 0, 5, 5, 0, 0,		\
+	41, 64, 4, 2,		\
+		6, 0, 6, 0, 0, 6, 0, 0,		\
+	43, 111, 2, 4,		\
+		0, 0, 5, 0, 5, 5, 0, 0,		\
+	44, 7, 2, 4,		\
+		4, 0, 0, 2, 0, 4, 0, 2,		\
+	44, 67, 4, 2,		\
+		0, 0, 6, 0, 6, 0, 0, 6,		\
+	47, 19, 4, 2,		\
+		0, 6, 0, 6, 0, 6, 6, 0,		\
+	68, 70, 4, 2,		\
+		0, 3, 3, 0, 3, 0, 3, 0,		\
+	72, 21, 2, 4,		\
+		3, 6, 0, 0, 0, 0, 6, 0,		\
+	72, 64, 2, 4,		\
+		0, 0, 6, 0, 0, 6, 0, 0,		\
+	76, 32, 2, 4,		\
+		4, 5, 0, 0, 0, 5, 0, 0,		\
+	80, 34, 4, 2,		\
+		5, 4, 0, 5, 6, 6, 0, 5,		\
+	81, 51, 4, 2,		\
+		1, 0, 1, 0, 6, 6, 1, 0,		\
+	94, 16, 4, 2,		\
+		2, 0, 2, 0, 2, 0, 0, 0,		\
+	99, 53, 2, 4,		\
+		0, 0, 0, 2, 0, 0, 2, 0,		\
+	155, 24, 2, 4,		\
+		0, 0, 3, 0, 0, 3, 0, 0,		\
+	153, 31, 4, 2,		\
+		0, 3, 0, 3, 3, 0, 3, 0,		\
+	156, 8, 4, 2,		\
+		0, 0, 3, 0, 3, 3, 0, 0,		\
+	0, 4, 2, 3,		\
+		0, 0, 0, 5, 0, 0,		\
+	14, 87, 3, 2,		\
+		0, 6, 0, 6, 0, 6,		\
+	22, 33, 2, 3,		\
+		0, 0, 0, 0, 0, 0,		\
+	28, 67, 3, 2,		\
+		0, 0, 6, 6, 0, 0,		\
+	35, 56, 2, 3,		\
+		6, 6, 0, 0, 0, 6,		\
+	40, 52, 2, 3,		\
+		4, 3, 0, 3, 4, 0,		\
+	46, 71, 2, 3,		\
+		0, 6, 0, 0, 6, 0,		\
+	46, 97, 2, 3,		\
+		5, 5, 5, 0, 0, 0,		\
+	50, 12, 3, 2,		\
+		4, 0, 4, 0, 2, 4,		\
+	54, 75, 3, 2,		\
+		0, 3, 0, 3, 0, 3,		\
+	57, 65, 2, 3,		\
+		0, 0, 4, 0, 0, 0,		\
+	59, 19, 3, 2,		\
+		4, 0, 4, 0, 0, 4,		\
+	62, 31, 2, 3,		\
+		0, 0, 0, 1, 1, 1,		\
+	64, 12, 3, 2,		\
+		0, 1, 1, 0, 0, 0,		\
+	69, 48, 2, 3,		\
+		0, 2, 0, 0, 0, 2,		\
+	71, 44, 3, 2,		\
+		3, 1, 3, 1, 3, 4,		\
+	76, 24, 2, 3,		\
+		0, 6, 0, 0, 0, 6,		\
+	76, 18, 3, 2,		\
+		2, 0, 2, 0, 0, 2,		\
+	82, 89, 2, 3,		\
+		0, 4, 0, 0, 0, 4,		\
+	101, 0, 2, 3,		\
+		0, 3, 0, 0, 0, 3,		\
+	102, 31, 3, 2,		\
+		0, 5, 0, 5, 0, 5,		\
+	110, 54, 2, 3,		\
+		3, 0, 0, 5, 5, 5,		\
+	114, 11, 3, 2,		\
+		0, 0, 1, 1, 0, 0,		\
+	121, 21, 3, 2,		\
+		0, 0, 0, 0, 0, 0,		\
+	131, 27, 3, 2,		\
+		0, 3, 0, 3, 3, 0,		\
+	134, 33, 2, 3,		\
+		2, 3, 0, 2, 3, 0,		\
+	134, 44, 2, 3,		\
+		3, 2, 0, 2, 0, 5,		\
+	137, 113, 2, 3,		\
+		0, 5, 5, 5, 0, 0,		\
+	140, 20, 2, 3,		\
+		3, 3, 0, 0, 0, 3,		\
+	140, 44, 3, 2,		\
+		3, 0, 0, 3, 0, 0,		\
+	146, 52, 3, 2,		\
+		0, 0, 3, 0, 0, 3,		\
+	154, 5, 3, 2,		\
+		0, 3, 0, 3, 0, 0,		\
+	0x15, 6, 4, 2, 2,		\
+		0, 0, 0, 0,		\
+	0x15, 24, 126, 2, 2,		\
+		0, 6, 0, 6,		\
+	0x15, 30, 71, 2, 2,		\
+		2, 6, 0, 6,		\
+	0x15, 33, 46, 2, 2,		\
+		4, 0, 0, 4,		\
+	0x15, 37, 42, 2, 2,		\
+		0, 6, 6, 0,		\
+	0x16, 0x2d, 0x00, 53, 22,		\
+	0x16, 0x17, 0x00, 56, 16,		\
+	0x16, 0x37, 0x00, 59, 111,		\
+	0x16, 0x33, 0x00, 63, 107,		\
+	0x15, 77, 66, 2, 2,		\
+		0, 3, 0, 3,		\
+	0x07, 3, 82, 13, 2, 2,		\
+		0, 2, 0, 0,		\
+	82, 99, 2, 2,		\
+		6, 0, 6, 0,		\
+	88, 25, 2, 2,		\
+		0, 5, 0, 5,		\
+	0x16, 0x64, 0x00, 93, 63,		\
+	0x15, 102, 85, 2, 2,		\
+		0, 2, 2, 0,		\
+	0x15, 110, 74, 2, 2,		\
+		5, 5, 2, 2,		\
+	0x15, 113, 0, 2, 2,		\
+		0, 0, 3, 3,		\
+	0x16, 0x43, 0x00, 114, 51,		\
+	0x15, 130, 41, 2, 2,		\
+		4, 0, 4, 0,		\
+	0x15, 140, 104, 2, 2,		\
+		5, 5, 0, 0,		\
+	0x16, 0x5a, 0x00, 145, 5,		\
+	0x15, 145, 26, 2, 2,		\
+		3, 0, 3, 0,		\
+	0x15, 152, 33, 2, 2,		\
+		3, 0, 0, 0,		\
+	0x15, 158, 23, 2, 2,		\
+		3, 3, 0, 0,		\
+	0x12, 27, 90, 18,		\
+		5, 5, 5, 2, 2, 6, 2, 2, 2, 2, 5, 5, 5, 2, 2, 2, 2, 2,		\
+	0x07, 30, 89, 38, 11,		\
+		5, 5, 0, 3, 3, 3, 3, 0, 0, 0, 0,		\
+	145, 39, 9,		\
+		0, 3, 3, 0, 0, 0, 0, 0, 5,		\
+	96, 94, 7,		\
+		0, 0, 2, 2, 0, 0, 0,		\
+	122, 36, 7,		\
+		4, 4, 4, 4, 4, 0, 0,		\
+	130, 40, 7,		\
+		0, 0, 4, 4, 0, 0, 3,		\
+	13, 30, 6,		\
+		0, 0, 4, 4, 0, 0,		\
+	24, 117, 6,		\
+		0, 0, 0, 0, 0, 0,		\
+	43, 22, 6,		\
+		0, 6, 0, 0, 5, 5,		\
+	55, 110, 6,		\
+		0, 0, 0, 0, 6, 6,		\
+	58, 69, 6,		\
+		0, 4, 0, 0, 0, 0,		\
+	77, 44, 6,		\
+		4, 4, 4, 4, 4, 0,		\
+	83, 37, 6,		\
+		6, 0, 0, 5, 5, 5,		\
+	88, 42, 6,		\
+		4, 4, 4, 4, 4, 4,		\
+	92, 92, 6,		\
+		0, 0, 2, 2, 6, 6,		\
+	96, 51, 6,		\
+		1, 1, 1, 1, 0, 0,		\
+	100, 49, 6,		\
+		0, 0, 1, 1, 0, 0,		\
+	136, 106, 6,		\
+		0, 0, 0, 5, 0, 0,		\
+	27, 80, 5,		\
+		2, 2, 2, 2, 2,		\
+	63, 22, 5,		\
+		4, 0, 0, 0, 0,		\
+	89, 39, 5,		\
+		3, 3, 3, 5, 5,		\
+	101, 40, 5,		\
+		4, 4, 4, 4, 0,		\
+	105, 39, 5,		\
+		4, 4, 4, 4, 4,		\
+	114, 48, 5,		\
+		5, 5, 5, 5, 5,		\
+	121, 27, 5,		\
+		3, 0, 0, 0, 3,		\
+	14, 100, 4,		\
+		6, 0, 0, 0,		\
+	31, 55, 4,		\
+		2, 2, 2, 6,		\
+	37, 37, 4,		\
+		0, 0, 6, 0,		\
+	37, 63, 4,		\
+		0, 0, 0, 6,		\
+	37, 116, 4,		\
+		5, 5, 5, 0,		\
+	50, 29, 4,		\
+		2, 0, 0, 0,		\
+	0x12, 59, 47, 4,		\
+		3, 3, 3, 3,		\
+	0x07, 4, 69, 3, 4,		\
+		0, 0, 1, 1,		\
+	78, 75, 4,		\
+		0, 0, 3, 0,		\
+	80, 72, 4,		\
+		6, 6, 6, 6,		\
+	92, 60, 4,		\
+		0, 0, 3, 2,		\
+	0x16, 0x26, 0x00, 96, 37,		\
+	0x12, 136, 108, 4,		\
+		0, 0, 0, 5,		\
+	0x12, 13, 19, 3,		\
+		1, 0, 0,		\
+	0x12, 17, 87, 3,		\
+		6, 6, 6,		\
+	0x12, 24, 92, 3,		\
+		5, 5, 0,		\
+	0x12, 26, 73, 3,		\
+		0, 6, 0,		\
+	0x12, 27, 89, 3,		\
+		0, 0, 0,		\
+	0x12, 27, 116, 3,		\
+		5, 5, 5,		\
+	0x12, 28, 43, 3,		\
+		0, 0, 4,		\
+	0x16, 0x1c, 0x00, 30, 61,		\
+	0x16, 0x2f, 0x00, 33, 83,		\
+	0x16, 0x18, 0x00, 37, 18,		\
+	0x16, 0x2b, 0x00, 40, 31,		\
+	0x12, 40, 114, 3,		\
+		0, 5, 5,		\
+	0x16, 0x3e, 0x00, 63, 28,		\
+	0x16, 0x27, 0x00, 65, 77,		\
+	0x12, 67, 16, 3,		\
+		2, 2, 2,		\
+	0x16, 0x41, 0x00, 73, 29,		\
+	0x12, 74, 64, 3,		\
+		6, 6, 0,		\
+	0x12, 76, 80, 3,		\
+		3, 0, 0,		\
+	0x07, 3, 111, 72, 3,		\
+		0, 0, 2,		\
+	121, 43, 3,		\
+		4, 4, 4,		\
+	134, 27, 3,		\
+		3, 3, 3,		\
+	0x16, 0x1b, 0x00, 151, 47,		\
+	0x12, 0, 20, 2,		\
+		0, 0,		\
+	0x12, 8, 26, 2,		\
+		0, 1,		\
+	0x12, 13, 29, 2,		\
+		0, 4,		\
+	0x16, 0x12, 0x00, 26, 38,		\
+	0x12, 28, 48, 2,		\
+		5, 0,		\
+	0x16, 0x1d, 0x00, 28, 123,		\
+	0x12, 30, 77, 2,		\
+		2, 0,		\
+	0x16, 0x28, 0x00, 36, 21,		\
+	0x12, 43, 23, 2,		\
+		6, 6,		\
+	0x12, 46, 18, 2,		\
+		6, 0,		\
+	0x12, 57, 75, 2,		\
+		3, 3,		\
+	0x16, 0x06, 0x00, 59, 74,		\
+	0x12, 60, 14, 2,		\
+		2, 5,		\
+	0x16, 0x44, 0x00, 62, 17,		\
+	0x16, 0x43, 0x00, 63, 23,		\
+	0x16, 0x32, 0x00, 64, 44,		\
+	0x16, 0x59, 0x00, 65, 7,		\
+	0x16, 0x5e, 0x00, 66, 80,		\
+	0x16, 0x63, 0x00, 67, 104,		\
+	0x16, 0x68, 0x00, 68, 8,		\
+	0x12, 69, 30, 2,		\
+		5, 5,		\
+	0x16, 0x46, 0x00, 70, 21,		\
+	0x16, 0x4b, 0x00, 70, 67,		\
+	0x16, 0x7d, 0x00, 70, 69,		\
+	0x16, 0x82, 0x00, 71, 4,		\
+	0x16, 0x87, 0x00, 74, 21,		\
+	0x16, 0x5f, 0x00, 74, 24,		\
+	0x16, 0x91, 0x00, 80, 76,		\
+	0x12, 81, 53, 2,		\
+		0, 6,		\
+	0x16, 0x69, 0x00, 83, 38,		\
+	0x12, 84, 20, 2,		\
+		2, 2,		\
+	0x16, 0xa7, 0x00, 84, 100,		\
+	0x16, 0x0b, 0x00, 86, 21,		\
+	0x16, 0xb1, 0x00, 89, 67,		\
+	0x16, 0x15, 0x00, 96, 93,		\
+	0x12, 100, 50, 2,		\
+		1, 1,		\
+	0x16, 0xc1, 0x00, 104, 7,		\
+	0x16, 0x0b, 0x00, 104, 48,		\
+	0x16, 0x10, 0x00, 108, 3,		\
+	0x16, 0x2f, 0x00, 108, 26,		\
+	0x16, 0xd5, 0x00, 110, 14,		\
+	0x16, 0x6d, 0x00, 122, 40,		\
+	0x12, 141, 46, 2,		\
+		0, 3,		\
+	0x13, 112, 40, 17,		\
+		0, 1, 0, 0, 0, 0, 4, 0, 5, 0, 0, 0, 0, 3, 0, 0, 0,		\
+	0x07, 5, 31, 38, 11,		\
+		5, 5, 5, 0, 0, 0, 4, 0, 0, 0, 2,		\
+	103, 0, 11,		\
+		0, 0, 0, 3, 0, 0, 0, 2, 2, 2, 0,		\
+	29, 71, 7,		\
+		0, 2, 2, 2, 2, 2, 0,		\
+	104, 80, 7,		\
+		0, 0, 0, 2, 2, 0, 0,		\
+	22, 110, 6,		\
+		0, 5, 5, 0, 0, 0,		\
+	0x13, 63, 49, 6,		\
+		5, 5, 5, 5, 5, 5,		\
+	0x07, 3, 68, 49, 6,		\
+		2, 2, 2, 2, 2, 2,		\
+	72, 85, 6,		\
+		0, 0, 3, 0, 0, 0,		\
+	105, 98, 6,		\
+		1, 1, 1, 1, 1, 1,		\
+	0x16, 0x27, 0x00, 109, 98,		\
+	0x13, 154, 54, 6,		\
+		3, 5, 5, 5, 5, 5,		\
+	0x13, 32, 73, 5,		\
+		6, 6, 6, 6, 6,		\
+	0x16, 0x09, 0x00, 32, 91,		\
+	0x13, 44, 91, 5,		\
+		0, 0, 0, 5, 5,		\
+	0x07, 4, 64, 33, 5,		\
+		0, 1, 1, 5, 0,		\
+	76, 53, 5,		\
+		0, 0, 0, 2, 2,		\
+	134, 5, 5,		\
+		0, 0, 4, 4, 4,		\
+	20, 107, 4,		\
+		5, 5, 5, 0,		\
+	0x13, 53, 60, 4,		\
+		0, 0, 0, 0,		\
+	0x13, 73, 69, 4,		\
+		3, 0, 0, 0,		\
+	0x13, 107, 0, 4,		\
+		0, 0, 1, 0,		\
+	0x16, 0x18, 0x00, 109, 79,		\
+	0x13, 110, 69, 4,		\
+		5, 5, 5, 5,		\
+	0x07, 4, 112, 7, 4,		\
+		1, 0, 0, 5,		\
+	116, 19, 4,		\
+		3, 3, 0, 0,		\
+	120, 43, 4,		\
+		0, 4, 0, 0,		\
+	120, 49, 4,		\
+		0, 3, 0, 0,		\
+	0x13, 122, 57, 4,		\
+		0, 0, 0, 2,		\
+	0x16, 0x08, 0x00, 126, 52,		\
+	0x13, 27, 54, 3,		\
+		0, 0, 0,		\
+	0x07, 4, 69, 42, 3,		\
+		1, 1, 0,		\
+	73, 46, 3,		\
+		1, 0, 0,		\
+	81, 83, 3,		\
+		0, 2, 0,		\
+	82, 41, 3,		\
+		3, 0, 4,		\
+	0x13, 88, 88, 3,		\
+		2, 0, 0,		\
+	0x13, 93, 89, 3,		\
+		0, 0, 2,		\
+	0x16, 0x0e, 0x00, 100, 95,		\
+	0x13, 101, 10, 3,		\
+		0, 2, 2,		\
+	0x13, 105, 105, 3,		\
+		1, 1, 1,		\
+	0x16, 0x42, 0x00, 118, 62,		\
+	0x13, 125, 47, 3,		\
+		0, 3, 0,		\
+	0x07, 5, 136, 13, 3,		\
+		4, 4, 4,		\
+	145, 40, 3,		\
+		3, 0, 0,		\
+	153, 36, 3,		\
+		0, 0, 5,		\
+	153, 40, 3,		\
+		5, 5, 5,		\
+	6, 31, 2,		\
+		0, 1,		\
+	0x13, 13, 105, 2,		\
+		0, 0,		\
+	0x13, 20, 96, 2,		\
+		0, 5,		\
+	0x13, 30, 41, 2,		\
+		5, 5,		\
+	0x13, 31, 84, 2,		\
+		6, 0,		\
+	0x16, 0x18, 0x00, 45, 26,		\
+	0x13, 48, 53, 2,		\
+		6, 6,		\
+	0x13, 54, 32, 2,		\
+		0, 2,		\
+	0x16, 0x29, 0x00, 55, 37,		\
+	0x16, 0x2e, 0x00, 59, 41,		\
+	0x16, 0x33, 0x00, 63, 19,		\
+	0x16, 0x38, 0x00, 63, 34,		\
+	0x13, 65, 36, 2,		\
+		1, 1,		\
+	0x16, 0x20, 0x00, 72, 51,		\
+	0x13, 77, 42, 2,		\
+		0, 3,		\
+	0x13, 83, 15, 2,		\
+		2, 0,		\
+	0x13, 88, 40, 2,		\
+		3, 0,		\
+	0x16, 0x37, 0x00, 101, 53,		\
+	0x16, 0x0b, 0x00, 105, 56,		\
+	0x16, 0x27, 0x00, 105, 109,		\
+	0x16, 0x5d, 0x00, 111, 31,		\
+	0x16, 0x31, 0x00, 114, 9,		\
+	0x13, 117, 21, 2,		\
+		3, 3,		\
+	0x16, 0x79, 0x00, 121, 51,		\
+	0x13, 129, 43, 2,		\
+		5, 2,		\
+	0x16, 0x84, 0x00, 131, 11,		\
+	0x16, 0x7d, 0x00, 138, 111,		\
+	0x16, 0x46, 0x00, 140, 41,		\
+	0x16, 0x20, 0x00, 146, 50,		\
+	0x01, 0, 14, 28,		\
+	0x21, 18, 31,		\
+	0x07, 19, 37, 19,		\
+	37, 117,		\
+	43, 95,		\
+	48, 73,		\
+	49, 30,		\
+	55, 17,		\
+	62, 30,		\
+	73, 90,		\
+	84, 50,		\
+	90, 25,		\
+	94, 27,		\
+	102, 54,		\
+	106, 110,		\
+	125, 26,		\
+	136, 26,		\
+	139, 20,		\
+	140, 23,		\
+	147, 26,		\
+	154, 24,		\
+	0x01, 1, 12, 20,		\
+	0x21, 70, 44,		\
+	0x21, 113, 40,		\
+	0x21, 115, 36,		\
+	0x01, 2, 79, 11,		\
+	0x21, 79, 19,		\
+	0x07, 8, 82, 63,		\
+	84, 16,		\
+	97, 15,		\
+	102, 10,		\
+	110, 76,		\
+	112, 73,		\
+	116, 28,		\
+	130, 50,		\
+	0x01, 3, 76, 81,		\
+	0x21, 111, 53,		\
+	0x07, 6, 130, 28,		\
+	149, 23,		\
+	156, 7,		\
+	157, 24,		\
+	159, 10,		\
+	159, 22,		\
+	0x01, 4, 42, 54,		\
+	0x21, 58, 68,		\
+	0x21, 64, 74,		\
+	0x21, 77, 86,		\
+	0x01, 5, 6, 6,		\
+	0x21, 19, 11,		\
+	0x07, 14, 21, 96,		\
+	21, 110,		\
+	24, 59,		\
+	26, 54,		\
+	26, 91,		\
+	36, 26,		\
+	40, 115,		\
+	45, 96,		\
+	45, 110,		\
+	46, 109,		\
+	53, 24,		\
+	118, 36,		\
+	136, 46,		\
+	139, 109,		\
+	0x01, 6, 28, 71,		\
+	0x21, 30, 66,		\
+	0x07, 10, 32, 60,		\
+	40, 36,		\
+	42, 30,		\
+	44, 66,		\
+	50, 115,		\
+	59, 127,		\
+	73, 104,		\
+	76, 63,		\
+	83, 36,		\
+	99, 127,		\
+	0xff
+
+#endif  //  LINEART_H_INCLUDED
+
@@ -0,0 +1,280 @@
+/*
+ *  ST7735 Huffman Coded Image (draw with drawHuffImage())
+ *  Original: lineart.png
+ *  Commands: 8620 bytes, coded: 4145 (code tables and bitstream); total 4160 vs. 6593 bytes
+ */
+
+#ifndef LINEART_HUFF_H_INCLUDED
+#define LINEART_HUFF_H_INCLUDED
+
+#define LINEART_WIDTH		160
+#define LINEART_HEIGHT		128
+#define LINEART_HUFF_LEN		4160	/*  Total array size  */
+
+#define LINEART_HUFF		\
+	7,		\
+	0xff, 0xff,	0x00, 0x00,	0xcf, 0x7b,	0x60, 0xe4,		\
+	0xf9, 0x19,	0x65, 0x14,	0xe3, 0xc8,		\
+	0x00, 0x01, 0x04, 0x02, 0x03, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0x03, 0x21,	\
+	0x23, 0x02, 0x22, 0x05, 0x15, 0x25, 0x12, 0x13, 0xff, 0x00, 0x00, 0x01, 0x02, 0x03, 0x05, 0x25,	\
+	0x35, 0x21, 0x0d, 0x08, 0x04, 0x04, 0x02, 0x03, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x15,	\
+	0x00, 0x0c, 0x0d, 0x0e, 0x0f, 0x12, 0x13, 0x14, 0x16, 0x18, 0x1a, 0x1b, 0x1c, 0x1e, 0x1f, 0x20,	\
+	0x21, 0x24, 0x25, 0x28, 0x2c, 0x2e, 0x31, 0x32, 0x35, 0x3f, 0x40, 0x45, 0x49, 0x4a, 0x4c, 0x50,	\
+	0x54, 0x58, 0x69, 0x6e, 0x6f, 0x10, 0x11, 0x17, 0x19, 0x1d, 0x22, 0x26, 0x27, 0x29, 0x2a, 0x2b,	\
+	0x2d, 0x2f, 0x30, 0x33, 0x36, 0x37, 0x38, 0x39, 0x3b, 0x3c, 0x41, 0x42, 0x43, 0x46, 0x47, 0x48,	\
+	0x4b, 0x4d, 0x51, 0x52, 0x53, 0x55, 0x56, 0x59, 0x5b, 0x5c, 0x60, 0x62, 0x64, 0x65, 0x68, 0x6a,	\
+	0x6c, 0x6d, 0x70, 0x71, 0x72, 0x74, 0x76, 0x7e, 0x88, 0x8c, 0x23, 0x34, 0x3a, 0x3d, 0x3e, 0x44,	\
+	0x4e, 0x4f, 0x57, 0x5a, 0x5d, 0x5e, 0x5f, 0x61, 0x66, 0x6b, 0x73, 0x75, 0x78, 0x79, 0x7a, 0x7c,	\
+	0x7f, 0x82, 0x86, 0x89, 0x8d, 0x91, 0x92, 0x93, 0x9a, 0x9b, 0x9d, 0x63, 0x67, 0x77, 0x7b, 0x83,	\
+	0x84, 0x85, 0x8b, 0x8e, 0x97, 0x99, 0x9c, 0x9e, 0x7d, 0x81, 0x8a, 0x8f, 0x94, 0x95, 0x98, 0x9f,	\
+	0x01, 0x87, 0x90, 0x96, 0x01, 0x00, 0x03, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	\
+	0x00, 0x03, 0x05, 0x06, 0x02, 0x01, 0x04, 0xe3, 0xa2, 0x85, 0xd3, 0xff, 0x36, 0x9c, 0xf6, 0xec,	\
+	0x6d, 0x8d, 0xc9, 0xd7, 0x71, 0xc3, 0xc9, 0x74, 0xeb, 0xab, 0x85, 0xeb, 0xdc, 0x3d, 0x98, 0x0e,	\
+	0x1a, 0xf1, 0xdc, 0xb8, 0xe3, 0xa6, 0xe6, 0xe1, 0xb7, 0x33, 0xf6, 0xf0, 0xdb, 0x5e, 0xaa, 0xab,	\
+	0x66, 0x9c, 0x74, 0x57, 0x72, 0xef, 0xf0, 0x6c, 0xcb, 0x5f, 0x1a, 0xed, 0xde, 0x7e, 0xcc, 0x5b,	\
+	0xb8, 0x6d, 0xde, 0x61, 0xf6, 0xa6, 0x8b, 0xe6, 0x2f, 0xae, 0xdc, 0xb9, 0x5a, 0x2a, 0xef, 0x5e,	\
+	0x34, 0xe9, 0xbc, 0xbd, 0x37, 0x8b, 0xfb, 0xa6, 0xb7, 0x70, 0xd9, 0x77, 0x0c, 0xfb, 0x9b, 0x40,	\
+	0x43, 0x66, 0x84, 0x5d, 0xc7, 0x4e, 0x57, 0x93, 0xe8, 0x74, 0xb6, 0xbe, 0xe3, 0xc4, 0xf8, 0xbb,	\
+	0x2e, 0x95, 0xee, 0x84, 0xf1, 0x15, 0xf0, 0x1d, 0xa3, 0xfa, 0xa0, 0x52, 0xab, 0x43, 0x72, 0x96,	\
+	0x7c, 0xab, 0xae, 0xee, 0x4a, 0xeb, 0xe2, 0xe3, 0xae, 0xbd, 0x3e, 0xfa, 0xcc, 0x59, 0xdc, 0x70,	\
+	0x9a, 0x18, 0xea, 0x67, 0x73, 0xbc, 0xca, 0xb6, 0x68, 0xbc, 0x11, 0x19, 0x74, 0x8c, 0x3d, 0xf7,	\
+	0x48, 0x9a, 0xa7, 0x48, 0x7b, 0x49, 0x2d, 0xf3, 0x90, 0x96, 0xfc, 0xb3, 0x96, 0x5d, 0xae, 0xd2,	\
+	0x98, 0xfc, 0x9c, 0x21, 0xcf, 0x66, 0xcb, 0xe3, 0xb6, 0x74, 0xe1, 0x10, 0x6d, 0x38, 0x46, 0xac,	\
+	0xeb, 0x61, 0x5a, 0xc3, 0x46, 0xd9, 0xb4, 0x32, 0x8d, 0x59, 0xba, 0x33, 0x34, 0xd2, 0xc5, 0x19,	\
+	0x0d, 0xd1, 0xf4, 0x8c, 0x96, 0x18, 0xef, 0x07, 0x33, 0x31, 0x1c, 0x8f, 0x45, 0x04, 0xaf, 0xec,	\
+	0xc6, 0x4a, 0xfd, 0x31, 0xed, 0xcd, 0xff, 0x3b, 0x08, 0x89, 0x41, 0x84, 0x09, 0x07, 0x6c, 0xed,	\
+	0x4d, 0xc6, 0x7d, 0x86, 0xe3, 0xe5, 0x90, 0xb2, 0x7c, 0xcd, 0x83, 0x2d, 0xb8, 0x92, 0xa7, 0x0d,	\
+	0x25, 0x58, 0xd0, 0x94, 0x9a, 0xd6, 0x5a, 0x27, 0xf1, 0x96, 0x46, 0xec, 0x16, 0x05, 0x67, 0x0e,	\
+	0x0f, 0xfa, 0x94, 0x4f, 0x03, 0x41, 0x7c, 0x08, 0x49, 0x4e, 0x35, 0xe8, 0x5e, 0x66, 0x7b, 0x73,	\
+	0xd4, 0xc8, 0x4a, 0x6b, 0x57, 0x0b, 0xeb, 0xbb, 0x6e, 0x7b, 0x1a, 0xcb, 0x8e, 0x78, 0xab, 0x88,	\
+	0xdb, 0x2a, 0x44, 0x9a, 0x48, 0x55, 0xf6, 0x4a, 0x91, 0xff, 0xa8, 0x52, 0x21, 0x4d, 0x2b, 0x7c,	\
+	0xb8, 0xcc, 0x9d, 0x58, 0x2c, 0x9e, 0xb4, 0xc6, 0x4f, 0x82, 0xc3, 0x27, 0xf1, 0x53, 0x26, 0xff,	\
+	0xc0, 0xb0, 0x8b, 0xeb, 0x58, 0x68, 0x63, 0x85, 0xbc, 0x8c, 0xac, 0x16, 0x0c, 0x1b, 0x9d, 0xe4,	\
+	0x25, 0xa9, 0xa6, 0xc5, 0xdc, 0x73, 0x63, 0xd6, 0xd2, 0x51, 0x87, 0xcc, 0xa1, 0xa5, 0x88, 0x15,	\
+	0xea, 0x9a, 0x15, 0xeb, 0xb4, 0xe4, 0xb7, 0xbb, 0x0b, 0x9f, 0xed, 0xb8, 0x6b, 0xff, 0x99, 0x4b,	\
+	0x9c, 0x6a, 0x48, 0x46, 0x1b, 0x94, 0x21, 0xb1, 0x37, 0x27, 0x0d, 0xd6, 0x37, 0x64, 0xdc, 0xb0,	\
+	0x6d, 0x24, 0x50, 0x98, 0x13, 0x4e, 0x8a, 0x46, 0x96, 0x0a, 0x46, 0xd7, 0x89, 0x63, 0xdf, 0xa6,	\
+	0x13, 0xc8, 0xf0, 0xd6, 0xf4, 0xca, 0x58, 0xfd, 0x7c, 0x0d, 0xcb, 0xdf, 0xcc, 0x4d, 0xf6, 0x6e,	\
+	0x59, 0x2b, 0x59, 0x04, 0xcf, 0xb5, 0xb1, 0x33, 0xd3, 0x19, 0x92, 0x73, 0xb0, 0x6a, 0x91, 0x0c,	\
+	0xd5, 0x23, 0x1d, 0x47, 0x8c, 0xf9, 0x47, 0x9a, 0xb9, 0xaa, 0x96, 0x89, 0xaa, 0xa3, 0x26, 0xad,	\
+	0x26, 0xc6, 0xaf, 0x54, 0x85, 0x1f, 0xca, 0x4a, 0x8d, 0xaa, 0xe8, 0x11, 0xb2, 0x42, 0x2f, 0x28,	\
+	0xb0, 0x52, 0xf4, 0x42, 0x26, 0x63, 0xa0, 0x4d, 0xb9, 0x40, 0xec, 0x5d, 0xa0, 0x64, 0xf7, 0x18,	\
+	0x2d, 0xd9, 0x0c, 0x17, 0x04, 0x90, 0x8b, 0x1a, 0xa8, 0x1c, 0x13, 0x50, 0x39, 0x7b, 0x41, 0x1c,	\
+	0xb2, 0x50, 0x39, 0xf7, 0xd0, 0x3a, 0x5a, 0x08, 0xea, 0xae, 0x4c, 0x49, 0xb6, 0x49, 0xd2, 0xef,	\
+	0x24, 0xfb, 0xba, 0x46, 0x9e, 0xe3, 0xf4, 0x9d, 0x5d, 0xe4, 0x9e, 0xe4, 0x64, 0x9f, 0xdf, 0xe1,	\
+	0x49, 0xf0, 0x6e, 0x1a, 0x7d, 0x7e, 0x32, 0x5f, 0xfd, 0x3f, 0x49, 0xfd, 0x71, 0x4d, 0x2d, 0x94,	\
+	0xb1, 0x3b, 0x8e, 0x05, 0xd3, 0xb5, 0x8a, 0x1a, 0xeb, 0x15, 0xec, 0x92, 0x5a, 0x65, 0x00, 0x32,	\
+	0x70, 0x00, 0xc9, 0xcb, 0x03, 0xb6, 0xf8, 0x0d, 0x0b, 0x90, 0x29, 0x4c, 0x03, 0xba, 0xe8, 0x0a,	\
+	0xfb, 0x20, 0x6b, 0xdc, 0x2c, 0x5c, 0xd4, 0x40, 0xfc, 0x72, 0x80, 0xe8, 0xc3, 0x02, 0xe7, 0x20,	\
+	0xd1, 0x01, 0x94, 0x1c, 0x1d, 0x34, 0x1c, 0x1d, 0x74, 0x1e, 0x0d, 0xc2, 0x0f, 0x4a, 0x7a, 0x0f,	\
+	0x85, 0xb2, 0x0f, 0x8e, 0xe9, 0x07, 0xfb, 0xe1, 0x9a, 0x31, 0xe6, 0x28, 0xa8, 0x44, 0x51, 0x6a,	\
+	0x6d, 0x12, 0xb7, 0x8c, 0x95, 0xbb, 0xd0, 0xa2, 0xea, 0x70, 0x4a, 0x5e, 0x10, 0x3b, 0x7d, 0xb3,	\
+	0x0f, 0x36, 0x8c, 0x5c, 0x59, 0x06, 0xff, 0xf1, 0x07, 0x76, 0xd1, 0x26, 0xef, 0x9c, 0x1d, 0xe2,	\
+	0x92, 0x52, 0xf6, 0x49, 0x33, 0x9e, 0x24, 0xbb, 0x0e, 0x81, 0xf6, 0x1b, 0xa4, 0xa7, 0xbf, 0x31,	\
+	0x42, 0xf0, 0x93, 0x3f, 0x7c, 0x1d, 0x16, 0xc0, 0xf5, 0xa5, 0x18, 0xd9, 0xcb, 0x07, 0xb5, 0x90,	\
+	0x0f, 0xc3, 0xb0, 0x0f, 0xca, 0x0c, 0x58, 0x88, 0x92, 0xe0, 0x7e, 0x92, 0xf6, 0xc7, 0x31, 0xf9,	\
+	0xa8, 0x93, 0xed, 0xba, 0x07, 0xee, 0xc2, 0x07, 0xef, 0x60, 0x93, 0xfc, 0x42, 0x06, 0xb3, 0x44,	\
+	0x85, 0xed, 0x12, 0x1c, 0x29, 0x04, 0xf6, 0xd1, 0x21, 0xfc, 0xd2, 0x44, 0x0e, 0xe2, 0x0a, 0x1e,	\
+	0x39, 0x22, 0x0e, 0xca, 0x0a, 0x24, 0xd2, 0x44, 0x6d, 0x34, 0x14, 0x98, 0x04, 0x8b, 0xc7, 0xc8,	\
+	0x29, 0x33, 0x50, 0x57, 0xde, 0x64, 0x16, 0x04, 0xe4, 0x14, 0xee, 0xda, 0x0a, 0x8e, 0x21, 0x23,	\
+	0x37, 0x41, 0x05, 0x9f, 0x2c, 0x91, 0x52, 0x09, 0x22, 0x9b, 0xe4, 0x16, 0x9b, 0x48, 0x2d, 0x89,	\
+	0x28, 0x2f, 0x14, 0x14, 0x16, 0xf5, 0xf2, 0x0b, 0x9a, 0xe0, 0x91, 0xee, 0x59, 0x68, 0x23, 0xb1,	\
+	0xcb, 0x31, 0x05, 0xf9, 0x4d, 0x24, 0x7e, 0x77, 0xc8, 0x2e, 0xa8, 0x08, 0x2f, 0x9e, 0x11, 0x22,	\
+	0x15, 0xe1, 0x9c, 0x9f, 0x01, 0x9c, 0x9b, 0x46, 0x77, 0xd9, 0x86, 0x78, 0x34, 0x0c, 0xe6, 0x44,	\
+	0x33, 0xcc, 0xbf, 0x33, 0xa7, 0x96, 0x67, 0xa7, 0xae, 0x67, 0xab, 0x6e, 0x67, 0xf7, 0xce, 0x33,	\
+	0xdf, 0x58, 0xce, 0xd5, 0x13, 0x3f, 0x96, 0x29, 0x9f, 0xd6, 0x51, 0x9f, 0xd9, 0x06, 0x7f, 0x6b,	\
+	0x93, 0x31, 0x0c, 0x82, 0x78, 0x88, 0x31, 0xbc, 0x41, 0xd4, 0x20, 0x56, 0xf5, 0xc8, 0x3b, 0x98,	\
+	0x41, 0xda, 0x01, 0x43, 0xa4, 0x42, 0x17, 0x40, 0x28, 0xfe, 0xa0, 0x57, 0x9e, 0x70, 0x52, 0xb9,	\
+	0xc1, 0x4d, 0xd1, 0x05, 0x89, 0x68, 0x16, 0x37, 0x40, 0x2c, 0x9d, 0x10, 0x59, 0x90, 0x41, 0x66,	\
+	0xf9, 0x41, 0x67, 0x5f, 0x82, 0xa9, 0xa2, 0x42, 0x9e, 0xe8, 0x2d, 0x2a, 0xc0, 0xb4, 0xe4, 0x10,	\
+	0xd6, 0xbc, 0x05, 0xb7, 0x30, 0x16, 0xe6, 0xb0, 0x2e, 0x0c, 0x70, 0x56, 0x54, 0x43, 0x8e, 0xec,	\
+	0x17, 0x9d, 0x92, 0x1e, 0x8b, 0xe0, 0x5e, 0x8c, 0x20, 0x5d, 0x10, 0x01, 0x74, 0xca, 0x05, 0xd5,	\
+	0x7a, 0x0b, 0xfc, 0xf8, 0x48, 0x73, 0x45, 0xcf, 0x49, 0x7a, 0x4e, 0x7a, 0x0b, 0x19, 0x5e, 0xcb,	\
+	0xdd, 0xd7, 0xa6, 0xec, 0x7b, 0xeb, 0xe2, 0x75, 0x5b, 0x85, 0x9f, 0x0d, 0xeb, 0x3c, 0x1c, 0x4c,	\
+	0xf8, 0xb8, 0x98, 0xa7, 0xbe, 0xbb, 0xe0, 0xb4, 0x8d, 0x85, 0xb0, 0xb8, 0x96, 0xef, 0xb4, 0xb7,	\
+	0xff, 0xdc, 0x2d, 0x06, 0xca, 0xa1, 0xf3, 0x2a, 0xf3, 0x55, 0x55, 0xb4, 0x15, 0xde, 0xb6, 0x56,	\
+	0xc4, 0x85, 0x6d, 0xf5, 0xd5, 0xf3, 0x4a, 0xbe, 0x7d, 0x65, 0x67, 0x46, 0xc3, 0x8f, 0xbd, 0x6c,	\
+	0x6b, 0xb1, 0x32, 0xea, 0xbd, 0x97, 0xdf, 0x7b, 0xeb, 0xb2, 0xea, 0x35, 0x56, 0xfe, 0x5b, 0x2c,	\
+	0x77, 0xad, 0xd5, 0x97, 0x3b, 0xb7, 0x2b, 0x6b, 0x47, 0x88, 0x2b, 0x5e, 0x94, 0x0d, 0x6c, 0x37,	\
+	0x99, 0x91, 0xed, 0xe5, 0xd3, 0x71, 0xc9, 0x49, 0xc4, 0x3d, 0x85, 0x43, 0xf3, 0xab, 0x36, 0x4f,	\
+	0x45, 0xf6, 0xc4, 0x98, 0xec, 0x44, 0x5d, 0xb7, 0x13, 0x9d, 0xb3, 0x3b, 0x39, 0x96, 0xa6, 0x2e,	\
+	0xd6, 0x82, 0xd9, 0x35, 0x77, 0xfa, 0xdb, 0xab, 0xc7, 0xd6, 0x19, 0xfd, 0x30, 0x20, 0xfe, 0x93,	\
+	0xe0, 0xb8, 0x7b, 0x73, 0x84, 0xd3, 0xae, 0x9e, 0xb3, 0x24, 0xf5, 0x85, 0xa2, 0x2e, 0xb7, 0x5d,	\
+	0x79, 0xed, 0x2b, 0xe6, 0x85, 0x7c, 0xe0, 0xab, 0x3d, 0x8d, 0xc5, 0x0b, 0x7c, 0x5c, 0x2f, 0x85,	\
+	0xba, 0x7c, 0xad, 0x58, 0xf1, 0xbc, 0xe7, 0xe1, 0x77, 0x62, 0xd3, 0x7b, 0xbb, 0x2c, 0xd6, 0xe2,	\
+	0x67, 0x5b, 0xae, 0xcc, 0xbb, 0x2b, 0xb7, 0xda, 0x83, 0xfb, 0x6a, 0xa3, 0x43, 0x1f, 0x5a, 0x6e,	\
+	0x7e, 0xde, 0x27, 0x1f, 0xf5, 0x96, 0x7f, 0x9a, 0x0c, 0x59, 0xae, 0xbc, 0x1b, 0xe5, 0x9e, 0xee,	\
+	0xaa, 0x35, 0xea, 0xa5, 0xee, 0xab, 0x94, 0x94, 0xff, 0x9f, 0x89, 0x6d, 0x74, 0x28, 0xdb, 0x3e,	\
+	0xfd, 0x6c, 0xbb, 0xbe, 0xd6, 0x6d, 0xc5, 0x79, 0x79, 0x1d, 0x40, 0xaa, 0xce, 0x5e, 0x9a, 0xf0,	\
+	0xf0, 0xd6, 0xa8, 0xd9, 0x5b, 0xed, 0x95, 0xfd, 0xe3, 0xa9, 0xde, 0x4b, 0xe8, 0x37, 0xf9, 0xa6,	\
+	0xe4, 0x73, 0x3f, 0x1d, 0xc7, 0xe1, 0x1d, 0xc4, 0xf8, 0xed, 0xf8, 0xdc, 0xb7, 0xb3, 0x90, 0xcd,	\
+	0x9d, 0x26, 0x75, 0x6f, 0x58, 0xfa, 0xd0, 0x63, 0x8a, 0xba, 0xf6, 0xb0, 0x56, 0x79, 0xba, 0xac,	\
+	0x2d, 0xd5, 0x7d, 0x30, 0x95, 0xf6, 0xae, 0xa7, 0xb0, 0x73, 0xee, 0x6b, 0xd9, 0x8f, 0xc1, 0x87,	\
+	0x8f, 0x6f, 0x5a, 0xf5, 0x98, 0xb7, 0xac, 0x45, 0xaa, 0xbb, 0x8a, 0x88, 0xfa, 0xdb, 0xc4, 0x7c,	\
+	0x23, 0xf4, 0x94, 0xf3, 0x90, 0x99, 0xd5, 0xb0, 0xaf, 0x3d, 0x85, 0x7e, 0xae, 0x14, 0xfd, 0xda,	\
+	0x78, 0xcd, 0xfc, 0x77, 0x18, 0xea, 0x92, 0xb2, 0xd4, 0x02, 0x80, 0xa0, 0x28, 0x05, 0x01, 0x40,	\
+	0x28, 0x0a, 0x03, 0x67, 0xac, 0xac, 0xb5, 0x00, 0xa0, 0x28, 0x0a, 0x01, 0x40, 0x50, 0x0a, 0x02,	\
+	0x85, 0x57, 0xcb, 0x2d, 0x40, 0x28, 0x0a, 0x02, 0x80, 0x50, 0x14, 0x02, 0x80, 0xa1, 0x8a, 0xfd,	\
+	0x65, 0xa8, 0x05, 0x01, 0x40, 0x50, 0x0a, 0x02, 0x80, 0x50, 0x14, 0x3c, 0x30, 0x96, 0x5a, 0x80,	\
+	0x50, 0x14, 0x05, 0x00, 0xa0, 0x28, 0x05, 0x01, 0x42, 0xbf, 0x81, 0x65, 0x86, 0x01, 0x80, 0xc0,	\
+	0x30, 0x18, 0x06, 0x03, 0x00, 0xc0, 0x29, 0xee, 0xac, 0xb0, 0xc0, 0x30, 0x18, 0x06, 0x03, 0x00,	\
+	0xc0, 0x60, 0x18, 0x06, 0x25, 0xa5, 0x96, 0x18, 0x06, 0x03, 0x00, 0xc0, 0x60, 0x18, 0x0c, 0x03,	\
+	0x00, 0xbf, 0xf3, 0x2c, 0xb0, 0xc0, 0x30, 0x18, 0x06, 0x03, 0x00, 0xc0, 0x60, 0x18, 0x05, 0xdf,	\
+	0xe0, 0xb2, 0xc3, 0x00, 0xc0, 0x60, 0x18, 0x0c, 0x03, 0x01, 0x80, 0x60, 0x19, 0x77, 0x00, 0x7c,	\
+	0x3e, 0x1f, 0x0f, 0xb1, 0x72, 0x07, 0xc3, 0xe1, 0xf0, 0xfd, 0x18, 0x00, 0x7c, 0x3e, 0x1f, 0x0f,	\
+	0xbb, 0x8a, 0x07, 0xc3, 0xe1, 0xf0, 0xfb, 0xe8, 0xe0, 0x7c, 0x3e, 0x1f, 0x0f, 0xc0, 0xbd, 0x03,	\
+	0xe1, 0xf0, 0xf8, 0x7e, 0x66, 0x50, 0x1f, 0x0f, 0x87, 0xc3, 0xf3, 0xa8, 0x01, 0xf0, 0xf8, 0x7c,	\
+	0x3f, 0xdb, 0xd2, 0x03, 0xe1, 0xf0, 0xf8, 0x7f, 0xb9, 0xae, 0x07, 0xc3, 0xe1, 0xf0, 0xfe, 0x0b,	\
+	0x90, 0x00, 0xdb, 0x60, 0x2f, 0xa0, 0x00, 0x06, 0xdb, 0x01, 0x7b, 0x14, 0x00, 0x36, 0xd8, 0x09,	\
+	0x17, 0x80, 0x01, 0xb6, 0xc0, 0x75, 0xa5, 0x00, 0x06, 0xdb, 0x01, 0x57, 0x14, 0x00, 0x36, 0xd8,	\
+	0x08, 0x98, 0xe0, 0x01, 0xb6, 0xc0, 0x5d, 0x76, 0x80, 0x03, 0x6d, 0x80, 0xb9, 0xa6, 0x00, 0x1b,	\
+	0x6c, 0x03, 0xba, 0xe0, 0x01, 0xb6, 0xc0, 0x5b, 0x6d, 0x00, 0x06, 0xdb, 0x00, 0xe7, 0x6c, 0x00,	\
+	0x36, 0xd8, 0x06, 0x77, 0x80, 0x03, 0x6d, 0x80, 0x5e, 0xc0, 0x00, 0x6d, 0xb0, 0x0a, 0xe2, 0x00,	\
+	0x0d, 0xb6, 0x03, 0xc9, 0x34, 0x01, 0xc7, 0x1c, 0x70, 0xf6, 0x62, 0x00, 0x38, 0xe3, 0x8e, 0x1f,	\
+	0x8e, 0x38, 0x03, 0x8e, 0x38, 0xe1, 0xf8, 0x76, 0x40, 0x1c, 0x71, 0xc7, 0x0d, 0x89, 0xe0, 0x0e,	\
+	0x38, 0xe3, 0x87, 0x36, 0x58, 0x03, 0x8e, 0x38, 0xe1, 0x1e, 0xa0, 0x03, 0x8e, 0x38, 0xe1, 0x63,	\
+	0xba, 0x00, 0xe3, 0x8e, 0x38, 0x37, 0xff, 0xc0, 0x1c, 0x38, 0x38, 0x72, 0xd8, 0x80, 0x70, 0xe0,	\
+	0xe1, 0xc7, 0xa6, 0x03, 0x87, 0x07, 0x0e, 0x3f, 0x00, 0x38, 0x70, 0x70, 0xe4, 0x24, 0x00, 0xe1,	\
+	0xc1, 0xc3, 0x91, 0x52, 0x03, 0x87, 0x07, 0x0e, 0x47, 0x50, 0x0e, 0x1c, 0x1c, 0x39, 0x25, 0x60,	\
+	0x1c, 0x38, 0x38, 0x73, 0x1d, 0xb8, 0x0e, 0x1c, 0x1c, 0x39, 0xac, 0xe8, 0x07, 0x0e, 0x0e, 0x1c,	\
+	0xaa, 0xec, 0x07, 0x0e, 0x0e, 0x1c, 0xae, 0xf4, 0x07, 0x0e, 0x0e, 0x1c, 0xda, 0x68, 0x07, 0x0e,	\
+	0x0e, 0x1c, 0xdb, 0x7c, 0x03, 0x87, 0x07, 0x0e, 0x6e, 0xdc, 0x00, 0xe1, 0xc1, 0xc3, 0x9b, 0xef,	\
+	0xc0, 0x70, 0xe0, 0xe1, 0xce, 0x38, 0x00, 0x38, 0x70, 0x70, 0xe6, 0x96, 0x98, 0x0e, 0x1c, 0x1c,	\
+	0x39, 0xa9, 0x58, 0x07, 0x0e, 0x0e, 0x1c, 0xd8, 0xae, 0x03, 0x87, 0x07, 0x0e, 0x6f, 0x78, 0x80,	\
+	0x70, 0xe0, 0xe1, 0xc2, 0x00, 0x50, 0xa2, 0x85, 0x3a, 0x5c, 0x0a, 0x14, 0x50, 0xa8, 0x4e, 0x40,	\
+	0xa1, 0x45, 0x0a, 0xa8, 0xf4, 0x0a, 0x14, 0x50, 0xa9, 0x8f, 0x80, 0xa1, 0x45, 0x0a, 0xef, 0xc0,	\
+	0x02, 0x85, 0x14, 0x2b, 0xdf, 0x2c, 0x0a, 0x14, 0x50, 0xa9, 0x3b, 0x20, 0x50, 0xa2, 0x85, 0x5c,	\
+	0x72, 0x01, 0x42, 0x8a, 0x15, 0xf1, 0x7c, 0x01, 0x04, 0x10, 0x87, 0xbd, 0xf8, 0x04, 0x10, 0x42,	\
+	0x1f, 0xbd, 0xc8, 0x04, 0x10, 0x42, 0x1c, 0x71, 0x00, 0x20, 0x82, 0x10, 0xff, 0x51, 0x40, 0x20,	\
+	0x82, 0x10, 0xff, 0xe8, 0xc0, 0x10, 0x41, 0x08, 0x7c, 0x2f, 0x40, 0x20, 0x82, 0x10, 0xee, 0x49,	\
+	0x00, 0x82, 0x08, 0x43, 0xa3, 0x04, 0x02, 0x08, 0x21, 0x0f, 0x4e, 0x10, 0x04, 0x10, 0x42, 0x1c,	\
+	0xd3, 0x00, 0x20, 0x82, 0x10, 0xbf, 0x9a, 0x01, 0x04, 0x10, 0x87, 0x04, 0xe0, 0x08, 0x20, 0x84,	\
+	0x37, 0xb1, 0x80, 0x20, 0x82, 0x10, 0xee, 0xd0, 0x00, 0x82, 0x08, 0x42, 0x86, 0x70, 0x04, 0x10,	\
+	0x42, 0x1c, 0x0a, 0x02, 0x04, 0x08, 0x13, 0xd3, 0x70, 0x04, 0x08, 0x10, 0x27, 0xe9, 0x1c, 0x08,	\
+	0x10, 0x20, 0x4c, 0x4b, 0x70, 0x0c, 0x31, 0x86, 0x3b, 0x3a, 0x20, 0x18, 0x63, 0x0c, 0x64, 0x54,	\
+	0x00, 0xc3, 0x18, 0x62, 0x3e, 0x98, 0x06, 0x18, 0xc3, 0x10, 0x75, 0x40, 0x30, 0xc6, 0x18, 0xad,	\
+	0xb6, 0x01, 0x86, 0x30, 0xc5, 0x1f, 0xbc, 0x03, 0x0c, 0x61, 0x8c, 0xbb, 0x00, 0x18, 0x63, 0x0c,	\
+	0x43, 0xf5, 0x00, 0x61, 0x8c, 0x31, 0x03, 0xd6, 0x01, 0x86, 0x30, 0xc7, 0x71, 0xb8, 0x01, 0xc1,	\
+	0xc1, 0xc9, 0x70, 0x00, 0x0e, 0x0e, 0x0e, 0x4d, 0x86, 0x00, 0x70, 0x70, 0x73, 0x1e, 0x40, 0x01,	\
+	0xc1, 0xc1, 0xcd, 0x09, 0xc0, 0x07, 0x07, 0x07, 0x33, 0x40, 0x00, 0x3c, 0xf7, 0x9e, 0x14, 0x16,	\
+	0x00, 0x07, 0x9e, 0xf3, 0xc1, 0xbb, 0xa0, 0x00, 0x79, 0xef, 0x3c, 0x17, 0x68, 0x00, 0x1e, 0x7b,	\
+	0xcf, 0x04, 0xc1, 0x00, 0x07, 0x9e, 0xf3, 0xc0, 0xe3, 0x00, 0x03, 0xcf, 0x79, 0xe1, 0xd6, 0x7c,	\
+	0x00, 0x16, 0xda, 0x04, 0x19, 0x40, 0x01, 0x6d, 0xa0, 0x5c, 0xcd, 0x00, 0x0b, 0x6d, 0x02, 0xe3,	\
+	0x18, 0x00, 0x2d, 0xb4, 0x0e, 0x1d, 0x70, 0x00, 0xb6, 0xd0, 0x3f, 0x6a, 0xe0, 0x01, 0x6d, 0xa0,	\
+	0x7c, 0x36, 0x80, 0x02, 0xdb, 0x40, 0xea, 0xdb, 0x00, 0x0b, 0x6d, 0x01, 0xde, 0xe0, 0x00, 0x5b,	\
+	0x68, 0x1f, 0xae, 0xe8, 0x00, 0x5b, 0x68, 0x18, 0x36, 0x00, 0x02, 0xdb, 0x40, 0xab, 0x0c, 0x0c,	\
+	0x1b, 0x06, 0x09, 0x19, 0x20, 0x60, 0xd8, 0x30, 0x7f, 0x86, 0x00, 0x01, 0x12, 0x20, 0xaf, 0x90,	\
+	0x00, 0x08, 0x91, 0x05, 0x4a, 0x80, 0x00, 0x89, 0x10, 0x79, 0xe1, 0x38, 0x1c, 0xf7, 0xbd, 0xe4,	\
+	0x72, 0x39, 0x1c, 0x91, 0x11, 0x09, 0x04, 0x48, 0x89, 0x22, 0x3a, 0x77, 0x75, 0x0b, 0x76, 0xe0,	\
+	0xc3, 0x0c, 0xa6, 0xa6, 0xa6, 0xea, 0x75, 0x39, 0x5c, 0xa7, 0x2b, 0x96, 0x34, 0xd5, 0x23, 0x6c,	\
+	0x1b, 0x6d, 0x88, 0x10, 0x47, 0xc8, 0x7d, 0x15, 0x68, 0xb2, 0x60, 0x12, 0x41, 0xce, 0xdc, 0xc6,	\
+	0x63, 0x19, 0x53, 0xb0, 0x94, 0x03, 0x86, 0x76, 0xc6, 0xe3, 0x1c, 0x0e, 0xd5, 0x9e, 0x94, 0x3a,	\
+	0x09, 0xc2, 0x24, 0x48, 0xe9, 0x04, 0x1d, 0x2d, 0x41, 0x47, 0xdc, 0x1f, 0x73, 0x0d, 0xb1, 0xb3,	\
+	0xe7, 0xb2, 0x2a, 0x80, 0xfc, 0x3f, 0x3b, 0xbf, 0xd1, 0xfe, 0x93, 0xfc, 0x9f, 0xe4, 0x5d, 0xc1,	\
+	0x35, 0xc5, 0xb7, 0x6d, 0x6d, 0x6c, 0x06, 0x05, 0xe3, 0xc5, 0xce, 0xdb, 0x52, 0xa5, 0x45, 0x8b,	\
+	0x0b, 0xb6, 0x35, 0x99, 0x0b, 0x9b, 0xeb, 0xfa, 0xfa, 0xdb, 0x7d, 0xef, 0x7d, 0xf3, 0xf5, 0xfa,	\
+	0xa5, 0x49, 0xc1, 0x33, 0x36, 0xba, 0xeb, 0xaa, 0x4a, 0xaa, 0xab, 0xc1, 0x82, 0x84, 0x1e, 0xbc,	\
+	0xf7, 0xeb, 0xce, 0xaf, 0x77, 0xeb, 0xbe, 0xad, 0xf8, 0xcb, 0x19, 0x2a, 0x54, 0x42, 0x10, 0x96,	\
+	0x5b, 0xc8, 0xe0, 0x25, 0x02, 0x49, 0x01, 0x24, 0xf7, 0x89, 0x39, 0xf8, 0x92, 0x1d, 0xe3, 0xbc,	\
+	0x77, 0x8e, 0xf1, 0xde, 0x7b, 0xde, 0x4d, 0xd2, 0x51, 0xa6, 0x4d, 0x1a, 0x31, 0x98, 0xca, 0x18,	\
+	0x2a, 0x34, 0x74, 0x22, 0x3a, 0x7d, 0x3e, 0x7d, 0x97, 0x4d, 0x47, 0x7f, 0xab, 0xf7, 0x2e, 0x5c,	\
+	0xb9, 0x8a, 0x77, 0xe6, 0xa4, 0x7d, 0xe2, 0x3e, 0x79, 0x1f, 0x3d, 0xe1, 0x92, 0xa3, 0xbf, 0x5f,	\
+	0xaf, 0xcf, 0x9f, 0x7d, 0x7e, 0xbc, 0xed, 0x1a, 0xbd, 0xe9, 0xef, 0x7b, 0xd0, 0x81, 0x09, 0x1e,	\
+	0xdc, 0x03, 0x55, 0x20, 0x58, 0x39, 0x61, 0xcf, 0xae, 0x11, 0xaa, 0x02, 0x48, 0x24, 0x24, 0x84,	\
+	0x2a, 0x2c, 0x13, 0x60, 0xee, 0x73, 0x9c, 0xe3, 0xa9, 0x6a, 0x04, 0x7c, 0x91, 0xf8, 0x49, 0xf0,	\
+	0x7d, 0xb7, 0x90, 0x80, 0x74, 0x74, 0x72, 0x10, 0x43, 0xd7, 0x25, 0x01, 0x7e, 0x5f, 0x8a, 0x29,	\
+	0xf5, 0xff, 0x78, 0x44, 0xc1, 0x24, 0x21, 0x20, 0x91, 0x0f, 0x75, 0x92, 0x66, 0x6d, 0xb1, 0x8c,	\
+	0xc5, 0x0c, 0xd4, 0x9a, 0xe5, 0xcb, 0x98, 0xc6, 0x77, 0x20, 0x92, 0xfb, 0x07, 0xe8, 0xc1, 0x5f,	\
+	0x0c, 0x24, 0x9a, 0x8b, 0x15, 0x04, 0x11, 0x6d, 0x96, 0x2a, 0xa5, 0x55, 0x05, 0xa8, 0xa0, 0x03,	\
+	0xbb, 0x83, 0x82, 0x73, 0x73, 0x47, 0x3e, 0x39, 0xf3, 0x8f, 0xe5, 0x5e, 0x1a, 0x0e, 0x07, 0x03,	\
+	0xbb, 0x4e, 0x50, 0x77, 0x8f, 0x7b, 0xd4, 0xea, 0x5c, 0xc9, 0x06, 0x87, 0xbc, 0x0f, 0x03, 0xd4,	\
+	0x9b, 0x1a, 0x0f, 0x0f, 0x0f, 0x06, 0x7c, 0x34, 0x1a, 0x95, 0xf5, 0xfa, 0xbf, 0x7a, 0x6d, 0x8d,	\
+	0x00, 0xff, 0xfe, 0x0f, 0xff, 0xf6, 0x41, 0xa0, 0x48, 0x20, 0x87, 0xda, 0x11, 0xa0, 0x82, 0x08,	\
+	0x13, 0x26, 0x28, 0x91, 0x12, 0x22, 0x23, 0x4a, 0x62, 0x8b, 0xcf, 0x1e, 0x78, 0x1a, 0xbf, 0x65,	\
+	0x45, 0x22, 0x22, 0x44, 0xee, 0x58, 0x6c, 0x4a, 0xf0, 0x43, 0xc1, 0x3f, 0x36, 0xc4, 0xa3, 0xff,	\
+	0x01, 0xff, 0xfe, 0x2c, 0x62, 0x49, 0x6d, 0x5a, 0xdb, 0x48, 0x80, 0x60, 0x66, 0xcc, 0x2f, 0x5f,	\
+	0xa4, 0x86, 0xcc, 0x6c, 0x95, 0x8e, 0x0f, 0xe3, 0xe3, 0xe7, 0xe6, 0x76, 0xc1, 0xe1, 0x8c, 0x67,	\
+	0x67, 0x3c, 0xc7, 0xc8, 0xfc, 0xa7, 0xec, 0xfb, 0xa4, 0x93, 0xc5, 0x55, 0x2e, 0xb4, 0x93, 0x10,	\
+	0xfc, 0x3f, 0x0f, 0xd9, 0x33, 0x0f, 0x07, 0xbc, 0x1c, 0xb9, 0xa4, 0x90, 0xe1, 0xdc, 0x79, 0xdd,	\
+	0x12, 0x7d, 0xef, 0x7a, 0x03, 0xde, 0xf7, 0xde, 0x98, 0x3b, 0x9c, 0x9c, 0x4f, 0x85, 0xc0, 0x32,	\
+	0x49, 0x12, 0x24, 0xfd, 0xe7, 0x18, 0x84, 0x41, 0x0f, 0xa6, 0x50, 0x31, 0x6d, 0x01, 0xf6, 0xd1,	\
+	0x20, 0xb4, 0xa2, 0x27, 0x71, 0x05, 0xcd, 0xce, 0x73, 0xaf, 0x33, 0xc9, 0x1d, 0x86, 0xee, 0xee,	\
+	0x93, 0xa6, 0x82, 0x66, 0xcc, 0xcf, 0x1b, 0x84, 0x10, 0xe7, 0x70, 0xe1, 0xa6, 0x48, 0x0e, 0x1c,	\
+	0xb3, 0x00, 0x90, 0xe1, 0x7a, 0xdb, 0x66, 0x49, 0x20, 0x3d, 0x6f, 0xbd, 0xdc, 0xd1, 0x49, 0x11,	\
+	0xef, 0x5f, 0x78, 0xbc, 0xb2, 0x90, 0x4f, 0xbe, 0xff, 0xdf, 0x7a, 0x23, 0x92, 0x1f, 0x53, 0xe5,	\
+	0x4f, 0x21, 0x99, 0xb6, 0x09, 0x73, 0x4c, 0xd0, 0x8d, 0xb6, 0x35, 0xd9, 0x9f, 0x0e, 0x1d, 0xaf,	\
+	0xac, 0x66, 0x71, 0xc2, 0xcb, 0x26, 0x70, 0x45, 0xb3, 0xdc, 0xc1, 0x98, 0xff, 0xfe, 0x3f, 0xe4,	\
+	0xa3, 0x32, 0x5b, 0x08, 0xd6, 0x50, 0x20, 0xb4, 0xbe, 0xa0, 0x0b, 0x31, 0x8c, 0x0b, 0x44, 0x0a,	\
+	0xb4, 0x94, 0xa2, 0x1f, 0x39, 0xf7, 0x4a, 0xcd, 0x04, 0x66, 0x36, 0x13, 0xc0, 0x4c, 0xcd, 0x9d,	\
+	0xbc, 0xe0, 0x49, 0x11, 0x1a, 0x0d, 0x10, 0x98, 0x33, 0x42, 0x81, 0x03, 0x18, 0xa9, 0x14, 0x87,	\
+	0xe8, 0xa5, 0x5b, 0xb0, 0x57, 0xeb, 0xb2, 0xe9, 0xe2, 0x02, 0xf3, 0xcd, 0xbc, 0xf0, 0xdb, 0x02,	\
+	0xe7, 0x38, 0x7d, 0xd3, 0x88, 0x0e, 0x39, 0xf5, 0x7e, 0x40, 0x84, 0x3f, 0x88, 0x80, 0x91, 0x22,	\
+	0x3f, 0x95, 0x81, 0x11, 0x20, 0xd8, 0x11, 0x8a, 0x39, 0xef, 0x19, 0x33, 0x33, 0xe8, 0xc4, 0x60,	\
+	0x42, 0xcd, 0x32, 0x36, 0x3a, 0xd8, 0xe4, 0x7b, 0x0d, 0x27, 0xae, 0x47, 0xf8, 0x9f, 0x4b, 0xcf,	\
+	0x23, 0x63, 0x25, 0xf8, 0xc8, 0xed, 0xa2, 0x6b, 0x73, 0x2f, 0xbe, 0xef, 0xe2, 0xe8, 0x99, 0x22,	\
+	0x26, 0x46, 0x59, 0x19, 0xf1, 0x92, 0xf0, 0xcb, 0xef, 0x9f, 0xed, 0x44, 0x23, 0x1e, 0xf7, 0xa8,	\
+	0x37, 0x32, 0x7b, 0xc2, 0x8e, 0x19, 0x1b, 0x87, 0x67, 0xca, 0x32, 0x9e, 0x9e, 0x9f, 0xa8, 0xfc,	\
+	0x8d, 0x86, 0xa8, 0xec, 0xcb, 0x9c, 0x76, 0xa6, 0xc1, 0x1b, 0xe3, 0xfb, 0xcd, 0x88, 0xd0, 0x4f,	\
+	0x24, 0x43, 0x25, 0x55, 0xb3, 0x8a, 0x47, 0x0b, 0x6f, 0x2b, 0x26, 0x47, 0xbc, 0x7a, 0x5a, 0x32,	\
+	0x03, 0xf2, 0x82, 0x64, 0x89, 0x1e, 0xe8, 0xc4, 0x7d, 0x1d, 0x1e, 0xe9, 0x44, 0x73, 0x9c, 0xbe,	\
+	0xfe, 0x42, 0x35, 0xb4, 0xea, 0x7a, 0x47, 0x20, 0x9d, 0xea, 0x94, 0x65, 0x08, 0x10, 0x3e, 0x5d,	\
+	0x73, 0x22, 0x13, 0xe8, 0x83, 0x24, 0x41, 0x20, 0x88, 0x1f, 0xf4, 0x11, 0x33, 0x43, 0xcf, 0x22,	\
+	0xec, 0xd1, 0xa5, 0x91, 0x7c, 0xfc, 0x8b, 0xf2, 0x26, 0xc9, 0xcf, 0x88, 0x83, 0x1e, 0xd8, 0x8b,	\
+	0xe7, 0xf2, 0x6d, 0x11, 0x04, 0xff, 0x29, 0x13, 0x36, 0x96, 0x61, 0x12, 0x26, 0xa3, 0x82, 0x27,	\
+	0x1a, 0x9f, 0x71, 0x16, 0x65, 0x7b, 0x92, 0x25, 0x5f, 0x04, 0xf2, 0x20, 0xf2, 0x6b, 0x11, 0x3b,	\
+	0x96, 0x69, 0x91, 0x5b, 0xdd, 0xc8, 0xd8, 0x88, 0x93, 0x97, 0x10, 0x89, 0x13, 0xdb, 0x7c, 0x45,	\
+	0xf7, 0xdd, 0x5b, 0xe4, 0x56, 0x9f, 0x14, 0x11, 0x22, 0x7c, 0x60, 0x11, 0x44, 0x7f, 0xc8, 0xc4,	\
+	0x50, 0x7f, 0x57, 0x04, 0x52, 0x1f, 0x41, 0xef, 0xbb, 0xb6, 0xf7, 0x6e, 0xee, 0xeb, 0x6f, 0x77,	\
+	0x77, 0x1e, 0x4d, 0x8b, 0xc6, 0x6d, 0x49, 0x20, 0x7c, 0x6f, 0x57, 0x48, 0x0b, 0xb7, 0xe1, 0x51,	\
+	0xdc, 0x3d, 0x51, 0xd5, 0xff, 0xff, 0xff, 0x3d, 0xb2, 0x54, 0x7f, 0xe4, 0x71, 0x0d, 0x27, 0xfe,	\
+	0x3f, 0xf3, 0xa4, 0x0c, 0x07, 0xc9, 0x62, 0xdc, 0x6b, 0x29, 0x0d, 0xbb, 0x14, 0x52, 0xf8, 0x69,	\
+	0x4a, 0x4f, 0xff, 0xff, 0xfd, 0xab, 0x21, 0x38, 0xb6, 0xd7, 0xbf, 0x4f, 0xff, 0xff, 0xff, 0xfb,	\
+	0x5b, 0x49, 0x3b, 0xb6, 0xdb, 0xc4, 0x4f, 0xbd, 0xef, 0x1b, 0xb3, 0x12, 0x7b, 0xc7, 0x4f, 0x02,	\
+	0x45, 0x20, 0xd5, 0x47, 0x77, 0x77, 0x4f, 0x7c, 0x8f, 0x86, 0xc5, 0xea, 0x24, 0x96, 0xef, 0x49,	\
+	0x47, 0xff, 0xff, 0xac, 0x5e, 0xa3, 0xff, 0xff, 0xff, 0xcb, 0x86, 0x8b, 0x6d, 0xbe, 0x98, 0x28,	\
+	0x82, 0x39, 0xdd, 0x18, 0x44, 0xc6, 0x1d, 0xdd, 0xa4, 0x48, 0x06, 0x48, 0x9e, 0x06, 0x91, 0xcc,	\
+	0x2d, 0xa9, 0xb7, 0x43, 0x86, 0x4e, 0x10, 0x92, 0x4a, 0x26, 0x0f, 0x7b, 0xb9, 0xa2, 0x08, 0xab,	\
+	0xa0, 0x36, 0xdb, 0x6b, 0x28, 0x13, 0xb6, 0xe4, 0x09, 0x24, 0xe9, 0xe1, 0x02, 0xb8, 0x78, 0x7e,	\
+	0x2d, 0xfb, 0xc7, 0xb6, 0x7f, 0xb4, 0x76, 0xa0, 0x52, 0x36, 0x41, 0xd8, 0x31, 0x07, 0x98, 0xed,	\
+	0xb0, 0xb0, 0x0c, 0xfc, 0x3e, 0xc9, 0xb2, 0x36, 0xa9, 0xed, 0xa4, 0x3b, 0x3b, 0x6c, 0x98, 0x86,	\
+	0xc9, 0x3c, 0xa6, 0xb6, 0x7c, 0x23, 0xb5, 0x97, 0xa4, 0x67, 0xf3, 0x6d, 0x8f, 0xbb, 0xa9, 0x5d,	\
+	0x18, 0xa7, 0x40, 0xf6, 0x54, 0xaa, 0x70, 0xb5, 0xa0, 0x67, 0x7a, 0x70, 0x0f, 0xff, 0xff, 0xba,	\
+	0x09, 0xc9, 0x3f, 0x7c, 0x23, 0x83, 0x67, 0xa4, 0x2d, 0x00, 0x9e, 0x71, 0x74, 0x4f, 0xc0, 0xbc,	\
+	0x22, 0x16, 0x19, 0x54, 0x2f, 0xc4, 0x88, 0x7a, 0x45, 0xc8, 0xed, 0x11, 0x81, 0x70, 0x5b, 0x4b,	\
+	0x76, 0x59, 0x91, 0xa2, 0x52, 0x64, 0xd3, 0x29, 0x32, 0x9c, 0x97, 0x5e, 0xd5, 0xb9, 0x3d, 0x3e,	\
+	0xe0, 0x9f, 0xa1, 0x28, 0xb9, 0x96, 0xa2, 0x33, 0x2a, 0x91, 0x9b, 0xbe, 0x47, 0x6d, 0x62, 0x28,	\
+	0xc3, 0x2b, 0x73, 0x9a, 0x2d, 0xb3, 0xb3, 0x4b, 0x6c, 0xea, 0x24, 0x67, 0x82, 0x29, 0xb4, 0x45,	\
+	0x37, 0xe5, 0xb5, 0x5a, 0x84, 0x69, 0xce, 0x26, 0xd5, 0xbc, 0x2c, 0xac, 0xf4, 0xbb, 0xab, 0x6e,	\
+	0x91, 0xae, 0xd1, 0x77, 0x6c, 0x66, 0x91, 0xb7, 0xe0, 0x2e, 0xed, 0xd9, 0xa5, 0xef, 0x6f, 0xa8,	\
+	0x8d, 0xfc, 0x32, 0xf7, 0xb8, 0x4c, 0xbd, 0xee, 0x18, 0x05, 0xdd, 0x65, 0xc9, 0x1e, 0xa9, 0x25,	\
+	0x6f, 0xc2, 0x59, 0x27, 0xee, 0x39, 0x36, 0xef, 0x07, 0xd4, 0x20, 0x29, 0xc4, 0xbc, 0x66, 0xda,	\
+	0x3e, 0x3b, 0xef, 0x6c, 0xc8, 0x83, 0xbb, 0x97, 0x59, 0xea, 0x77, 0x77, 0x73, 0x7e, 0xaa, 0x87,	\
+	0x70, 0xfa, 0xca, 0x56, 0x89, 0xf3, 0x13, 0x6d, 0xb6, 0xf6, 0xe6, 0x27, 0xbb, 0xbb, 0xbb, 0x43,	\
+	0x59, 0x24, 0x16, 0x37, 0x13, 0xef, 0x7b, 0xde, 0xf7, 0x16, 0xe2, 0x6d, 0xb6, 0xdf, 0xa6, 0x2a,	\
+	0x65, 0xb6, 0xd8, 0xb4, 0x91, 0xb6, 0xda, 0x2e, 0xca, 0x36, 0xdb, 0x4a, 0xd9, 0x40, 0xb6, 0x84,	\
+	0x64, 0x3d, 0xea, 0xa9, 0x39, 0x03, 0xbb, 0xdc, 0x84, 0x1f, 0xff, 0xde, 0xf9, 0x45, 0xb5, 0x3b,	\
+	0x28, 0x05, 0x2a, 0x22, 0x0f, 0x2b, 0x60, 0x79, 0xc5, 0xdd, 0x01, 0x66, 0x88, 0xb6, 0xde, 0x35,	\
+	0x0f, 0x17, 0x99, 0xe0, 0x90, 0xf4, 0x60, 0x07, 0xcf, 0x44, 0xc0, 0x87, 0xab, 0x20, 0x0e, 0xe8,	\
+	0xeb, 0x81, 0xd0, 0x71, 0x4c, 0x51, 0xbf, 0x3f, 0x79, 0x4a, 0x59, 0xf8, 0xd3, 0xd5, 0x37, 0x35,	\
+	0x2f, 0x8e, 0x3f, 0x5e, 0xb9, 0xf1, 0xe0, 0xd8, 0x33, 0xb7, 0x7c, 0x47, 0xc6, 0xf3, 0x06, 0xee,	\
+	0xb1, 0x60, 0xfd, 0xef, 0x73, 0xf6, 0x8c, 0x7f, 0x6c, 0x23, 0x47, 0x4b, 0x83, 0xff, 0xff, 0xf1,	\
+	0x92, 0x70, 0xfe, 0x23, 0x99, 0x7f, 0x89, 0x27, 0x6d, 0x4c, 0x42, 0x79, 0xc5, 0x82, 0x1e, 0xed,	\
+	0x92, 0xc3, 0xbe, 0x2b, 0x62, 0x56, 0x2c, 0xc1, 0x80, 0x46, 0x1c, 0xe2, 0xdb, 0x16, 0x29, 0x3b,	\
+	0x1a, 0x41, 0x19, 0x37, 0xc4, 0x4f, 0x78, 0x44, 0xfb, 0xb2, 0x32, 0xe3, 0x97, 0xbd, 0xa1, 0x88,	\
+	0x4e, 0xd2, 0xbf, 0x24, 0xd5, 0x74, 0x5c, 0xaf, 0x24, 0xa3, 0x7a, 0x71, 0x3a, 0xc6, 0x39, 0x45,	\
+	0x8e, 0x22, 0xf7, 0xad, 0x44, 0x2b, 0x79, 0x57, 0x2f, 0x7b, 0xce, 0xd1, 0x49, 0xe9, 0xc4, 0x23,	\
+	0xfb, 0xe0, 0x15, 0xef, 0xc9, 0x92, 0x3f, 0xc5, 0xa2, 0xb7, 0xaa, 0xf8, 0x93, 0xe5, 0x34, 0xa4,	\
+	0x47, 0x30, 0xa3, 0xb8, 0x83, 0xc9, 0x0f, 0x24, 0x79, 0xf0, 0x3c, 0x58, 0x74, 0xa6, 0x43, 0xc6,	\
+	0xb7, 0xed, 0x43, 0xa5, 0xdf, 0xad, 0x37, 0xbf, 0x73, 0xe1, 0x83, 0xe4, 0xc5, 0xe0, 0xb3, 0xfd,	\
+	0xa0, 0x74, 0xc0, 0xfd, 0x5e, 0xf5, 0x5c, 0x7c, 0xe0, 0x7d, 0x1f, 0xaf, 0x37, 0x7b, 0x33, 0xa5,	\
+	0x4e, 0x49, 0x33, 0xcd, 0x1d, 0x77, 0x75, 0x99, 0xdd, 0x78, 0x2d, 0xa9, 0x3e, 0xb5, 0xb7, 0x8d,	\
+	0xd7, 0x91, 0x8b, 0x35, 0x38, 0xe9, 0x73, 0x42, 0xf6, 0xcd, 0x52, 0xa6, 0x9c, 0xb5, 0x38, 0x4f,	\
+	0xb6, 0x17, 0xfb, 0xb8, 0xfe, 0x55, 0xf6, 0x7f, 0xff, 0x58, 0xff, 0xaf, 0x97, 0xef, 0xf1, 0x67,	\
+	0x63, 0xb7, 0x28, 0x53, 0x9a, 0x5a, 0xea, 0xa5, 0x31, 0xe3, 0x23, 0x96, 0xb6, 0xda, 0xb2, 0xff,	\
+	0x26, 0x06, 0x2c, 0x0d, 0x98, 0xf0, 0x24, 0xf9, 0xb0, 0x76, 0xf0, 0x6c, 0xcb, 0xe2, 0x9c, 0xff,	\
+	0x9e, 0x3f, 0x4c, 0xbf, 0xd7, 0x89, 0x68, 0x59, 0xf2, 0x1e, 0x60, 0xc4, 0x5c, 0xa9, 0x31, 0xef,	\
+	0xe1, 0xca, 0xcc, 0x9b, 0xe6, 0xc9, 0xf6, 0x52, 0xdf, 0xa9, 0x3f, 0x56, 0x3f, 0xdd, 0xec, 0xfe,	\
+	0x00
+
+#endif  //  LINEART_HUFF_H_INCLUDED
+
@@ -0,0 +1,413 @@
+/*
+ *  ST7735 Command Set Encoded Image
+ *  Encoder by Tim Williams, 2018-12-29
+ *  Original: photo.png
+ */
+
+#ifndef PHOTO_H_INCLUDED
+#define PHOTO_H_INCLUDED
+
+#define PHOTO_MAGIC_NUMBER	0x371e5453
+#define PHOTO_WIDTH		120
+#define PHOTO_HEIGHT		90
+#define PHOTO_CMD_LEN		11058	/*  Number of command bytes  */
+#define PHOTO_PALETTE_LEN		510	/*  Number of bytes (2 * colors)  */
+#define PHOTO_TOTAL_LEN		11569	/*  Total array size  */
+
+#define PHOTO_PAL		\
+	0x61, 0x08,	0x22, 0x18,	0x83, 0x28,	0x43, 0x38,		\
+	0x65, 0x38,	0x65, 0x48,	0x86, 0x60,	0x67, 0x58,		\
+	0x47, 0x70,	0xa7, 0x68,	0xa9, 0x70,	0x49, 0x80,		\
+	0xc8, 0x80,	0x6a, 0x90,	0x6b, 0xa8,	0x8b, 0x98,		\
+	0x6b, 0xb8,	0x6d, 0xb8,	0x6d, 0xc8,	0x4e, 0xe0,		\
+	0x4f, 0xf0,	0xb0, 0xf0,	0xc2, 0x18,	0xc4, 0x30,		\
+	0xe7, 0x50,	0xaf, 0xd0,	0xce, 0xd8,	0x83, 0x18,		\
+	0xe5, 0x40,	0xcc, 0xb0,	0xe2, 0x08,	0xec, 0x98,		\
+	0x06, 0x51,	0xe9, 0x78,	0xea, 0x88,	0xed, 0xc8,		\
+	0x07, 0x69,	0xea, 0x98,	0x10, 0xe9,	0x04, 0x19,		\
+	0x29, 0x69,	0xed, 0xb0,	0x0f, 0xd1,	0x11, 0xf1,		\
+	0xcc, 0x41,	0x25, 0x31,	0x24, 0x29,	0x50, 0xd9,		\
+	0x63, 0x09,	0x47, 0x49,	0x6d, 0xc1,	0x6a, 0x79,		\
+	0x66, 0x39,	0x4b, 0x89,	0x6d, 0xb1,	0x6f, 0xc1,		\
+	0x71, 0xe9,	0x72, 0xf1,	0x68, 0x51,	0x6d, 0xa1,		\
+	0x8c, 0xa1,	0x84, 0x21,	0x86, 0x41,	0x68, 0x61,		\
+	0x8c, 0x89,	0xa5, 0x11,	0xb0, 0xd1,	0xa6, 0x29,		\
+	0x8a, 0x61,	0xab, 0x89,	0xcf, 0xb1,	0xb2, 0xe1,		\
+	0xe8, 0x49,	0xca, 0x71,	0xee, 0xb1,	0xc3, 0x09,		\
+	0xed, 0xa1,	0xe7, 0x39,	0xe9, 0x59,	0xf0, 0xc1,		\
+	0x05, 0x12,	0x05, 0x22,	0xed, 0x89,	0x31, 0xe2,		\
+	0xf3, 0xf1,	0xea, 0x61,	0x0b, 0x7a,	0x46, 0x2a,		\
+	0x2a, 0x52,	0x44, 0x0a,	0x48, 0x3a,	0x2b, 0x62,		\
+	0x4d, 0x8a,	0x6f, 0xa2,	0x51, 0xca,	0x6e, 0xaa,		\
+	0x66, 0x12,	0x69, 0x4a,	0x70, 0xb2,	0x50, 0xba,		\
+	0x53, 0xe2,	0x34, 0xfa,	0xb5, 0x02,	0x68, 0x2a,		\
+	0x6b, 0x72,	0x8a, 0x52,	0x6d, 0x7a,	0xae, 0x9a,		\
+	0x92, 0xf2,	0x91, 0xd2,	0xad, 0x82,	0xb2, 0xd2,		\
+	0xa6, 0x22,	0x8e, 0x8a,	0xd2, 0xc2,	0xd5, 0xf2,		\
+	0xa5, 0x0a,	0xac, 0x5a,	0xcb, 0x6a,	0xd0, 0xaa,		\
+	0xd0, 0xba,	0xc8, 0x32,	0xca, 0x3a,	0xc9, 0x4a,		\
+	0xec, 0x72,	0xd4, 0xe2,	0xe6, 0x0a,	0xea, 0x4a,		\
+	0xef, 0x9a,	0xe8, 0x22,	0x14, 0xf3,	0x4c, 0x63,		\
+	0x0e, 0x83,	0x31, 0xb3,	0x34, 0xe3,	0x52, 0xcb,		\
+	0x47, 0x1b,	0x49, 0x2b,	0x50, 0x93,	0x34, 0xd3,		\
+	0x56, 0xfb,	0x67, 0x0b,	0x49, 0x1b,	0x4a, 0x43,		\
+	0x4c, 0x4b,	0x70, 0xa3,	0x4d, 0x73,	0x6e, 0x83,		\
+	0x4f, 0x93,	0x72, 0xbb,	0x6b, 0x3b,	0x75, 0xe3,		\
+	0x72, 0xb3,	0xca, 0x33,	0xac, 0x4b,	0xac, 0x63,		\
+	0x6d, 0x63,	0xad, 0x73,	0x93, 0xbb,	0xd4, 0xe3,		\
+	0xc8, 0x13,	0xaf, 0x7b,	0xb4, 0xcb,	0xca, 0x23,		\
+	0xd0, 0x93,	0xd6, 0xf3,	0xd1, 0xa3,	0xf5, 0xd3,		\
+	0xe8, 0x0b,	0xed, 0x53,	0xd2, 0xab,	0xf6, 0xe3,		\
+	0xec, 0x3b,	0xee, 0x63,	0x12, 0xbc,	0x4a, 0x14,		\
+	0x2f, 0x74,	0x33, 0xac,	0x31, 0x9c,	0x54, 0xc4,		\
+	0x4c, 0x44,	0x37, 0xf4,	0x6a, 0x2c,	0x4c, 0x34,		\
+	0x2e, 0x5c,	0x55, 0xd4,	0x69, 0x0c,	0x50, 0x74,		\
+	0x51, 0x8c,	0x6d, 0x5c,	0x6f, 0x6c,	0x53, 0x94,		\
+	0x77, 0xe4,	0x59, 0xf4,	0x8c, 0x24,	0xae, 0x54,		\
+	0x74, 0xb4,	0xaa, 0x1c,	0x8d, 0x44,	0xb0, 0x74,		\
+	0xb5, 0xcc,	0xd3, 0xac,	0xb8, 0xf4,	0xed, 0x34,		\
+	0xd2, 0x94,	0xf5, 0xbc,	0xea, 0x0c,	0xd2, 0x84,		\
+	0xd3, 0x94,	0xec, 0x24,	0xb0, 0x5c,	0xd5, 0xa4,		\
+	0xf7, 0xe4,	0x0f, 0x65,	0x11, 0x7d,	0xf9, 0xfc,		\
+	0x0e, 0x4d,	0xd8, 0xdc,	0xee, 0x44,	0x30, 0x6d,		\
+	0x17, 0xcd,	0x19, 0xed,	0x2b, 0x1d,	0x34, 0xa5,		\
+	0x50, 0x4d,	0x33, 0x8d,	0x33, 0x9d,	0x76, 0xb5,		\
+	0x6b, 0x0d,	0x70, 0x5d,	0x75, 0x9d,	0x78, 0xe5,		\
+	0x6c, 0x25,	0x4e, 0x35,	0x72, 0x75,	0x98, 0xd5,		\
+	0x7a, 0xf5,	0xae, 0x4d,	0xb3, 0x85,	0x96, 0xc5,		\
+	0xcc, 0x0d,	0xb4, 0x95,	0x97, 0xbd,	0xaf, 0x35,		\
+	0xb1, 0x4d,	0x9a, 0xe5,	0xd0, 0x5d,	0xcd, 0x25,		\
+	0xd2, 0x6d,	0xce, 0x25,	0xf3, 0x7d,	0xf6, 0xb5,		\
+	0xf9, 0xd5,	0xfa, 0xf5,	0xf5, 0x95
+
+#define PHOTO_CMDS		\
+	0x05, 220, 95, 75, 4, 3,		\
+	0x07, 14, 227, 82, 79, 2, 4,		\
+	162, 96, 53, 4, 4,		\
+	139, 102, 44, 2, 4,		\
+	170, 82, 57, 2, 4,		\
+	188, 65, 64, 4, 2,		\
+	133, 81, 44, 4, 2,		\
+	66, 97, 24, 3, 3,		\
+	47, 106, 14, 3, 3,		\
+	21, 115, 2, 2, 4,		\
+	243, 22, 88, 4, 2,		\
+	19, 106, 0, 4, 3,		\
+	198, 27, 66, 5, 2,		\
+	169, 35, 60, 4, 2,		\
+	18, 93, 2, 5, 2,		\
+	0x25, 98, 0, 4, 2,		\
+	0x05, 240, 1, 86, 4, 4,		\
+	0x07, 11, 228, 0, 81, 3, 3,		\
+	14, 77, 0, 9, 2,		\
+	206, 0, 74, 2, 6,		\
+	163, 15, 56, 2, 4,		\
+	137, 14, 47, 2, 4,		\
+	40, 49, 14, 4, 2,		\
+	72, 32, 24, 3, 3,		\
+	58, 36, 18, 2, 4,		\
+	67, 16, 22, 6, 2,		\
+	80, 6, 27, 3, 3,		\
+	5, 31, 0, 7, 2,		\
+	0x25, 32, 3, 6, 2,		\
+	0x05, 48, 0, 17, 2, 4,		\
+	0x07, 3, 2, 11, 1, 2, 5,		\
+	30, 0, 8, 3, 5,		\
+	0, 0, 0, 4, 2,		\
+	0x02, 236, 112, 83, 8,		\
+	0x02, 252, 99, 88, 8,		\
+	0x02, 251, 82, 88, 8,		\
+	0x22, 76, 89, 7,		\
+	0x02, 185, 98, 62, 9,		\
+	0x07, 6, 94, 93, 33, 8,		\
+	194, 12, 68, 8,		\
+	183, 22, 68, 7,		\
+	105, 33, 38, 7,		\
+	28, 28, 11, 7,		\
+	2, 13, 2, 7,		\
+	0x22, 13, 4, 7,		\
+	0x02, 1, 7, 0, 7,		\
+	0x03, 192, 110, 63, 9,		\
+	0x07, 12, 165, 118, 52, 9,		\
+	205, 87, 70, 7,		\
+	225, 66, 74, 8,		\
+	114, 95, 38, 7,		\
+	188, 61, 61, 8,		\
+	233, 24, 79, 9,		\
+	216, 30, 70, 7,		\
+	232, 14, 76, 8,		\
+	34, 64, 7, 7,		\
+	186, 1, 62, 8,		\
+	137, 18, 45, 7,		\
+	80, 0, 28, 7,		\
+	0x15, 40, 16, 41, 45,		\
+		68, 32, 58, 58, 78, 63, 78, 58, 78, 78, 78, 78, 97, 91, 91, 88, 88, 117, 105, 123, 97, 118, 118, 127, 117, 117, 117, 117, 127, 127, 144, 155, 131, 131, 154, 155, 144, 169, 169, 156, 169, 169, 169, 184, 184, 49, 58, 40, 49, 63, 58, 63, 78, 58, 68, 91, 78, 78, 97, 78, 78, 91, 105, 105, 88, 105, 105, 91, 118, 117, 117, 117, 131, 118, 144, 131, 156, 131, 131, 144, 131, 155, 156, 169, 155, 173, 169, 169, 184, 173, 58, 58, 63, 58, 58, 63, 68, 78, 78, 78, 85, 88, 88, 91, 88, 88, 97, 91, 105, 91, 117, 88, 117, 117, 118, 117, 144, 117, 117, 131, 144, 131, 144, 131, 131, 131, 155, 156, 154, 131, 155, 155, 184, 184, 155, 24, 58, 68, 58, 78, 40, 78, 78, 68, 68, 78, 97, 85, 78, 88, 91, 88, 91, 105, 105, 91, 91, 91, 117, 117, 131, 118, 117, 131, 131, 144, 131, 131, 131, 156, 131, 173, 131, 156, 173, 156, 156, 173, 173, 189, 36, 63, 63, 63, 40, 58, 58, 68, 85, 78, 85, 88, 85, 105, 91, 78, 91, 105, 91, 88, 91, 117, 105, 131, 117, 118, 131, 118, 117, 117, 131, 131, 131, 156, 146, 156, 131, 155, 155, 173, 157, 155, 173, 173, 190, 40, 36, 68, 58, 68, 58, 78, 63, 68, 85, 88, 85, 91, 91, 85, 78, 91, 117, 105, 91, 118, 117, 117, 118, 117, 117, 124, 117, 131, 117, 117, 124, 155, 156, 131, 131, 155, 156, 155, 156, 173, 173, 184, 173, 173, 68, 58, 68, 68, 68, 63, 68, 78, 68, 78, 85, 91, 91, 73, 91, 91, 78, 91, 117, 91, 118, 91, 118, 117, 118, 118, 118, 131, 118, 118, 131, 131, 156, 156, 131, 155, 169, 156, 156, 173, 157, 173, 173, 169, 173, 63, 40, 40, 68, 68, 73, 85, 85, 68, 68, 68, 68, 78, 91, 85, 104, 91, 91, 91, 118, 91, 117, 104, 117, 118, 124, 117, 124, 146, 131, 131, 146, 155, 155, 131, 131, 155, 157, 173, 173, 173, 157, 176, 157, 173, 63, 63, 63, 40, 68, 73, 78, 68, 68, 68, 73, 91, 73, 104, 91, 91, 85, 86, 104, 91, 118, 91, 118, 124, 118, 124, 117, 131, 124, 131, 117, 124, 131, 157, 156, 156, 155, 155, 173, 173, 173, 176, 161, 176, 176, 51, 40, 63, 68, 73, 40, 85, 68, 51, 51, 85, 85, 91, 91, 86, 104, 104, 118, 104, 104, 91, 117, 118, 104, 124, 124, 124, 118, 131, 146, 131, 146, 131, 157, 156, 146, 156, 157, 173, 161, 157, 157, 173, 176, 173, 40, 40, 51, 73, 73, 68, 68, 68, 85, 68, 73, 85, 91, 91, 86, 91, 86, 117, 104, 104, 104, 117, 104, 117, 118, 124, 124, 118, 124, 124, 146, 156, 131, 146, 146, 156, 161, 156, 173, 161, 173, 173, 161, 173, 173, 51, 36, 40, 63, 68, 68, 68, 86, 68, 91, 68, 86, 91, 86, 91, 104, 86, 104, 91, 106, 104, 118, 104, 104, 124, 117, 110, 146, 131, 146, 131, 146, 131, 131, 146, 157, 157, 156, 146, 176, 157, 157, 157, 157, 187, 40, 68, 51, 51, 51, 68, 73, 51, 73, 73, 68, 68, 86, 86, 85, 86, 104, 104, 104, 104, 118, 118, 124, 118, 106, 124, 124, 124, 146, 146, 146, 156, 146, 146, 156, 146, 146, 173, 157, 157, 157, 176, 157, 176, 176, 40, 40, 40, 51, 73, 73, 68, 73, 86, 85, 86, 73, 73, 91, 106, 86, 104, 104, 118, 104, 106, 106, 124, 110, 124, 124, 110, 124, 124, 124, 146, 124, 124, 146, 156, 156, 157, 161, 161, 157, 157, 173, 176, 190, 173, 63, 40, 73, 40, 73, 73, 51, 73, 73, 68, 73, 73, 104, 86, 86, 86, 86, 106, 106, 118, 124, 106, 124, 106, 124, 124, 132, 124, 146, 146, 124, 157, 146, 157, 156, 146, 156, 161, 147, 147, 161, 176, 176, 187, 157, 51, 40, 51, 51, 51, 51, 53, 73, 86, 86, 73, 86, 86, 86, 104, 104, 104, 106, 86, 118, 104, 124, 124, 110, 124, 124, 124, 124, 124, 146, 124, 147, 132, 147, 146, 157, 146, 161, 161, 157, 176, 161, 173, 161, 187, 40, 51, 51, 53, 51, 40, 73, 86, 73, 86, 73, 86, 86, 86, 82, 86, 86, 86, 104, 92, 104, 124, 106, 110, 106, 110, 124, 124, 132, 110, 147, 146, 132, 157, 147, 161, 161, 161, 157, 161, 157, 161, 187, 161, 176, 33, 51, 51, 51, 73, 51, 51, 51, 86, 69, 86, 86, 86, 106, 106, 86, 104, 106, 124, 86, 106, 118, 110, 106, 132, 110, 110, 124, 147, 132, 132, 146, 146, 146, 161, 132, 157, 161, 161, 161, 176, 161, 161, 187, 187, 40, 51, 51, 69, 69, 51, 86, 86, 86, 86, 73, 86, 104, 104, 106, 106, 106, 118, 86, 110, 106, 106, 124, 124, 110, 124, 124, 132, 132, 132, 132, 132, 147, 147, 146, 147, 147, 161, 157, 161, 161, 176, 161, 187, 188, 51, 51, 34, 53, 51, 64, 86, 51, 86, 86, 86, 73, 82, 86, 106, 106, 106, 104, 86, 106, 106, 110, 110, 110, 106, 132, 124, 132, 132, 132, 147, 147, 148, 147, 147, 147, 161, 147, 157, 161, 161, 161, 161, 176, 187, 51, 69, 53, 53, 69, 64, 69, 73, 82, 86, 64, 86, 86, 104, 86, 110, 106, 92, 110, 110, 110, 106, 110, 110, 132, 110, 132, 124, 132, 147, 124, 132, 132, 161, 132, 161, 164, 161, 164, 161, 164, 176, 161, 161, 164, 51, 51, 69, 51, 73, 53, 53, 73, 69, 64, 86, 86, 82, 86, 82, 92, 106, 92, 110, 110, 110, 106, 110, 110, 132, 132, 110, 147, 124, 147, 132, 147, 161, 132, 161, 147, 147, 161, 147, 161, 161, 138, 176, 161, 187, 34, 34, 53, 53, 69, 53, 69, 53, 64, 82, 69, 86, 92, 92, 92, 92, 86, 106, 106, 106, 124, 106, 113, 132, 132, 113, 132, 132, 113, 146, 132, 132, 147, 147, 147, 161, 138, 164, 147, 164, 161, 161, 164, 188, 161, 53, 53, 73, 51, 69, 69, 64, 82, 69, 92, 86, 82, 82, 82, 82, 82, 106, 92, 92, 113, 110, 113, 110, 113, 113, 110, 110, 132, 132, 113, 132, 138, 132, 147, 138, 161, 148, 138, 147, 161, 161, 164, 188, 188, 187, 69, 69, 53, 34, 64, 53, 69, 69, 64, 69, 82, 92, 92, 86, 82, 82, 92, 92, 92, 110, 92, 92, 110, 110, 110, 128, 113, 132, 147, 128, 138, 110, 138, 148, 147, 147, 138, 164, 148, 161, 164, 161, 164, 164, 164, 53, 64, 53, 64, 64, 64, 69, 82, 82, 64, 82, 92, 64, 82, 92, 82, 92, 107, 113, 92, 110, 113, 113, 113, 128, 113, 107, 128, 132, 132, 148, 148, 148, 132, 132, 164, 164, 161, 138, 161, 147, 164, 176, 188, 164, 53, 64, 34, 64, 64, 64, 69, 69, 82, 86, 92, 92, 92, 92, 92, 86, 92, 92, 106, 113, 113, 92, 113, 128, 113, 113, 128, 148, 148, 110, 148, 147, 138, 138, 148, 147, 138, 148, 161, 164, 164, 164, 178, 188, 164, 31, 69, 60, 53, 69, 69, 64, 82, 82, 64, 64, 82, 92, 92, 76, 92, 82, 82, 92, 92, 113, 92, 113, 132, 107, 113, 107, 148, 110, 148, 132, 132, 145, 148, 148, 148, 164, 164, 164, 164, 164, 166, 164, 178, 188, 69, 64, 53, 53, 53, 64, 64, 82, 76, 69, 82, 69, 82, 82, 92, 82, 92, 82, 92, 110, 92, 113, 110, 128, 107, 128, 138, 107, 128, 128, 128, 148, 148, 138, 147, 164, 164, 166, 164, 166, 147, 164, 164, 178, 188, 53, 64, 64, 64, 64, 82, 64, 64, 64, 82, 92, 64, 82, 92, 93, 82, 92, 93, 93, 113, 92, 92, 93, 107, 128, 138, 107, 128, 138, 128, 148, 148, 147, 148, 164, 138, 148, 164, 164, 164, 164, 145, 164, 164, 166, 69, 60, 59, 60, 64, 60, 60, 59, 64, 82, 60, 82, 82, 92, 107, 76, 82, 92, 92, 107, 113, 107, 93, 93, 128, 128, 107, 107, 138, 128, 138, 138, 128, 145, 148, 138, 145, 138, 164, 138, 145, 164, 166, 188, 178, 60, 60, 64, 53, 60, 60, 60, 82, 59, 82, 76, 82, 82, 82, 95, 82, 82, 107, 92, 95, 107, 107, 128, 107, 107, 128, 113, 128, 148, 138, 138, 128, 148, 148, 148, 138, 138, 164, 164, 138, 164, 178, 178, 164, 191, 60, 31, 31, 60, 69, 60, 82, 76, 60, 76, 95, 76, 76, 107, 76, 82, 113, 107, 92, 113, 113, 113, 93, 128, 128, 128, 138, 128, 145, 119, 148, 128, 138, 128, 145, 164, 164, 145, 166, 145, 178, 166, 178, 164, 178, 60, 60, 59, 64, 60, 60, 60, 76, 76, 82, 82, 76, 76, 82, 76, 92, 95, 107, 107, 107, 93, 107, 95, 93, 119, 128, 128, 145, 128, 145, 128, 128, 138, 148, 138, 138, 145, 164, 138, 164, 166, 170, 166, 164, 178, 31, 60, 31, 64, 59, 60, 59, 59, 60, 76, 76, 92, 95, 76, 76, 76, 93, 76, 93, 95, 113, 93, 128, 93, 107, 119, 128, 107, 128, 128, 145, 138, 145, 164, 145, 138, 166, 166, 145, 166, 178, 164, 178, 170, 164, 41, 59, 60, 60, 60, 76, 59, 76, 59, 64, 76, 76, 93, 76, 76, 107, 95, 93, 93, 107, 93, 107, 107, 93, 93, 128, 128, 119, 148, 145, 145, 138, 145, 145, 145, 138, 145, 166, 145, 177, 166, 170, 178, 177, 166, 37, 60, 60, 60, 59, 60, 76, 59, 76, 76, 76, 76, 76, 76, 74, 93, 76, 93, 93, 107, 107, 95, 98, 119, 119, 133, 119, 93, 119, 138, 119, 133, 138, 133, 145, 145, 145, 170, 166, 166, 178, 178, 177, 191, 166, 60, 59, 59, 59, 74, 60, 59, 59, 74, 93, 76, 95, 76, 76, 95, 95, 95, 93, 95, 98, 93, 119, 119, 119, 119, 119, 119, 145, 119, 119, 145, 148, 138, 138, 166, 166, 166, 145, 145, 178, 166, 166, 166, 170, 178, 59, 59, 59, 59, 60, 59, 76, 60, 60, 60, 76, 95, 76, 93, 93, 93, 95, 95, 107, 107, 98, 128, 119, 93, 93, 119, 93, 119, 128, 138, 133, 145, 133, 145, 166, 145, 170, 145, 145, 170, 166, 166, 170, 177, 178, 60, 60, 60, 74, 60, 54, 59, 59, 74, 70, 70, 74, 76, 70, 70, 93, 95, 119, 95, 98, 128, 98, 119, 95, 93, 119, 119, 119, 119, 119, 133, 145, 145, 145, 152, 133, 166, 152, 166, 152, 178, 166, 166, 170, 177, 41, 59, 59, 59, 59, 54, 74, 76, 70, 93, 74, 70, 70, 95, 93, 95, 95, 93, 93, 93, 93, 119, 93, 119, 98, 119, 145, 145, 128, 133, 145, 145, 119, 145, 133, 145, 152, 166, 152, 170, 170, 152, 177, 177, 170,		\
+	0x07, 84, 32, 62, 29, 28,		\
+		180, 180, 189, 198, 180, 198, 198, 198, 198, 195, 195, 198, 195, 218, 218, 216, 218, 224, 237, 216, 237, 237, 237, 229, 224, 244, 237, 244, 180, 189, 189, 198, 198, 189, 198, 216, 218, 218, 218, 195, 218, 198, 216, 224, 216, 216, 224, 224, 237, 224, 224, 224, 244, 244, 237, 244, 169, 189, 189, 189, 198, 198, 195, 198, 218, 195, 216, 216, 218, 218, 216, 216, 216, 224, 224, 237, 224, 224, 224, 237, 244, 246, 237, 237, 180, 195, 184, 198, 184, 198, 198, 198, 195, 195, 198, 198, 218, 218, 224, 213, 216, 237, 224, 237, 216, 237, 244, 229, 229, 244, 244, 237, 184, 180, 195, 189, 195, 189, 195, 189, 195, 195, 195, 195, 213, 216, 224, 216, 229, 210, 224, 224, 224, 244, 237, 244, 229, 224, 237, 246, 195, 169, 189, 184, 189, 198, 198, 195, 216, 216, 210, 195, 195, 213, 216, 216, 224, 229, 213, 224, 246, 237, 246, 244, 237, 237, 229, 246, 180, 169, 184, 169, 195, 195, 189, 195, 195, 195, 195, 216, 224, 216, 195, 229, 216, 224, 213, 216, 216, 229, 237, 246, 246, 244, 246, 244, 184, 189, 189, 190, 195, 189, 189, 184, 195, 195, 224, 210, 210, 195, 224, 229, 216, 229, 237, 237, 229, 246, 244, 229, 244, 246, 229, 246, 184, 184, 189, 184, 189, 189, 195, 189, 210, 210, 195, 213, 213, 224, 210, 224, 213, 229, 219, 229, 229, 246, 246, 246, 229, 229, 229, 246, 189, 184, 189, 173, 184, 210, 213, 184, 195, 190, 213, 210, 210, 213, 213, 229, 210, 229, 244, 229, 244, 229, 229, 246, 246, 229, 229, 246, 189, 189, 184, 184, 190, 189, 190, 210, 210, 195, 190, 216, 229, 219, 216, 216, 213, 229, 229, 219, 229, 246, 246, 229, 229, 248, 248, 246, 184, 184, 189, 189, 184, 210, 184, 190, 210, 190, 190, 213, 210, 213, 219, 224, 229, 213, 229, 213, 229, 246, 246, 229, 248, 246, 246, 244, 184, 184, 195, 195, 184, 210, 195, 213, 210, 195, 210, 219, 199, 213, 219, 219, 219, 213, 229, 219, 229, 246, 229, 248, 248, 248, 246, 246, 184, 190, 173, 190, 190, 184, 190, 190, 210, 199, 213, 213, 210, 210, 219, 213, 229, 229, 219, 229, 219, 248, 248, 246, 248, 248, 248, 248, 176, 190, 189, 176, 190, 190, 184, 190, 190, 190, 213, 210, 199, 199, 213, 229, 219, 219, 219, 219, 219, 229, 248, 229, 234, 246, 248, 234, 169, 176, 190, 190, 190, 190, 184, 190, 210, 219, 210, 213, 213, 190, 219, 213, 213, 229, 229, 219, 219, 229, 219, 248, 248, 248, 248, 248, 184, 173, 173, 190, 199, 187, 190, 210, 213, 199, 199, 190, 219, 190, 219, 214, 219, 219, 234, 246, 219, 229, 219, 248, 219, 248, 248, 248, 190, 190, 176, 187, 176, 187, 199, 190, 213, 210, 219, 199, 190, 219, 214, 219, 219, 219, 219, 234, 234, 234, 229, 248, 234, 234, 248, 248, 190, 190, 190, 176, 190, 190, 176, 210, 213, 213, 199, 199, 199, 219, 234, 213, 219, 229, 234, 219, 234, 214, 234, 234, 248, 248, 250, 248, 176, 190, 173, 199, 190, 199, 213, 190, 199, 199, 213, 219, 199, 219, 199, 219, 219, 219, 219, 234, 234, 234, 234, 234, 248, 250, 248, 234, 176, 187, 176, 199, 187, 190, 199, 190, 199, 190, 199, 199, 214, 214, 199, 219, 214, 234, 234, 234, 234, 248, 248, 248, 248, 248, 248, 238, 161, 190, 176, 187, 190, 176, 199, 199, 187, 214, 199, 213, 219, 199, 234, 199, 234, 234, 219, 234, 234, 234, 248, 248, 234, 248, 248, 250, 187, 176, 187, 187, 199, 190, 190, 214, 219, 214, 219, 199, 219, 219, 234, 214, 214, 214, 234, 219, 234, 214, 234, 250, 238, 250, 248, 248, 176, 199, 199, 176, 199, 187, 190, 187, 199, 187, 207, 199, 199, 207, 214, 214, 234, 214, 214, 225, 248, 234, 234, 234, 248, 238, 248, 250, 187, 187, 176, 187, 199, 199, 199, 187, 214, 199, 199, 214, 207, 199, 234, 214, 207, 214, 214, 214, 214, 238, 248, 250, 238, 250, 238, 250, 187, 187, 176, 188, 199, 176, 214, 188, 207, 214, 188, 219, 207, 219, 214, 214, 225, 234, 234, 214, 225, 238, 238, 238, 238, 250, 250, 250, 176, 188, 187, 187, 199, 187, 190, 214, 214, 214, 199, 207, 207, 207, 214, 214, 238, 214, 234, 238, 234, 238, 250, 234, 234, 238, 250, 248, 188, 176, 188, 187, 199, 187, 207, 187, 199, 207, 207, 199, 207, 207, 225, 214, 214, 234, 234, 238, 234, 238, 238, 225, 238, 250, 238, 250, 188, 187, 188, 188, 188, 187, 187, 207, 207, 214, 207, 188, 207, 207, 214, 207, 207, 214, 225, 225, 234, 234, 238, 238, 238, 238, 238, 250,		\
+	104, 17, 14, 45,		\
+		47, 47, 66, 66, 66, 47, 66, 66, 83, 94, 71, 83, 83, 94, 94, 83, 100, 111, 109, 108, 111, 111, 111, 125, 111, 111, 125, 139, 111, 139, 139, 134, 134, 135, 159, 162, 139, 167, 167, 159, 159, 167, 159, 171, 167, 47, 47, 66, 47, 66, 66, 71, 66, 83, 71, 83, 83, 94, 109, 111, 111, 83, 100, 83, 100, 109, 111, 111, 111, 111, 111, 125, 139, 134, 151, 159, 134, 151, 151, 167, 167, 151, 171, 171, 167, 167, 162, 185, 171, 171, 66, 42, 47, 66, 71, 71, 47, 71, 66, 94, 83, 94, 83, 83, 83, 100, 83, 100, 83, 100, 111, 100, 109, 111, 139, 111, 135, 135, 139, 151, 151, 139, 139, 134, 151, 134, 162, 159, 159, 167, 159, 167, 171, 159, 185, 38, 66, 66, 66, 83, 71, 66, 56, 83, 83, 83, 83, 100, 100, 109, 100, 100, 100, 83, 100, 111, 108, 125, 125, 125, 111, 125, 139, 139, 134, 139, 134, 139, 151, 167, 151, 167, 167, 167, 171, 181, 159, 185, 192, 192, 47, 56, 47, 71, 56, 66, 71, 83, 71, 71, 83, 83, 100, 83, 100, 100, 111, 100, 111, 108, 125, 125, 111, 111, 125, 134, 134, 125, 139, 151, 151, 159, 159, 151, 171, 159, 167, 171, 171, 167, 171, 171, 171, 185, 192, 56, 38, 56, 71, 71, 47, 56, 71, 66, 83, 71, 83, 100, 83, 83, 100, 83, 108, 125, 100, 111, 125, 108, 111, 108, 111, 125, 125, 139, 130, 151, 151, 134, 151, 159, 139, 171, 159, 151, 159, 159, 167, 181, 171, 171, 57, 56, 66, 66, 71, 57, 84, 84, 71, 83, 83, 100, 100, 83, 84, 83, 100, 108, 100, 108, 125, 108, 125, 111, 125, 134, 125, 125, 125, 130, 134, 134, 159, 151, 151, 134, 151, 167, 151, 151, 151, 181, 171, 171, 171, 38, 71, 56, 57, 56, 71, 56, 71, 83, 84, 84, 100, 71, 84, 100, 108, 100, 100, 125, 108, 125, 100, 108, 125, 125, 130, 125, 125, 130, 130, 130, 130, 134, 134, 151, 159, 151, 165, 171, 159, 171, 171, 185, 192, 181, 38, 57, 56, 57, 57, 56, 71, 71, 84, 83, 100, 83, 84, 108, 100, 108, 100, 100, 100, 100, 108, 130, 134, 130, 125, 130, 130, 134, 115, 134, 130, 134, 130, 159, 171, 151, 159, 151, 159, 151, 171, 171, 171, 159, 171, 38, 56, 56, 57, 57, 71, 71, 84, 84, 84, 84, 71, 108, 84, 108, 100, 100, 100, 115, 125, 125, 108, 125, 125, 130, 134, 125, 151, 115, 130, 151, 130, 151, 159, 151, 159, 151, 165, 165, 171, 181, 171, 171, 192, 171, 56, 56, 56, 71, 71, 56, 84, 84, 83, 71, 71, 84, 83, 100, 84, 84, 108, 125, 125, 100, 115, 125, 115, 115, 108, 130, 134, 115, 130, 130, 130, 140, 151, 140, 151, 159, 151, 140, 171, 181, 151, 165, 181, 181, 181, 71, 38, 57, 56, 56, 71, 57, 71, 71, 84, 83, 83, 108, 108, 84, 108, 101, 108, 115, 101, 100, 108, 115, 108, 108, 134, 108, 115, 134, 140, 130, 130, 130, 159, 159, 159, 165, 151, 140, 165, 165, 181, 165, 165, 181, 43, 57, 57, 57, 84, 57, 84, 84, 84, 84, 83, 100, 84, 101, 84, 101, 100, 108, 101, 101, 115, 115, 115, 115, 115, 115, 130, 115, 130, 134, 140, 140, 140, 140, 165, 140, 151, 165, 165, 165, 181, 181, 181, 165, 181, 43, 57, 43, 57, 57, 57, 57, 84, 84, 56, 84, 84, 101, 108, 108, 115, 101, 100, 108, 115, 115, 125, 108, 130, 115, 130, 140, 115, 115, 140, 140, 115, 165, 140, 140, 165, 165, 159, 165, 165, 165, 181, 165, 181, 193,		\
+	19, 24, 13, 42,		\
+		87, 77, 67, 87, 87, 87, 77, 90, 90, 103, 103, 103, 103, 103, 121, 103, 121, 129, 129, 121, 122, 121, 137, 129, 137, 143, 143, 153, 153, 137, 150, 153, 163, 153, 183, 153, 182, 182, 182, 183, 163, 153, 77, 67, 77, 90, 77, 67, 103, 87, 103, 87, 90, 121, 112, 129, 90, 121, 121, 121, 137, 137, 143, 122, 121, 137, 143, 137, 163, 137, 153, 153, 150, 153, 163, 172, 163, 183, 163, 172, 172, 182, 182, 183, 67, 77, 67, 87, 77, 90, 87, 103, 90, 77, 87, 103, 103, 90, 121, 121, 121, 137, 137, 122, 137, 137, 137, 153, 143, 137, 153, 150, 163, 163, 153, 163, 172, 150, 182, 182, 182, 153, 182, 182, 183, 183, 87, 77, 77, 77, 87, 90, 103, 87, 87, 90, 87, 121, 90, 90, 121, 112, 121, 121, 122, 137, 137, 122, 122, 153, 143, 150, 150, 163, 153, 163, 172, 150, 153, 150, 153, 183, 153, 183, 182, 183, 183, 182, 77, 90, 62, 77, 87, 67, 90, 77, 103, 103, 90, 121, 103, 121, 103, 121, 122, 122, 143, 143, 121, 143, 129, 121, 143, 137, 137, 143, 153, 163, 150, 172, 153, 153, 172, 172, 153, 183, 183, 180, 198, 203, 77, 77, 77, 62, 62, 77, 77, 77, 90, 90, 122, 121, 103, 122, 122, 121, 122, 122, 122, 122, 137, 122, 123, 143, 150, 153, 153, 137, 150, 150, 153, 153, 143, 172, 172, 153, 183, 153, 183, 172, 183, 183, 52, 62, 77, 77, 90, 77, 90, 77, 77, 90, 90, 121, 122, 90, 121, 97, 97, 122, 143, 122, 150, 121, 121, 122, 143, 153, 143, 143, 172, 143, 150, 143, 150, 180, 180, 153, 180, 172, 183, 180, 180, 183, 77, 77, 77, 72, 90, 77, 90, 90, 90, 90, 103, 97, 103, 123, 122, 97, 123, 121, 121, 122, 123, 123, 123, 121, 150, 143, 150, 143, 172, 143, 144, 154, 172, 153, 172, 153, 172, 180, 172, 172, 180, 182, 62, 77, 77, 77, 97, 90, 90, 90, 97, 90, 90, 123, 123, 122, 122, 90, 123, 122, 122, 143, 121, 143, 122, 127, 143, 150, 153, 143, 150, 150, 150, 154, 172, 180, 143, 172, 183, 172, 183, 183, 172, 183, 77, 90, 72, 72, 72, 90, 97, 90, 90, 88, 90, 90, 121, 123, 122, 97, 122, 122, 127, 143, 143, 143, 143, 143, 143, 127, 154, 153, 150, 154, 154, 172, 154, 154, 154, 183, 183, 180, 180, 198, 180, 183, 62, 77, 72, 72, 90, 72, 90, 90, 90, 97, 123, 121, 97, 122, 122, 97, 122, 122, 122, 127, 122, 122, 127, 143, 150, 143, 150, 143, 143, 143, 172, 154, 180, 183, 172, 180, 154, 183, 172, 183, 198, 180, 77, 77, 62, 72, 72, 90, 90, 72, 90, 97, 97, 97, 123, 105, 123, 90, 121, 123, 123, 122, 123, 143, 143, 127, 144, 122, 154, 144, 150, 172, 154, 150, 154, 153, 180, 172, 180, 180, 172, 172, 180, 198, 72, 72, 77, 72, 72, 90, 97, 90, 97, 97, 90, 97, 123, 122, 122, 122, 123, 127, 127, 127, 143, 144, 122, 143, 144, 143, 154, 154, 150, 154, 154, 154, 154, 154, 180, 180, 180, 172, 180, 180, 189, 183,		\
+	85, 2, 8, 68,		\
+		14, 14, 17, 29, 29, 29, 17, 41, 29, 41, 41, 41, 41, 54, 59, 54, 59, 59, 70, 59, 54, 74, 59, 76, 74, 79, 74, 70, 99, 99, 98, 98, 119, 98, 119, 120, 120, 98, 119, 133, 119, 133, 120, 133, 133, 133, 133, 152, 133, 149, 170, 170, 152, 170, 170, 170, 174, 177, 170, 177, 196, 196, 179, 177, 196, 201, 201, 201, 14, 16, 29, 17, 29, 29, 17, 29, 41, 29, 41, 41, 41, 41, 54, 54, 54, 70, 54, 74, 55, 70, 70, 70, 70, 95, 99, 74, 74, 98, 98, 98, 99, 98, 98, 98, 98, 98, 119, 120, 119, 133, 133, 133, 152, 149, 145, 158, 133, 145, 152, 170, 174, 170, 158, 152, 158, 158, 174, 174, 196, 174, 201, 196, 196, 196, 205, 201, 18, 14, 29, 29, 17, 17, 41, 35, 41, 41, 41, 41, 55, 54, 41, 41, 59, 70, 70, 70, 54, 55, 70, 74, 74, 70, 99, 99, 95, 99, 98, 120, 99, 99, 99, 120, 98, 120, 133, 98, 120, 133, 119, 149, 133, 149, 152, 133, 152, 149, 152, 158, 152, 149, 158, 170, 174, 177, 170, 174, 174, 174, 196, 201, 179, 200, 196, 196, 17, 17, 16, 29, 17, 35, 17, 17, 29, 41, 54, 35, 50, 41, 70, 55, 50, 74, 54, 70, 54, 70, 79, 79, 79, 99, 99, 79, 99, 95, 98, 99, 99, 98, 98, 99, 120, 114, 119, 114, 114, 120, 120, 114, 114, 133, 149, 149, 158, 152, 152, 174, 170, 174, 170, 170, 177, 174, 158, 170, 174, 177, 196, 179, 196, 196, 196, 196, 16, 17, 18, 18, 18, 41, 29, 41, 41, 17, 29, 50, 41, 55, 54, 54, 54, 41, 54, 79, 74, 55, 55, 70, 74, 99, 98, 74, 74, 98, 99, 98, 99, 120, 120, 98, 120, 114, 114, 133, 119, 135, 149, 152, 152, 152, 133, 158, 152, 158, 149, 174, 174, 174, 177, 174, 162, 179, 174, 174, 196, 196, 179, 196, 179, 196, 179, 196, 16, 17, 35, 18, 29, 17, 29, 18, 18, 41, 35, 54, 55, 50, 54, 50, 55, 55, 74, 74, 70, 55, 70, 50, 79, 79, 70, 79, 79, 98, 98, 120, 119, 99, 98, 120, 98, 133, 98, 120, 120, 149, 114, 152, 133, 135, 135, 149, 135, 158, 152, 149, 158, 158, 174, 174, 174, 167, 162, 179, 177, 179, 177, 179, 196, 179, 179, 205, 17, 18, 17, 18, 18, 17, 18, 18, 41, 41, 35, 35, 50, 50, 54, 50, 54, 55, 50, 74, 74, 74, 79, 70, 79, 79, 99, 70, 98, 79, 99, 94, 98, 94, 120, 99, 114, 114, 119, 109, 114, 114, 120, 149, 114, 135, 149, 149, 135, 149, 149, 158, 149, 174, 174, 174, 158, 158, 174, 162, 179, 174, 179, 179, 179, 196, 196, 205, 17, 18, 18, 35, 41, 35, 17, 50, 29, 35, 41, 35, 35, 50, 41, 42, 42, 54, 54, 55, 79, 55, 74, 79, 70, 79, 99, 99, 79, 94, 99, 99, 99, 94, 111, 120, 94, 98, 98, 114, 114, 111, 149, 114, 114, 158, 133, 135, 158, 149, 162, 162, 158, 174, 162, 149, 179, 185, 174, 162, 196, 179, 185, 200, 179, 200, 179, 200,		\
+	2, 30, 10, 51,		\
+		80, 89, 96, 116, 89, 96, 80, 89, 96, 116, 126, 126, 126, 116, 141, 136, 126, 126, 141, 141, 141, 141, 141, 168, 168, 160, 168, 168, 168, 160, 168, 160, 186, 186, 186, 186, 197, 197, 186, 186, 206, 197, 197, 186, 206, 228, 206, 222, 206, 228, 222, 80, 89, 80, 89, 80, 116, 89, 126, 126, 116, 126, 96, 126, 141, 126, 136, 141, 136, 136, 142, 160, 168, 141, 160, 160, 141, 141, 168, 168, 168, 186, 186, 168, 168, 186, 197, 186, 197, 175, 197, 206, 175, 206, 197, 206, 206, 206, 206, 228, 228, 228, 89, 80, 96, 89, 96, 89, 116, 126, 126, 112, 126, 126, 126, 126, 126, 141, 136, 136, 141, 142, 142, 141, 160, 168, 160, 160, 168, 160, 160, 160, 160, 168, 163, 168, 175, 197, 206, 186, 186, 206, 186, 175, 197, 175, 206, 206, 222, 206, 206, 222, 209, 80, 80, 80, 96, 96, 96, 126, 116, 96, 126, 96, 96, 141, 126, 141, 126, 142, 141, 142, 141, 142, 160, 141, 160, 142, 142, 160, 160, 175, 160, 186, 168, 186, 175, 168, 186, 175, 197, 197, 175, 206, 206, 206, 197, 222, 197, 206, 222, 206, 228, 228, 80, 96, 96, 96, 96, 112, 96, 96, 126, 112, 126, 112, 112, 126, 126, 142, 126, 126, 142, 142, 141, 141, 168, 168, 160, 160, 160, 163, 186, 160, 160, 175, 175, 197, 168, 175, 197, 197, 197, 175, 197, 194, 197, 222, 228, 222, 209, 222, 228, 222, 228, 80, 96, 80, 96, 96, 96, 116, 87, 96, 112, 96, 112, 129, 129, 126, 126, 141, 142, 142, 142, 141, 136, 142, 142, 160, 141, 160, 163, 186, 175, 160, 160, 186, 186, 175, 175, 182, 175, 197, 175, 197, 222, 197, 206, 209, 222, 222, 209, 209, 209, 222, 96, 89, 80, 80, 96, 81, 96, 96, 112, 96, 129, 129, 112, 129, 126, 126, 142, 137, 160, 129, 142, 141, 160, 136, 160, 163, 175, 160, 163, 175, 163, 168, 175, 175, 175, 182, 197, 194, 175, 197, 194, 197, 194, 197, 222, 197, 222, 209, 222, 240, 222, 80, 81, 96, 81, 112, 116, 112, 96, 96, 96, 96, 136, 136, 112, 129, 136, 129, 142, 136, 142, 142, 142, 136, 160, 142, 163, 137, 160, 160, 160, 175, 175, 175, 197, 182, 186, 175, 175, 175, 175, 197, 197, 209, 194, 197, 209, 206, 222, 222, 232, 232, 96, 96, 96, 87, 112, 96, 116, 112, 103, 96, 112, 112, 129, 129, 129, 126, 129, 129, 137, 136, 163, 137, 137, 137, 160, 163, 163, 160, 160, 160, 175, 175, 163, 182, 182, 175, 182, 194, 175, 182, 175, 209, 197, 197, 209, 209, 222, 232, 222, 232, 222, 96, 80, 96, 80, 87, 96, 112, 112, 112, 112, 112, 129, 121, 126, 142, 129, 129, 129, 129, 137, 160, 136, 142, 163, 163, 175, 163, 163, 163, 163, 163, 182, 163, 175, 175, 175, 175, 175, 197, 182, 194, 209, 197, 209, 209, 209, 209, 209, 232, 209, 232,		\
+	3, 6, 25, 16,		\
+		22, 30, 22, 48, 30, 30, 22, 39, 48, 30, 48, 48, 48, 75, 48, 48, 27, 27, 0, 30, 39, 48, 48, 48, 39, 48, 39, 39, 48, 48, 75, 48, 22, 30, 22, 27, 22, 22, 39, 30, 39, 48, 48, 48, 48, 61, 61, 61, 22, 30, 22, 30, 30, 22, 39, 22, 39, 30, 48, 48, 61, 48, 61, 61, 27, 22, 39, 48, 30, 22, 22, 39, 61, 65, 39, 65, 61, 61, 65, 39, 22, 22, 39, 27, 30, 39, 39, 39, 39, 39, 39, 65, 61, 61, 61, 65, 0, 22, 39, 22, 22, 39, 22, 39, 46, 39, 65, 39, 61, 61, 61, 61, 27, 22, 22, 22, 22, 46, 39, 39, 39, 39, 61, 61, 39, 39, 65, 80, 22, 30, 22, 39, 27, 39, 46, 39, 39, 61, 48, 61, 39, 65, 61, 61, 27, 2, 22, 23, 2, 46, 39, 45, 39, 46, 46, 39, 65, 61, 61, 67, 39, 39, 22, 46, 2, 2, 23, 61, 45, 45, 46, 61, 67, 61, 65, 67, 2, 27, 23, 2, 39, 46, 46, 46, 61, 39, 45, 46, 46, 65, 45, 46, 39, 39, 2, 39, 39, 23, 22, 39, 46, 39, 61, 61, 61, 46, 65, 67, 2, 2, 2, 2, 46, 46, 46, 45, 46, 45, 46, 39, 61, 67, 67, 61, 22, 2, 23, 2, 46, 46, 23, 39, 46, 45, 61, 61, 46, 67, 61, 81, 23, 2, 23, 23, 23, 39, 45, 46, 45, 23, 67, 45, 61, 67, 61, 52, 4, 2, 45, 23, 46, 23, 23, 46, 45, 45, 45, 67, 62, 45, 61, 81, 23, 4, 23, 23, 23, 28, 23, 23, 45, 46, 61, 61, 45, 45, 67, 52, 23, 23, 23, 28, 23, 28, 45, 46, 23, 45, 52, 52, 45, 62, 45, 67, 23, 2, 46, 4, 23, 45, 45, 45, 52, 52, 67, 46, 67, 52, 67, 62, 4, 2, 28, 4, 45, 23, 45, 52, 52, 45, 45, 52, 67, 52, 67, 62, 4, 23, 45, 28, 49, 45, 28, 52, 52, 46, 67, 28, 45, 62, 77, 52, 5, 28, 45, 4, 45, 52, 45, 28, 52, 28, 62, 62, 52, 45, 67, 52, 5, 5, 28, 28, 23, 52, 46, 45, 45, 62, 52, 52, 49, 62, 62, 52, 5, 23, 5, 45, 28, 49, 52, 28, 52, 49, 52, 52, 62, 62, 62, 52,		\
+	38, 0, 26, 14,		\
+		5, 7, 5, 28, 32, 5, 24, 6, 32, 32, 24, 24, 24, 32, 5, 24, 5, 7, 24, 6, 7, 9, 5, 24, 36, 49, 58, 32, 6, 5, 6, 7, 9, 36, 24, 6, 24, 7, 6, 24, 32, 58, 5, 6, 6, 24, 7, 7, 7, 32, 6, 49, 6, 36, 36, 63, 6, 7, 6, 6, 24, 7, 7, 7, 9, 24, 32, 24, 24, 63, 7, 7, 7, 9, 5, 9, 36, 7, 24, 7, 24, 36, 32, 36, 6, 9, 9, 6, 8, 7, 6, 9, 24, 9, 32, 36, 36, 58, 6, 7, 7, 6, 9, 6, 32, 36, 6, 36, 24, 9, 40, 40, 6, 6, 7, 7, 9, 9, 9, 36, 40, 7, 40, 40, 40, 40, 7, 8, 9, 7, 6, 36, 9, 6, 9, 9, 36, 36, 36, 36, 8, 7, 8, 9, 7, 9, 9, 40, 10, 36, 9, 40, 36, 40, 7, 9, 6, 8, 6, 9, 9, 36, 9, 10, 33, 36, 36, 36, 6, 8, 8, 9, 10, 10, 9, 40, 33, 9, 40, 9, 40, 9, 8, 9, 6, 8, 8, 10, 40, 10, 9, 40, 40, 40, 10, 10, 6, 8, 11, 9, 10, 10, 12, 36, 9, 10, 33, 40, 40, 40, 8, 10, 8, 10, 10, 36, 33, 10, 9, 40, 40, 10, 40, 40, 9, 10, 10, 12, 10, 8, 10, 10, 33, 12, 33, 33, 33, 40, 8, 10, 10, 8, 12, 12, 33, 10, 33, 40, 12, 12, 40, 36, 10, 8, 8, 8, 11, 33, 10, 10, 10, 36, 33, 40, 33, 51, 11, 10, 8, 9, 8, 10, 12, 34, 12, 12, 33, 33, 33, 51, 8, 11, 11, 11, 10, 11, 11, 11, 33, 33, 34, 33, 33, 51, 12, 11, 11, 12, 10, 11, 34, 33, 10, 11, 51, 34, 34, 51, 11, 8, 11, 12, 33, 10, 11, 11, 33, 33, 33, 51, 53, 34, 12, 12, 11, 13, 11, 12, 34, 33, 33, 34, 33, 53, 34, 33, 11, 11, 11, 11, 13, 12, 13, 34, 33, 34, 34, 34, 34, 33, 11, 11, 13, 12, 34, 11, 12, 11, 10, 34, 33, 34, 51, 34,		\
+	69, 61, 13, 28,		\
+		164, 178, 178, 191, 178, 188, 191, 204, 204, 208, 208, 191, 204, 204, 208, 225, 225, 226, 225, 241, 226, 241, 241, 225, 226, 241, 241, 241, 178, 164, 178, 178, 178, 188, 191, 191, 204, 208, 208, 204, 191, 204, 207, 204, 226, 230, 230, 226, 230, 241, 225, 230, 241, 238, 230, 254, 178, 191, 188, 191, 178, 204, 204, 201, 201, 208, 204, 226, 225, 208, 208, 208, 201, 211, 230, 226, 241, 241, 225, 241, 241, 254, 254, 254, 178, 188, 178, 177, 178, 208, 191, 204, 208, 191, 208, 208, 226, 225, 204, 226, 225, 226, 241, 241, 225, 230, 230, 241, 254, 254, 254, 230, 178, 191, 188, 177, 178, 178, 177, 191, 191, 201, 208, 211, 201, 204, 223, 208, 225, 226, 225, 223, 230, 226, 230, 230, 230, 230, 241, 241, 178, 178, 178, 191, 178, 191, 204, 191, 201, 204, 211, 208, 211, 208, 211, 208, 223, 230, 225, 223, 226, 230, 241, 230, 230, 254, 230, 254, 170, 170, 178, 191, 201, 191, 208, 201, 211, 208, 223, 201, 201, 208, 201, 223, 230, 230, 223, 230, 230, 230, 223, 223, 254, 230, 251, 251, 178, 178, 178, 178, 201, 178, 204, 196, 208, 201, 211, 211, 211, 223, 211, 226, 223, 226, 223, 223, 223, 227, 223, 230, 223, 254, 230, 227, 170, 191, 177, 177, 204, 191, 177, 201, 191, 201, 223, 191, 226, 211, 230, 226, 226, 230, 211, 223, 223, 227, 227, 230, 230, 230, 230, 230, 166, 177, 191, 177, 178, 177, 211, 191, 211, 201, 211, 201, 223, 211, 211, 211, 211, 211, 223, 230, 230, 223, 223, 230, 230, 254, 230, 241, 177, 170, 177, 196, 201, 177, 201, 211, 201, 211, 201, 211, 205, 201, 223, 226, 201, 227, 226, 223, 223, 241, 227, 230, 230, 251, 251, 251, 177, 170, 170, 177, 177, 177, 196, 211, 201, 196, 201, 201, 211, 223, 223, 211, 201, 211, 211, 223, 230, 227, 227, 230, 251, 251, 227, 230, 170, 177, 177, 177, 177, 201, 211, 201, 196, 177, 205, 211, 201, 223, 211, 211, 226, 223, 223, 205, 227, 230, 223, 230, 227, 227, 227, 227,		\
+	65, 2, 20, 14,		\
+		12, 13, 11, 13, 34, 13, 12, 34, 34, 34, 33, 53, 34, 34, 11, 13, 34, 34, 11, 34, 15, 13, 34, 12, 53, 34, 34, 34, 13, 11, 11, 34, 13, 34, 34, 33, 34, 34, 53, 34, 37, 53, 13, 13, 13, 34, 11, 13, 34, 37, 37, 37, 34, 53, 53, 53, 11, 15, 13, 13, 13, 34, 37, 31, 37, 37, 31, 34, 53, 37, 11, 11, 13, 13, 37, 13, 34, 37, 34, 34, 37, 53, 37, 53, 13, 14, 15, 15, 37, 37, 31, 37, 31, 34, 37, 31, 53, 53, 13, 13, 13, 37, 13, 13, 13, 34, 34, 31, 31, 37, 34, 31, 13, 13, 15, 13, 15, 13, 31, 37, 34, 37, 31, 37, 37, 37, 13, 14, 31, 15, 34, 15, 34, 15, 37, 31, 37, 31, 31, 59, 13, 15, 15, 37, 37, 37, 15, 37, 31, 29, 59, 53, 53, 60, 13, 15, 15, 15, 15, 37, 31, 31, 15, 37, 31, 37, 60, 60, 15, 31, 14, 31, 15, 15, 15, 29, 15, 31, 60, 29, 31, 59, 14, 14, 15, 37, 31, 15, 29, 15, 37, 31, 15, 41, 31, 37, 14, 14, 15, 37, 14, 31, 37, 29, 31, 29, 53, 59, 60, 60, 29, 14, 31, 31, 15, 37, 15, 31, 29, 37, 41, 29, 59, 41, 17, 14, 14, 14, 14, 29, 29, 31, 29, 29, 29, 60, 41, 54, 14, 14, 29, 14, 29, 17, 15, 29, 31, 29, 60, 31, 41, 41, 17, 17, 14, 29, 29, 41, 17, 29, 29, 15, 41, 29, 54, 41, 29, 29, 17, 14, 17, 29, 41, 41, 29, 54, 54, 54, 41, 29,		\
+	84, 78, 28, 10,		\
+		205, 227, 223, 227, 227, 223, 239, 227, 251, 239, 223, 223, 205, 205, 239, 227, 227, 251, 239, 251, 227, 227, 205, 227, 227, 227, 242, 227, 227, 242, 205, 227, 227, 239, 205, 227, 251, 227, 227, 251, 227, 227, 227, 239, 227, 242, 251, 239, 227, 227, 220, 227, 227, 242, 239, 242, 242, 251, 227, 242, 227, 242, 227, 239, 242, 227, 239, 239, 251, 239, 227, 242, 227, 220, 227, 239, 242, 242, 242, 251, 220, 227, 239, 220, 239, 220, 242, 251, 242, 239, 205, 239, 239, 220, 242, 242, 242, 239, 239, 242, 239, 205, 220, 239, 239, 227, 242, 242, 242, 239, 239, 220, 220, 239, 239, 220, 242, 242, 242, 252, 220, 239, 220, 239, 242, 239, 242, 242, 239, 235, 220, 239, 235, 239, 235, 235, 235, 239, 242, 252, 235, 220, 235, 220, 235, 235, 235, 252, 235, 252, 220, 235, 235, 220, 220, 235, 242, 235, 235, 235, 220, 220, 220, 220, 235, 235, 235, 235, 235, 252, 220, 231, 212, 235, 235, 235, 231, 252, 235, 252, 235, 220, 220, 235, 220, 220, 252, 235, 235, 235, 212, 217, 235, 235, 220, 239, 231, 231, 235, 235, 217, 212, 231, 231, 231, 231, 245, 235, 252, 252, 212, 231, 220, 212, 235, 235, 252, 235, 252, 235, 220, 231, 217, 231, 231, 231, 231, 231, 245, 252, 217, 221, 231, 231, 231, 231, 235, 245, 231, 235, 231, 231, 221, 221, 231, 231, 231, 245, 245, 231, 212, 212, 231, 231, 221, 245, 221, 245, 245, 245, 231, 221, 231, 231, 231, 231, 231, 245, 245, 236, 221, 236, 231, 231, 231, 245, 253, 236, 235, 245,		\
+	93, 4, 11, 20,		\
+		18, 18, 18, 35, 41, 35, 50, 35, 41, 42, 50, 41, 50, 70, 74, 42, 50, 79, 50, 55, 17, 18, 18, 35, 18, 18, 35, 35, 35, 55, 50, 35, 55, 55, 42, 74, 74, 50, 55, 66, 18, 18, 25, 35, 42, 18, 35, 55, 35, 35, 50, 42, 50, 55, 55, 55, 79, 55, 79, 79, 35, 18, 18, 35, 25, 18, 25, 35, 42, 50, 50, 42, 55, 55, 55, 50, 79, 55, 55, 79, 35, 35, 35, 35, 18, 35, 18, 35, 42, 35, 42, 42, 42, 66, 55, 55, 66, 66, 55, 66, 25, 18, 25, 25, 25, 42, 35, 35, 42, 42, 42, 55, 42, 66, 47, 55, 55, 79, 66, 79, 18, 25, 26, 26, 18, 25, 26, 26, 50, 55, 47, 47, 42, 42, 47, 47, 66, 47, 47, 66, 18, 35, 18, 18, 25, 42, 35, 26, 42, 42, 42, 42, 42, 66, 66, 66, 66, 47, 66, 55, 18, 35, 26, 25, 26, 42, 42, 26, 35, 42, 26, 66, 42, 66, 47, 66, 47, 66, 66, 66, 25, 19, 35, 25, 25, 35, 42, 25, 42, 42, 42, 42, 66, 66, 66, 66, 47, 66, 47, 79, 25, 26, 25, 42, 42, 47, 25, 47, 42, 47, 47, 42, 66, 42, 47, 47, 79, 47, 47, 66,		\
+	93, 63, 17, 12,		\
+		179, 179, 179, 179, 205, 200, 196, 200, 179, 200, 220, 200, 185, 200, 179, 185, 200, 179, 200, 220, 205, 200, 205, 205, 179, 185, 205, 200, 179, 200, 200, 200, 205, 200, 200, 205, 185, 179, 179, 185, 200, 200, 200, 200, 185, 220, 200, 220, 185, 179, 185, 185, 185, 200, 185, 200, 200, 200, 220, 220, 167, 185, 185, 200, 185, 200, 200, 200, 220, 200, 220, 200, 185, 185, 185, 185, 185, 192, 185, 217, 185, 220, 200, 220, 185, 185, 185, 179, 200, 200, 185, 185, 200, 220, 200, 220, 200, 185, 200, 192, 200, 185, 200, 220, 220, 220, 200, 220, 167, 192, 192, 185, 185, 185, 200, 200, 220, 212, 220, 217, 167, 185, 185, 185, 185, 185, 192, 217, 192, 200, 212, 212, 185, 185, 185, 192, 212, 185, 217, 192, 200, 212, 212, 212, 185, 185, 185, 185, 200, 192, 192, 192, 212, 212, 200, 217, 185, 185, 192, 192, 192, 185, 192, 192, 220, 192, 212, 217, 192, 192, 192, 192, 192, 200, 192, 212, 217, 212, 221, 217, 192, 181, 185, 192, 192, 192, 192, 212, 212, 221, 217, 217, 192, 185, 192, 181, 202, 192, 212, 192, 212, 212, 212, 212,		\
+	15, 69, 9, 19,		\
+		209, 209, 194, 194, 222, 222, 209, 222, 209, 232, 209, 232, 233, 232, 232, 232, 249, 249, 232, 194, 194, 209, 194, 209, 209, 203, 233, 209, 209, 203, 209, 232, 232, 233, 232, 232, 247, 243, 209, 203, 194, 203, 209, 209, 203, 233, 232, 232, 232, 203, 243, 233, 233, 247, 243, 232, 249, 194, 183, 183, 183, 209, 209, 209, 203, 203, 209, 233, 233, 203, 233, 232, 249, 233, 233, 233, 182, 183, 203, 209, 209, 194, 209, 209, 203, 203, 233, 232, 232, 233, 233, 233, 249, 243, 233, 182, 209, 182, 203, 203, 209, 203, 203, 203, 233, 203, 203, 233, 247, 233, 243, 247, 233, 243, 198, 194, 203, 203, 194, 203, 203, 203, 209, 233, 203, 232, 203, 203, 203, 233, 233, 233, 237, 194, 203, 182, 203, 198, 203, 203, 203, 233, 233, 233, 232, 233, 243, 233, 247, 243, 247, 233, 203, 198, 182, 203, 203, 203, 198, 233, 203, 233, 233, 203, 237, 243, 233, 232, 243, 243, 233,		\
+	32, 39, 8, 21,		\
+		127, 123, 105, 143, 127, 143, 127, 144, 144, 144, 143, 144, 144, 154, 144, 154, 154, 172, 169, 154, 180, 123, 123, 127, 127, 143, 127, 127, 143, 127, 127, 154, 150, 144, 154, 154, 169, 154, 154, 154, 180, 180, 123, 123, 123, 127, 127, 127, 127, 144, 144, 144, 144, 144, 154, 154, 150, 154, 154, 154, 169, 154, 154, 105, 127, 105, 127, 127, 144, 143, 143, 144, 144, 144, 143, 144, 169, 144, 169, 154, 169, 169, 180, 154, 127, 127, 117, 127, 117, 144, 117, 127, 144, 154, 144, 144, 169, 154, 154, 154, 154, 154, 184, 155, 169, 123, 127, 123, 127, 144, 127, 143, 143, 154, 144, 154, 144, 169, 155, 154, 155, 169, 154, 154, 169, 189, 105, 127, 127, 144, 127, 117, 117, 127, 144, 131, 154, 131, 144, 154, 154, 154, 155, 169, 169, 154, 169, 105, 105, 117, 131, 131, 127, 144, 143, 144, 154, 144, 154, 144, 144, 131, 155, 154, 169, 169, 169, 173,		\
+	112, 62, 8, 21,		\
+		171, 192, 171, 181, 193, 192, 192, 192, 221, 221, 221, 212, 221, 221, 221, 221, 221, 231, 245, 231, 231, 192, 181, 181, 193, 181, 192, 212, 202, 217, 192, 221, 202, 217, 202, 221, 221, 221, 221, 221, 221, 245, 192, 181, 192, 192, 181, 202, 181, 192, 202, 202, 221, 212, 202, 221, 221, 231, 231, 236, 231, 236, 231, 171, 181, 181, 193, 192, 193, 192, 192, 202, 192, 202, 202, 202, 215, 221, 215, 221, 221, 221, 245, 231, 181, 193, 181, 192, 181, 202, 202, 202, 202, 193, 215, 221, 215, 202, 221, 231, 221, 231, 236, 236, 236, 181, 181, 181, 181, 202, 202, 193, 202, 221, 202, 215, 202, 221, 215, 236, 215, 215, 221, 236, 221, 236, 181, 181, 193, 202, 181, 193, 193, 202, 193, 193, 221, 215, 202, 215, 236, 236, 221, 236, 215, 236, 236, 181, 102, 202, 193, 202, 193, 215, 181, 221, 193, 215, 215, 221, 221, 215, 215, 215, 236, 236, 221, 236,		\
+	12, 24, 7, 21,		\
+		65, 81, 67, 96, 81, 103, 67, 103, 87, 103, 112, 96, 112, 112, 129, 112, 129, 112, 142, 129, 129, 67, 80, 81, 81, 80, 80, 80, 81, 96, 96, 96, 103, 103, 96, 103, 129, 103, 129, 121, 129, 136, 67, 81, 81, 67, 80, 80, 87, 80, 87, 103, 112, 112, 103, 103, 112, 112, 129, 129, 129, 137, 137, 67, 67, 77, 87, 87, 87, 67, 87, 87, 87, 112, 87, 121, 103, 121, 96, 112, 129, 129, 137, 112, 67, 81, 81, 81, 87, 87, 67, 103, 81, 87, 121, 121, 112, 121, 121, 103, 112, 103, 137, 121, 137, 67, 81, 87, 67, 87, 87, 81, 77, 112, 87, 87, 112, 103, 121, 129, 103, 121, 121, 136, 121, 129, 61, 67, 87, 67, 103, 87, 87, 77, 87, 77, 103, 87, 103, 121, 103, 103, 121, 121, 137, 121, 129,		\
+	104, 6, 16, 8,		\
+		25, 42, 25, 25, 26, 42, 47, 38, 26, 25, 47, 25, 25, 47, 42, 47, 19, 25, 19, 42, 38, 38, 42, 38, 25, 26, 26, 25, 38, 26, 47, 42, 26, 19, 21, 21, 26, 43, 38, 43, 26, 38, 38, 38, 42, 38, 47, 47, 26, 26, 21, 38, 42, 56, 43, 47, 26, 19, 38, 26, 38, 38, 38, 47, 21, 20, 38, 26, 21, 38, 38, 38, 21, 38, 38, 38, 38, 38, 38, 26, 38, 38, 38, 21, 21, 38, 43, 43, 21, 38, 43, 43, 21, 21, 38, 43, 20, 21, 38, 21, 38, 38, 43, 38, 20, 21, 21, 38, 21, 43, 43, 38, 21, 43, 21, 43, 21, 43, 38, 56, 21, 44, 43, 38, 43, 57, 43, 57,		\
+	96, 34, 6, 19,		\
+		111, 94, 94, 109, 111, 114, 135, 114, 114, 135, 114, 135, 139, 139, 162, 162, 158, 135, 149, 111, 94, 114, 114, 114, 94, 114, 109, 114, 135, 139, 135, 135, 135, 135, 139, 162, 135, 162, 114, 94, 109, 94, 111, 111, 114, 111, 111, 114, 135, 135, 139, 139, 135, 135, 135, 135, 162, 94, 109, 94, 109, 114, 114, 135, 114, 111, 139, 125, 111, 111, 135, 162, 139, 139, 135, 162, 111, 94, 111, 114, 114, 111, 111, 109, 114, 111, 139, 111, 139, 139, 135, 139, 139, 139, 139, 100, 111, 111, 109, 111, 109, 111, 111, 114, 114, 111, 139, 135, 135, 139, 139, 135, 159, 162,		\
+	81, 16, 4, 28,		\
+		41, 41, 54, 76, 74, 76, 74, 59, 54, 70, 74, 98, 70, 98, 95, 95, 93, 76, 95, 95, 95, 93, 119, 93, 119, 133, 119, 119, 54, 59, 74, 59, 74, 74, 74, 76, 74, 74, 74, 74, 70, 76, 74, 95, 74, 98, 95, 93, 119, 119, 98, 98, 119, 119, 119, 119, 54, 54, 59, 41, 54, 70, 70, 76, 74, 74, 70, 93, 74, 99, 98, 74, 95, 99, 93, 119, 119, 98, 119, 93, 133, 119, 128, 145, 54, 54, 55, 59, 59, 54, 74, 74, 74, 74, 74, 99, 70, 70, 79, 93, 98, 74, 93, 99, 93, 93, 98, 119, 98, 133, 119, 133,		\
+	61, 69, 5, 21,		\
+		199, 207, 207, 207, 207, 214, 207, 225, 214, 238, 225, 214, 225, 238, 225, 238, 234, 238, 238, 238, 238, 207, 187, 207, 207, 199, 207, 207, 207, 207, 207, 207, 225, 225, 238, 238, 225, 238, 238, 241, 238, 238, 207, 188, 207, 207, 207, 207, 214, 208, 225, 225, 225, 207, 225, 238, 225, 238, 241, 241, 238, 254, 238, 188, 207, 188, 214, 207, 208, 207, 225, 225, 225, 225, 225, 225, 238, 238, 238, 238, 225, 241, 238, 254, 207, 214, 207, 214, 208, 207, 225, 204, 225, 204, 238, 241, 238, 238, 225, 238, 230, 250, 254, 238, 241,		\
+	28, 12, 8, 12,		\
+		49, 49, 24, 28, 49, 52, 58, 49, 49, 62, 58, 72, 28, 28, 49, 52, 52, 52, 52, 62, 58, 62, 62, 77, 49, 49, 49, 28, 24, 52, 49, 49, 52, 58, 62, 49, 32, 52, 32, 28, 49, 52, 49, 62, 62, 58, 72, 58, 32, 62, 49, 62, 49, 58, 72, 62, 62, 62, 49, 72, 32, 24, 52, 62, 49, 32, 58, 49, 62, 58, 72, 72, 24, 32, 32, 49, 49, 24, 49, 49, 49, 58, 62, 58, 32, 24, 49, 32, 49, 58, 49, 49, 72, 72, 58, 49,		\
+	25, 69, 5, 19,		\
+		198, 203, 198, 203, 218, 203, 218, 218, 233, 237, 233, 216, 237, 233, 233, 233, 243, 233, 237, 198, 198, 180, 203, 203, 203, 218, 233, 218, 216, 237, 243, 233, 216, 247, 237, 233, 233, 237, 198, 198, 218, 218, 218, 218, 216, 203, 203, 216, 218, 233, 237, 237, 224, 237, 243, 224, 243, 203, 218, 198, 198, 218, 218, 218, 203, 218, 233, 233, 224, 216, 243, 243, 237, 216, 243, 237, 195, 198, 216, 198, 218, 218, 203, 218, 216, 218, 224, 218, 237, 216, 233, 237, 224, 244, 244,		\
+	32, 27, 8, 11,		\
+		97, 77, 72, 88, 72, 72, 88, 97, 97, 123, 97, 97, 72, 88, 97, 97, 97, 105, 97, 97, 97, 123, 77, 72, 97, 72, 97, 97, 97, 97, 105, 123, 123, 72, 78, 72, 72, 97, 97, 88, 88, 88, 88, 97, 78, 88, 78, 78, 78, 88, 88, 105, 97, 127, 127, 88, 97, 88, 78, 88, 97, 105, 105, 88, 123, 105, 78, 88, 88, 72, 88, 88, 78, 105, 97, 105, 105, 85, 88, 97, 105, 91, 78, 88, 97, 105, 127, 127,		\
+	5, 81, 9, 9,		\
+		232, 228, 240, 232, 240, 240, 247, 232, 247, 222, 222, 228, 232, 232, 240, 240, 247, 240, 228, 247, 232, 228, 232, 240, 247, 240, 249, 222, 222, 222, 232, 240, 240, 249, 232, 240, 232, 228, 222, 240, 247, 249, 232, 247, 249, 232, 232, 247, 249, 232, 249, 240, 249, 247, 222, 247, 232, 232, 232, 232, 247, 247, 247, 232, 232, 232, 232, 232, 233, 232, 249, 249, 232, 247, 232, 232, 247, 232, 249, 247, 249,		\
+	118, 14, 2, 38,		\
+		43, 43, 57, 43, 43, 57, 57, 56, 84, 56, 57, 71, 84, 101, 84, 100, 101, 101, 101, 101, 101, 101, 125, 108, 115, 108, 115, 140, 130, 115, 115, 140, 140, 151, 130, 140, 140, 151, 43, 43, 57, 57, 57, 56, 57, 57, 84, 84, 84, 57, 84, 102, 84, 101, 84, 84, 101, 108, 101, 108, 101, 115, 102, 115, 102, 130, 130, 130, 115, 130, 140, 140, 102, 140, 165, 165,		\
+	20, 0, 11, 6,		\
+		2, 23, 3, 2, 23, 23, 3, 3, 4, 4, 2, 4, 3, 3, 4, 2, 2, 23, 4, 3, 2, 23, 23, 2, 3, 3, 3, 23, 5, 2, 5, 3, 3, 3, 4, 4, 3, 4, 4, 23, 23, 4, 3, 3, 4, 4, 5, 5, 3, 5, 4, 4, 28, 4, 3, 5, 4, 4, 4, 23, 4, 5, 5, 28, 5, 28,		\
+	93, 27, 11, 6,		\
+		99, 99, 99, 94, 94, 79, 74, 79, 79, 79, 94, 94, 99, 94, 94, 109, 109, 79, 79, 99, 79, 94, 94, 94, 79, 94, 79, 79, 109, 94, 79, 94, 94, 71, 94, 114, 66, 94, 79, 94, 100, 94, 94, 94, 66, 100, 94, 83, 79, 79, 94, 83, 94, 94, 83, 71, 71, 71, 109, 109, 66, 66, 66, 66, 94, 83,		\
+	0, 22, 12, 5,		\
+		48, 75, 80, 75, 65, 75, 75, 75, 65, 80, 65, 48, 80, 80, 65, 75, 65, 65, 65, 80, 61, 48, 75, 65, 65, 61, 65, 80, 75, 75, 75, 61, 80, 80, 65, 80, 65, 80, 80, 89, 65, 61, 80, 89, 65, 81, 65, 65, 61, 80, 65, 67, 61, 80, 81, 81, 80, 81, 61, 81,		\
+	93, 34, 2, 29,		\
+		99, 94, 114, 120, 114, 120, 109, 114, 114, 149, 114, 135, 114, 149, 149, 158, 133, 149, 162, 135, 149, 162, 162, 179, 179, 179, 179, 179, 174, 94, 109, 94, 114, 114, 98, 114, 114, 135, 114, 135, 135, 114, 158, 135, 162, 149, 162, 162, 149, 162, 162, 174, 162, 162, 167, 179, 179, 179,		\
+	12, 60, 7, 8,		\
+		163, 163, 160, 175, 182, 175, 182, 209, 163, 182, 163, 163, 175, 182, 182, 182, 163, 175, 182, 182, 194, 194, 182, 197, 163, 182, 194, 197, 183, 182, 194, 194, 153, 163, 163, 182, 194, 183, 194, 194, 163, 182, 183, 182, 163, 194, 182, 183, 163, 183, 163, 183, 183, 182, 194, 194,		\
+	0, 35, 2, 27,		\
+		126, 89, 89, 89, 116, 126, 116, 116, 126, 126, 126, 141, 126, 142, 141, 160, 141, 141, 141, 141, 141, 168, 168, 168, 186, 168, 168, 116, 89, 116, 126, 89, 126, 116, 126, 126, 126, 126, 136, 126, 141, 141, 160, 141, 141, 168, 168, 168, 160, 175, 160, 168, 160, 168,		\
+	82, 61, 3, 17,		\
+		177, 177, 177, 196, 201, 177, 177, 211, 201, 196, 196, 201, 196, 223, 211, 223, 223, 177, 177, 177, 177, 177, 201, 201, 201, 177, 201, 196, 201, 201, 211, 205, 201, 205, 177, 196, 196, 174, 177, 196, 177, 196, 211, 196, 196, 205, 196, 201, 205, 227, 205,		\
+	28, 6, 10, 5,		\
+		5, 28, 28, 4, 28, 28, 4, 5, 5, 23, 23, 5, 28, 28, 28, 28, 7, 45, 49, 24, 5, 28, 32, 28, 32, 32, 28, 28, 28, 28, 5, 5, 5, 32, 24, 32, 5, 5, 5, 24, 24, 5, 24, 5, 24, 5, 5, 32, 24, 24,		\
+	67, 66, 2, 24,		\
+		204, 188, 178, 207, 191, 188, 225, 225, 225, 207, 225, 225, 230, 225, 225, 225, 241, 225, 238, 225, 241, 241, 254, 254, 178, 208, 191, 188, 204, 188, 204, 208, 225, 226, 225, 225, 225, 225, 225, 241, 225, 230, 225, 254, 230, 241, 241, 254,		\
+	112, 84, 8, 6,		\
+		253, 245, 253, 245, 253, 253, 236, 221, 236, 236, 245, 253, 253, 245, 245, 231, 236, 253, 231, 236, 236, 236, 253, 245, 253, 253, 253, 236, 253, 253, 236, 236, 236, 253, 253, 236, 245, 236, 236, 236, 253, 236, 245, 253, 245, 253, 253, 253,		\
+	95, 57, 9, 5,		\
+		167, 162, 167, 167, 185, 162, 162, 162, 162, 167, 162, 179, 167, 162, 185, 167, 162, 162, 185, 179, 179, 179, 162, 167, 167, 185, 179, 167, 185, 167, 167, 185, 185, 185, 167, 151, 159, 185, 171, 185, 167, 167, 167, 185, 185,		\
+	0, 2, 11, 4,		\
+		1, 0, 0, 0, 0, 0, 27, 30, 0, 30, 0, 0, 1, 0, 0, 30, 1, 0, 27, 22, 0, 0, 0, 0, 27, 22, 27, 22, 27, 1, 0, 22, 27, 1, 22, 22, 1, 22, 27, 1, 27, 2, 27, 22,		\
+	81, 46, 4, 11,		\
+		133, 145, 133, 133, 152, 152, 152, 152, 170, 170, 170, 133, 133, 145, 152, 152, 145, 170, 152, 170, 145, 166, 119, 133, 133, 145, 133, 170, 166, 152, 170, 152, 158, 152, 133, 133, 133, 149, 170, 149, 170, 152, 170, 170,		\
+	88, 70, 5, 8,		\
+		205, 196, 205, 205, 205, 227, 200, 205, 196, 205, 179, 196, 205, 205, 200, 227, 205, 196, 205, 205, 205, 227, 205, 205, 200, 196, 201, 227, 205, 200, 200, 200, 205, 179, 200, 220, 205, 205, 227, 227,		\
+	99, 75, 13, 3,		\
+		217, 220, 220, 220, 217, 220, 220, 231, 220, 220, 212, 212, 220, 231, 217, 220, 217, 212, 231, 235, 231, 212, 217, 212, 231, 212, 212, 212, 212, 212, 231, 231, 221, 217, 221, 231, 221, 212, 221,		\
+	104, 3, 11, 3,		\
+		26, 18, 19, 26, 19, 25, 19, 19, 18, 19, 26, 26, 21, 19, 26, 19, 26, 38, 25, 20, 20, 26, 21, 26, 26, 26, 21, 20, 21, 21, 20, 20, 38,		\
+	12, 45, 2, 15,		\
+		137, 137, 136, 129, 142, 142, 137, 137, 160, 160, 163, 175, 182, 182, 160, 129, 129, 129, 142, 137, 137, 137, 160, 137, 160, 163, 163, 163, 160, 163,		\
+	109, 14, 9, 3,		\
+		38, 56, 56, 38, 47, 56, 38, 38, 56, 47, 47, 56, 43, 56, 38, 38, 57, 57, 38, 43, 71, 43, 43, 56, 21, 57, 43,		\
+	30, 77, 2, 13,		\
+		224, 218, 224, 237, 224, 237, 216, 237, 244, 243, 237, 237, 244, 218, 237, 237, 224, 216, 237, 237, 244, 237, 233, 224, 246, 243,		\
+	38, 14, 2, 13,		\
+		49, 58, 49, 58, 62, 58, 78, 58, 72, 78, 88, 78, 72, 24, 58, 58, 49, 63, 49, 72, 58, 72, 58, 58, 88, 68,		\
+	64, 0, 13, 2,		\
+		11, 11, 13, 13, 11, 13, 11, 13, 11, 11, 11, 13, 11, 13, 13, 14, 14, 13, 13, 13, 13, 15, 14, 13, 15, 14,		\
+	12, 69, 2, 12,		\
+		197, 197, 209, 194, 194, 182, 203, 209, 222, 232, 203, 232, 197, 194, 194, 209, 197, 222, 209, 209, 232, 232, 232, 233,		\
+	53, 14, 12, 2,		\
+		33, 63, 33, 33, 51, 33, 51, 33, 33, 51, 34, 33, 51, 51, 51, 34, 33, 34, 51, 53, 53, 53, 64, 34,		\
+	62, 61, 3, 8,		\
+		188, 188, 188, 187, 199, 199, 188, 188, 164, 188, 188, 178, 188, 207, 188, 207, 188, 188, 188, 178, 188, 188, 188, 207,		\
+	86, 0, 12, 2,		\
+		16, 17, 16, 17, 17, 17, 16, 17, 18, 18, 14, 18, 18, 18, 18, 16, 17, 18, 18, 17, 18, 18, 18, 25,		\
+	16, 45, 2, 11,		\
+		137, 137, 137, 137, 163, 137, 153, 163, 153, 137, 137, 129, 137, 122, 137, 137, 163, 137, 163, 163, 150, 163,		\
+	102, 33, 2, 11,		\
+		109, 83, 109, 109, 111, 100, 111, 111, 111, 139, 111, 83, 111, 109, 109, 111, 94, 111, 111, 139, 134, 125,		\
+	110, 0, 10, 2,		\
+		19, 19, 19, 19, 20, 19, 19, 20, 20, 20, 20, 21, 20, 20, 21, 20, 20, 20, 21, 21,		\
+	40, 14, 9, 2,		\
+		24, 40, 49, 49, 58, 40, 63, 40, 63, 36, 40, 24, 36, 36, 33, 63, 36, 63,		\
+	102, 48, 2, 9,		\
+		139, 135, 167, 139, 162, 162, 162, 167, 159, 134, 139, 139, 162, 139, 162, 159, 171, 159,		\
+	14, 88, 8, 2,		\
+		249, 233, 233, 249, 249, 247, 247, 247, 247, 249, 249, 243, 233, 249, 243, 249,		\
+	19, 66, 8, 2,		\
+		183, 194, 183, 183, 182, 198, 183, 183, 182, 183, 183, 198, 180, 183, 180, 198,		\
+	85, 70, 2, 8,		\
+		205, 211, 196, 205, 205, 211, 205, 223, 205, 196, 205, 223, 201, 205, 205, 205,		\
+	1, 27, 5, 3,		\
+		89, 75, 80, 80, 89, 89, 65, 80, 96, 80, 75, 65, 80, 65, 89,		\
+	36, 11, 2, 7,		\
+		32, 32, 58, 49, 24, 32, 49, 32, 32, 58, 24, 49, 32, 58,		\
+	0, 13, 3, 4,		\
+		30, 48, 30, 48, 48, 48, 30, 30, 48, 30, 39, 48,		\
+	14, 0, 6, 2,		\
+		2, 1, 1, 2, 2, 3, 1, 23, 1, 1, 2, 2,		\
+	22, 22, 6, 2,		\
+		52, 52, 77, 77, 62, 77, 77, 77, 62, 77, 77, 62,		\
+	65, 61, 4, 3,		\
+		188, 164, 188, 164, 188, 178, 178, 178, 188, 188, 164, 188,		\
+	93, 24, 4, 3,		\
+		55, 79, 79, 66, 79, 94, 55, 79, 66, 79, 94, 79,		\
+	98, 2, 6, 2,		\
+		18, 25, 26, 18, 26, 18, 18, 18, 26, 19, 19, 18,		\
+	100, 24, 4, 3,		\
+		66, 83, 79, 66, 66, 66, 66, 94, 66, 66, 66, 83,		\
+	117, 2, 3, 4,		\
+		21, 21, 20, 20, 20, 20, 21, 21, 20, 20, 21, 21,		\
+	0, 84, 5, 2,		\
+		228, 240, 240, 240, 240, 228, 228, 232, 240, 240,		\
+	14, 51, 2, 5,		\
+		142, 163, 163, 137, 137, 137, 142, 153, 163, 137,		\
+	36, 22, 2, 5,		\
+		49, 72, 49, 88, 58, 78, 58, 58, 72, 78,		\
+	82, 83, 2, 5,		\
+		230, 227, 227, 251, 251, 227, 242, 227, 227, 227,		\
+	9, 27, 3, 3,		\
+		80, 65, 81, 81, 80, 80, 65, 87, 81,		\
+	12, 22, 4, 2,		\
+		80, 67, 67, 81, 61, 81, 67, 61,		\
+	17, 56, 2, 4,		\
+		153, 137, 183, 182, 163, 163, 153, 182,		\
+	26, 88, 4, 2,		\
+		237, 249, 244, 243, 243, 237, 237, 243,		\
+	100, 53, 2, 4,		\
+		159, 162, 179, 167, 139, 139, 162, 162,		\
+	102, 0, 4, 2,		\
+		19, 19, 19, 19, 18, 19, 19, 26,		\
+	0, 6, 3, 2,		\
+		0, 0, 0, 30, 0, 30,		\
+	3, 81, 2, 3,		\
+		206, 222, 240, 209, 222, 240,		\
+	32, 60, 3, 2,		\
+		154, 180, 180, 154, 169, 172,		\
+	93, 75, 2, 3,		\
+		220, 205, 227, 205, 205, 205,		\
+	104, 14, 2, 3,		\
+		26, 47, 42, 42, 42, 47,		\
+	14, 45, 2, 2,		\
+		129, 136, 129, 129,		\
+	0x12, 83, 89, 29,		\
+		227, 251, 227, 251, 251, 251, 227, 242, 251, 242, 242, 252, 239, 242, 252, 235, 252, 235, 235, 252, 253, 252, 252, 245, 245, 252, 253, 253, 253,		\
+	0x07, 19, 39, 61, 22,		\
+		184, 184, 173, 173, 173, 189, 189, 173, 190, 173, 190, 189, 161, 176, 176, 176, 161, 176, 187, 188, 187, 187,		\
+	90, 88, 9,		\
+		242, 251, 242, 251, 252, 242, 235, 235, 235,		\
+	4, 1, 7,		\
+		0, 1, 0, 1, 1, 1, 22,		\
+	13, 3, 7,		\
+		1, 2, 2, 3, 3, 3, 4,		\
+	13, 5, 7,		\
+		22, 22, 2, 23, 2, 2, 4,		\
+	31, 2, 7,		\
+		3, 28, 5, 24, 5, 5, 7,		\
+	31, 5, 7,		\
+		28, 5, 32, 5, 5, 6, 24,		\
+	69, 89, 7,		\
+		250, 254, 241, 254, 254, 241, 241,		\
+	107, 88, 5,		\
+		235, 245, 245, 253, 253,		\
+	110, 2, 5,		\
+		21, 20, 19, 20, 21,		\
+	107, 62, 4,		\
+		171, 171, 171, 171,		\
+	4, 0, 3,		\
+		1, 0, 0,		\
+	95, 62, 3,		\
+		179, 185, 179,		\
+	0, 21, 2,		\
+		48, 65,		\
+	0, 80, 2,		\
+		206, 222,		\
+	20, 68, 2,		\
+		183, 182,		\
+	29, 68, 2,		\
+		198, 198,		\
+	82, 78, 2,		\
+		205, 205,		\
+	104, 2, 2,		\
+		25, 26,		\
+	0x13, 111, 62, 13,		\
+		181, 171, 192, 171, 192, 192, 202, 192, 212, 215, 221, 212, 221,		\
+	0x07, 23, 0, 62, 12,		\
+		168, 168, 186, 186, 168, 186, 186, 186, 206, 186, 206, 206,		\
+	95, 45, 12,		\
+		135, 111, 135, 135, 135, 135, 158, 162, 174, 158, 162, 162,		\
+	24, 69, 10,		\
+		183, 198, 203, 218, 203, 203, 203, 203, 233, 218,		\
+	119, 52, 10,		\
+		165, 165, 165, 165, 102, 181, 181, 165, 181, 181,		\
+	31, 68, 9,		\
+		180, 195, 195, 218, 195, 195, 216, 216, 216,		\
+	66, 66, 8,		\
+		178, 188, 207, 204, 207, 207, 207, 204,		\
+	66, 82, 8,		\
+		238, 238, 241, 241, 238, 254, 254, 254,		\
+	14, 69, 7,		\
+		182, 209, 209, 194, 209, 209, 209,		\
+	1, 30, 5,		\
+		75, 80, 80, 116, 116,		\
+	2, 17, 5,		\
+		48, 30, 75, 75, 65,		\
+	64, 2, 5,		\
+		13, 12, 34, 34, 11,		\
+	0, 86, 4,		\
+		228, 240, 240, 240,		\
+	1, 70, 4,		\
+		197, 206, 206, 186,		\
+	14, 56, 4,		\
+		163, 175, 163, 163,		\
+	14, 84, 4,		\
+		247, 232, 249, 247,		\
+	18, 52, 4,		\
+		163, 163, 163, 153,		\
+	81, 57, 4,		\
+		170, 174, 170, 177,		\
+	84, 57, 4,		\
+		174, 170, 158, 174,		\
+	95, 34, 4,		\
+		94, 94, 109, 94,		\
+	35, 24, 3,		\
+		72, 58, 78,		\
+	65, 66, 3,		\
+		204, 188, 188,		\
+	110, 72, 3,		\
+		217, 217, 221,		\
+	31, 3, 2,		\
+		28, 5,		\
+	0x01, 1, 13, 1,		\
+	0x07, 8, 32, 35, 11,		\
+	79, 101, 33,		\
+	89, 0, 27,		\
+	122, 32, 38,		\
+	169, 39, 60,		\
+	181, 118, 61,		\
+	198, 30, 69,		\
+	227, 87, 77,		\
+	0xff
+
+#endif  //  PHOTO_H_INCLUDED
+
@@ -0,0 +1,782 @@
+/*
+ *  ST7735 Huffman Coded Image (draw with drawHuffImage())
+ *  Original: photo.png
+ *  Commands: 11058 bytes, coded: 11191 (code tables and bitstream); total 11702 vs. 11569 bytes
+ */
+
+#ifndef PHOTO_HUFF_H_INCLUDED
+#define PHOTO_HUFF_H_INCLUDED
+
+#define PHOTO_WIDTH		120
+#define PHOTO_HEIGHT		90
+#define PHOTO_HUFF_LEN		11702	/*  Total array size  */
+
+#define PHOTO_HUFF		\
+	255,		\
+	0x61, 0x08,	0x22, 0x18,	0x83, 0x28,	0x43, 0x38,		\
+	0x65, 0x38,	0x65, 0x48,	0x86, 0x60,	0x67, 0x58,		\
+	0x47, 0x70,	0xa7, 0x68,	0xa9, 0x70,	0x49, 0x80,		\
+	0xc8, 0x80,	0x6a, 0x90,	0x6b, 0xa8,	0x8b, 0x98,		\
+	0x6b, 0xb8,	0x6d, 0xb8,	0x6d, 0xc8,	0x4e, 0xe0,		\
+	0x4f, 0xf0,	0xb0, 0xf0,	0xc2, 0x18,	0xc4, 0x30,		\
+	0xe7, 0x50,	0xaf, 0xd0,	0xce, 0xd8,	0x83, 0x18,		\
+	0xe5, 0x40,	0xcc, 0xb0,	0xe2, 0x08,	0xec, 0x98,		\
+	0x06, 0x51,	0xe9, 0x78,	0xea, 0x88,	0xed, 0xc8,		\
+	0x07, 0x69,	0xea, 0x98,	0x10, 0xe9,	0x04, 0x19,		\
+	0x29, 0x69,	0xed, 0xb0,	0x0f, 0xd1,	0x11, 0xf1,		\
+	0xcc, 0x41,	0x25, 0x31,	0x24, 0x29,	0x50, 0xd9,		\
+	0x63, 0x09,	0x47, 0x49,	0x6d, 0xc1,	0x6a, 0x79,		\
+	0x66, 0x39,	0x4b, 0x89,	0x6d, 0xb1,	0x6f, 0xc1,		\
+	0x71, 0xe9,	0x72, 0xf1,	0x68, 0x51,	0x6d, 0xa1,		\
+	0x8c, 0xa1,	0x84, 0x21,	0x86, 0x41,	0x68, 0x61,		\
+	0x8c, 0x89,	0xa5, 0x11,	0xb0, 0xd1,	0xa6, 0x29,		\
+	0x8a, 0x61,	0xab, 0x89,	0xcf, 0xb1,	0xb2, 0xe1,		\
+	0xe8, 0x49,	0xca, 0x71,	0xee, 0xb1,	0xc3, 0x09,		\
+	0xed, 0xa1,	0xe7, 0x39,	0xe9, 0x59,	0xf0, 0xc1,		\
+	0x05, 0x12,	0x05, 0x22,	0xed, 0x89,	0x31, 0xe2,		\
+	0xf3, 0xf1,	0xea, 0x61,	0x0b, 0x7a,	0x46, 0x2a,		\
+	0x2a, 0x52,	0x44, 0x0a,	0x48, 0x3a,	0x2b, 0x62,		\
+	0x4d, 0x8a,	0x6f, 0xa2,	0x51, 0xca,	0x6e, 0xaa,		\
+	0x66, 0x12,	0x69, 0x4a,	0x70, 0xb2,	0x50, 0xba,		\
+	0x53, 0xe2,	0x34, 0xfa,	0xb5, 0x02,	0x68, 0x2a,		\
+	0x6b, 0x72,	0x8a, 0x52,	0x6d, 0x7a,	0xae, 0x9a,		\
+	0x92, 0xf2,	0x91, 0xd2,	0xad, 0x82,	0xb2, 0xd2,		\
+	0xa6, 0x22,	0x8e, 0x8a,	0xd2, 0xc2,	0xd5, 0xf2,		\
+	0xa5, 0x0a,	0xac, 0x5a,	0xcb, 0x6a,	0xd0, 0xaa,		\
+	0xd0, 0xba,	0xc8, 0x32,	0xca, 0x3a,	0xc9, 0x4a,		\
+	0xec, 0x72,	0xd4, 0xe2,	0xe6, 0x0a,	0xea, 0x4a,		\
+	0xef, 0x9a,	0xe8, 0x22,	0x14, 0xf3,	0x4c, 0x63,		\
+	0x0e, 0x83,	0x31, 0xb3,	0x34, 0xe3,	0x52, 0xcb,		\
+	0x47, 0x1b,	0x49, 0x2b,	0x50, 0x93,	0x34, 0xd3,		\
+	0x56, 0xfb,	0x67, 0x0b,	0x49, 0x1b,	0x4a, 0x43,		\
+	0x4c, 0x4b,	0x70, 0xa3,	0x4d, 0x73,	0x6e, 0x83,		\
+	0x4f, 0x93,	0x72, 0xbb,	0x6b, 0x3b,	0x75, 0xe3,		\
+	0x72, 0xb3,	0xca, 0x33,	0xac, 0x4b,	0xac, 0x63,		\
+	0x6d, 0x63,	0xad, 0x73,	0x93, 0xbb,	0xd4, 0xe3,		\
+	0xc8, 0x13,	0xaf, 0x7b,	0xb4, 0xcb,	0xca, 0x23,		\
+	0xd0, 0x93,	0xd6, 0xf3,	0xd1, 0xa3,	0xf5, 0xd3,		\
+	0xe8, 0x0b,	0xed, 0x53,	0xd2, 0xab,	0xf6, 0xe3,		\
+	0xec, 0x3b,	0xee, 0x63,	0x12, 0xbc,	0x4a, 0x14,		\
+	0x2f, 0x74,	0x33, 0xac,	0x31, 0x9c,	0x54, 0xc4,		\
+	0x4c, 0x44,	0x37, 0xf4,	0x6a, 0x2c,	0x4c, 0x34,		\
+	0x2e, 0x5c,	0x55, 0xd4,	0x69, 0x0c,	0x50, 0x74,		\
+	0x51, 0x8c,	0x6d, 0x5c,	0x6f, 0x6c,	0x53, 0x94,		\
+	0x77, 0xe4,	0x59, 0xf4,	0x8c, 0x24,	0xae, 0x54,		\
+	0x74, 0xb4,	0xaa, 0x1c,	0x8d, 0x44,	0xb0, 0x74,		\
+	0xb5, 0xcc,	0xd3, 0xac,	0xb8, 0xf4,	0xed, 0x34,		\
+	0xd2, 0x94,	0xf5, 0xbc,	0xea, 0x0c,	0xd2, 0x84,		\
+	0xd3, 0x94,	0xec, 0x24,	0xb0, 0x5c,	0xd5, 0xa4,		\
+	0xf7, 0xe4,	0x0f, 0x65,	0x11, 0x7d,	0xf9, 0xfc,		\
+	0x0e, 0x4d,	0xd8, 0xdc,	0xee, 0x44,	0x30, 0x6d,		\
+	0x17, 0xcd,	0x19, 0xed,	0x2b, 0x1d,	0x34, 0xa5,		\
+	0x50, 0x4d,	0x33, 0x8d,	0x33, 0x9d,	0x76, 0xb5,		\
+	0x6b, 0x0d,	0x70, 0x5d,	0x75, 0x9d,	0x78, 0xe5,		\
+	0x6c, 0x25,	0x4e, 0x35,	0x72, 0x75,	0x98, 0xd5,		\
+	0x7a, 0xf5,	0xae, 0x4d,	0xb3, 0x85,	0x96, 0xc5,		\
+	0xcc, 0x0d,	0xb4, 0x95,	0x97, 0xbd,	0xaf, 0x35,		\
+	0xb1, 0x4d,	0x9a, 0xe5,	0xd0, 0x5d,	0xcd, 0x25,		\
+	0xd2, 0x6d,	0xce, 0x25,	0xf3, 0x7d,	0xf6, 0xb5,		\
+	0xf9, 0xd5,	0xfa, 0xf5,	0xf5, 0x95,		\
+	0x00, 0x02, 0x02, 0x01, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x07, 0x05, 0x22,	\
+	0x25, 0x01, 0x03, 0x12, 0x13, 0x15, 0xff, 0x00, 0x00, 0x01, 0x02, 0x07, 0x0d, 0x1b, 0x11, 0x11,	\
+	0x12, 0x00, 0x00, 0x02, 0x03, 0x04, 0x00, 0x05, 0x06, 0x07, 0x08, 0x0c, 0x0e, 0x01, 0x09, 0x0b,	\
+	0x0d, 0x16, 0x18, 0x1b, 0x1c, 0x3d, 0x3e, 0x42, 0x45, 0x58, 0x0a, 0x10, 0x11, 0x13, 0x14, 0x15,	\
+	0x1d, 0x1e, 0x1f, 0x20, 0x21, 0x23, 0x26, 0x2d, 0x39, 0x3c, 0x40, 0x41, 0x44, 0x46, 0x51, 0x52,	\
+	0x54, 0x5d, 0x5f, 0x66, 0x68, 0x0f, 0x12, 0x22, 0x24, 0x27, 0x34, 0x35, 0x38, 0x4b, 0x4d, 0x53,	\
+	0x56, 0x59, 0x62, 0x6e, 0x70, 0x76, 0x19, 0x1a, 0x28, 0x2c, 0x33, 0x3f, 0x4a, 0x4c, 0x4e, 0x4f,	\
+	0x55, 0x57, 0x60, 0x63, 0x64, 0x6a, 0x6b, 0x17, 0x29, 0x2a, 0x2e, 0x2f, 0x30, 0x31, 0x43, 0x48,	\
+	0x50, 0x5a, 0x61, 0x65, 0x6d, 0x6f, 0x73, 0x75, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19,	\
+	0xb8, 0x2b, 0x01, 0x02, 0x00, 0x12, 0x22, 0x42, 0x56, 0x6f, 0x77, 0x7c, 0x89, 0x9a, 0xa1, 0xa3,	\
+	0xa4, 0xb9, 0xbc, 0xc0, 0xc8, 0xcb, 0xcd, 0xcf, 0xdc, 0xe1, 0xe3, 0xe7, 0xe8, 0xe9, 0x02, 0x04,	\
+	0x05, 0x06, 0x07, 0x09, 0x0a, 0x0b, 0x0d, 0x0e, 0x0f, 0x11, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a,	\
+	0x1c, 0x1d, 0x1f, 0x20, 0x21, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x2b, 0x2d, 0x2e,	\
+	0x2f, 0x30, 0x31, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x3b, 0x3c, 0x3d, 0x3e, 0x40,	\
+	0x41, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x4c, 0x4d, 0x4e, 0x4f, 0x50, 0x52, 0x53,	\
+	0x54, 0x57, 0x58, 0x5a, 0x5b, 0x5c, 0x5d, 0x5e, 0x5f, 0x60, 0x61, 0x62, 0x63, 0x64, 0x67, 0x68,	\
+	0x69, 0x6a, 0x6b, 0x6c, 0x6e, 0x70, 0x71, 0x72, 0x73, 0x75, 0x76, 0x79, 0x7a, 0x7b, 0x7d, 0x7e,	\
+	0x7f, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x87, 0x8a, 0x8b, 0x8d, 0x8e, 0x8f, 0x90, 0x91, 0x92,	\
+	0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9c, 0x9d, 0x9f, 0xa0, 0xa2, 0xa5, 0xa6, 0xa7, 0xa8,	\
+	0xa9, 0xaa, 0xab, 0xac, 0xad, 0xae, 0xaf, 0xb0, 0xb1, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8,	\
+	0xba, 0xbb, 0xbd, 0xbe, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc9, 0xce, 0xd1, 0xd3, 0xd4, 0xd5,	\
+	0xd6, 0xd8, 0xda, 0xdb, 0xdd, 0xde, 0xdf, 0xe0, 0xe5, 0xe6, 0xea, 0xeb, 0xec, 0xed, 0xee, 0xef,	\
+	0xf1, 0xf2, 0xf5, 0xf6, 0xf7, 0xf8, 0x00, 0x01, 0x03, 0x08, 0x0c, 0x13, 0x14, 0x1b, 0x1e, 0x32,	\
+	0x3f, 0x4b, 0x51, 0x55, 0x59, 0x65, 0x6d, 0x74, 0x78, 0x86, 0x88, 0x8c, 0x9b, 0x9e, 0xbf, 0xc1,	\
+	0xca, 0xcc, 0xd0, 0xd2, 0xd7, 0xd9, 0xe2, 0xe4, 0xf0, 0xf3, 0xf4, 0xf9, 0xfa, 0xfb, 0xfc, 0xfd,	\
+	0xfe, 0x10, 0x2c, 0x66, 0x84, 0xf7, 0x75, 0x19, 0x2e, 0x2b, 0xaf, 0xde, 0x0e, 0xbf, 0xe5, 0xd0,	\
+	0x67, 0x3b, 0xbf, 0xd2, 0x0e, 0xd7, 0x5e, 0x40, 0x63, 0x73, 0xe6, 0x31, 0x35, 0xab, 0xd2, 0x60,	\
+	0x17, 0xf3, 0x19, 0x12, 0xa7, 0xd5, 0xc4, 0x47, 0xdf, 0xe8, 0x07, 0xf7, 0x8a, 0xa3, 0x1d, 0x9f,	\
+	0xaa, 0x0c, 0xb3, 0x24, 0xa1, 0x22, 0xd3, 0x0e, 0x53, 0x00, 0x36, 0x84, 0x8c, 0xef, 0x41, 0x89,	\
+	0xf6, 0x7b, 0xb4, 0xcd, 0x83, 0xea, 0x8d, 0x44, 0x47, 0x7d, 0x68, 0x7c, 0x67, 0xa3, 0xd8, 0x14,	\
+	0x2b, 0x8b, 0xa4, 0x18, 0x77, 0x7e, 0x40, 0xd3, 0xbf, 0x47, 0x18, 0x6a, 0xbf, 0x19, 0x12, 0xf7,	\
+	0x2f, 0x18, 0x36, 0x5a, 0xf1, 0x28, 0x38, 0xaa, 0x42, 0x23, 0x4b, 0xc8, 0x58, 0xcb, 0xe4, 0xa1,	\
+	0x15, 0x51, 0x60, 0x1a, 0x46, 0x50, 0x3c, 0x13, 0xdc, 0x43, 0x09, 0x3d, 0x44, 0x20, 0xc1, 0xc1,	\
+	0xe3, 0xd8, 0xc3, 0xf9, 0xf3, 0xa9, 0x87, 0xef, 0x5d, 0x4c, 0xbe, 0xde, 0xe5, 0x83, 0x3b, 0xe7,	\
+	0x7d, 0x53, 0xde, 0xdc, 0x0c, 0xc8, 0x6e, 0x86, 0x61, 0x45, 0xa1, 0x70, 0x98, 0x31, 0x2d, 0x12,	\
+	0x58, 0x16, 0x65, 0x08, 0x5d, 0x84, 0xd6, 0x75, 0x56, 0x85, 0xec, 0x77, 0x87, 0xad, 0xf5, 0xb6,	\
+	0x1e, 0x5c, 0xef, 0x91, 0xf8, 0xe9, 0x59, 0x4a, 0x3d, 0x8c, 0x8b, 0xdd, 0x89, 0x63, 0x66, 0x99,	\
+	0x86, 0x23, 0xf7, 0xbf, 0xab, 0x77, 0x4a, 0xcb, 0xbb, 0xda, 0xc0, 0x39, 0x96, 0xbc, 0x47, 0xa7,	\
+	0x60, 0x7e, 0x3c, 0x6b, 0x71, 0x44, 0xab, 0xf7, 0xa2, 0xbf, 0xdf, 0x8d, 0x99, 0x1d, 0x79, 0x79,	\
+	0xbf, 0xbc, 0xde, 0xbc, 0xde, 0xde, 0xde, 0xde, 0xfc, 0xf0, 0xf0, 0xec, 0xed, 0x1b, 0x09, 0x22,	\
+	0xfd, 0x1d, 0x1d, 0x29, 0x1b, 0x1b, 0x1b, 0x1b, 0x29, 0x29, 0x43, 0xea, 0x98, 0x98, 0x11, 0xea,	\
+	0xa1, 0xb4, 0xb4, 0xab, 0xb4, 0xb4, 0xb4, 0xc3, 0xc3, 0x56, 0x5e, 0x4e, 0x56, 0xef, 0x2f, 0x77,	\
+	0x9b, 0xd7, 0x99, 0x9e, 0x1b, 0xdb, 0xdf, 0x9b, 0xdb, 0xde, 0x21, 0x21, 0x1d, 0xa1, 0x21, 0x1e,	\
+	0x23, 0xa3, 0x63, 0x63, 0x66, 0x23, 0xa8, 0x66, 0x2a, 0xe6, 0x26, 0x28, 0x66, 0x3d, 0x55, 0x76,	\
+	0x9e, 0xab, 0x8b, 0x4b, 0x4c, 0x3b, 0x85, 0xe5, 0xee, 0xf2, 0xf2, 0xf7, 0x79, 0x99, 0xbd, 0xbd,	\
+	0xbf, 0xc2, 0xec, 0xec, 0xf0, 0xec, 0xec, 0xfc, 0xf1, 0x08, 0xf1, 0x1a, 0xed, 0x1b, 0x1b, 0x1d,	\
+	0x1b, 0x43, 0x1b, 0x1b, 0x31, 0x43, 0x31, 0x43, 0x31, 0x31, 0x31, 0xea, 0xab, 0x11, 0x31, 0xea,	\
+	0xf5, 0x61, 0xe1, 0xfa, 0x90, 0x57, 0x99, 0x97, 0x9b, 0xd3, 0x9b, 0xdb, 0xd9, 0x99, 0x9b, 0xdf,	\
+	0xbc, 0x2d, 0xee, 0xcf, 0x0e, 0xcf, 0x10, 0x90, 0x8f, 0x0f, 0x0f, 0x11, 0xb1, 0xb3, 0x11, 0xd1,	\
+	0xb3, 0x13, 0x14, 0x33, 0x13, 0x13, 0x15, 0x73, 0x17, 0x13, 0x15, 0x77, 0x15, 0x75, 0x77, 0x17,	\
+	0x18, 0xc9, 0x5d, 0xee, 0xf7, 0x79, 0x39, 0x79, 0x79, 0x9b, 0xc2, 0xdf, 0xe1, 0x76, 0xf0, 0xc2,	\
+	0x3c, 0x37, 0xbc, 0x42, 0x3c, 0x3b, 0x3c, 0x46, 0xc2, 0x4c, 0x46, 0xc7, 0x4c, 0x47, 0x46, 0xc6,	\
+	0xcc, 0x4c, 0x4c, 0x55, 0xd1, 0xd5, 0xcc, 0x7a, 0xbd, 0x57, 0x15, 0x9e, 0xab, 0x8b, 0x8c, 0x74,	\
+	0xe4, 0xa6, 0x65, 0xe6, 0x65, 0xe6, 0xfe, 0xf3, 0x37, 0x85, 0xdb, 0xc2, 0xf0, 0xf1, 0xe1, 0x6f,	\
+	0x78, 0x8d, 0x84, 0x78, 0x8e, 0x8d, 0x8d, 0x8e, 0x8d, 0x8d, 0x0d, 0x1b, 0x31, 0x1b, 0x1a, 0x1b,	\
+	0xd5, 0x57, 0x31, 0x31, 0xea, 0xab, 0xf5, 0x55, 0xdc, 0x5c, 0x61, 0xdc, 0x5c, 0x33, 0x2f, 0x33,	\
+	0x33, 0x33, 0x77, 0x99, 0x9b, 0xd9, 0x9b, 0xfc, 0x2f, 0x0f, 0x0d, 0x6f, 0x0f, 0x0d, 0xef, 0x11,	\
+	0xaf, 0x11, 0xcf, 0x11, 0xd1, 0xb1, 0xd1, 0xd1, 0xd3, 0x11, 0xd1, 0xd3, 0x13, 0x15, 0x75, 0x73,	\
+	0x1e, 0xab, 0x4a, 0xba, 0xbb, 0x8a, 0xcb, 0x8b, 0x8b, 0x4b, 0x8e, 0xf2, 0x72, 0x73, 0x33, 0x33,	\
+	0x5f, 0x87, 0xc2, 0xcc, 0xcc, 0xcc, 0xcc, 0xde, 0xf1, 0xe1, 0x83, 0x78, 0x78, 0x78, 0x8e, 0x78,	\
+	0x8d, 0x83, 0x8d, 0x8e, 0x0d, 0x1a, 0x1a, 0x8e, 0x62, 0x62, 0x8f, 0xd5, 0xea, 0x98, 0x98, 0xf5,	\
+	0x56, 0x5c, 0x5c, 0x5c, 0x56, 0x5d, 0xd6, 0x5c, 0x77, 0xbb, 0xdd, 0xe4, 0xe6, 0x66, 0xb6, 0xf6,	\
+	0x66, 0x66, 0x66, 0xb7, 0x86, 0xb8, 0x37, 0x87, 0x8f, 0x08, 0x38, 0x37, 0x88, 0xe7, 0x88, 0xe0,	\
+	0xd1, 0xc1, 0xa3, 0x66, 0x03, 0x4c, 0x46, 0x86, 0x98, 0xac, 0xab, 0xab, 0xf5, 0x7a, 0xae, 0x2e,	\
+	0x2e, 0x2e, 0xc4, 0xdd, 0xdd, 0xab, 0xa7, 0x77, 0x99, 0x9a, 0xd3, 0xbc, 0x2c, 0xca, 0xea, 0xfe,	\
+	0x1f, 0x0b, 0xc3, 0xc0, 0x38, 0x38, 0x38, 0xe8, 0x38, 0x37, 0x88, 0xd8, 0xe8, 0x30, 0xc1, 0x83,	\
+	0x47, 0x4c, 0x51, 0xcc, 0x51, 0xcc, 0x56, 0x55, 0xd1, 0xd5, 0xd6, 0x5c, 0x09, 0xac, 0xac, 0xb8,	\
+	0xbb, 0xb8, 0x4e, 0x4e, 0x57, 0x6b, 0x6b, 0x66, 0x66, 0x66, 0xf0, 0xb3, 0x35, 0xf8, 0x5e, 0x1e,	\
+	0x01, 0xbc, 0x03, 0x8d, 0x83, 0x83, 0x83, 0x8d, 0x83, 0x8d, 0x8e, 0x0c, 0x1a, 0x38, 0x30, 0x6a,	\
+	0x3a, 0xb9, 0x8a, 0x3a, 0x3a, 0xb1, 0x35, 0x77, 0x02, 0x6e, 0x2e, 0x04, 0xdc, 0x5c, 0x2b, 0xa5,	\
+	0x27, 0x77, 0x99, 0x99, 0x99, 0x81, 0xb3, 0x3c, 0x33, 0x03, 0x78, 0x06, 0xf1, 0x06, 0x0e, 0x0d,	\
+	0xe2, 0x16, 0x0e, 0x3a, 0x0e, 0x0c, 0x34, 0x6c, 0x45, 0x1c, 0xc5, 0x1c, 0xc5, 0x1c, 0xc4, 0xc5,	\
+	0x1d, 0x65, 0x65, 0x5d, 0x1d, 0xdd, 0x65, 0x65, 0x65, 0x66, 0x2a, 0x73, 0x32, 0xba, 0xba, 0xbb,	\
+	0x33, 0x5a, 0xbb, 0x5b, 0x5b, 0x33, 0x30, 0x30, 0x7e, 0x10, 0x70, 0x70, 0x70, 0x70, 0x71, 0xd1,	\
+	0xc1, 0xa3, 0xa1, 0x43, 0x06, 0x0d, 0x47, 0x47, 0x47, 0x57, 0x47, 0x47, 0x57, 0x47, 0x47, 0x71,	\
+	0x59, 0x59, 0x59, 0x77, 0x59, 0x77, 0x76, 0x9c, 0x9c, 0x9c, 0xae, 0xd6, 0xd6, 0xcc, 0xd6, 0x0f,	\
+	0xc2, 0x0d, 0xad, 0xad, 0xe2, 0x14, 0x1c, 0x1c, 0x1c, 0x74, 0x1c, 0x2c, 0x28, 0x68, 0x80, 0xc1,	\
+	0xa2, 0x03, 0x06, 0x0d, 0x46, 0x18, 0x35, 0x1d, 0x5d, 0x5d, 0x60, 0x91, 0x35, 0x95, 0x97, 0x17,	\
+	0x78, 0xf7, 0x1d, 0xe4, 0xe6, 0xb4, 0xe6, 0xb6, 0xb5, 0x76, 0xb6, 0xb6, 0x66, 0xb6, 0xb8, 0x30,	\
+	0x60, 0xc1, 0x83, 0x85, 0x85, 0x8e, 0x0d, 0x0a, 0x1a, 0x14, 0x30, 0x69, 0x90, 0xd4, 0x74, 0x61,	\
+	0xab, 0x28, 0xeb, 0x2a, 0xe8, 0xea, 0xc4, 0xd2, 0x52, 0x09, 0xbb, 0xbb, 0xc5, 0xac, 0x57, 0x4e,	\
+	0x57, 0x57, 0x57, 0x57, 0x59, 0x6b, 0x06, 0x0d, 0xac, 0x18, 0x30, 0x70, 0x70, 0x70, 0x70, 0xa0,	\
+	0xe3, 0xa0, 0xc3, 0x06, 0x88, 0x0c, 0x18, 0x30, 0x60, 0xd4, 0x61, 0xa9, 0x26, 0x69, 0x28, 0xeb,	\
+	0x28, 0xc4, 0x89, 0xac, 0xbb, 0x13, 0x70, 0x27, 0x15, 0x39, 0x5d, 0x5d, 0x65, 0x5d, 0x39, 0xac,	\
+	0x1b, 0x58, 0x36, 0xb0, 0x60, 0xc1, 0xb9, 0x03, 0x06, 0x0e, 0x0d, 0xe6, 0x0c, 0x34, 0x2c, 0x44,	\
+	0x2c, 0x40, 0x60, 0xd3, 0x31, 0x14, 0x94, 0x73, 0x35, 0x94, 0x82, 0x44, 0x89, 0xac, 0x13, 0x58,	\
+	0x27, 0x14, 0x4d, 0xda, 0x42, 0xba, 0xba, 0xbb, 0x5a, 0xba, 0xba, 0xb8, 0x36, 0x70, 0x60, 0xc1,	\
+	0xc2, 0xc2, 0x83, 0x83, 0x85, 0x0c, 0x0e, 0x16, 0x3a, 0x22, 0x16, 0x66, 0x22, 0x20, 0x35, 0x24,	\
+	0xcc, 0xcd, 0x1d, 0x1d, 0x18, 0x99, 0x9a, 0xc1, 0x22, 0x44, 0xdd, 0x89, 0x13, 0x8b, 0x8a, 0x9c,	\
+	0xae, 0xae, 0xce, 0xce, 0xae, 0x0c, 0x18, 0x30, 0x6d, 0x60, 0xe0, 0xe0, 0xe1, 0x61, 0x61, 0x63,	\
+	0x81, 0xc4, 0x42, 0xc2, 0x86, 0x0d, 0x10, 0x18, 0x34, 0xcc, 0xcc, 0xcc, 0xcc, 0xcd, 0x25, 0x25,	\
+	0x1d, 0x25, 0x20, 0x9a, 0xc1, 0x22, 0x6e, 0xc4, 0xe2, 0x8d, 0x57, 0x57, 0x02, 0xb2, 0xae, 0xc6,	\
+	0x0d, 0x5c, 0x18, 0x30, 0x6d, 0x6e, 0x40, 0xe1, 0x61, 0x61, 0x60, 0xc1, 0xc2, 0xc2, 0xc4, 0x44,	\
+	0x44, 0x42, 0xcc, 0x86, 0x99, 0x99, 0x99, 0xa4, 0xa4, 0xa5, 0xa4, 0xa4, 0xa4, 0x13, 0x49, 0x58,	\
+	0x24, 0x48, 0x91, 0x37, 0x78, 0xaa, 0xec, 0xeb, 0x2b, 0x2c, 0xec, 0x6c, 0xed, 0x6e, 0x40, 0xd8,	\
+	0xc1, 0x83, 0x83, 0x07, 0x11, 0x0a, 0xf3, 0x11, 0x11, 0x11, 0x0b, 0x11, 0x11, 0x33, 0x11, 0x32,	\
+	0x1a, 0x66, 0x90, 0x34, 0xcc, 0xc8, 0x99, 0x91, 0x22, 0xc4, 0x8b, 0x12, 0x2e, 0xec, 0x48, 0x91,	\
+	0x6a, 0xea, 0xec, 0xea, 0xed, 0x6b, 0x2b, 0x2d, 0x6c, 0xec, 0x60, 0xc1, 0xb9, 0x03, 0x72, 0x79,	\
+	0x85, 0x79, 0x88, 0x88, 0x88, 0x85, 0x88, 0x88, 0x99, 0x99, 0x88, 0xa4, 0x0d, 0x49, 0x33, 0x48,	\
+	0x26, 0x64, 0x4d, 0x25, 0x20, 0x9a, 0x41, 0x22, 0x67, 0x2e, 0xc4, 0xe2, 0x81, 0x02, 0xb2, 0xb2,	\
+	0xce, 0xb2, 0xce, 0xb2, 0xc6, 0xe4, 0xce, 0x0d, 0xe5, 0xe5, 0xe5, 0xe4, 0x1c, 0x2c, 0x2c, 0x28,	\
+	0x68, 0x58, 0xa9, 0x99, 0x98, 0xa9, 0x99, 0x98, 0xaa, 0x39, 0x99, 0x9a, 0x4a, 0x4a, 0x41, 0x33,	\
+	0x82, 0xe9, 0x05, 0x89, 0x12, 0x2c, 0x68, 0x95, 0x95, 0x96, 0xb5, 0x76, 0x76, 0x76, 0x37, 0x26,	\
+	0x77, 0x90, 0x6e, 0x4e, 0x4e, 0x4e, 0x4e, 0x50, 0xaf, 0x2f, 0x31, 0x51, 0x11, 0x51, 0x11, 0x51,	\
+	0x51, 0x11, 0x13, 0x33, 0x31, 0x53, 0x33, 0x93, 0x34, 0x93, 0x82, 0x69, 0x67, 0x29, 0x04, 0x89,	\
+	0x16, 0x34, 0x6e, 0x2b, 0x3b, 0x3a, 0xc8, 0x16, 0x35, 0x96, 0x76, 0x76, 0x36, 0x77, 0x27, 0x97,	\
+	0x90, 0x6e, 0x4e, 0x4f, 0x2f, 0x2f, 0x31, 0x0f, 0x2f, 0x31, 0x11, 0x11, 0x12, 0xb1, 0x53, 0x34,	\
+	0x92, 0xb3, 0x91, 0x13, 0x94, 0xb4, 0x94, 0x93, 0x82, 0xe9, 0x44, 0x8b, 0x12, 0x2c, 0x58, 0xb5,	\
+	0x96, 0x35, 0x96, 0x36, 0x36, 0x36, 0x77, 0x27, 0x26, 0x37, 0x27, 0x96, 0x37, 0x27, 0x97, 0x27,	\
+	0x98, 0x68, 0xa7, 0x98, 0x88, 0xa8, 0xa8, 0xa9, 0x58, 0xa8, 0x69, 0x59, 0x99, 0x9a, 0x5a, 0x5a,	\
+	0x59, 0x99, 0x91, 0x62, 0xc4, 0xce, 0x09, 0xa4, 0x17, 0x76, 0x34, 0x5a, 0xcb, 0x18, 0x16, 0x36,	\
+	0x36, 0x36, 0x76, 0x77, 0x20, 0x6f, 0x2f, 0x2f, 0x2f, 0x2f, 0x20, 0xde, 0x5e, 0x61, 0x62, 0xa2,	\
+	0x9e, 0x62, 0xa5, 0x62, 0xa2, 0xa5, 0x69, 0x69, 0x62, 0x29, 0x69, 0x27, 0x27, 0x29, 0x69, 0x27,	\
+	0x29, 0x44, 0x8b, 0x16, 0x2e, 0xf4, 0x68, 0xb4, 0x66, 0x76, 0x05, 0x96, 0x76, 0x76, 0x37, 0x27,	\
+	0x26, 0x36, 0x37, 0x27, 0x97, 0x96, 0xd7, 0x97, 0x27, 0x27, 0x97, 0x98, 0xa7, 0x98, 0xa9, 0x98,	\
+	0x68, 0xa8, 0x6a, 0x58, 0x8a, 0x59, 0x99, 0x9a, 0x2a, 0x5a, 0x5a, 0x51, 0x62, 0xc5, 0x8b, 0x17,	\
+	0x62, 0x2e, 0xf4, 0x6b, 0x3b, 0x1a, 0xca, 0xca, 0xcb, 0x1b, 0x1b, 0x93, 0x6b, 0x3b, 0x93, 0x3b,	\
+	0x93, 0x93, 0xcb, 0x93, 0xcb, 0x93, 0xcc, 0x43, 0xcc, 0x54, 0x44, 0xac, 0x34, 0xac, 0xe4, 0x34,	\
+	0xac, 0xac, 0xad, 0x2d, 0x2c, 0xe5, 0x20, 0xb1, 0x76, 0x22, 0xec, 0x69, 0x05, 0x8b, 0xbd, 0x1a,	\
+	0xb2, 0xc6, 0xc6, 0xc6, 0xc6, 0xe4, 0xc6, 0xc6, 0xc6, 0xe4, 0xf2, 0xc6, 0xe4, 0xf2, 0xf4, 0xe4,	\
+	0xf2, 0xf4, 0xf5, 0x14, 0xf2, 0xf2, 0xf5, 0x0d, 0x2b, 0x39, 0x0d, 0x2b, 0x39, 0x2b, 0x4b, 0x4b,	\
+	0x49, 0x4a, 0x2e, 0x72, 0x94, 0x58, 0xb1, 0x62, 0xe8, 0x85, 0x8b, 0xb1, 0x67, 0x60, 0x5f, 0x60,	\
+	0x63, 0x60, 0x60, 0x5f, 0x63, 0x72, 0x60, 0x72, 0x72, 0x79, 0x86, 0x6d, 0x72, 0x79, 0x79, 0x86,	\
+	0x8a, 0x86, 0x7a, 0x7a, 0x95, 0x95, 0x86, 0x86, 0x9c, 0x95, 0x9c, 0x9c, 0x95, 0xa2, 0xa5, 0x9c,	\
+	0xa2, 0x9c, 0x17, 0x39, 0x44, 0x2e, 0xc4, 0x6d, 0xeb, 0x03, 0x03, 0x1a, 0xcb, 0x03, 0x03, 0x03,	\
+	0x92, 0xfb, 0x93, 0x6b, 0x93, 0x93, 0x93, 0xe3, 0x93, 0x94, 0x33, 0xcb, 0xe4, 0x34, 0x34, 0xac,	\
+	0x34, 0x34, 0xac, 0x54, 0xad, 0x2c, 0xe4, 0xe4, 0xad, 0x2d, 0x2d, 0x2c, 0xe4, 0xe0, 0xb1, 0x73,	\
+	0x82, 0xef, 0x6f, 0x45, 0xfb, 0x18, 0x11, 0x91, 0x98, 0x19, 0xd8, 0x1c, 0x9b, 0x58, 0x1b, 0x5f,	\
+	0x1b, 0x5b, 0x61, 0x9b, 0x5c, 0xa2, 0xa1, 0x9e, 0x62, 0xa2, 0xa2, 0x9e, 0xa5, 0x65, 0x65, 0x67,	\
+	0x25, 0x68, 0x82, 0xd2, 0xca, 0xce, 0x4a, 0xd1, 0x0b, 0x17, 0x45, 0x63, 0x45, 0x7b, 0x63, 0x7a,	\
+	0x2e, 0xf5, 0x81, 0x81, 0x7d, 0x8d, 0x81, 0x81, 0x81, 0xb5, 0xb5, 0xc9, 0xc9, 0xb5, 0xb5, 0xc9,	\
+	0xb5, 0xe5, 0xf2, 0x1a, 0x1a, 0x19, 0xea, 0x19, 0xf1, 0xe8, 0x2c, 0xac, 0xad, 0x14, 0xad, 0x14,	\
+	0xac, 0xac, 0xe5, 0x2c, 0xe4, 0xe5, 0x10, 0xb9, 0xc1, 0x76, 0x36, 0xb6, 0x22, 0xef, 0x51, 0x98,	\
+	0x11, 0x98, 0xd7, 0xd8, 0x17, 0xd7, 0xd8, 0x1b, 0x5b, 0x5e, 0x5f, 0x1b, 0x5b, 0x5b, 0x5e, 0x9b,	\
+	0x5e, 0x9f, 0x22, 0x9e, 0xa5, 0x5e, 0xa1, 0x82, 0xca, 0xc3, 0x4a, 0xca, 0xd1, 0x4e, 0x51, 0x0b,	\
+	0xa2, 0x9c, 0xb1, 0xb1, 0xa2, 0xb1, 0xbd, 0x17, 0x7b, 0x6a, 0x2d, 0x3d, 0x7d, 0x81, 0x81, 0x81,	\
+	0xb5, 0x7d, 0xb5, 0x7d, 0x8d, 0xb5, 0xb5, 0xe9, 0xb5, 0xb6, 0x19, 0xf1, 0xe9, 0xea, 0x19, 0xea,	\
+	0x1a, 0x19, 0xe9, 0xea, 0x56, 0x54, 0x2d, 0x2d, 0x15, 0x14, 0xe5, 0x15, 0x15, 0x14, 0xe5, 0x15,	\
+	0x8d, 0x15, 0xe5, 0x8d, 0xad, 0xed, 0xe5, 0x8a, 0x5b, 0x03, 0x03, 0x02, 0xfb, 0x03, 0x6a, 0xfb,	\
+	0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x63, 0xd3, 0x6b, 0xd3, 0xd4, 0x34, 0x33, 0xe3, 0xf8, 0x50,	\
+	0xb3, 0x41, 0x5e, 0x82, 0xce, 0x05, 0x9a, 0x9c, 0x9a, 0xa2, 0xa2, 0xa2, 0xb5, 0xb1, 0xb1, 0xbd,	\
+	0xbd, 0xbc, 0xf6, 0x58, 0xb0, 0x2f, 0xaf, 0xaf, 0xb6, 0x30, 0x2f, 0xaf, 0xb6, 0x3d, 0x36, 0xbe,	\
+	0x36, 0xb6, 0xbe, 0x3e, 0x3e, 0x3d, 0x3e, 0x3f, 0xbd, 0x05, 0x0a, 0x14, 0x28, 0x50, 0xb4, 0x41,	\
+	0x42, 0xd1, 0x52, 0xce, 0x4e, 0x58, 0xd8, 0xd8, 0xd1, 0x51, 0x5e, 0xd8, 0xd8, 0xd8, 0xda, 0xde,	\
+	0xaf, 0xaf, 0xaf, 0xaf, 0xb0, 0x2f, 0xb6, 0xb0, 0x30, 0x30, 0x36, 0xbe, 0x36, 0xbd, 0x3d, 0x3d,	\
+	0x3e, 0x3e, 0x43, 0x43, 0x3f, 0xca, 0x85, 0x7a, 0x7a, 0x0a, 0xf4, 0x16, 0x56, 0x72, 0x6a, 0x8a,	\
+	0x6a, 0x8a, 0xc6, 0x8a, 0xd6, 0x8a, 0x8a, 0xd6, 0xc6, 0xc6, 0xd6, 0xf2, 0xf5, 0x81, 0x81, 0x81,	\
+	0xb1, 0x81, 0x69, 0x7d, 0x7d, 0xb1, 0xa1, 0xa1, 0xb1, 0xb5, 0xa1, 0xa1, 0xe9, 0xf0, 0x2b, 0xe3,	\
+	0xfc, 0xab, 0xf8, 0x57, 0xc7, 0xa0, 0xa1, 0x42, 0x85, 0x0b, 0x35, 0x45, 0x45, 0x45, 0x53, 0x35,	\
+	0x63, 0x53, 0x63, 0x53, 0x7b, 0x63, 0x63, 0x6b, 0x78, 0x9e, 0xbe, 0xbe, 0xbe, 0xbe, 0xb4, 0xd8,	\
+	0xda, 0xd0, 0xf4, 0xd8, 0xd0, 0xd0, 0xf8, 0xf4, 0xf8, 0xf8, 0xf4, 0xf4, 0xf4, 0xf4, 0x15, 0xe8,	\
+	0x2b, 0xf8, 0x5a, 0x2a, 0x29, 0x59, 0xaa, 0x2a, 0x20, 0xb4, 0x53, 0x54, 0x55, 0x36, 0x35, 0x36,	\
+	0xb6, 0xb5, 0x37, 0x97, 0x96, 0xae, 0xcb, 0xf3, 0xdc, 0x96, 0xfe, 0xff, 0x1b, 0x32, 0xff, 0x33,	\
+	0x33, 0x33, 0x33, 0x27, 0x27, 0x33, 0x27, 0x5b, 0x5b, 0x57, 0x5b, 0x6f, 0x87, 0x57, 0x87, 0x87,	\
+	0x87, 0x73, 0x6f, 0xf1, 0xc3, 0xf8, 0xbf, 0xc6, 0xc6, 0xcc, 0xcc, 0xc6, 0xcc, 0xd5, 0xd6, 0xd6,	\
+	0xd6, 0xc9, 0xd6, 0xcc, 0xd5, 0xdb, 0xd5, 0xd5, 0xdb, 0xdb, 0xe1, 0xdb, 0xdb, 0xdb, 0xfc, 0x7e,	\
+	0x38, 0x7f, 0x16, 0x98, 0xd8, 0xd8, 0xd9, 0x99, 0x99, 0x39, 0x9a, 0xd9, 0x3a, 0xba, 0xba, 0xda,	\
+	0xda, 0xba, 0xba, 0xbb, 0x7b, 0x7c, 0x3b, 0x7b, 0x7b, 0x7c, 0x3f, 0x8e, 0x7e, 0x1e, 0x1b, 0xfc,	\
+	0x9c, 0x3c, 0xcc, 0x3c, 0xcc, 0xcc, 0xcc, 0x9c, 0x9c, 0xcc, 0xcd, 0x6d, 0x6d, 0xbd, 0x3d, 0x5e,	\
+	0x1d, 0xbe, 0x1d, 0x5e, 0x1f, 0xc6, 0xe6, 0xe7, 0xe3, 0xf1, 0xc3, 0x87, 0x7f, 0x93, 0x8d, 0x93,	\
+	0x8d, 0x93, 0x8d, 0x93, 0x93, 0x93, 0x93, 0xa7, 0xab, 0xb7, 0xab, 0xb9, 0xf1, 0xdb, 0xdb, 0xdb,	\
+	0xfc, 0x70, 0xfe, 0x37, 0x36, 0xf8, 0x79, 0xf2, 0x6d, 0x31, 0xb0, 0xf1, 0xb3, 0x33, 0x32, 0x75,	\
+	0x75, 0x7e, 0x39, 0x39, 0x3a, 0x7a, 0xba, 0xbb, 0x7b, 0x9a, 0x7b, 0x7c, 0xfc, 0x3c, 0xff, 0x8e,	\
+	0x1e, 0x1d, 0xce, 0x7b, 0xfb, 0x4c, 0x3b, 0x4c, 0x9c, 0x9c, 0x6c, 0x9c, 0x9c, 0x9c, 0x9d, 0x5d,	\
+	0xbd, 0x5c, 0x9d, 0xcd, 0x5d, 0xbd, 0x3d, 0x5d, 0x5d, 0xce, 0x1e, 0x7e, 0x7f, 0xc7, 0x3f, 0xe3,	\
+	0x0f, 0x1b, 0x1b, 0x1f, 0x27, 0x1b, 0x1b, 0x0f, 0x27, 0x27, 0x6f, 0xe3, 0xf1, 0xc9, 0xdb, 0xdc,	\
+	0xd5, 0xdc, 0xe1, 0xe1, 0xdc, 0xe7, 0xfc, 0x6e, 0x7e, 0x39, 0xf7, 0x39, 0xf0, 0xf0, 0xf1, 0xb0,	\
+	0xf1, 0xb1, 0xb2, 0x71, 0xbe, 0x3f, 0x1c, 0x9d, 0x3d, 0x3d, 0xbf, 0x8e, 0xde, 0x9e, 0xe6, 0xbe,	\
+	0xe6, 0xe7, 0x3f, 0x3f, 0x3e, 0xe6, 0xe6, 0xe7, 0x3e, 0x36, 0x1e, 0x35, 0xc6, 0x1f, 0xc7, 0x4f,	\
+	0x0f, 0x27, 0x1f, 0x4f, 0xe3, 0xf1, 0xd3, 0xd3, 0xdc, 0xf8, 0xee, 0x7e, 0x37, 0x3f, 0x1b, 0x9b,	\
+	0x9c, 0xfc, 0xfb, 0x9b, 0x9c, 0xf8, 0xd8, 0xd8, 0x78, 0x78, 0xf8, 0xd8, 0xff, 0x1f, 0x8e, 0x4e,	\
+	0x3e, 0xae, 0xe6, 0xbe, 0xae, 0xae, 0x9e, 0xe6, 0xe6, 0xbe, 0xe7, 0x3f, 0x3e, 0xe6, 0xe7, 0x4f,	\
+	0x4f, 0x3e, 0x1e, 0x1e, 0x36, 0x36, 0x1f, 0xc7, 0x0f, 0x1f, 0xe3, 0x8f, 0x8f, 0xa7, 0xf1, 0xd3,	\
+	0xd7, 0xdb, 0xdc, 0xd3, 0xdc, 0xd3, 0xdc, 0xe7, 0xe7, 0xdc, 0xe9, 0xe7, 0xe7, 0xfc, 0x61, 0xe1,	\
+	0xe4, 0xe4, 0xe1, 0xfc, 0x72, 0x74, 0xfe, 0x39, 0x3f, 0x1d, 0x7c, 0xdd, 0x3d, 0x7d, 0x7d, 0x7d,	\
+	0x3d, 0xcd, 0x7d, 0xce, 0x7d, 0xce, 0x9e, 0x9e, 0x9e, 0x7e, 0x7c, 0x3c, 0x7b, 0x8c, 0x7c, 0x7c,	\
+	0x3c, 0x7c, 0x7f, 0x8e, 0x6e, 0x9e, 0x9f, 0xc7, 0xe3, 0xaf, 0xa7, 0xb9, 0xb9, 0xaf, 0xb9, 0xaf,	\
+	0xd3, 0xd3, 0xcf, 0xd3, 0xd3, 0xd3, 0xd3, 0x77, 0x8f, 0x8d, 0x77, 0x8f, 0x8f, 0x87, 0x8f, 0x8f,	\
+	0x8f, 0xa7, 0xf1, 0xcd, 0xcd, 0xd3, 0xdc, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xdc, 0xe9, 0xdc, 0xde,	\
+	0xe7, 0xe9, 0xde, 0xb4, 0xbb, 0xc7, 0xc7, 0xc7, 0xc7, 0xc3, 0xc7, 0xf8, 0xeb, 0xfc, 0x74, 0xf4,	\
+	0xf1, 0xf5, 0xf4, 0xf4, 0xf7, 0x37, 0x35, 0xf5, 0xf7, 0x35, 0xfa, 0x7a, 0x7a, 0x7a, 0x7a, 0x70,	\
+	0xee, 0x2e, 0x31, 0xf3, 0x71, 0x71, 0xfe, 0x3a, 0x79, 0xb9, 0xb8, 0xfa, 0xf8, 0xfa, 0xfa, 0x9a,	\
+	0xfa, 0xfb, 0xdc, 0xfa, 0xfb, 0x9a, 0xfd, 0x3a, 0xfd, 0x3d, 0x3d, 0x38, 0xf8, 0xf7, 0x78, 0xb7,	\
+	0x78, 0xb9, 0xb8, 0xfa, 0x7f, 0x1d, 0x7c, 0xdc, 0x7d, 0x7d, 0x4d, 0x7d, 0x7d, 0x7d, 0x7d, 0xed,	\
+	0xed, 0xed, 0xce, 0x9d, 0xed, 0xee, 0x9e, 0x9c, 0x7c, 0x7c, 0x7b, 0xbc, 0x7c, 0x7b, 0xbf, 0x8e,	\
+	0x9e, 0x9e, 0x6e, 0x6e, 0x6e, 0xbe, 0xf6, 0x9e, 0xbe, 0xe6, 0xf6, 0xbe, 0xf6, 0xa6, 0xf6, 0xf7,	\
+	0x4f, 0x4f, 0xeb, 0xa6, 0xef, 0x1e, 0xe3, 0x37, 0x1f, 0x37, 0x4f, 0x1f, 0x37, 0x37, 0x4f, 0x5f,	\
+	0x37, 0x5f, 0x37, 0x5f, 0x5f, 0x5f, 0x5f, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0xa7, 0xf5, 0xd3, 0xbd,	\
+	0x77, 0x8b, 0x77, 0x9b, 0x8b, 0x8f, 0x9b, 0x8f, 0x9b, 0x8f, 0x9b, 0x9b, 0xa9, 0xa9, 0x9b, 0xaf,	\
+	0xa9, 0xbd, 0xbd, 0xbd, 0xbd, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xc4, 0x27, 0x1e, 0xef, 0x17,	\
+	0x1e, 0xef, 0x37, 0x37, 0x17, 0x53, 0x37, 0x4f, 0x5f, 0x37, 0x7b, 0x37, 0x7b, 0x7b, 0x5f, 0x7b,	\
+	0x7b, 0x7b, 0xa7, 0xa7, 0x7b, 0xa7, 0xa7, 0xf5, 0x8b, 0x77, 0x8b, 0x8b, 0x9b, 0x8f, 0x8f, 0xa9,	\
+	0xaf, 0xa9, 0xaf, 0x9b, 0xaf, 0xaf, 0xbd, 0xa9, 0xa9, 0xa9, 0xbd, 0xaf, 0xbd, 0xa9, 0xbd, 0xfa,	\
+	0xe2, 0xfd, 0x74, 0xf4, 0xdd, 0xe6, 0xe6, 0xdd, 0xe6, 0xe2, 0xe3, 0xe2, 0xe6, 0xe2, 0x92, 0xcd,	\
+	0xcd, 0x25, 0xa9, 0xa9, 0xbd, 0xa9, 0xa8, 0x53, 0xa7, 0x7b, 0x7b, 0x7b, 0xa7, 0x8b, 0xa7, 0xf5,	\
+	0x8b, 0x8b, 0x77, 0x8b, 0x9b, 0x9b, 0x9b, 0x8b, 0xa9, 0x9b, 0x9b, 0xa8, 0x4b, 0x37, 0x7b, 0x50,	\
+	0x96, 0xa6, 0xa6, 0xa6, 0xa7, 0x17, 0x4f, 0xeb, 0x8b, 0xf5, 0xc5, 0xfa, 0xc5, 0xc5, 0xbb, 0x1b,	\
+	0x9b, 0x77, 0xa8, 0x34, 0x96, 0xa0, 0xdd, 0x72, 0x5a, 0xfa, 0x9a, 0x85, 0x37, 0xb7, 0xb5, 0x0a,	\
+	0x71, 0x71, 0x71, 0x71, 0x7e, 0xbf, 0x5f, 0xab, 0xb1, 0xb8, 0xb8, 0xb9, 0xb8, 0xb8, 0xfa, 0x9a,	\
+	0x9a, 0x99, 0xa4, 0x89, 0x12, 0xd4, 0xd4, 0xe2, 0xd4, 0xde, 0xe2, 0xde, 0xe2, 0xfd, 0x6f, 0x6f,	\
+	0x71, 0x7e, 0xba, 0x46, 0xdd, 0x8d, 0xc5, 0xcd, 0xc5, 0x25, 0x8b, 0x9a, 0x48, 0x96, 0x69, 0x22,	\
+	0x45, 0x35, 0x35, 0x37, 0xb7, 0xb8, 0xb7, 0xb8, 0xb8, 0x8a, 0x71, 0x7e, 0xb8, 0xbf, 0x43, 0x71,	\
+	0x46, 0x8d, 0x1b, 0x8b, 0x8a, 0x48, 0x96, 0xa1, 0x21, 0xa4, 0x89, 0x6a, 0x12, 0x25, 0xa8, 0x50,	\
+	0xa6, 0xf6, 0xf7, 0x17, 0x17, 0x17, 0x17, 0x17, 0xeb, 0x85, 0x87, 0x63, 0x54, 0x54, 0x04, 0x08,	\
+	0x12, 0xa0, 0x20, 0x4e, 0x6f, 0x6d, 0x2e, 0x6e, 0x6f, 0x6f, 0x6e, 0x70, 0x21, 0x3c, 0x90, 0xe1,	\
+	0x02, 0x04, 0x92, 0x08, 0x12, 0x4a, 0x74, 0x24, 0xec, 0xef, 0x9f, 0xcf, 0x37, 0x5b, 0x5f, 0x3b,	\
+	0x65, 0x65, 0x5b, 0x5b, 0x65, 0x5b, 0x6d, 0x64, 0xa8, 0xa8, 0x09, 0x50, 0x10, 0x26, 0x90, 0x4e,	\
+	0x6d, 0x2e, 0x6e, 0x6f, 0x7e, 0x40, 0x81, 0x1c, 0xe0, 0x5c, 0xe0, 0x7c, 0x81, 0x02, 0x04, 0x08,	\
+	0x12, 0x4a, 0x77, 0xcf, 0x51, 0x5b, 0xe7, 0xa8, 0xa8, 0xb2, 0xb2, 0xa8, 0xb6, 0xb6, 0xb2, 0xb2,	\
+	0xaf, 0x19, 0x6d, 0x6c, 0x09, 0x41, 0x50, 0x13, 0x4b, 0x4a, 0xa3, 0x48, 0x27, 0xb7, 0x37, 0xb7,	\
+	0x37, 0x37, 0x38, 0x17, 0x38, 0x17, 0x38, 0x10, 0x90, 0x3e, 0x40, 0x93, 0xa1, 0x26, 0xe6, 0xe7,	\
+	0x6a, 0x2a, 0x27, 0x67, 0x7c, 0xf5, 0x1e, 0x7a, 0xfa, 0xda, 0xdb, 0x2a, 0xdb, 0x2b, 0x6a, 0xd1,	\
+	0x89, 0x80, 0x81, 0x02, 0x73, 0x69, 0x04, 0xb8, 0xe6, 0xe6, 0xe6, 0xe7, 0x03, 0x03, 0xe4, 0x81,	\
+	0x81, 0x81, 0x73, 0x81, 0x09, 0x0f, 0x25, 0x25, 0x24, 0x12, 0x4a, 0x76, 0x77, 0xcf, 0x3b, 0xe7,	\
+	0x9d, 0xa8, 0xb2, 0xa8, 0xb2, 0xb2, 0xb2, 0xb6, 0xc0, 0xad, 0x18, 0x38, 0x72, 0xa2, 0xe2, 0xa3,	\
+	0x4a, 0xe0, 0x26, 0x97, 0x36, 0x96, 0x97, 0x37, 0x38, 0x17, 0x38, 0x18, 0x10, 0x90, 0x21, 0x21,	\
+	0xe4, 0xa4, 0x82, 0x04, 0x92, 0xf3, 0xf9, 0xe4, 0xa7, 0x6a, 0x2a, 0x2b, 0x6b, 0x6a, 0x2d, 0xab,	\
+	0x6c, 0xad, 0xad, 0xac, 0xad, 0xad, 0xad, 0x86, 0x0e, 0x5c, 0x4c, 0x5c, 0x69, 0x69, 0x54, 0x5c,	\
+	0x69, 0x04, 0xe6, 0xd2, 0xe7, 0x02, 0xe6, 0xe7, 0x02, 0xe7, 0x0f, 0x25, 0x02, 0x12, 0x4a, 0x1c,	\
+	0x24, 0x38, 0x49, 0x29, 0x29, 0xd9, 0x7a, 0x8a, 0x8f, 0x3d, 0x45, 0x6c, 0xed, 0xb5, 0x6d, 0x45,	\
+	0x6d, 0x6d, 0x96, 0x05, 0xb5, 0xb2, 0xea, 0xe0, 0x20, 0x4d, 0x2b, 0xae, 0x8e, 0x8d, 0x2e, 0x6e,	\
+	0x70, 0x30, 0x2e, 0x6e, 0x8e, 0x70, 0x30, 0xf0, 0x30, 0xf2, 0x50, 0xf2, 0x41, 0x24, 0xbc, 0xf2,	\
+	0x52, 0x52, 0x52, 0xfe, 0x7f, 0x3d, 0x6d, 0x45, 0x47, 0x9e, 0xa2, 0xca, 0xa2, 0xa2, 0xa3, 0x02,	\
+	0xda, 0xda, 0xd9, 0x31, 0xa5, 0x71, 0x75, 0x71, 0xa5, 0x71, 0xa5, 0xcd, 0xd1, 0xd2, 0x05, 0xa5,	\
+	0xd2, 0x06, 0x1e, 0x06, 0x06, 0x4a, 0x1e, 0x4a, 0x06, 0x1e, 0x4a, 0x4a, 0x5e, 0x4a, 0x4a, 0x5e,	\
+	0x5e, 0x5e, 0x5f, 0xcf, 0xe7, 0xa8, 0xad, 0xa8, 0xb0, 0xb6, 0xad, 0xb6, 0xb6, 0x18, 0x3b, 0x01,	\
+	0x31, 0x75, 0x71, 0x75, 0x75, 0x71, 0xa5, 0xa5, 0xd1, 0xce, 0x05, 0xcd, 0xd2, 0x1e, 0x06, 0x1e,	\
+	0x06, 0x06, 0x06, 0x06, 0x1e, 0x5f, 0xcf, 0x2f, 0x25, 0x2f, 0x2f, 0xe7, 0x8c, 0xf3, 0xcb, 0xf9,	\
+	0xe5, 0xeb, 0x6d, 0xaa, 0x2b, 0x6a, 0x2b, 0x6a, 0x2d, 0xad, 0xad, 0xab, 0x6d, 0x93, 0x17, 0x17,	\
+	0x17, 0x57, 0x5a, 0x5a, 0x5d, 0x1d, 0x1d, 0x1d, 0x1a, 0x61, 0xdd, 0x21, 0xe0, 0x60, 0x60, 0x63,	\
+	0x24, 0xa4, 0xa1, 0xe4, 0xa4, 0xa5, 0xfc, 0xf2, 0x55, 0x11, 0x92, 0xf5, 0x12, 0xf5, 0x15, 0xb5,	\
+	0x15, 0xb5, 0x16, 0x16, 0x16, 0xd8, 0x16, 0xd6, 0xc3, 0xad, 0x97, 0x17, 0x17, 0x1a, 0x5a, 0x57,	\
+	0x1d, 0x1d, 0x1c, 0xda, 0x5a, 0x5d, 0x1c, 0xe0, 0x5d, 0x1d, 0x21, 0xe4, 0xa4, 0xa0, 0x63, 0x24,	\
+	0xa3, 0x23, 0x21, 0xe5, 0xfc, 0xf1, 0x92, 0xf2, 0xf2, 0xfe, 0x9a, 0x8f, 0x4d, 0x45, 0x6d, 0x47,	\
+	0xa6, 0xdb, 0x02, 0xa2, 0xc3, 0x03, 0x03, 0x01, 0xa5, 0x31, 0x75, 0x71, 0x71, 0xa5, 0x75, 0xa5,	\
+	0xa5, 0xd1, 0xcd, 0xce, 0x1e, 0x1d, 0xd2, 0x1f, 0xc7, 0x0f, 0x19, 0xe3, 0x81, 0x87, 0x8c, 0x87,	\
+	0x87, 0xf3, 0xc3, 0xc6, 0x79, 0xfd, 0x32, 0xf2, 0xf2, 0xf5, 0xb5, 0xb5, 0xb6, 0x15, 0x1e, 0x9b,	\
+	0x0b, 0x0c, 0x0b, 0x0b, 0x0c, 0x05, 0x15, 0xd5, 0xd5, 0xd7, 0x45, 0xd7, 0x47, 0x47, 0x47, 0x47,	\
+	0x38, 0x17, 0x4f, 0x1b, 0xa7, 0x8e, 0x06, 0x1f, 0xc7, 0xe3, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c,	\
+	0x97, 0x8c, 0x97, 0xf3, 0xfa, 0x7d, 0x3e, 0x9f, 0x4d, 0x87, 0xa6, 0xa2, 0xc2, 0xc2, 0xc3, 0x03,	\
+	0x03, 0x02, 0xc3, 0x01, 0x45, 0x75, 0x45, 0x75, 0x75, 0x75, 0x75, 0xd1, 0xd1, 0x71, 0xd1, 0xd3,	\
+	0xc7, 0x0f, 0x0f, 0x19, 0xe3, 0x81, 0x87, 0x8c, 0x8c, 0x92, 0x87, 0x97, 0x8c, 0x97, 0xf4, 0xc6,	\
+	0x46, 0x7a, 0x7d, 0x31, 0x96, 0x1e, 0x9f, 0x4d, 0x85, 0x85, 0x6d, 0x85, 0x85, 0x86, 0x05, 0x86,	\
+	0x07, 0xb6, 0xcc, 0x70, 0xfe, 0x0e, 0xad, 0xcc, 0xae, 0xae, 0xae, 0xad, 0xce, 0xee, 0xf0, 0x50,	\
+	0x50, 0x50, 0x50, 0x51, 0xf0, 0x51, 0xf2, 0xd2, 0xd1, 0xf2, 0x11, 0xe1, 0xe5, 0x83, 0xd0, 0x50,	\
+	0x55, 0x55, 0x07, 0xa7, 0xaa, 0x15, 0x55, 0x85, 0x55, 0x83, 0x83, 0x83, 0x84, 0x2a, 0xa9, 0xb9,	\
+	0x95, 0xb9, 0xdd, 0xb9, 0x96, 0x09, 0xd6, 0x09, 0xd5, 0xde, 0x3e, 0x26, 0x59, 0xde, 0x3e, 0x3e,	\
+	0x3c, 0x38, 0x7a, 0x09, 0x08, 0xf0, 0xf4, 0x01, 0xc5, 0x07, 0xaa, 0xaa, 0xa7, 0xaa, 0x15, 0x6e,	\
+	0x2b, 0x08, 0x55, 0xbd, 0xbe, 0x0e, 0x0e, 0x13, 0x2b, 0x73, 0x2b, 0xab, 0x73, 0xbb, 0xac, 0x13,	\
+	0xbb, 0x73, 0xac, 0x14, 0x13, 0xbc, 0x7c, 0x7c, 0x78, 0x70, 0xf2, 0x01, 0xc3, 0x87, 0xaa, 0xa0,	\
+	0x0f, 0x55, 0x4e, 0x28, 0x55, 0x50, 0xab, 0x7a, 0x7c, 0x1c, 0x1c, 0x1a, 0xac, 0x1c, 0x1c, 0x2c,	\
+	0x27, 0x56, 0xe6, 0xe6, 0xe7, 0x57, 0x78, 0x27, 0x57, 0x57, 0x77, 0x58, 0xf7, 0x77, 0x78, 0xf8,	\
+	0x98, 0xf8, 0xf9, 0x00, 0xe1, 0xe4, 0x24, 0x2a, 0xa8, 0x29, 0xe9, 0xc5, 0x55, 0x0a, 0xb7, 0xa7,	\
+	0xaa, 0xa7, 0xaa, 0xc2, 0xaa, 0xc2, 0xc1, 0xc2, 0xc2, 0xc1, 0x6e, 0x77, 0x62, 0x6e, 0x75, 0x65,	\
+	0x77, 0x6e, 0x82, 0x82, 0x77, 0x8f, 0x82, 0x8f, 0x82, 0x8f, 0x90, 0x90, 0xa0, 0xa0, 0x8f, 0xa0,	\
+	0x96, 0x8f, 0xa0, 0x0e, 0x1e, 0x82, 0xa8, 0x55, 0x3d, 0xbd, 0x55, 0x55, 0xbd, 0xbd, 0x56, 0x16,	\
+	0x15, 0xfe, 0x61, 0x06, 0xe6, 0xe6, 0xe6, 0x26, 0x26, 0xe6, 0xe6, 0xe7, 0x77, 0x79, 0x08, 0xf8,	\
+	0x29, 0x09, 0x08, 0xf9, 0x09, 0x09, 0x09, 0x00, 0xf2, 0x12, 0x34, 0x14, 0xf5, 0x55, 0x41, 0xe9,	\
+	0xe9, 0xea, 0xaa, 0xa8, 0x2d, 0xed, 0xea, 0xb0, 0xaa, 0xb0, 0xad, 0xf0, 0xb0, 0x96, 0x18, 0x9b,	\
+	0x9b, 0x9d, 0xdb, 0x9d, 0xdb, 0x9b, 0x9d, 0xdd, 0xe3, 0xe4, 0x1d, 0xe3, 0xdf, 0x9f, 0xa4, 0x28,	\
+	0x24, 0x29, 0xe3, 0xe3, 0xe4, 0x28, 0x2a, 0xa8, 0x28, 0x2d, 0xe8, 0x29, 0xe8, 0x29, 0xef, 0xef,	\
+	0xea, 0xaf, 0xed, 0xf0, 0xaf, 0xef, 0xf0, 0x9b, 0x9b, 0x9b, 0x9a, 0x9d, 0xdb, 0x9d, 0xdd, 0xdd,	\
+	0xdd, 0xe0, 0x9f, 0xa0, 0xa4, 0x64, 0x1f, 0xa4, 0x63, 0xe3, 0xe4, 0x24, 0x64, 0x64, 0x63, 0xe9,	\
+	0xe8, 0x29, 0xe8, 0x2d, 0xe8, 0x28, 0x44, 0x5b, 0xd5, 0x5b, 0xd5, 0x5b, 0xdf, 0xdb, 0xdb, 0xdf,	\
+	0xe0, 0xb1, 0x37, 0x37, 0x37, 0x3f, 0x3b, 0xbb, 0xbb, 0xbf, 0x3b, 0xbb, 0xc8, 0xc8, 0xc8, 0x48,	\
+	0x3b, 0xc8, 0xc8, 0x48, 0x50, 0x47, 0xd0, 0x48, 0x4a, 0x50, 0x53, 0xd5, 0x50, 0x53, 0xd3, 0xd3,	\
+	0x88, 0xb7, 0xbf, 0xa0, 0xb7, 0xc2, 0xb7, 0xc2, 0xc2, 0xb7, 0xc2, 0x6e, 0x77, 0x6a, 0x6a, 0x6a,	\
+	0x77, 0x7e, 0x77, 0x77, 0x76, 0x77, 0x77, 0x8f, 0x91, 0x90, 0x7e, 0x90, 0x90, 0x94, 0xa0, 0xa0,	\
+	0xa0, 0xa0, 0xa0, 0xa0, 0x94, 0x11, 0x55, 0x4e, 0x20, 0x45, 0xb8, 0x81, 0x02, 0x30, 0xb0, 0xaf,	\
+	0xef, 0xf3, 0x2f, 0xf0, 0x98, 0x9b, 0x9a, 0x9a, 0x9d, 0xda, 0x9d, 0xdd, 0xdd, 0xdf, 0xa4, 0x63,	\
+	0xdf, 0xa4, 0x24, 0x1f, 0xa4, 0x24, 0x24, 0x25, 0x24, 0x24, 0x25, 0x28, 0x29, 0xe8, 0x29, 0xe8,	\
+	0x28, 0x28, 0x2d, 0xc4, 0x5f, 0xe1, 0x5b, 0xdf, 0x88, 0xc2, 0xb7, 0xc2, 0xcc, 0xbf, 0x6e, 0x6e,	\
+	0x62, 0x6a, 0x6a, 0x77, 0x77, 0x6a, 0x77, 0x7e, 0x7e, 0x7e, 0x91, 0x84, 0x91, 0x77, 0x8f, 0x91,	\
+	0x91, 0x90, 0x91, 0xa0, 0xa0, 0x94, 0xa1, 0x90, 0x11, 0x43, 0x4f, 0x6e, 0x22, 0x9c, 0x45, 0x55,	\
+	0xfd, 0xbd, 0xfd, 0xfd, 0xbd, 0xbd, 0xfe, 0x63, 0x53, 0x53, 0x73, 0x53, 0x53, 0xbb, 0xf3, 0xbb,	\
+	0xf3, 0xf3, 0xbb, 0xf4, 0x8c, 0x84, 0x84, 0x84, 0x8c, 0xa4, 0xa4, 0xa5, 0x05, 0x0c, 0x85, 0x05,	\
+	0x0d, 0x00, 0x81, 0x14, 0xe2, 0x04, 0x08, 0x10, 0x22, 0xfe, 0xfe, 0xfe, 0xde, 0xfe, 0xff, 0x1b,	\
+	0x0b, 0xe0, 0x19, 0xa0, 0xec, 0xec, 0xf5, 0x15, 0x15, 0x14, 0xf5, 0x3d, 0x15, 0x3d, 0x3d, 0x3d,	\
+	0x3d, 0x69, 0x7d, 0x69, 0x7d, 0x7d, 0xa1, 0x7d, 0x69, 0xb1, 0x7d, 0xb5, 0xb1, 0xc1, 0xb1, 0xa2,	\
+	0x02, 0x01, 0xfd, 0xfc, 0x2b, 0xf8, 0x5f, 0x37, 0x99, 0xfc, 0x2c, 0xd0, 0x59, 0xaf, 0x34, 0xd4,	\
+	0xd4, 0xd4, 0xd5, 0x4c, 0xd5, 0x35, 0xad, 0xad, 0x4d, 0xad, 0xad, 0xad, 0xcd, 0xe5, 0xad, 0xe6,	\
+	0x56, 0x55, 0xf5, 0xe6, 0x56, 0x76, 0x76, 0x71, 0xdf, 0xfc, 0x8a, 0x7a, 0x8a, 0x8a, 0x7a, 0x8a,	\
+	0x9e, 0x8a, 0x9e, 0x9e, 0x9e, 0x9e, 0xb4, 0xb4, 0xb4, 0xd0, 0xb4, 0xd8, 0xb6, 0xd0, 0xd0, 0xd0,	\
+	0xd0, 0xf9, 0x00, 0xd8, 0xd8, 0xfe, 0xfe, 0xff, 0x00, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0x17, 0xcc,	\
+	0x16, 0x6a, 0x6a, 0x6a, 0xa6, 0x9a, 0x8b, 0xd7, 0x35, 0x45, 0x53, 0x6b, 0x73, 0x6b, 0xeb, 0xa9,	\
+	0xf5, 0xfa, 0xee, 0x6e, 0x72, 0xae, 0x73, 0xb2, 0xb2, 0xb2, 0x88, 0xe7, 0x00, 0x3b, 0x45, 0x45,	\
+	0x3d, 0x3d, 0x4f, 0x49, 0x4f, 0x4f, 0x4f, 0x4f, 0x5b, 0x5a, 0x4f, 0x4f, 0x5f, 0x68, 0x68, 0x68,	\
+	0x5a, 0x5b, 0x68, 0x6c, 0x6c, 0x68, 0x80, 0x80, 0x7c, 0x80, 0x7f, 0xf3, 0x40, 0x40, 0x40, 0x79,	\
+	0x9f, 0xfc, 0xd3, 0x4f, 0xfe, 0x69, 0xa0, 0xb4, 0xd3, 0x54, 0xd5, 0x33, 0x55, 0x34, 0xd5, 0x3e,	\
+	0xba, 0x9a, 0x6f, 0x5d, 0xad, 0xcd, 0xe5, 0xad, 0xcd, 0xcd, 0xce, 0x56, 0x75, 0xf0, 0xfc, 0xac,	\
+	0xa3, 0xd3, 0xdf, 0xf9, 0x14, 0xf5, 0x24, 0xf4, 0xf5, 0x15, 0x3d, 0x69, 0x27, 0xba, 0x9e, 0xd0,	\
+	0xb7, 0xdd, 0x6c, 0x5a, 0x68, 0x5a, 0x68, 0x70, 0x70, 0x70, 0x80, 0x80, 0x70, 0x80, 0x7c, 0x7f,	\
+	0x80, 0x80, 0x7f, 0x7f, 0x80, 0xf3, 0x45, 0x85, 0x8b, 0x8b, 0xf3, 0x79, 0xa2, 0xe2, 0xe6, 0xa9,	\
+	0xa9, 0xbd, 0x75, 0x35, 0x37, 0x36, 0xb7, 0x36, 0xb6, 0xb7, 0x97, 0x3e, 0xbb, 0x5b, 0x9b, 0xcc,	\
+	0xab, 0xec, 0xac, 0xac, 0xac, 0xaf, 0xf8, 0xf4, 0x00, 0x00, 0x09, 0xe8, 0xa9, 0xe9, 0xe7, 0xa8,	\
+	0xbd, 0xd4, 0xf5, 0xb5, 0xa5, 0xa5, 0xa4, 0xf5, 0xa7, 0x06, 0xc5, 0xb5, 0xb6, 0x86, 0xc8, 0x07,	\
+	0xf6, 0xc6, 0xc7, 0xf8, 0x07, 0xf8, 0x0f, 0x37, 0x99, 0xff, 0xcd, 0x17, 0x17, 0x34, 0x16, 0x6e,	\
+	0x9a, 0xa6, 0xa6, 0xa6, 0x6b, 0xd7, 0x53, 0xeb, 0xa6, 0xb9, 0xb9, 0xb9, 0xbc, 0xb9, 0xaf, 0xbe,	\
+	0xb9, 0xb9, 0xca, 0xca, 0xbe, 0xca, 0xbe, 0xca, 0xbe, 0xca, 0xff, 0x8f, 0x52, 0x40, 0x22, 0x9e,	\
+	0xa2, 0x80, 0x00, 0x9e, 0x92, 0xb4, 0xb7, 0xdd, 0x5a, 0xee, 0xad, 0xad, 0xb6, 0x36, 0x34, 0x2d,	\
+	0xb4, 0x77, 0x5c, 0x1c, 0x1a, 0x1c, 0x1c, 0x1f, 0xdf, 0xfc, 0xc1, 0x60, 0x1f, 0xfc, 0xcf, 0xf3,	\
+	0x4f, 0xfe, 0x6f, 0x35, 0x34, 0x5d, 0x4c, 0xd4, 0xdc, 0xdd, 0x34, 0xdf, 0xae, 0xa6, 0x9b, 0xd7,	\
+	0xeb, 0xb9, 0xb9, 0xb9, 0xb2, 0xaf, 0xbe, 0xbc, 0xbe, 0xbc, 0xbe, 0xca, 0xbe, 0xbe, 0x22, 0x7a,	\
+	0x00, 0xf4, 0x00, 0x03, 0xd0, 0x00, 0x13, 0xd3, 0xd2, 0x52, 0x7b, 0xbd, 0xd5, 0xae, 0xea, 0xd2,	\
+	0xdf, 0x75, 0xb1, 0xb1, 0xb1, 0xc1, 0xa1, 0xc1, 0xc2, 0x01, 0xa1, 0xfd, 0xc2, 0x01, 0xed, 0xfd,	\
+	0xef, 0xcd, 0x01, 0x17, 0x16, 0x17, 0xc9, 0x17, 0x17, 0xe6, 0xa6, 0x8b, 0x9b, 0xa6, 0xa6, 0x9b,	\
+	0xa6, 0xa6, 0xf5, 0xd3, 0x5c, 0xdc, 0xdc, 0xfa, 0xfd, 0x77, 0x35, 0xf7, 0xd7, 0x37, 0xd7, 0xd7,	\
+	0xd9, 0x59, 0x44, 0x4f, 0x40, 0x00, 0x49, 0x4f, 0x49, 0x3d, 0xee, 0xa2, 0xa4, 0xa7, 0xa4, 0xa4,	\
+	0xf7, 0x53, 0xd4, 0x14, 0x16, 0x96, 0x96, 0xdc, 0x16, 0xdb, 0x1c, 0x1a, 0x1c, 0x20, 0x20, 0x1c,	\
+	0x1e, 0xe0, 0x20, 0x20, 0x1e, 0xc2, 0x79, 0x9e, 0xdf, 0xdf, 0xe2, 0xe2, 0xc2, 0x53, 0x45, 0xc5,	\
+	0xfa, 0xe6, 0xa6, 0xfd, 0x74, 0xd5, 0xf5, 0xfe, 0xbb, 0x9a, 0xfa, 0x6b, 0xe1, 0x97, 0x35, 0xf9,	\
+	0x57, 0xc3, 0x07, 0xdf, 0x0f, 0xbe, 0x1e, 0x2e, 0xd6, 0xf5, 0x38, 0xf8, 0x9f, 0x7c, 0xbe, 0x27,	\
+	0xd7, 0x1f, 0x13, 0xef, 0x96, 0x4e, 0x4e, 0x4f, 0xcb, 0x3d, 0xe8, 0x93, 0x93, 0x9e, 0x9e, 0x9e,	\
+	0x9e, 0x9e, 0xb3, 0xb3, 0xae, 0xb3, 0xb3, 0xb3, 0xae, 0xb3, 0xae, 0xc4, 0xc4, 0xc4, 0xc4, 0xcb,	\
+	0xcb, 0xc4, 0xc4, 0xcf, 0xcb, 0xcb, 0xc4, 0xcf, 0xfa, 0xe7, 0xec, 0xe7, 0xfd, 0x76, 0x5c, 0x7c,	\
+	0x4e, 0x3e, 0x27, 0x1f, 0x2f, 0x8a, 0x4e, 0x4f, 0xcb, 0x26, 0xfb, 0x27, 0x3d, 0x27, 0xe8, 0x9e,	\
+	0xf4, 0x7a, 0x27, 0xeb, 0xac, 0xe7, 0xab, 0xab, 0xa7, 0xa7, 0xac, 0xec, 0xec, 0xf1, 0x31, 0x2c,	\
+	0xec, 0xf1, 0x32, 0xf1, 0x32, 0xee, 0xb2, 0xf3, 0xee, 0xb3, 0xf2, 0xf3, 0xf3, 0xf3, 0xf3, 0xfe,	\
+	0xbf, 0x5f, 0xaf, 0x89, 0xc5, 0xf7, 0xc4, 0xfb, 0xe2, 0xf2, 0xc9, 0xc9, 0xc4, 0xc9, 0xc9, 0xc9,	\
+	0xc9, 0xc9, 0xcf, 0x7a, 0x3d, 0x13, 0xd3, 0xf3, 0xf3, 0xd5, 0xd6, 0x75, 0xd5, 0xd6, 0x75, 0xd5,	\
+	0xd5, 0xd5, 0xd6, 0x62, 0xac, 0xee, 0xb2, 0xf3, 0xf1, 0x31, 0x33, 0xf1, 0x2e, 0xb2, 0xee, 0xb3,	\
+	0xf3, 0xf6, 0x73, 0xf3, 0xf6, 0x74, 0x1c, 0x5c, 0x5c, 0x5f, 0x5f, 0x5f, 0x64, 0xfc, 0xaf, 0xb2,	\
+	0x6f, 0xaf, 0xb3, 0xd2, 0x73, 0xd2, 0x73, 0xf3, 0xd3, 0xf3, 0xd3, 0xf5, 0xd3, 0xd5, 0xd3, 0xf3,	\
+	0xf5, 0xd5, 0xd7, 0x55, 0xd8, 0x96, 0x78, 0x97, 0x56, 0x78, 0x97, 0x59, 0x79, 0x77, 0x59, 0xf9,	\
+	0xf9, 0xf9, 0x7b, 0x39, 0x79, 0xfb, 0x39, 0xff, 0x5f, 0xab, 0x8b, 0xeb, 0xeb, 0xeb, 0xec, 0x4b,	\
+	0xeb, 0xec, 0x9c, 0x4c, 0x9c, 0x4c, 0x4c, 0x9c, 0x9c, 0xfc, 0x9c, 0x9c, 0xfc, 0xfc, 0xf4, 0xf5,	\
+	0x9d, 0x9d, 0x75, 0x75, 0x70, 0xac, 0x4a, 0xea, 0xeb, 0xab, 0xac, 0xbb, 0x3b, 0xac, 0xbc, 0xbc,	\
+	0xbb, 0xac, 0xbc, 0x8c, 0xbd, 0x9f, 0xae, 0xce, 0x86, 0xcf, 0xd7, 0x67, 0xea, 0xe2, 0xfa, 0xe2,	\
+	0xfa, 0xfa, 0xfb, 0xe5, 0x75, 0x7d, 0x89, 0x7d, 0x89, 0x96, 0x96, 0x93, 0x93, 0x9e, 0x9f, 0x9f,	\
+	0x9f, 0x9e, 0xf4, 0x4f, 0xcf, 0xd7, 0x4f, 0x57, 0x0a, 0xc4, 0xba, 0xae, 0xae, 0xc4, 0xc4, 0xba,	\
+	0xba, 0xc1, 0xba, 0xcb, 0xba, 0xcb, 0xd9, 0xcb, 0xcf, 0xd0, 0xd9, 0xd9, 0xd0, 0xd0, 0xd0, 0xd9,	\
+	0x7d, 0xf1, 0x38, 0xb8, 0xbe, 0xf8, 0x1f, 0x5f, 0x62, 0x5f, 0x65, 0xa5, 0xa2, 0x65, 0xa4, 0xe4,	\
+	0xe7, 0xc3, 0xd7, 0x4b, 0x4f, 0xcf, 0x57, 0x7a, 0x2b, 0x85, 0x5d, 0x57, 0x0a, 0xba, 0x15, 0x67,	\
+	0x75, 0x75, 0x75, 0x83, 0x97, 0x91, 0x75, 0x97, 0x91, 0x97, 0x91, 0x97, 0xb3, 0x97, 0xb3, 0xa1,	\
+	0xb3, 0xf6, 0xd9, 0x71, 0xf0, 0x3e, 0xf8, 0x22, 0x7c, 0xb1, 0x2f, 0xaf, 0xaf, 0xaf, 0xbe, 0x8f,	\
+	0x44, 0x4c, 0xb7, 0xa2, 0x5a, 0x7f, 0xd1, 0x3f, 0x3f, 0x3f, 0xe8, 0xae, 0x9f, 0x14, 0x1e, 0xba,	\
+	0xba, 0xba, 0xea, 0xea, 0xeb, 0x2f, 0x07, 0x12, 0xea, 0xea, 0xea, 0xeb, 0x2f, 0x2f, 0x43, 0x23,	\
+	0x2f, 0x43, 0x3f, 0x67, 0x64, 0xb9, 0x77, 0xd7, 0xd7, 0xd7, 0x58, 0x97, 0xdf, 0x2c, 0x4c, 0x13,	\
+	0xec, 0x4c, 0x4c, 0xb4, 0xb4, 0xb4, 0x9c, 0xb4, 0xb0, 0x7f, 0x40, 0xa0, 0xe1, 0xc3, 0xd7, 0x0a,	\
+	0x15, 0x5d, 0x5d, 0x5d, 0x75, 0x74, 0x2b, 0x07, 0x06, 0xeb, 0x07, 0x22, 0xeb, 0x06, 0xeb, 0x43,	\
+	0x2f, 0x2f, 0x43, 0x43, 0x64, 0xbe, 0xc9, 0x7d, 0x97, 0xd7, 0x17, 0xd7, 0x17, 0x57, 0xd8, 0x98,	\
+	0x98, 0x98, 0x98, 0x99, 0x68, 0xf9, 0x39, 0xf9, 0x69, 0x69, 0x69, 0x60, 0xf5, 0xde, 0x89, 0xf1,	\
+	0x42, 0xae, 0x85, 0x0a, 0x14, 0x28, 0x56, 0x08, 0xab, 0xab, 0xab, 0xab, 0xab, 0xac, 0xbc, 0x1c,	\
+	0x8d, 0x0c, 0xbd, 0x0d, 0x0d, 0x0d, 0x0d, 0x02, 0xfa, 0x05, 0xc9, 0x5e, 0x6a, 0xe7, 0xfd, 0xc3,	\
+	0xf5, 0x5e, 0xe7, 0x70, 0xfd, 0x35, 0x57, 0xb8, 0xaa, 0xaa, 0xab, 0xdf, 0x55, 0x55, 0xed, 0xf6,	\
+	0xfa, 0x9d, 0xc4, 0xd5, 0x55, 0x55, 0x54, 0xd5, 0x54, 0xd4, 0xd5, 0x55, 0x5e, 0xfa, 0xa9, 0xff,	\
+	0x70, 0xff, 0xb6, 0x7e, 0x7e, 0x9b, 0xdc, 0x4d, 0x55, 0x55, 0x55, 0x55, 0x61, 0x61, 0x61, 0x3f,	\
+	0xee, 0x1f, 0xf7, 0x3b, 0x87, 0xe9, 0xa7, 0xe9, 0xbd, 0xc5, 0x55, 0x56, 0x15, 0x56, 0x16, 0x1e,	\
+	0xd9, 0xfa, 0x6a, 0xaf, 0x70, 0xfc, 0xfd, 0x35, 0x85, 0x91, 0x35, 0x91, 0x85, 0x85, 0x91, 0x34,	\
+	0xfc, 0xfd, 0x37, 0xb7, 0xdc, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x64, 0x61, 0x61, 0x61, 0x64,	\
+	0xea, 0x1f, 0xa6, 0x9f, 0x9f, 0xa6, 0x9f, 0xa6, 0xa9, 0xa6, 0xb2, 0x26, 0xb0, 0xb0, 0xb0, 0xb0,	\
+	0xf6, 0xcf, 0xcf, 0xcf, 0xcf, 0xd4, 0xd3, 0x53, 0x53, 0x53, 0x58, 0x58, 0x53, 0x53, 0x59, 0x1c,	\
+	0x4f, 0xfb, 0x87, 0xe9, 0xbd, 0xb4, 0xd5, 0x34, 0xd4, 0xd6, 0x15, 0x56, 0x14, 0xd6, 0x46, 0x16,	\
+	0x1e, 0xd9, 0x91, 0xfa, 0x01, 0x92, 0x9a, 0x6a, 0x92, 0x6a, 0x9a, 0x9a, 0x6b, 0x23, 0x0b, 0x0b,	\
+	0x2a, 0x6a, 0x69, 0xfa, 0x99, 0x91, 0x92, 0x03, 0x0a, 0x92, 0x92, 0x9b, 0x0b, 0x2b, 0x0b, 0x23,	\
+	0x29, 0x97, 0x6d, 0x00, 0xc9, 0x35, 0x4d, 0x4d, 0x4d, 0x85, 0x35, 0x49, 0x4d, 0x4d, 0x91, 0x49,	\
+	0x4d, 0x35, 0x34, 0xc9, 0x35, 0x35, 0x00, 0xfd, 0x35, 0x4d, 0x35, 0x85, 0x85, 0x85, 0x4d, 0x91,	\
+	0x94, 0xc8, 0xc8, 0xc8, 0xc9, 0x4d, 0x4d, 0x4d, 0x49, 0x4d, 0x49, 0x4d, 0x35, 0x85, 0x95, 0x95,	\
+	0x84, 0xfc, 0xc9, 0x00, 0xc9, 0x4d, 0x4d, 0x01, 0x35, 0x4d, 0x49, 0x85, 0x85, 0x4d, 0x95, 0x87,	\
+	0xc0, 0x80, 0x64, 0x80, 0x80, 0x80, 0x9a, 0xa4, 0xa6, 0xa4, 0x80, 0xca, 0xa4, 0xc2, 0xca, 0xc2,	\
+	0xb0, 0x66, 0x64, 0xa4, 0x80, 0xa6, 0x80, 0x80, 0xa6, 0xa4, 0xa4, 0xa4, 0xca, 0xc4, 0xa4, 0xc3,	\
+	0xe0, 0x40, 0x33, 0x40, 0x40, 0x40, 0x44, 0x40, 0x40, 0x52, 0x53, 0x61, 0x61, 0x52, 0x52, 0x65,	\
+	0x58, 0x40, 0x40, 0x40, 0x44, 0x40, 0x44, 0x52, 0x53, 0x40, 0x52, 0x58, 0x58, 0x52, 0x62, 0x52,	\
+	0x65, 0x40, 0x32, 0x53, 0x33, 0x40, 0x52, 0x52, 0x52, 0x58, 0x58, 0x65, 0x53, 0x65, 0x58, 0x65,	\
+	0x62, 0x33, 0x32, 0x44, 0x33, 0x52, 0x40, 0x52, 0x58, 0x58, 0x52, 0x52, 0x58, 0x65, 0x58, 0x65,	\
+	0x62, 0x33, 0x40, 0x52, 0x44, 0x56, 0x52, 0x44, 0x58, 0x58, 0x53, 0x65, 0x44, 0x52, 0x62, 0x6e,	\
+	0x58, 0x34, 0x44, 0x52, 0x33, 0x52, 0x58, 0x52, 0x44, 0x58, 0x44, 0x62, 0x62, 0x58, 0x52, 0x65,	\
+	0x58, 0x34, 0x34, 0x44, 0x44, 0x40, 0x58, 0x53, 0x52, 0x52, 0x62, 0x58, 0x58, 0x56, 0x62, 0x62,	\
+	0x58, 0x34, 0x40, 0x34, 0x52, 0x44, 0x56, 0x58, 0x44, 0x58, 0x56, 0x58, 0x58, 0x62, 0x62, 0x62,	\
+	0x58, 0xc4, 0x8f, 0x3b, 0x8d, 0x0d, 0x8d, 0x11, 0x11, 0xcd, 0x10, 0x4d, 0x51, 0xd1, 0xd0, 0x50,	\
+	0x50, 0x51, 0xcd, 0x10, 0x4d, 0x0d, 0x90, 0x4d, 0x4d, 0x8d, 0xcd, 0x10, 0x52, 0x95, 0x97, 0x91,	\
+	0xcd, 0x4d, 0x0d, 0x4d, 0x8d, 0xd2, 0x90, 0x4d, 0x50, 0x4d, 0x8d, 0x50, 0x51, 0xd7, 0x8d, 0x0d,	\
+	0x4d, 0x50, 0x4d, 0x8d, 0x8d, 0x91, 0xcd, 0x55, 0x8d, 0x52, 0x92, 0xbb, 0xc6, 0xa6, 0xc6, 0xa6,	\
+	0xa8, 0x26, 0xc6, 0xc6, 0xc6, 0xe8, 0x28, 0xe8, 0x28, 0x3d, 0xe3, 0x63, 0x63, 0x63, 0x73, 0x43,	\
+	0x74, 0xa3, 0x64, 0x13, 0x64, 0x14, 0xa4, 0x74, 0xa3, 0x53, 0x73, 0x73, 0x5e, 0xb9, 0xb1, 0xa9,	\
+	0xba, 0x09, 0xba, 0x3a, 0x52, 0x52, 0xf1, 0xa9, 0xb1, 0xb1, 0xa9, 0xb9, 0xaa, 0x3a, 0x51, 0xaa,	\
+	0x52, 0x09, 0xba, 0x72, 0x71, 0xa9, 0xa9, 0xb1, 0xb1, 0xb9, 0xb9, 0xba, 0x52, 0x71, 0xb2, 0x72,	\
+	0x72, 0x72, 0x71, 0xb7, 0x5c, 0xdc, 0xd8, 0xd5, 0x28, 0xdc, 0xd4, 0xdc, 0xdd, 0x29, 0x29, 0x29,	\
+	0x2b, 0xae, 0x6d, 0xd7, 0x37, 0x36, 0x37, 0x37, 0x4e, 0x38, 0x4a, 0x37, 0x4e, 0x4a, 0x4e, 0x36,	\
+	0x37, 0x35, 0xeb, 0x9a, 0x9b, 0x9b, 0xa5, 0x1b, 0x9c, 0x24, 0x25, 0x25, 0x25, 0x1a, 0xf5, 0xfa,	\
+	0xe6, 0xe7, 0x07, 0x06, 0xe9, 0xc9, 0x06, 0xe9, 0xc6, 0xe9, 0xc6, 0xfd, 0x73, 0x73, 0x5e, 0xbf,	\
+	0x5c, 0xe1, 0x38, 0xe0, 0xdd, 0x39, 0x39, 0x38, 0xe0, 0xe0, 0xd7, 0xae, 0x72, 0x6e, 0x70, 0x71,	\
+	0xd8, 0x4a, 0x37, 0x38, 0x48, 0x4e, 0x4e, 0x4e, 0xeb, 0x9c, 0x75, 0xce, 0x0e, 0x12, 0x92, 0x0e,	\
+	0x0d, 0xd3, 0x93, 0x8e, 0x13, 0x93, 0x8d, 0xce, 0x0e, 0x3b, 0x07, 0x1d, 0x73, 0x83, 0x84, 0x8e,	\
+	0xc2, 0x42, 0x42, 0x42, 0x77, 0x5c, 0xe0, 0xe3, 0xaf, 0xd8, 0xec, 0x24, 0x1c, 0x24, 0x27, 0x76,	\
+	0x3b, 0x09, 0xc9, 0x47, 0x1d, 0x7e, 0xbf, 0x5c, 0xe5, 0x20, 0xe0, 0xe0, 0xe1, 0x29, 0x21, 0x39,	\
+	0x21, 0x5c, 0xe4, 0xe3, 0xae, 0x6f, 0xd7, 0x38, 0xec, 0x01, 0xec, 0x76, 0x12, 0x12, 0x12, 0x15,	\
+	0xfa, 0xe7, 0x27, 0x27, 0x27, 0x07, 0x27, 0x27, 0x29, 0x09, 0x00, 0x52, 0x12, 0x15, 0xfb, 0x07,	\
+	0x27, 0x3d, 0x83, 0x83, 0x90, 0x29, 0x07, 0x07, 0x2a, 0xe0, 0x40, 0xab, 0x9c, 0xf5, 0xce, 0x7b,	\
+	0x09, 0x07, 0x07, 0x27, 0x29, 0x09, 0x09, 0x0a, 0xeb, 0x20, 0x7b, 0x1d, 0x83, 0x93, 0xa3, 0x9e,	\
+	0xc0, 0x14, 0x84, 0x80, 0x29, 0x0b, 0x20, 0x52, 0x0e, 0x4e, 0x4e, 0x4e, 0x4e, 0xbb, 0x07, 0x40,	\
+	0x52, 0x00, 0x81, 0x02, 0x05, 0x20, 0xe4, 0xe4, 0xeb, 0xb0, 0x04, 0xe7, 0xb0, 0x72, 0x70, 0x05,	\
+	0x20, 0x0a, 0xb8, 0x1a, 0x66, 0x86, 0x51, 0x77, 0xb7, 0xbe, 0xcb, 0xd1, 0xbe, 0xcf, 0x7f, 0xbf,	\
+	0xe1, 0xf0, 0xf6, 0x7b, 0xfd, 0xff, 0x02, 0x85, 0x3e, 0x85, 0x39, 0x3e, 0x9c, 0x9c, 0x85, 0x3e,	\
+	0x9c, 0x9c, 0x9c, 0x97, 0xa2, 0xef, 0x6f, 0x6f, 0x46, 0xfb, 0x3d, 0x9e, 0xff, 0x87, 0xc3, 0xdf,	\
+	0xec, 0xf7, 0x92, 0xf7, 0xfd, 0x37, 0x77, 0x7e, 0x9b, 0xbc, 0x85, 0x37, 0x79, 0x38, 0xb7, 0x7f,	\
+	0xd7, 0xbe, 0xc1, 0xbe, 0xcb, 0xdf, 0x7f, 0xbf, 0x3b, 0x3b, 0xe1, 0xef, 0xfa, 0x14, 0xf8, 0x7c,	\
+	0x3e, 0x19, 0xda, 0x3b, 0xbf, 0x4e, 0x4e, 0x42, 0x9c, 0x9c, 0x9f, 0xef, 0xf7, 0xfa, 0xf4, 0x6d,	\
+	0xed, 0xe5, 0xef, 0xc3, 0xd9, 0xef, 0xf8, 0x7b, 0x3e, 0x1f, 0x0f, 0xa1, 0x4f, 0x7f, 0xd0, 0xa7,	\
+	0xd3, 0x93, 0x90, 0xa6, 0xee, 0xef, 0x27, 0xfb, 0xfd, 0xfe, 0xdd, 0xbd, 0xf6, 0x0d, 0xbc, 0xbd,	\
+	0xbd, 0xbc, 0xf6, 0x7b, 0x33, 0xbe, 0x1a, 0x39, 0xde, 0xfd, 0xaf, 0x81, 0x4f, 0xa1, 0x4d, 0xad,	\
+	0xdf, 0xa6, 0xee, 0xee, 0xee, 0xef, 0x27, 0x25, 0xed, 0xed, 0xef, 0xb2, 0xf7, 0xd9, 0xef, 0xf6,	\
+	0x67, 0x7b, 0xf4, 0x7e, 0x1a, 0x3f, 0x0d, 0x1f, 0x86, 0xd6, 0xe9, 0x4d, 0xaf, 0xa6, 0xef, 0x26,	\
+	0xee, 0xef, 0xfb, 0x77, 0xfd, 0x6b, 0x6b, 0x7b, 0xec, 0xce, 0xf6, 0x7c, 0x33, 0xb4, 0x7e, 0x1b,	\
+	0x59, 0xd9, 0xdf, 0x0c, 0xed, 0xad, 0xdd, 0xdd, 0xad, 0xdd, 0xdd, 0xdd, 0xad, 0xaf, 0xf6, 0xef,	\
+	0xef, 0xf7, 0x7b, 0x7b, 0x7b, 0x7b, 0x9d, 0x7b, 0xef, 0xca, 0xf8, 0x67, 0x68, 0xe8, 0xe8, 0xed,	\
+	0x68, 0xfd, 0x36, 0xbe, 0x9b, 0x5b, 0x5b, 0x45, 0x76, 0xb7, 0x76, 0xbf, 0xdb, 0xa5, 0x6d, 0x7d,	\
+	0x97, 0x97, 0x9e, 0xff, 0x65, 0xe6, 0x77, 0xb3, 0x3b, 0x6b, 0xd9, 0xf4, 0xd1, 0xdd, 0xfa, 0x7d,	\
+	0x37, 0x74, 0x76, 0xb6, 0x8a, 0x95, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xb1, 0xbc, 0xf6, 0x5e, 0x5e,	\
+	0xde, 0x68, 0xfb, 0x34, 0x73, 0xb4, 0x73, 0xb6, 0xb4, 0x74, 0x74, 0x74, 0x74, 0x76, 0xb7, 0x77,	\
+	0x76, 0xb6, 0xb7, 0x77, 0x7f, 0xdb, 0xbc, 0x97, 0x96, 0xb7, 0x99, 0x59, 0xd7, 0x99, 0xda, 0x39,	\
+	0xda, 0x39, 0xda, 0x24, 0x73, 0xb6, 0xbe, 0x99, 0xc5, 0x7e, 0x9b, 0x5b, 0x5c, 0x85, 0x77, 0x77,	\
+	0x7f, 0x7f, 0xbf, 0xdd, 0xe5, 0xad, 0xad, 0xe5, 0xe5, 0xe6, 0x56, 0x8e, 0x76, 0x56, 0x76, 0x76,	\
+	0x8e, 0xd6, 0xd6, 0x8e, 0x76, 0x8e, 0x8e, 0xd6, 0xe9, 0x52, 0xbb, 0xbf, 0xbf, 0xd9, 0x5d, 0xdb,	\
+	0x5b, 0xcb, 0xcb, 0xcb, 0xcc, 0xed, 0x1c, 0xec, 0xab, 0xc2, 0x3a, 0x39, 0xdb, 0x5a, 0x3a, 0x3f,	\
+	0x4d, 0xad, 0xa2, 0x25, 0x77, 0x76, 0xb7, 0x4a, 0x95, 0x2a, 0x57, 0x38, 0xb4, 0xee, 0xc1, 0xd1,	\
+	0xc9, 0xd0, 0x13, 0xae, 0xc0, 0x10, 0x20, 0x52, 0x16, 0x40, 0x81, 0x39, 0x3a, 0x02, 0x04, 0xe4,	\
+	0x09, 0xe1, 0xd0, 0x1e, 0xc2, 0xc8, 0x10, 0x20, 0x4e, 0x8e, 0x4e, 0x40, 0x9d, 0x01, 0x02, 0x90,	\
+	0x04, 0x0a, 0xc8, 0x14, 0xb5, 0x93, 0xa3, 0xa3, 0xa0, 0x27, 0x27, 0x40, 0x52, 0xd2, 0xd2, 0xc0,	\
+	0xac, 0xac, 0xac, 0x9c, 0x9e, 0x1d, 0x1d, 0x1d, 0x01, 0x4b, 0x46, 0x4b, 0x4b, 0x46, 0x02, 0xb2,	\
+	0x96, 0x72, 0x72, 0x74, 0x74, 0x96, 0x74, 0x05, 0x2c, 0x08, 0x14, 0xb5, 0x94, 0xb5, 0x93, 0xa3,	\
+	0xb3, 0xc3, 0xc4, 0xb4, 0xb4, 0x64, 0xb4, 0x60, 0x29, 0x68, 0xcb, 0x2b, 0x27, 0x47, 0x47, 0x49,	\
+	0x67, 0x47, 0x47, 0x40, 0x40, 0xa3, 0x23, 0x25, 0x81, 0x46, 0x3a, 0x3a, 0x3c, 0x3a, 0x3c, 0x3a,	\
+	0x46, 0x4b, 0x02, 0x96, 0x8c, 0x96, 0x96, 0x96, 0x74, 0x76, 0x8c, 0x78, 0x04, 0xf0, 0x09, 0xe2,	\
+	0x5a, 0x32, 0x5a, 0x32, 0x32, 0xf9, 0xd1, 0xe1, 0xe2, 0x5a, 0x5a, 0x59, 0xe2, 0x5a, 0x32, 0x2a,	\
+	0xfa, 0xca, 0xcb, 0x01, 0xd1, 0xe1, 0xe1, 0xe1, 0xe2, 0x5a, 0x32, 0x31, 0xe2, 0x5a, 0x32, 0x5b,	\
+	0x03, 0x01, 0xe2, 0x31, 0xda, 0x31, 0xe1, 0xe1, 0xe2, 0x29, 0xe2, 0x33, 0x02, 0x2a, 0x32, 0xf9,	\
+	0xd9, 0xd9, 0xe2, 0x5a, 0x31, 0xe2, 0x29, 0xe2, 0x5a, 0x31, 0xe2, 0x7a, 0x32, 0x59, 0xd9, 0xd9,	\
+	0xe2, 0x59, 0xda, 0x32, 0x5a, 0x2a, 0x32, 0x2a, 0xca, 0xfb, 0x03, 0x02, 0x29, 0xda, 0x32, 0x31,	\
+	0xe2, 0x59, 0xe2, 0x32, 0x2a, 0x5a, 0x7a, 0x2a, 0xfa, 0x79, 0xe9, 0xd9, 0xd9, 0xd9, 0xda, 0x2a,	\
+	0x2a, 0x32, 0x2a, 0x2a, 0x2b, 0x02, 0x7a, 0xd1, 0xd9, 0xda, 0x29, 0xda, 0x29, 0xe9, 0xe2, 0x2a,	\
+	0x32, 0x2b, 0x02, 0x32, 0x7a, 0x79, 0xe9, 0xe9, 0xda, 0x2a, 0x2a, 0x79, 0xea, 0x2a, 0x29, 0xe2,	\
+	0x7a, 0x2a, 0xd2, 0x7a, 0x2a, 0x29, 0xe9, 0xd9, 0xea, 0x2a, 0x7a, 0x7a, 0x2a, 0xd2, 0xd2, 0xd2,	\
+	0x7a, 0x2e, 0xcf, 0x74, 0xb5, 0x88, 0x95, 0xda, 0x2a, 0x57, 0x6b, 0x8c, 0xaf, 0xef, 0x8f, 0x6b,	\
+	0x68, 0x89, 0x1e, 0x32, 0xa5, 0x7f, 0x7c, 0x7f, 0xb2, 0xa5, 0x48, 0x95, 0x2a, 0x57, 0x94, 0xa9,	\
+	0x5e, 0x52, 0x25, 0x4a, 0xf1, 0x91, 0x2b, 0xfb, 0x2a, 0x57, 0xf6, 0x54, 0xa9, 0x5e, 0x32, 0xbc,	\
+	0xbf, 0xbe, 0x32, 0xa5, 0x49, 0x95, 0x2b, 0xcb, 0xc7, 0xcb, 0xcb, 0xfb, 0x2b, 0xca, 0x57, 0x94,	\
+	0xaf, 0x1f, 0x29, 0x5e, 0x3e, 0x3f, 0xdf, 0x19, 0x5e, 0x52, 0xa4, 0xca, 0xf1, 0xf2, 0xf2, 0xf2,	\
+	0xfe, 0xc9, 0x95, 0xe3, 0x27, 0xc6, 0x4f, 0x97, 0xf7, 0xcb, 0xc6, 0x47, 0x8f, 0x8c, 0x9f, 0x2f,	\
+	0x2f, 0x2f, 0x1f, 0x1f, 0x2f, 0x19, 0x12, 0x7c, 0x7c, 0x65, 0x79, 0x79, 0x79, 0x78, 0xf8, 0xc9,	\
+	0x93, 0xe3, 0xe3, 0x27, 0xcb, 0xcb, 0xcb, 0xfc, 0x27, 0xc6, 0x4f, 0x8f, 0x97, 0x8f, 0x97, 0x97,	\
+	0x8f, 0x7c, 0x9f, 0x1e, 0xff, 0x1e, 0xfe, 0xfe, 0xff, 0x1f, 0x2f, 0xf3, 0x7c, 0x9e, 0xf9, 0x3d,	\
+	0xfd, 0xfd, 0xff, 0xe6, 0xff, 0xf0, 0x9e, 0xfe, 0xf9, 0x32, 0x7b, 0xfc, 0xbb, 0xfb, 0xfb, 0xe4,	\
+	0xc9, 0x93, 0x27, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xfc, 0x26, 0x5b, 0x4b, 0x7f, 0x7f, 0x7c, 0xb7,	\
+	0xf3, 0x7f, 0xf9, 0xbe, 0x4c, 0x9e, 0xf9, 0x32, 0x7f, 0xcd, 0xfd, 0xfd, 0xfd, 0x2f, 0x9e, 0xfe,	\
+	0xf9, 0x3e, 0x32, 0xc5, 0xb7, 0xf7, 0xfe, 0x7a, 0x45, 0x8b, 0x16, 0x2d, 0xcd, 0xbf, 0xfc, 0xfe,	\
+	0x69, 0x16, 0x27, 0xa5, 0xbf, 0xbf, 0xfc, 0xdf, 0xfe, 0x6f, 0x93, 0x2d, 0xf3, 0x2c, 0x58, 0xb1,	\
+	0x62, 0xdc, 0xdf, 0xcf, 0x9e, 0xc1, 0x62, 0xc5, 0x8b, 0x6f, 0xf3, 0x16, 0xdf, 0x2c, 0x5b, 0x63,	\
+	0x60, 0xb1, 0x62, 0xdc, 0xdc, 0xc5, 0xb4, 0xb4, 0x8b, 0x16, 0xd8, 0xe6, 0xd8, 0xe6, 0xe6, 0xe6,	\
+	0x2d, 0xb0, 0x58, 0xb1, 0x62, 0xc5, 0xb9, 0xb9, 0xb8, 0x36, 0x38, 0x0b, 0x16, 0x2d, 0xcd, 0xfd,	\
+	0xe0, 0xdf, 0xe6, 0xda, 0x70, 0x5a, 0x00, 0x00, 0x02, 0x4a, 0x7a, 0x4f, 0x75, 0x25, 0x3d, 0x43,	\
+	0xba, 0x9f, 0xdd, 0x68, 0x6c, 0x50, 0xee, 0xb8, 0x77, 0x56, 0xcf, 0x40, 0x00, 0x49, 0x00, 0x01,	\
+	0x25, 0x25, 0x25, 0x6f, 0xba, 0x92, 0xb6, 0xb6, 0xa0, 0xd8, 0xd9, 0xdd, 0x5b, 0x04, 0x00, 0x02,	\
+	0x12, 0x4a, 0x80, 0x04, 0x95, 0xb4, 0x94, 0x9e, 0xea, 0x87, 0x75, 0x6d, 0x6d, 0x6d, 0xc1, 0x6d,	\
+	0xc1, 0xc1, 0x24, 0x00, 0x04, 0x94, 0x20, 0x08, 0x49, 0x2a, 0x1d, 0xde, 0xea, 0x82, 0xda, 0xda,	\
+	0xdf, 0x75, 0xc1, 0x6d, 0x6d, 0xc1, 0x25, 0x25, 0x25, 0x24, 0x02, 0x48, 0x04, 0x95, 0x04, 0x95,	\
+	0x05, 0x05, 0x00, 0x4b, 0x6b, 0x60, 0x81, 0x2d, 0x82, 0x42, 0x00, 0x84, 0x84, 0x84, 0xa0, 0x92,	\
+	0x92, 0xa0, 0xa0, 0xa0, 0xb6, 0xa0, 0x09, 0x51, 0x6d, 0x6d, 0xc0, 0x13, 0x80, 0x04, 0x24, 0x34,	\
+	0x30, 0x08, 0x48, 0x68, 0x7d, 0xd5, 0xb5, 0x45, 0x45, 0x05, 0x05, 0x45, 0x40, 0x4a, 0x8a, 0x80,	\
+	0x80, 0x24, 0x80, 0x00, 0x84, 0xa0, 0x92, 0x86, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0x08, 0x10, 0x20,	\
+	0x4a, 0x80, 0x96, 0xc0, 0x24, 0xa1, 0xa1, 0x21, 0xa8, 0x28, 0x21, 0xa4, 0xa8, 0x21, 0x82, 0x50,	\
+	0x04, 0xa8, 0x09, 0x50, 0x10, 0x20, 0x48, 0x5d, 0x94, 0x94, 0x24, 0x24, 0x95, 0x04, 0x25, 0x05,	\
+	0x05, 0x05, 0x00, 0x40, 0x81, 0x02, 0x54, 0x04, 0xa8, 0xe0, 0x84, 0x86, 0x84, 0xa0, 0xa0, 0xa8,	\
+	0x84, 0xa8, 0xa0, 0xa8, 0xa8, 0xa0, 0x09, 0x41, 0x51, 0x51, 0xc1, 0x51, 0x50, 0x16, 0xdf, 0x5d,	\
+	0x86, 0xdf, 0x5f, 0x5f, 0x5f, 0x11, 0x1f, 0x94, 0x3e, 0xf8, 0x79, 0x31, 0xe3, 0x07, 0xdf, 0x0c,	\
+	0x1f, 0x7c, 0x3c, 0x99, 0x11, 0xe4, 0x48, 0xdf, 0x0c, 0x22, 0x3e, 0xf8, 0x78, 0xf1, 0xe4, 0x47,	\
+	0x8f, 0x22, 0x32, 0xfa, 0xf8, 0x60, 0xf1, 0xe3, 0xc7, 0x8c, 0x26, 0x3c, 0x98, 0xcb, 0xe1, 0x83,	\
+	0x06, 0x0f, 0x18, 0x3c, 0x78, 0xf2, 0x64, 0xec, 0x86, 0x0c, 0x1e, 0x30, 0x78, 0xf1, 0xe4, 0xc7,	\
+	0x93, 0x1e, 0x30, 0x60, 0xc1, 0x83, 0x07, 0x0c, 0xf9, 0x8c, 0x26, 0x3c, 0x98, 0xc1, 0x83, 0x2f,	\
+	0x87, 0x8f, 0x18, 0x30, 0x79, 0x31, 0xe4, 0xc7, 0x8c, 0x1e, 0x38, 0x78, 0xc1, 0xe4, 0xc9, 0x93,	\
+	0x1e, 0x4e, 0xc8, 0x70, 0xe1, 0x83, 0x06, 0x0f, 0x1e, 0x4f, 0x48, 0x9f, 0xce, 0xc8, 0x60, 0xc1,	\
+	0x83, 0x06, 0x0e, 0xf9, 0x8e, 0x1f, 0xa5, 0xa4, 0x30, 0x60, 0xc1, 0xda, 0x43, 0x3e, 0x63, 0x87,	\
+	0xe9, 0x69, 0x69, 0x0c, 0x18, 0x30, 0x60, 0xf1, 0xc3, 0x87, 0x69, 0x69, 0x0f, 0xf9, 0x8c, 0x18,	\
+	0x38, 0x70, 0xe1, 0x83, 0x87, 0x13, 0x1d, 0xa5, 0xf3, 0x1c, 0x38, 0x70, 0xe1, 0xc3, 0xc7, 0x69,	\
+	0x7c, 0xf4, 0xb6, 0x3e, 0x63, 0xb0, 0x06, 0x0e, 0x1c, 0x38, 0x76, 0x96, 0x96, 0xc7, 0xcf, 0xe6,	\
+	0x38, 0x60, 0xec, 0x0f, 0x70, 0xed, 0x21, 0xda, 0x5a, 0x5a, 0x5a, 0x5c, 0x54, 0xbf, 0x67, 0x43,	\
+	0x43, 0x23, 0x23, 0x67, 0x67, 0x43, 0x67, 0x40, 0xbe, 0x81, 0x73, 0x05, 0xcb, 0x97, 0xfc, 0xfe,	\
+	0x4b, 0xe4, 0x64, 0x68, 0x64, 0x68, 0x68, 0x10, 0x31, 0xa1, 0xa0, 0x43, 0x40, 0xb9, 0x73, 0x05,	\
+	0xcb, 0xf4, 0x7d, 0xf4, 0x08, 0x64, 0x10, 0xd0, 0xd0, 0x20, 0x60, 0xb9, 0x72, 0xe4, 0x3e, 0xe6,	\
+	0x0c, 0x74, 0x7d, 0xcb, 0xfe, 0x72, 0x30, 0xb0, 0xb0, 0xb4, 0x34, 0x34, 0x08, 0x10, 0xd0, 0x30,	\
+	0x60, 0x81, 0x82, 0xff, 0x93, 0x06, 0x0c, 0x60, 0xe1, 0x10, 0xd0, 0xd0, 0xc8, 0xd0, 0xd0, 0x20,	\
+	0x40, 0xc1, 0x72, 0xe6, 0x0c, 0x18, 0xfc, 0xfd, 0xcc, 0x60, 0xe8, 0x60, 0x90, 0x21, 0xa0, 0x40,	\
+	0x81, 0x03, 0x04, 0x08, 0x18, 0xe8, 0x31, 0xf7, 0xe8, 0x31, 0xf7, 0xcc, 0xc8, 0x20, 0x43, 0x20,	\
+	0x81, 0x02, 0x1a, 0x06, 0x08, 0x17, 0x20, 0x40, 0x81, 0x83, 0x06, 0x38, 0x72, 0x08, 0x60, 0x90,	\
+	0xcc, 0x20, 0x40, 0x81, 0x83, 0x06, 0x0b, 0x98, 0xfb, 0x98, 0xe8, 0xfb, 0xf4, 0x18, 0x21, 0x99,	\
+	0x82, 0x40, 0x81, 0x0c, 0xc3, 0x04, 0x0c, 0x18, 0x21, 0xc3, 0xf7, 0x30, 0x5f, 0xef, 0xf7, 0x31,	\
+	0x7f, 0x99, 0x96, 0xe5, 0x24, 0x61, 0x28, 0x25, 0x28, 0x25, 0x28, 0x68, 0x68, 0x68, 0x28, 0x68,	\
+	0x44, 0x50, 0x88, 0x11, 0x6f, 0x68, 0x22, 0xfe, 0x46, 0x46, 0x52, 0x52, 0x82, 0x52, 0x52, 0x82,	\
+	0x52, 0x50, 0x45, 0x3d, 0x08, 0x81, 0x16, 0x82, 0x04, 0x08, 0xbf, 0xbf, 0x91, 0x91, 0x91, 0x94,	\
+	0x94, 0x94, 0x94, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0x10, 0x22, 0x9c, 0x40, 0x81, 0x16, 0x82, 0x04,	\
+	0x42, 0x4a, 0x42, 0x4a, 0x4a, 0x50, 0xd0, 0x50, 0x50, 0xd0, 0xd0, 0xd0, 0x50, 0xda, 0x50, 0xda,	\
+	0x08, 0xb4, 0xb4, 0xbf, 0x11, 0x29, 0x29, 0x1b, 0x29, 0x1b, 0x43, 0x1b, 0x29, 0x42, 0x22, 0x86,	\
+	0x86, 0xd0, 0x40, 0x81, 0x02, 0x04, 0x61, 0xfa, 0xad, 0x24, 0x65, 0x24, 0x65, 0x28, 0x65, 0x28,	\
+	0x28, 0x04, 0x50, 0x88, 0xa1, 0xb4, 0xf5, 0x08, 0xf5, 0x5a, 0x08, 0x11, 0x69, 0x8d, 0x09, 0x29,	\
+	0x29, 0x43, 0x29, 0x1b, 0x1b, 0x29, 0x43, 0x30, 0x22, 0x62, 0x84, 0x40, 0x81, 0x1e, 0xab, 0x4b,	\
+	0x41, 0x16, 0x90, 0x90, 0x91, 0xb3, 0x13, 0x12, 0x94, 0x34, 0x14, 0x22, 0x28, 0x44, 0x50, 0xd0,	\
+	0xcc, 0x7a, 0x84, 0x5a, 0x5a, 0x5a, 0x5c, 0x78, 0xce, 0xcb, 0x76, 0xc3, 0xad, 0xb0, 0x3d, 0xa3,	\
+	0x87, 0x0e, 0xd8, 0xd8, 0xd8, 0xd2, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0x2d, 0xcc, 0x58, 0xb0, 0xec,	\
+	0x0c, 0x0f, 0x6e, 0x00, 0xed, 0x2f, 0x77, 0xcc, 0x76, 0xc7, 0xbb, 0xe7, 0xee, 0xd8, 0xd8, 0xd8,	\
+	0xd8, 0xd8, 0xd8, 0xe6, 0x1d, 0x80, 0x38, 0x76, 0x07, 0xbb, 0x00, 0x77, 0xbb, 0xdd, 0xb1, 0xa5,	\
+	0xee, 0xd8, 0xd8, 0x2c, 0x5b, 0x80, 0xb7, 0x01, 0x6b, 0x6c, 0x0c, 0x0f, 0x68, 0xef, 0x68, 0xe1,	\
+	0xde, 0xe1, 0xde, 0xef, 0x77, 0xbb, 0xe5, 0xb1, 0xf2, 0xd8, 0xd8, 0xd8, 0xe6, 0x2d, 0x81, 0xed,	\
+	0xc0, 0x1d, 0x81, 0xee, 0xf7, 0x7b, 0xbd, 0xde, 0xdf, 0x96, 0xc7, 0xcb, 0xdd, 0xb0, 0x5b, 0x60,	\
+	0xb7, 0x07, 0x07, 0x06, 0x06, 0x06, 0x06, 0x07, 0xbb, 0xdd, 0xed, 0xf7, 0x6c, 0x7b, 0xbe, 0x5e,	\
+	0xed, 0x8f, 0x97, 0x07, 0xcb, 0xe5, 0xb1, 0xc1, 0xb1, 0xc1, 0x81, 0x81, 0xed, 0xf7, 0x60, 0x7b,	\
+	0x7d, 0xbe, 0xef, 0x6f, 0xb7, 0x63, 0xe5, 0xee, 0xf9, 0x70, 0x70, 0x6c, 0x70, 0x7c, 0xb8, 0x38,	\
+	0x30, 0x3f, 0xff, 0xbb, 0xdb, 0xee, 0xf6, 0xfc, 0xb0, 0x36, 0x3d, 0xbf, 0x2f, 0x96, 0xc6, 0xc7,	\
+	0xcb, 0xe5, 0xf2, 0xe0, 0xe0, 0xd8, 0xe0, 0x6c, 0x6b, 0xb6, 0xc9, 0xe0, 0x65, 0x7d, 0xf0, 0x41,	\
+	0x32, 0xc1, 0x3a, 0xc1, 0x44, 0xbe, 0xc4, 0xc4, 0xcb, 0x44, 0xcb, 0x44, 0xcf, 0xcb, 0x4b, 0x32,	\
+	0xb8, 0xf8, 0x3c, 0x0e, 0x2e, 0x2e, 0x3e, 0x07, 0xd7, 0xd7, 0xd8, 0x28, 0x27, 0xd8, 0x29, 0x68,	\
+	0x29, 0x68, 0xf9, 0x6f, 0x43, 0x2f, 0x83, 0xc0, 0xca, 0xe2, 0xe2, 0xea, 0xe2, 0xeb, 0x05, 0x13,	\
+	0x13, 0x05, 0x05, 0x13, 0x13, 0x2d, 0x2d, 0x2c, 0x1c, 0x3b, 0x2b, 0x2b, 0x73, 0xab, 0xab, 0xab,	\
+	0x2b, 0xab, 0xab, 0xac, 0x4b, 0xac, 0x7c, 0x14, 0x7b, 0xec, 0x4c, 0xb4, 0xb0, 0x78, 0x96, 0x5f,	\
+	0x07, 0x83, 0xc0, 0xea, 0xea, 0xcb, 0x05, 0xe0, 0x75, 0x8f, 0x8f, 0x89, 0x8f, 0x8f, 0x82, 0x89,	\
+	0x82, 0x0f, 0x1e, 0x1d, 0x97, 0xc0, 0xea, 0xca, 0xea, 0xeb, 0xe0, 0x6e, 0x89, 0x75, 0x75, 0x89,	\
+	0x82, 0x8f, 0x96, 0x82, 0x8f, 0x8f, 0xf4, 0x47, 0xcb, 0x30, 0xb2, 0xba, 0xb2, 0xc1, 0x3a, 0xba,	\
+	0xb7, 0x3a, 0xb7, 0x41, 0x3a, 0xc1, 0x47, 0xc1, 0x41, 0x47, 0xc7, 0x87, 0x8f, 0x96, 0xe0, 0xaa,	\
+	0xec, 0x42, 0x50, 0x42, 0x42, 0x43, 0x50, 0x54, 0x4c, 0x43, 0x42, 0x54, 0x42, 0x42, 0x54, 0x50,	\
+	0x54, 0xec, 0xa1, 0x76, 0x54, 0x13, 0x13, 0x14, 0x13, 0x10, 0x90, 0xd0, 0xd0, 0x93, 0x10, 0xd5,	\
+	0x14, 0x10, 0xfb, 0x27, 0xc7, 0xc8, 0x6a, 0x29, 0x8a, 0x28, 0x69, 0x89, 0x89, 0x8a, 0x09, 0x8a,	\
+	0x8a, 0x88, 0x68, 0x67, 0xc9, 0x8a, 0x0b, 0x8a, 0x2a, 0x88, 0x7d, 0x94, 0xc4, 0x34, 0xc4, 0xc4,	\
+	0xc5, 0x43, 0xee, 0xd2, 0x62, 0x19, 0xf2, 0x62, 0x62, 0x61, 0xf2, 0x62, 0x62, 0x62, 0x62, 0x62,	\
+	0x62, 0x1a, 0x62, 0x62, 0x61, 0xf1, 0xf2, 0x62, 0x8a, 0x89, 0xf2, 0x62, 0x8a, 0x89, 0xf1, 0xf2,	\
+	0x62, 0x8f, 0x68, 0xf9, 0x30, 0xf9, 0x31, 0x31, 0x45, 0x33, 0xb4, 0x7c, 0x7c, 0x98, 0x7c, 0xa2,	\
+	0xa2, 0x98, 0x7c, 0xa2, 0x7c, 0xa2, 0x7c, 0xa2, 0x98, 0xb8, 0x7d, 0xff, 0x94, 0x53, 0x14, 0x57,	\
+	0x54, 0x57, 0x7e, 0x5c, 0x8a, 0xb2, 0x11, 0xed, 0xef, 0xc8, 0x12, 0x2e, 0x6e, 0x2e, 0x2e, 0x6e,	\
+	0x2e, 0x6e, 0x76, 0x76, 0xbe, 0xbf, 0xd7, 0x37, 0x4c, 0x11, 0xee, 0x2e, 0x2e, 0x2d, 0xee, 0x2f,	\
+	0xc9, 0x17, 0x37, 0x3b, 0x37, 0x37, 0x37, 0x37, 0x3b, 0x5f, 0x37, 0x5f, 0x16, 0xf7, 0xe4, 0x7b,	\
+	0x08, 0x12, 0x2c, 0x20, 0x48, 0xb9, 0xb9, 0xb9, 0xd9, 0xd9, 0xb9, 0xb9, 0xb9, 0xba, 0xf7, 0xbf,	\
+	0x23, 0xdf, 0x92, 0x2e, 0x2e, 0x6e, 0x2c, 0x24, 0xec, 0x90, 0x40, 0x93, 0x75, 0xf3, 0xb3, 0xb3,	\
+	0x75, 0xe1, 0x1e, 0xc2, 0x45, 0xc5, 0x84, 0x09, 0xe4, 0x8b, 0x09, 0x3a, 0x12, 0x76, 0x76, 0x6e,	\
+	0x76, 0x76, 0x76, 0x76, 0x04, 0x20, 0x4f, 0x20, 0x4f, 0x20, 0x40, 0x91, 0x71, 0x61, 0x27, 0x66,	\
+	0xe6, 0xe7, 0x67, 0x66, 0xeb, 0x6b, 0xf5, 0x57, 0x39, 0x53, 0xd3, 0xd6, 0x9b, 0x5b, 0x1b, 0x5b,	\
+	0x17, 0xd6, 0x9a, 0x1b, 0x1f, 0xda, 0x1f, 0xdf, 0x1f, 0x1e, 0x9b, 0x5f, 0x1f, 0x1f, 0x1e, 0x82,	\
+	0xbd, 0x05, 0x9a, 0x0a, 0x15, 0x69, 0x7d, 0xb1, 0x7d, 0xb1, 0xb1, 0xb1, 0xb5, 0xb1, 0xb1, 0xb1,	\
+	0xb1, 0xa1, 0xb5, 0xb1, 0xf1, 0xb1, 0xfd, 0xf1, 0xe8, 0x28, 0x57, 0xf7, 0xf0, 0xa1, 0x42, 0x85,	\
+	0x5a, 0x5a, 0x5f, 0x4f, 0x5a, 0x68, 0x68, 0x6d, 0x6c, 0x6c, 0x68, 0x7a, 0x6c, 0x80, 0x7f, 0x6c,	\
+	0x7c, 0x80, 0x7a, 0x0a, 0x15, 0xfc, 0x2b, 0xd4, 0xd0, 0x59, 0x5a, 0x25, 0xa5, 0xa5, 0xb5, 0xf5,	\
+	0xf5, 0xa6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc8, 0x06, 0x86, 0x87, 0x07, 0xa7, 0xf6, 0xc7, 0xa8, 0x07,	\
+	0xa7, 0xa7, 0xf0, 0xaf, 0xf3, 0x41, 0x66, 0xa6, 0xa5, 0x36, 0xf3, 0x49, 0x12, 0x24, 0x4b, 0x50,	\
+	0x91, 0x4d, 0x4e, 0x22, 0x9a, 0x85, 0x38, 0x8a, 0x71, 0x6f, 0x71, 0x71, 0x71, 0x71, 0x12, 0xc5,	\
+	0x24, 0x4b, 0x34, 0x91, 0x22, 0x44, 0x89, 0x12, 0x28, 0x53, 0x8b, 0x88, 0xa7, 0x17, 0x17, 0x27,	\
+	0x17, 0x11, 0x21, 0xa4, 0x89, 0x12, 0x25, 0xa9, 0xf0, 0x28, 0x50, 0xa1, 0x22, 0x9c, 0x45, 0x38,	\
+	0xb9, 0x39, 0x38, 0xbf, 0xdc, 0x43, 0x49, 0x0d, 0xd4, 0x25, 0xf0, 0x24, 0x50, 0xa1, 0x42, 0x85,	\
+	0x0a, 0x71, 0x71, 0x71, 0x71, 0x14, 0xe4, 0xe2, 0xff, 0x12, 0xd4, 0x25, 0xa9, 0xf0, 0x24, 0x53,	\
+	0xde, 0x53, 0xdf, 0xc5, 0xc9, 0xc5, 0xc4, 0x53, 0x8b, 0x77, 0xf5, 0xfe, 0xe2, 0xe4, 0x95, 0xac,	\
+	0x6a, 0xb2, 0xb2, 0x0a, 0x22, 0xb2, 0xc2, 0xf2, 0xb2, 0xb3, 0x12, 0xf3, 0x52, 0x22, 0x22, 0xb2,	\
+	0xc2, 0xc2, 0xc2, 0xc3, 0x12, 0xf3, 0x13, 0x13, 0x72, 0xb2, 0xb2, 0xb2, 0x22, 0x0a, 0xc2, 0xb2,	\
+	0xb2, 0xc2, 0xf3, 0x12, 0xb2, 0x3a, 0xc2, 0x3a, 0x22, 0xb2, 0xc2, 0xb3, 0x13, 0x12, 0xf3, 0x52,	\
+	0xf2, 0x3b, 0x12, 0xb3, 0x12, 0xb2, 0xf3, 0x53, 0x13, 0x13, 0x12, 0xb3, 0x52, 0x3a, 0x0a, 0xc3,	\
+	0x12, 0xb2, 0x3a, 0xf2, 0xb3, 0x12, 0xf3, 0x53, 0x52, 0x0a, 0x3a, 0x3a, 0xb2, 0xb2, 0x0a, 0xb2,	\
+	0xb2, 0xb2, 0xf3, 0x12, 0xf2, 0x3a, 0x0a, 0xb2, 0x3a, 0xb2, 0xf2, 0xb2, 0xb3, 0x53, 0x52, 0xf2,	\
+	0xb7, 0x9a, 0x94, 0xd9, 0xcc, 0x21, 0x98, 0x43, 0x58, 0x86, 0xb6, 0xb1, 0x8e, 0x13, 0x1a, 0xbc,	\
+	0x26, 0x0c, 0x18, 0xfb, 0x98, 0xe1, 0xcc, 0xcc, 0xbf, 0x20, 0x40, 0x86, 0xb1, 0x8d, 0x6d, 0x5e,	\
+	0x1f, 0xb9, 0x8d, 0x5e, 0x8e, 0x13, 0x06, 0x38, 0x73, 0x33, 0x35, 0xb5, 0xb5, 0xb5, 0xb5, 0x48,	\
+	0x10, 0xd5, 0xd6, 0x31, 0xc3, 0xc3, 0xb7, 0xc3, 0xf7, 0xdb, 0xfb, 0x90, 0xd6, 0xcc, 0xcc, 0xd6,	\
+	0xd6, 0xd6, 0x21, 0xac, 0x60, 0xc6, 0xde, 0xaf, 0xdf, 0xef, 0xc3, 0xab, 0xf7, 0xe1, 0xc9, 0xcc,	\
+	0xd5, 0xcc, 0xd6, 0xd6, 0x21, 0xad, 0xab, 0xad, 0xb7, 0xad, 0xc3, 0xaa, 0x63, 0x87, 0x6f, 0xf1,	\
+	0xf8, 0xbf, 0x23, 0x20, 0x7e, 0x6e, 0x6a, 0x76, 0x6a, 0x6a, 0x76, 0x7e, 0x7e, 0x91, 0x7e, 0x7e,	\
+	0x6a, 0x76, 0x7e, 0x7e, 0x7e, 0x84, 0x7e, 0x7e, 0x7e, 0x91, 0x6e, 0x6a, 0x7e, 0x6a, 0x7e, 0x7e,	\
+	0x7e, 0x7e, 0x84, 0x91, 0x91, 0x6a, 0x6f, 0x6a, 0x6a, 0x7e, 0x7e, 0x76, 0x76, 0x76, 0x76, 0x7e,	\
+	0x6f, 0x76, 0x6f, 0x6f, 0x6f, 0x76, 0x76, 0x84, 0x7e, 0x94, 0x94, 0x76, 0x7e, 0x76, 0x6f, 0x76,	\
+	0x7e, 0x84, 0x84, 0x76, 0x91, 0x84, 0x6f, 0x76, 0x76, 0x6a, 0x76, 0x76, 0x6f, 0x84, 0x7e, 0x84,	\
+	0x84, 0xf0, 0xbb, 0x3f, 0x42, 0x3c, 0x37, 0xbb, 0x3f, 0x42, 0x4a, 0x4a, 0x27, 0x53, 0xef, 0x97,	\
+	0xfa, 0xfd, 0x8b, 0xfd, 0xbe, 0xdd, 0x05, 0xfa, 0x36, 0x76, 0x7e, 0xa5, 0xcb, 0xfd, 0xbe, 0xdd,	\
+	0x1f, 0x6f, 0xaf, 0x41, 0x7f, 0xa9, 0x7f, 0xb7, 0x47, 0xdb, 0xf3, 0xb3, 0xb3, 0xb2, 0x5f, 0xed,	\
+	0xf6, 0xfc, 0x97, 0xfb, 0x17, 0xfa, 0xec, 0xfd, 0xba, 0x3f, 0x25, 0xfa, 0x3f, 0x25, 0xcb, 0xf4,	\
+	0x7e, 0x4b, 0xfe, 0x7e, 0xdf, 0x9e, 0x8d, 0x9e, 0x82, 0xe5, 0xcb, 0x97, 0xe8, 0xe8, 0xe8, 0x2e,	\
+	0x5c, 0xb9, 0x72, 0xe6, 0x0b, 0xfe, 0x7f, 0x25, 0xfa, 0x0b, 0x97, 0xe8, 0x2f, 0xf9, 0xe8, 0xfc,	\
+	0xf9, 0x38, 0x62, 0x51, 0x51, 0x5d, 0x51, 0x51, 0x5d, 0x5d, 0x5c, 0x74, 0x5c, 0x5d, 0x69, 0x74,	\
+	0xf1, 0xba, 0x40, 0xf8, 0xfc, 0x7e, 0x3f, 0x1f, 0x8f, 0xc7, 0x25, 0x0f, 0x19, 0x0f, 0x19, 0xe9,	\
+	0x97, 0x8c, 0x8c, 0xf4, 0xfa, 0x6a, 0x25, 0xfd, 0x3e, 0x9a, 0x85, 0x15, 0x15, 0xd5, 0xd5, 0xd5,	\
+	0xc5, 0xd5, 0xd7, 0x47, 0x47, 0x45, 0xd7, 0x4f, 0xfe, 0xe9, 0xe3, 0x74, 0x74, 0xf1, 0xc3, 0xf8,	\
+	0xe1, 0xfc, 0x71, 0x9f, 0xfe, 0x33, 0xff, 0xcb, 0xcb, 0xcb, 0xc6, 0x4b, 0xfa, 0x7d, 0x3f, 0xff,	\
+	0xd3, 0x61, 0x61, 0x69, 0x10, 0x28, 0xc9, 0x03, 0xac, 0x64, 0x80, 0x81, 0xd6, 0xeb, 0x19, 0x99,	\
+	0x99, 0x19, 0xf5, 0xba, 0xc6, 0x66, 0x46, 0x48, 0x06, 0x7d, 0x63, 0x24, 0x04, 0x03, 0x2e, 0xb7,	\
+	0x5b, 0xac, 0x80, 0x68, 0x64, 0x69, 0xd6, 0xeb, 0x75, 0x8c, 0xcc, 0xfa, 0xc6, 0x66, 0x68, 0x08,	\
+	0x06, 0x7d, 0x6e, 0xb1, 0x99, 0x99, 0xa1, 0xa7, 0x58, 0xd0, 0xcc, 0xcd, 0x10, 0xcf, 0xac, 0x68,	\
+	0x66, 0x66, 0x66, 0x80, 0x66, 0x68, 0x68, 0x88, 0x68, 0x89, 0xb6, 0x48, 0x15, 0x01, 0x01, 0x00,	\
+	0xf6, 0xf6, 0xe0, 0xd8, 0xe0, 0xe0, 0xe0, 0xf6, 0xf7, 0x00, 0xf6, 0xf7, 0xe4, 0xf2, 0x38, 0x38,	\
+	0x40, 0x38, 0x3d, 0xbd, 0xbd, 0xb8, 0x3d, 0xb8, 0x38, 0x79, 0x1e, 0xdc, 0x1e, 0xde, 0xda, 0x5e,	\
+	0xe2, 0xc1, 0x3d, 0xb8, 0x3d, 0xc0, 0xbd, 0xbd, 0xbd, 0x82, 0x81, 0x7b, 0x73, 0x70, 0x70, 0x7b,	\
+	0x73, 0x7b, 0x7b, 0x73, 0x69, 0x69, 0x69, 0xf2, 0x79, 0x01, 0x02, 0x04, 0x09, 0xed, 0xcd, 0x11,	\
+	0x35, 0x2a, 0xbd, 0xf7, 0x1e, 0xfb, 0x27, 0x7f, 0xbf, 0xdf, 0x64, 0x71, 0x64, 0x55, 0x71, 0x71,	\
+	0x64, 0xef, 0xb2, 0x32, 0x32, 0x38, 0xb0, 0xaa, 0xf7, 0xd9, 0x19, 0x18, 0x59, 0x1c, 0x7b, 0xfd,	\
+	0xfe, 0xfb, 0x0b, 0x8b, 0x8b, 0x23, 0x8b, 0x23, 0x8b, 0x8f, 0x89, 0x91, 0x85, 0xc7, 0xc4, 0xc9,	\
+	0xe0, 0x64, 0x64, 0x61, 0x71, 0x64, 0x65, 0x61, 0x71, 0xf0, 0x78, 0x1c, 0x7c, 0x0c, 0x3e, 0x0d,	\
+	0xbc, 0x82, 0xe4, 0x03, 0xdc, 0x5f, 0x9a, 0x2f, 0xcd, 0xe4, 0x8b, 0x8b, 0xa6, 0x8b, 0x9b, 0x8b,	\
+	0xa6, 0xa6, 0xf5, 0xcd, 0x53, 0x57, 0xcd, 0xd3, 0x57, 0xd7, 0xdf, 0x5f, 0x5f, 0x5f, 0x5f, 0x5c,	\
+	0xbd, 0xf9, 0x1e, 0xe2, 0xe2, 0xdf, 0xe2, 0xe2, 0xe6, 0xe2, 0xe6, 0xe6, 0xe2, 0xfd, 0x73, 0x75,	\
+	0xf4, 0xd5, 0xf5, 0xf4, 0xd5, 0xf5, 0xf7, 0x35, 0xf5, 0xf6, 0x57, 0xd7, 0xd7, 0xcd, 0xca, 0xb6,	\
+	0x0a, 0x15, 0x5d, 0x75, 0x83, 0x75, 0x83, 0xa0, 0x2b, 0x04, 0x50, 0xab, 0xac, 0x1c, 0x1c, 0x11,	\
+	0x57, 0x58, 0x38, 0x39, 0x19, 0x18, 0x39, 0x62, 0xb0, 0x72, 0x32, 0xf0, 0xb0, 0x72, 0x32, 0x2a,	\
+	0x85, 0x0a, 0xc1, 0xc8, 0xc2, 0xc8, 0xc8, 0x15, 0x83, 0x85, 0x82, 0x2b, 0x23, 0x07, 0x08, 0x56,	\
+	0x10, 0xac, 0x2c, 0x2c, 0x1c, 0x8c, 0x84, 0x61, 0x12, 0x49, 0xf8, 0xbc, 0x5e, 0x2f, 0x2c, 0x9f,	\
+	0x97, 0xcb, 0x27, 0x27, 0x27, 0x3d, 0x27, 0x3f, 0x3d, 0x5d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x67,	\
+	0x67, 0x67, 0x89, 0x67, 0x67, 0xe5, 0xf1, 0x79, 0x64, 0xfc, 0x52, 0x7e, 0x59, 0x39, 0x39, 0x39,	\
+	0x3f, 0x44, 0x9c, 0xf4, 0xf5, 0x74, 0xf4, 0xf5, 0x9d, 0x9d, 0x9d, 0x75, 0xd5, 0x75, 0x9d, 0x75,	\
+	0x9e, 0xb9, 0x8a, 0xc5, 0xe5, 0xe5, 0xe6, 0x56, 0x75, 0xe5, 0xe6, 0x8e, 0x76, 0x56, 0x56, 0x76,	\
+	0x56, 0xd6, 0x8e, 0xd6, 0xd5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe6, 0x76, 0x76, 0x75, 0xe6, 0x76, 0x56,	\
+	0x76, 0x76, 0x89, 0x1c, 0xe2, 0x37, 0x99, 0x59, 0x57, 0x37, 0x99, 0x57, 0x99, 0x5a, 0x39, 0x59,	\
+	0x44, 0x72, 0xb3, 0x88, 0x95, 0x23, 0x2a, 0xab, 0x24, 0xd1, 0x11, 0x10, 0xcd, 0x11, 0x10, 0xcc,	\
+	0xd0, 0xd1, 0x01, 0x00, 0xd1, 0x11, 0x11, 0x11, 0x10, 0xd9, 0x49, 0x59, 0x04, 0xd1, 0x11, 0x1d,	\
+	0x11, 0x1d, 0x1d, 0x11, 0x11, 0x11, 0x10, 0xd0, 0xd0, 0xd1, 0x1d, 0x05, 0x1c, 0xd0, 0xd0, 0xd1,	\
+	0x05, 0x04, 0xd1, 0x04, 0xd1, 0x04, 0xd0, 0xd1, 0x1d, 0x05, 0x07, 0xf5, 0xa0, 0x47, 0xef, 0x1b,	\
+	0x7a, 0x4b, 0xd8, 0x34, 0xa1, 0x42, 0x84, 0x8a, 0x14, 0xdd, 0x28, 0x50, 0xa7, 0x21, 0x4e, 0x22,	\
+	0x9c, 0x9c, 0x9f, 0xef, 0xf5, 0xef, 0xc3, 0xd8, 0x37, 0xde, 0x37, 0xdf, 0xf0, 0x29, 0xf4, 0x28,	\
+	0x50, 0xa1, 0x42, 0x9c, 0x85, 0x37, 0x4a, 0x7f, 0xb7, 0x79, 0x39, 0x3f, 0xde, 0x3b, 0x18, 0xaf,	\
+	0xef, 0x37, 0xf7, 0x9b, 0xfb, 0xfd, 0xe0, 0xd8, 0xe0, 0xe0, 0xe6, 0xfe, 0xff, 0x79, 0xb9, 0x8b,	\
+	0x70, 0x7f, 0x4b, 0x70, 0x70, 0x70, 0x7f, 0x79, 0xbf, 0xbf, 0xdf, 0xef, 0x07, 0xf7, 0xfb, 0xc1,	\
+	0xc1, 0xc1, 0xfd, 0xfe, 0xf0, 0x73, 0x70, 0x70, 0x70, 0x7f, 0x78, 0x39, 0xbf, 0xbc, 0xdf, 0xdf,	\
+	0xef, 0xf7, 0x76, 0x47, 0xd3, 0x65, 0x5f, 0x65, 0x64, 0x32, 0xbe, 0xbe, 0xbe, 0xbe, 0xca, 0xbe,	\
+	0xfa, 0xca, 0xbc, 0x65, 0x95, 0x7d, 0x78, 0xcb, 0xeb, 0xeb, 0xea, 0xfb, 0x2b, 0x21, 0x97, 0xd6,	\
+	0x43, 0x2c, 0xac, 0x86, 0x0c, 0x19, 0x65, 0x51, 0x5a, 0x32, 0xd8, 0x65, 0x95, 0x95, 0x90, 0xc1,	\
+	0x88, 0x10, 0x1f, 0x57, 0xa9, 0xd4, 0xea, 0x75, 0x3a, 0x9d, 0xbe, 0xe7, 0x53, 0xb9, 0xd4, 0xea,	\
+	0x75, 0x7a, 0x9d, 0x4e, 0xe7, 0x57, 0xa9, 0xdb, 0x3f, 0xea, 0x75, 0x3a, 0x9d, 0x4e, 0xd9, 0xff,	\
+	0x6c, 0xff, 0xb7, 0xd5, 0xea, 0x1f, 0xf6, 0xfa, 0xa7, 0xe7, 0xfd, 0x53, 0xfe, 0xdf, 0x57, 0xb6,	\
+	0x65, 0xdb, 0x3f, 0xd5, 0xf8, 0x9c, 0x13, 0x54, 0x53, 0x53, 0x55, 0x35, 0x35, 0x35, 0x36, 0xb6,	\
+	0xb6, 0xb3, 0x53, 0x54, 0x55, 0x35, 0x34, 0x56, 0xb5, 0x36, 0xb4, 0x56, 0x21, 0x66, 0xa6, 0xa8,	\
+	0xa6, 0xad, 0x6c, 0x6a, 0x6d, 0x6a, 0x7d, 0x75, 0x33, 0x53, 0x53, 0x54, 0xd6, 0xb4, 0xd6, 0xb5,	\
+	0x36, 0xb6, 0xb5, 0x69, 0x4b, 0x08, 0xe5, 0x11, 0x22, 0x44, 0xa8, 0xf2, 0x39, 0x44, 0x6f, 0xb2,	\
+	0x88, 0x91, 0x1e, 0x54, 0x8e, 0x51, 0x12, 0x24, 0x4a, 0x91, 0x22, 0x3f, 0x2b, 0x38, 0xa9, 0x11,	\
+	0xe3, 0xc7, 0x91, 0xbe, 0x1e, 0x4c, 0x89, 0x12, 0xa5, 0x7e, 0x7d, 0x50, 0x97, 0xcc, 0x99, 0x32,	\
+	0x7f, 0x32, 0x64, 0xcb, 0x13, 0x27, 0xa5, 0xa4, 0x4c, 0xb7, 0xcc, 0x9f, 0xcf, 0x48, 0xb6, 0xf9,	\
+	0x6d, 0x2f, 0x9e, 0x91, 0x6d, 0x2d, 0x2d, 0x2d, 0x2d, 0x22, 0xc5, 0xb6, 0x3e, 0x7b, 0x05, 0xb6,	\
+	0x34, 0xb6, 0x38, 0x14, 0x04, 0x86, 0x03, 0xb2, 0x87, 0xd9, 0x42, 0xec, 0xf6, 0x40, 0x76, 0x50,	\
+	0xd0, 0xcf, 0xbb, 0x28, 0x7d, 0x94, 0x34, 0xc4, 0x2e, 0xd7, 0x69, 0x0c, 0xf9, 0x0d, 0x0d, 0x0c,	\
+	0xfb, 0xb4, 0x7c, 0x7d, 0xda, 0xed, 0x26, 0x37, 0x18, 0xe2, 0x0e, 0x1f, 0xd1, 0x2d, 0x3f, 0x3e,	\
+	0x1c, 0x3d, 0x75, 0x70, 0xab, 0xac, 0x1c, 0x1a, 0xe9, 0x69, 0x69, 0x69, 0xf0, 0xe1, 0xc3, 0xd7,	\
+	0x07, 0xae, 0x14, 0x28, 0x55, 0x70, 0xaf, 0xed, 0xcf, 0x92, 0x62, 0xe2, 0xe2, 0x62, 0xa2, 0xe2,	\
+	0x62, 0x62, 0xe2, 0xa2, 0xa2, 0xe2, 0x8a, 0xe2, 0x62, 0x62, 0xea, 0xea, 0x62, 0x8b, 0x4a, 0x8a,	\
+	0x8a, 0xe1, 0xf2, 0xea, 0x8d, 0xde, 0xb1, 0x0e, 0xde, 0xb6, 0xdf, 0x0e, 0xdf, 0x0e, 0xaf, 0x0f,	\
+	0xe3, 0xef, 0xc3, 0xc3, 0xf8, 0xd6, 0xe1, 0xe1, 0xdb, 0xd5, 0xe1, 0xe1, 0xfc, 0x70, 0x98, 0xdb,	\
+	0xe7, 0xfb, 0xe2, 0x70, 0x85, 0x59, 0x79, 0x59, 0x79, 0x89, 0x79, 0xbd, 0x79, 0xa9, 0xbd, 0xd9,	\
+	0xbd, 0xa9, 0x05, 0x79, 0x79, 0x5b, 0xbc, 0xac, 0xd4, 0xbc, 0xd4, 0xbc, 0xbc, 0xec, 0xcd, 0x99,	\
+	0x10, 0x83, 0x93, 0x93, 0xa3, 0xa3, 0x93, 0xa3, 0x93, 0xa3, 0x93, 0x93, 0x93, 0xa3, 0x93, 0xa3,	\
+	0xa3, 0xb3, 0xb3, 0xa3, 0xa3, 0xa3, 0xa3, 0xc3, 0xb3, 0xa3, 0xc3, 0xb6, 0xd2, 0x1b, 0x97, 0x97,	\
+	0xa1, 0x91, 0x91, 0x82, 0x43, 0x43, 0x64, 0xb9, 0x02, 0xf9, 0x79, 0x19, 0x1a, 0x19, 0x7b, 0x3a,	\
+	0x1a, 0x05, 0xcb, 0x97, 0x31, 0xd0, 0xe6, 0x84, 0x8e, 0xf2, 0x42, 0x42, 0xba, 0x42, 0xba, 0x42,	\
+	0x42, 0xb8, 0x14, 0x85, 0x75, 0x75, 0x70, 0x29, 0x00, 0x55, 0xd6, 0x56, 0x56, 0x58, 0xc0, 0xcf,	\
+	0x31, 0x30, 0x68, 0xd1, 0xb8, 0xb9, 0xb9, 0xa3, 0x46, 0x8b, 0x1a, 0x36, 0xf4, 0x69, 0x21, 0xa4,	\
+	0x86, 0x8d, 0x1b, 0x7a, 0x34, 0x68, 0xd2, 0x5d, 0xa8, 0x68, 0xff, 0x8f, 0x7f, 0xe3, 0xd3, 0xd3,	\
+	0xdf, 0xf8, 0xf4, 0x00, 0x03, 0xb0, 0x00, 0x00, 0x00, 0xff, 0x8f, 0x40, 0x00, 0x3d, 0x00, 0x00,	\
+	0x02, 0x15, 0x7c, 0x62, 0x00, 0xe1, 0xc3, 0x87, 0x14, 0x1e, 0xa8, 0x55, 0x50, 0x70, 0xf2, 0xc1,	\
+	0xe4, 0x03, 0x87, 0x14, 0x1c, 0x50, 0xaa, 0x71, 0x5b, 0xf0, 0x08, 0x3c, 0x8e, 0x7e, 0x4f, 0x20,	\
+	0x48, 0x10, 0x81, 0x02, 0x4e, 0x84, 0x73, 0x09, 0xe4, 0xf2, 0x04, 0x7b, 0x08, 0x12, 0x77, 0xcf,	\
+	0x25, 0xe0, 0x8a, 0xc3, 0xb3, 0xd9, 0xec, 0xf6, 0x7b, 0x5d, 0x9e, 0xcf, 0x6b, 0xb5, 0xda, 0xed,	\
+	0x1f, 0x76, 0xbb, 0x47, 0xdd, 0xae, 0xd7, 0x68, 0xf8, 0xfb, 0xd0, 0xe7, 0xc2, 0x0a, 0x72, 0xb2,	\
+	0xb2, 0xf2, 0x77, 0x79, 0x3b, 0xbc, 0x94, 0x9c, 0x82, 0x94, 0x94, 0x91, 0xde, 0x4a, 0xef, 0x6f,	\
+	0xfc, 0xc3, 0xf3, 0xb3, 0x76, 0x53, 0xb5, 0xf5, 0xf5, 0xf6, 0x55, 0xbe, 0x79, 0xd9, 0xda, 0xf9,	\
+	0xda, 0xfa, 0xdb, 0x6a, 0xd7, 0x54, 0xc1, 0xf9, 0x30, 0x63, 0xf3, 0xf9, 0xe8, 0xe8, 0xe8, 0xe8,	\
+	0xfc, 0xfe, 0x7e, 0xe6, 0x3f, 0x3f, 0x7f, 0xcd, 0x9a, 0x18, 0x30, 0xb2, 0x30, 0xb0, 0xb0, 0x73,	\
+	0x30, 0xb0, 0xb0, 0x70, 0xb0, 0xb3, 0x2f, 0xf0, 0xaf, 0xf3, 0x3e, 0x1a, 0x43, 0x08, 0xe8, 0xe5,	\
+	0x11, 0x23, 0xa2, 0x47, 0x68, 0x8e, 0x51, 0x1d, 0xac, 0xe2, 0x24, 0x48, 0xbd, 0x22, 0x4b, 0xc5,	\
+	0xdf, 0x71, 0x71, 0xf1, 0x78, 0x99, 0x1c, 0x5f, 0x5c, 0x7b, 0xec, 0x8e, 0x2c, 0x9e, 0x2e, 0x58,	\
+	0x02, 0xd1, 0xd1, 0xd7, 0x95, 0x90, 0x51, 0xd5, 0x91, 0xd1, 0xd7, 0x90, 0x55, 0x91, 0xd7, 0x91,	\
+	0x09, 0x1f, 0x71, 0x57, 0xb8, 0xaa, 0xaa, 0xab, 0xdc, 0xee, 0x2a, 0xf7, 0x13, 0x55, 0x5c, 0x85,	\
+	0x03, 0x2e, 0xaf, 0x54, 0xc8, 0xcb, 0xad, 0xd5, 0x40, 0xea, 0xf5, 0x4c, 0x8c, 0xa2, 0x89, 0x41,	\
+	0x61, 0x61, 0xb9, 0xb9, 0x89, 0xb9, 0xb9, 0xb9, 0x89, 0xb9, 0xb9, 0x8b, 0x3c, 0xc6, 0x43, 0x45,	\
+	0x8d, 0x16, 0x36, 0xf6, 0xf6, 0xf4, 0x68, 0xd1, 0x63, 0x76, 0xc6, 0x64, 0xb6, 0xe0, 0xe0, 0x09,	\
+	0xc1, 0xed, 0x6d, 0xc0, 0x13, 0x83, 0xdb, 0x87, 0x78, 0x50, 0x00, 0x84, 0x86, 0x01, 0x0c, 0x00,	\
+	0x00, 0x08, 0x7d, 0x9e, 0xc8, 0x0f, 0xa4, 0x66, 0x40, 0x9c, 0xdc, 0x01, 0x02, 0x04, 0x09, 0xec,	\
+	0x10, 0x20, 0x4e, 0x7f, 0xf0, 0x23, 0x3e, 0x3e, 0xed, 0x76, 0xbb, 0x5d, 0xa3, 0xe3, 0xee, 0xd7,	\
+	0x68, 0xf8, 0xf9, 0x1b, 0x12, 0x3e, 0xbf, 0x6f, 0xb7, 0xdb, 0xed, 0xf5, 0xfa, 0x97, 0xfb, 0x7d,	\
+	0x9d, 0xea, 0x09, 0x9f, 0x14, 0x28, 0x38, 0x70, 0xf3, 0xf5, 0x42, 0x83, 0xf2, 0xc4, 0x12, 0xac,	\
+	0xd4, 0xac, 0xec, 0xbc, 0xde, 0xbc, 0xbc, 0xd4, 0xdf, 0xaf, 0xb0, 0x27, 0x74, 0xa9, 0x5f, 0xdf,	\
+	0xec, 0xaf, 0x29, 0x52, 0xa5, 0x5f, 0x90, 0x89, 0xc5, 0x93, 0xc1, 0xe0, 0x71, 0x71, 0x64, 0x75,	\
+	0xf0, 0x36, 0x23, 0x0e, 0x2c, 0xac, 0xbe, 0x06, 0x1f, 0x03, 0x2b, 0x0d, 0x8e, 0x90, 0x75, 0x41,	\
+	0xf0, 0xb0, 0x45, 0x0a, 0xaa, 0xc1, 0xf3, 0xd4, 0x63, 0x87, 0xf3, 0xf8, 0xfb, 0xfd, 0xf8, 0x78,	\
+	0x7e, 0xff, 0x4e, 0x80, 0x75, 0xb5, 0xf7, 0xd6, 0x53, 0xb3, 0xb5, 0xf5, 0xfb, 0xd0, 0x63, 0xb3,	\
+	0xd9, 0xec, 0xf6, 0x40, 0x76, 0x7b, 0x28, 0x68, 0x51, 0x0e, 0xa7, 0x53, 0xa9, 0xdc, 0xea, 0x77,	\
+	0x0b, 0x50, 0x2c, 0xfd, 0x9f, 0xb6, 0x86, 0xcf, 0xda, 0xfe, 0x52, 0x02, 0x2f, 0xef, 0xc4, 0x5a,	\
+	0x5b, 0xed, 0xea, 0x04, 0x4c, 0x89, 0x52, 0x24, 0x48, 0xf0, 0x70, 0x24, 0x35, 0x45, 0x05, 0x05,	\
+	0x05, 0x47, 0x63, 0x02, 0x5b, 0xd1, 0x2d, 0x2d, 0xce, 0xce, 0xeb, 0x85, 0x7f, 0x65, 0x7f, 0x7f,	\
+	0xbf, 0xd9, 0x5e, 0x5f, 0xdf, 0x2f, 0x2f, 0xf3, 0x8f, 0x97, 0xf9, 0xbf, 0xfc, 0xdf, 0xdf, 0xfe,	\
+	0x7f, 0x7f, 0x9f, 0xce, 0x6e, 0x6f, 0xe7, 0xf7, 0xfb, 0xfd, 0x6c, 0xf3, 0x4d, 0x16, 0x1e, 0x1d,	\
+	0xc5, 0xc5, 0xc6, 0x36, 0x35, 0xc6, 0x3d, 0xc6, 0x3e, 0x30, 0x9b, 0xbb, 0xbb, 0xb1, 0x37, 0x78,	\
+	0xa3, 0x71, 0x71, 0x7f, 0x8a, 0x9f, 0xe5, 0xfd, 0xf2, 0xfe, 0xff, 0x9c, 0xbb, 0xfb, 0xfb, 0xe6,	\
+	0xf2, 0xfa, 0x9d, 0x5e, 0xa7, 0x57, 0xab, 0xd5, 0x3f, 0x84, 0x97, 0xd5, 0x32, 0x32, 0xeb, 0x75,	\
+	0xba, 0xc6, 0x70, 0xa5, 0x67, 0xe7, 0xe6, 0x48, 0x06, 0x46, 0x46, 0x77, 0x82, 0xfa, 0xc8, 0x86,	\
+	0x88, 0x26, 0x86, 0x86, 0xd7, 0x92, 0xb4, 0x43, 0x44, 0x73, 0x43, 0x43, 0x54, 0x1a, 0x7b, 0x97,	\
+	0xfa, 0xff, 0x72, 0x7f, 0xbf, 0xdc, 0x9c, 0x9f, 0x6a, 0x93, 0xbf, 0xcd, 0xcd, 0xfd, 0xfe, 0xf8,	\
+	0x04, 0x9f, 0x76, 0xbb, 0x3d, 0xa3, 0xef, 0xb4, 0xe7, 0x6d, 0x6d, 0x6d, 0x6c, 0x68, 0x2e, 0xaf,	\
+	0x53, 0xa9, 0xba, 0x72, 0xbe, 0x19, 0x7c, 0x8b, 0x61, 0x55, 0x91, 0x1f, 0xb8, 0xcf, 0xd9, 0xb5,	\
+	0xa0, 0x61, 0x60, 0xdc, 0xd0, 0x33, 0x33, 0x35, 0xfb, 0x81, 0x12, 0x3c, 0x00, 0x42, 0x43, 0xef,	\
+	0xf9, 0x3c, 0x38, 0x16, 0xc3, 0xad, 0x87, 0x0e, 0xf7, 0x0e, 0xd2, 0xf9, 0x6c, 0x69, 0x6c, 0x3f,	\
+	0x72, 0x27, 0x6d, 0x9d, 0x9e, 0x26, 0x25, 0x9e, 0x26, 0x26, 0x26, 0x7e, 0x26, 0x7e, 0x7e, 0xec,	\
+	0x6d, 0x9b, 0x09, 0x37, 0x37, 0x37, 0x37, 0xeb, 0xaf, 0xb9, 0xf5, 0xd7, 0xd7, 0xc7, 0x4d, 0x6c,	\
+	0x2c, 0xc2, 0x1a, 0xc4, 0x08, 0x10, 0x20, 0x63, 0x5b, 0xff, 0xe7, 0xad, 0x61, 0x61, 0x61, 0x61,	\
+	0xff, 0xf0, 0x30, 0x2c, 0x30, 0x30, 0x2f, 0x68, 0x7e, 0xff, 0x27, 0x27, 0x5b, 0x27, 0x27, 0x57,	\
+	0x57, 0x56, 0x8a, 0x19, 0x7a, 0x34, 0x97, 0xbc, 0x91, 0x22, 0x5e, 0xfa, 0x35, 0xb3, 0x8b, 0x8b,	\
+	0x93, 0x93, 0x8b, 0xfd, 0xfe, 0xff, 0x3a, 0x95, 0xe0, 0xe8, 0x68, 0x64, 0x68, 0x68, 0x68, 0x3d,	\
+	0x75, 0x3d, 0xf7, 0x17, 0x1f, 0x2f, 0x94, 0x58, 0x4a, 0xaf, 0x73, 0xbf, 0xdf, 0x64, 0xcc, 0x12,	\
+	0x75, 0xd8, 0x02, 0x04, 0xe5, 0x1d, 0xa7, 0xf5, 0xfb, 0x7d, 0xbe, 0xcf, 0x69, 0x3c, 0xbc, 0xfc,	\
+	0xfc, 0x47, 0x74, 0x98, 0xab, 0xa1, 0x42, 0x9d, 0xb0, 0xfa, 0x0b, 0xfe, 0x7a, 0x38, 0xf9, 0xcc,	\
+	0x50, 0xa1, 0x55, 0x5a, 0xb2, 0x1d, 0xad, 0xcd, 0xad, 0xe6, 0xcc, 0x87, 0x73, 0x6b, 0xeb, 0xb9,	\
+	0xdd, 0xc8, 0x6f, 0x6f, 0x7e, 0x47, 0xbc, 0x31, 0x93, 0x52, 0xf3, 0x7e, 0x7a, 0x0b, 0xde, 0x34,	\
+	0x6f, 0x87, 0xec, 0x5f, 0x3f, 0x9e, 0xc5, 0xe2, 0x08, 0x86, 0x9a, 0xea, 0xc2, 0xf2, 0xc4, 0x7c,	\
+	0x30, 0x38, 0x7f, 0x58, 0x3c, 0x48, 0x92, 0x42, 0xfe, 0x2b, 0x4e, 0x6c, 0xb8, 0x1e, 0x53, 0x66,	\
+	0x5d, 0xa4, 0xaf, 0xc7, 0xaf, 0xe0, 0x00
+
+#endif  //  PHOTO_HUFF_H_INCLUDED
+
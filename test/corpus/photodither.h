@@ -0,0 +1,146 @@
+/*
+ *  ST7735 Command Set Encoded Image
+ *  Encoder by Tim Williams, 2018-12-29
+ *  Original: photodither.png
+ */
+
+#ifndef PHOTODITHER_H_INCLUDED
+#define PHOTODITHER_H_INCLUDED
+
+#define PHOTODITHER_MAGIC_NUMBER	0x371e5453
+#define PHOTODITHER_WIDTH		100
+#define PHOTODITHER_HEIGHT		80
+#define PHOTODITHER_CMD_LEN		8075	/*  Number of command bytes  */
+#define PHOTODITHER_PALETTE_LEN		512	/*  Number of bytes (2 * colors) (0 --&gt; 256 colors)  */
+#define PHOTODITHER_TOTAL_LEN		8588	/*  Total array size  */
+
+#define PHOTODITHER_PAL		\
+	0x62, 0x08,	0x60, 0x08,	0x41, 0x18,	0x43, 0x20,		\
+	0x63, 0x30,	0x44, 0x40,	0xa5, 0x38,	0x45, 0x50,		\
+	0xa6, 0x48,	0x86, 0x58,	0x46, 0x68,	0x87, 0x60,		\
+	0x48, 0x70,	0x88, 0x78,	0x29, 0x88,	0xa9, 0x78,		\
+	0x69, 0xa0,	0x2b, 0xa8,	0xca, 0x98,	0x8b, 0xa0,		\
+	0x6b, 0xb8,	0x8d, 0xb8,	0x8d, 0xc8,	0x4d, 0xc8,		\
+	0x84, 0x28,	0xe5, 0x28,	0xaa, 0x88,	0xcb, 0xa8,		\
+	0xcc, 0xb8,	0xc2, 0x18,	0xe9, 0x70,	0xeb, 0x90,		\
+	0xc4, 0x18,	0xe5, 0x40,	0xe8, 0x60,	0xe9, 0x80,		\
+	0xed, 0xa8,	0xed, 0xc8,	0x03, 0x09,	0xe3, 0x28,		\
+	0xe1, 0x00,	0x07, 0x51,	0x4c, 0x91,	0xed, 0xb8,		\
+	0xef, 0xc8,	0xe6, 0x60,	0x49, 0x69,	0x25, 0x31,		\
+	0x4c, 0xa9,	0x84, 0x29,	0x26, 0x41,	0x27, 0x61,		\
+	0x4a, 0x71,	0x2a, 0x81,	0x4e, 0xb1,	0x44, 0x19,		\
+	0x4b, 0x99,	0x4d, 0xa1,	0x66, 0x21,	0x88, 0x49,		\
+	0x6a, 0x89,	0x2e, 0xc9,	0x83, 0x11,	0x42, 0x09,		\
+	0x49, 0x79,	0xb0, 0xc1,	0x89, 0x59,	0xcb, 0x71,		\
+	0x85, 0x31,	0x87, 0x31,	0x87, 0x59,	0xab, 0x81,		\
+	0xaf, 0xa9,	0x87, 0x41,	0x87, 0x49,	0xad, 0xa1,		\
+	0xae, 0xc1,	0xa4, 0x09,	0xe5, 0x19,	0xc6, 0x29,		\
+	0xac, 0x99,	0xb0, 0xd1,	0x07, 0x3a,	0xa9, 0x69,		\
+	0xcd, 0x89,	0xca, 0x61,	0xcd, 0xb1,	0xe5, 0x09,		\
+	0xc8, 0x49,	0x0c, 0x7a,	0x0f, 0xba,	0x09, 0x52,		\
+	0x0a, 0x72,	0x11, 0xca,	0x08, 0x3a,	0x2d, 0xa2,		\
+	0x2f, 0xa2,	0x10, 0xc2,	0x45, 0x22,	0x27, 0x32,		\
+	0x48, 0x4a,	0x2d, 0x92,	0x03, 0x0a,	0x27, 0x1a,		\
+	0x2b, 0x82,	0x2c, 0x92,	0x6a, 0x6a,	0x6d, 0x82,		\
+	0x69, 0x52,	0x65, 0x0a,	0x4b, 0x62,	0x71, 0xba,		\
+	0x70, 0xc2,	0x6f, 0xb2,	0x87, 0x2a,	0x8a, 0x5a,		\
+	0x8c, 0x72,	0x8f, 0xa2,	0xa6, 0x1a,	0xac, 0x62,		\
+	0x8e, 0xa2,	0x92, 0xd2,	0xc7, 0x12,	0xa9, 0x3a,		\
+	0x88, 0x3a,	0x8d, 0x7a,	0x8e, 0x92,	0xb1, 0xc2,		\
+	0xca, 0x4a,	0xd1, 0xb2,	0x11, 0xcb,	0xec, 0x6a,		\
+	0xed, 0x72,	0xe5, 0x0a,	0xe8, 0x32,	0x0b, 0x4b,		\
+	0xcd, 0x8a,	0x0f, 0x93,	0x10, 0xa3,	0xef, 0xa2,		\
+	0xe8, 0x22,	0x07, 0x1b,	0xe9, 0x42,	0x0c, 0x5b,		\
+	0xf2, 0xca,	0x48, 0x1b,	0x0a, 0x33,	0x2d, 0x63,		\
+	0x4d, 0x73,	0x11, 0xbb,	0x27, 0x0b,	0x2d, 0x7b,		\
+	0x0f, 0x8b,	0x12, 0xb3,	0x51, 0xab,	0x49, 0x23,		\
+	0x70, 0x9b,	0x68, 0x33,	0x6a, 0x43,	0x4a, 0x4b,		\
+	0x6f, 0x83,	0x6c, 0x63,	0x6f, 0x9b,	0x53, 0xcb,		\
+	0x72, 0xb3,	0xae, 0x73,	0x86, 0x13,	0x8a, 0x33,		\
+	0x8c, 0x53,	0xd1, 0x93,	0x8c, 0x43,	0x8d, 0x6b,		\
+	0x90, 0x8b,	0xb2, 0xc3,	0xa8, 0x13,	0xae, 0x5b,		\
+	0xcf, 0x7b,	0xef, 0x8b,	0xb2, 0xa3,	0xc9, 0x2b,		\
+	0xb1, 0xb3,	0x94, 0xd3,	0xc9, 0x1b,	0xe8, 0x03,		\
+	0xcb, 0x43,	0xd1, 0xa3,	0xee, 0x6b,	0xd3, 0xb3,		\
+	0xf4, 0xcb,	0x0b, 0x3c,	0x0d, 0x5c,	0x0e, 0x74,		\
+	0x15, 0xd4,	0x2c, 0x4c,	0x2a, 0x14,	0x2a, 0x24,		\
+	0x29, 0x14,	0x70, 0x8c,	0x30, 0x7c,	0x33, 0x9c,		\
+	0x33, 0xc4,	0x2c, 0x34,	0x71, 0x9c,	0x52, 0xa4,		\
+	0x53, 0xb4,	0x54, 0xac,	0x35, 0xc4,	0x4e, 0x54,		\
+	0x89, 0x0c,	0x2d, 0x44,	0x4e, 0x64,	0x6b, 0x34,		\
+	0x6f, 0x74,	0x95, 0xd4,	0xaa, 0x24,	0x8e, 0x4c,		\
+	0xae, 0x5c,	0x91, 0x74,	0x94, 0xbc,	0x8c, 0x44,		\
+	0x8f, 0x5c,	0x90, 0x6c,	0xb1, 0x8c,	0x8b, 0x14,		\
+	0xac, 0x24,	0xb3, 0xa4,	0xcb, 0x34,	0xd2, 0x84,		\
+	0xd3, 0x94,	0xac, 0x34,	0xce, 0x3c,	0xb5, 0xbc,		\
+	0xca, 0x0c,	0xf0, 0x6c,	0xd6, 0xc4,	0xd5, 0xa4,		\
+	0xf5, 0xb4,	0xee, 0x4c,	0x2f, 0x55,	0x31, 0x7d,		\
+	0x13, 0xa5,	0x34, 0xb5,	0x2b, 0x0d,	0x2a, 0x1d,		\
+	0x0d, 0x2d,	0x2c, 0x1d,	0xf0, 0x5c,	0x17, 0xcd,		\
+	0x4d, 0x3d,	0x2e, 0x3d,	0x32, 0x7d,	0x33, 0x95,		\
+	0x55, 0xa5,	0x56, 0xc5,	0x51, 0x65,	0x12, 0x6d
+
+#define PHOTODITHER_CMDS		\
+	0x05, 238, 33, 78, 4, 2,		\
+	0x07, 4, 101, 70, 29, 2, 4,		\
+	42, 67, 15, 3, 3,		\
+	34, 43, 9, 3, 3,		\
+	109, 0, 32, 2, 5,		\
+	0x02, 251, 67, 79, 7,		\
+	0x02, 248, 21, 78, 7,		\
+	0x02, 14, 64, 0, 7,		\
+	0x03, 213, 99, 65, 7,		\
+	0x03, 186, 47, 57, 7,		\
+	0x15, 2, 0, 41, 78,		\
+		2, 0, 2, 1, 0, 40, 0, 0, 29, 38, 32, 38, 38, 55, 38, 55, 62, 62, 55, 63, 77, 49, 87, 78, 102, 87, 102, 78, 78, 118, 109, 109, 118, 87, 109, 122, 109, 103, 133, 109, 122, 133, 118, 141, 150, 150, 150, 150, 166, 150, 174, 174, 145, 183, 174, 174, 196, 174, 183, 194, 196, 214, 183, 194, 194, 214, 223, 232, 232, 194, 242, 245, 232, 223, 232, 243, 242, 242, 0, 2, 1, 2, 29, 0, 29, 29, 29, 38, 38, 29, 38, 38, 38, 77, 55, 55, 62, 55, 78, 62, 77, 49, 62, 102, 87, 87, 109, 102, 103, 78, 103, 118, 103, 109, 109, 103, 122, 122, 141, 122, 150, 133, 150, 140, 122, 150, 174, 150, 150, 174, 150, 145, 174, 182, 174, 182, 182, 183, 196, 174, 196, 196, 182, 194, 196, 214, 194, 223, 223, 232, 232, 245, 232, 245, 232, 245, 0, 0, 0, 29, 0, 39, 29, 32, 32, 38, 38, 62, 32, 38, 55, 38, 62, 77, 77, 77, 77, 87, 78, 102, 98, 87, 78, 87, 87, 103, 87, 109, 109, 98, 109, 103, 122, 122, 109, 122, 133, 145, 118, 141, 150, 118, 133, 166, 145, 145, 182, 145, 145, 183, 174, 166, 182, 174, 174, 183, 195, 196, 208, 194, 195, 208, 196, 232, 223, 223, 223, 208, 214, 224, 223, 243, 242, 245, 2, 3, 2, 29, 29, 0, 1, 32, 29, 29, 29, 29, 38, 38, 55, 62, 55, 55, 77, 55, 55, 87, 58, 77, 78, 78, 77, 78, 77, 78, 78, 98, 118, 122, 103, 133, 109, 122, 140, 122, 150, 122, 140, 122, 150, 145, 150, 140, 150, 155, 183, 145, 174, 182, 174, 196, 182, 182, 208, 183, 196, 194, 196, 196, 196, 194, 195, 223, 223, 223, 232, 232, 243, 243, 242, 223, 245, 243, 2, 0, 0, 0, 0, 29, 39, 0, 32, 38, 58, 39, 38, 39, 38, 55, 55, 55, 62, 49, 87, 87, 87, 49, 78, 87, 109, 49, 98, 109, 98, 87, 103, 109, 118, 103, 118, 109, 118, 122, 114, 150, 141, 118, 122, 114, 150, 145, 145, 150, 155, 179, 174, 174, 194, 174, 194, 182, 196, 174, 182, 179, 196, 196, 194, 195, 214, 194, 194, 214, 214, 223, 223, 214, 223, 243, 245, 243, 3, 3, 0, 24, 32, 29, 29, 38, 32, 32, 32, 63, 38, 49, 55, 78, 32, 62, 87, 62, 58, 87, 58, 103, 87, 98, 87, 78, 87, 78, 109, 122, 98, 103, 109, 118, 118, 122, 118, 118, 122, 114, 141, 118, 141, 141, 146, 122, 145, 145, 150, 140, 155, 174, 145, 196, 174, 182, 196, 194, 196, 195, 195, 214, 195, 194, 196, 223, 201, 224, 223, 223, 214, 224, 214, 243, 243, 244, 3, 3, 3, 32, 29, 32, 39, 29, 32, 29, 24, 32, 63, 55, 32, 55, 49, 58, 49, 78, 77, 58, 62, 55, 79, 78, 103, 103, 79, 103, 98, 79, 114, 98, 98, 118, 122, 122, 118, 118, 118, 118, 118, 150, 140, 141, 166, 140, 155, 174, 155, 179, 174, 182, 174, 182, 179, 174, 182, 179, 182, 194, 182, 196, 208, 195, 223, 223, 223, 232, 211, 243, 223, 243, 243, 224, 214, 242, 3, 2, 3, 1, 3, 0, 3, 29, 32, 32, 32, 32, 39, 32, 55, 55, 55, 55, 55, 49, 78, 78, 49, 98, 49, 103, 103, 79, 87, 78, 103, 109, 109, 79, 118, 103, 103, 118, 145, 118, 141, 141, 141, 140, 145, 141, 141, 141, 141, 145, 182, 145, 166, 155, 174, 155, 182, 194, 194, 155, 194, 182, 201, 194, 195, 214, 223, 195, 223, 195, 243, 223, 245, 223, 214, 224, 243, 248, 2, 3, 3, 3, 29, 3, 25, 29, 39, 38, 47, 32, 55, 38, 25, 49, 38, 58, 78, 62, 78, 49, 78, 58, 98, 87, 98, 78, 78, 98, 98, 103, 98, 103, 114, 122, 122, 118, 118, 140, 140, 140, 114, 140, 141, 157, 141, 145, 140, 145, 145, 145, 157, 174, 174, 182, 182, 179, 182, 182, 211, 194, 195, 195, 182, 224, 195, 194, 226, 224, 224, 214, 243, 211, 245, 223, 243, 244, 3, 3, 29, 29, 3, 24, 32, 39, 32, 39, 39, 55, 32, 49, 55, 49, 58, 32, 68, 49, 78, 68, 78, 68, 98, 79, 98, 79, 114, 103, 98, 98, 103, 103, 118, 118, 114, 114, 140, 103, 141, 118, 140, 155, 145, 140, 141, 145, 145, 155, 157, 145, 179, 179, 155, 179, 179, 174, 194, 182, 196, 179, 211, 194, 195, 223, 224, 223, 214, 226, 223, 214, 224, 245, 224, 245, 245, 243, 2, 3, 3, 3, 29, 32, 39, 24, 25, 32, 29, 55, 25, 32, 49, 55, 49, 68, 58, 62, 58, 62, 69, 98, 77, 79, 79, 98, 78, 99, 103, 99, 103, 99, 118, 103, 99, 140, 123, 141, 114, 141, 140, 122, 146, 140, 145, 155, 145, 179, 182, 182, 155, 179, 195, 155, 195, 167, 179, 179, 195, 195, 208, 211, 223, 211, 211, 195, 226, 223, 211, 232, 211, 214, 224, 243, 244, 248, 3, 3, 29, 3, 25, 24, 39, 32, 24, 29, 24, 29, 25, 32, 25, 25, 58, 49, 79, 49, 79, 79, 58, 58, 98, 79, 103, 79, 98, 98, 103, 114, 103, 99, 98, 124, 122, 103, 114, 141, 134, 140, 140, 146, 145, 140, 157, 157, 134, 155, 155, 157, 179, 155, 182, 155, 179, 155, 182, 195, 195, 195, 195, 195, 189, 224, 224, 211, 224, 211, 226, 224, 224, 243, 244, 245, 245, 243, 3, 4, 4, 3, 39, 29, 39, 39, 39, 39, 39, 49, 55, 25, 49, 25, 49, 55, 49, 79, 78, 49, 98, 68, 68, 79, 99, 79, 99, 98, 99, 98, 124, 118, 114, 134, 124, 114, 146, 114, 140, 123, 140, 155, 140, 140, 157, 157, 155, 167, 155, 179, 179, 155, 167, 179, 167, 194, 201, 201, 182, 195, 201, 211, 201, 194, 194, 214, 214, 214, 224, 226, 243, 229, 244, 226, 226, 248, 3, 3, 3, 3, 4, 24, 3, 39, 25, 39, 49, 24, 25, 39, 55, 69, 55, 68, 55, 58, 68, 69, 49, 58, 58, 103, 79, 79, 103, 98, 114, 99, 99, 99, 114, 99, 99, 141, 134, 114, 140, 140, 134, 140, 134, 157, 145, 140, 145, 157, 157, 145, 167, 167, 182, 182, 167, 167, 182, 195, 189, 195, 195, 179, 224, 201, 195, 201, 211, 224, 224, 224, 224, 229, 226, 244, 245, 244, 4, 24, 24, 24, 24, 39, 24, 39, 32, 25, 29, 32, 49, 47, 47, 47, 49, 58, 58, 47, 79, 79, 79, 69, 103, 79, 79, 99, 99, 79, 99, 98, 94, 114, 114, 94, 103, 123, 140, 114, 114, 146, 146, 134, 140, 146, 146, 155, 155, 146, 145, 167, 155, 189, 167, 182, 201, 167, 167, 201, 182, 201, 195, 189, 194, 195, 189, 211, 224, 226, 229, 224, 226, 229, 244, 214, 244, 248, 3, 3, 25, 29, 39, 24, 4, 24, 49, 6, 47, 25, 49, 25, 39, 68, 79, 50, 68, 69, 58, 58, 69, 79, 58, 99, 99, 79, 79, 98, 99, 114, 124, 98, 124, 124, 114, 140, 134, 134, 123, 134, 157, 141, 155, 157, 157, 157, 167, 167, 157, 157, 155, 155, 167, 167, 195, 182, 195, 211, 201, 179, 195, 211, 201, 211, 224, 214, 211, 211, 219, 229, 229, 229, 244, 244, 244, 244, 3, 4, 4, 5, 24, 24, 25, 4, 25, 24, 47, 39, 25, 39, 47, 25, 68, 49, 58, 68, 69, 82, 68, 69, 79, 79, 98, 99, 99, 94, 99, 79, 103, 124, 114, 114, 114, 114, 140, 140, 141, 155, 140, 124, 146, 157, 155, 140, 167, 157, 146, 157, 167, 167, 189, 167, 170, 189, 189, 195, 167, 211, 179, 211, 201, 211, 229, 226, 229, 224, 226, 224, 224, 229, 226, 248, 244, 244, 4, 25, 3, 24, 6, 25, 24, 25, 33, 55, 24, 47, 49, 47, 33, 68, 58, 50, 58, 47, 47, 79, 68, 68, 99, 79, 68, 99, 103, 103, 94, 99, 94, 99, 100, 134, 94, 114, 123, 123, 134, 134, 123, 157, 134, 123, 146, 146, 146, 167, 167, 167, 167, 155, 157, 179, 167, 195, 167, 167, 201, 195, 189, 211, 195, 201, 211, 219, 224, 211, 201, 219, 226, 244, 229, 229, 229, 248, 3, 5, 24, 33, 24, 6, 33, 6, 4, 25, 47, 25, 33, 47, 47, 47, 68, 47, 47, 68, 69, 69, 69, 69, 82, 68, 82, 82, 79, 99, 94, 94, 99, 94, 118, 123, 124, 94, 140, 114, 140, 146, 155, 123, 155, 157, 158, 167, 167, 157, 146, 179, 179, 167, 158, 189, 167, 195, 201, 201, 201, 201, 201, 201, 195, 201, 229, 224, 209, 201, 244, 229, 224, 219, 229, 229, 244, 243, 3, 5, 3, 5, 6, 6, 4, 4, 50, 47, 47, 47, 24, 47, 25, 50, 47, 68, 50, 47, 68, 50, 99, 68, 68, 94, 82, 82, 99, 82, 99, 123, 99, 124, 124, 114, 124, 123, 140, 123, 124, 140, 123, 140, 159, 146, 146, 157, 158, 146, 157, 167, 184, 167, 189, 189, 179, 167, 201, 167, 201, 211, 201, 193, 209, 226, 211, 209, 226, 230, 226, 230, 248, 229, 244, 248, 230, 248, 5, 4, 5, 4, 5, 25, 24, 6, 25, 6, 47, 25, 47, 25, 25, 68, 47, 69, 79, 79, 82, 79, 68, 73, 79, 94, 82, 94, 79, 82, 94, 94, 94, 124, 123, 124, 124, 114, 123, 124, 123, 146, 146, 142, 140, 157, 146, 146, 167, 158, 167, 146, 167, 170, 167, 167, 184, 179, 189, 179, 209, 189, 201, 211, 201, 211, 201, 211, 226, 229, 230, 219, 219, 230, 244, 237, 230, 244, 6, 4, 5, 6, 5, 6, 6, 47, 33, 33, 25, 25, 50, 50, 69, 50, 50, 69, 69, 69, 73, 79, 82, 79, 82, 69, 69, 94, 94, 94, 100, 124, 124, 124, 99, 124, 103, 123, 123, 124, 123, 146, 146, 123, 157, 142, 146, 146, 158, 146, 170, 179, 167, 184, 189, 189, 189, 201, 167, 189, 201, 201, 201, 211, 193, 209, 230, 201, 189, 219, 230, 224, 211, 230, 230, 244, 249, 248, 5, 6, 24, 6, 39, 6, 4, 8, 47, 47, 33, 50, 50, 68, 50, 68, 50, 69, 68, 50, 68, 73, 68, 73, 94, 82, 94, 82, 94, 100, 94, 94, 124, 124, 123, 123, 123, 124, 123, 146, 123, 123, 146, 158, 142, 142, 167, 158, 170, 155, 146, 167, 158, 167, 158, 184, 189, 158, 170, 193, 179, 201, 189, 193, 211, 201, 211, 229, 219, 226, 219, 230, 230, 244, 230, 248, 230, 248, 5, 5, 5, 6, 7, 33, 6, 47, 6, 33, 25, 50, 47, 25, 73, 50, 69, 69, 50, 68, 59, 73, 73, 68, 94, 73, 99, 94, 99, 94, 100, 82, 94, 123, 100, 123, 94, 128, 146, 123, 142, 123, 158, 146, 158, 158, 142, 158, 135, 146, 159, 146, 170, 167, 167, 184, 201, 184, 189, 201, 184, 215, 219, 201, 211, 219, 193, 193, 229, 219, 229, 229, 230, 230, 230, 248, 248, 229, 5, 5, 6, 4, 7, 33, 6, 33, 6, 50, 33, 25, 50, 41, 50, 73, 47, 50, 74, 73, 68, 82, 50, 82, 88, 82, 88, 88, 100, 94, 100, 82, 114, 124, 124, 94, 123, 124, 124, 142, 142, 146, 146, 142, 142, 128, 146, 146, 159, 135, 184, 170, 167, 184, 159, 167, 193, 189, 193, 184, 209, 189, 201, 201, 193, 209, 219, 201, 229, 201, 237, 229, 230, 237, 248, 248, 237, 248, 4, 5, 7, 8, 24, 7, 8, 8, 6, 6, 50, 33, 6, 6, 47, 50, 69, 50, 59, 50, 73, 59, 82, 82, 82, 73, 94, 82, 82, 88, 94, 124, 128, 94, 128, 123, 100, 142, 134, 123, 123, 128, 135, 146, 142, 159, 135, 146, 158, 158, 158, 158, 189, 170, 184, 193, 184, 184, 209, 193, 189, 189, 193, 209, 219, 201, 207, 219, 215, 219, 219, 219, 230, 230, 237, 219, 248, 237, 5, 7, 6, 6, 5, 6, 6, 33, 50, 41, 50, 50, 41, 69, 41, 79, 73, 50, 50, 74, 68, 88, 59, 59, 59, 94, 88, 82, 94, 94, 100, 94, 100, 100, 124, 128, 128, 124, 142, 135, 123, 128, 142, 135, 159, 142, 157, 158, 170, 158, 135, 170, 159, 170, 158, 184, 189, 184, 184, 193, 193, 189, 201, 201, 216, 219, 230, 230, 229, 219, 219, 237, 249, 229, 249, 237, 230, 230, 5, 5, 7, 6, 9, 6, 6, 6, 33, 50, 41, 50, 25, 59, 50, 50, 50, 74, 68, 88, 88, 74, 82, 88, 88, 100, 100, 94, 94, 91, 94, 108, 123, 123, 94, 128, 123, 100, 123, 142, 128, 128, 142, 142, 128, 135, 135, 135, 170, 158, 158, 158, 170, 189, 170, 168, 168, 193, 189, 209, 189, 184, 193, 193, 219, 215, 201, 193, 219, 230, 219, 237, 215, 237, 230, 248, 238, 237, 5, 6, 7, 6, 6, 8, 6, 8, 50, 8, 47, 41, 50, 50, 59, 41, 82, 41, 41, 73, 73, 74, 59, 82, 73, 99, 59, 94, 91, 94, 100, 100, 123, 91, 123, 100, 123, 128, 100, 142, 123, 128, 142, 158, 159, 159, 135, 146, 158, 159, 170, 159, 135, 159, 168, 170, 184, 168, 184, 184, 207, 175, 193, 211, 209, 219, 209, 207, 207, 219, 215, 219, 219, 237, 219, 230, 237, 248, 5, 9, 5, 6, 7, 8, 41, 33, 8, 33, 41, 41, 8, 41, 50, 41, 41, 69, 50, 82, 59, 73, 59, 73, 100, 59, 88, 94, 100, 94, 91, 108, 85, 123, 100, 123, 115, 94, 135, 128, 142, 128, 128, 146, 128, 142, 159, 159, 159, 170, 159, 170, 168, 184, 193, 170, 168, 193, 184, 184, 209, 193, 209, 189, 209, 207, 207, 216, 219, 219, 216, 237, 237, 237, 238, 238, 248, 237, 7, 7, 6, 8, 7, 8, 7, 6, 8, 41, 50, 50, 59, 59, 73, 69, 74, 59, 59, 59, 88, 41, 59, 66, 88, 100, 66, 108, 100, 100, 91, 94, 108, 108, 100, 110, 128, 128, 128, 123, 128, 135, 135, 135, 135, 158, 135, 159, 159, 158, 159, 135, 168, 193, 158, 170, 184, 190, 184, 207, 190, 170, 209, 215, 209, 193, 219, 219, 209, 215, 237, 219, 215, 237, 215, 249, 237, 237, 5, 7, 7, 7, 6, 8, 41, 41, 41, 41, 8, 50, 50, 8, 50, 41, 41, 41, 88, 74, 59, 94, 88, 59, 88, 88, 91, 88, 91, 108, 91, 91, 123, 128, 91, 123, 128, 128, 142, 128, 135, 128, 128, 135, 135, 158, 135, 135, 161, 168, 168, 168, 168, 170, 175, 159, 168, 193, 170, 193, 209, 207, 209, 190, 209, 215, 207, 215, 230, 215, 215, 237, 237, 237, 230, 237, 248, 237, 8, 7, 8, 8, 11, 41, 6, 8, 50, 41, 33, 34, 41, 41, 74, 41, 41, 41, 59, 59, 66, 91, 59, 74, 88, 66, 88, 66, 94, 108, 94, 108, 88, 100, 128, 110, 108, 108, 115, 128, 108, 135, 135, 135, 135, 135, 135, 170, 159, 168, 159, 184, 159, 168, 159, 193, 168, 193, 209, 193, 184, 184, 193, 207, 207, 190, 207, 207, 216, 215, 237, 237, 230, 215, 246, 237, 237, 249, 5, 7, 11, 8, 8, 9, 9, 8, 11, 41, 8, 41, 41, 41, 41, 51, 73, 59, 41, 74, 88, 88, 74, 88, 100, 91, 66, 108, 108, 91, 85, 108, 91, 128, 110, 108, 108, 128, 108, 110, 143, 115, 128, 143, 135, 135, 128, 143, 175, 170, 159, 161, 170, 170, 193, 161, 190, 168, 207, 190, 193, 190, 193, 207, 190, 207, 193, 216, 220, 220, 216, 216, 215, 238, 238, 238, 238, 238, 7, 7, 7, 7, 8, 8, 9, 9, 8, 41, 59, 50, 66, 70, 41, 74, 41, 59, 59, 51, 88, 66, 100, 66, 91, 88, 108, 91, 91, 91, 115, 108, 108, 91, 94, 128, 91, 135, 115, 128, 135, 128, 128, 135, 128, 143, 143, 135, 168, 143, 161, 170, 161, 168, 161, 184, 184, 168, 209, 193, 170, 190, 207, 219, 216, 219, 216, 215, 207, 207, 216, 215, 216, 237, 237, 216, 237, 216, 7, 9, 11, 7, 8, 8, 41, 41, 9, 50, 45, 45, 8, 51, 74, 41, 51, 66, 74, 74, 66, 91, 59, 66, 66, 100, 91, 66, 91, 91, 100, 123, 91, 115, 91, 135, 110, 91, 135, 119, 119, 135, 135, 119, 143, 158, 168, 143, 135, 161, 159, 170, 175, 168, 193, 190, 190, 190, 168, 190, 190, 207, 190, 215, 190, 207, 215, 190, 220, 216, 216, 237, 237, 237, 238, 237, 238, 238, 9, 7, 7, 7, 11, 8, 8, 41, 41, 11, 41, 41, 41, 41, 66, 51, 59, 34, 66, 88, 66, 66, 91, 91, 106, 66, 66, 91, 91, 115, 91, 108, 110, 91, 108, 128, 115, 110, 115, 135, 128, 115, 135, 143, 158, 143, 168, 168, 159, 143, 171, 161, 161, 168, 161, 175, 190, 168, 190, 190, 175, 190, 168, 215, 193, 215, 216, 210, 215, 216, 216, 238, 216, 216, 246, 238, 238, 238, 7, 11, 8, 34, 9, 34, 41, 11, 34, 51, 41, 34, 34, 41, 66, 74, 59, 70, 70, 66, 91, 66, 70, 85, 91, 91, 88, 66, 85, 115, 110, 110, 91, 110, 91, 115, 135, 110, 115, 119, 143, 128, 115, 115, 143, 131, 143, 159, 143, 168, 168, 168, 161, 168, 190, 193, 190, 190, 193, 190, 190, 216, 207, 207, 207, 207, 193, 219, 210, 237, 216, 216, 216, 238, 216, 233, 238, 246, 7, 8, 10, 11, 9, 8, 34, 34, 8, 11, 41, 50, 34, 34, 66, 66, 51, 59, 46, 74, 70, 91, 66, 66, 91, 85, 88, 92, 91, 110, 110, 91, 106, 115, 110, 128, 119, 115, 115, 115, 135, 131, 159, 135, 131, 159, 143, 161, 143, 143, 161, 168, 168, 161, 168, 161, 175, 175, 175, 190, 190, 190, 190, 190, 216, 220, 210, 216, 216, 216, 238, 216, 216, 233, 246, 238, 216, 254, 10, 9, 10, 8, 11, 8, 11, 41, 34, 8, 34, 34, 41, 34, 41, 41, 70, 51, 59, 85, 70, 83, 91, 70, 85, 108, 108, 91, 88, 91, 85, 91, 108, 108, 115, 128, 91, 143, 119, 115, 115, 143, 119, 135, 143, 159, 161, 135, 143, 175, 161, 170, 161, 168, 190, 175, 168, 190, 161, 190, 175, 210, 190, 207, 175, 190, 215, 212, 233, 216, 216, 220, 220, 216, 216, 246, 238, 246, 9, 10, 7, 11, 11, 12, 12, 41, 34, 34, 41, 34, 66, 59, 34, 46, 74, 66, 66, 66, 83, 70, 85, 66, 66, 85, 83, 85, 91, 85, 106, 106, 115, 106, 110, 115, 119, 115, 143, 135, 147, 119, 115, 119, 128, 161, 143, 171, 131, 168, 147, 171, 147, 161, 168, 171, 175, 175, 190, 210, 190, 207, 190, 207, 210, 210, 210, 210, 216, 191, 220, 233, 216, 233, 233, 238, 254, 216,		\
+	0x07, 15, 48, 33, 51, 46,		\
+		110, 116, 119, 110, 119, 116, 119, 116, 132, 119, 161, 131, 147, 161, 148, 161, 171, 148, 186, 148, 148, 191, 191, 176, 186, 210, 186, 186, 212, 221, 210, 212, 221, 221, 212, 210, 216, 233, 233, 233, 233, 254, 221, 233, 233, 239, 92, 131, 110, 125, 119, 119, 131, 147, 116, 131, 131, 131, 161, 161, 131, 148, 171, 171, 161, 191, 175, 165, 171, 186, 176, 186, 186, 186, 210, 186, 186, 221, 210, 198, 233, 233, 212, 221, 212, 221, 254, 216, 233, 254, 239, 246, 106, 119, 116, 116, 116, 131, 116, 131, 116, 148, 131, 151, 131, 131, 132, 148, 148, 148, 171, 165, 186, 171, 165, 171, 186, 191, 176, 198, 186, 176, 186, 186, 221, 221, 212, 210, 221, 212, 221, 233, 233, 217, 221, 227, 233, 233, 116, 116, 116, 110, 131, 119, 131, 116, 131, 151, 151, 161, 161, 151, 132, 148, 171, 151, 165, 148, 186, 186, 175, 165, 165, 186, 191, 165, 210, 221, 212, 221, 212, 221, 221, 212, 233, 217, 212, 233, 221, 217, 239, 233, 254, 250, 125, 119, 116, 106, 116, 116, 151, 131, 116, 131, 131, 131, 151, 136, 148, 152, 148, 165, 165, 160, 165, 176, 176, 186, 186, 175, 165, 186, 198, 176, 176, 198, 212, 198, 217, 233, 212, 233, 233, 221, 239, 233, 221, 239, 239, 254, 125, 119, 110, 132, 116, 148, 132, 116, 132, 116, 132, 131, 148, 148, 151, 147, 148, 148, 165, 176, 175, 148, 186, 165, 176, 191, 191, 212, 176, 210, 221, 191, 198, 210, 221, 221, 227, 233, 221, 212, 221, 217, 239, 233, 250, 255, 116, 89, 116, 107, 119, 125, 116, 136, 125, 148, 148, 132, 160, 148, 132, 165, 151, 165, 165, 171, 171, 176, 176, 176, 171, 186, 212, 186, 198, 198, 212, 191, 191, 197, 212, 221, 212, 217, 217, 221, 217, 250, 255, 239, 233, 239, 106, 125, 104, 116, 132, 116, 131, 125, 132, 151, 132, 132, 132, 160, 147, 160, 151, 147, 160, 176, 165, 191, 165, 176, 165, 198, 191, 176, 198, 186, 220, 221, 198, 212, 217, 221, 212, 217, 239, 227, 233, 250, 233, 239, 250, 239, 116, 116, 116, 125, 89, 116, 136, 132, 132, 136, 148, 151, 151, 132, 160, 132, 160, 172, 165, 176, 160, 160, 165, 176, 198, 198, 177, 176, 198, 217, 169, 198, 221, 217, 198, 212, 227, 217, 227, 233, 222, 217, 239, 239, 233, 250, 107, 116, 89, 125, 125, 132, 151, 125, 136, 125, 151, 136, 165, 148, 152, 160, 165, 171, 165, 176, 160, 165, 191, 172, 176, 176, 176, 198, 217, 198, 198, 217, 198, 212, 198, 197, 222, 233, 222, 227, 212, 255, 239, 227, 250, 250, 107, 132, 107, 136, 136, 116, 125, 132, 132, 151, 132, 151, 160, 151, 151, 160, 148, 160, 176, 148, 176, 172, 165, 176, 176, 165, 177, 191, 176, 217, 198, 198, 197, 198, 227, 233, 217, 217, 227, 239, 222, 217, 227, 227, 222, 250, 89, 107, 107, 132, 107, 136, 125, 136, 132, 136, 160, 132, 165, 160, 136, 132, 160, 165, 165, 177, 151, 160, 176, 165, 177, 198, 198, 198, 198, 198, 197, 198, 217, 212, 198, 198, 222, 212, 228, 217, 227, 239, 239, 239, 250, 250, 125, 116, 136, 89, 136, 125, 126, 132, 136, 160, 125, 160, 136, 160, 148, 160, 160, 176, 160, 160, 160, 177, 176, 165, 169, 198, 191, 177, 177, 197, 198, 198, 169, 198, 222, 227, 222, 239, 227, 228, 227, 227, 222, 239, 239, 227, 107, 104, 107, 116, 107, 107, 151, 116, 136, 136, 151, 136, 160, 152, 151, 176, 152, 176, 160, 160, 176, 176, 197, 177, 198, 172, 169, 198, 198, 198, 197, 169, 197, 217, 222, 197, 198, 222, 222, 239, 227, 222, 239, 250, 228, 227, 125, 107, 107, 136, 107, 136, 151, 136, 136, 136, 152, 136, 152, 136, 152, 160, 172, 160, 152, 160, 172, 176, 160, 198, 169, 198, 176, 172, 177, 197, 217, 217, 227, 197, 197, 197, 217, 222, 227, 217, 222, 239, 250, 228, 250, 239, 107, 101, 126, 107, 107, 136, 107, 107, 151, 152, 137, 152, 152, 151, 132, 152, 160, 177, 176, 156, 172, 172, 198, 172, 172, 172, 197, 169, 169, 197, 197, 197, 222, 197, 198, 197, 222, 197, 198, 227, 227, 227, 227, 222, 239, 251, 89, 126, 101, 107, 125, 136, 136, 136, 152, 152, 136, 152, 160, 152, 160, 152, 160, 152, 160, 156, 172, 160, 177, 169, 160, 177, 169, 177, 198, 199, 217, 198, 169, 217, 199, 222, 222, 227, 228, 222, 222, 251, 239, 227, 251, 222, 101, 107, 107, 136, 125, 107, 152, 107, 152, 126, 160, 136, 137, 152, 152, 177, 152, 177, 160, 156, 162, 176, 160, 177, 169, 169, 198, 169, 176, 222, 169, 169, 197, 198, 222, 222, 227, 222, 227, 222, 227, 227, 251, 251, 228, 250, 101, 126, 105, 126, 136, 126, 117, 126, 137, 152, 152, 152, 160, 152, 152, 152, 152, 160, 160, 162, 177, 162, 198, 160, 169, 172, 197, 169, 197, 222, 217, 197, 222, 202, 202, 202, 227, 222, 228, 222, 222, 227, 251, 251, 239, 251, 107, 126, 126, 126, 126, 136, 136, 136, 137, 126, 136, 160, 152, 139, 137, 137, 156, 162, 160, 172, 160, 177, 162, 169, 172, 169, 169, 172, 177, 169, 169, 217, 169, 222, 228, 222, 222, 222, 222, 250, 228, 250, 228, 251, 228, 251, 107, 126, 101, 139, 126, 136, 126, 152, 137, 136, 162, 137, 162, 160, 172, 137, 172, 156, 169, 169, 172, 162, 172, 169, 202, 177, 177, 197, 199, 198, 169, 222, 222, 202, 222, 199, 228, 227, 222, 251, 222, 228, 228, 250, 251, 250, 101, 126, 101, 117, 137, 136, 126, 126, 137, 137, 126, 152, 137, 137, 156, 156, 156, 152, 162, 156, 169, 172, 172, 177, 177, 202, 202, 202, 169, 169, 202, 202, 228, 222, 202, 228, 202, 222, 228, 225, 251, 228, 251, 252, 251, 228, 107, 126, 126, 126, 126, 126, 126, 139, 152, 137, 137, 138, 139, 162, 160, 156, 162, 152, 156, 172, 162, 156, 177, 156, 169, 169, 185, 177, 199, 169, 199, 169, 227, 199, 197, 197, 227, 240, 199, 228, 222, 228, 228, 251, 227, 240, 117, 117, 101, 138, 139, 117, 126, 136, 152, 117, 139, 160, 137, 137, 138, 156, 172, 172, 156, 138, 172, 169, 169, 185, 185, 162, 202, 177, 202, 169, 199, 199, 202, 197, 202, 203, 202, 228, 228, 251, 225, 228, 228, 227, 251, 240, 126, 105, 137, 101, 117, 126, 138, 138, 117, 152, 160, 137, 156, 162, 137, 172, 156, 185, 169, 162, 169, 169, 185, 202, 156, 169, 185, 169, 185, 199, 197, 197, 199, 169, 203, 199, 240, 199, 240, 228, 228, 251, 228, 240, 252, 251, 126, 101, 137, 117, 101, 126, 126, 126, 137, 139, 138, 139, 139, 162, 137, 154, 162, 156, 156, 162, 156, 178, 169, 156, 169, 185, 169, 199, 197, 202, 199, 199, 197, 202, 225, 202, 222, 228, 228, 228, 240, 251, 228, 240, 251, 228, 126, 117, 126, 95, 117, 139, 117, 117, 138, 117, 152, 156, 137, 162, 137, 162, 156, 156, 169, 172, 178, 156, 156, 199, 185, 199, 203, 203, 169, 185, 204, 199, 199, 225, 202, 225, 202, 225, 225, 199, 228, 228, 251, 240, 252, 251, 117, 101, 117, 117, 126, 138, 137, 117, 152, 137, 139, 137, 139, 139, 162, 138, 169, 138, 169, 154, 185, 169, 169, 185, 199, 156, 169, 185, 203, 202, 203, 199, 202, 225, 225, 205, 202, 235, 228, 228, 225, 228, 252, 251, 240, 240, 117, 117, 96, 117, 126, 117, 117, 117, 156, 137, 137, 138, 154, 156, 156, 156, 138, 169, 154, 169, 156, 169, 178, 185, 185, 185, 203, 203, 203, 199, 203, 199, 199, 199, 202, 235, 228, 240, 204, 203, 251, 236, 251, 252, 240, 252, 117, 96, 126, 117, 117, 126, 117, 153, 138, 138, 138, 138, 137, 169, 138, 154, 156, 185, 154, 178, 178, 154, 185, 203, 185, 169, 178, 203, 180, 203, 203, 203, 225, 228, 225, 202, 235, 240, 225, 251, 225, 251, 235, 235, 251, 252, 117, 96, 117, 129, 117, 138, 96, 117, 138, 138, 117, 138, 153, 156, 154, 138, 156, 178, 154, 154, 185, 178, 185, 154, 185, 185, 169, 204, 203, 203, 199, 203, 199, 204, 202, 225, 204, 202, 203, 252, 235, 240, 236, 240, 240, 228, 117, 117, 117, 96, 117, 96, 138, 138, 117, 129, 138, 156, 139, 138, 162, 138, 178, 154, 185, 156, 164, 164, 199, 185, 169, 187, 187, 199, 203, 178, 199, 225, 199, 205, 225, 225, 225, 240, 225, 225, 235, 241, 225, 236, 235, 252, 90, 117, 96, 138, 129, 117, 117, 111, 138, 138, 139, 154, 149, 139, 138, 138, 154, 154, 178, 185, 178, 185, 185, 185, 187, 204, 185, 187, 203, 199, 203, 203, 205, 203, 218, 228, 225, 235, 225, 225, 241, 235, 252, 240, 252, 240, 96, 96, 138, 117, 117, 111, 120, 154, 129, 117, 138, 138, 154, 139, 149, 178, 180, 154, 178, 154, 154, 180, 164, 204, 187, 178, 178, 204, 203, 204, 203, 205, 204, 203, 225, 203, 241, 205, 240, 225, 240, 240, 241, 240, 241, 236, 129, 120, 113, 90, 129, 137, 129, 113, 113, 138, 156, 129, 149, 154, 154, 154, 153, 178, 185, 178, 178, 187, 169, 180, 180, 187, 185, 187, 199, 203, 203, 205, 225, 204, 205, 205, 225, 204, 236, 204, 241, 241, 240, 241, 252, 252, 120, 129, 96, 129, 113, 129, 138, 129, 138, 154, 138, 129, 138, 138, 149, 164, 154, 154, 180, 180, 164, 178, 164, 203, 187, 187, 187, 204, 204, 205, 205, 203, 204, 204, 205, 205, 225, 218, 235, 225, 218, 235, 236, 241, 236, 241, 97, 90, 113, 111, 113, 129, 117, 129, 138, 111, 129, 129, 154, 164, 154, 154, 180, 164, 164, 154, 185, 178, 187, 178, 187, 205, 180, 187, 203, 185, 187, 205, 225, 231, 204, 205, 218, 205, 218, 218, 235, 241, 231, 235, 252, 241, 117, 117, 129, 113, 113, 129, 129, 117, 149, 129, 154, 153, 138, 164, 154, 149, 164, 164, 164, 187, 187, 164, 180, 187, 187, 187, 206, 180, 204, 200, 204, 200, 218, 204, 204, 218, 236, 205, 241, 204, 236, 236, 241, 218, 241, 236, 113, 113, 111, 113, 113, 117, 111, 111, 153, 129, 154, 129, 153, 149, 138, 149, 164, 149, 154, 164, 185, 187, 200, 180, 203, 187, 187, 204, 204, 203, 204, 205, 218, 204, 218, 218, 218, 218, 236, 241, 218, 236, 218, 235, 241, 236, 129, 111, 111, 113, 113, 149, 129, 129, 129, 129, 153, 153, 154, 149, 164, 164, 164, 164, 180, 164, 187, 187, 164, 188, 200, 187, 187, 187, 200, 203, 187, 204, 218, 204, 204, 218, 218, 218, 236, 218, 218, 241, 236, 241, 252, 252, 97, 111, 129, 129, 111, 113, 127, 129, 129, 129, 129, 129, 153, 153, 154, 149, 164, 153, 187, 173, 164, 163, 187, 164, 187, 187, 200, 205, 206, 204, 206, 218, 225, 231, 204, 218, 200, 236, 231, 236, 241, 236, 241, 236, 234, 253, 111, 113, 129, 90, 111, 149, 111, 130, 130, 149, 149, 153, 153, 149, 127, 164, 181, 173, 164, 164, 178, 187, 173, 187, 187, 187, 187, 200, 205, 205, 200, 187, 200, 231, 204, 218, 218, 218, 234, 218, 241, 213, 241, 253, 241, 253, 111, 111, 129, 112, 111, 127, 149, 149, 153, 129, 153, 153, 149, 153, 173, 149, 164, 163, 187, 163, 181, 187, 188, 205, 181, 187, 200, 187, 206, 188, 218, 218, 218, 206, 200, 205, 241, 205, 231, 234, 231, 253, 225, 234, 253, 236, 111, 97, 111, 129, 111, 111, 127, 127, 127, 127, 149, 164, 164, 130, 164, 149, 173, 163, 163, 187, 164, 187, 187, 173, 187, 188, 187, 173, 187, 204, 206, 218, 206, 218, 231, 213, 218, 218, 241, 213, 218, 234, 234, 234, 241, 234, 90, 127, 90, 111, 111, 127, 127, 153, 121, 144, 154, 130, 153, 130, 164, 164, 130, 164, 187, 173, 164, 163, 173, 206, 188, 163, 187, 206, 204, 200, 188, 200, 205, 218, 218, 236, 218, 218, 218, 241, 241, 253, 241, 234, 234, 253, 112, 111, 130, 127, 129, 144, 144, 153, 153, 153, 121, 144, 144, 164, 163, 130, 164, 163, 173, 173, 188, 173, 188, 173, 173, 188, 206, 187, 206, 204, 218, 218, 213, 206, 213, 218, 231, 234, 218, 234, 234, 213, 253, 234, 234, 253, 112, 111, 112, 127, 112, 112, 129, 144, 153, 130, 153, 144, 153, 163, 164, 164, 163, 181, 173, 188, 187, 164, 173, 200, 181, 188, 187, 200, 188, 187, 206, 187, 188, 231, 218, 234, 213, 204, 247, 253, 236, 253, 253, 253, 236, 253, 93, 127, 112, 130, 127, 127, 127, 130, 127, 144, 127, 163, 144, 129, 163, 163, 163, 173, 164, 130, 181, 188, 188, 188, 188, 187, 188, 200, 200, 188, 188, 206, 206, 231, 213, 200, 231, 213, 218, 213, 213, 234, 234, 234, 234, 253, 121, 127, 112, 112, 127, 121, 121, 130, 130, 127, 144, 163, 144, 144, 163, 163, 173, 163, 163, 192, 163, 187, 173, 200, 188, 192, 188, 206, 188, 213, 218, 188, 213, 192, 234, 213, 213, 218, 247, 213, 231, 247, 234, 247, 234, 247, 130, 121, 121, 111, 144, 130, 127, 127, 129, 144, 163, 153, 153, 144, 144, 173, 163, 163, 187, 163, 181, 188, 188, 181, 188, 206, 200, 213, 218, 200, 206, 192, 218, 213, 206, 206, 213, 213, 234, 213, 231, 234, 234, 234, 247, 247, 112, 127, 127, 121, 127, 144, 121, 144, 121, 144, 144, 163, 144, 144, 163, 163, 181, 173, 181, 163, 181, 173, 181, 188, 188, 187, 192, 200, 192, 188, 206, 206, 206, 206, 206, 234, 218, 234, 213, 213, 213, 213, 247, 213, 253, 247,		\
+	72, 0, 28, 33,		\
+		16, 14, 19, 36, 18, 26, 18, 18, 31, 18, 31, 56, 31, 42, 27, 57, 56, 56, 42, 84, 75, 84, 75, 80, 107, 80, 75, 75, 96, 107, 120, 96, 117, 16, 19, 26, 14, 19, 19, 26, 36, 18, 42, 56, 56, 31, 36, 42, 80, 56, 56, 80, 42, 57, 75, 75, 57, 80, 95, 105, 101, 72, 84, 96, 126, 126, 16, 19, 19, 26, 19, 18, 31, 19, 19, 31, 48, 19, 31, 31, 48, 57, 42, 80, 75, 56, 57, 80, 101, 105, 75, 101, 105, 96, 96, 95, 117, 101, 101, 17, 19, 19, 19, 19, 26, 18, 36, 26, 27, 36, 31, 42, 48, 42, 27, 42, 86, 80, 80, 75, 75, 48, 75, 95, 80, 95, 75, 72, 84, 84, 96, 120, 18, 14, 16, 21, 19, 36, 31, 19, 19, 31, 56, 19, 27, 42, 42, 75, 48, 80, 75, 57, 80, 75, 80, 105, 75, 75, 75, 96, 101, 120, 95, 101, 96, 17, 17, 17, 19, 26, 31, 36, 27, 19, 19, 21, 56, 31, 48, 27, 57, 42, 57, 75, 80, 57, 42, 86, 86, 96, 80, 95, 96, 72, 75, 117, 117, 117, 19, 17, 17, 17, 19, 42, 19, 19, 27, 36, 18, 48, 48, 48, 57, 80, 48, 42, 48, 57, 84, 95, 75, 80, 75, 75, 101, 86, 75, 96, 75, 101, 96, 17, 17, 26, 17, 19, 27, 31, 36, 36, 57, 36, 36, 57, 27, 75, 48, 75, 72, 80, 75, 48, 86, 72, 72, 86, 72, 101, 72, 95, 96, 96, 111, 96, 17, 17, 17, 27, 17, 19, 36, 17, 27, 36, 31, 48, 36, 42, 48, 28, 75, 48, 54, 80, 57, 72, 75, 75, 96, 96, 86, 95, 117, 96, 96, 96, 113, 17, 27, 16, 19, 21, 19, 36, 36, 48, 19, 48, 48, 21, 72, 48, 57, 75, 48, 86, 75, 72, 80, 75, 90, 95, 54, 95, 75, 95, 96, 111, 95, 96, 19, 19, 21, 19, 17, 19, 19, 21, 21, 48, 36, 36, 42, 28, 36, 57, 36, 48, 48, 57, 75, 72, 86, 95, 72, 75, 90, 86, 90, 86, 96, 95, 117, 17, 17, 21, 19, 27, 36, 36, 48, 19, 27, 57, 57, 28, 54, 48, 54, 72, 75, 54, 86, 75, 96, 86, 75, 90, 95, 86, 96, 111, 90, 96, 96, 117, 17, 17, 21, 27, 21, 19, 27, 19, 21, 54, 48, 21, 57, 54, 48, 54, 54, 48, 36, 76, 72, 86, 57, 86, 75, 72, 72, 90, 75, 96, 90, 96, 113, 20, 21, 17, 17, 19, 27, 21, 36, 36, 36, 28, 36, 27, 43, 54, 36, 54, 54, 72, 54, 86, 54, 76, 96, 97, 90, 95, 113, 113, 72, 95, 111, 96, 20, 17, 20, 19, 21, 23, 21, 28, 28, 54, 57, 36, 54, 36, 36, 54, 54, 48, 76, 72, 54, 72, 86, 76, 54, 97, 72, 72, 112, 90, 97, 117, 111, 20, 28, 21, 21, 17, 36, 27, 27, 28, 20, 54, 36, 36, 54, 54, 54, 76, 72, 54, 61, 72, 76, 90, 76, 96, 95, 111, 72, 113, 76, 113, 90, 90, 21, 17, 20, 21, 21, 21, 28, 28, 36, 54, 21, 43, 43, 43, 61, 54, 61, 54, 54, 86, 76, 90, 72, 54, 76, 65, 90, 112, 90, 111, 97, 111, 111, 20, 21, 19, 21, 21, 36, 28, 28, 43, 22, 54, 43, 43, 37, 54, 36, 76, 76, 54, 54, 76, 54, 90, 86, 76, 90, 96, 97, 96, 65, 96, 112, 96, 22, 21, 17, 28, 21, 22, 22, 43, 54, 43, 37, 48, 44, 43, 54, 76, 54, 61, 76, 90, 65, 54, 76, 90, 86, 97, 90, 72, 76, 97, 65, 97, 113, 20, 23, 28, 37, 21, 28, 21, 28, 37, 54, 54, 43, 36, 54, 37, 54, 44, 54, 76, 65, 43, 65, 90, 65, 90, 90, 65, 65, 111, 97, 113, 111, 112, 23, 17, 23, 17, 23, 28, 37, 43, 43, 43, 61, 36, 37, 44, 54, 76, 54, 72, 61, 76, 90, 65, 90, 76, 76, 76, 97, 97, 65, 90, 97, 127, 97, 23, 21, 23, 21, 22, 43, 37, 21, 44, 36, 54, 43, 54, 37, 61, 61, 44, 65, 54, 90, 54, 65, 97, 76, 76, 97, 65, 97, 97, 93, 97, 90, 97, 21, 22, 21, 23, 21, 22, 43, 36, 37, 44, 22, 43, 61, 65, 61, 61, 65, 61, 61, 44, 76, 65, 90, 76, 97, 97, 97, 65, 65, 93, 111, 112, 97, 23, 21, 21, 21, 22, 22, 21, 37, 21, 21, 44, 65, 43, 61, 76, 44, 54, 76, 65, 81, 44, 76, 61, 93, 90, 97, 81, 76, 112, 97, 111, 112, 112, 22, 23, 23, 23, 23, 44, 22, 44, 44, 44, 22, 44, 44, 54, 44, 81, 61, 44, 65, 61, 65, 76, 93, 81, 97, 97, 97, 93, 97, 112, 121, 93, 112, 23, 23, 21, 23, 22, 23, 44, 22, 44, 37, 37, 61, 44, 61, 61, 76, 61, 61, 44, 76, 93, 81, 65, 81, 81, 90, 65, 65, 112, 93, 93, 93, 112, 23, 23, 23, 22, 37, 44, 23, 44, 23, 37, 44, 61, 44, 61, 44, 61, 65, 44, 65, 81, 61, 97, 65, 81, 81, 65, 112, 93, 65, 93, 93, 127, 121, 23, 23, 23, 23, 23, 37, 44, 22, 44, 37, 44, 61, 37, 44, 65, 61, 44, 65, 81, 81, 90, 81, 81, 76, 93, 81, 93, 93, 112, 93, 93, 93, 97,		\
+	46, 1, 21, 32,		\
+		10, 12, 11, 9, 30, 45, 12, 34, 34, 11, 34, 46, 46, 34, 59, 46, 46, 46, 66, 66, 85, 83, 67, 85, 85, 91, 85, 92, 110, 110, 92, 110, 11, 12, 11, 11, 11, 46, 11, 11, 30, 46, 51, 46, 46, 46, 46, 34, 46, 83, 83, 85, 52, 83, 83, 85, 66, 110, 110, 67, 119, 85, 110, 110, 11, 13, 10, 11, 11, 30, 11, 13, 45, 30, 30, 34, 51, 46, 46, 46, 83, 85, 66, 85, 85, 83, 83, 67, 92, 85, 92, 85, 92, 85, 110, 116, 11, 12, 34, 12, 12, 34, 30, 51, 30, 34, 30, 52, 30, 46, 66, 83, 64, 46, 83, 52, 85, 83, 85, 85, 85, 106, 83, 67, 110, 89, 106, 110, 11, 30, 13, 34, 11, 15, 41, 30, 30, 51, 30, 46, 34, 30, 64, 83, 46, 83, 52, 67, 67, 67, 71, 106, 67, 92, 67, 89, 85, 85, 67, 106, 12, 13, 10, 13, 13, 12, 34, 34, 34, 15, 30, 34, 46, 64, 46, 46, 52, 83, 52, 92, 83, 83, 66, 67, 67, 104, 85, 110, 89, 119, 110, 89, 15, 11, 12, 12, 12, 30, 30, 13, 13, 30, 46, 30, 51, 52, 64, 30, 46, 46, 52, 83, 46, 71, 92, 83, 83, 110, 92, 92, 85, 92, 89, 119, 11, 13, 11, 14, 30, 34, 30, 52, 30, 30, 30, 52, 46, 53, 64, 52, 83, 83, 52, 92, 60, 85, 67, 104, 67, 71, 67, 89, 104, 110, 106, 104, 13, 13, 15, 13, 30, 13, 13, 30, 46, 30, 15, 64, 30, 46, 64, 71, 52, 53, 52, 64, 67, 71, 85, 92, 89, 92, 85, 92, 92, 67, 116, 89, 12, 15, 15, 12, 30, 13, 30, 30, 30, 52, 46, 35, 30, 64, 64, 64, 67, 53, 83, 92, 71, 85, 71, 67, 92, 67, 89, 89, 67, 116, 89, 119, 12, 15, 15, 12, 30, 30, 30, 30, 15, 15, 53, 30, 64, 64, 53, 52, 52, 52, 64, 52, 67, 71, 67, 52, 67, 104, 71, 89, 89, 106, 71, 104, 12, 15, 15, 12, 15, 26, 15, 15, 15, 30, 53, 52, 60, 53, 52, 46, 71, 67, 71, 83, 60, 71, 67, 104, 71, 104, 67, 104, 107, 71, 125, 125, 26, 12, 12, 15, 15, 14, 30, 35, 53, 15, 15, 53, 30, 53, 52, 53, 30, 53, 52, 71, 53, 71, 67, 71, 67, 104, 104, 104, 71, 89, 89, 89, 13, 14, 15, 15, 15, 15, 26, 15, 35, 15, 53, 67, 71, 53, 71, 67, 71, 52, 71, 71, 89, 71, 89, 71, 67, 89, 89, 89, 107, 89, 101, 116, 13, 12, 14, 15, 15, 15, 30, 15, 35, 31, 53, 53, 30, 53, 53, 31, 67, 42, 89, 71, 71, 71, 71, 104, 84, 89, 104, 71, 107, 107, 104, 126, 14, 14, 15, 12, 26, 15, 26, 35, 53, 15, 30, 53, 53, 53, 60, 52, 53, 42, 52, 71, 71, 84, 104, 89, 104, 71, 106, 104, 104, 89, 107, 107, 26, 14, 15, 26, 26, 15, 26, 30, 18, 31, 53, 53, 53, 52, 71, 71, 60, 71, 71, 53, 52, 92, 42, 71, 71, 84, 71, 107, 89, 101, 101, 107, 14, 15, 13, 15, 15, 26, 35, 15, 35, 53, 64, 60, 53, 60, 53, 42, 52, 84, 42, 84, 71, 71, 71, 104, 71, 107, 84, 104, 107, 107, 107, 101, 26, 13, 26, 26, 26, 26, 26, 26, 35, 31, 31, 60, 56, 53, 56, 42, 42, 53, 53, 42, 71, 71, 84, 84, 84, 104, 71, 89, 101, 71, 101, 105, 14, 14, 14, 26, 26, 26, 35, 53, 31, 60, 31, 35, 53, 60, 53, 71, 60, 42, 84, 42, 67, 60, 84, 84, 71, 84, 105, 84, 89, 101, 107, 107, 13, 18, 35, 26, 35, 26, 18, 18, 26, 18, 31, 31, 42, 53, 31, 42, 42, 53, 84, 71, 80, 71, 101, 84, 71, 105, 80, 84, 84, 107, 107, 101,		\
+	43, 12, 3, 68,		\
+		34, 34, 34, 59, 51, 83, 66, 46, 83, 59, 91, 66, 91, 92, 100, 85, 115, 85, 91, 92, 110, 91, 115, 119, 115, 115, 115, 119, 119, 115, 143, 143, 147, 143, 143, 131, 168, 147, 171, 175, 168, 175, 186, 168, 171, 190, 171, 210, 210, 175, 186, 186, 220, 175, 220, 216, 216, 238, 220, 246, 216, 254, 216, 233, 238, 233, 238, 238, 41, 66, 66, 66, 46, 85, 51, 66, 70, 83, 85, 46, 83, 85, 92, 85, 106, 85, 110, 110, 115, 85, 119, 110, 119, 110, 119, 106, 106, 119, 115, 143, 161, 161, 131, 143, 147, 147, 161, 161, 171, 190, 161, 161, 190, 165, 175, 190, 186, 207, 210, 207, 207, 210, 221, 210, 210, 212, 207, 212, 233, 220, 233, 238, 254, 233, 238, 254, 34, 66, 46, 46, 46, 51, 66, 83, 85, 83, 66, 85, 85, 85, 83, 85, 106, 115, 106, 106, 110, 116, 106, 110, 110, 115, 110, 131, 143, 143, 119, 147, 143, 161, 161, 143, 147, 132, 175, 161, 171, 161, 175, 175, 186, 207, 186, 175, 186, 186, 207, 221, 221, 186, 220, 210, 221, 216, 233, 238, 216, 233, 233, 238, 239, 246, 239, 254,		\
+	0, 37, 2, 43,		\
+		122, 133, 109, 150, 122, 150, 122, 122, 150, 150, 150, 166, 150, 150, 183, 174, 174, 150, 174, 183, 174, 183, 174, 196, 183, 196, 208, 208, 196, 196, 208, 208, 232, 208, 232, 232, 242, 232, 242, 232, 242, 242, 242, 109, 133, 150, 122, 133, 150, 150, 133, 133, 141, 150, 150, 150, 174, 150, 174, 174, 174, 174, 174, 183, 196, 174, 196, 183, 196, 183, 182, 208, 208, 196, 208, 194, 232, 232, 223, 242, 223, 232, 232, 245, 242, 242,		\
+	67, 1, 5, 14,		\
+		17, 14, 14, 26, 26, 31, 26, 35, 56, 18, 31, 60, 53, 60, 14, 26, 26, 31, 14, 31, 26, 18, 42, 31, 31, 42, 56, 42, 14, 31, 35, 16, 19, 14, 31, 26, 31, 57, 31, 31, 56, 31, 19, 14, 19, 26, 18, 26, 18, 26, 26, 31, 26, 56, 31, 42, 26, 14, 31, 26, 31, 18, 42, 17, 56, 31, 36, 31, 42, 31,		\
+	0, 0, 2, 32,		\
+		0, 1, 1, 1, 0, 38, 1, 38, 40, 2, 38, 38, 40, 63, 63, 62, 62, 38, 63, 63, 77, 77, 62, 77, 77, 102, 77, 87, 87, 102, 109, 118, 1, 0, 29, 0, 38, 0, 38, 38, 40, 38, 0, 32, 38, 63, 38, 55, 62, 62, 77, 77, 55, 87, 77, 102, 62, 87, 102, 78, 109, 87, 87, 87,		\
+	67, 18, 5, 11,		\
+		71, 84, 60, 84, 84, 84, 104, 84, 105, 84, 116, 71, 60, 84, 80, 80, 105, 42, 101, 84, 75, 101, 42, 80, 42, 80, 42, 42, 107, 80, 80, 75, 84, 56, 80, 84, 60, 84, 84, 84, 105, 75, 101, 95, 56, 75, 42, 84, 101, 80, 75, 84, 107, 107, 84,		\
+	46, 33, 2, 24,		\
+		106, 106, 119, 131, 119, 147, 131, 119, 131, 119, 143, 119, 143, 131, 171, 148, 168, 161, 161, 190, 171, 161, 148, 175, 106, 106, 119, 106, 106, 110, 131, 143, 115, 143, 148, 131, 161, 131, 171, 131, 171, 148, 161, 175, 147, 190, 171, 175,		\
+	2, 78, 19, 2,		\
+		242, 245, 243, 242, 245, 242, 242, 243, 245, 245, 245, 245, 243, 243, 242, 244, 245, 243, 245, 245, 244, 245, 226, 248, 248, 244, 245, 244, 244, 245, 248, 244, 226, 248, 229, 249, 249, 244,		\
+	46, 64, 2, 16,		\
+		221, 207, 216, 220, 221, 212, 220, 233, 233, 216, 233, 238, 216, 254, 233, 239, 221, 190, 221, 220, 217, 239, 216, 212, 233, 221, 254, 233, 233, 233, 238, 254,		\
+	43, 0, 3, 9,		\
+		11, 7, 12, 11, 11, 34, 8, 11, 41, 10, 10, 11, 11, 11, 41, 34, 11, 34, 9, 10, 11, 34, 11, 10, 11, 11, 34,		\
+	37, 78, 6, 2,		\
+		246, 238, 237, 246, 254, 246, 238, 233, 233, 216, 238, 254,		\
+	67, 29, 3, 4,		\
+		84, 101, 84, 101, 101, 105, 101, 101, 96, 101, 107, 96,		\
+	70, 15, 2, 3,		\
+		57, 53, 42, 42, 84, 42,		\
+	0x12, 74, 79, 26,		\
+		252, 251, 252, 251, 241, 252, 241, 236, 252, 252, 241, 241, 241, 253, 241, 252, 241, 253, 253, 236, 253, 253, 236, 247, 247, 247,		\
+	0x07, 4, 48, 79, 19,		\
+		254, 250, 254, 255, 239, 239, 255, 239, 250, 239, 250, 239, 251, 250, 251, 239, 251, 251, 239,		\
+	46, 0, 18,		\
+		10, 11, 10, 12, 10, 11, 10, 12, 10, 12, 13, 12, 12, 13, 14, 13, 14, 15,		\
+	21, 79, 12,		\
+		248, 248, 244, 248, 249, 248, 238, 248, 249, 237, 249, 238,		\
+	28, 78, 5,		\
+		249, 237, 238, 248, 248,		\
+	0x13, 99, 33, 32,		\
+		121, 127, 121, 93, 127, 144, 111, 144, 121, 130, 163, 163, 163, 144, 163, 173, 181, 130, 188, 181, 181, 181, 181, 188, 192, 192, 181, 192, 192, 206, 188, 192,		\
+	0x13, 46, 57, 7,		\
+		186, 190, 186, 190, 186, 220, 186,		\
+	0x13, 99, 72, 7,		\
+		247, 234, 247, 253, 234, 247, 253,		\
+	0x01, 16, 71, 0,		\
+	0xff
+
+#endif  //  PHOTODITHER_H_INCLUDED
+
@@ -0,0 +1,600 @@
+/*
+ *  ST7735 Huffman Coded Image (draw with drawHuffImage())
+ *  Original: photodither.png
+ *  Commands: 8075 bytes, coded: 8277 (code tables and bitstream); total 8790 vs. 8588 bytes
+ */
+
+#ifndef PHOTODITHER_HUFF_H_INCLUDED
+#define PHOTODITHER_HUFF_H_INCLUDED
+
+#define PHOTODITHER_WIDTH		100
+#define PHOTODITHER_HEIGHT		80
+#define PHOTODITHER_HUFF_LEN		8790	/*  Total array size  */
+
+#define PHOTODITHER_HUFF		\
+	0,		\
+	0x62, 0x08,	0x60, 0x08,	0x41, 0x18,	0x43, 0x20,		\
+	0x63, 0x30,	0x44, 0x40,	0xa5, 0x38,	0x45, 0x50,		\
+	0xa6, 0x48,	0x86, 0x58,	0x46, 0x68,	0x87, 0x60,		\
+	0x48, 0x70,	0x88, 0x78,	0x29, 0x88,	0xa9, 0x78,		\
+	0x69, 0xa0,	0x2b, 0xa8,	0xca, 0x98,	0x8b, 0xa0,		\
+	0x6b, 0xb8,	0x8d, 0xb8,	0x8d, 0xc8,	0x4d, 0xc8,		\
+	0x84, 0x28,	0xe5, 0x28,	0xaa, 0x88,	0xcb, 0xa8,		\
+	0xcc, 0xb8,	0xc2, 0x18,	0xe9, 0x70,	0xeb, 0x90,		\
+	0xc4, 0x18,	0xe5, 0x40,	0xe8, 0x60,	0xe9, 0x80,		\
+	0xed, 0xa8,	0xed, 0xc8,	0x03, 0x09,	0xe3, 0x28,		\
+	0xe1, 0x00,	0x07, 0x51,	0x4c, 0x91,	0xed, 0xb8,		\
+	0xef, 0xc8,	0xe6, 0x60,	0x49, 0x69,	0x25, 0x31,		\
+	0x4c, 0xa9,	0x84, 0x29,	0x26, 0x41,	0x27, 0x61,		\
+	0x4a, 0x71,	0x2a, 0x81,	0x4e, 0xb1,	0x44, 0x19,		\
+	0x4b, 0x99,	0x4d, 0xa1,	0x66, 0x21,	0x88, 0x49,		\
+	0x6a, 0x89,	0x2e, 0xc9,	0x83, 0x11,	0x42, 0x09,		\
+	0x49, 0x79,	0xb0, 0xc1,	0x89, 0x59,	0xcb, 0x71,		\
+	0x85, 0x31,	0x87, 0x31,	0x87, 0x59,	0xab, 0x81,		\
+	0xaf, 0xa9,	0x87, 0x41,	0x87, 0x49,	0xad, 0xa1,		\
+	0xae, 0xc1,	0xa4, 0x09,	0xe5, 0x19,	0xc6, 0x29,		\
+	0xac, 0x99,	0xb0, 0xd1,	0x07, 0x3a,	0xa9, 0x69,		\
+	0xcd, 0x89,	0xca, 0x61,	0xcd, 0xb1,	0xe5, 0x09,		\
+	0xc8, 0x49,	0x0c, 0x7a,	0x0f, 0xba,	0x09, 0x52,		\
+	0x0a, 0x72,	0x11, 0xca,	0x08, 0x3a,	0x2d, 0xa2,		\
+	0x2f, 0xa2,	0x10, 0xc2,	0x45, 0x22,	0x27, 0x32,		\
+	0x48, 0x4a,	0x2d, 0x92,	0x03, 0x0a,	0x27, 0x1a,		\
+	0x2b, 0x82,	0x2c, 0x92,	0x6a, 0x6a,	0x6d, 0x82,		\
+	0x69, 0x52,	0x65, 0x0a,	0x4b, 0x62,	0x71, 0xba,		\
+	0x70, 0xc2,	0x6f, 0xb2,	0x87, 0x2a,	0x8a, 0x5a,		\
+	0x8c, 0x72,	0x8f, 0xa2,	0xa6, 0x1a,	0xac, 0x62,		\
+	0x8e, 0xa2,	0x92, 0xd2,	0xc7, 0x12,	0xa9, 0x3a,		\
+	0x88, 0x3a,	0x8d, 0x7a,	0x8e, 0x92,	0xb1, 0xc2,		\
+	0xca, 0x4a,	0xd1, 0xb2,	0x11, 0xcb,	0xec, 0x6a,		\
+	0xed, 0x72,	0xe5, 0x0a,	0xe8, 0x32,	0x0b, 0x4b,		\
+	0xcd, 0x8a,	0x0f, 0x93,	0x10, 0xa3,	0xef, 0xa2,		\
+	0xe8, 0x22,	0x07, 0x1b,	0xe9, 0x42,	0x0c, 0x5b,		\
+	0xf2, 0xca,	0x48, 0x1b,	0x0a, 0x33,	0x2d, 0x63,		\
+	0x4d, 0x73,	0x11, 0xbb,	0x27, 0x0b,	0x2d, 0x7b,		\
+	0x0f, 0x8b,	0x12, 0xb3,	0x51, 0xab,	0x49, 0x23,		\
+	0x70, 0x9b,	0x68, 0x33,	0x6a, 0x43,	0x4a, 0x4b,		\
+	0x6f, 0x83,	0x6c, 0x63,	0x6f, 0x9b,	0x53, 0xcb,		\
+	0x72, 0xb3,	0xae, 0x73,	0x86, 0x13,	0x8a, 0x33,		\
+	0x8c, 0x53,	0xd1, 0x93,	0x8c, 0x43,	0x8d, 0x6b,		\
+	0x90, 0x8b,	0xb2, 0xc3,	0xa8, 0x13,	0xae, 0x5b,		\
+	0xcf, 0x7b,	0xef, 0x8b,	0xb2, 0xa3,	0xc9, 0x2b,		\
+	0xb1, 0xb3,	0x94, 0xd3,	0xc9, 0x1b,	0xe8, 0x03,		\
+	0xcb, 0x43,	0xd1, 0xa3,	0xee, 0x6b,	0xd3, 0xb3,		\
+	0xf4, 0xcb,	0x0b, 0x3c,	0x0d, 0x5c,	0x0e, 0x74,		\
+	0x15, 0xd4,	0x2c, 0x4c,	0x2a, 0x14,	0x2a, 0x24,		\
+	0x29, 0x14,	0x70, 0x8c,	0x30, 0x7c,	0x33, 0x9c,		\
+	0x33, 0xc4,	0x2c, 0x34,	0x71, 0x9c,	0x52, 0xa4,		\
+	0x53, 0xb4,	0x54, 0xac,	0x35, 0xc4,	0x4e, 0x54,		\
+	0x89, 0x0c,	0x2d, 0x44,	0x4e, 0x64,	0x6b, 0x34,		\
+	0x6f, 0x74,	0x95, 0xd4,	0xaa, 0x24,	0x8e, 0x4c,		\
+	0xae, 0x5c,	0x91, 0x74,	0x94, 0xbc,	0x8c, 0x44,		\
+	0x8f, 0x5c,	0x90, 0x6c,	0xb1, 0x8c,	0x8b, 0x14,		\
+	0xac, 0x24,	0xb3, 0xa4,	0xcb, 0x34,	0xd2, 0x84,		\
+	0xd3, 0x94,	0xac, 0x34,	0xce, 0x3c,	0xb5, 0xbc,		\
+	0xca, 0x0c,	0xf0, 0x6c,	0xd6, 0xc4,	0xd5, 0xa4,		\
+	0xf5, 0xb4,	0xee, 0x4c,	0x2f, 0x55,	0x31, 0x7d,		\
+	0x13, 0xa5,	0x34, 0xb5,	0x2b, 0x0d,	0x2a, 0x1d,		\
+	0x0d, 0x2d,	0x2c, 0x1d,	0xf0, 0x5c,	0x17, 0xcd,		\
+	0x4d, 0x3d,	0x2e, 0x3d,	0x32, 0x7d,	0x33, 0x95,		\
+	0x55, 0xa5,	0x56, 0xc5,	0x51, 0x65,	0x12, 0x6d,		\
+	0x00, 0x01, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x01, 0x02, 0x03,	\
+	0x07, 0x05, 0x12, 0x15, 0xff, 0x00, 0x00, 0x01, 0x03, 0x0c, 0x0e, 0x0c, 0x00, 0x00, 0x00, 0x00,	\
+	0x00, 0x02, 0x00, 0x03, 0x07, 0x04, 0x05, 0x0f, 0x15, 0x20, 0x21, 0x2b, 0x2e, 0x43, 0x4e, 0x4f,	\
+	0x63, 0x01, 0x06, 0x09, 0x0c, 0x12, 0x13, 0x1c, 0x1d, 0x25, 0x30, 0x39, 0x40, 0x46, 0x48, 0x0b,	\
+	0x0e, 0x10, 0x18, 0x1a, 0x29, 0x2f, 0x33, 0x41, 0x44, 0x47, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00,	\
+	0x00, 0x21, 0xa4, 0x2e, 0x0b, 0x02, 0x00, 0x0b, 0x13, 0x1a, 0x1e, 0x22, 0x29, 0x2a, 0x32, 0x36,	\
+	0x42, 0x47, 0x4b, 0x55, 0x5b, 0x5e, 0x60, 0x6b, 0x75, 0x7b, 0x80, 0x87, 0x8a, 0xa0, 0xa7, 0xa9,	\
+	0xbb, 0xbe, 0xc6, 0xc9, 0xd8, 0xda, 0xde, 0xe9, 0x00, 0x03, 0x05, 0x06, 0x07, 0x08, 0x0c, 0x0d,	\
+	0x0e, 0x0f, 0x11, 0x15, 0x17, 0x18, 0x19, 0x1d, 0x1f, 0x20, 0x24, 0x26, 0x27, 0x2c, 0x2e, 0x2f,	\
+	0x30, 0x31, 0x34, 0x35, 0x37, 0x39, 0x3a, 0x3b, 0x3d, 0x41, 0x43, 0x44, 0x45, 0x48, 0x4c, 0x4e,	\
+	0x4f, 0x50, 0x52, 0x53, 0x54, 0x57, 0x58, 0x59, 0x5a, 0x5c, 0x61, 0x62, 0x63, 0x64, 0x65, 0x67,	\
+	0x68, 0x6a, 0x6c, 0x6d, 0x6e, 0x6f, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76, 0x77, 0x7a, 0x7c, 0x7e,	\
+	0x7f, 0x81, 0x83, 0x84, 0x88, 0x89, 0x8c, 0x8d, 0x8e, 0x8f, 0x90, 0x91, 0x92, 0x94, 0x96, 0x97,	\
+	0x98, 0x99, 0x9a, 0x9b, 0x9c, 0x9d, 0x9e, 0x9f, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5, 0xa8, 0xaa, 0xab,	\
+	0xac, 0xad, 0xae, 0xaf, 0xb0, 0xb1, 0xb2, 0xb3, 0xb6, 0xb8, 0xb9, 0xba, 0xbc, 0xbd, 0xc1, 0xc2,	\
+	0xc3, 0xc4, 0xc5, 0xc7, 0xc8, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf, 0xd1, 0xd2, 0xd3, 0xd4, 0xd5,	\
+	0xd6, 0xd7, 0xd9, 0xdb, 0xdd, 0xdf, 0xe0, 0xe1, 0xe3, 0xe4, 0xe5, 0xe6, 0xe8, 0xea, 0xec, 0xed,	\
+	0xee, 0xef, 0xf0, 0xf1, 0xf3, 0xf4, 0xf5, 0xf8, 0xfa, 0xfb, 0xfc, 0xfd, 0x02, 0x04, 0x09, 0x0a,	\
+	0x12, 0x16, 0x1b, 0x1c, 0x21, 0x23, 0x25, 0x2b, 0x33, 0x38, 0x3c, 0x3e, 0x40, 0x49, 0x4a, 0x4d,	\
+	0x51, 0x56, 0x5d, 0x5f, 0x69, 0x79, 0x7d, 0x82, 0x86, 0x8b, 0x93, 0x95, 0xb4, 0xb5, 0xb7, 0xbf,	\
+	0xd0, 0xdc, 0xe2, 0xe7, 0xeb, 0xf2, 0xf6, 0xf7, 0xf9, 0xfe, 0x01, 0x10, 0x14, 0x3f, 0x46, 0x66,	\
+	0x78, 0x85, 0xa6, 0xc0, 0xff, 0x28, 0x2d, 0xcd, 0xa7, 0xcd, 0x42, 0xa9, 0xe3, 0x8c, 0xc2, 0x83,	\
+	0x49, 0x86, 0x61, 0x21, 0x71, 0x9b, 0xe9, 0x38, 0x2d, 0xf1, 0xca, 0x88, 0xf8, 0x5b, 0x34, 0x69,	\
+	0x5b, 0x92, 0x4c, 0x9a, 0xfc, 0x49, 0x6b, 0xeb, 0x64, 0xe0, 0x5e, 0x67, 0xcc, 0x42, 0xe6, 0x7e,	\
+	0x88, 0x5f, 0xf9, 0x09, 0x09, 0x45, 0x55, 0x4d, 0x55, 0x55, 0x79, 0x55, 0x7b, 0xb7, 0xdb, 0x5e,	\
+	0xfd, 0xfb, 0xeb, 0x6d, 0xed, 0x3f, 0xcb, 0x7f, 0xf2, 0xd2, 0xd3, 0x0a, 0xfa, 0xfb, 0x0a, 0xde,	\
+	0xfb, 0x0e, 0xfa, 0xf3, 0xfd, 0xbe, 0xc3, 0xff, 0x70, 0xb2, 0x33, 0x13, 0x13, 0x13, 0x1f, 0xe4,	\
+	0xc5, 0x65, 0x64, 0xaf, 0xba, 0xb2, 0xb2, 0xee, 0xb3, 0xdd, 0x73, 0x77, 0x95, 0xee, 0xb9, 0xb9,	\
+	0xca, 0xcf, 0xd6, 0xd6, 0xb9, 0xfa, 0xf0, 0x6b, 0x67, 0xeb, 0x6f, 0x7d, 0x7e, 0xa8, 0x5c, 0xcf,	\
+	0xd3, 0x98, 0xa2, 0x84, 0xa2, 0xa2, 0xa2, 0xaa, 0xaa, 0xa2, 0xaa, 0xaa, 0xab, 0xdf, 0x5e, 0x5e,	\
+	0xed, 0xaf, 0x34, 0xf6, 0xfb, 0xeb, 0x7d, 0xbf, 0xe5, 0xbd, 0xbd, 0xf7, 0xf9, 0x79, 0x69, 0x79,	\
+	0x85, 0x79, 0x7d, 0x7d, 0x79, 0x87, 0x87, 0x91, 0x87, 0x98, 0xfe, 0xe6, 0x24, 0x21, 0xe6, 0x2b,	\
+	0x26, 0x26, 0x2b, 0x26, 0x25, 0x6b, 0x2c, 0xab, 0x2c, 0xac, 0xbd, 0xd7, 0x75, 0x97, 0x77, 0x76,	\
+	0x57, 0x37, 0x79, 0x57, 0x39, 0xf9, 0xfa, 0xda, 0xdc, 0x1a, 0xdc, 0x1a, 0xdc, 0x08, 0x48, 0x48,	\
+	0x4a, 0x28, 0x4a, 0xca, 0x2a, 0x6a, 0x6a, 0xaa, 0xbd, 0xb5, 0x35, 0x55, 0xe5, 0x5e, 0xdf, 0x7f,	\
+	0xbf, 0xdf, 0xef, 0xb7, 0xb4, 0xff, 0x2e, 0xad, 0xed, 0x2d, 0xed, 0xef, 0x2d, 0xef, 0xaf, 0xae,	\
+	0xaf, 0xaf, 0x30, 0xf0, 0xef, 0xb0, 0xff, 0xdc, 0xac, 0x2c, 0x8c, 0xc4, 0x2f, 0xf7, 0xfe, 0x4a,	\
+	0xca, 0xd9, 0x4a, 0xca, 0xfb, 0xab, 0x3f, 0xcb, 0x2a, 0xca, 0xcf, 0x75, 0xd5, 0xdf, 0xc2, 0xe6,	\
+	0xeb, 0xe1, 0x77, 0xad, 0x9f, 0x9f, 0x9f, 0xf0, 0xca, 0xd0, 0xcf, 0xde, 0xfa, 0xf0, 0x73, 0x10,	\
+	0xf9, 0x8a, 0x2a, 0x28, 0x5f, 0xa2, 0x9a, 0x8a, 0x8a, 0x8a, 0x8a, 0xaa, 0xaa, 0xf7, 0x6d, 0x79,	\
+	0x7b, 0xbe, 0xbc, 0xbc, 0xde, 0xc1, 0xdf, 0x69, 0x69, 0xef, 0xb4, 0xf7, 0xda, 0x5a, 0x5d, 0x61,	\
+	0x61, 0xde, 0x7f, 0xb7, 0xd8, 0x79, 0x08, 0x79, 0x88, 0x79, 0x08, 0x79, 0x89, 0x59, 0x89, 0x09,	\
+	0x89, 0xdf, 0x74, 0xad, 0x65, 0x95, 0x65, 0xdd, 0x95, 0x97, 0xc3, 0xdd, 0x77, 0x73, 0x77, 0x77,	\
+	0x77, 0x73, 0x75, 0x9f, 0x9f, 0x9f, 0xad, 0xad, 0xbd, 0xbd, 0xf5, 0xcf, 0xe0, 0xde, 0xe6, 0x21,	\
+	0x21, 0x21, 0x21, 0x28, 0xab, 0x21, 0x29, 0xaa, 0xb0, 0x2b, 0x2a, 0xab, 0x2a, 0xaf, 0x2f, 0x2f,	\
+	0x76, 0xd6, 0xdb, 0xdb, 0xdb, 0xd6, 0xda, 0x5b, 0xdf, 0x56, 0xdd, 0x5f, 0x5d, 0x5b, 0xde, 0x5f,	\
+	0x61, 0x5e, 0x61, 0x5f, 0x61, 0x61, 0xe0, 0xa6, 0x24, 0x61, 0x61, 0xe0, 0xa6, 0x25, 0x65, 0x66,	\
+	0x27, 0x6c, 0x6b, 0x2b, 0x2e, 0x6b, 0x2e, 0x6c, 0xae, 0xeb, 0x2c, 0xac, 0x6e, 0xee, 0xee, 0x6e,	\
+	0xb2, 0xae, 0x6e, 0x72, 0xb2, 0xb3, 0xf3, 0xf2, 0xb3, 0xf7, 0xb8, 0x37, 0x90, 0xd0, 0xd0, 0x93,	\
+	0xd4, 0xd4, 0x54, 0x55, 0x54, 0xd4, 0xd4, 0xff, 0x75, 0x55, 0xb5, 0xe6, 0x95, 0x3e, 0xdb, 0x7f,	\
+	0x6d, 0x81, 0xbd, 0x81, 0xe5, 0xbd, 0xd5, 0xbd, 0xa5, 0xbd, 0xa5, 0xf6, 0x1d, 0xd5, 0xe5, 0xf6,	\
+	0x16, 0x16, 0x1e, 0x16, 0x16, 0x1e, 0x0a, 0x46, 0x16, 0x46, 0x46, 0x5a, 0x1e, 0x56, 0x56, 0x62,	\
+	0x42, 0x76, 0xb2, 0x56, 0xee, 0xb2, 0xca, 0xee, 0xe6, 0xee, 0xea, 0xeb, 0x2a, 0xea, 0xe6, 0xef,	\
+	0x3c, 0xe6, 0x86, 0x7e, 0x7e, 0x56, 0x86, 0x56, 0xf6, 0xf6, 0xfa, 0x1a, 0x1a, 0x1a, 0x9a, 0x8a,	\
+	0x9a, 0xb2, 0x8a, 0x9a, 0x8a, 0x7a, 0x9f, 0xee, 0xbc, 0xa6, 0xbc, 0xb6, 0xc0, 0xb6, 0xd3, 0xdf,	\
+	0x60, 0xed, 0xaf, 0x35, 0x34, 0xbc, 0xbc, 0xb5, 0x3c, 0xba, 0xb5, 0x41, 0x3a, 0xba, 0xc2, 0xc3,	\
+	0xc3, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xcc, 0x48, 0x48, 0xff, 0x92, 0x13, 0xb5, 0x93, 0xb6, 0x35,	\
+	0x96, 0x55, 0x96, 0x56, 0x35, 0x96, 0x56, 0x36, 0x57, 0x36, 0x57, 0x7f, 0x0b, 0xac, 0xfc, 0xfc,	\
+	0xfd, 0x6c, 0x7d, 0xec, 0xfd, 0xed, 0xed, 0x0c, 0xaf, 0xaa, 0x1f, 0x31, 0x0f, 0xf4, 0x43, 0x42,	\
+	0x43, 0x51, 0x53, 0x53, 0x53, 0x53, 0x56, 0x53, 0x5e, 0x5e, 0x5e, 0x5e, 0x5e, 0x5b, 0x69, 0x69,	\
+	0x5b, 0x75, 0x5b, 0x79, 0x79, 0x6a, 0x6f, 0x69, 0x79, 0x7d, 0x7d, 0x6a, 0x85, 0x79, 0x79, 0x85,	\
+	0x95, 0x85, 0x91, 0x91, 0x91, 0x90, 0x95, 0x91, 0x91, 0x91, 0x91, 0x95, 0xb2, 0x95, 0xff, 0x27,	\
+	0x6b, 0x27, 0x6c, 0xae, 0x6e, 0x67, 0x6e, 0x6c, 0x8e, 0x5c, 0xdd, 0x65, 0x67, 0xdd, 0x67, 0xdd,	\
+	0x6f, 0x67, 0xf0, 0x67, 0xe5, 0x68, 0x6f, 0x70, 0xf3, 0x10, 0xd0, 0xd0, 0xd4, 0x50, 0xd4, 0x14,	\
+	0x55, 0x95, 0x56, 0x54, 0xd7, 0x95, 0x54, 0x16, 0xd5, 0x58, 0x1a, 0x7b, 0x6d, 0x2b, 0x6d, 0x2c,	\
+	0x0e, 0xad, 0xee, 0xad, 0x2d, 0x2e, 0xae, 0xaf, 0x2e, 0xaf, 0x30, 0x50, 0xf0, 0xf0, 0xb0, 0xb2,	\
+	0x12, 0x12, 0x10, 0x52, 0x12, 0x33, 0xf2, 0x32, 0xb2, 0x12, 0xb2, 0xb2, 0xb3, 0xf5, 0x95, 0x96,	\
+	0x56, 0x56, 0x36, 0x56, 0x58, 0xf7, 0x37, 0x57, 0x56, 0x5a, 0x17, 0x57, 0x3f, 0x2d, 0x0d, 0x0c,	\
+	0xad, 0xec, 0x7e, 0x0c, 0xfd, 0xed, 0xf4, 0x34, 0x35, 0x15, 0x14, 0x34, 0xf5, 0x35, 0x65, 0x35,	\
+	0x65, 0x65, 0xe5, 0x35, 0xb5, 0xe5, 0xb6, 0x05, 0x36, 0x55, 0xb6, 0x96, 0x56, 0x96, 0x57, 0x56,	\
+	0xa7, 0x56, 0xa8, 0x27, 0x97, 0x57, 0x57, 0x97, 0x98, 0x58, 0x58, 0x28, 0x29, 0x07, 0x99, 0x18,	\
+	0x59, 0x09, 0xd9, 0x59, 0x09, 0x19, 0x59, 0x59, 0xd9, 0xf9, 0x5b, 0x1b, 0x19, 0xdb, 0x1b, 0x1a,	\
+	0xcb, 0x9b, 0x2b, 0xbb, 0x1c, 0x7b, 0x9b, 0xac, 0xfd, 0x0c, 0xfc, 0xaf, 0x96, 0x7e, 0x56, 0x87,	\
+	0x06, 0x87, 0x07, 0x06, 0xf7, 0x31, 0x0d, 0x0d, 0x0d, 0x45, 0x4d, 0x59, 0x3d, 0x41, 0x4d, 0x45,	\
+	0x79, 0x41, 0x4d, 0x6d, 0x79, 0x6d, 0x95, 0x83, 0xb6, 0xc1, 0xdb, 0x66, 0x75, 0xef, 0xb5, 0x35,	\
+	0x3a, 0xb4, 0xbb, 0x3c, 0xbb, 0x3c, 0xbb, 0x42, 0xbc, 0xbb, 0x48, 0x12, 0x91, 0x82, 0x91, 0x90,	\
+	0x87, 0x96, 0x90, 0x95, 0x9d, 0x95, 0xb1, 0xb2, 0xb2, 0x9d, 0xb1, 0xba, 0x9d, 0xba, 0x2f, 0x63,	\
+	0x63, 0x75, 0x75, 0xf0, 0xc7, 0xcf, 0xc7, 0xc7, 0xba, 0xf9, 0x67, 0xe3, 0xeb, 0x63, 0xe5, 0x68,	\
+	0x6f, 0x6f, 0xf0, 0xa1, 0xa1, 0xa8, 0xa1, 0xa8, 0x27, 0xab, 0x29, 0xa7, 0xa8, 0xa7, 0xa8, 0xa8,	\
+	0x29, 0xa8, 0x28, 0x30, 0x2d, 0xb5, 0x2d, 0xb5, 0x35, 0x30, 0x30, 0x3a, 0xb5, 0x3c, 0xb5, 0x3a,	\
+	0xba, 0xbc, 0xc1, 0x3c, 0xbb, 0x3a, 0xc4, 0x43, 0xbc, 0xc1, 0x48, 0xfa, 0x24, 0x24, 0x25, 0xa5,	\
+	0x64, 0x27, 0xe7, 0xfd, 0x13, 0xb3, 0xb3, 0xf6, 0x33, 0xb6, 0x53, 0xb6, 0x33, 0xb6, 0x57, 0x57,	\
+	0x57, 0x57, 0x57, 0x56, 0xfa, 0x1a, 0x18, 0xfa, 0x18, 0xff, 0x2d, 0x0d, 0x0d, 0xed, 0xfe, 0x0e,	\
+	0x0d, 0xe4, 0x3e, 0x6f, 0x35, 0x0d, 0x59, 0x45, 0x59, 0x59, 0x59, 0x59, 0x59, 0x6d, 0x79, 0x41,	\
+	0x6d, 0x41, 0x6d, 0x79, 0x6d, 0xa9, 0xa5, 0x6d, 0xd5, 0x95, 0x95, 0xa9, 0xd9, 0xa9, 0xd9, 0xd5,	\
+	0xd9, 0xd6, 0x22, 0x16, 0x0b, 0xd1, 0x11, 0x05, 0x2d, 0x05, 0x20, 0x4a, 0x42, 0x76, 0x42, 0x42,	\
+	0x7e, 0x7e, 0x74, 0xbc, 0xed, 0x8d, 0x8c, 0xe9, 0x7b, 0x12, 0xf7, 0x27, 0x0e, 0x59, 0x5d, 0x1c,	\
+	0xc7, 0x39, 0x73, 0x73, 0x95, 0x95, 0x95, 0xa1, 0xf2, 0xde, 0xd4, 0xdf, 0xf9, 0x7c, 0xb8, 0x50,	\
+	0xd0, 0xd0, 0xd0, 0xf9, 0xa9, 0xe8, 0x6a, 0xca, 0x0a, 0xcb, 0x69, 0xea, 0x0a, 0xcb, 0xcc, 0xcb,	\
+	0xcc, 0xab, 0xcc, 0x0c, 0xac, 0xcb, 0x6c, 0x0c, 0x0f, 0x2d, 0x4d, 0x4f, 0x2e, 0xb0, 0x4e, 0xce,	\
+	0xce, 0xd0, 0x4e, 0xce, 0xd2, 0x3e, 0x88, 0x29, 0x09, 0x0f, 0x44, 0x87, 0xa2, 0x7e, 0x56, 0x42,	\
+	0x56, 0x7e, 0x7e, 0x54, 0xb9, 0x7b, 0x2b, 0x22, 0xe5, 0xec, 0xae, 0xad, 0xee, 0xae, 0xac, 0x74,	\
+	0x0e, 0x5d, 0x1c, 0xc7, 0xd0, 0xd0, 0xd0, 0xd0, 0xd4, 0xf9, 0x6f, 0xf0, 0x6f, 0xf3, 0x53, 0xd3,	\
+	0xd3, 0xd3, 0xd5, 0x93, 0xd5, 0x94, 0xd4, 0x14, 0x54, 0xd6, 0xd6, 0x56, 0x56, 0x56, 0xd8, 0x18,	\
+	0x16, 0x5a, 0x9a, 0x9a, 0x99, 0x9e, 0x5a, 0x9a, 0x9d, 0x9d, 0x9a, 0x9d, 0x9d, 0x47, 0x41, 0x41,	\
+	0x0e, 0x79, 0x25, 0x21, 0x05, 0x05, 0x2d, 0x2d, 0xe8, 0x90, 0x96, 0x96, 0x9d, 0x9d, 0x96, 0x95,	\
+	0x2f, 0x3b, 0x6e, 0x5e, 0xc8, 0xe1, 0x72, 0xe7, 0x2c, 0x8e, 0x5d, 0x5b, 0xdc, 0xdd, 0x5b, 0xe3,	\
+	0xe8, 0x7c, 0xb5, 0x34, 0x3e, 0x5a, 0x9b, 0xf9, 0x5b, 0xfc, 0x28, 0x68, 0x6a, 0x0a, 0x2a, 0xc9,	\
+	0xfc, 0xd4, 0xf5, 0xb4, 0x55, 0x95, 0x05, 0xb5, 0x05, 0x66, 0x56, 0xa0, 0xec, 0xac, 0xcc, 0x0c,	\
+	0x0c, 0xcd, 0x4c, 0x0e, 0xce, 0xcd, 0x4d, 0x4e, 0xae, 0xd0, 0x51, 0x0e, 0xb1, 0x11, 0x10, 0x52,	\
+	0x1e, 0x8f, 0x41, 0x2f, 0x44, 0xfc, 0x8c, 0xec, 0xfc, 0xfc, 0xf9, 0x72, 0xf3, 0xf3, 0xf3, 0xb3,	\
+	0xa5, 0xcb, 0xdd, 0x59, 0x5d, 0x63, 0x9c, 0xb1, 0xba, 0xc7, 0x39, 0x8f, 0xa1, 0x95, 0x8f, 0x8f,	\
+	0x9b, 0xa9, 0xa9, 0xa9, 0xbf, 0xbf, 0xbf, 0xbe, 0x87, 0xcd, 0xe6, 0xa2, 0x27, 0xa7, 0xa8, 0x73,	\
+	0x54, 0x13, 0xd6, 0x55, 0x94, 0x15, 0x96, 0x54, 0x19, 0x56, 0xd8, 0x19, 0x59, 0x9b, 0x19, 0x59,	\
+	0x9a, 0x9a, 0x9d, 0x5d, 0x9d, 0x87, 0x3b, 0x35, 0x3c, 0xc4, 0x41, 0x41, 0x41, 0x41, 0x48, 0x48,	\
+	0x48, 0xce, 0xc8, 0x44, 0x4b, 0x4f, 0xce, 0xc8, 0x17, 0x9f, 0x96, 0x9f, 0x2e, 0x5e, 0xdc, 0xbd,	\
+	0x45, 0xbd, 0xbd, 0xd1, 0x7c, 0x7b, 0x1c, 0x73, 0x98, 0xfa, 0x9f, 0x2d, 0x4d, 0x0f, 0x96, 0x86,	\
+	0x86, 0xa7, 0xcb, 0x87, 0x7f, 0x7f, 0x9a, 0xa0, 0x86, 0x9e, 0x8a, 0xa0, 0x9e, 0xa1, 0xd4, 0x5e,	\
+	0x4f, 0x59, 0x5b, 0x59, 0xea, 0x32, 0xb0, 0x07, 0x60, 0x59, 0x59, 0x6a, 0x65, 0x65, 0x76, 0x6a,	\
+	0x65, 0x76, 0x79, 0x79, 0x1c, 0xec, 0x39, 0xd9, 0xdf, 0xd0, 0x3a, 0x08, 0x91, 0x2f, 0x47, 0xa0,	\
+	0x94, 0xff, 0xa0, 0x94, 0xb4, 0xb4, 0xb1, 0x72, 0xe5, 0xcb, 0xce, 0xcf, 0xd8, 0x97, 0xba, 0x2e,	\
+	0x5c, 0xe5, 0xd5, 0xbe, 0x3d, 0xd1, 0xcc, 0x7c, 0xdd, 0x0c, 0x73, 0x99, 0xbf, 0x2d, 0xfd, 0x4d,	\
+	0x4d, 0x4e, 0x14, 0x34, 0x44, 0xfe, 0xa2, 0x7a, 0x2f, 0x51, 0x17, 0x9a, 0xa0, 0xb2, 0xa1, 0xd4,	\
+	0x59, 0x59, 0x59, 0x65, 0x59, 0x59, 0x65, 0x66, 0x66, 0x66, 0x66, 0x6c, 0x65, 0x6c, 0x6c, 0x6a,	\
+	0x76, 0x1c, 0x39, 0xd8, 0x74, 0x29, 0x28, 0x81, 0xd2, 0x10, 0x52, 0x12, 0xd3, 0xa4, 0xa7, 0x67,	\
+	0xe8, 0x0b, 0x97, 0x9f, 0x96, 0xb1, 0xb1, 0x2f, 0x41, 0x6e, 0x5e, 0xe8, 0xe1, 0xc3, 0x87, 0x0e,	\
+	0x1c, 0xba, 0x39, 0xa9, 0xa1, 0x8a, 0x73, 0x7f, 0x53, 0x43, 0x37, 0x53, 0x53, 0x7f, 0x79, 0x0d,	\
+	0x11, 0x0d, 0x11, 0x15, 0x17, 0x9b, 0xcd, 0x0e, 0xb2, 0xb2, 0xb2, 0x9e, 0xb2, 0xa0, 0x1d, 0x65,	\
+	0x94, 0x3a, 0xcb, 0x28, 0x77, 0x66, 0x56, 0x51, 0xcd, 0x8d, 0x8e, 0xcd, 0x8e, 0xc4, 0x9d, 0xa2,	\
+	0x22, 0x20, 0xa2, 0x09, 0x48, 0x12, 0x88, 0x90, 0x25, 0x21, 0x43, 0x2d, 0x2d, 0x3f, 0x41, 0x2d,	\
+	0x3e, 0x5e, 0xcc, 0xbd, 0xbd, 0xbd, 0x89, 0x73, 0x85, 0xce, 0x63, 0x9c, 0xb8, 0xc5, 0xf9, 0x63,	\
+	0xe2, 0xfc, 0xb5, 0x7e, 0x5a, 0xbc, 0x3a, 0x9b, 0xfc, 0x3a, 0xbc, 0x28, 0x9c, 0xd4, 0x4e, 0x6a,	\
+	0x22, 0x82, 0x7a, 0x2a, 0x82, 0x2a, 0xca, 0x82, 0xca, 0x82, 0x83, 0x2a, 0xcb, 0x33, 0x53, 0x53,	\
+	0x63, 0x53, 0x2f, 0x75, 0xa8, 0x73, 0x60, 0xe6, 0xa6, 0xc1, 0xc3, 0x87, 0x44, 0x12, 0x88, 0x88,	\
+	0x82, 0x25, 0x10, 0x4a, 0x5a, 0x5a, 0x4a, 0x42, 0x7e, 0x5a, 0x58, 0xbd, 0x01, 0x79, 0x62, 0xf5,	\
+	0x05, 0xcb, 0xd9, 0xd8, 0xdb, 0xd8, 0xe2, 0xdb, 0x9c, 0xc7, 0x39, 0x8e, 0x73, 0x1f, 0xe5, 0xa9,	\
+	0xab, 0x9b, 0x9b, 0xab, 0xbf, 0xb3, 0xab, 0xbe, 0x8b, 0xcd, 0x44, 0x45, 0x44, 0x45, 0x45, 0x59,	\
+	0xea, 0x75, 0x14, 0x14, 0x03, 0x87, 0x66, 0x0e, 0x1d, 0x99, 0x99, 0x9b, 0xba, 0xd4, 0xd8, 0xd4,	\
+	0xd8, 0xcc, 0xcc, 0x38, 0x70, 0xe7, 0x78, 0x88, 0x88, 0x87, 0x68, 0x87, 0x92, 0x44, 0xa2, 0x09,	\
+	0x4b, 0x4b, 0x12, 0x9f, 0x92, 0x96, 0x96, 0xa0, 0x96, 0xa8, 0xb1, 0x2f, 0x67, 0x6f, 0x6f, 0x6e,	\
+	0x70, 0xbd, 0xb9, 0xc3, 0x87, 0x31, 0xee, 0x31, 0x75, 0x4e, 0x5b, 0xe6, 0xea, 0xe8, 0x63, 0xea,	\
+	0xea, 0xef, 0xfe, 0x38, 0x51, 0x11, 0x53, 0xd1, 0x55, 0x91, 0x79, 0xa8, 0xeb, 0x2b, 0x3d, 0x40,	\
+	0xe1, 0xd9, 0x43, 0xb2, 0x87, 0x66, 0x65, 0x0e, 0xcb, 0xdd, 0x65, 0xee, 0x8e, 0x6c, 0x1c, 0xd8,	\
+	0x39, 0xdc, 0x70, 0xe8, 0x88, 0x82, 0x44, 0x89, 0x44, 0x12, 0x96, 0x24, 0x4a, 0x5a, 0x82, 0x4a,	\
+	0x48, 0xbd, 0x05, 0x44, 0xec, 0xb1, 0x7a, 0x02, 0xf4, 0x16, 0x76, 0xf4, 0x15, 0x17, 0x16, 0x27,	\
+	0x2d, 0xee, 0x31, 0xce, 0x63, 0xea, 0x66, 0xfc, 0xb3, 0x75, 0x75, 0x77, 0xf5, 0x78, 0x75, 0x78,	\
+	0x51, 0x11, 0x11, 0x11, 0x51, 0xba, 0x88, 0xab, 0x28, 0xbd, 0x45, 0x00, 0xeb, 0x2a, 0x1d, 0xd0,	\
+	0xec, 0xcc, 0xc1, 0xd9, 0x58, 0x7b, 0xbd, 0xd6, 0x51, 0xdd, 0xd7, 0x61, 0xce, 0xc3, 0x9d, 0xdb,	\
+	0x07, 0x12, 0x77, 0x24, 0x38, 0x9c, 0xb1, 0x29, 0x22, 0x54, 0x12, 0xd4, 0x14, 0x12, 0x54, 0x05,	\
+	0x25, 0xa8, 0x65, 0xaa, 0x0b, 0x97, 0xb3, 0x39, 0x67, 0x6e, 0x72, 0xcf, 0x2f, 0x34, 0xe6, 0x3e,	\
+	0x6d, 0xc5, 0xc6, 0xa6, 0x6e, 0xa6, 0xa6, 0xae, 0xae, 0xaf, 0x0f, 0x0e, 0xa2, 0x22, 0x22, 0x2f,	\
+	0x35, 0x1b, 0xa8, 0x8b, 0xd4, 0x45, 0x0f, 0xd4, 0x50, 0x0e, 0x14, 0x3f, 0x75, 0x64, 0x3f, 0x7b,	\
+	0xba, 0xca, 0xd8, 0x1d, 0xb1, 0xc1, 0xb1, 0xc1, 0xc1, 0xdc, 0x73, 0xbb, 0x64, 0x14, 0x44, 0x40,	\
+	0xe2, 0x51, 0x11, 0x12, 0x52, 0x52, 0xd2, 0xd2, 0x52, 0x44, 0xe5, 0xa5, 0xa8, 0x4a, 0x59, 0xd4,	\
+	0x17, 0xb3, 0xa1, 0x2f, 0x71, 0x6f, 0x71, 0x67, 0x8b, 0x6e, 0x70, 0xe5, 0xc6, 0x2e, 0x69, 0xcd,	\
+	0x43, 0x9b, 0x3a, 0x9a, 0xbb, 0x3c, 0x3c, 0x3b, 0x3c, 0x3c, 0xd4, 0x44, 0x64, 0x74, 0xf4, 0x64,	\
+	0x74, 0x74, 0x54, 0x50, 0xfd, 0x44, 0x54, 0x55, 0x90, 0xec, 0xc1, 0xd8, 0x43, 0xf7, 0x58, 0x5b,	\
+	0x1b, 0x1b, 0x3b, 0xa3, 0x9b, 0x1b, 0x1c, 0x07, 0x44, 0x13, 0x1c, 0x4c, 0x93, 0xbc, 0x97, 0xa0,	\
+	0x91, 0x22, 0x65, 0x25, 0xa4, 0xa8, 0x4a, 0x4b, 0x50, 0x50, 0x50, 0x50, 0x5b, 0xd4, 0x59, 0xdc,	\
+	0x59, 0xd9, 0xe2, 0xdc, 0x5b, 0xdb, 0xdc, 0x62, 0xe6, 0x9c, 0xc4, 0xcd, 0xcb, 0xcd, 0xcd, 0xcd,	\
+	0xd5, 0xd5, 0xd9, 0xcd, 0xe1, 0xd9, 0x44, 0x46, 0x45, 0x45, 0x44, 0x45, 0x45, 0xea, 0x07, 0x0a,	\
+	0x1c, 0x38, 0x56, 0x60, 0xad, 0x5d, 0xd0, 0xe1, 0xfb, 0xcc, 0xae, 0x0c, 0x2c, 0x2c, 0x23, 0x9c,	\
+	0x1b, 0x07, 0x0e, 0x77, 0x1c, 0xee, 0xef, 0x10, 0x4c, 0x9c, 0x44, 0x91, 0x42, 0x44, 0xe4, 0x8a,	\
+	0x50, 0xc9, 0x4f, 0xd0, 0x54, 0x50, 0x14, 0xa8, 0xa1, 0xa8, 0xa0, 0xb3, 0xb7, 0xb3, 0xb3, 0xb8,	\
+	0xb8, 0xb7, 0x38, 0x70, 0xee, 0x6e, 0xae, 0xae, 0xa6, 0x6e, 0x6e, 0xcf, 0xe3, 0x53, 0xf1, 0xb3,	\
+	0xab, 0xaa, 0x88, 0x88, 0x8c, 0x8b, 0xce, 0x45, 0x45, 0x45, 0xea, 0x07, 0x0a, 0x1d, 0x41, 0x84,	\
+	0x38, 0x70, 0xfd, 0xe6, 0x57, 0x07, 0x0e, 0xf3, 0x63, 0x83, 0x83, 0xbb, 0xb8, 0xe1, 0xc3, 0x47,	\
+	0x3e, 0x12, 0x24, 0x38, 0x99, 0x27, 0x72, 0x52, 0x44, 0xc9, 0xc9, 0x49, 0x13, 0x28, 0x50, 0xa5,	\
+	0x45, 0x05, 0x05, 0x05, 0x45, 0xbd, 0x45, 0x3d, 0x3d, 0xc5, 0xbe, 0x2d, 0xbd, 0x9d, 0xc5, 0xc6,	\
+	0x6e, 0x59, 0xcb, 0x8c, 0xdd, 0x5c, 0xdd, 0x9c, 0xbd, 0x9d, 0x5e, 0x1d, 0xad, 0x94, 0x44, 0x54,	\
+	0x64, 0x54, 0x54, 0x74, 0x54, 0x70, 0xe8, 0xeb, 0x21, 0x43, 0x87, 0x61, 0x0a, 0xd8, 0x14, 0x2f,	\
+	0x77, 0xbb, 0xde, 0x61, 0x6c, 0xee, 0xbb, 0x30, 0x8e, 0x1a, 0x39, 0xdd, 0xdc, 0x90, 0xd2, 0x4e,	\
+	0xe4, 0x89, 0xbb, 0xc9, 0x12, 0x27, 0x25, 0x41, 0x43, 0x42, 0x52, 0x5a, 0x82, 0x86, 0xa2, 0x84,	\
+	0xa5, 0x0d, 0x3d, 0x45, 0x9d, 0x3d, 0x9d, 0x9e, 0x25, 0x6d, 0xc6, 0x3e, 0x2e, 0x6e, 0x2e, 0x26,	\
+	0x26, 0x6e, 0x5e, 0x6e, 0x6e, 0xce, 0x6e, 0xae, 0xcf, 0x0a, 0x27, 0x39, 0x11, 0x15, 0x19, 0x1c,	\
+	0x2f, 0x51, 0x1f, 0xa8, 0x14, 0x2a, 0x38, 0x50, 0xe1, 0x42, 0xb3, 0x07, 0x6c, 0x61, 0xee, 0xb0,	\
+	0xf7, 0x5d, 0xd8, 0x5c, 0x07, 0x3b, 0x8e, 0x1a, 0xf8, 0x30, 0x93, 0xb9, 0x28, 0x31, 0xc5, 0x09,	\
+	0xc9, 0x13, 0x27, 0x2c, 0x4e, 0x4a, 0x86, 0x86, 0x86, 0xa2, 0x86, 0xa2, 0x9e, 0xce, 0xe2, 0xa2,	\
+	0x9e, 0xe2, 0xce, 0xcf, 0x16, 0xe3, 0x16, 0xdf, 0x17, 0x13, 0x10, 0xee, 0x6e, 0x69, 0xdd, 0x9d,	\
+	0x9d, 0x9d, 0xad, 0xae, 0x1d, 0x94, 0x64, 0x64, 0x54, 0x74, 0x64, 0x74, 0x64, 0x54, 0x70, 0xa1,	\
+	0xc3, 0xb0, 0xb0, 0xf7, 0x59, 0xbb, 0xcc, 0x2c, 0x2c, 0x2e, 0x01, 0x58, 0x44, 0xb8, 0x3b, 0x89,	\
+	0x7c, 0x77, 0x77, 0x1a, 0x39, 0xf1, 0xf1, 0xdd, 0xf8, 0x99, 0x32, 0x64, 0x89, 0x94, 0x28, 0x50,	\
+	0xa5, 0x01, 0x4a, 0x1a, 0x1a, 0x0a, 0x12, 0x94, 0xf7, 0x14, 0x15, 0x16, 0x66, 0xac, 0xf1, 0x0d,	\
+	0x54, 0x62, 0xe5, 0xe2, 0xdc, 0x66, 0xe6, 0xe2, 0xe5, 0xec, 0xe6, 0xe5, 0xec, 0xe5, 0xfe, 0x36,	\
+	0x76, 0x51, 0x11, 0x91, 0x91, 0x91, 0x51, 0xc2, 0x85, 0x0a, 0x15, 0x1c, 0x38, 0x74, 0x70, 0xe1,	\
+	0x42, 0x85, 0x70, 0xef, 0x30, 0x8e, 0x70, 0x61, 0x70, 0x70, 0x1a, 0xe0, 0x35, 0xf0, 0x68, 0xd2,	\
+	0x44, 0xc6, 0x92, 0x26, 0x4e, 0x48, 0x99, 0x42, 0x64, 0xca, 0x14, 0xa0, 0x28, 0x52, 0x8a, 0x9e,	\
+	0x9e, 0x9e, 0x9e, 0xa2, 0xb6, 0x86, 0x9e, 0xe2, 0xa2, 0xe3, 0x17, 0x13, 0x14, 0xd6, 0x2e, 0x5e,	\
+	0x26, 0x5e, 0xae, 0x5e, 0x5e, 0xce, 0xce, 0xce, 0xae, 0xcf, 0x0e, 0xca, 0x3a, 0x32, 0x3a, 0x38,	\
+	0x00, 0xa8, 0xa8, 0xe1, 0xc2, 0xf5, 0x02, 0x05, 0x0b, 0xde, 0x0a, 0x14, 0x2b, 0x0b, 0x08, 0x91,	\
+	0xac, 0x3d, 0xe7, 0x01, 0x2e, 0x02, 0x47, 0x3e, 0x0e, 0x7c, 0x70, 0x77, 0x26, 0xfc, 0xf8, 0xf9,	\
+	0x06, 0x4d, 0xf0, 0xa1, 0x42, 0x85, 0x0a, 0x14, 0xa8, 0xa1, 0xa7, 0xa1, 0xb3, 0xa1, 0xa7, 0xa1,	\
+	0xb8, 0xa7, 0xb8, 0xc5, 0xb8, 0xb3, 0xb3, 0xb8, 0xc4, 0xc4, 0x35, 0x89, 0x88, 0x77, 0x2f, 0x67,	\
+	0x67, 0x57, 0x2f, 0xed, 0xb3, 0xb3, 0xf8, 0x44, 0x46, 0x00, 0x8e, 0x8f, 0xce, 0xe7, 0x23, 0x80,	\
+	0x0a, 0x8e, 0x14, 0x28, 0x50, 0xbd, 0x8e, 0xeb, 0x08, 0x5e, 0xf3, 0x83, 0x87, 0x79, 0xc1, 0xdc,	\
+	0x68, 0x97, 0xc7, 0xc1, 0xa3, 0x1f, 0x06, 0x93, 0x7e, 0x7c, 0x7c, 0x26, 0xf8, 0xfd, 0x27, 0x06,	\
+	0x4e, 0x4c, 0xa1, 0x42, 0x72, 0x75, 0xb5, 0x14, 0x34, 0x55, 0x15, 0x17, 0x14, 0x46, 0xa9, 0xf1,	\
+	0x0d, 0x5c, 0x1a, 0xb8, 0xc4, 0x35, 0x89, 0x70, 0x77, 0xe3, 0xf1, 0x3a, 0x77, 0x2f, 0x6b, 0x6b,	\
+	0x6b, 0x6b, 0x69, 0x19, 0x19, 0x19, 0x19, 0x1d, 0x1f, 0x9d, 0xce, 0x47, 0x0a, 0xc2, 0x1c, 0x4f,	\
+	0xf0, 0x17, 0xbc, 0x15, 0x85, 0x87, 0xb0, 0xe0, 0x25, 0xdc, 0x48, 0xd7, 0x07, 0xc1, 0xa3, 0x46,	\
+	0xc1, 0xbe, 0x3e, 0x0d, 0x1c, 0x4c, 0x69, 0x48, 0x32, 0x65, 0x09, 0x93, 0x28, 0x4e, 0x4e, 0x4c,	\
+	0xa5, 0x3c, 0x9d, 0x15, 0x45, 0x15, 0x3d, 0x15, 0x9d, 0x9d, 0x3e, 0x2d, 0xc5, 0x41, 0xac, 0x4c,	\
+	0xd3, 0xb9, 0xa7, 0x72, 0xf1, 0x31, 0x0e, 0xe5, 0x9d, 0xd9, 0xd9, 0x3b, 0xb2, 0x75, 0x1b, 0x9c,	\
+	0x01, 0x19, 0x1d, 0x1c, 0x28, 0x5e, 0x70, 0x7f, 0xff, 0xff, 0xd1, 0xfb, 0x1d, 0xe0, 0xbd, 0x81,	\
+	0x3d, 0xee, 0xf0, 0x91, 0xac, 0x22, 0x44, 0xbb, 0x8d, 0x12, 0x34, 0x6b, 0xb9, 0x21, 0xb0, 0x63,	\
+	0x4a, 0x3f, 0x0d, 0x29, 0x0d, 0x0c, 0x50, 0xa4, 0x34, 0x9d, 0x05, 0x3c, 0x99, 0x4a, 0x2a, 0x1a,	\
+	0x8a, 0xda, 0x7b, 0x83, 0x46, 0x8d, 0x53, 0x9a, 0x35, 0x88, 0x6b, 0x2c, 0xd6, 0x26, 0x59, 0xaf,	\
+	0x89, 0xd3, 0xbb, 0x3b, 0x3b, 0x3b, 0x5b, 0x3b, 0x5b, 0x5c, 0xe4, 0x64, 0x64, 0x60, 0x08, 0xe8,	\
+	0xe1, 0x42, 0x80, 0x0a, 0x14, 0x28, 0x51, 0x3d, 0x86, 0x10, 0x82, 0x5c, 0x04, 0x89, 0x1a, 0x35,	\
+	0xec, 0x48, 0x91, 0xa3, 0x60, 0xc6, 0xbe, 0x3f, 0x0d, 0x7c, 0x27, 0x06, 0xfd, 0x06, 0x50, 0x9c,	\
+	0x19, 0x49, 0x3a, 0x09, 0x3a, 0x7a, 0x7a, 0x19, 0x3a, 0x9a, 0x2a, 0x2a, 0x7a, 0x2a, 0xd3, 0x54,	\
+	0xe6, 0x8d, 0x56, 0x9a, 0xa7, 0xcb, 0xb8, 0xcb, 0x3b, 0x8d, 0x96, 0x74, 0xee, 0xd1, 0xd3, 0xbf,	\
+	0x6d, 0xad, 0xad, 0xa4, 0x60, 0x08, 0xe1, 0x39, 0xc1, 0x02, 0x80, 0x09, 0xd8, 0x0a, 0x10, 0x20,	\
+	0x51, 0x3d, 0xe6, 0x1f, 0xe3, 0xf8, 0x12, 0x34, 0x4f, 0xf0, 0x30, 0x68, 0xd7, 0x01, 0x23, 0x20,	\
+	0xdf, 0x9f, 0x86, 0xbf, 0x0d, 0x83, 0x28, 0xfd, 0x07, 0x0d, 0x26, 0x4e, 0x0e, 0x0e, 0x4e, 0x32,	\
+	0x4e, 0x86, 0x4e, 0x9e, 0x9e, 0x9e, 0x8a, 0x9c, 0xd5, 0xc1, 0xa3, 0x57, 0x06, 0x8d, 0x1d, 0xc4,	\
+	0xc4, 0xc4, 0xc4, 0xb8, 0xcd, 0xc6, 0xd9, 0x3a, 0x74, 0xee, 0xd1, 0xd4, 0x1b, 0x5f, 0x64, 0x64,	\
+	0x7e, 0x78, 0x0e, 0x72, 0x38, 0x40, 0x88, 0xe0, 0x02, 0x87, 0x08, 0x10, 0x48, 0x9e, 0xc3, 0x0a,	\
+	0xc7, 0x7b, 0xf8, 0x1a, 0x24, 0x48, 0xd1, 0x8e, 0x0e, 0x63, 0x5f, 0x9f, 0x86, 0xbd, 0xc1, 0xbf,	\
+	0x13, 0x86, 0x83, 0x83, 0x83, 0x29, 0x19, 0x42, 0x52, 0x32, 0x86, 0x4e, 0x8a, 0x4e, 0x4e, 0x8a,	\
+	0x9e, 0x9e, 0x8a, 0x9e, 0x8a, 0xb6, 0xb6, 0xb4, 0xd1, 0xa3, 0x46, 0x8d, 0x1d, 0xf8, 0xe3, 0x1d,	\
+	0x3a, 0x77, 0x68, 0xe9, 0xd4, 0x1f, 0x6d, 0xa3, 0xbf, 0x9e, 0x7f, 0x3b, 0x9e, 0x8e, 0x01, 0x1c,	\
+	0x00, 0x50, 0x88, 0xe1, 0x02, 0x05, 0x08, 0x14, 0x2f, 0xf1, 0xd8, 0x61, 0x19, 0xfc, 0x36, 0x8d,	\
+	0xfe, 0x06, 0x3e, 0x3e, 0x0d, 0x70, 0x1a, 0x30, 0x6b, 0xe3, 0xe4, 0x19, 0x31, 0xb2, 0x70, 0xd0,	\
+	0x70, 0x72, 0x70, 0xc5, 0x24, 0xe8, 0x68, 0x8a, 0x49, 0xd6, 0xd1, 0x54, 0x51, 0x53, 0x9a, 0xad,	\
+	0xa7, 0x35, 0x44, 0x6a, 0xb7, 0x18, 0xd6, 0x25, 0x69, 0xac, 0xbc, 0x84, 0x07, 0x4e, 0xfc, 0x7e,	\
+	0x27, 0x4e, 0xfd, 0xb6, 0xbe, 0xdc, 0xee, 0x7a, 0x30, 0x00, 0x09, 0x09, 0x01, 0x42, 0x04, 0x0a,	\
+	0x10, 0x4b, 0x08, 0x45, 0x8e, 0xf0, 0x91, 0x22, 0x5b, 0x7f, 0x81, 0x82, 0x44, 0x8c, 0x6d, 0x18,	\
+	0x34, 0x63, 0xdb, 0xdc, 0x1b, 0xdb, 0xf4, 0x1c, 0x34, 0x1c, 0x99, 0x4f, 0x54, 0x34, 0x1c, 0x31,	\
+	0x3a, 0x29, 0x3a, 0x98, 0xca, 0x7f, 0x55, 0x4f, 0xaa, 0x8a, 0x9e, 0xa6, 0xb6, 0xb4, 0xd6, 0x31,	\
+	0xac, 0x43, 0x58, 0x98, 0xd8, 0xd8, 0xd8, 0xc7, 0x7d, 0xff, 0x14, 0x07, 0x50, 0x20, 0xda, 0xfc,	\
+	0x9d, 0xac, 0xd5, 0xfe, 0xe2, 0xfd, 0x09, 0x0c, 0xfd, 0x0d, 0x09, 0x0d, 0x09, 0x1b, 0x0d, 0x45,	\
+	0x19, 0xea, 0xa2, 0x97, 0xa2, 0xa9, 0x97, 0xb5, 0x97, 0x97, 0xf7, 0xfb, 0xeb, 0xad, 0x71, 0xad,	\
+	0x6d, 0x72, 0x33, 0xb1, 0xb2, 0x33, 0xb3, 0xb2, 0x31, 0x8e, 0xa0, 0x40, 0x81, 0x07, 0xe7, 0x39,	\
+	0x02, 0x0d, 0xb7, 0x38, 0xc7, 0xef, 0x34, 0x34, 0x34, 0x67, 0xaa, 0x12, 0x32, 0x32, 0x32, 0x8a,	\
+	0x8a, 0x32, 0x5e, 0xa6, 0xa6, 0x8b, 0xdf, 0x5b, 0x4d, 0x53, 0x6b, 0x5d, 0x6b, 0x6b, 0x6b, 0x8d,	\
+	0x6b, 0x6b, 0x9d, 0x8c, 0x6d, 0x02, 0x0c, 0x8c, 0xec, 0x8c, 0xef, 0xc9, 0xd4, 0x1f, 0x9d, 0xbf,	\
+	0xb3, 0xdc, 0x34, 0x24, 0x24, 0x24, 0x64, 0x24, 0x64, 0x24, 0xbc, 0x64, 0xcc, 0x64, 0x64, 0x6c,	\
+	0xbc, 0xbc, 0xbd, 0x4d, 0x35, 0xad, 0x4d, 0x35, 0x4d, 0xaf, 0xbe, 0xb8, 0xdd, 0xad, 0x75, 0xad,	\
+	0xae, 0x76, 0x76, 0x46, 0x36, 0x76, 0x46, 0x72, 0x04, 0x19, 0x99, 0xda, 0x48, 0x10, 0x42, 0x42,	\
+	0x42, 0x3f, 0x46, 0x43, 0x46, 0x42, 0x46, 0x4c, 0xcc, 0xd1, 0x51, 0x4c, 0xc6, 0xcb, 0xd4, 0xcc,	\
+	0xd3, 0x4b, 0xda, 0xda, 0xd6, 0xd3, 0x53, 0x5a, 0xfb, 0xe9, 0xb1, 0xb3, 0xb2, 0x33, 0xb2, 0x33,	\
+	0xb3, 0xb2, 0x10, 0x66, 0x64, 0x20, 0xce, 0xcc, 0xdb, 0x41, 0xf9, 0xe2, 0xf3, 0x43, 0x42, 0x3d,	\
+	0xc2, 0x42, 0x4c, 0xc6, 0x42, 0x46, 0x46, 0x46, 0x4c, 0xc7, 0x4b, 0xcd, 0x4b, 0xd3, 0x53, 0x16,	\
+	0xa6, 0xae, 0xae, 0xb5, 0xb5, 0xad, 0xa6, 0xb5, 0x37, 0x5d, 0x5c, 0x6f, 0x20, 0xde, 0x62, 0x0c,	\
+	0x84, 0x08, 0x33, 0xb6, 0xd0, 0x67, 0x6d, 0xed, 0xfe, 0x7c, 0xd0, 0xcf, 0xd1, 0xb0, 0x92, 0xf1,	\
+	0xb0, 0x91, 0xb0, 0x91, 0xb1, 0x92, 0xf2, 0xf3, 0x3e, 0xa9, 0x79, 0x7a, 0x6a, 0xea, 0xd9, 0x7b,	\
+	0x5a, 0x6a, 0xef, 0x7f, 0xbf, 0x22, 0xbb, 0x1b, 0x3b, 0xde, 0x6f, 0x1b, 0x3b, 0x3b, 0x49, 0x06,	\
+	0x76, 0x46, 0x76, 0x66, 0xda, 0x0e, 0x2f, 0xfa, 0x11, 0xc6, 0x10, 0x84, 0x37, 0x9a, 0x12, 0x3b,	\
+	0xcd, 0x2f, 0x2f, 0x1a, 0x5a, 0x5e, 0x36, 0x9a, 0x66, 0x9a, 0x9a, 0xa6, 0xa6, 0xba, 0xba, 0xba,	\
+	0xa6, 0xd7, 0x22, 0xd4, 0xd9, 0xbc, 0x8f, 0x7f, 0xbe, 0xf3, 0x23, 0x3b, 0x23, 0x33, 0x33, 0x3b,	\
+	0x33, 0x8b, 0xfe, 0xdb, 0x41, 0xb6, 0xf7, 0xe6, 0x7a, 0x84, 0x8d, 0x84, 0x8c, 0xf3, 0x46, 0xcc,	\
+	0xc6, 0xc6, 0xc6, 0x96, 0xf5, 0x16, 0x99, 0xf5, 0x16, 0xae, 0xa6, 0xf7, 0xd3, 0x57, 0x53, 0x1b,	\
+	0xf7, 0xd7, 0x1b, 0xb5, 0xf8, 0xe7, 0x1b, 0xc8, 0xcc, 0xce, 0xc8, 0xcc, 0xdb, 0xd2, 0x41, 0xc4,	\
+	0x83, 0x6f, 0x8b, 0x6e, 0x12, 0x12, 0x13, 0xcc, 0xe3, 0x09, 0x1d, 0x1b, 0x1b, 0x1d, 0x2f, 0x33,	\
+	0x33, 0x1a, 0x5a, 0x34, 0xb5, 0x55, 0x35, 0x71, 0x62, 0xd4, 0xd5, 0xc6, 0xcd, 0xd7, 0xd7, 0x1b,	\
+	0xcc, 0x30, 0x6f, 0x3b, 0x30, 0xde, 0x46, 0x96, 0x66, 0x92, 0x03, 0xf9, 0x9b, 0x7b, 0x68, 0x38,	\
+	0x88, 0x42, 0x38, 0xf9, 0xbc, 0xd1, 0xb3, 0x3e, 0x68, 0xef, 0x34, 0xcc, 0x75, 0x34, 0xbc, 0xd1,	\
+	0x6a, 0x6a, 0x9a, 0x6a, 0xe2, 0xd4, 0xde, 0xfa, 0xaa, 0xea, 0xea, 0xe3, 0x79, 0x86, 0xcd, 0xe6,	\
+	0x1b, 0xc8, 0x37, 0x78, 0x7d, 0x01, 0xfd, 0x2c, 0x8f, 0xfb, 0x6f, 0x4b, 0x8b, 0x88, 0x84, 0x69,	\
+	0x08, 0xe8, 0xe8, 0x4f, 0x34, 0x6c, 0x6c, 0xcc, 0x6c, 0xc9, 0x69, 0x99, 0x92, 0xd2, 0xe5, 0xab,	\
+	0xa5, 0xeb, 0xaa, 0xa9, 0xab, 0xab, 0xa9, 0xab, 0xfd, 0xf5, 0xd9, 0x86, 0xcd, 0xde, 0x1b, 0xd2,	\
+	0x41, 0x99, 0x99, 0xa5, 0xb6, 0x7f, 0x33, 0x4b, 0x48, 0xff, 0x13, 0x89, 0x02, 0x11, 0xa4, 0x23,	\
+	0xbc, 0xd1, 0xd1, 0xb1, 0xc5, 0xa3, 0x69, 0x8b, 0x47, 0x46, 0x96, 0xa6, 0xa6, 0xaf, 0x99, 0x2d,	\
+	0x5d, 0x4d, 0x5e, 0x6c, 0xd9, 0xb3, 0x66, 0xef, 0x0d, 0xe6, 0x64, 0x1b, 0x36, 0x7f, 0x23, 0x4f,	\
+	0x33, 0x4b, 0x6f, 0x6f, 0x6f, 0x8b, 0x8b, 0xcd, 0x09, 0x1c, 0xe3, 0x1d, 0xe6, 0x89, 0x8d, 0x8e,	\
+	0x2d, 0xe6, 0x2d, 0x1c, 0x5a, 0x5c, 0xb1, 0x6a, 0xe2, 0xc5, 0x8b, 0x57, 0xd7, 0x53, 0x18, 0x37,	\
+	0xef, 0xaf, 0xaf, 0xbc, 0x36, 0x6c, 0xc1, 0xb3, 0xfa, 0x47, 0xf6, 0xf4, 0xb4, 0xf4, 0xb4, 0x8f,	\
+	0xed, 0xed, 0xe9, 0x10, 0x7a, 0x21, 0x08, 0x40, 0x84, 0xcc, 0x24, 0x74, 0x74, 0xcc, 0x71, 0x69,	\
+	0xa9, 0x9a, 0xe9, 0xaa, 0xe2, 0xc5, 0xab, 0xab, 0xaf, 0x2b, 0xcd, 0xd5, 0x18, 0x36, 0x6c, 0xdd,	\
+	0xe1, 0x8b, 0xcc, 0xc3, 0xf7, 0x86, 0xcf, 0x9f, 0xdb, 0xd2, 0x3f, 0xb7, 0xc5, 0xa7, 0xa5, 0xe6,	\
+	0x20, 0x42, 0x38, 0x84, 0x74, 0xcc, 0x74, 0x74, 0x74, 0xd4, 0x74, 0xd4, 0x74, 0xd1, 0x6a, 0xa2,	\
+	0xd3, 0x45, 0xaa, 0xab, 0x8b, 0x1b, 0x30, 0x6e, 0xba, 0xaa, 0xbe, 0xf3, 0x33, 0x33, 0x4a, 0xf2,	\
+	0xf2, 0xf3, 0x30, 0xfe, 0x96, 0x61, 0xfd, 0xbe, 0x2d, 0x3e, 0x2d, 0xb2, 0x0f, 0x11, 0x24, 0x08,	\
+	0x47, 0x10, 0x21, 0x33, 0x35, 0x1f, 0x35, 0x35, 0x33, 0x1b, 0x34, 0x5a, 0xbe, 0xba, 0x7a, 0xaa,	\
+	0xa8, 0xdd, 0x55, 0x55, 0x55, 0xe1, 0x83, 0x17, 0x97, 0x97, 0x87, 0xef, 0x0d, 0xde, 0x1f, 0xbc,	\
+	0x37, 0xa5, 0xa5, 0xa5, 0xa4, 0x7f, 0x6f, 0x8d, 0xc6, 0x25, 0xe0, 0x87, 0x9a, 0x3a, 0x3a, 0x3a,	\
+	0x6a, 0x6a, 0x3a, 0x68, 0xb4, 0xd1, 0x69, 0xa2, 0xd3, 0x45, 0xa7, 0xaa, 0x8b, 0x57, 0x98, 0x2d,	\
+	0x5e, 0x62, 0xbc, 0xdd, 0xee, 0x61, 0xb3, 0x19, 0x97, 0xa7, 0xcf, 0xe9, 0x69, 0x9f, 0x3f, 0xc7,	\
+	0xb7, 0xa5, 0xc6, 0x7d, 0xe0, 0x81, 0x08, 0xef, 0x31, 0x09, 0xa2, 0x13, 0x51, 0x25, 0xa3, 0xa3,	\
+	0xe6, 0xa6, 0xab, 0xe6, 0xab, 0xcb, 0x4f, 0x51, 0xd7, 0x16, 0xaf, 0x30, 0x60, 0xd9, 0x8a, 0xe3,	\
+	0xe6, 0x0c, 0x5e, 0x1b, 0x3e, 0x7f, 0x48, 0xfe, 0x91, 0xfd, 0x2d, 0x2e, 0x3e, 0x3d, 0x3e, 0x27,	\
+	0x88, 0x9f, 0x24, 0x4c, 0x74, 0x49, 0x18, 0x98, 0xf9, 0xa9, 0xa9, 0xa2, 0xd3, 0x53, 0x53, 0x53,	\
+	0x45, 0x8b, 0x51, 0xd7, 0xd1, 0x9b, 0x2c, 0x62, 0xaa, 0xf0, 0xc5, 0xe1, 0xfc, 0xcb, 0xc3, 0xf7,	\
+	0xf7, 0xf7, 0xfa, 0x47, 0xf4, 0xcf, 0x9f, 0xd2, 0xe3, 0xe3, 0xdb, 0xe3, 0x21, 0x13, 0x13, 0x13,	\
+	0x13, 0x1d, 0x1d, 0x1d, 0x1f, 0x13, 0x1c, 0x5a, 0x6b, 0xd3, 0x1f, 0x1f, 0x3d, 0x46, 0x5a, 0xa8,	\
+	0xb5, 0x7d, 0x19, 0x8a, 0xa3, 0x06, 0x2a, 0xab, 0xcc, 0x18, 0xcc, 0x30, 0x7f, 0x4c, 0xf9, 0xf3,	\
+	0xe7, 0xf8, 0xb4, 0xf8, 0xb4, 0xf8, 0xf4, 0xf8, 0xc8, 0x44, 0xbc, 0x7a, 0x62, 0x63, 0xa2, 0x66,	\
+	0xa3, 0xe3, 0xa8, 0xe3, 0xe8, 0xcb, 0x55, 0x47, 0xd5, 0x4f, 0x18, 0x31, 0x55, 0x47, 0x54, 0x62,	\
+	0xfe, 0xbe, 0xbe, 0xf2, 0xf4, 0xd9, 0x83, 0xe7, 0xef, 0xcf, 0xde, 0xe9, 0xe9, 0x1f, 0xe3, 0x3f,	\
+	0xa7, 0xa7, 0xc5, 0xc7, 0xc4, 0xf1, 0x12, 0xf0, 0x46, 0x3e, 0x3a, 0x26, 0x26, 0x3e, 0x3e, 0x26,	\
+	0x6a, 0x3e, 0x3e, 0x7a, 0x7a, 0x7a, 0x6a, 0x8e, 0x78, 0xc5, 0x55, 0x55, 0x7d, 0x7d, 0xfd, 0xfd,	\
+	0xf9, 0x83, 0x17, 0xf7, 0xfa, 0x67, 0xef, 0xf4, 0xef, 0xcf, 0xe9, 0xe8, 0xf1, 0xe9, 0xf1, 0xf2,	\
+	0x71, 0xe9, 0x90, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0xf4, 0xcd, 0x47, 0xc7, 0x95, 0xf4, 0xd1,	\
+	0x96, 0x9e, 0xa3, 0x9a, 0x9e, 0xaa, 0xa3, 0x9e, 0xaf, 0x9e, 0x30, 0x62, 0xd2, 0xbe, 0xf4, 0xc5,	\
+	0xe9, 0x8d, 0x2b, 0xdb, 0xcb, 0xcd, 0x2d, 0xcb, 0xdd, 0x33, 0xfa, 0x7a, 0x7c, 0x7a, 0x5b, 0x84,	\
+	0x48, 0xbc, 0x15, 0xf4, 0x91, 0x89, 0x8e, 0x9a, 0x23, 0xe9, 0x2d, 0x1f, 0x1e, 0x56, 0x7a, 0xaa,	\
+	0xaa, 0x78, 0xad, 0x51, 0x83, 0x16, 0x96, 0x94, 0x77, 0xf5, 0xf7, 0xe6, 0x2f, 0x6f, 0x6f, 0xef,	\
+	0x2f, 0xf0, 0x2f, 0xf4, 0xf4, 0xf8, 0xf4, 0x74, 0xf4, 0xf4, 0xb8, 0xf7, 0x22, 0x7c, 0x91, 0xef,	\
+	0x04, 0x62, 0x4a, 0x95, 0x23, 0x34, 0x5a, 0x3e, 0x7a, 0x8e, 0x3e, 0xaa, 0x7a, 0xd0, 0xc5, 0x19,	\
+	0x83, 0x16, 0x97, 0xf3, 0xc6, 0x2d, 0x0c, 0x5a, 0x5e, 0xde, 0x5e, 0x5e, 0x98, 0xc0, 0xbd, 0xdc,	\
+	0xbd, 0xdc, 0xd3, 0xd3, 0xe3, 0xd3, 0xdc, 0xe4, 0xe3, 0x89, 0x78, 0x8f, 0x22, 0xf1, 0x13, 0x13,	\
+	0x13, 0x1f, 0xe9, 0x2b, 0xe9, 0xf4, 0xd1, 0xc7, 0xce, 0x51, 0xcf, 0x4f, 0x51, 0xcf, 0x58, 0x18,	\
+	0x9e, 0x31, 0x68, 0x62, 0xf6, 0xf2, 0xfe, 0xf6, 0xf6, 0xf2, 0xff, 0x46, 0xfc, 0xfe, 0x9e, 0x9e,	\
+	0x9e, 0xe7, 0x1e, 0x9e, 0xe7, 0x1e, 0x9c, 0x49, 0x18, 0x9f, 0x19, 0x1f, 0x49, 0x12, 0x25, 0x48,	\
+	0xcd, 0x4f, 0x47, 0xd1, 0xc7, 0xd1, 0xcf, 0x4f, 0x18, 0xaa, 0xb0, 0x9e, 0x9e, 0xbd, 0xb4, 0xbd,	\
+	0xc0, 0xc0, 0x31, 0x69, 0x83, 0x7b, 0x7b, 0xa3, 0x7f, 0xa3, 0x7f, 0xa3, 0xa3, 0x7b, 0xa7, 0xa7,	\
+	0xc7, 0xb9, 0xc9, 0xc6, 0x45, 0xe0, 0x89, 0x18, 0x92, 0xb1, 0xe4, 0x66, 0xa3, 0xfd, 0x31, 0xfe,	\
+	0x9f, 0x4d, 0x19, 0x53, 0x05, 0x4c, 0x4e, 0x5a, 0x18, 0x31, 0x69, 0x7b, 0x3c, 0x62, 0xd3, 0x02,	\
+	0xff, 0x02, 0xf6, 0xff, 0x47, 0x47, 0x0a, 0xff, 0xe9, 0xa7, 0xa7, 0xa3, 0xa7, 0xc9, 0xc7, 0xb9,	\
+	0xb8, 0x44, 0x88, 0xf2, 0x31, 0x24, 0x48, 0x91, 0x9e, 0x8f, 0x8f, 0x2b, 0x39, 0x3d, 0x3d, 0x3c,	\
+	0x54, 0xc4, 0xe1, 0x89, 0xe3, 0x16, 0x16, 0x96, 0x96, 0x98, 0x18, 0x18, 0x17, 0xb8, 0x17, 0xb7,	\
+	0xb7, 0xb7, 0xff, 0x4d, 0x3d, 0xcc, 0x1c, 0x0e, 0x3d, 0x8e, 0x3e, 0x4d, 0xce, 0x42, 0x23, 0xe2,	\
+	0x48, 0x91, 0x89, 0x23, 0x36, 0x54, 0xa9, 0x52, 0xb1, 0xe6, 0x0a, 0xce, 0x4f, 0x5a, 0x4e, 0x58,	\
+	0x58, 0x4e, 0x5a, 0x60, 0x5a, 0x18, 0xb0, 0xc0, 0xf6, 0x60, 0x60, 0x60, 0x68, 0xe9, 0xe8, 0xdf,	\
+	0xfd, 0x37, 0x34, 0x78, 0xf4, 0x78, 0xfe, 0x9f, 0x4e, 0x3e, 0x42, 0x23, 0xc8, 0xc5, 0x91, 0x2a,	\
+	0x3c, 0x89, 0x52, 0xa4, 0x4a, 0xcd, 0xcf, 0x4e, 0x15, 0x9e, 0xb0, 0x9c, 0x9c, 0xb4, 0xb0, 0xb4,	\
+	0x9c, 0xb4, 0xb4, 0x31, 0x83, 0x81, 0x81, 0x7b, 0x81, 0x7b, 0x83, 0x7f, 0xa3, 0x83, 0x7f, 0x81,	\
+	0xc9, 0xf4, 0xdc, 0xd8, 0xdc, 0xdc, 0xd3, 0x22, 0x44, 0x88, 0xf2, 0x23, 0xca, 0x95, 0x23, 0x16,	\
+	0x56, 0x7b, 0xd2, 0x56, 0x8c, 0xad, 0x84, 0xe5, 0xa4, 0xf5, 0x2d, 0x2d, 0xed, 0xa1, 0x83, 0x26,	\
+	0x6f, 0x70, 0x2c, 0x2f, 0x74, 0x6f, 0x70, 0xb4, 0x74, 0x74, 0x77, 0x34, 0x74, 0x7e, 0x9b, 0xba,	\
+	0x3b, 0x1f, 0x4e, 0x47, 0x22, 0x23, 0xca, 0xc5, 0x91, 0x22, 0xfe, 0x54, 0xaf, 0xa6, 0x73, 0xd7,	\
+	0xe9, 0x2a, 0x56, 0x72, 0x72, 0xc2, 0xd2, 0xc2, 0xd2, 0xd2, 0xd0, 0xce, 0x0d, 0xa1, 0x9c, 0x0b,	\
+	0xdc, 0x0c, 0x0c, 0x2c, 0x03, 0xda, 0x7a, 0x3f, 0x4d, 0x1d, 0x1d, 0xdf, 0xa7, 0x26, 0xe7, 0x26,	\
+	0xe0, 0xf1, 0xe5, 0x48, 0x91, 0x7f, 0xfe, 0xa7, 0x22, 0xc8, 0x95, 0x2b, 0x39, 0xe9, 0xf5, 0xd8,	\
+	0x7b, 0x27, 0x2c, 0x27, 0x27, 0x3d, 0x94, 0xb8, 0x26, 0x6c, 0x2c, 0x30, 0x70, 0x30, 0x70, 0x30,	\
+	0xb0, 0x70, 0x34, 0x70, 0x37, 0x70, 0xb7, 0x34, 0x77, 0x37, 0x37, 0x77, 0x37, 0x76, 0x22, 0xff,	\
+	0xa8, 0x17, 0x28, 0xb8, 0xf8, 0xb8, 0x18, 0x12, 0xb3, 0xd1, 0x7e, 0xb9, 0xc9, 0xc9, 0xc9, 0xbb,	\
+	0x0b, 0x4b, 0x0b, 0x03, 0x26, 0x3d, 0x9e, 0xc3, 0x36, 0x86, 0x6f, 0x70, 0x30, 0x30, 0xb4, 0x70,	\
+	0x70, 0xb0, 0xb4, 0x70, 0x76, 0x30, 0x77, 0x77, 0x77, 0x37, 0x79, 0x39, 0x3f, 0xa8, 0xb1, 0xf1,	\
+	0x70, 0x31, 0x65, 0x62, 0xca, 0xce, 0x15, 0x8b, 0x2a, 0x57, 0xd7, 0x4b, 0x39, 0x39, 0xec, 0xf6,	\
+	0x52, 0xd8, 0x52, 0xe0, 0x19, 0x32, 0x67, 0x07, 0x07, 0x0b, 0x0b, 0x03, 0x07, 0x07, 0x0b, 0x0b,	\
+	0x44, 0xf7, 0xd3, 0x44, 0xf7, 0xd3, 0x63, 0x77, 0x63, 0x75, 0xd1, 0xca, 0x05, 0xfe, 0x06, 0x2c,	\
+	0x8c, 0x59, 0x57, 0xf8, 0xb8, 0xb9, 0xca, 0x59, 0xc9, 0xcf, 0x65, 0x2d, 0x2c, 0xe5, 0xa5, 0x81,	\
+	0x9b, 0x03, 0x38, 0x5e, 0xc3, 0x38, 0x16, 0x86, 0x70, 0xb4, 0x7e, 0x78, 0x38, 0x47, 0xb0, 0x8f,	\
+	0x1e, 0xfa, 0x6e, 0xfc, 0xfe, 0x9c, 0x9b, 0xa4, 0x48, 0xc5, 0xc0, 0xc0, 0xc5, 0xc5, 0x91, 0xf5,	\
+	0xc5, 0xce, 0x4d, 0x95, 0xa5, 0x9c, 0xf5, 0xd2, 0xd2, 0xd2, 0x99, 0x33, 0x4b, 0xec, 0x32, 0x64,	\
+	0xce, 0x1f, 0xb3, 0x06, 0xfb, 0x06, 0xf8, 0xf6, 0x0e, 0x09, 0xed, 0x8c, 0x2d, 0xdc, 0x1d, 0x8d,	\
+	0x8d, 0xd3, 0xdb, 0xbb, 0x10, 0x30, 0x2f, 0xf0, 0x30, 0x24, 0x5f, 0xdf, 0xe6, 0xe2, 0xe7, 0x22,	\
+	0xe6, 0xfd, 0x65, 0x7d, 0x74, 0xbe, 0xb9, 0xca, 0x5b, 0x43, 0x37, 0xde, 0xcc, 0x03, 0x26, 0x70,	\
+	0x70, 0x70, 0x30, 0x70, 0x8f, 0x60, 0x9e, 0x3c, 0x78, 0xf6, 0xc6, 0xe9, 0xed, 0x83, 0xdf, 0x4d,	\
+	0xdd, 0x88, 0xb7, 0xf7, 0xf8, 0x18, 0x1f, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0xdc, 0xdc, 0xe7, 0xae,	\
+	0x96, 0x96, 0x96, 0x97, 0xd9, 0x4a, 0x64, 0xcd, 0x2d, 0xb5, 0xf1, 0x93, 0x26, 0x6f, 0xb0, 0x0c,	\
+	0xe0, 0x9e, 0xc1, 0xc1, 0x3c, 0x78, 0xf6, 0xc1, 0xe3, 0xdb, 0xbb, 0x1b, 0xbc, 0x9c, 0x8e, 0x8f,	\
+	0xf1, 0x71, 0x6f, 0xf0, 0x31, 0x51, 0x71, 0x71, 0x71, 0x71, 0x73, 0x73, 0x73, 0x9e, 0xba, 0x59,	\
+	0xb3, 0x35, 0x74, 0xb4, 0x86, 0x69, 0x4c, 0x99, 0xbe, 0xc2, 0xc3, 0xc1, 0xc3, 0x3d, 0xa3, 0xf3,	\
+	0xc1, 0x3d, 0x7d, 0xb1, 0xf3, 0xd8, 0xdd, 0xd8, 0xdd, 0xd8, 0xd7, 0xe5, 0x7f, 0x81, 0x8b, 0x72,	\
+	0x7f, 0xf5, 0xbf, 0xf9, 0xfc, 0xfe, 0xbf, 0x5c, 0xdc, 0xdf, 0xae, 0x2a, 0x97, 0xdb, 0x57, 0x4b,	\
+	0x4b, 0x60, 0x66, 0xac, 0xc9, 0x93, 0x26, 0x6f, 0xb0, 0xb0, 0xaf, 0x8c, 0xdf, 0x7c, 0xf0, 0x4f,	\
+	0x1e, 0x3d, 0xae, 0x7b, 0x77, 0x27, 0x77, 0x97, 0x77, 0x95, 0xfd, 0xfe, 0x2e, 0x01, 0xfe, 0x2b,	\
+	0xd7, 0xeb, 0x9b, 0x8b, 0x9b, 0x9b, 0xf5, 0xcd, 0xd5, 0xfa, 0xe9, 0x69, 0x0c, 0xd2, 0x7b, 0x4c,	\
+	0xdb, 0x61, 0x7b, 0x4c, 0xdf, 0x19, 0xc3, 0xb6, 0x3c, 0x78, 0xf6, 0x1d, 0xf6, 0x16, 0xee, 0x17,	\
+	0xcf, 0x5f, 0xe7, 0xcb, 0xa3, 0xaf, 0xcb, 0xb0, 0xfe, 0xe8, 0xff, 0x16, 0xfe, 0xff, 0x15, 0x15,	\
+	0x15, 0x15, 0xeb, 0xa5, 0xa5, 0xf3, 0xd2, 0xfa, 0xea, 0xe9, 0x29, 0x0c, 0xd2, 0x99, 0x33, 0x56,	\
+	0x66, 0xd8, 0xcd, 0x59, 0x9c, 0x1c, 0x33, 0xd8, 0x67, 0xbe, 0x79, 0x27, 0x8f, 0x6e, 0xe4, 0x9e,	\
+	0xd7, 0xd7, 0xd7, 0xdd, 0xd7, 0x72, 0x8a, 0x72, 0x7f, 0x7f, 0x8a, 0x8a, 0x9b, 0xf2, 0xca, 0x4e,	\
+	0x79, 0xe6, 0xfc, 0xf4, 0xb4, 0xbe, 0x7a, 0x53, 0x35, 0x74, 0xb4, 0x95, 0x78, 0x76, 0xd4, 0x86,	\
+	0x70, 0xf0, 0x6f, 0xad, 0xaf, 0xb0, 0x8f, 0x1e, 0xd8, 0x3c, 0x78, 0xf6, 0xee, 0xef, 0x2e, 0xee,	\
+	0xbe, 0xbf, 0x2c, 0x03, 0xff, 0x9e, 0x2a, 0x2e, 0x52, 0x52, 0x6e, 0x6e, 0x6f, 0xcb, 0x29, 0x29,	\
+	0x4b, 0x49, 0xe7, 0xa5, 0xa4, 0xab, 0xab, 0xb6, 0xab, 0xb6, 0xab, 0xab, 0xb6, 0xc3, 0x33, 0x87,	\
+	0x82, 0x78, 0xf6, 0x4e, 0x1e, 0x49, 0xef, 0x9e, 0xb9, 0xed, 0x7d, 0x7c, 0x9e, 0x5d, 0x7d, 0x7e,	\
+	0x58, 0x07, 0xf8, 0x08, 0xa8, 0x08, 0x08, 0xb9, 0x49, 0xbf, 0x3c, 0xdc, 0xa4, 0xdd, 0x25, 0x2d,	\
+	0x2d, 0x27, 0xb6, 0xae, 0xd8, 0xcd, 0x2d, 0x5d, 0xf7, 0xb6, 0xd8, 0xcd, 0xf5, 0xb1, 0x9c, 0x33,	\
+	0x36, 0xdf, 0x33, 0xda, 0xf9, 0x38, 0x3f, 0x7e, 0x5d, 0x8e, 0x5e, 0x5e, 0x5d, 0x8e, 0x5f, 0x14,	\
+	0x54, 0x07, 0x9e, 0x2a, 0x2a, 0x2b, 0xcf, 0x15, 0x29, 0x15, 0x49, 0x29, 0x17, 0x49, 0x49, 0x49,	\
+	0x57, 0x4b, 0xe7, 0xf6, 0xdb, 0x5b, 0x5b, 0x5b, 0x19, 0xb6, 0xbe, 0xbe, 0xb6, 0xb6, 0xc3, 0xc3,	\
+	0xf9, 0xe4, 0xdf, 0x7c, 0xf2, 0x4f, 0x64, 0xe4, 0xeb, 0xeb, 0xeb, 0xeb, 0xf2, 0xf9, 0x62, 0xa0,	\
+	0x20, 0x22, 0xbc, 0xbe, 0x5f, 0x3f, 0x9e, 0x2a, 0x52, 0x92, 0x52, 0x52, 0x92, 0x92, 0xae, 0x92,	\
+	0x93, 0xfd, 0xa4, 0x33, 0x57, 0x7d, 0x6d, 0xfe, 0xdb, 0x61, 0xdb, 0x64, 0x9e, 0xb6, 0xc9, 0xff,	\
+	0x75, 0xf2, 0x72, 0x4f, 0x7d, 0xf2, 0x7e, 0x7f, 0x7d, 0x7f, 0xbe, 0xbf, 0xdf, 0xcf, 0xe5, 0xf2,	\
+	0xbf, 0xca, 0x79, 0xe2, 0xa2, 0xa2, 0xe5, 0x29, 0x26, 0xe6, 0xe5, 0x25, 0x2a, 0xe9, 0x29, 0x0c,	\
+	0xd2, 0x7b, 0x6d, 0xad, 0xbd, 0xb6, 0xd8, 0x77, 0xd9, 0x27, 0xaf, 0xb0, 0xff, 0xd3, 0xd9, 0x38,	\
+	0x78, 0x79, 0x39, 0x3a, 0xf9, 0x3f, 0x3d, 0x7d, 0x7d, 0x7f, 0xbf, 0xde, 0x02, 0x2a, 0x2b, 0xcb,	\
+	0x15, 0x29, 0xe5, 0x94, 0xf2, 0xca, 0x4a, 0x52, 0x4a, 0x4a, 0x52, 0x52, 0x7b, 0x6a, 0xfd, 0xb4,	\
+	0x9e, 0xda, 0xbf, 0x6d, 0xb5, 0xb1, 0x9f, 0xf6, 0xfb, 0xfd, 0xb6, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3,	\
+	0xd7, 0x3d, 0xaf, 0x93, 0x93, 0x93, 0x93, 0xf7, 0xc9, 0xe5, 0xfb, 0xf2, 0x59, 0x3f, 0xf5, 0x4a,	\
+	0x02, 0xa9, 0xd0, 0x05, 0xd0, 0xe8, 0x29, 0x74, 0x14, 0xbb, 0x2a, 0x41, 0xba, 0x4b, 0xfd, 0x9e,	\
+	0xc8, 0x66, 0xe1, 0x6d, 0xc2, 0xda, 0xc8, 0x35, 0x8b, 0x16, 0x3c, 0x87, 0xf4, 0x3c, 0x8f, 0xea,	\
+	0x04, 0x12, 0x50, 0x10, 0x20, 0x95, 0x3a, 0x01, 0xbb, 0x3d, 0x95, 0x25, 0x40, 0xcd, 0x7d, 0x9e,	\
+	0xcb, 0x58, 0x65, 0xf1, 0x62, 0xd7, 0xda, 0xfc, 0x7e, 0x47, 0x86, 0x76, 0xe1, 0xf1, 0x31, 0x3f,	\
+	0xa8, 0x10, 0x20, 0x80, 0xf4, 0x14, 0x80, 0x81, 0x52, 0x5a, 0x02, 0xa4, 0xa4, 0xb4, 0xbe, 0x19,	\
+	0xac, 0x5f, 0x65, 0x7d, 0xad, 0xe3, 0xc8, 0x2d, 0xe3, 0xc8, 0x3c, 0x7f, 0x8c, 0x8b, 0xc3, 0xc2,	\
+	0x60, 0x10, 0x20, 0x40, 0x82, 0xe8, 0x2a, 0x02, 0xe9, 0x2a, 0x29, 0x06, 0x5a, 0x0d, 0xd2, 0x0d,	\
+	0xe1, 0x6b, 0x6b, 0x16, 0x2d, 0x68, 0x5f, 0x8d, 0xaf, 0xc6, 0x2d, 0x9d, 0xb9, 0xb8, 0x7f, 0xf5,	\
+	0xd0, 0x4a, 0xfd, 0x53, 0x40, 0xaa, 0x29, 0x01, 0x02, 0xa5, 0xd9, 0x03, 0xd2, 0x0c, 0x18, 0x5a,	\
+	0xd3, 0x58, 0xb5, 0xf6, 0xb1, 0x6d, 0x7e, 0x41, 0x62, 0xc5, 0x8f, 0x78, 0xfe, 0xbc, 0x6f, 0x03,	\
+	0xd3, 0x13, 0x13, 0x00, 0x82, 0x52, 0x54, 0xe9, 0x01, 0x02, 0x9b, 0xd9, 0x52, 0x5a, 0xe9, 0x2f,	\
+	0x86, 0x5f, 0x16, 0xd6, 0xbe, 0x1b, 0xc3, 0xe1, 0x1e, 0xd7, 0xe3, 0x1e, 0xce, 0x2c, 0x89, 0x12,	\
+	0x20, 0x53, 0x13, 0x13, 0x00, 0x86, 0x02, 0x07, 0xa4, 0xa9, 0xd0, 0x5a, 0x5a, 0x5a, 0x5f, 0x6b,	\
+	0x5a, 0x0c, 0xb4, 0xbe, 0xdd, 0xe3, 0x16, 0xd6, 0x2c, 0x5b, 0xc7, 0x84, 0x58, 0xf1, 0x6f, 0x03,	\
+	0xd3, 0x13, 0x01, 0x26, 0x01, 0xe9, 0x29, 0x2a, 0x2a, 0x2f, 0xaa, 0x2a, 0x2f, 0xf4, 0x85, 0xad,	\
+	0x0b, 0x67, 0x6b, 0x16, 0xb5, 0xe1, 0x67, 0x67, 0xf0, 0xb3, 0xbc, 0x33, 0xf8, 0xc7, 0x8f, 0x7f,	\
+	0x1e, 0x98, 0x98, 0x99, 0xd2, 0x4c, 0x02, 0xa8, 0x99, 0xd2, 0x54, 0x52, 0x5a, 0x54, 0x0c, 0xb5,	\
+	0xd3, 0x16, 0xb4, 0x21, 0xad, 0x7d, 0x9c, 0x58, 0xb1, 0xe3, 0xfc, 0x3e, 0x32, 0x23, 0xc7, 0x8f,	\
+	0x81, 0x4c, 0xe9, 0x7e, 0xa0, 0x53, 0x40, 0xaa, 0x2a, 0x2d, 0x01, 0x5a, 0x5a, 0x4d, 0x67, 0x5a,	\
+	0x5f, 0x16, 0xb5, 0xe1, 0x16, 0xce, 0xd6, 0x2d, 0xcb, 0xc6, 0x23, 0xc6, 0x2f, 0xc6, 0x3d, 0xff,	\
+	0xc6, 0x3c, 0x08, 0x14, 0xd0, 0x29, 0x80, 0x40, 0xa6, 0xa6, 0xad, 0x2a, 0x2a, 0x06, 0xe9, 0xaa,	\
+	0x2f, 0xaa, 0x2d, 0x2d, 0x2f, 0x8b, 0x67, 0xf0, 0xf8, 0xd9, 0xc5, 0xb9, 0x78, 0x5c, 0xbc, 0x23,	\
+	0xfc, 0x64, 0x53, 0x13, 0x13, 0x40, 0xf4, 0x95, 0x15, 0x16, 0x80, 0xf4, 0x97, 0xd7, 0xfa, 0x62,	\
+	0x16, 0x84, 0x33, 0x8b, 0x11, 0xe1, 0x16, 0x3f, 0xc2, 0x2d, 0xcb, 0xc7, 0xe1, 0x1e, 0xfe, 0xe4,	\
+	0x3c, 0x79, 0x14, 0xc4, 0xc4, 0xde, 0x92, 0x68, 0x1e, 0x90, 0x14, 0xd1, 0x0b, 0x49, 0xab, 0xe2,	\
+	0x16, 0x84, 0x08, 0x5a, 0x54, 0x68, 0x67, 0xf0, 0xaf, 0xf8, 0x45, 0xb3, 0xb3, 0xb9, 0x0b, 0x1e,	\
+	0xe4, 0x3e, 0x07, 0xf6, 0x4d, 0x4c, 0x4c, 0x03, 0xd2, 0x4d, 0x54, 0x54, 0x54, 0xe9, 0xaa, 0x74,	\
+	0xba, 0xe2, 0x15, 0x04, 0x08, 0x67, 0x11, 0xe1, 0x10, 0xd0, 0x3d, 0xd1, 0xcb, 0xc7, 0x03, 0x02,	\
+	0xcf, 0xe3, 0x7f, 0x1f, 0xfb, 0x26, 0x7e, 0xc0, 0x53, 0x53, 0x93, 0x7a, 0x7d, 0x31, 0x0b, 0xea,	\
+	0x82, 0x15, 0x15, 0x04, 0x08, 0x5a, 0x68, 0x67, 0x10, 0xcf, 0xe1, 0x68, 0x10, 0xe8, 0xce, 0xcf,	\
+	0x00, 0xe4, 0xe8, 0x45, 0xff, 0xf6, 0xe9, 0xa6, 0xa6, 0xa6, 0x2a, 0x74, 0xba, 0x5d, 0x3f, 0xd8,	\
+	0x42, 0xa2, 0xa0, 0x81, 0x02, 0x1a, 0x19, 0xc4, 0x31, 0x33, 0xb4, 0x39, 0x34, 0x0f, 0xf1, 0xbf,	\
+	0xb3, 0xc0, 0xb4, 0x40, 0xb9, 0x39, 0x26, 0xa6, 0x7e, 0xc9, 0xa9, 0xa9, 0xbd, 0x3e, 0x9a, 0xa0,	\
+	0x84, 0xde, 0xbf, 0x5f, 0xae, 0xc4, 0x21, 0x88, 0x40, 0x8f, 0x0b, 0x43, 0x93, 0x38, 0x86, 0x86,	\
+	0x37, 0x28, 0x07, 0x27, 0xf7, 0x47, 0xf7, 0xff, 0xd9, 0x34, 0x0a, 0x6a, 0x6a, 0xa7, 0x4f, 0xa7,	\
+	0xd7, 0xe8, 0x88, 0xeb, 0xf5, 0xfa, 0xc2, 0x15, 0x1a, 0x1a, 0x04, 0x08, 0x68, 0x10, 0xe5, 0xe1,	\
+	0x68, 0x72, 0x1e, 0xe8, 0x3d, 0x8c, 0x7c, 0x00, 0xfe, 0x8a, 0x6a, 0x67, 0x4d, 0x37, 0xa3, 0xd1,	\
+	0xeb, 0x88, 0xeb, 0xf5, 0x96, 0x95, 0xfa, 0xe2, 0x1a, 0x04, 0x31, 0x34, 0x39, 0x31, 0x88, 0x68,	\
+	0x72, 0xf0, 0xba, 0x39, 0x33, 0xb4, 0x3a, 0x31, 0xba, 0x40, 0xfe, 0xc9, 0xdd, 0x3e, 0xb2, 0x6f,	\
+	0x4d, 0x37, 0xa7, 0xd6, 0x10, 0x23, 0xae, 0xa8, 0x23, 0xac, 0x21, 0x5c, 0x43, 0x43, 0x1f, 0x5d,	\
+	0x8d, 0xc9, 0x8d, 0xc9, 0xc9, 0x8d, 0x8d, 0xfd, 0xd2, 0x05, 0xfe, 0x01, 0x39, 0x31, 0x39, 0x31,	\
+	0x3b, 0xa7, 0xd6, 0xeb, 0xf5, 0xfa, 0xec, 0x4a, 0x9d, 0x65, 0x71, 0x0d, 0x02, 0x19, 0xd8, 0x9a,	\
+	0x1c, 0x98, 0xdc, 0x9a, 0x1a, 0x1a, 0x1d, 0x1d, 0x18, 0xdc, 0x9d, 0x22, 0x9d, 0x13, 0x93, 0x53,	\
+	0x93, 0x7a, 0x3d, 0x7e, 0xb2, 0x6a, 0xba, 0xa0, 0x8e, 0xb8, 0x8e, 0xb3, 0x13, 0x12, 0xbb, 0x18,	\
+	0x87, 0x21, 0x0c, 0x6e, 0x8d, 0x0d, 0x0e, 0x8c, 0x6e, 0x8e, 0x9e, 0x27, 0x47, 0x27, 0x44, 0xde,	\
+	0x8a, 0x6a, 0x72, 0x6f, 0x47, 0xae, 0xa9, 0xd6, 0x57, 0xe8, 0xf5, 0xd8, 0x98, 0xd8, 0x98, 0x98,	\
+	0xd8, 0x98, 0x95, 0xda, 0x18, 0xdc, 0x9a, 0x1d, 0x1d, 0x1d, 0x18, 0xd8, 0xfc, 0x4f, 0xf0, 0x0e,	\
+	0x89, 0xc9, 0xa9, 0xa9, 0xbd, 0x1e, 0x8a, 0x6f, 0x59, 0x35, 0x35, 0x5d, 0x8f, 0xae, 0xc4, 0xd0,	\
+	0xae, 0x21, 0xa1, 0x8f, 0xc0, 0xae, 0xd0, 0xc5, 0xe2, 0x72, 0x74, 0xf0, 0x34, 0x40, 0x3a, 0x3f,	\
+	0xc0, 0x40, 0x74, 0x53, 0x93, 0x93, 0x93, 0x95, 0xfa, 0x2a, 0xea, 0xea, 0xfd, 0x15, 0x75, 0x71,	\
+	0x0a, 0xfe, 0x06, 0x25, 0x76, 0x36, 0x26, 0x36, 0x8f, 0x17, 0x81, 0xd1, 0xd1, 0xd3, 0xc4, 0xe9,	\
+	0x01, 0xe5, 0xf1, 0x40, 0x27, 0x27, 0x26, 0xa7, 0x74, 0x53, 0x95, 0xfa, 0x2a, 0xfd, 0x6e, 0xb3,	\
+	0x12, 0xbb, 0x13, 0x13, 0x43, 0x13, 0x12, 0xbb, 0x47, 0x8b, 0xc0, 0xc7, 0xe0, 0xf0, 0x39, 0x31,	\
+	0xb1, 0xc0, 0x78, 0xbc, 0x5e, 0x28, 0x04, 0xe4, 0xe4, 0xee, 0x8f, 0x59, 0x5d, 0x39, 0x5d, 0x3b,	\
+	0xac, 0xae, 0xc4, 0xae, 0xc4, 0xae, 0xc4, 0xc6, 0xae, 0xc7, 0xe0, 0x62, 0x74, 0x63, 0xf0, 0x78,	\
+	0x18, 0xe0, 0x3c, 0x4c, 0x7e, 0x2f, 0x14, 0x57, 0x95, 0x39, 0x39, 0x39, 0x39, 0x3b, 0xac, 0xaf,	\
+	0xd1, 0x57, 0xeb, 0x2b, 0xb1, 0x75, 0x95, 0xd8, 0xd8, 0x95, 0xd8, 0xfc, 0x1e, 0x07, 0x2f, 0x07,	\
+	0x81, 0xa3, 0xc5, 0xe0, 0xf1, 0x78, 0xa0, 0x3c, 0x5e, 0x2f, 0x13, 0xa4, 0x6c, 0x6b, 0xb9, 0xe9,	\
+	0x00, 0x39, 0xc0, 0xff, 0xfa, 0x40, 0x40, 0x80, 0x02, 0x2c, 0x2c, 0x04, 0x61, 0x58, 0x58, 0x58,	\
+	0x12, 0x24, 0x63, 0x6b, 0x20, 0xc1, 0x83, 0x46, 0x39, 0xbf, 0x3f, 0x39, 0xbf, 0x00, 0x48, 0x00,	\
+	0x00, 0x02, 0xc0, 0x00, 0x00, 0xd6, 0x3b, 0x0b, 0x0b, 0x0b, 0x0b, 0x01, 0x16, 0x1b, 0x5b, 0x46,	\
+	0x2e, 0x36, 0xb6, 0x8c, 0x12, 0xfc, 0xfc, 0xc9, 0x0c, 0x31, 0xf9, 0xf8, 0x02, 0x4f, 0x3c, 0x00,	\
+	0x00, 0x60, 0x12, 0x7f, 0xf8, 0x30, 0x61, 0x3b, 0x0b, 0x0b, 0x0b, 0x0d, 0xa3, 0x04, 0x8c, 0x18,	\
+	0xda, 0xda, 0xc8, 0xe6, 0x31, 0xcc, 0x63, 0x98, 0xc7, 0xe8, 0x40, 0x09, 0x01, 0x12, 0x12, 0x02,	\
+	0x03, 0xec, 0x03, 0x08, 0x0d, 0x70, 0x1a, 0xc0, 0x96, 0xde, 0xe2, 0xc3, 0x6a, 0xe0, 0xc6, 0xd1,	\
+	0x83, 0x06, 0x3d, 0xb6, 0xb2, 0x3f, 0x38, 0xbd, 0xbf, 0x00, 0x06, 0x92, 0x10, 0x02, 0x58, 0x50,	\
+	0x60, 0xfb, 0x00, 0xd6, 0x02, 0x03, 0xee, 0x36, 0xac, 0x36, 0xae, 0x32, 0x32, 0x32, 0x0a, 0x7b,	\
+	0x64, 0x73, 0x64, 0x71, 0x18, 0x31, 0x91, 0xed, 0x21, 0x27, 0x9e, 0x92, 0x92, 0x90, 0x10, 0x20,	\
+	0x44, 0xb0, 0x61, 0x16, 0x3b, 0x8b, 0x0b, 0x0b, 0x8d, 0xab, 0x8e, 0x6d, 0xad, 0xa2, 0x59, 0x19,	\
+	0x1e, 0x86, 0x3f, 0x38, 0xc3, 0x3f, 0x38, 0xa5, 0x80, 0x48, 0x48, 0x48, 0x06, 0x0d, 0x25, 0x24,	\
+	0x1a, 0xc0, 0x3e, 0xc2, 0xe7, 0x70, 0x1a, 0xc2, 0xc2, 0xe3, 0x6a, 0xc0, 0xa7, 0x36, 0xd6, 0xd7,	\
+	0xe7, 0x37, 0x31, 0x8e, 0x6e, 0x30, 0xc0, 0x12, 0x40, 0x25, 0x03, 0x08, 0x0d, 0x70, 0x18, 0x30,	\
+	0x6b, 0x8b, 0x0b, 0xbd, 0xc5, 0xc6, 0xd6, 0xd5, 0xc7, 0x3e, 0xd0, 0xc6, 0x47, 0xa6, 0x41, 0x4c,	\
+	0x8e, 0x2f, 0x4f, 0xcf, 0x6f, 0x49, 0x29, 0x29, 0x69, 0x20, 0xd2, 0x52, 0x41, 0xac, 0x03, 0x4b,	\
+	0xee, 0x03, 0x58, 0xee, 0x0a, 0x5c, 0x5d, 0x5c, 0xee, 0x32, 0x0a, 0x18, 0xe6, 0xe2, 0xe6, 0x31,	\
+	0xcd, 0xcd, 0x92, 0x11, 0xc5, 0x21, 0x2d, 0x2d, 0x20, 0x1a, 0x48, 0x30, 0x60, 0xd7, 0x16, 0x3a,	\
+	0xa0, 0xfb, 0x9d, 0xce, 0xe3, 0x22, 0xeb, 0x6b, 0x98, 0xa1, 0x82, 0x99, 0x1c, 0xd9, 0x1c, 0x5c,	\
+	0x59, 0x21, 0x1c, 0x61, 0x92, 0x12, 0xd2, 0xd2, 0x01, 0x83, 0x06, 0x0d, 0x2d, 0x2d, 0x74, 0x1f,	\
+	0x73, 0xb8, 0xba, 0xb8, 0xb8, 0xb9, 0xdc, 0x5c, 0x64, 0x14, 0xc8, 0xb8, 0xc8, 0xf4, 0x29, 0xc5,	\
+	0xc5, 0xec, 0x53, 0xd2, 0x42, 0x5a, 0x5a, 0x42, 0x58, 0x24, 0xb4, 0xb4, 0xb0, 0x6b, 0xab, 0x9d,	\
+	0xa5, 0xd5, 0xc5, 0x81, 0x4c, 0x82, 0x9b, 0x7b, 0x42, 0x99, 0x1e, 0x85, 0x3d, 0x32, 0x3d, 0x10,	\
+	0x15, 0xe6, 0xf3, 0x02, 0x48, 0x48, 0x4b, 0x4b, 0x4a, 0x07, 0xd5, 0x5d, 0x4b, 0x4b, 0x5d, 0x06,	\
+	0xba, 0xb8, 0xba, 0x0d, 0x75, 0x70, 0x52, 0xe8, 0xa6, 0x41, 0x4c, 0x8f, 0x4f, 0x4f, 0x42, 0x9c,	\
+	0x5c, 0x5c, 0x52, 0x52, 0x92, 0xd2, 0xd2, 0xd2, 0xc1, 0x25, 0xf5, 0x52, 0xd7, 0x59, 0x05, 0x2e,	\
+	0x8a, 0x64, 0x14, 0xb8, 0x28, 0x53, 0x88, 0xa7, 0x11, 0x4c, 0x8e, 0x2e, 0x2e, 0x24, 0x1c, 0x5e,	\
+	0x21, 0x12, 0x52, 0x12, 0x92, 0xd2, 0xd2, 0xc1, 0xa5, 0xf5, 0x54, 0x97, 0x57, 0x41, 0xae, 0xae,	\
+	0xa9, 0x32, 0x06, 0x71, 0x14, 0x28, 0x50, 0xa7, 0xa6, 0xe7, 0x17, 0xa1, 0x44, 0x08, 0x3d, 0x44,	\
+	0xa5, 0x25, 0x25, 0xa4, 0x02, 0x4b, 0x05, 0xd5, 0x5d, 0x4b, 0x06, 0xba, 0xba, 0xbb, 0xda, 0x5c,	\
+	0x5d, 0x0c, 0xb8, 0x28, 0x53, 0x73, 0xd3, 0x8b, 0xd0, 0xa7, 0xb7, 0xa7, 0xa7, 0x12, 0x04, 0x01,	\
+	0x25, 0x25, 0x82, 0x04, 0x96, 0x08, 0x1f, 0x41, 0x49, 0x75, 0x75, 0x75, 0x70, 0x50, 0xae, 0xd0,	\
+	0xa1, 0x4b, 0xab, 0x8e, 0x61, 0x85, 0x0a, 0x6e, 0x14, 0x41, 0xc5, 0xe1, 0xe0, 0x82, 0x52, 0x5a,	\
+	0x4a, 0x5a, 0x58, 0x2e, 0xaa, 0x5f, 0x55, 0x77, 0xb9, 0xda, 0x5d, 0xed, 0x2e, 0x86, 0x5c, 0x6e,	\
+	0x0c, 0xdc, 0x28, 0x50, 0xa7, 0xa1, 0x44, 0x1b, 0x9e, 0x88, 0x10, 0x20, 0xf0, 0x09, 0x24, 0x10,	\
+	0x20, 0x40, 0x81, 0x02, 0xea, 0xa9, 0x29, 0x76, 0xbb, 0x2b, 0xbd, 0x90, 0xc1, 0x97, 0x57, 0x43,	\
+	0x0a, 0x14, 0xdc, 0xdc, 0xdc, 0xf4, 0x29, 0xc5, 0xe0, 0x53, 0xc7, 0x91, 0x29, 0x29, 0x28, 0x10,	\
+	0x20, 0x5d, 0x55, 0xd5, 0x2e, 0xd2, 0x97, 0x55, 0x77, 0xb4, 0xba, 0x2b, 0xb4, 0x19, 0xb8, 0x33,	\
+	0x27, 0x69, 0xb9, 0xb8, 0x53, 0x77, 0x91, 0xb9, 0xc5, 0xe0, 0x81, 0x04, 0x9e, 0x87, 0x54, 0x17,	\
+	0x54, 0x17, 0x43, 0xa0, 0x0b, 0xa0, 0xa4, 0xa4, 0x19, 0x75, 0x48, 0x30, 0x65, 0xd6, 0xe1, 0x4d,	\
+	0x62, 0x9e, 0x1b, 0x85, 0x79, 0x1a, 0xdb, 0x9b, 0x88, 0x10, 0x78, 0x85, 0xe7, 0xf4, 0x20, 0x40,	\
+	0x8c, 0x3d, 0x86, 0xd1, 0x2b, 0x0d, 0xac, 0x23, 0x44, 0x8d, 0x73, 0x77, 0x19, 0x06, 0x30, 0x6b,	\
+	0x9b, 0xf0, 0xd8, 0x38, 0x68, 0x38, 0x38, 0x38, 0x68, 0x68, 0x39, 0x39, 0x3f, 0x54, 0x9c, 0x9c,	\
+	0x65, 0x3f, 0xaa, 0xa6, 0xb6, 0x9e, 0xb6, 0xd6, 0x9e, 0xa4, 0xd5, 0x4e, 0x36, 0x35, 0x6d, 0xad,	\
+	0xaf, 0xc6, 0xb7, 0xe2, 0x74, 0xee, 0xd7, 0xc7, 0xec, 0x77, 0xf2, 0x75, 0x06, 0xd2, 0x0d, 0xad,	\
+	0xa0, 0xa2, 0x44, 0x89, 0x58, 0x19, 0xd8, 0x13, 0xfc, 0x36, 0x8c, 0x58, 0x6d, 0x18, 0xe6, 0x31,	\
+	0xec, 0x63, 0xf3, 0xf4, 0x18, 0xc8, 0x67, 0xe8, 0x67, 0xe8, 0x67, 0xb7, 0xb8, 0x68, 0x39, 0x3a,	\
+	0x2a, 0x28, 0xc9, 0x3f, 0x57, 0xaa, 0x8a, 0x8a, 0xa4, 0xd5, 0x15, 0x11, 0xaa, 0x6a, 0xd3, 0x56,	\
+	0xb8, 0x98, 0xd8, 0x98, 0x98, 0xd9, 0xd8, 0xd8, 0xd9, 0x18, 0x99, 0x08, 0x3e, 0x28, 0x36, 0xbf,	\
+	0x28, 0x36, 0xbf, 0x21, 0x04, 0xac, 0x2c, 0x2c, 0x76, 0x04, 0xb6, 0x8c, 0x6d, 0x12, 0x30, 0x60,	\
+	0xc6, 0xd1, 0x8f, 0x70, 0x6f, 0x6f, 0x6f, 0xd0, 0x8f, 0x6f, 0xcf, 0xd0, 0x6f, 0xd1, 0x92, 0x72,	\
+	0x70, 0xde, 0xa9, 0x3a, 0x2a, 0x29, 0x3f, 0x54, 0x6d, 0x6d, 0x15, 0x4d, 0x15, 0x6d, 0x6d, 0xae,	\
+	0x25, 0xad, 0x6d, 0xad, 0xae, 0x26, 0x76, 0x75, 0xaf, 0xc7, 0x1b, 0x38, 0xea, 0x0d, 0xa3, 0xa8,	\
+	0x10, 0x6d, 0x6d, 0xfd, 0xb6, 0xff, 0x25, 0xa0, 0x84, 0x3f, 0xf6, 0xfb, 0x31, 0x0f, 0x31, 0x0f,	\
+	0x0f, 0x31, 0x31, 0x31, 0xfe, 0x4c, 0x4c, 0x7b, 0xab, 0x2b, 0x26, 0x2b, 0x3d, 0xd5, 0x9e, 0xea,	\
+	0xcb, 0xbf, 0x75, 0xdf, 0xc3, 0xe1, 0x77, 0x77, 0xf0, 0xf8, 0x6b, 0x7c, 0x35, 0xb5, 0xbe, 0xba,	\
+	0xdf, 0x5d, 0x6f, 0xaf, 0xd7, 0xea, 0xfb, 0xfd, 0xcc, 0x43, 0xff, 0x73, 0x13, 0x1f, 0xdf, 0xf7,	\
+	0x23, 0x31, 0x31, 0x31, 0x59, 0x31, 0x59, 0x59, 0x59, 0x59, 0x59, 0xee, 0xbb, 0xac, 0xbb, 0xf7,	\
+	0x5d, 0xfb, 0xac, 0xbe, 0x1f, 0x0b, 0xbf, 0x85, 0xce, 0xb6, 0xb6, 0x7f, 0xd7, 0x3f, 0x5b, 0x5b,	\
+	0x83, 0xeb, 0xf5, 0x95, 0x8b, 0xea, 0x98, 0x94, 0x94, 0x08, 0x12, 0x90, 0x2e, 0xaf, 0x67, 0xa0,	\
+	0xa5, 0xda, 0x5d, 0xed, 0x25, 0x02, 0x04, 0xa4, 0x94, 0xa4, 0x0b, 0xa0, 0x19, 0x49, 0x48, 0x37,	\
+	0x64, 0x32, 0x52, 0x97, 0x57, 0xf5, 0x02, 0x94, 0xa4, 0x09, 0x49, 0x7d, 0x49, 0x4b, 0xb2, 0xa4,	\
+	0x05, 0x28, 0x08, 0x2e, 0x80, 0x2e, 0x80, 0x20, 0x4a, 0x40, 0xbb, 0x2a, 0x41, 0x81, 0x25, 0x29,	\
+	0x02, 0x52, 0xe8, 0x06, 0x4c, 0xec, 0xa9, 0x2a, 0x29, 0x06, 0x52, 0x22, 0x0e, 0x42, 0xfd, 0x3f,	\
+	0x4f, 0xd1, 0x09, 0x57, 0xf4, 0x55, 0xff, 0xdc, 0xc5, 0x55, 0x5f, 0xfd, 0xfb, 0xfe, 0xfd, 0xbe,	\
+	0xda, 0xaf, 0xef, 0xfb, 0xf7, 0xfb, 0xfd, 0xbe, 0xff, 0x7f, 0xf9, 0xef, 0xb7, 0xb7, 0xff, 0x2f,	\
+	0xb0, 0xbf, 0xa2, 0x12, 0x8a, 0x12, 0xaa, 0x12, 0xaa, 0xaf, 0xfe, 0x55, 0x42, 0x53, 0x55, 0xfd,	\
+	0xd5, 0x57, 0xbb, 0x7d, 0xbe, 0xff, 0x7d, 0x79, 0xbf, 0xbf, 0xfc, 0xf6, 0xdb, 0xff, 0x96, 0x97,	\
+	0xd6, 0xf6, 0xf6, 0xf9, 0x60, 0xbe, 0x82, 0x9b, 0xbb, 0x4d, 0xcd, 0xcd, 0xcf, 0x4d, 0xde, 0x46,	\
+	0xe8, 0x41, 0x5d, 0xa6, 0xe6, 0xb6, 0xbf, 0x20, 0x67, 0x86, 0xe1, 0x6f, 0x01, 0x9a, 0xc3, 0x35,	\
+	0x86, 0x0c, 0x41, 0xad, 0xac, 0x5b, 0x77, 0x65, 0xad, 0xbb, 0xb4, 0xdc, 0xdc, 0xdd, 0xe4, 0x16,	\
+	0xf1, 0xe3, 0xec, 0x8b, 0x0c, 0xdc, 0xf0, 0xd6, 0x2d, 0xb8, 0x81, 0x06, 0xe8, 0xbc, 0x77, 0x7b,	\
+	0x7b, 0x86, 0x8c, 0x86, 0xf5, 0x46, 0x43, 0x46, 0x43, 0x49, 0xc3, 0x49, 0xc6, 0x54, 0xcb, 0xd3,	\
+	0xd1, 0x51, 0x1a, 0xa9, 0xa2, 0x97, 0xad, 0x7b, 0x7b, 0x86, 0x7b, 0x7b, 0x7e, 0x8c, 0x93, 0x83,	\
+	0x93, 0x97, 0x8c, 0xa2, 0x8c, 0xa9, 0x8c, 0xa9, 0x97, 0xa2, 0xad, 0xf5, 0x1a, 0xa9, 0xad, 0x13,	\
+	0xc4, 0x7d, 0x78, 0x37, 0xbe, 0xbc, 0x1f, 0x5f, 0xae, 0xf7, 0x07, 0x07, 0x07, 0x06, 0xf6, 0xf7,	\
+	0xd7, 0x7f, 0x83, 0x7b, 0x83, 0x83, 0x7f, 0x83, 0xe5, 0xc3, 0xc3, 0xbf, 0xc1, 0xbf, 0xbf, 0xc1,	\
+	0xc3, 0xbf, 0xf2, 0xe1, 0xd4, 0xfc, 0x7e, 0x37, 0xe3, 0xb8, 0xed, 0x9d, 0x88, 0x77, 0xe3, 0x9d,	\
+	0x91, 0xf1, 0x40, 0x80, 0xea, 0x0d, 0xa3, 0xbf, 0x94, 0x1b, 0x79, 0xc6, 0xb3, 0xbe, 0x39, 0x9b,	\
+	0x67, 0x72, 0x10, 0x67, 0x7e, 0x50, 0x20, 0x41, 0xb5, 0xf9, 0x81, 0x1d, 0xc0, 0x11, 0x92, 0x00,	\
+	0x00, 0x08, 0x8e, 0x00, 0x2f, 0x3f, 0x9e, 0x00, 0x00, 0x00, 0xa1, 0x00, 0x04, 0xe7, 0x73, 0xc0,	\
+	0x04, 0x01, 0xcf, 0x00, 0x00, 0x26, 0x93, 0xb4, 0x7d, 0xb6, 0xb6, 0x7e, 0xdf, 0x9f, 0xb6, 0xd2,	\
+	0x04, 0x07, 0x76, 0xbf, 0x32, 0xcc, 0xd4, 0xdc, 0xf0, 0xdc, 0xf0, 0xf1, 0xe4, 0x78, 0x78, 0x1e,	\
+	0xf0, 0x40, 0x7f, 0x0c, 0x06, 0xbe, 0xba, 0x18, 0x33, 0x70, 0x6d, 0xff, 0x4f, 0x1c, 0x9c, 0x7c,	\
+	0x9c, 0x7b, 0xbc, 0x9b, 0xbb, 0x1c, 0x9c, 0x9b, 0xbb, 0xbb, 0xbc, 0xbb, 0xbc, 0x9b, 0xbc, 0xbc,	\
+	0xbb, 0x1c, 0xbc, 0xbb, 0x1f, 0x7f, 0xbf, 0xde, 0xab, 0x5a, 0x63, 0xf9, 0xe2, 0xfc, 0xff, 0xdb,	\
+	0x7b, 0x7f, 0xf6, 0xdf, 0x16, 0xdf, 0x16, 0xdf, 0x1f, 0x17, 0x1e, 0xdf, 0x1f, 0x1e, 0xdc, 0x4b,	\
+	0x0e, 0x78, 0x0e, 0x7a, 0x47, 0x3c, 0x07, 0x3d, 0x23, 0x9e, 0x90, 0x92, 0x90, 0x90, 0x92, 0x94,	\
+	0x92, 0x94, 0x96, 0xda, 0x5f, 0xc3, 0xc3, 0xbf, 0xc3, 0xf8, 0xe1, 0xda, 0xe1, 0xfc, 0x6c, 0xfe,	\
+	0x36, 0xb2, 0x9a, 0xff, 0x1b, 0x3b, 0x5c, 0x3c, 0x25, 0x5e, 0xef, 0x2c, 0x57, 0x97, 0xc5, 0x15,	\
+	0x28, 0xff, 0x29, 0xe5, 0xf3, 0xd2, 0x52, 0x52, 0x4a, 0x52, 0x55, 0xfb, 0x7c, 0xf6, 0xde, 0xdf,	\
+	0x6f, 0xb7, 0xdb, 0x6d, 0xfe, 0xff, 0xbe, 0xdf, 0xf7, 0xfd, 0xc3, 0xb6, 0xff, 0x48, 0xec, 0x96,	\
+	0xa6, 0xad, 0x4d, 0x5a, 0xfc, 0x6d, 0x4a, 0xf2, 0x9f, 0x7d, 0x7f, 0xbf, 0x2e, 0xbf, 0xdf, 0x95,	\
+	0x7e, 0xbf, 0x8b, 0xc0, 0x00
+
+#endif  //  PHOTODITHER_HUFF_H_INCLUDED
+
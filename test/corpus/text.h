@@ -0,0 +1,1239 @@
+/*
+ *  ST7735 Command Set Encoded Image
+ *  Encoder by Tim Williams, 2018-12-29
+ *  Original: text.png
+ */
+
+#ifndef TEXT_H_INCLUDED
+#define TEXT_H_INCLUDED
+
+#define TEXT_MAGIC_NUMBER	0x371e5453
+#define TEXT_WIDTH		160
+#define TEXT_HEIGHT		128
+#define TEXT_CMD_LEN		7974	/*  Number of command bytes  */
+#define TEXT_PALETTE_LEN		14	/*  Number of bytes (2 * colors)  */
+#define TEXT_TOTAL_LEN		7989	/*  Total array size  */
+
+#define TEXT_PAL		\
+	0x9c, 0xf7,	0x34, 0x2a,	0xf6, 0x6b,	0xb9, 0xb5,		\
+	0xc5, 0x18,	0x54, 0xad,	0x0c, 0x63
+
+#define TEXT_CMDS		\
+	0x05, 0, 0, 119, 160, 9,		\
+	0x25, 0, 17, 160, 5,		\
+	0x07, 189, 155, 22, 5, 97,		\
+	0, 0, 160, 3,		\
+	0, 29, 155, 3,		\
+	0, 39, 155, 3,		\
+	0, 49, 155, 3,		\
+	0, 59, 155, 3,		\
+	0, 69, 155, 3,		\
+	0, 79, 155, 3,		\
+	0, 89, 155, 3,		\
+	0, 99, 155, 3,		\
+	0, 109, 155, 3,		\
+	146, 3, 14, 14,		\
+	0, 3, 4, 14,		\
+	147, 112, 8, 7,		\
+	14, 3, 22, 2,		\
+	132, 82, 6, 7,		\
+	26, 7, 4, 10,		\
+	62, 11, 10, 4,		\
+	15, 62, 5, 7,		\
+	15, 82, 5, 7,		\
+	15, 92, 5, 7,		\
+	21, 32, 5, 7,		\
+	33, 102, 5, 7,		\
+	37, 32, 5, 7,		\
+	39, 22, 5, 7,		\
+	43, 82, 5, 7,		\
+	45, 42, 5, 7,		\
+	51, 52, 5, 7,		\
+	51, 72, 5, 7,		\
+	51, 112, 5, 7,		\
+	61, 62, 5, 7,		\
+	65, 82, 5, 7,		\
+	67, 22, 5, 7,		\
+	67, 92, 5, 7,		\
+	67, 102, 5, 7,		\
+	67, 112, 5, 7,		\
+	71, 32, 5, 7,		\
+	79, 52, 5, 7,		\
+	83, 102, 5, 7,		\
+	87, 32, 5, 7,		\
+	91, 42, 5, 7,		\
+	95, 62, 5, 7,		\
+	97, 72, 5, 7,		\
+	99, 82, 5, 7,		\
+	101, 22, 5, 7,		\
+	101, 52, 5, 7,		\
+	103, 32, 5, 7,		\
+	107, 112, 5, 7,		\
+	111, 102, 5, 7,		\
+	117, 22, 5, 7,		\
+	119, 72, 5, 7,		\
+	119, 92, 5, 7,		\
+	129, 52, 5, 7,		\
+	137, 32, 5, 7,		\
+	137, 42, 5, 7,		\
+	141, 62, 5, 7,		\
+	108, 3, 4, 8,		\
+	0, 22, 4, 7,		\
+	0, 32, 4, 7,		\
+	0, 42, 4, 7,		\
+	0, 52, 4, 7,		\
+	0, 62, 4, 7,		\
+	0, 72, 4, 7,		\
+	0, 82, 4, 7,		\
+	0, 92, 4, 7,		\
+	0, 102, 4, 7,		\
+	0, 112, 4, 7,		\
+	38, 3, 2, 14,		\
+	50, 3, 2, 14,		\
+	74, 3, 2, 14,		\
+	86, 3, 2, 14,		\
+	98, 3, 2, 14,		\
+	122, 3, 2, 14,		\
+	134, 3, 2, 14,		\
+	151, 22, 4, 7,		\
+	151, 52, 4, 7,		\
+	151, 62, 4, 7,		\
+	151, 102, 4, 7,		\
+	4, 11, 6, 4,		\
+	14, 5, 2, 12,		\
+	66, 5, 6, 4,		\
+	110, 11, 4, 6,		\
+	4, 3, 8, 2,		\
+	40, 3, 8, 2,		\
+	52, 3, 8, 2,		\
+	62, 3, 2, 8,		\
+	15, 44, 3, 5,		\
+	67, 54, 3, 5,		\
+	113, 44, 3, 5,		\
+	8, 22, 2, 7,		\
+	8, 52, 2, 7,		\
+	8, 72, 2, 7,		\
+	134, 72, 2, 7,		\
+	153, 32, 2, 7,		\
+	153, 42, 2, 7,		\
+	153, 72, 2, 7,		\
+	153, 92, 2, 7,		\
+	18, 7, 6, 2,		\
+	26, 45, 3, 4,		\
+	40, 9, 6, 2,		\
+	52, 9, 6, 2,		\
+	80, 5, 6, 2,		\
+	94, 3, 2, 6,		\
+	102, 7, 2, 6,		\
+	112, 9, 6, 2,		\
+	114, 15, 6, 2,		\
+	115, 66, 6, 2,		\
+	116, 7, 6, 2,		\
+	124, 15, 6, 2,		\
+	140, 5, 6, 2,		\
+	15, 56, 5, 2,		\
+	31, 84, 2, 5,		\
+	33, 46, 5, 2,		\
+	47, 34, 2, 5,		\
+	49, 64, 2, 5,		\
+	49, 94, 2, 5,		\
+	55, 106, 5, 2,		\
+	61, 104, 2, 5,		\
+	59, 116, 5, 2,		\
+	61, 56, 5, 2,		\
+	106, 24, 2, 5,		\
+	126, 67, 5, 2,		\
+	135, 116, 5, 2,		\
+	141, 116, 5, 2,		\
+	145, 106, 5, 2,		\
+	14, 113, 3, 3,		\
+	36, 66, 3, 3,		\
+	66, 46, 3, 3,		\
+	9, 35, 2, 4,		\
+	7, 47, 4, 2,		\
+	9, 85, 2, 4,		\
+	9, 105, 2, 4,		\
+	10, 9, 4, 2,		\
+	15, 104, 2, 4,		\
+	16, 9, 4, 2,		\
+	18, 15, 4, 2,		\
+	21, 54, 2, 4,		\
+	21, 105, 2, 4,		\
+	33, 114, 2, 4,		\
+	44, 11, 2, 4,		\
+	43, 96, 4, 2,		\
+	48, 86, 4, 2,		\
+	53, 35, 2, 4,		\
+	55, 95, 2, 4,		\
+	56, 11, 2, 4,		\
+	60, 52, 2, 4,		\
+	60, 72, 2, 4,		\
+	65, 35, 2, 4,		\
+	64, 77, 4, 2,		\
+	72, 72, 2, 4,		\
+	76, 3, 2, 4,		\
+	76, 13, 2, 4,		\
+	74, 117, 4, 2,		\
+	79, 45, 2, 4,		\
+	77, 96, 4, 2,		\
+	77, 106, 4, 2,		\
+	83, 95, 2, 4,		\
+	84, 9, 2, 4,		\
+	85, 75, 2, 4,		\
+	86, 82, 2, 4,		\
+	88, 62, 2, 4,		\
+	89, 94, 2, 4,		\
+	88, 106, 4, 2,		\
+	89, 26, 4, 2,		\
+	91, 75, 2, 4,		\
+	95, 26, 4, 2,		\
+	99, 105, 2, 4,		\
+	105, 105, 2, 4,		\
+	107, 76, 4, 2,		\
+	109, 84, 2, 4,		\
+	111, 26, 4, 2,		\
+	112, 3, 4, 2,		\
+	117, 115, 2, 4,		\
+	117, 56, 4, 2,		\
+	121, 105, 2, 4,		\
+	124, 3, 4, 2,		\
+	125, 46, 4, 2,		\
+	127, 105, 2, 4,		\
+	129, 94, 2, 4,		\
+	136, 3, 2, 4,		\
+	136, 13, 2, 4,		\
+	140, 92, 2, 4,		\
+	139, 26, 4, 2,		\
+	144, 9, 2, 4,		\
+	144, 102, 2, 4,		\
+	145, 55, 2, 4,		\
+	143, 86, 4, 2,		\
+	147, 33, 2, 4,		\
+	147, 43, 2, 4,		\
+	0x05, 3, 82, 7, 2, 4,		\
+	0x25, 88, 11, 2, 4,		\
+	0x25, 116, 11, 2, 4,		\
+	0x25, 142, 7, 2, 4,		\
+	0x05, 1, 72, 3, 2, 12,		\
+	0x25, 90, 9, 4, 6,		\
+	0x07, 47, 116, 3, 6, 4,		\
+	36, 3, 2, 10,		\
+	124, 13, 10, 2,		\
+	10, 11, 4, 4,		\
+	32, 5, 2, 8,		\
+	48, 9, 2, 8,		\
+	60, 9, 2, 8,		\
+	100, 3, 8, 2,		\
+	112, 5, 4, 4,		\
+	132, 3, 2, 8,		\
+	4, 15, 6, 2,		\
+	34, 11, 2, 6,		\
+	42, 7, 6, 2,		\
+	54, 7, 6, 2,		\
+	64, 5, 2, 6,		\
+	66, 3, 6, 2,		\
+	104, 15, 6, 2,		\
+	124, 5, 2, 6,		\
+	4, 7, 4, 2,		\
+	6, 9, 4, 2,		\
+	8, 5, 4, 2,		\
+	16, 11, 4, 2,		\
+	18, 13, 4, 2,		\
+	20, 5, 4, 2,		\
+	24, 7, 2, 4,		\
+	40, 11, 2, 4,		\
+	48, 3, 2, 4,		\
+	52, 11, 2, 4,		\
+	60, 3, 2, 4,		\
+	64, 15, 4, 2,		\
+	66, 9, 4, 2,		\
+	78, 13, 2, 4,		\
+	80, 7, 2, 4,		\
+	82, 11, 2, 4,		\
+	84, 13, 2, 4,		\
+	88, 3, 2, 4,		\
+	94, 9, 4, 2,		\
+	100, 7, 2, 4,		\
+	104, 9, 4, 2,		\
+	114, 11, 2, 4,		\
+	120, 13, 2, 4,		\
+	128, 5, 2, 4,		\
+	128, 11, 4, 2,		\
+	138, 13, 2, 4,		\
+	140, 7, 2, 4,		\
+	142, 11, 2, 4,		\
+	144, 13, 2, 4,		\
+	0x02, 0, 72, 26, 13,		\
+	0x22, 94, 116, 13,		\
+	0x07, 32, 112, 82, 13,		\
+	130, 22, 13,		\
+	55, 26, 12,		\
+	125, 36, 12,		\
+	18, 77, 11,		\
+	94, 96, 11,		\
+	118, 87, 11,		\
+	119, 42, 11,		\
+	123, 62, 11,		\
+	19, 27, 10,		\
+	29, 97, 10,		\
+	30, 56, 10,		\
+	98, 42, 10,		\
+	122, 25, 10,		\
+	126, 112, 10,		\
+	13, 73, 9,		\
+	37, 115, 9,		\
+	42, 52, 9,		\
+	43, 107, 9,		\
+	69, 64, 9,		\
+	139, 52, 9,		\
+	4, 102, 8,		\
+	10, 76, 8,		\
+	15, 25, 8,		\
+	25, 94, 8,		\
+	27, 24, 8,		\
+	31, 27, 8,		\
+	70, 82, 8,		\
+	140, 97, 8,		\
+	4, 43, 7,		\
+	73, 76, 7,		\
+	92, 92, 7,		\
+	0x23, 9, 62, 7,		\
+	0x07, 59, 9, 92, 7,		\
+	9, 112, 7,		\
+	15, 32, 7,		\
+	21, 42, 7,		\
+	21, 112, 7,		\
+	25, 62, 7,		\
+	25, 82, 7,		\
+	27, 52, 7,		\
+	27, 102, 7,		\
+	27, 112, 7,		\
+	31, 32, 7,		\
+	31, 62, 7,		\
+	33, 72, 7,		\
+	37, 82, 7,		\
+	39, 42, 7,		\
+	39, 72, 7,		\
+	43, 62, 7,		\
+	45, 72, 7,		\
+	49, 22, 7,		\
+	53, 82, 7,		\
+	55, 42, 7,		\
+	55, 62, 7,		\
+	59, 32, 7,		\
+	59, 82, 7,		\
+	61, 42, 7,		\
+	61, 92, 7,		\
+	73, 42, 7,		\
+	73, 52, 7,		\
+	81, 32, 7,		\
+	81, 82, 7,		\
+	83, 62, 7,		\
+	83, 112, 7,		\
+	85, 42, 7,		\
+	89, 52, 7,		\
+	89, 112, 7,		\
+	93, 82, 7,		\
+	93, 102, 7,		\
+	95, 52, 7,		\
+	97, 32, 7,		\
+	105, 62, 7,		\
+	107, 92, 7,		\
+	111, 52, 7,		\
+	111, 62, 7,		\
+	113, 32, 7,		\
+	113, 72, 7,		\
+	113, 92, 7,		\
+	119, 32, 7,		\
+	123, 52, 7,		\
+	123, 112, 7,		\
+	129, 72, 7,		\
+	131, 42, 7,		\
+	133, 102, 7,		\
+	135, 62, 7,		\
+	135, 92, 7,		\
+	139, 102, 7,		\
+	141, 72, 7,		\
+	145, 22, 7,		\
+	147, 72, 7,		\
+	149, 82, 7,		\
+	0x15, 8, 51, 8, 8,		\
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 4, 4, 4, 4, 0, 0, 0, 0, 5, 5, 0, 0, 0, 0, 4, 5, 4, 4, 4, 0, 0, 4, 4, 4, 0, 4, 0, 4, 0, 0, 4, 6, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,		\
+	0x16, 0x45, 0x00, 82, 51,		\
+	0x16, 0x4a, 0x00, 98, 61,		\
+	0x16, 0x4f, 0x00, 2, 91,		\
+	0x16, 0x54, 0x00, 70, 91,		\
+	0x16, 0x59, 0x00, 114, 101,		\
+	0x15, 61, 21, 8, 8,		\
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 0, 0, 4, 0, 0, 4, 4, 6, 0, 0, 4, 0, 0, 4, 6, 5, 0, 0, 6, 0, 6, 4, 0, 4, 0, 5, 4, 0, 4, 6, 0, 4, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,		\
+	0x16, 0x45, 0x00, 95, 21,		\
+	0x16, 0x4a, 0x00, 111, 21,		\
+	0x16, 0x4f, 0x00, 131, 31,		\
+	0x16, 0x54, 0x00, 77, 101,		\
+	0x16, 0x59, 0x00, 101, 111,		\
+	0x15, 145, 21, 8, 8,		\
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 4, 0, 4, 5, 4, 5, 0, 4, 0, 0, 4, 4, 0, 4, 0, 4, 4, 5, 4, 4, 0, 5, 0, 0, 6, 4, 4, 4, 4, 4, 0, 4, 0, 4, 0, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,		\
+	0x16, 0x45, 0x00, 9, 61,		\
+	0x16, 0x4a, 0x00, 145, 61,		\
+	0x16, 0x4f, 0x00, 113, 71,		\
+	0x16, 0x54, 0x00, 147, 91,		\
+	0x15, 11, 31, 8, 8,		\
+		0, 0, 4, 4, 4, 0, 4, 4, 0, 5, 0, 0, 4, 0, 4, 4, 0, 4, 4, 4, 0, 5, 4, 4, 0, 4, 5, 4, 4, 4, 4, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 4, 6, 0, 0, 0, 4, 0, 0, 4, 4, 5, 4, 0, 0, 5, 0, 4, 0, 4, 0,		\
+	0x16, 0x45, 0x00, 55, 31,		\
+	0x16, 0x4a, 0x00, 137, 71,		\
+	0x15, 74, 41, 8, 8,		\
+		0, 0, 5, 4, 6, 4, 4, 0, 0, 0, 4, 4, 4, 5, 4, 0, 0, 0, 5, 5, 4, 0, 0, 0, 0, 0, 5, 5, 6, 0, 4, 4, 0, 4, 4, 4, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 4, 4, 0, 4, 4, 0,		\
+	0x16, 0x45, 0x00, 80, 71,		\
+	0x16, 0x4a, 0x00, 94, 101,		\
+	0x15, 42, 21, 8, 8,		\
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 4, 6, 4, 4, 0, 0, 0, 4, 4, 4, 5, 4, 0, 0, 0, 5, 5, 4, 0, 0, 0, 0, 0, 5, 5, 6, 0, 4, 4, 0, 4, 4, 4, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0,		\
+	0x16, 0x45, 0x00, 104, 51,		\
+	0x16, 0x4a, 0x00, 132, 51,		\
+	0x16, 0x4f, 0x00, 122, 71,		\
+	0x15, 123, 51, 8, 8,		\
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 4, 4, 0, 0, 0, 4, 4, 0, 4, 5, 4, 0, 0, 5, 4, 0, 0, 0, 6, 0, 0, 0, 4, 5, 0, 4, 0, 0, 4, 4, 0, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,		\
+	0x16, 0x45, 0x00, 89, 61,		\
+	0x16, 0x4a, 0x00, 149, 81,		\
+	0x16, 0x4f, 0x00, 113, 91,		\
+	0x15, 3, 31, 8, 8,		\
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 4, 0, 0, 4, 5, 4, 0, 0, 6, 0, 0, 4, 4, 6, 4, 0, 0, 0, 4, 0, 5, 0, 4, 0, 4, 0, 0, 4, 4, 0, 4, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 0, 0, 0, 0,		\
+	0x16, 0x45, 0x00, 31, 91,		\
+	0x16, 0x4a, 0x00, 15, 101,		\
+	0x15, 48, 41, 8, 8,		\
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 4, 4, 4, 0, 0, 0, 0, 4, 6, 0, 0, 4, 0, 4, 0, 0, 4, 0, 5, 0, 4, 0, 0, 5, 0, 4, 4, 0, 4, 0, 0, 4, 4, 0, 4, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0,		\
+	0x16, 0x45, 0x00, 136, 81,		\
+	0x16, 0x4a, 0x00, 110, 111,		\
+	0x15, 24, 31, 8, 8,		\
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 6, 0, 0, 4, 0, 0, 5, 4, 4, 0, 0, 4, 0, 0, 4, 5, 4, 0, 0, 4, 0, 0, 4, 6, 0, 4, 4, 0, 0, 4, 6, 4, 0, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0,		\
+	0x16, 0x45, 0x00, 18, 61,		\
+	0x16, 0x4a, 0x00, 2, 81,		\
+	0x15, 75, 61, 8, 8,		\
+		0, 4, 4, 0, 4, 4, 0, 5, 0, 6, 4, 0, 6, 4, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 0, 4, 0, 0, 0, 5, 0, 4, 5, 4, 0, 0, 6, 4, 4, 0, 4, 4, 0, 0, 4, 5, 4, 5, 4, 4, 4, 0, 4, 4, 4, 4, 5, 4, 5,		\
+	0x16, 0x45, 0x00, 145, 71,		\
+	0x15, 111, 31, 8, 8,		\
+		0, 4, 0, 5, 0, 4, 0, 4, 0, 0, 4, 4, 0, 4, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 4, 0, 0, 0, 0, 4, 0, 5, 0, 4, 4, 0, 4, 0, 4, 4, 5, 0, 5, 0, 6, 0, 5, 5, 4, 4, 0, 0, 4, 0, 4, 0, 0, 4, 4,		\
+	0x16, 0x45, 0x00, 25, 71,		\
+	0x15, 38, 101, 8, 8,		\
+		0, 6, 4, 0, 4, 5, 4, 5, 0, 4, 0, 0, 4, 4, 0, 4, 0, 4, 4, 5, 4, 4, 0, 5, 0, 0, 6, 4, 4, 4, 4, 4, 0, 4, 0, 4, 0, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 4, 0, 0, 4, 5, 4, 0, 0, 6,		\
+	0x16, 0x45, 0x00, 28, 111,		\
+	0x15, 81, 31, 8, 8,		\
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 4, 0, 0, 0, 0, 4, 0, 5, 0, 4, 4, 0, 4, 0, 4, 4, 5, 0, 5, 0, 6, 0, 5, 5, 4, 4, 0, 0, 4, 0, 4, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,		\
+	0x16, 0x45, 0x00, 97, 31,		\
+	0x16, 0x4a, 0x00, 85, 41,		\
+	0x15, 132, 41, 8, 8,		\
+		0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 6, 0, 5, 0, 5, 0, 0, 4, 4, 0, 4, 0, 4, 6, 0, 6, 0, 0, 0, 0, 4, 4, 0, 4, 0, 0, 4, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,		\
+	0x16, 0x45, 0x00, 136, 61,		\
+	0x16, 0x4a, 0x00, 10, 91,		\
+	0x15, 40, 51, 8, 8,		\
+		0, 4, 4, 6, 0, 5, 5, 4, 0, 4, 5, 4, 4, 4, 4, 6, 0, 0, 4, 0, 4, 4, 4, 5, 0, 0, 0, 0, 4, 5, 0, 4, 0, 0, 4, 0, 4, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 4, 4, 4, 6, 0, 0, 4, 4, 0, 5, 5, 4,		\
+	0x16, 0x45, 0x00, 124, 111,		\
+	0x15, 41, 61, 8, 8,		\
+		0, 4, 4, 4, 0, 5, 4, 4, 0, 4, 5, 4, 4, 4, 4, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 4, 4, 4, 0, 0, 0, 0, 4, 6, 0, 0, 4, 0, 4, 0, 0, 4, 0, 5, 0, 4, 0, 0, 5, 0, 4, 4, 0, 4, 0, 0, 4, 4, 0, 4, 0, 4, 0,		\
+	0x16, 0x45, 0x00, 105, 91,		\
+	0x15, 88, 71, 8, 8,		\
+		0, 4, 4, 0, 0, 5, 5, 0, 0, 4, 4, 0, 5, 4, 0, 0, 0, 4, 4, 0, 4, 5, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 4, 4, 0, 4, 4, 0, 0, 4, 4, 0, 0, 5, 5, 0, 0, 4, 4, 0, 5, 4, 0, 0,		\
+	0x16, 0x45, 0x00, 102, 101,		\
+	0x15, 1, 61, 8, 8,		\
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 4, 0, 4, 0, 0, 5, 0, 0, 4, 4, 0, 0, 0, 4, 0, 4, 5, 4, 0, 0, 0, 4, 0, 0, 4, 0, 4, 0, 0, 5, 4, 4, 0, 4, 5,		\
+	0x16, 0x45, 0x00, 67, 81,		\
+	0x16, 0x4a, 0x00, 1, 101,		\
+	0x15, 56, 51, 8, 8,		\
+		0, 4, 6, 4, 4, 0, 5, 0, 0, 4, 4, 0, 0, 0, 4, 5, 0, 4, 6, 0, 4, 0, 6, 4, 0, 4, 0, 4, 4, 5, 4, 4, 0, 0, 0, 0, 0, 4, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 4, 4, 4, 0, 0, 4, 0, 4, 0, 0, 4, 0, 0, 4,		\
+	0x16, 0x45, 0x00, 140, 101,		\
+	0x15, 8, 21, 8, 8,		\
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 4, 4, 0, 4, 4, 0, 0, 4, 4, 0, 0, 5, 5, 0, 0, 4, 4, 0, 5, 4, 0, 0, 0, 4, 4, 0, 4, 5, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0,		\
+	0x16, 0x45, 0x00, 100, 71,		\
+	0x15, 0, 21, 8, 8,		\
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 4, 4, 0, 0, 0, 0, 4, 6, 4, 6, 5, 0, 0, 4, 4, 4, 5, 4, 4, 0, 0, 5, 6, 6, 0, 5, 4, 4,		\
+	0x16, 0x45, 0x00, 0, 51,		\
+	0x16, 0x4a, 0x00, 0, 71,		\
+	0x15, 140, 31, 8, 8,		\
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 0, 0, 4, 0, 0, 4, 4, 6, 0, 0, 4, 0, 0, 4, 6, 5, 0, 0, 6, 0, 6, 4, 0, 4, 0, 5, 4, 0, 4, 6, 0, 4, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0,		\
+	0x16, 0x45, 0x00, 64, 61,		\
+	0x15, 47, 31, 8, 8,		\
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 4, 6, 0, 5, 0, 4, 0, 0, 4, 4, 4, 4, 5, 0, 0, 0, 4, 5, 0, 4, 4, 4, 0, 4, 4, 4, 4, 4, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 0, 0, 0, 0,		\
+	0x16, 0x45, 0x00, 49, 91,		\
+	0x15, 95, 51, 8, 8,		\
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 4, 4, 4, 4, 0, 0, 0, 0, 5, 5, 0, 0, 0, 0, 4, 5, 4, 4, 4, 0, 0, 4, 4, 4, 0, 4, 0, 4, 0, 0, 4, 6, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,		\
+	0x16, 0x45, 0x00, 45, 111,		\
+	0x15, 67, 33, 4, 4,		\
+		4, 4, 4, 0, 0, 0, 4, 0, 4, 4, 0, 5, 5, 4, 4, 4,		\
+	0x16, 0x15, 0x00, 29, 43,		\
+	0x16, 0x1a, 0x00, 147, 53,		\
+	0x16, 0x1f, 0x00, 21, 83,		\
+	0x16, 0x24, 0x00, 39, 93,		\
+	0x16, 0x29, 0x00, 85, 93,		\
+	0x16, 0x2e, 0x00, 11, 103,		\
+	0x16, 0x33, 0x00, 123, 103,		\
+	0x16, 0x38, 0x00, 129, 103,		\
+	0x15, 72, 22, 4, 4,		\
+		0, 0, 4, 4, 0, 6, 0, 5, 4, 4, 0, 4, 6, 0, 0, 0,		\
+	0x16, 0x15, 0x00, 78, 22,		\
+	0x16, 0x1a, 0x00, 76, 32,		\
+	0x16, 0x1f, 0x00, 126, 32,		\
+	0x16, 0x24, 0x00, 34, 52,		\
+	0x16, 0x29, 0x00, 10, 72,		\
+	0x16, 0x2e, 0x00, 74, 72,		\
+	0x16, 0x33, 0x00, 26, 82,		\
+	0x16, 0x38, 0x00, 96, 112,		\
+	0x15, 134, 23, 4, 4,		\
+		0, 4, 0, 4, 5, 0, 0, 4, 4, 0, 4, 5, 4, 0, 0, 4,		\
+	0x16, 0x15, 0x00, 56, 43,		\
+	0x16, 0x1a, 0x00, 102, 43,		\
+	0x16, 0x1f, 0x00, 120, 43,		\
+	0x16, 0x24, 0x00, 140, 53,		\
+	0x16, 0x29, 0x00, 26, 63,		\
+	0x16, 0x2e, 0x00, 46, 73,		\
+	0x16, 0x33, 0x00, 62, 93,		\
+	0x15, 37, 62, 4, 4,		\
+		0, 0, 0, 0, 0, 4, 4, 0, 0, 4, 4, 4, 5, 0, 0, 4,		\
+	0x16, 0x15, 0x00, 101, 92,		\
+	0x15, 34, 42, 4, 4,		\
+		6, 4, 4, 4, 4, 0, 0, 4, 4, 0, 0, 4, 4, 0, 0, 5,		\
+	0x16, 0x15, 0x00, 16, 52,		\
+	0x16, 0x1a, 0x00, 48, 82,		\
+	0x16, 0x1f, 0x00, 56, 102,		\
+	0x16, 0x24, 0x00, 88, 102,		\
+	0x16, 0x29, 0x00, 136, 112,		\
+	0x16, 0x2e, 0x00, 142, 112,		\
+	0x15, 23, 23, 4, 4,		\
+		4, 5, 4, 0, 4, 4, 6, 4, 0, 5, 0, 4, 4, 4, 0, 4,		\
+	0x16, 0x15, 0x00, 35, 23,		\
+	0x16, 0x1a, 0x00, 143, 43,		\
+	0x16, 0x1f, 0x00, 123, 83,		\
+	0x16, 0x24, 0x00, 131, 93,		\
+	0x16, 0x29, 0x00, 143, 93,		\
+	0x16, 0x2e, 0x00, 63, 113,		\
+	0x15, 107, 32, 4, 4,		\
+		0, 0, 0, 0, 0, 4, 0, 0, 0, 4, 5, 4, 0, 4, 4, 6,		\
+	0x16, 0x15, 0x00, 21, 72,		\
+	0x15, 46, 102, 4, 4,		\
+		0, 4, 4, 6, 4, 0, 5, 0, 0, 4, 4, 0, 0, 0, 0, 0,		\
+	0x16, 0x15, 0x00, 36, 112,		\
+	0x15, 93, 33, 4, 4,		\
+		4, 6, 0, 5, 4, 4, 4, 4, 4, 5, 0, 4, 4, 4, 4, 4,		\
+	0x16, 0x15, 0x00, 51, 63,		\
+	0x16, 0x1a, 0x00, 131, 63,		\
+	0x16, 0x1f, 0x00, 33, 83,		\
+	0x16, 0x24, 0x00, 105, 83,		\
+	0x16, 0x29, 0x00, 63, 103,		\
+	0x15, 84, 62, 4, 4,		\
+		4, 6, 4, 4, 4, 4, 0, 0, 4, 6, 0, 4, 4, 0, 4, 4,		\
+	0x16, 0x15, 0x00, 56, 72,		\
+	0x16, 0x1a, 0x00, 68, 72,		\
+	0x16, 0x1f, 0x00, 82, 82,		\
+	0x16, 0x24, 0x00, 136, 92,		\
+	0x16, 0x29, 0x00, 10, 112,		\
+	0x15, 91, 22, 4, 4,		\
+		0, 5, 4, 4, 0, 4, 5, 4, 0, 4, 6, 0, 4, 6, 4, 0,		\
+	0x16, 0x15, 0x00, 127, 42,		\
+	0x16, 0x1a, 0x00, 119, 52,		\
+	0x16, 0x1f, 0x00, 145, 82,		\
+	0x16, 0x24, 0x00, 45, 92,		\
+	0x16, 0x29, 0x00, 79, 92,		\
+	0x15, 28, 25, 4, 4,		\
+		4, 6, 0, 0, 4, 4, 5, 4, 4, 0, 4, 0, 4, 4, 0, 5,		\
+	0x16, 0x15, 0x00, 32, 35,		\
+	0x16, 0x1a, 0x00, 60, 85,		\
+	0x16, 0x1f, 0x00, 26, 95,		\
+	0x16, 0x24, 0x00, 72, 105,		\
+	0x16, 0x29, 0x00, 4, 115,		\
+	0x15, 48, 53, 4, 4,		\
+		0, 6, 0, 0, 4, 4, 0, 4, 4, 4, 4, 4, 0, 0, 0, 0,		\
+	0x16, 0x15, 0x00, 126, 63,		\
+	0x16, 0x1a, 0x00, 64, 73,		\
+	0x16, 0x1f, 0x00, 118, 83,		\
+	0x16, 0x24, 0x00, 74, 113,		\
+	0x16, 0x29, 0x00, 132, 113,		\
+	0x15, 85, 22, 4, 4,		\
+		0, 4, 4, 0, 4, 4, 0, 0, 4, 4, 0, 5, 4, 4, 0, 4,		\
+	0x16, 0x15, 0x00, 11, 82,		\
+	0x16, 0x1a, 0x00, 57, 92,		\
+	0x16, 0x1f, 0x00, 23, 102,		\
+	0x16, 0x24, 0x00, 119, 112,		\
+	0x15, 42, 32, 4, 4,		\
+		0, 5, 0, 0, 0, 4, 4, 0, 0, 5, 4, 0, 0, 0, 4, 5,		\
+	0x16, 0x15, 0x00, 112, 52,		\
+	0x16, 0x1a, 0x00, 124, 92,		\
+	0x16, 0x1f, 0x00, 22, 112,		\
+	0x16, 0x24, 0x00, 84, 112,		\
+	0x15, 68, 42, 4, 4,		\
+		5, 4, 4, 4, 4, 6, 0, 0, 0, 4, 0, 5, 5, 0, 4, 4,		\
+	0x16, 0x15, 0x00, 28, 52,		\
+	0x16, 0x1a, 0x00, 38, 82,		\
+	0x16, 0x1f, 0x00, 54, 82,		\
+	0x16, 0x24, 0x00, 50, 102,		\
+	0x15, 32, 62, 4, 4,		\
+		4, 4, 0, 4, 4, 4, 6, 0, 5, 6, 4, 4, 0, 4, 5, 0,		\
+	0x16, 0x15, 0x00, 56, 62,		\
+	0x16, 0x1a, 0x00, 112, 62,		\
+	0x16, 0x1f, 0x00, 94, 82,		\
+	0x16, 0x24, 0x00, 56, 112,		\
+	0x15, 57, 22, 4, 4,		\
+		0, 4, 4, 6, 0, 4, 6, 5, 6, 4, 0, 4, 4, 6, 0, 4,		\
+	0x16, 0x15, 0x00, 141, 22,		\
+	0x16, 0x1a, 0x00, 119, 62,		\
+	0x16, 0x1f, 0x00, 109, 72,		\
+	0x16, 0x24, 0x00, 97, 92,		\
+	0x15, 78, 3, 4, 4,		\
+		0, 0, 1, 1, 0, 0, 1, 1, 1, 1, 0, 0, 1, 1, 0, 0,		\
+	0x16, 0x15, 0x00, 138, 3,		\
+	0x16, 0x1a, 0x00, 46, 5,		\
+	0x16, 0x1f, 0x00, 58, 5,		\
+	0x16, 0x24, 0x00, 126, 7,		\
+	0x16, 0x29, 0x00, 22, 9,		\
+	0x16, 0x2e, 0x00, 8, 13,		\
+	0x16, 0x33, 0x00, 16, 13,		\
+	0x16, 0x38, 0x00, 70, 13,		\
+	0x16, 0x3d, 0x00, 94, 13,		\
+	0x15, 149, 34, 4, 4,		\
+		5, 6, 0, 6, 4, 4, 6, 0, 5, 6, 4, 0, 0, 0, 6, 0,		\
+	0x16, 0x15, 0x00, 5, 44,		\
+	0x16, 0x1a, 0x00, 149, 44,		\
+	0x16, 0x1f, 0x00, 17, 74,		\
+	0x16, 0x24, 0x00, 17, 114,		\
+	0x15, 34, 72, 4, 4,		\
+		6, 4, 0, 4, 4, 0, 0, 4, 4, 4, 5, 4, 0, 6, 4, 4,		\
+	0x16, 0x15, 0x00, 40, 72,		\
+	0x16, 0x1a, 0x00, 134, 102,		\
+	0x16, 0x1f, 0x00, 90, 112,		\
+	0x15, 16, 22, 4, 4,		\
+		5, 4, 4, 0, 4, 4, 5, 0, 5, 5, 4, 0, 5, 5, 0, 0,		\
+	0x16, 0x15, 0x00, 122, 22,		\
+	0x16, 0x1a, 0x00, 22, 42,		\
+	0x16, 0x1f, 0x00, 62, 42,		\
+	0x16, 0x24, 0x00, 40, 112,		\
+	0x15, 84, 66, 4, 4,		\
+		0, 5, 0, 0, 0, 4, 5, 0, 0, 6, 4, 0, 5, 4, 4, 0,		\
+	0x16, 0x15, 0x00, 56, 76,		\
+	0x16, 0x1a, 0x00, 68, 76,		\
+	0x16, 0x1f, 0x00, 82, 86,		\
+	0x16, 0x24, 0x00, 136, 96,		\
+	0x16, 0x29, 0x00, 10, 116,		\
+	0x15, 16, 5, 4, 4,		\
+		0, 0, 1, 1, 0, 0, 1, 1, 3, 3, 0, 0, 3, 3, 0, 0,		\
+	0x16, 0x15, 0x00, 76, 9,		\
+	0x16, 0x1a, 0x00, 136, 9,		\
+	0x16, 0x1f, 0x00, 30, 13,		\
+	0x15, 129, 23, 4, 4,		\
+		4, 6, 0, 4, 0, 4, 0, 6, 0, 4, 0, 4, 4, 0, 4, 0,		\
+	0x16, 0x15, 0x00, 23, 53,		\
+	0x16, 0x1a, 0x00, 111, 83,		\
+	0x16, 0x1f, 0x00, 91, 93,		\
+	0x15, 107, 22, 4, 4,		\
+		4, 0, 0, 0, 6, 0, 4, 4, 0, 4, 0, 4, 4, 4, 4, 4,		\
+	0x16, 0x15, 0x00, 17, 42,		\
+	0x16, 0x1a, 0x00, 115, 42,		\
+	0x16, 0x1f, 0x00, 69, 52,		\
+	0x15, 85, 26, 4, 4,		\
+		4, 4, 0, 0, 5, 5, 0, 0, 4, 0, 0, 0, 5, 4, 4, 0,		\
+	0x16, 0x15, 0x00, 11, 86,		\
+	0x16, 0x1a, 0x00, 57, 96,		\
+	0x16, 0x1f, 0x00, 23, 106,		\
+	0x16, 0x24, 0x00, 119, 116,		\
+	0x15, 72, 26, 4, 4,		\
+		0, 0, 0, 0, 0, 5, 0, 0, 0, 4, 6, 0, 0, 4, 4, 0,		\
+	0x16, 0x15, 0x00, 78, 26,		\
+	0x16, 0x1a, 0x00, 76, 36,		\
+	0x16, 0x1f, 0x00, 126, 36,		\
+	0x16, 0x24, 0x00, 34, 56,		\
+	0x16, 0x29, 0x00, 10, 76,		\
+	0x16, 0x2e, 0x00, 74, 76,		\
+	0x16, 0x33, 0x00, 26, 86,		\
+	0x16, 0x38, 0x00, 96, 116,		\
+	0x15, 42, 36, 4, 4,		\
+		4, 4, 0, 0, 4, 5, 4, 0, 0, 0, 6, 0, 0, 4, 0, 0,		\
+	0x16, 0x15, 0x00, 112, 56,		\
+	0x16, 0x1a, 0x00, 124, 96,		\
+	0x16, 0x1f, 0x00, 22, 116,		\
+	0x16, 0x24, 0x00, 84, 116,		\
+	0x15, 40, 5, 4, 4,		\
+		3, 3, 0, 0, 3, 3, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,		\
+	0x16, 0x15, 0x00, 52, 5,		\
+	0x16, 0x1a, 0x00, 34, 7,		\
+	0x16, 0x1f, 0x00, 46, 9,		\
+	0x16, 0x24, 0x00, 58, 9,		\
+	0x16, 0x29, 0x00, 70, 9,		\
+	0x16, 0x2e, 0x00, 80, 11,		\
+	0x16, 0x33, 0x00, 140, 11,		\
+	0x15, 28, 21, 4, 4,		\
+		0, 4, 0, 0, 0, 4, 0, 0, 0, 0, 5, 0, 0, 4, 4, 0,		\
+	0x16, 0x15, 0x00, 32, 31,		\
+	0x16, 0x1a, 0x00, 60, 81,		\
+	0x16, 0x1f, 0x00, 26, 91,		\
+	0x16, 0x24, 0x00, 72, 101,		\
+	0x16, 0x29, 0x00, 4, 111,		\
+	0x15, 16, 26, 4, 4,		\
+		5, 4, 5, 0, 4, 4, 4, 0, 0, 6, 0, 0, 4, 0, 0, 0,		\
+	0x16, 0x15, 0x00, 122, 26,		\
+	0x16, 0x1a, 0x00, 22, 46,		\
+	0x16, 0x1f, 0x00, 62, 46,		\
+	0x16, 0x24, 0x00, 40, 116,		\
+	0x15, 50, 22, 4, 4,		\
+		4, 0, 0, 4, 0, 0, 0, 5, 0, 4, 5, 4, 4, 4, 4, 0,		\
+	0x16, 0x15, 0x00, 106, 62,		\
+	0x16, 0x1a, 0x00, 78, 112,		\
+	0x15, 120, 32, 4, 4,		\
+		0, 4, 4, 4, 0, 5, 0, 4, 6, 4, 4, 0, 4, 5, 4, 5,		\
+	0x16, 0x15, 0x00, 74, 52,		\
+	0x16, 0x1a, 0x00, 88, 82,		\
+	0x15, 11, 43, 4, 4,		\
+		4, 0, 5, 0, 0, 4, 4, 5, 0, 5, 5, 4, 0, 4, 0, 0,		\
+	0x16, 0x15, 0x00, 77, 83,		\
+	0x16, 0x1a, 0x00, 21, 93,		\
+	0x15, 96, 43, 4, 4,		\
+		4, 6, 0, 5, 5, 4, 4, 4, 4, 0, 4, 4, 0, 0, 4, 5,		\
+	0x16, 0x15, 0x00, 108, 43,		\
+	0x16, 0x1a, 0x00, 90, 53,		\
+	0x15, 69, 46, 4, 4,		\
+		4, 0, 4, 0, 0, 4, 0, 0, 0, 4, 0, 0, 0, 4, 0, 0,		\
+	0x16, 0x15, 0x00, 29, 56,		\
+	0x16, 0x1a, 0x00, 39, 86,		\
+	0x16, 0x1f, 0x00, 55, 86,		\
+	0x16, 0x24, 0x00, 51, 106,		\
+	0x15, 32, 66, 4, 4,		\
+		0, 6, 0, 0, 5, 4, 6, 0, 4, 5, 4, 0, 0, 0, 6, 0,		\
+	0x16, 0x15, 0x00, 56, 66,		\
+	0x16, 0x1a, 0x00, 112, 66,		\
+	0x16, 0x1f, 0x00, 94, 86,		\
+	0x16, 0x24, 0x00, 56, 116,		\
+	0x15, 90, 5, 4, 4,		\
+		3, 3, 1, 1, 3, 3, 1, 1, 1, 1, 0, 0, 1, 1, 0, 0,		\
+	0x16, 0x15, 0x00, 106, 11,		\
+	0x15, 34, 76, 4, 4,		\
+		5, 4, 5, 0, 4, 0, 4, 0, 4, 0, 5, 0, 4, 4, 4, 0,		\
+	0x16, 0x15, 0x00, 40, 76,		\
+	0x16, 0x1a, 0x00, 134, 106,		\
+	0x16, 0x1f, 0x00, 90, 116,		\
+	0x15, 67, 37, 4, 4,		\
+		4, 4, 0, 0, 4, 4, 0, 0, 4, 4, 0, 0, 4, 5, 0, 0,		\
+	0x16, 0x15, 0x00, 29, 47,		\
+	0x16, 0x1a, 0x00, 147, 57,		\
+	0x16, 0x1f, 0x00, 21, 87,		\
+	0x16, 0x24, 0x00, 39, 97,		\
+	0x16, 0x29, 0x00, 85, 97,		\
+	0x16, 0x2e, 0x00, 11, 107,		\
+	0x16, 0x33, 0x00, 123, 107,		\
+	0x16, 0x38, 0x00, 129, 107,		\
+	0x15, 134, 27, 4, 4,		\
+		0, 4, 0, 0, 4, 0, 0, 0, 4, 0, 0, 0, 0, 4, 0, 0,		\
+	0x16, 0x15, 0x00, 56, 47,		\
+	0x16, 0x1a, 0x00, 102, 47,		\
+	0x16, 0x1f, 0x00, 120, 47,		\
+	0x16, 0x24, 0x00, 140, 57,		\
+	0x16, 0x29, 0x00, 26, 67,		\
+	0x16, 0x2e, 0x00, 46, 77,		\
+	0x16, 0x33, 0x00, 62, 97,		\
+	0x15, 130, 72, 4, 4,		\
+		4, 0, 0, 4, 0, 4, 6, 4, 4, 4, 4, 5, 5, 6, 6, 0,		\
+	0x16, 0x15, 0x00, 128, 82,		\
+	0x15, 40, 42, 4, 4,		\
+		0, 5, 4, 6, 0, 4, 4, 4, 0, 5, 5, 4, 0, 5, 5, 6,		\
+	0x16, 0x15, 0x00, 28, 102,		\
+	0x15, 50, 26, 4, 4,		\
+		4, 4, 4, 0, 5, 0, 0, 0, 4, 4, 0, 0, 4, 0, 4, 0,		\
+	0x16, 0x15, 0x00, 106, 66,		\
+	0x16, 0x1a, 0x00, 78, 116,		\
+	0x15, 120, 36, 4, 4,		\
+		0, 4, 0, 0, 5, 4, 0, 0, 4, 4, 0, 0, 4, 4, 4, 0,		\
+	0x16, 0x15, 0x00, 74, 56,		\
+	0x16, 0x1a, 0x00, 88, 86,		\
+	0x15, 22, 5, 4, 4,		\
+		1, 1, 0, 0, 1, 1, 0, 0, 3, 3, 1, 1, 3, 3, 1, 1,		\
+	0x16, 0x15, 0x00, 118, 11,		\
+	0x16, 0x1a, 0x00, 40, 13,		\
+	0x16, 0x1f, 0x00, 52, 13,		\
+	0x15, 91, 26, 4, 4,		\
+		0, 0, 4, 0, 0, 0, 4, 0, 4, 4, 0, 0, 4, 4, 4, 0,		\
+	0x16, 0x15, 0x00, 127, 46,		\
+	0x16, 0x1a, 0x00, 119, 56,		\
+	0x16, 0x1f, 0x00, 145, 86,		\
+	0x16, 0x24, 0x00, 45, 96,		\
+	0x16, 0x29, 0x00, 79, 96,		\
+	0x15, 93, 37, 4, 4,		\
+		0, 4, 0, 0, 5, 0, 0, 0, 4, 4, 0, 0, 6, 0, 0, 0,		\
+	0x16, 0x15, 0x00, 51, 67,		\
+	0x16, 0x1a, 0x00, 131, 67,		\
+	0x16, 0x1f, 0x00, 33, 87,		\
+	0x16, 0x24, 0x00, 105, 87,		\
+	0x16, 0x29, 0x00, 63, 107,		\
+	0x15, 91, 97, 14, 2,		\
+		0, 4, 5, 4, 4, 0, 0, 4, 0, 0, 0, 4, 0, 4, 0, 6, 5, 4, 4, 4, 0, 0, 0, 0, 4, 4, 4, 4,		\
+	0x07, 8, 82, 42, 3, 7,		\
+		4, 4, 0, 0, 5, 5, 0, 4, 4, 0, 5, 4, 0, 0, 4, 4, 0, 4, 5, 4, 4,		\
+	123, 63, 3, 6,		\
+		0, 0, 0, 0, 0, 0, 6, 0, 4, 4, 4, 6, 4, 4, 0, 5, 5, 4,		\
+	22, 13, 4, 4,		\
+		0, 0, 1, 1, 0, 0, 1, 1, 1, 1, 3, 3, 1, 1, 3, 3,		\
+	30, 5, 2, 8,		\
+		1, 1, 2, 2, 0, 0, 3, 3, 1, 1, 2, 2, 0, 0, 3, 3,		\
+	100, 13, 4, 4,		\
+		3, 3, 0, 0, 3, 3, 0, 0, 1, 1, 3, 3, 1, 1, 3, 3,		\
+	100, 5, 8, 2,		\
+		2, 2, 2, 2, 1, 1, 1, 1, 2, 2, 2, 2, 0, 0, 0, 0,		\
+	130, 3, 2, 8,		\
+		1, 1, 3, 3, 1, 1, 3, 3, 1, 1, 3, 3, 1, 1, 3, 3,		\
+	126, 27, 8, 2,		\
+		0, 0, 0, 0, 0, 4, 0, 4, 5, 4, 4, 0, 0, 4, 0, 0,		\
+	0x15, 28, 106, 5, 3,		\
+		4, 4, 0, 5, 4, 0, 0, 0, 0, 0, 4, 4, 0, 4, 0,		\
+	0x16, 0x14, 0x00, 40, 46,		\
+	0x15, 115, 83, 3, 5,		\
+		0, 0, 0, 0, 0, 6, 0, 4, 4, 4, 4, 4, 0, 5, 5,		\
+	0x15, 19, 32, 2, 7,		\
+		4, 4, 0, 4, 4, 0, 5, 6, 4, 0, 6, 4, 0, 4,		\
+	0x15, 54, 27, 7, 2,		\
+		0, 0, 0, 0, 0, 4, 0, 4, 0, 6, 5, 4, 4, 4,		\
+	0x15, 62, 72, 2, 7,		\
+		0, 6, 0, 4, 4, 4, 6, 0, 4, 4, 0, 5, 5, 4,		\
+	0x16, 0x39, 0x00, 63, 32,		\
+	0x16, 0x18, 0x00, 72, 112,		\
+	0x15, 106, 47, 7, 2,		\
+		4, 5, 0, 0, 5, 4, 4, 6, 4, 5, 0, 4, 4, 0,		\
+	0x07, 6, 142, 47, 7, 2,		\
+		0, 4, 0, 6, 0, 0, 0, 4, 0, 4, 0, 0, 4, 5,		\
+	8, 7, 6, 2,		\
+		3, 3, 3, 3, 2, 2, 2, 2, 1, 1, 1, 1,		\
+	20, 97, 6, 2,		\
+		0, 0, 4, 4, 0, 5, 4, 0, 4, 4, 0, 0,		\
+	36, 116, 4, 3,		\
+		4, 0, 0, 4, 0, 4, 4, 0, 4, 0, 0, 0,		\
+	54, 22, 3, 4,		\
+		0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 4, 4,		\
+	60, 112, 3, 4,		\
+		0, 4, 0, 4, 0, 0, 0, 0, 0, 4, 0, 0,		\
+	0x15, 64, 52, 3, 4,		\
+		4, 0, 0, 4, 4, 0, 0, 5, 4, 4, 4, 4,		\
+	0x07, 10, 72, 65, 3, 4,		\
+		4, 6, 0, 0, 4, 4, 5, 4, 4, 0, 4, 0,		\
+	75, 83, 2, 6,		\
+		0, 0, 0, 0, 0, 0, 0, 4, 0, 4, 0, 0,		\
+	82, 22, 3, 4,		\
+		4, 0, 0, 4, 0, 0, 0, 0, 0, 4, 4, 0,		\
+	88, 15, 6, 2,		\
+		1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3,		\
+	96, 3, 2, 6,		\
+		0, 0, 1, 1, 0, 0, 0, 0, 1, 1, 0, 0,		\
+	96, 47, 6, 2,		\
+		5, 4, 4, 6, 4, 5, 0, 4, 4, 0, 0, 0,		\
+	116, 52, 3, 4,		\
+		4, 4, 0, 4, 0, 0, 0, 0, 0, 0, 4, 6,		\
+	116, 62, 3, 4,		\
+		0, 4, 0, 4, 0, 0, 0, 0, 0, 0, 4, 4,		\
+	116, 46, 4, 3,		\
+		4, 4, 0, 4, 6, 0, 4, 0, 0, 0, 0, 0,		\
+	130, 76, 4, 3,		\
+		4, 0, 0, 6, 5, 0, 4, 4, 0, 5, 4, 4,		\
+	0x16, 0xb3, 0x00, 148, 102,		\
+	0x15, 90, 57, 5, 2,		\
+		5, 4, 4, 6, 4, 5, 0, 4, 4, 0,		\
+	0x15, 14, 116, 3, 3,		\
+		4, 0, 4, 0, 0, 0, 0, 4, 5,		\
+	0x15, 18, 46, 3, 3,		\
+		4, 4, 0, 4, 6, 0, 4, 0, 0,		\
+	0x15, 20, 22, 3, 3,		\
+		4, 4, 4, 0, 0, 0, 0, 4, 0,		\
+	0x15, 26, 42, 3, 3,		\
+		4, 4, 4, 0, 0, 0, 0, 4, 4,		\
+	0x16, 0x2a, 0x00, 70, 56,		\
+	0x16, 0x2f, 0x00, 108, 26,		\
+	0x15, 108, 36, 3, 3,		\
+		0, 0, 4, 0, 0, 6, 4, 0, 0,		\
+	0x07, 3, 124, 43, 3, 3,		\
+		5, 4, 4, 0, 0, 0, 0, 4, 6,		\
+	126, 22, 3, 3,		\
+		4, 4, 4, 0, 0, 0, 4, 4, 0,		\
+	138, 23, 3, 3,		\
+		5, 4, 4, 0, 0, 0, 0, 4, 4,		\
+	0x15, 4, 5, 4, 2,		\
+		0, 0, 0, 0, 3, 3, 3, 3,		\
+	0x15, 12, 3, 2, 4,		\
+		1, 1, 2, 2, 1, 1, 2, 2,		\
+	0x15, 11, 47, 4, 2,		\
+		4, 4, 0, 5, 4, 0, 4, 4,		\
+	0x15, 17, 112, 4, 2,		\
+		4, 0, 4, 0, 4, 0, 4, 0,		\
+	0x15, 20, 9, 2, 4,		\
+		1, 1, 3, 3, 1, 1, 3, 3,		\
+	0x16, 0x41, 0x00, 26, 5,		\
+	0x15, 32, 52, 2, 4,		\
+		4, 4, 0, 4, 0, 0, 0, 0,		\
+	0x15, 36, 13, 2, 4,		\
+		2, 2, 0, 0, 2, 2, 0, 0,		\
+	0x15, 38, 52, 2, 4,		\
+		4, 0, 0, 4, 0, 0, 0, 0,		\
+	0x15, 43, 92, 2, 4,		\
+		0, 0, 0, 0, 0, 0, 4, 6,		\
+	0x15, 44, 15, 4, 2,		\
+		2, 2, 2, 2, 0, 0, 0, 0,		\
+	0x16, 0x41, 0x00, 54, 102,		\
+	0x16, 0x12, 0x00, 56, 15,		\
+	0x15, 66, 42, 2, 4,		\
+		4, 4, 4, 0, 0, 0, 0, 0,		\
+	0x16, 0x3e, 0x00, 76, 22,		\
+	0x15, 76, 7, 4, 2,		\
+		1, 1, 1, 1, 0, 0, 0, 0,		\
+	0x16, 0x50, 0x00, 78, 72,		\
+	0x16, 0x9b, 0x00, 77, 87,		\
+	0x15, 80, 15, 4, 2,		\
+		3, 3, 3, 3, 0, 0, 0, 0,		\
+	0x15, 82, 3, 4, 2,		\
+		2, 2, 2, 2, 1, 1, 1, 1,		\
+	0x16, 0x81, 0x00, 88, 7,		\
+	0x16, 0x6c, 0x00, 89, 22,		\
+	0x16, 0x3b, 0x00, 90, 3,		\
+	0x15, 94, 112, 2, 4,		\
+		4, 0, 4, 0, 0, 0, 0, 0,		\
+	0x16, 0x36, 0x00, 94, 11,		\
+	0x16, 0x12, 0x00, 100, 43,		\
+	0x15, 104, 11, 2, 4,		\
+		0, 0, 2, 2, 0, 0, 2, 2,		\
+	0x07, 3, 104, 7, 4, 2,		\
+		0, 0, 0, 0, 1, 1, 1, 1,		\
+	106, 43, 2, 4,		\
+		5, 4, 4, 0, 0, 0, 0, 0,		\
+	118, 9, 4, 2,		\
+		3, 3, 3, 3, 1, 1, 1, 1,		\
+	0x15, 124, 32, 2, 4,		\
+		4, 4, 4, 4, 0, 0, 0, 0,		\
+	0x16, 0x3a, 0x01, 124, 11,		\
+	0x15, 130, 15, 4, 2,		\
+		1, 1, 1, 1, 3, 3, 3, 3,		\
+	0x15, 131, 97, 4, 2,		\
+		0, 6, 0, 0, 0, 4, 0, 4,		\
+	0x16, 0xb6, 0x00, 136, 7,		\
+	0x16, 0x31, 0x00, 140, 112,		\
+	0x16, 0xa9, 0x00, 140, 15,		\
+	0x16, 0xa1, 0x00, 142, 3,		\
+	0x16, 0x46, 0x01, 149, 32,		\
+	0x15, 9, 44, 2, 3,		\
+		0, 0, 0, 4, 0, 4,		\
+	0x15, 14, 74, 3, 2,		\
+		0, 4, 0, 0, 0, 0,		\
+	0x07, 3, 32, 25, 3, 2,		\
+		6, 4, 0, 0, 0, 0,		\
+	39, 66, 2, 3,		\
+		0, 4, 4, 0, 4, 4,		\
+	48, 57, 3, 2,		\
+		0, 0, 0, 0, 0, 0,		\
+	0x15, 60, 76, 2, 3,		\
+		4, 0, 4, 0, 0, 0,		\
+	0x15, 65, 32, 2, 3,		\
+		0, 0, 0, 0, 4, 4,		\
+	0x15, 72, 62, 3, 2,		\
+		4, 0, 4, 0, 0, 5,		\
+	0x16, 0x4c, 0x00, 82, 27,		\
+	0x16, 0x26, 0x00, 86, 86,		\
+	0x16, 0x20, 0x00, 95, 93,		\
+	0x15, 111, 76, 2, 3,		\
+		0, 5, 4, 0, 4, 4,		\
+	0x15, 129, 86, 3, 2,		\
+		6, 5, 4, 4, 5, 4,		\
+	0x15, 4, 9, 2, 2,		\
+		2, 2, 2, 2,		\
+	0x15, 9, 103, 2, 2,		\
+		0, 0, 4, 4,		\
+	0x15, 12, 15, 2, 2,		\
+		1, 1, 1, 1,		\
+	0x16, 0x09, 0x00, 34, 5,		\
+	0x15, 38, 57, 2, 2,		\
+		0, 4, 0, 0,		\
+	0x16, 0x17, 0x00, 42, 11,		\
+	0x15, 44, 5, 2, 2,		\
+		3, 3, 3, 3,		\
+	0x16, 0x25, 0x00, 46, 13,		\
+	0x16, 0x2a, 0x00, 54, 11,		\
+	0x16, 0x13, 0x00, 56, 5,		\
+	0x16, 0x34, 0x00, 58, 13,		\
+	0x15, 62, 15, 2, 2,		\
+		0, 0, 0, 0,		\
+	0x16, 0x54, 0x00, 64, 3,		\
+	0x16, 0x50, 0x00, 67, 52,		\
+	0x16, 0x30, 0x00, 68, 15,		\
+	0x16, 0x43, 0x00, 72, 77,		\
+	0x16, 0x48, 0x00, 76, 27,		\
+	0x16, 0x4d, 0x00, 78, 77,		\
+	0x16, 0x69, 0x00, 83, 93,		\
+	0x16, 0x65, 0x00, 84, 7,		\
+	0x15, 94, 117, 2, 2,		\
+		4, 6, 0, 0,		\
+	0x16, 0x3a, 0x00, 100, 11,		\
+	0x15, 121, 66, 2, 2,		\
+		0, 5, 0, 4,		\
+	0x15, 124, 37, 2, 2,		\
+		4, 5, 0, 0,		\
+	0x16, 0x6e, 0x00, 126, 5,		\
+	0x16, 0x98, 0x00, 127, 103,		\
+	0x16, 0xa6, 0x00, 128, 3,		\
+	0x16, 0x7d, 0x00, 132, 11,		\
+	0x16, 0x26, 0x00, 143, 26,		\
+	0x16, 0xa3, 0x00, 144, 7,		\
+	0x16, 0xb1, 0x00, 145, 53,		\
+	0x12, 109, 88, 23,		\
+		0, 4, 4, 4, 0, 4, 0, 6, 4, 0, 0, 0, 0, 4, 6, 0, 4, 4, 0, 0, 0, 0, 4,		\
+	0x07, 12, 132, 118, 15,		\
+		0, 0, 0, 0, 4, 4, 5, 4, 0, 0, 4, 4, 5, 4, 0,		\
+	4, 42, 13,		\
+		4, 4, 4, 4, 4, 0, 0, 0, 4, 6, 4, 0, 4,		\
+	14, 78, 11,		\
+		4, 0, 5, 4, 5, 0, 0, 0, 4, 6, 0,		\
+	16, 58, 11,		\
+		4, 4, 5, 4, 0, 0, 4, 4, 4, 0, 4,		\
+	122, 102, 11,		\
+		0, 0, 5, 4, 4, 0, 0, 0, 5, 4, 4,		\
+	142, 42, 11,		\
+		0, 0, 0, 4, 0, 0, 4, 4, 4, 4, 4,		\
+	83, 92, 9,		\
+		0, 0, 0, 5, 4, 4, 0, 4, 5,		\
+	20, 28, 8,		\
+		0, 0, 4, 6, 0, 4, 4, 0,		\
+	104, 82, 8,		\
+		0, 0, 0, 0, 4, 0, 4, 5,		\
+	14, 72, 7,		\
+		4, 0, 4, 4, 4, 4, 4,		\
+	20, 52, 7,		\
+		4, 0, 4, 5, 0, 0, 0,		\
+	32, 22, 7,		\
+		6, 0, 0, 0, 0, 4, 0,		\
+	0x12, 32, 28, 7,		\
+		4, 0, 4, 6, 0, 4, 4,		\
+	0x07, 4, 60, 118, 7,		\
+		0, 0, 4, 6, 0, 4, 4,		\
+	108, 42, 7,		\
+		4, 4, 0, 0, 0, 0, 4,		\
+	116, 68, 7,		\
+		0, 0, 4, 4, 6, 4, 4,		\
+	138, 28, 7,		\
+		5, 0, 4, 4, 6, 4, 4,		\
+	0x16, 0x35, 0x00, 140, 98,		\
+	0x12, 20, 92, 6,		\
+		0, 0, 4, 6, 4, 0,		\
+	0x12, 31, 82, 6,		\
+		0, 0, 0, 0, 0, 4,		\
+	0x16, 0x0a, 0x00, 49, 62,		\
+	0x16, 0x0f, 0x00, 61, 102,		\
+	0x12, 129, 92, 6,		\
+		0, 0, 0, 0, 4, 0,		\
+	0x12, 23, 22, 5,		\
+		0, 0, 4, 0, 0,		\
+	0x12, 29, 42, 5,		\
+		0, 5, 4, 4, 0,		\
+	0x12, 33, 48, 5,		\
+		0, 4, 4, 5, 4,		\
+	0x12, 46, 106, 5,		\
+		4, 4, 4, 0, 0,		\
+	0x12, 46, 108, 5,		\
+		0, 4, 4, 0, 0,		\
+	0x16, 0x1b, 0x00, 55, 108,		\
+	0x12, 90, 52, 5,		\
+		4, 4, 0, 0, 0,		\
+	0x12, 148, 38, 5,		\
+		5, 4, 5, 0, 0,		\
+	0x12, 17, 118, 4,		\
+		4, 5, 0, 0,		\
+	0x12, 21, 76, 4,		\
+		0, 0, 0, 4,		\
+	0x12, 21, 82, 4,		\
+		0, 5, 4, 4,		\
+	0x12, 23, 57, 4,		\
+		0, 5, 4, 0,		\
+	0x12, 26, 62, 4,		\
+		0, 0, 0, 0,		\
+	0x16, 0x18, 0x00, 39, 92,		\
+	0x16, 0x0d, 0x00, 46, 72,		\
+	0x12, 48, 88, 4,		\
+		4, 4, 5, 4,		\
+	0x16, 0x1a, 0x00, 56, 42,		\
+	0x16, 0x1f, 0x00, 62, 92,		\
+	0x12, 63, 112, 4,		\
+		0, 0, 4, 0,		\
+	0x16, 0x2c, 0x00, 64, 72,		\
+	0x16, 0x41, 0x00, 67, 32,		\
+	0x16, 0x36, 0x00, 74, 112,		\
+	0x16, 0x29, 0x00, 88, 108,		\
+	0x16, 0x58, 0x00, 93, 32,		\
+	0x16, 0x4d, 0x00, 111, 87,		\
+	0x16, 0x26, 0x00, 143, 92,		\
+	0x16, 0x4f, 0x00, 149, 43,		\
+	0x16, 0x74, 0x00, 149, 48,		\
+	0x12, 12, 102, 3,		\
+		5, 4, 4,		\
+	0x12, 14, 77, 3,		\
+		0, 0, 4,		\
+	0x16, 0x07, 0x00, 14, 112,		\
+	0x12, 20, 26, 3,		\
+		0, 0, 0,		\
+	0x12, 32, 23, 3,		\
+		4, 0, 4,		\
+	0x12, 64, 58, 3,		\
+		5, 4, 0,		\
+	0x16, 0x15, 0x00, 64, 117,		\
+	0x12, 78, 82, 3,		\
+		4, 6, 4,		\
+	0x12, 108, 78, 3,		\
+		4, 4, 6,		\
+	0x16, 0x28, 0x00, 126, 26,		\
+	0x16, 0x2d, 0x00, 132, 117,		\
+	0x16, 0x45, 0x00, 148, 52,		\
+	0x16, 0x29, 0x00, 148, 108,		\
+	0x12, 5, 48, 2,		\
+		4, 5,		\
+	0x12, 15, 43, 2,		\
+		0, 4,		\
+	0x16, 0x06, 0x00, 21, 53,		\
+	0x12, 31, 83, 2,		\
+		0, 5,		\
+	0x16, 0x11, 0x00, 43, 98,		\
+	0x16, 0x0b, 0x00, 49, 63,		\
+	0x16, 0x10, 0x00, 61, 103,		\
+	0x16, 0x20, 0x00, 89, 28,		\
+	0x16, 0x25, 0x00, 89, 93,		\
+	0x16, 0x2a, 0x00, 89, 98,		\
+	0x12, 96, 42, 2,		\
+		4, 4,		\
+	0x16, 0x35, 0x00, 109, 83,		\
+	0x16, 0x3a, 0x00, 113, 43,		\
+	0x16, 0x3f, 0x00, 117, 58,		\
+	0x16, 0x44, 0x00, 125, 48,		\
+	0x12, 125, 82, 2,		\
+		4, 0,		\
+	0x16, 0x4f, 0x00, 129, 93,		\
+	0x16, 0x54, 0x00, 129, 98,		\
+	0x16, 0x10, 0x00, 140, 96,		\
+	0x13, 8, 112, 7,		\
+		6, 4, 0, 6, 4, 0, 4,		\
+	0x13, 20, 82, 7,		\
+		0, 4, 4, 0, 0, 0, 0,		\
+	0x13, 26, 112, 7,		\
+		4, 4, 0, 4, 4, 4, 4,		\
+	0x13, 30, 62, 7,		\
+		0, 5, 4, 4, 0, 4, 5,		\
+	0x13, 30, 82, 7,		\
+		4, 0, 0, 4, 0, 0, 4,		\
+	0x16, 0x37, 0x00, 36, 32,		\
+	0x13, 38, 42, 7,		\
+		4, 4, 4, 4, 4, 4, 0,		\
+	0x13, 38, 72, 7,		\
+		4, 0, 4, 0, 0, 4, 6,		\
+	0x16, 0x0b, 0x00, 44, 72,		\
+	0x16, 0x41, 0x00, 46, 32,		\
+	0x16, 0x3b, 0x00, 50, 72,		\
+	0x16, 0x25, 0x00, 52, 82,		\
+	0x16, 0x45, 0x00, 60, 42,		\
+	0x13, 60, 62, 7,		\
+		0, 4, 0, 4, 0, 0, 0,		\
+	0x16, 0x3a, 0x00, 60, 102,		\
+	0x16, 0x7b, 0x00, 64, 82,		\
+	0x16, 0x5f, 0x00, 66, 92,		\
+	0x16, 0x85, 0x00, 76, 102,		\
+	0x13, 78, 52, 7,		\
+		4, 4, 4, 4, 5, 4, 5,		\
+	0x16, 0x69, 0x00, 80, 32,		\
+	0x13, 82, 112, 7,		\
+		0, 4, 6, 0, 6, 0, 0,		\
+	0x16, 0x8f, 0x00, 88, 112,		\
+	0x13, 92, 32, 7,		\
+		0, 5, 0, 0, 0, 0, 0,		\
+	0x16, 0x2b, 0x00, 92, 82,		\
+	0x16, 0x7e, 0x00, 92, 102,		\
+	0x13, 96, 72, 7,		\
+		4, 4, 0, 4, 5, 4, 4,		\
+	0x16, 0x5f, 0x00, 98, 82,		\
+	0x16, 0x35, 0x00, 110, 62,		\
+	0x16, 0x15, 0x00, 110, 102,		\
+	0x16, 0xc3, 0x00, 128, 92,		\
+	0x16, 0xd3, 0x00, 136, 72,		\
+	0x16, 0x9c, 0x00, 138, 102,		\
+	0x13, 104, 83, 6,		\
+		5, 0, 0, 0, 0, 0,		\
+	0x07, 6, 144, 53, 6,		\
+		5, 4, 4, 0, 4, 5,		\
+	146, 112, 6,		\
+		4, 4, 4, 4, 4, 4,		\
+	4, 44, 5,		\
+		0, 0, 0, 4, 5,		\
+	20, 53, 5,		\
+		4, 4, 4, 4, 4,		\
+	127, 82, 5,		\
+		0, 0, 0, 0, 0,		\
+	142, 92, 5,		\
+		0, 4, 0, 0, 0,		\
+	0x13, 20, 93, 4,		\
+		0, 4, 0, 4,		\
+	0x13, 32, 102, 4,		\
+		4, 4, 4, 0,		\
+	0x16, 0x10, 0x00, 36, 62,		\
+	0x13, 42, 82, 4,		\
+		4, 4, 0, 4,		\
+	0x16, 0x15, 0x00, 44, 42,		\
+	0x16, 0x0d, 0x00, 58, 82,		\
+	0x16, 0x12, 0x00, 72, 42,		\
+	0x13, 78, 92, 4,		\
+		0, 0, 4, 6,		\
+	0x13, 94, 53, 4,		\
+		4, 0, 4, 0,		\
+	0x13, 100, 112, 4,		\
+		4, 0, 0, 4,		\
+	0x13, 108, 72, 4,		\
+		0, 0, 4, 4,		\
+	0x16, 0x18, 0x00, 112, 43,		\
+	0x13, 122, 83, 4,		\
+		4, 0, 0, 0,		\
+	0x16, 0x1d, 0x00, 130, 32,		\
+	0x13, 130, 63, 4,		\
+		5, 0, 0, 0,		\
+	0x13, 133, 23, 4,		\
+		0, 0, 0, 0,		\
+	0x16, 0x1d, 0x00, 142, 43,		\
+	0x16, 0x47, 0x00, 144, 82,		\
+	0x13, 10, 82, 3,		\
+		0, 4, 4,		\
+	0x13, 28, 56, 3,		\
+		0, 0, 0,		\
+	0x16, 0x07, 0x00, 33, 43,		\
+	0x16, 0x0c, 0x00, 38, 86,		\
+	0x13, 44, 112, 3,		\
+		4, 4, 4,		\
+	0x16, 0x18, 0x00, 44, 116,		\
+	0x16, 0x1d, 0x00, 54, 86,		\
+	0x13, 88, 66, 3,		\
+		4, 0, 4,		\
+	0x16, 0x18, 0x00, 116, 56,		\
+	0x16, 0x35, 0x00, 118, 112,		\
+	0x16, 0x33, 0x00, 119, 43,		\
+	0x13, 124, 46, 3,		\
+		0, 4, 5,		\
+	0x13, 25, 95, 2,		\
+		0, 0,		\
+	0x16, 0x06, 0x00, 27, 25,		\
+	0x13, 30, 92, 2,		\
+		6, 4,		\
+	0x16, 0x06, 0x00, 30, 95,		\
+	0x16, 0x16, 0x00, 33, 57,		\
+	0x13, 66, 56, 2,		\
+		4, 4,		\
+	0x13, 100, 117, 2,		\
+		0, 4,		\
+	0x16, 0x0c, 0x00, 106, 22,		\
+	0x16, 0x11, 0x00, 122, 103,		\
+	0x16, 0x10, 0x00, 130, 37,		\
+	0x16, 0x15, 0x00, 138, 26,		\
+	0x16, 0x20, 0x00, 140, 116,		\
+	0x16, 0x25, 0x00, 150, 106,		\
+	0x21, 25, 93,		\
+	0x21, 27, 23,		\
+	0x01, 4, 30, 98,		\
+	0x21, 72, 76,		\
+	0x07, 6, 78, 98,		\
+	128, 86,		\
+	134, 62,		\
+	144, 88,		\
+	148, 32,		\
+	148, 37,		\
+	0x01, 5, 124, 36,		\
+	0x21, 129, 22,		\
+	0x01, 6, 54, 26,		\
+	0xff
+
+#endif  //  TEXT_H_INCLUDED
+
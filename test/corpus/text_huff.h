@@ -0,0 +1,348 @@
+/*
+ *  ST7735 Huffman Coded Image (draw with drawHuffImage())
+ *  Original: text.png
+ *  Commands: 14352 bytes, coded: 5237 (code tables and bitstream); total 5252 vs. 7989 bytes
+ */
+
+#ifndef TEXT_HUFF_H_INCLUDED
+#define TEXT_HUFF_H_INCLUDED
+
+#define TEXT_WIDTH		160
+#define TEXT_HEIGHT		128
+#define TEXT_HUFF_LEN		5252	/*  Total array size  */
+
+#define TEXT_HUFF		\
+	7,		\
+	0x9c, 0xf7,	0x34, 0x2a,	0xf6, 0x6b,	0xb9, 0xb5,		\
+	0xc5, 0x18,	0x54, 0xad,	0x0c, 0x63,		\
+	0x00, 0x01, 0x04, 0x01, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0x05, 0x21,	\
+	0x25, 0x15, 0x02, 0x12, 0x13, 0x22, 0x23, 0xff, 0x00, 0x01, 0x00, 0x03, 0x02, 0x03, 0x12, 0x2c,	\
+	0x3e, 0x10, 0x08, 0x00, 0x04, 0x02, 0x07, 0x08, 0x03, 0x05, 0x48, 0x52, 0x70, 0x00, 0x06, 0x09,	\
+	0x0b, 0x0d, 0x0f, 0x16, 0x1a, 0x20, 0x2a, 0x2b, 0x34, 0x38, 0x3e, 0x4c, 0x5c, 0x66, 0x74, 0x0a,	\
+	0x0e, 0x15, 0x17, 0x1b, 0x1c, 0x1f, 0x21, 0x24, 0x28, 0x2c, 0x2e, 0x2f, 0x30, 0x33, 0x35, 0x3c,	\
+	0x3d, 0x3f, 0x40, 0x42, 0x43, 0x4a, 0x4d, 0x4e, 0x53, 0x56, 0x58, 0x5b, 0x5d, 0x5e, 0x5f, 0x60,	\
+	0x61, 0x65, 0x69, 0x6a, 0x6c, 0x6f, 0x71, 0x77, 0x7c, 0x81, 0x8c, 0x0c, 0x10, 0x14, 0x19, 0x1d,	\
+	0x1e, 0x22, 0x23, 0x25, 0x26, 0x27, 0x29, 0x2d, 0x31, 0x32, 0x36, 0x37, 0x39, 0x3a, 0x3b, 0x44,	\
+	0x46, 0x47, 0x49, 0x4f, 0x50, 0x51, 0x54, 0x55, 0x57, 0x59, 0x5a, 0x62, 0x64, 0x67, 0x68, 0x6b,	\
+	0x6d, 0x72, 0x73, 0x75, 0x76, 0x78, 0x7a, 0x7b, 0x7e, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x86, 0x88,	\
+	0x8a, 0x8e, 0x8f, 0x90, 0x91, 0x93, 0x94, 0x95, 0x9b, 0x11, 0x12, 0x18, 0x41, 0x45, 0x4b, 0x63,	\
+	0x6e, 0x7d, 0x87, 0x89, 0x8b, 0x8d, 0x97, 0x99, 0xa0, 0x01, 0x13, 0x79, 0x85, 0x92, 0x96, 0xbd,	\
+	0xc6, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x05,	\
+	0x06, 0x01, 0x02, 0x03, 0x68, 0xdb, 0x1f, 0xdc, 0x8b, 0x1b, 0xec, 0xfe, 0xde, 0x7f, 0xef, 0xac,	\
+	0xc7, 0xe8, 0xc6, 0x8d, 0xfd, 0xba, 0x36, 0xf3, 0xea, 0xe8, 0xdc, 0x2f, 0xab, 0xa3, 0x71, 0x7e,	\
+	0xae, 0x8d, 0xcb, 0xfa, 0xba, 0x37, 0xe1, 0xf5, 0x74, 0x6e, 0x87, 0xd5, 0xd1, 0xba, 0xdf, 0x57,	\
+	0x46, 0xfc, 0xbe, 0xae, 0x8d, 0xdd, 0xfa, 0xbb, 0xfe, 0x3a, 0xc6, 0xc6, 0x33, 0x8b, 0x1f, 0x94,	\
+	0x4c, 0xb6, 0x2e, 0x98, 0x9e, 0xa8, 0x63, 0xac, 0xd5, 0x2c, 0x29, 0xc9, 0xb0, 0x25, 0xd3, 0x7a,	\
+	0xcb, 0x85, 0xeb, 0x2e, 0xab, 0xd6, 0xca, 0x73, 0xd6, 0xde, 0xb3, 0xd7, 0x81, 0x39, 0xeb, 0xc2,	\
+	0x98, 0xf5, 0xa1, 0x0b, 0xd7, 0x89, 0x3d, 0xeb, 0x7d, 0x45, 0xeb, 0x7d, 0x03, 0xd6, 0xfa, 0x27,	\
+	0xae, 0x0d, 0x37, 0xaf, 0xdf, 0x0b, 0xd7, 0x16, 0x63, 0xd7, 0x16, 0xab, 0xd7, 0x16, 0xb3, 0xd7,	\
+	0x16, 0x27, 0xaf, 0x3a, 0x73, 0xd7, 0xa1, 0x45, 0xeb, 0x93, 0x59, 0xeb, 0xd5, 0x9c, 0xf5, 0xcc,	\
+	0x9e, 0xf5, 0xcf, 0xa6, 0xf5, 0xd1, 0x81, 0xeb, 0xf9, 0x42, 0xf5, 0xd2, 0x98, 0xf5, 0xd2, 0xa2,	\
+	0xf5, 0xed, 0x4e, 0x7a, 0xf7, 0x22, 0x7a, 0xeb, 0x56, 0x7a, 0xf8, 0x26, 0x3d, 0x76, 0x20, 0x7a,	\
+	0xec, 0x55, 0x7a, 0xed, 0x51, 0x7a, 0xfe, 0xd3, 0x9e, 0xbf, 0xb4, 0xf7, 0xaf, 0xf1, 0x4d, 0xeb,	\
+	0xaa, 0xe1, 0xa3, 0x4c, 0x16, 0x34, 0xe1, 0x63, 0x4f, 0x16, 0x35, 0x11, 0x63, 0x53, 0x16, 0x34,	\
+	0x02, 0xc6, 0x84, 0x58, 0xd5, 0x45, 0x8d, 0x58, 0x58, 0xd1, 0x0b, 0xc1, 0x72, 0x58, 0xf1, 0x9c,	\
+	0x96, 0x38, 0xce, 0x4b, 0x1c, 0xa7, 0x25, 0x8f, 0x61, 0xc9, 0x63, 0xe3, 0x72, 0x58, 0xfa, 0xdc,	\
+	0x96, 0x3f, 0xcc, 0xc1, 0x7f, 0x9a, 0x22, 0xff, 0x34, 0xc5, 0xfe, 0x6b, 0x0a, 0x49, 0x8e, 0x58,	\
+	0xbd, 0x37, 0x18, 0x8f, 0x8e, 0x7e, 0x72, 0x48, 0xe3, 0x99, 0x2e, 0x5c, 0xc9, 0x45, 0xcc, 0x94,	\
+	0xdc, 0x8d, 0x2e, 0xe9, 0xcf, 0xc5, 0xe3, 0xb9, 0xfa, 0xf7, 0x4e, 0x7b, 0x4c, 0x45, 0x6a, 0x28,	\
+	0xad, 0x02, 0x2f, 0xae, 0x04, 0x5f, 0xea, 0x72, 0x2f, 0xf5, 0x3d, 0x17, 0xfa, 0x81, 0x17, 0xfa,	\
+	0xaa, 0x8b, 0xf6, 0xac, 0x74, 0x9b, 0xc4, 0x71, 0x73, 0x22, 0x3a, 0x51, 0x91, 0x1d, 0x3a, 0x2f,	\
+	0x8e, 0x99, 0xce, 0x48, 0xf5, 0x95, 0x23, 0xc5, 0x22, 0x3a, 0x77, 0xa5, 0xc7, 0x4e, 0xfe, 0x24,	\
+	0x74, 0xae, 0xb1, 0xd3, 0x66, 0x5c, 0x74, 0xdb, 0x7c, 0x74, 0x97, 0x49, 0xe9, 0x6d, 0xd3, 0x47,	\
+	0xdb, 0xdd, 0xbd, 0x2f, 0x37, 0xc8, 0xfe, 0x2e, 0x1a, 0x3f, 0x8b, 0x9c, 0x8f, 0xe4, 0x6a, 0x3d,	\
+	0x30, 0x7b, 0x68, 0xfe, 0x5d, 0x77, 0xa6, 0x0d, 0x27, 0xa6, 0xa7, 0xdc, 0x8f, 0xf2, 0xe2, 0xbd,	\
+	0x3f, 0x5a, 0xef, 0x4f, 0xe2, 0xbb, 0xd3, 0xe3, 0xa8, 0xf4, 0xb1, 0xd7, 0x73, 0xae, 0x31, 0x1c,	\
+	0xec, 0x4b, 0xb7, 0x3a, 0x46, 0xfd, 0x05, 0xbc, 0x12, 0x47, 0x51, 0x09, 0x1a, 0x68, 0x58, 0x48,	\
+	0x12, 0x5f, 0x6d, 0x0d, 0xcc, 0x81, 0x3e, 0xd9, 0x62, 0x59, 0x71, 0xd0, 0xb2, 0xd3, 0x42, 0xdf,	\
+	0xbc, 0x85, 0xd4, 0x94, 0x28, 0x68, 0x09, 0x7b, 0x94, 0x25, 0xfe, 0xfd, 0x0e, 0x46, 0x7a, 0x14,	\
+	0xa4, 0xa1, 0x81, 0x45, 0x0c, 0x08, 0x10, 0xfb, 0xf7, 0xe8, 0x61, 0xe3, 0x89, 0x04, 0x08, 0x54,	\
+	0x72, 0x15, 0x25, 0x21, 0x8d, 0xe0, 0x13, 0xa1, 0xc4, 0x43, 0x1f, 0x40, 0x4c, 0x7d, 0x41, 0x32,	\
+	0x73, 0xd0, 0xe9, 0xc8, 0x43, 0xa9, 0xf8, 0xa1, 0x95, 0x0a, 0x19, 0x74, 0xd0, 0xeb, 0x67, 0x21,	\
+	0x97, 0xa8, 0x27, 0x5a, 0x68, 0x99, 0x9f, 0x8a, 0x19, 0xf3, 0x44, 0xfc, 0xb4, 0xd0, 0xd3, 0xd3,	\
+	0x43, 0xb9, 0x50, 0x4e, 0xef, 0x4d, 0x0d, 0x69, 0xa2, 0x44, 0xe1, 0x3c, 0x1d, 0xf4, 0x3c, 0x14,	\
+	0x84, 0xff, 0x5a, 0x68, 0x6c, 0xb8, 0x4f, 0xd2, 0xec, 0x4f, 0x36, 0x9a, 0x1b, 0x59, 0xc8, 0x7b,	\
+	0x1c, 0x87, 0xb2, 0x52, 0x1b, 0x75, 0x50, 0xfd, 0xe6, 0x89, 0xf0, 0x90, 0x87, 0xc2, 0xb2, 0x1f,	\
+	0x1e, 0x42, 0x1e, 0xfc, 0xa1, 0x3e, 0x56, 0xe8, 0x7c, 0xa8, 0x20, 0xff, 0x85, 0x50, 0xb9, 0x72,	\
+	0x50, 0xb5, 0xe4, 0xa1, 0x7d, 0xca, 0x83, 0xf4, 0x0e, 0x4d, 0xc5, 0xeb, 0xc8, 0x23, 0x97, 0x95,	\
+	0xdd, 0x1c, 0xb8, 0x72, 0x58, 0x6c, 0xca, 0xb0, 0x4b, 0x09, 0x21, 0x39, 0xe8, 0xd7, 0xb2, 0x11,	\
+	0xb0, 0x24, 0x23, 0x76, 0x5c, 0xc9, 0x13, 0xc3, 0xd4, 0xe4, 0x62, 0x5c, 0x74, 0xdf, 0x49, 0x48,	\
+	0xf3, 0xd6, 0x3a, 0x71, 0xd6, 0x3a, 0x61, 0xbd, 0x23, 0xe2, 0x3a, 0x3a, 0x76, 0xe5, 0xc7, 0x4d,	\
+	0x97, 0xa4, 0x71, 0x44, 0x8f, 0x20, 0x46, 0x78, 0x9b, 0x99, 0x22, 0x7d, 0xb2, 0x84, 0xdd, 0x3c,	\
+	0x4f, 0xb9, 0x50, 0xb9, 0x92, 0x85, 0xeb, 0x90, 0xa3, 0x25, 0x0c, 0x07, 0x21, 0x87, 0x2c, 0x4c,	\
+	0x49, 0x02, 0x64, 0x4a, 0x43, 0xa2, 0xa8, 0x43, 0x25, 0x0e, 0x9c, 0xa4, 0x32, 0xdc, 0x86, 0x74,	\
+	0x81, 0x3b, 0x2a, 0x87, 0x6e, 0x40, 0x9d, 0xe9, 0x28, 0x78, 0xa5, 0x21, 0xe7, 0x7a, 0x1e, 0x79,	\
+	0x22, 0x7b, 0x65, 0x21, 0xb6, 0xa8, 0x7b, 0xa4, 0xa1, 0xf0, 0x94, 0x86, 0x90, 0x4d, 0x95, 0xdc,	\
+	0xea, 0xf2, 0x89, 0xd1, 0x43, 0x2b, 0xd1, 0x32, 0x57, 0x22, 0x6e, 0xe3, 0xf4, 0xb8, 0xdc, 0x7d,	\
+	0xb8, 0xf2, 0x73, 0xb4, 0x24, 0xf8, 0x7a, 0xb2, 0x76, 0x27, 0xc9, 0xf2, 0x53, 0x93, 0xfe, 0x6d,	\
+	0x2c, 0x37, 0x9a, 0x36, 0x1b, 0xda, 0x56, 0x1d, 0x89, 0xf6, 0x1e, 0x3d, 0xdd, 0x87, 0x96, 0x2b,	\
+	0x09, 0x5c, 0xf9, 0x1c, 0x0e, 0xfc, 0x89, 0xf4, 0x64, 0x50, 0xee, 0x48, 0xfc, 0x30, 0xe4, 0x7e,	\
+	0xf4, 0x64, 0x15, 0x9a, 0xc2, 0xa3, 0x4b, 0xdd, 0xb6, 0xef, 0x39, 0xad, 0x3e, 0xe6, 0xb6, 0xb4,	\
+	0x6e, 0x6c, 0x2d, 0xb7, 0xa2, 0xc5, 0x05, 0xe7, 0xd4, 0x5a, 0xb5, 0x57, 0xd2, 0x29, 0xa9, 0xcb,	\
+	0x91, 0x55, 0x64, 0x44, 0xb2, 0xe7, 0x2d, 0x94, 0xf5, 0xb2, 0x89, 0x77, 0x74, 0xd7, 0x77, 0x0a,	\
+	0xda, 0x51, 0x5b, 0x4a, 0xcb, 0x69, 0x12, 0xdb, 0x4e, 0x5b, 0x6a, 0x6b, 0x6f, 0x02, 0xf0, 0x21,	\
+	0x5e, 0x14, 0xf5, 0xe1, 0x40, 0xb4, 0x29, 0xaf, 0x12, 0x05, 0xe2, 0xcc, 0x5b, 0xf8, 0x57, 0x91,	\
+	0x3d, 0x79, 0x14, 0xd7, 0x97, 0x39, 0x79, 0x70, 0xae, 0x0c, 0xf5, 0xc1, 0xaa, 0xbc, 0xf9, 0xeb,	\
+	0xcf, 0xa2, 0xbd, 0x29, 0xcb, 0xd2, 0x85, 0x72, 0x69, 0xae, 0x4c, 0x4b, 0xd4, 0x9e, 0xbd, 0x6a,	\
+	0x2b, 0xd6, 0x89, 0x73, 0x61, 0x5c, 0xda, 0xcb, 0x9f, 0x45, 0x74, 0x67, 0x2e, 0x9d, 0x35, 0xee,	\
+	0x55, 0x5d, 0x6a, 0x2b, 0xad, 0x4d, 0x75, 0xe7, 0x2e, 0xbc, 0x0b, 0xaf, 0x55, 0x76, 0x27, 0x2f,	\
+	0x92, 0x8a, 0xf9, 0x22, 0x5d, 0xa8, 0x17, 0xd3, 0x3d, 0x7f, 0xdd, 0x65, 0xfd, 0x69, 0xaf, 0xeb,	\
+	0x55, 0x7f, 0x7a, 0xcb, 0xfc, 0x40, 0xbf, 0x19, 0x8b, 0xf2, 0x81, 0x7e, 0x90, 0xae, 0x35, 0xf3,	\
+	0x30, 0x00, 0x02, 0x2a, 0x83, 0x60, 0xb5, 0x45, 0x49, 0x17, 0x38, 0x00, 0x23, 0x43, 0x7c, 0xcc,	\
+	0x00, 0x00, 0x8a, 0xa0, 0xd8, 0x2d, 0x51, 0x52, 0x45, 0xce, 0x00, 0x3b, 0x18, 0x2c, 0xc0, 0x00,	\
+	0x08, 0xaa, 0x0d, 0x82, 0xd5, 0x15, 0x24, 0x5c, 0xe0, 0x01, 0x33, 0x19, 0x80, 0x00, 0x11, 0x54,	\
+	0x1b, 0x05, 0xaa, 0x2a, 0x48, 0xb9, 0xc0, 0x07, 0x37, 0x31, 0x98, 0x00, 0x01, 0x15, 0x41, 0xb0,	\
+	0x5a, 0xa2, 0xa4, 0x8b, 0x9c, 0x00, 0x77, 0xb4, 0x99, 0x80, 0x00, 0x11, 0x54, 0x1b, 0x05, 0xaa,	\
+	0x2a, 0x48, 0xb9, 0xc0, 0x06, 0x0d, 0x93, 0x30, 0x00, 0xa2, 0x2b, 0x88, 0xbb, 0x1c, 0xe9, 0x34,	\
+	0xb9, 0x28, 0x00, 0x03, 0x3e, 0xc9, 0x98, 0x00, 0x51, 0x15, 0xc4, 0x5d, 0x8e, 0x74, 0x9a, 0x5c,	\
+	0x94, 0x00, 0x01, 0xad, 0x64, 0xcc, 0x00, 0x28, 0x8a, 0xe2, 0x2e, 0xc7, 0x3a, 0x4d, 0x2e, 0x4a,	\
+	0x00, 0x00, 0xf4, 0xdb, 0x33, 0x00, 0x0a, 0x22, 0xb8, 0x8b, 0xb1, 0xce, 0x93, 0x4b, 0x92, 0x80,	\
+	0x00, 0x31, 0xf4, 0x99, 0x80, 0x05, 0x11, 0x5c, 0x45, 0xd8, 0xe7, 0x49, 0xa5, 0xc9, 0x40, 0x00,	\
+	0x1a, 0x5a, 0xcc, 0xc0, 0x02, 0x88, 0xae, 0x22, 0xec, 0x73, 0xa4, 0xd2, 0xe4, 0xa0, 0x00, 0x0f,	\
+	0x8d, 0x93, 0x30, 0x03, 0xa5, 0xac, 0x8a, 0x4a, 0xd4, 0xc7, 0x55, 0x49, 0x17, 0x00, 0x00, 0x48,	\
+	0xc1, 0x66, 0x00, 0x74, 0xb5, 0x91, 0x49, 0x5a, 0x98, 0xea, 0xa9, 0x22, 0xe0, 0x00, 0x0f, 0x8e,	\
+	0x0b, 0x30, 0x03, 0xa5, 0xac, 0x8a, 0x4a, 0xd4, 0xc7, 0x55, 0x49, 0x17, 0x00, 0x00, 0x6b, 0xf3,	\
+	0x99, 0x80, 0x1d, 0x2d, 0x64, 0x52, 0x56, 0xa6, 0x3a, 0xaa, 0x48, 0xb8, 0x00, 0x03, 0xe5, 0x98,	\
+	0xcc, 0x00, 0xe9, 0x6b, 0x22, 0x92, 0xb5, 0x31, 0xd5, 0x52, 0x45, 0xc0, 0x00, 0x12, 0x6d, 0x99,	\
+	0x8a, 0x94, 0xc4, 0xa5, 0x4d, 0x4b, 0x55, 0x60, 0x04, 0x5c, 0x22, 0xb4, 0x64, 0x9c, 0x8b, 0x66,	\
+	0x62, 0xa5, 0x31, 0x29, 0x53, 0x52, 0xd5, 0x58, 0x01, 0x17, 0x08, 0xad, 0x19, 0x27, 0xed, 0xce,	\
+	0x66, 0x2a, 0x53, 0x12, 0x95, 0x35, 0x2d, 0x55, 0x80, 0x11, 0x70, 0x8a, 0xd1, 0x92, 0x63, 0x70,	\
+	0xd9, 0x8d, 0x75, 0x0a, 0xb4, 0x36, 0x81, 0xb7, 0x29, 0x51, 0x00, 0x0a, 0x02, 0x94, 0xe8, 0xf3,	\
+	0x99, 0x8d, 0x75, 0x0a, 0xb4, 0x36, 0x81, 0xb7, 0x29, 0x51, 0x00, 0x0a, 0x02, 0x94, 0xce, 0xd2,	\
+	0x66, 0x35, 0xd4, 0x2a, 0xd0, 0xda, 0x06, 0xdc, 0xa5, 0x44, 0x00, 0x28, 0x0a, 0x52, 0x7d, 0x93,	\
+	0x30, 0x00, 0x01, 0xae, 0xa1, 0x56, 0x86, 0xd0, 0x36, 0xe5, 0x2a, 0x20, 0x07, 0x6e, 0xf9, 0x98,	\
+	0x00, 0x00, 0xd7, 0x50, 0xab, 0x43, 0x68, 0x1b, 0x72, 0x95, 0x10, 0x03, 0xd5, 0x7c, 0xcc, 0x00,	\
+	0x00, 0x6b, 0xa8, 0x55, 0xa1, 0xb4, 0x0d, 0xb9, 0x4a, 0x88, 0x01, 0xe3, 0xe7, 0x33, 0x00, 0x00,	\
+	0x1a, 0xea, 0x15, 0x68, 0x6d, 0x03, 0x6e, 0x52, 0xa2, 0x00, 0x79, 0x2f, 0x99, 0x80, 0x0c, 0x50,	\
+	0xa5, 0xa3, 0x43, 0x85, 0x91, 0x4a, 0xa0, 0x00, 0x0e, 0xb6, 0x0b, 0x30, 0x01, 0x8a, 0x14, 0xb4,	\
+	0x68, 0x70, 0xb2, 0x29, 0x54, 0x00, 0x01, 0xf4, 0xe9, 0x33, 0x00, 0x18, 0xa1, 0x4b, 0x46, 0x87,	\
+	0x0b, 0x22, 0x95, 0x40, 0x00, 0x1a, 0xf9, 0x8c, 0xc0, 0x06, 0x28, 0x52, 0xd1, 0xa1, 0xc2, 0xc8,	\
+	0xa5, 0x50, 0x00, 0x03, 0xad, 0x99, 0x80, 0x08, 0x22, 0xd1, 0xc5, 0x74, 0x26, 0x48, 0xa4, 0x80,	\
+	0x0a, 0x0b, 0x6c, 0xc6, 0x60, 0x02, 0x08, 0xb4, 0x71, 0x5d, 0x09, 0x92, 0x29, 0x20, 0x02, 0x82,	\
+	0x5e, 0x93, 0x30, 0x01, 0x04, 0x5a, 0x38, 0xae, 0x84, 0xc9, 0x14, 0x90, 0x01, 0x41, 0x7b, 0xc3,	\
+	0x66, 0x00, 0x00, 0x6a, 0x82, 0xe2, 0x44, 0xc8, 0xca, 0x45, 0x24, 0x00, 0xf6, 0x74, 0x99, 0x80,	\
+	0x00, 0x1a, 0xa0, 0xb8, 0x91, 0x32, 0x32, 0x91, 0x49, 0x00, 0x3f, 0x3d, 0x66, 0x60, 0x00, 0x06,	\
+	0xa8, 0x2e, 0x24, 0x4c, 0x8c, 0xa4, 0x52, 0x40, 0x0f, 0xba, 0xd9, 0x98, 0x00, 0x00, 0x5c, 0x46,	\
+	0xa2, 0x2d, 0x11, 0x72, 0x8b, 0xa5, 0x40, 0x1f, 0x6e, 0x0b, 0x30, 0x00, 0x00, 0xb8, 0x8d, 0x44,	\
+	0x5a, 0x22, 0xe5, 0x17, 0x4a, 0x80, 0x13, 0xa4, 0xcc, 0x00, 0x00, 0x2e, 0x23, 0x51, 0x16, 0x88,	\
+	0xb9, 0x45, 0xd2, 0xa0, 0x0f, 0xc7, 0x05, 0x99, 0x4a, 0x67, 0x4e, 0x90, 0x01, 0x52, 0x19, 0x68,	\
+	0xea, 0x51, 0x6b, 0x54, 0xaa, 0xd6, 0xf8, 0xf3, 0x99, 0x94, 0xa6, 0x74, 0xe9, 0x00, 0x15, 0x21,	\
+	0x96, 0x8e, 0xa5, 0x16, 0xb5, 0x4a, 0xad, 0x6d, 0x6b, 0x66, 0x64, 0xc9, 0x14, 0x90, 0x00, 0x90,	\
+	0x4c, 0xa4, 0xac, 0xce, 0x6d, 0x44, 0x8a, 0xdd, 0xf3, 0x99, 0x93, 0x24, 0x52, 0x40, 0x02, 0x41,	\
+	0x32, 0x92, 0xb3, 0x39, 0xb5, 0x12, 0x2b, 0x83, 0xa4, 0xcc, 0xe9, 0x6b, 0x22, 0x92, 0xb5, 0x31,	\
+	0xd5, 0x52, 0x45, 0xc0, 0x04, 0x11, 0x68, 0xeb, 0x5d, 0x66, 0x67, 0x4b, 0x59, 0x14, 0x95, 0xa9,	\
+	0x8e, 0xaa, 0x92, 0x2e, 0x00, 0x20, 0x8b, 0x47, 0x74, 0xad, 0x99, 0x80, 0x04, 0x82, 0x65, 0x25,	\
+	0x66, 0x73, 0x6a, 0x24, 0x50, 0x00, 0x06, 0x8d, 0xb3, 0x30, 0x00, 0x90, 0x4c, 0xa4, 0xac, 0xce,	\
+	0x6d, 0x44, 0x8a, 0x00, 0x00, 0xea, 0x70, 0xd9, 0x80, 0x04, 0x82, 0x65, 0x25, 0x66, 0x73, 0x6a,	\
+	0x24, 0x50, 0x00, 0x07, 0xab, 0x86, 0xcc, 0x28, 0x1c, 0xcc, 0x52, 0x5c, 0xe0, 0xa4, 0x44, 0x00,	\
+	0x00, 0x01, 0xec, 0xc1, 0x66, 0x14, 0x0e, 0x66, 0x29, 0x2e, 0x70, 0x52, 0x22, 0x00, 0x00, 0x00,	\
+	0xb0, 0xcc, 0x66, 0x14, 0x0e, 0x66, 0x29, 0x2e, 0x70, 0x52, 0x22, 0x00, 0x00, 0x00, 0xb9, 0xbe,	\
+	0x66, 0x57, 0x36, 0x96, 0xaa, 0xe2, 0x55, 0x82, 0xc8, 0x92, 0x00, 0x1c, 0xab, 0x8a, 0x6d, 0x6c,	\
+	0xeb, 0x33, 0x2b, 0x9b, 0x4b, 0x55, 0x71, 0x2a, 0xc1, 0x64, 0x49, 0x00, 0x0e, 0x55, 0xc5, 0x36,	\
+	0xb8, 0x78, 0x2c, 0xca, 0x9a, 0x96, 0xaa, 0xc0, 0x0d, 0x50, 0x5c, 0x48, 0x99, 0x19, 0x48, 0xa4,	\
+	0x9a, 0x79, 0x8c, 0xca, 0x9a, 0x96, 0xaa, 0xc0, 0x0d, 0x50, 0x5c, 0x48, 0x99, 0x19, 0x48, 0xa4,	\
+	0x99, 0x7c, 0xe6, 0x65, 0x1b, 0x14, 0xd0, 0xa5, 0xa8, 0x00, 0xa0, 0x29, 0x45, 0x1b, 0x14, 0xd1,	\
+	0x5b, 0x49, 0x99, 0x46, 0xc5, 0x34, 0x29, 0x6a, 0x00, 0x28, 0x0a, 0x51, 0x46, 0xc5, 0x34, 0x7f,	\
+	0x8c, 0x16, 0x60, 0x00, 0x00, 0x01, 0x24, 0x62, 0x84, 0xb4, 0x22, 0x46, 0xa5, 0xb1, 0x7a, 0x4c,	\
+	0xc0, 0x00, 0x00, 0x02, 0x48, 0xc5, 0x09, 0x68, 0x44, 0x8d, 0x4b, 0x7f, 0x8d, 0x26, 0x60, 0x00,	\
+	0x00, 0x01, 0x24, 0x62, 0x84, 0xb4, 0x22, 0x46, 0xa5, 0xa9, 0x5f, 0x33, 0x2e, 0xa6, 0x28, 0x59,	\
+	0x72, 0x74, 0x95, 0xa8, 0x12, 0x00, 0x75, 0x44, 0x88, 0xb6, 0xf4, 0x99, 0x97, 0x53, 0x14, 0x2c,	\
+	0xb9, 0x3a, 0x4a, 0xd4, 0x09, 0x00, 0x3a, 0xa2, 0x44, 0x4d, 0x64, 0xcc, 0x00, 0x00, 0x50, 0x14,	\
+	0xa2, 0x8d, 0x8a, 0x68, 0x52, 0xd4, 0x01, 0xd9, 0xe7, 0x33, 0x00, 0x00, 0x14, 0x05, 0x28, 0xa3,	\
+	0x62, 0x9a, 0x14, 0xb5, 0x00, 0x46, 0xb2, 0x66, 0x00, 0x00, 0x00, 0x00, 0x45, 0x05, 0xd7, 0x62,	\
+	0xad, 0x46, 0xee, 0x6a, 0x8d, 0x7c, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x0b, 0xae, 0xc5, 0x5a,	\
+	0x8d, 0xdc, 0xd5, 0x1b, 0x9c, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x0b, 0xae, 0xc5, 0x5a, 0x8d,	\
+	0xdc, 0xd5, 0xb7, 0x6c, 0xcc, 0x00, 0x00, 0x28, 0x8a, 0xe2, 0x2e, 0xc7, 0x3a, 0x4d, 0x2e, 0x4a,	\
+	0x00, 0xc3, 0xc1, 0x66, 0x00, 0x00, 0x14, 0x45, 0x71, 0x17, 0x63, 0x9d, 0x26, 0x97, 0x25, 0x00,	\
+	0x5e, 0x5b, 0x33, 0x00, 0x18, 0x05, 0xcc, 0x8a, 0xac, 0x2c, 0xa9, 0x55, 0x70, 0x00, 0xa0, 0xe2,	\
+	0xe6, 0x33, 0x00, 0x18, 0x05, 0xcc, 0x8a, 0xac, 0x2c, 0xa9, 0x55, 0x70, 0x00, 0xa0, 0xcf, 0xbe,	\
+	0x66, 0x00, 0x45, 0x50, 0x6c, 0x16, 0xa8, 0xa9, 0x22, 0xe7, 0x00, 0x00, 0x1c, 0x4d, 0x66, 0x60,	\
+	0x04, 0x55, 0x06, 0xc1, 0x6a, 0x8a, 0x92, 0x2e, 0x70, 0x00, 0x01, 0x8b, 0x6e, 0x15, 0x09, 0x4d,	\
+	0xaa, 0xde, 0x50, 0x0a, 0x84, 0xa6, 0xd5, 0x7c, 0xaf, 0xc2, 0xa1, 0x29, 0xb5, 0x56, 0x59, 0x21,	\
+	0x50, 0x94, 0xda, 0xae, 0x16, 0x68, 0x54, 0x25, 0x36, 0xab, 0xa9, 0x9a, 0x15, 0x09, 0x4d, 0xaa,	\
+	0x93, 0xda, 0x0a, 0x84, 0xa6, 0xd5, 0x79, 0x3b, 0x41, 0x50, 0x94, 0xda, 0xad, 0xae, 0xd0, 0x54,	\
+	0x25, 0x36, 0xaa, 0x09, 0x80, 0x53, 0x9a, 0x97, 0x0c, 0x89, 0x80, 0x53, 0x9a, 0x97, 0x0a, 0x93,	\
+	0x80, 0xa7, 0x35, 0x2e, 0x1e, 0x59, 0xc0, 0x53, 0x9a, 0x97, 0x0d, 0xf5, 0x10, 0x29, 0xcd, 0x4b,	\
+	0x85, 0x84, 0x00, 0x53, 0x9a, 0x97, 0x0c, 0x68, 0x00, 0xa7, 0x35, 0x2e, 0x13, 0x61, 0x02, 0x9c,	\
+	0xd4, 0xb8, 0x68, 0x44, 0x05, 0x39, 0xa9, 0x70, 0xf5, 0xd9, 0x82, 0x58, 0xa5, 0xa2, 0xa5, 0x40,	\
+	0x12, 0xc5, 0x2d, 0x15, 0x6a, 0x00, 0x96, 0x29, 0x68, 0xbc, 0x54, 0x01, 0x2c, 0x52, 0xd1, 0x6d,	\
+	0xdf, 0x82, 0x58, 0xa5, 0xa2, 0x9b, 0x84, 0x09, 0x62, 0x96, 0x8a, 0xef, 0x9e, 0x09, 0x62, 0x96,	\
+	0x8a, 0x9e, 0x68, 0x25, 0x8a, 0x5a, 0x2e, 0x05, 0x30, 0x05, 0x15, 0x62, 0xd2, 0xaa, 0x00, 0xa2,	\
+	0xac, 0x5b, 0xe9, 0xe1, 0xd5, 0x45, 0x14, 0x6d, 0xcd, 0x10, 0xea, 0xa2, 0x8a, 0x35, 0xec, 0x21,	\
+	0xd5, 0x45, 0x14, 0x6a, 0x55, 0x83, 0xaa, 0x8a, 0x28, 0xd9, 0x75, 0x83, 0xaa, 0x8a, 0x28, 0xde,	\
+	0xc8, 0x83, 0xaa, 0x8a, 0x28, 0xde, 0xe8, 0x83, 0xaa, 0x8a, 0x28, 0xd6, 0x76, 0x61, 0x69, 0x5d,	\
+	0x32, 0xa5, 0xbf, 0xb3, 0x0b, 0x4a, 0xe9, 0x95, 0x2f, 0x7d, 0x00, 0xb4, 0xae, 0x99, 0x52, 0xf2,	\
+	0x64, 0x85, 0xa5, 0x74, 0xca, 0x97, 0xa7, 0x34, 0x2d, 0x2b, 0xa6, 0x54, 0xbd, 0xf9, 0xa1, 0x69,	\
+	0x5d, 0x32, 0xa5, 0x85, 0xae, 0x16, 0x95, 0xd3, 0x2a, 0x5d, 0xc9, 0xc0, 0x08, 0x5a, 0x57, 0x59,	\
+	0x40, 0x00, 0x85, 0xa5, 0x75, 0xdd, 0x60, 0x57, 0x4c, 0x50, 0x2e, 0x22, 0x05, 0x74, 0xc5, 0x03,	\
+	0x36, 0xdc, 0x2e, 0x6a, 0xab, 0x2a, 0xab, 0xec, 0x20, 0xb9, 0xaa, 0xac, 0xaa, 0xbd, 0x38, 0x41,	\
+	0x73, 0x55, 0x59, 0x55, 0x5b, 0xe4, 0x85, 0xcd, 0x55, 0x65, 0x55, 0xa7, 0x92, 0x17, 0x35, 0x55,	\
+	0x95, 0x56, 0x17, 0x68, 0x2e, 0x6a, 0xab, 0x2a, 0xae, 0x9d, 0x30, 0xba, 0xa8, 0xb9, 0x4a, 0xa5,	\
+	0x00, 0x5d, 0x54, 0x5c, 0xa5, 0x73, 0x20, 0x0b, 0xaa, 0x8b, 0x94, 0xa8, 0x61, 0x0b, 0xaa, 0x8b,	\
+	0x94, 0xaf, 0x65, 0x50, 0xba, 0xa8, 0xb9, 0x4a, 0xb0, 0x88, 0x2e, 0xaa, 0x2e, 0x52, 0xb3, 0x26,	\
+	0x03, 0x52, 0xd2, 0xe5, 0xd3, 0xcd, 0x3c, 0x1a, 0x96, 0x97, 0x2e, 0x9b, 0x14, 0x41, 0xa9, 0x69,	\
+	0x72, 0xe9, 0xf1, 0x84, 0x1a, 0x96, 0x97, 0x2e, 0x9c, 0x4a, 0xa0, 0xd4, 0xb4, 0xb9, 0x74, 0xe8,	\
+	0x55, 0x06, 0xa5, 0xa5, 0xcb, 0xa5, 0xae, 0xec, 0x2e, 0x2b, 0x52, 0x53, 0x4e, 0xdf, 0x85, 0xc5,	\
+	0x6a, 0x4a, 0x6c, 0x0e, 0xa0, 0x5c, 0x56, 0xa4, 0xa6, 0x9b, 0x9e, 0x17, 0x15, 0xa9, 0x29, 0xa0,	\
+	0xd3, 0x0b, 0x8a, 0xd4, 0x94, 0xc7, 0x7c, 0x2e, 0x2b, 0x52, 0x53, 0x5e, 0xdf, 0x83, 0x8a, 0x55,	\
+	0x41, 0xe5, 0xc2, 0x07, 0x14, 0xaa, 0x83, 0x0f, 0x9e, 0x0e, 0x29, 0x55, 0x07, 0x87, 0x24, 0x1c,	\
+	0x52, 0xaa, 0x0c, 0x6d, 0x70, 0x71, 0x4a, 0xa8, 0x3d, 0x5a, 0xe0, 0xe2, 0x95, 0x50, 0x75, 0x26,	\
+	0x02, 0x94, 0x53, 0x52, 0x93, 0x08, 0x29, 0x45, 0x35, 0x2e, 0x4d, 0x50, 0x52, 0x8a, 0x6a, 0x56,	\
+	0x75, 0x81, 0x4a, 0x29, 0xa9, 0x6c, 0x44, 0x0a, 0x51, 0x4d, 0x4a, 0x7c, 0xe0, 0x61, 0x46, 0x85,	\
+	0xa2, 0xa2, 0x0c, 0x28, 0xd0, 0xb6, 0xcd, 0x50, 0x61, 0x46, 0x85, 0xa6, 0x44, 0x0c, 0x28, 0xd0,	\
+	0xb7, 0x4e, 0x20, 0x61, 0x46, 0x85, 0xb9, 0x93, 0xc3, 0x55, 0x70, 0x9b, 0x2a, 0xd6, 0x88, 0x6a,	\
+	0xae, 0x13, 0x65, 0x70, 0x61, 0x0d, 0x55, 0xc2, 0x6c, 0xae, 0x3c, 0x21, 0xaa, 0xb8, 0x4d, 0x95,	\
+	0xc6, 0xac, 0x1a, 0xab, 0x84, 0xd9, 0x53, 0xa9, 0x85, 0x2a, 0xe6, 0xea, 0x59, 0x4a, 0x98, 0x52,	\
+	0xae, 0x6e, 0xa5, 0x91, 0x53, 0x0a, 0x55, 0xcd, 0xd4, 0xb3, 0x3a, 0x10, 0xa5, 0x5c, 0xdd, 0x4b,	\
+	0x29, 0x44, 0x14, 0xab, 0x9b, 0xa9, 0x67, 0x26, 0x60, 0x2b, 0x97, 0x6e, 0x95, 0xcb, 0xf8, 0x98,	\
+	0x0a, 0xe5, 0xdb, 0xa5, 0x72, 0xd8, 0xa6, 0x0a, 0xe5, 0xdb, 0xa5, 0x72, 0xee, 0xc0, 0x0a, 0xe5,	\
+	0xdb, 0xa5, 0x72, 0xd1, 0xaa, 0x0a, 0xe5, 0xdb, 0xa5, 0x72, 0xc8, 0x70, 0x1e, 0xf1, 0xef, 0x7b,	\
+	0xc7, 0xbc, 0x7b, 0x5c, 0x07, 0xbc, 0x7b, 0xde, 0xf1, 0xef, 0x17, 0x6f, 0x03, 0xde, 0x3d, 0xef,	\
+	0x78, 0xf7, 0x8e, 0x53, 0xc0, 0xf7, 0x8f, 0x7b, 0xde, 0x3d, 0xe3, 0xca, 0xa0, 0x7b, 0xc7, 0xbd,	\
+	0xef, 0x1e, 0xf1, 0x32, 0x40, 0x1e, 0xf1, 0xef, 0x7b, 0xc7, 0xbc, 0x34, 0xa0, 0x3d, 0xe3, 0xde,	\
+	0xf7, 0x8f, 0x78, 0xdc, 0xca, 0x03, 0xde, 0x3d, 0xef, 0x78, 0xf7, 0x8e, 0x6c, 0xa0, 0x3d, 0xe3,	\
+	0xde, 0xf7, 0x8f, 0x78, 0xce, 0x94, 0x07, 0xbc, 0x7b, 0xde, 0xf1, 0xef, 0x1f, 0x4d, 0xf0, 0x6e,	\
+	0x75, 0x73, 0x74, 0x38, 0xfb, 0xa0, 0xdc, 0xea, 0xe6, 0xe8, 0x73, 0xe9, 0x74, 0x1b, 0x9d, 0x5c,	\
+	0xdd, 0x0e, 0x7d, 0x98, 0xc1, 0xb9, 0xd5, 0xcd, 0xd0, 0xe7, 0xd9, 0xde, 0x0d, 0xce, 0xae, 0x6e,	\
+	0x87, 0x37, 0xd0, 0x07, 0x4a, 0x2a, 0xd3, 0xaa, 0xe6, 0x00, 0xe9, 0x45, 0x5a, 0x75, 0x7a, 0xeb,	\
+	0x07, 0x4a, 0x2a, 0xd3, 0xab, 0xaf, 0x10, 0x74, 0xa2, 0xad, 0x3a, 0xb7, 0x33, 0x03, 0x52, 0xb3,	\
+	0x69, 0xb1, 0xe3, 0x98, 0x1a, 0x95, 0x9b, 0x4d, 0x89, 0x93, 0xc3, 0x52, 0xb3, 0x69, 0xb1, 0x4e,	\
+	0x78, 0x6a, 0x56, 0x6d, 0x36, 0x2e, 0x62, 0x0d, 0x4a, 0xcd, 0xa6, 0xc7, 0x4f, 0x10, 0x18, 0x58,	\
+	0xe9, 0xa9, 0x4a, 0xa0, 0x30, 0xb1, 0xd3, 0x53, 0x99, 0x50, 0x18, 0x58, 0xe9, 0xa9, 0x0e, 0x50,	\
+	0x30, 0xb1, 0xd3, 0x53, 0xd9, 0xa0, 0x0c, 0x2c, 0x74, 0xd4, 0xb0, 0xae, 0x0c, 0x2c, 0x74, 0xd4,	\
+	0xdc, 0xbc, 0x0f, 0x78, 0xf7, 0xbf, 0xfc, 0xff, 0xf2, 0xa4, 0x80, 0x3d, 0xe3, 0xde, 0xff, 0xf3,	\
+	0xff, 0xcf, 0x64, 0x80, 0x3d, 0xe3, 0xde, 0xff, 0xf3, 0xff, 0xcd, 0xec, 0xa0, 0x3d, 0xe3, 0xde,	\
+	0xff, 0xf3, 0xff, 0xcd, 0xab, 0x30, 0xb9, 0x27, 0x25, 0x25, 0x9d, 0xf8, 0x5c, 0x93, 0x92, 0x93,	\
+	0x5b, 0x24, 0x2e, 0x49, 0xc9, 0x49, 0x99, 0x9a, 0x17, 0x24, 0xe4, 0xa4, 0xee, 0x4c, 0x08, 0x72,	\
+	0x92, 0xaa, 0xfb, 0x27, 0x84, 0x39, 0x49, 0x55, 0x77, 0xe7, 0x84, 0x39, 0x49, 0x55, 0x7e, 0x14,	\
+	0x42, 0x1c, 0xa4, 0xaa, 0xba, 0x93, 0x42, 0x8d, 0x88, 0x6a, 0x49, 0xca, 0x0a, 0x36, 0x21, 0xa9,	\
+	0xc9, 0xd0, 0x0a, 0x36, 0x21, 0xa9, 0x67, 0xa8, 0x14, 0x6c, 0x43, 0x53, 0x62, 0xb8, 0x51, 0xb1,	\
+	0x0d, 0x48, 0x26, 0x80, 0x30, 0xb8, 0xa6, 0x44, 0xd0, 0x06, 0x17, 0x14, 0xa9, 0x70, 0x00, 0xc2,	\
+	0xe2, 0x9e, 0x5b, 0x80, 0x06, 0x17, 0x14, 0xdf, 0x52, 0x00, 0x61, 0x71, 0x4b, 0x0a, 0x80, 0x0c,	\
+	0x2e, 0x29, 0x8d, 0x50, 0x01, 0x85, 0xc5, 0x26, 0xe5, 0x00, 0x30, 0xb8, 0xa6, 0x85, 0x70, 0x06,	\
+	0x17, 0x14, 0x9f, 0x70, 0x14, 0x5a, 0x1c, 0x44, 0x54, 0x82, 0x8b, 0x43, 0x88, 0xd9, 0xd0, 0x0a,	\
+	0x2d, 0x0e, 0x22, 0x65, 0x70, 0xa2, 0xd0, 0xe2, 0x3a, 0x75, 0xc2, 0x8b, 0x43, 0x88, 0xb9, 0x78,	\
+	0x7f, 0xf9, 0xff, 0xe7, 0xbd, 0xef, 0x7b, 0xde, 0xf5, 0x17, 0x87, 0xff, 0x9f, 0xfe, 0x7b, 0xde,	\
+	0xf7, 0xbd, 0xef, 0x6f, 0x94, 0x3f, 0xfc, 0xff, 0xf3, 0xde, 0xf7, 0xbd, 0xef, 0x7a, 0xee, 0x40,	\
+	0x7f, 0xf9, 0xff, 0xe7, 0xbd, 0xef, 0x7b, 0xde, 0xf7, 0x2a, 0x40, 0x7f, 0xf9, 0xff, 0xe7, 0xbd,	\
+	0xef, 0x7b, 0xde, 0xf7, 0x36, 0x40, 0x7f, 0xf9, 0xff, 0xe7, 0xbd, 0xef, 0x7b, 0xde, 0xf7, 0x46,	\
+	0x48, 0x7f, 0xf9, 0xff, 0xe7, 0xbd, 0xef, 0x7b, 0xde, 0xf6, 0xdc, 0x90, 0xff, 0xf3, 0xff, 0xcf,	\
+	0x7b, 0xde, 0xf7, 0xbd, 0xeb, 0x5b, 0x20, 0x42, 0x0c, 0x52, 0x75, 0xb0, 0x21, 0x06, 0x29, 0x81,	\
+	0xd2, 0x04, 0x20, 0xc5, 0x26, 0xe6, 0x02, 0x10, 0x62, 0x90, 0x69, 0x02, 0x10, 0x62, 0x86, 0xb0,	\
+	0x21, 0x06, 0x29, 0xb9, 0x9a, 0x1a, 0xca, 0x8e, 0x21, 0xe3, 0x9a, 0x1a, 0xca, 0x8e, 0x21, 0x32,	\
+	0xec, 0x35, 0x95, 0x1c, 0x42, 0x9d, 0xd8, 0x6b, 0x2a, 0x38, 0x85, 0xcd, 0x70, 0xd6, 0x54, 0x71,	\
+	0x0e, 0x34, 0xc0, 0x88, 0x65, 0xaa, 0x9a, 0x94, 0xc2, 0x21, 0x96, 0xaa, 0x66, 0x44, 0x41, 0x10,	\
+	0xcb, 0x55, 0x0f, 0xff, 0xe2, 0x9c, 0x0a, 0x99, 0x75, 0x2d, 0x6c, 0x6a, 0x20, 0xa9, 0x97, 0x52,	\
+	0xd6, 0xcb, 0x84, 0x15, 0x32, 0xea, 0x5a, 0xd2, 0x68, 0x04, 0xc5, 0x66, 0xd2, 0x31, 0xf2, 0x42,	\
+	0x62, 0xb3, 0x69, 0x16, 0x59, 0xa1, 0x31, 0x59, 0xb4, 0x8d, 0x0a, 0x01, 0x73, 0x6a, 0xa5, 0x16,	\
+	0xd5, 0xa0, 0x17, 0x36, 0xaa, 0x51, 0x6e, 0xbd, 0xf8, 0x5c, 0xda, 0xa9, 0x45, 0xbf, 0x0b, 0xb0,	\
+	0x91, 0x08, 0x46, 0xf2, 0x90, 0x48, 0x84, 0x23, 0x85, 0x94, 0x12, 0x21, 0x08, 0xe4, 0x65, 0x04,	\
+	0x88, 0x42, 0x2f, 0xb5, 0x02, 0x44, 0x21, 0x13, 0xb1, 0x01, 0xc6, 0xb9, 0x68, 0x72, 0x96, 0x20,	\
+	0x38, 0xd7, 0x2d, 0x0e, 0x45, 0x88, 0x0e, 0x35, 0xcb, 0x43, 0x99, 0xd9, 0x40, 0xe3, 0x5c, 0xb4,	\
+	0x39, 0x4a, 0xb8, 0x38, 0xd7, 0x2d, 0x0e, 0x75, 0xde, 0x1f, 0xff, 0xef, 0x7f, 0xff, 0xbd, 0xef,	\
+	0x1e, 0xf1, 0xa9, 0x24, 0x3f, 0xff, 0xde, 0xff, 0xff, 0x7b, 0xde, 0x3d, 0xe3, 0x7d, 0x50, 0x35,	\
+	0x92, 0x4c, 0xa9, 0x73, 0x50, 0x35, 0x92, 0x4c, 0xa9, 0xeb, 0xd4, 0x0d, 0x64, 0x93, 0x2a, 0x75,	\
+	0xeb, 0x86, 0xb2, 0x49, 0x95, 0x31, 0x78, 0x01, 0x45, 0x14, 0x58, 0xde, 0x5e, 0x05, 0x14, 0x51,	\
+	0x63, 0xe5, 0xc9, 0x0a, 0x28, 0xa2, 0xc5, 0x97, 0x54, 0x28, 0xa2, 0x8b, 0x1c, 0x2d, 0x10, 0xa2,	\
+	0x8a, 0x2c, 0x75, 0x34, 0x42, 0x8a, 0x28, 0xb1, 0x27, 0xb8, 0x14, 0x51, 0x45, 0x8f, 0x27, 0x70,	\
+	0x28, 0xa2, 0x8b, 0x1b, 0x5d, 0xc0, 0xa2, 0x8a, 0x2c, 0x7a, 0xed, 0x01, 0x10, 0x82, 0x29, 0x5e,	\
+	0x02, 0x21, 0x04, 0x56, 0xbc, 0x04, 0x42, 0x08, 0xf1, 0x5e, 0x02, 0x21, 0x04, 0x6d, 0xf2, 0x41,	\
+	0x10, 0x82, 0x26, 0xe2, 0x82, 0x21, 0x04, 0x5d, 0xe3, 0x82, 0x21, 0x04, 0x53, 0xd1, 0x04, 0x42,	\
+	0x08, 0xf4, 0x40, 0x11, 0x2e, 0xaa, 0xdb, 0xb9, 0xe7, 0x84, 0x22, 0x5d, 0x55, 0xb7, 0x72, 0xe6,	\
+	0x78, 0x35, 0xca, 0x9b, 0x4d, 0xba, 0xd6, 0xb0, 0x35, 0xca, 0x9b, 0x4d, 0xbb, 0x8d, 0x34, 0x2a,	\
+	0x61, 0x44, 0x9a, 0x98, 0x81, 0x53, 0x0a, 0x24, 0xc8, 0xae, 0x15, 0x30, 0xa2, 0x4f, 0x15, 0xc0,	\
+	0x23, 0x45, 0x15, 0x31, 0xa9, 0x02, 0x34, 0x51, 0x53, 0x2f, 0x28, 0x11, 0xa2, 0x8a, 0x93, 0x1e,	\
+	0x1e, 0xf1, 0xef, 0x1f, 0xff, 0xef, 0x7f, 0xff, 0xbd, 0xe1, 0x92, 0x1e, 0xf1, 0xef, 0x1f, 0xff,	\
+	0xef, 0x7f, 0xff, 0xbd, 0x73, 0x28, 0x3d, 0xe3, 0xde, 0x3f, 0xff, 0xde, 0xff, 0xff, 0x7a, 0x8c,	\
+	0xa0, 0xf7, 0x8f, 0x78, 0xff, 0xff, 0x7b, 0xff, 0xfd, 0xec, 0xc9, 0xa0, 0x42, 0x51, 0x53, 0xcd,	\
+	0x76, 0x04, 0x25, 0x15, 0x36, 0x29, 0x01, 0x09, 0x45, 0x4f, 0x8e, 0x50, 0x10, 0x94, 0x54, 0xe2,	\
+	0x68, 0x01, 0x09, 0x45, 0x4e, 0x86, 0x80, 0x10, 0x94, 0x54, 0xcd, 0xe0, 0x02, 0x30, 0xa3, 0x85,	\
+	0xf6, 0x28, 0x23, 0x0a, 0x38, 0x7a, 0x71, 0x41, 0x18, 0x51, 0xc2, 0xdf, 0xaa, 0x08, 0xc2, 0x8e,	\
+	0x1a, 0x7d, 0x50, 0x46, 0x14, 0x70, 0xc2, 0xee, 0x02, 0x30, 0xa3, 0x86, 0x66, 0x8d, 0x8a, 0x2d,	\
+	0x44, 0x24, 0xed, 0x50, 0x55, 0x43, 0x3d, 0xcb, 0x46, 0xca, 0x68, 0xa5, 0xab, 0xc9, 0x84, 0xe8,	\
+	0xe0, 0x72, 0xae, 0xa6, 0xd4, 0xc9, 0x40, 0x7b, 0xc7, 0xbd, 0xef, 0x7f, 0xff, 0xbd, 0xff, 0xfb,	\
+	0xd7, 0xa3, 0x7b, 0xdf, 0x7c, 0x7f, 0xff, 0xbd, 0xf7, 0xc7, 0xff, 0xf6, 0x65, 0x07, 0xff, 0x9f,	\
+	0xfe, 0x7b, 0xdf, 0xff, 0xef, 0x7f, 0xff, 0x65, 0xec, 0x9f, 0x7d, 0xf7, 0xde, 0xf7, 0xbd, 0xf7,	\
+	0xdf, 0x7c, 0x1e, 0x87, 0x23, 0x7b, 0xdf, 0xff, 0xef, 0x7f, 0xff, 0xbd, 0xff, 0xfe, 0xf7, 0xff,	\
+	0xf9, 0x6d, 0x19, 0x01, 0x2d, 0x44, 0x5a, 0xea, 0x3d, 0xd4, 0xd0, 0x29, 0x2e, 0x6e, 0xde, 0xea,	\
+	0x68, 0x14, 0x9d, 0xfc, 0x97, 0x3c, 0x1c, 0xaa, 0x9b, 0x7f, 0x99, 0xc8, 0xb4, 0xa6, 0xe9, 0xd2,	\
+	0xe3, 0xda, 0x2a, 0x02, 0x4e, 0xd5, 0x53, 0x81, 0x15, 0xca, 0xb9, 0x4d, 0xac, 0x29, 0xc8, 0xb4,	\
+	0xa6, 0xe9, 0xd2, 0x82, 0x24, 0x57, 0x2a, 0xe5, 0x36, 0xb5, 0x2f, 0x15, 0x2c, 0x6a, 0xeb, 0x29,	\
+	0xee, 0xbc, 0x54, 0x4e, 0x12, 0x2c, 0xcb, 0x1d, 0x3f, 0xff, 0xff, 0xfe, 0xfb, 0xef, 0xbd, 0xef,	\
+	0x7b, 0x75, 0xa3, 0x1d, 0x0a, 0x69, 0x45, 0xc5, 0x71, 0xd1, 0x29, 0x0e, 0x3c, 0xc7, 0x0b, 0x80,	\
+	0x56, 0x04, 0x4e, 0x12, 0x04, 0x61, 0xd1, 0x71, 0x14, 0x6a, 0xa8, 0x3e, 0xf7, 0x17, 0x15, 0xa9,	\
+	0x3f, 0x1c, 0x94, 0x8e, 0x02, 0x44, 0x33, 0x1c, 0x44, 0x0a, 0x65, 0xcb, 0x8e, 0x9e, 0xf7, 0xbd,	\
+	0xf7, 0xdf, 0x7d, 0xff, 0xff, 0xff, 0xa0, 0xe4, 0x8e, 0x7b, 0xc1, 0xef, 0x1a, 0x17, 0x91, 0xd3,	\
+	0x57, 0x59, 0x42, 0xbd, 0x17, 0x14, 0x80, 0xba, 0xbd, 0x37, 0x09, 0x01, 0x55, 0xee, 0xc7, 0x52,	\
+	0xe4, 0x0f, 0x45, 0x41, 0xd1, 0xd9, 0x4d, 0x5f, 0x3a, 0xce, 0x22, 0x8d, 0x55, 0xd7, 0xe4, 0xbd,	\
+	0x35, 0x75, 0x94, 0xb1, 0xae, 0xe7, 0x48, 0x2d, 0xf6, 0xdd, 0xb9, 0xd4, 0xb9, 0x1b, 0xa9, 0x8e,	\
+	0x75, 0x41, 0x26, 0xcf, 0x73, 0xaa, 0x0a, 0xe6, 0xd2, 0x73, 0xa9, 0x72, 0x35, 0x66, 0xb9, 0xd4,	\
+	0xb9, 0x1a, 0xb7, 0x0e, 0x71, 0x1d, 0x1b, 0x34, 0x1c, 0xed, 0x41, 0x77, 0x96, 0x63, 0x9d, 0x50,	\
+	0xa7, 0xb6, 0xcd, 0xce, 0xd4, 0x14, 0x3c, 0x40, 0xff, 0xff, 0xff, 0xdc, 0x39, 0x0f, 0x7b, 0xef,	\
+	0xbd, 0xef, 0xbe, 0x93, 0x78, 0x25, 0x34, 0xaf, 0xb2, 0x21, 0x24, 0x93, 0x75, 0x21, 0x0f, 0x7b,	\
+	0xff, 0xfd, 0xef, 0xff, 0x9a, 0xf1, 0x03, 0xff, 0xff, 0xfe, 0x75, 0x14, 0x29, 0x05, 0xc4, 0xa4,	\
+	0x3e, 0xf8, 0xfb, 0xe3, 0x83, 0x45, 0x08, 0x82, 0x85, 0x54, 0x00, 0xba, 0xea, 0x58, 0x9f, 0x7d,	\
+	0xf7, 0xc1, 0xc7, 0xac, 0x85, 0x20, 0xa5, 0x2c, 0x4f, 0xbe, 0xfb, 0xe0, 0xc4, 0x9e, 0x85, 0x40,	\
+	0xa9, 0x31, 0x08, 0x82, 0xa2, 0x89, 0xef, 0x7b, 0xc1, 0x91, 0x02, 0x11, 0x06, 0x3f, 0x54, 0x4a,	\
+	0x69, 0x5d, 0x19, 0x62, 0x7f, 0xff, 0xff, 0x84, 0x2e, 0x13, 0xef, 0xbe, 0xfb, 0xde, 0xf7, 0xb2,	\
+	0xd5, 0x0f, 0xbe, 0x3e, 0xf8, 0xeb, 0x4c, 0x40, 0x0b, 0xba, 0xee, 0x13, 0xde, 0xf7, 0x83, 0x3a,	\
+	0x24, 0x24, 0x0c, 0xe9, 0x22, 0x7f, 0xff, 0xff, 0x87, 0x66, 0x82, 0x12, 0x07, 0x6e, 0x4a, 0x07,	\
+	0xdf, 0x1f, 0x7d, 0xdb, 0x51, 0x03, 0xde, 0xf7, 0xb5, 0x28, 0x21, 0xa8, 0x1e, 0x19, 0x02, 0x7f,	\
+	0xff, 0xff, 0xfb, 0xde, 0xf6, 0xcc, 0xe4, 0x2a, 0x83, 0x66, 0x48, 0x81, 0xff, 0xff, 0xff, 0xe8,	\
+	0x96, 0x27, 0xbd, 0xef, 0x7f, 0xff, 0xff, 0xfa, 0x74, 0x44, 0x70, 0x97, 0xb1, 0x44, 0xf7, 0xbd,	\
+	0xe0, 0xdb, 0x89, 0x0a, 0xa0, 0xdb, 0x96, 0x27, 0xff, 0xff, 0xf8, 0x7b, 0x9c, 0x27, 0xdf, 0x7d,	\
+	0xf7, 0xbd, 0xef, 0x7d, 0x27, 0x09, 0x24, 0x92, 0x2e, 0x91, 0xc2, 0x56, 0x38, 0xce, 0x44, 0x13,	\
+	0xb7, 0x6e, 0x4e, 0x83, 0x85, 0x88, 0x8e, 0x52, 0xaf, 0x79, 0x2e, 0x40, 0x30, 0x2a, 0x23, 0xa4,	\
+	0x3e, 0xf9, 0xc8, 0xe0, 0xa8, 0x29, 0xb9, 0x24, 0x68, 0x6d, 0x1c, 0x88, 0x32, 0xb2, 0x91, 0xd2,	\
+	0x19, 0xf9, 0xa8, 0xe0, 0xad, 0x6a, 0x88, 0xe6, 0x95, 0xb5, 0x94, 0xe4, 0xed, 0x5a, 0x24, 0x22,	\
+	0x7d, 0xf7, 0xdf, 0x48, 0xed, 0x22, 0x15, 0xb8, 0x96, 0x89, 0xef, 0x7b, 0xdb, 0xe7, 0xa2, 0x7b,	\
+	0xde, 0xf7, 0x07, 0x92, 0x88, 0x89, 0xf2, 0x51, 0x3d, 0xef, 0x7a, 0xe9, 0xe8, 0x9f, 0xff, 0xff,	\
+	0xf7, 0x72, 0x91, 0x3d, 0xef, 0x7b, 0x8f, 0x25, 0x13, 0xde, 0xf7, 0xa9, 0x3d, 0x13, 0xff, 0xff,	\
+	0xff, 0x95, 0x29, 0x13, 0xde, 0xf7, 0xa9, 0xcb, 0x44, 0x0c, 0x37, 0x22, 0x7d, 0xf7, 0xdf, 0x62,	\
+	0xd1, 0x44, 0x2b, 0x99, 0x2d, 0x13, 0xff, 0xff, 0xfe, 0x0c, 0x74, 0x44, 0x54, 0xb4, 0x44, 0x46,	\
+	0x46, 0x3a, 0x22, 0x32, 0x73, 0x51, 0x0a, 0xe9, 0xaa, 0x27, 0xbd, 0xef, 0x67, 0x78, 0x11, 0x2e,	\
+	0x3b, 0x32, 0x51, 0x03, 0xfd, 0x62, 0x22, 0x32, 0xd9, 0xe0, 0x22, 0x58, 0xf2, 0xbd, 0x13, 0xff,	\
+	0xff, 0xff, 0xcd, 0xda, 0x44, 0x2b, 0xce, 0xe4, 0x4f, 0xbe, 0xfb, 0xef, 0x54, 0x94, 0x4f, 0xff,	\
+	0xff, 0xff, 0x7c, 0xd4, 0x46, 0x5f, 0x05, 0x44, 0xf7, 0xbd, 0xef, 0x8d, 0xfa, 0x21, 0x5b, 0xee,	\
+	0xe5, 0xd9, 0xaa, 0x4e, 0x82, 0xe5, 0x04, 0x64, 0xfa, 0xbc, 0x32, 0xc2, 0xb4, 0x56, 0x84, 0xf9,	\
+	0x55, 0x50, 0xba, 0x56, 0x39, 0x12, 0x66, 0xb0, 0xb9, 0xb9, 0xe5, 0x49, 0xad, 0x15, 0x2f, 0x1d,	\
+	0x69, 0x26, 0xa1, 0xab, 0xdd, 0x3e, 0x48, 0x8a, 0xab, 0x26, 0xac, 0x81, 0xa9, 0x6d, 0xd5, 0xab,	\
+	0x17, 0x29, 0xdb, 0x85, 0x82, 0x5a, 0xc6, 0x05, 0x95, 0x56, 0xea, 0x8a, 0xcb, 0x09, 0xd3, 0x17,	\
+	0x82, 0x4e, 0xb5, 0x59, 0x72, 0xb0, 0x3c, 0x2a, 0x5c, 0xad, 0x59, 0xeb, 0x41, 0x57, 0xe6, 0x29,	\
+	0x5d, 0x5e, 0xdb, 0x55, 0xca, 0xea, 0xdb, 0xec, 0x2c, 0xb9, 0x5b, 0xaa, 0xb1, 0xcb, 0xa5, 0xb4,	\
+	0x31, 0xc1, 0x71, 0x69, 0xc7, 0x05, 0x83, 0x5a, 0x38, 0x2d, 0xaa, 0xb1, 0xc2, 0x59, 0xcc, 0x79,	\
+	0x1b, 0xc9, 0xef, 0x6a, 0x5b, 0xde, 0xbd, 0x5a, 0xbb, 0xd4, 0x7d, 0x45, 0xde, 0xab, 0xd4, 0x72,	\
+	0x35, 0x5e, 0xad, 0x75, 0xe8, 0xbe, 0x87, 0xcf, 0x82, 0xfd, 0x63, 0xec, 0xf0, 0x96, 0x2c, 0xaa,	\
+	0x02, 0xb2, 0x84, 0x6a, 0xb3, 0xe4, 0x8d, 0x26, 0xd3, 0x03, 0x85, 0x54, 0x6a, 0xbb, 0x80, 0x0b,	\
+	0xdc, 0xb2, 0xb5, 0x4a, 0x78, 0x14, 0xea, 0x81, 0x85, 0x10, 0x4c, 0x38, 0x00, 0xc5, 0x9c, 0x35,	\
+	0x63, 0x44, 0x06, 0x5e, 0xa9, 0x5a, 0xcd, 0x9c, 0x0b, 0x5b, 0xaa, 0x34, 0xf7, 0xd5, 0x09, 0xf4,	\
+	0xa0, 0x07, 0xd2, 0xf4, 0xb1, 0xb8, 0xac, 0xed, 0x56, 0x38, 0xee, 0x2b, 0x18, 0x9c, 0x5b, 0xa9,	\
+	0xae, 0x13, 0xac, 0xdd, 0x2c, 0x3e, 0x53, 0xb4, 0xc3, 0xf0, 0x38, 0x64, 0x42, 0xeb, 0xad, 0x5c,	\
+	0x87, 0x57, 0x79, 0x66, 0xb8, 0x7a, 0xbc, 0x0e, 0x1f, 0x3a, 0x2e, 0xd5, 0xf3, 0xd5, 0x76, 0x8f,	\
+	0xbd, 0x4b, 0x4b, 0xa0, 0x8a, 0xca, 0xfd, 0x15, 0xb6, 0x4a, 0x35, 0x0e, 0xc2, 0x2e, 0x2e, 0x12,	\
+	0x36, 0x0f, 0x69, 0x1b, 0xad, 0x6a, 0x8b, 0xad, 0x9a, 0x8b, 0xad, 0xd8, 0x45, 0xa1, 0x3d, 0x2b,	\
+	0xbb, 0x92, 0x8b, 0x5e, 0x82, 0x2f, 0x07, 0x29, 0x17, 0xe9, 0x7a, 0x8b, 0xf4, 0x85, 0x26, 0xd6,	\
+	0x6a, 0x2d, 0xae, 0xc2, 0x2d, 0xbd, 0x04, 0x9c, 0x68, 0x97, 0xa7, 0x48, 0xe9, 0x6e, 0xa1, 0x55,	\
+	0x04, 0xd8, 0x96, 0x95, 0x5b, 0xda, 0x6a, 0xd4, 0xb6, 0xf6, 0x15, 0x88, 0xae, 0x27, 0x2f, 0x4e,	\
+	0x97, 0x06, 0x7a, 0xd5, 0x53, 0x83, 0x02, 0xc8, 0xba, 0xea, 0x05, 0x91, 0x75, 0xdc, 0xe5, 0xa5,	\
+	0x57, 0x1a, 0x05, 0x6a, 0x5a, 0x8c, 0x2b, 0x55, 0x4c, 0x09, 0xea, 0xd4, 0xb6, 0x05, 0x35, 0x48,	\
+	0x60, 0x56, 0x5a, 0xaa, 0x61, 0xc2, 0xbd, 0x3a, 0x58, 0x95, 0x55, 0xa9, 0x6a, 0x95, 0x97, 0xa7,	\
+	0x4b, 0x22, 0x8a, 0xd5, 0x6b, 0x74, 0x67, 0x2c, 0x45, 0x0c, 0x4a, 0xb9, 0xc6, 0x5c, 0x4b, 0x4a,	\
+	0xaa, 0xb3, 0x95, 0x81, 0x56, 0x15, 0xaa, 0xd6, 0xab, 0x59, 0x6a, 0xa9, 0xa1, 0x02, 0xd2, 0xd5,	\
+	0xd8, 0x85, 0x52, 0x1f, 0x9d, 0x35, 0x5c, 0xe3, 0xf3, 0xac, 0xb4, 0xb5, 0x79, 0xea, 0xad, 0x2a,	\
+	0xbd, 0x90, 0x2a, 0x83, 0xdb, 0x59, 0x64, 0x5d, 0xdb, 0xc9, 0x8f, 0x81, 0xf0, 0xbf, 0x8f, 0xa9,	\
+	0x6f, 0xf9, 0x14, 0x7a, 0xaa, 0x2e, 0x9e, 0x2d, 0xba, 0xbf, 0x7d, 0x55, 0xe6, 0x85, 0xe0, 0xf7,	\
+	0x55, 0x7a, 0x1b, 0xac, 0xd1, 0x29, 0xd5, 0x8a, 0x97, 0x14, 0xc4, 0xa7, 0xc2, 0x52, 0xba, 0x9e,	\
+	0x54, 0xe5, 0x42, 0x52, 0x82, 0x79, 0x4b, 0x22, 0xa8, 0x5d, 0x9d, 0x7e, 0x49, 0xd9, 0x88, 0x8b,	\
+	0x56, 0x00, 0xa8, 0xa8, 0x12, 0x78, 0xf2, 0x48, 0x7a, 0x27, 0x11, 0x7a, 0x30, 0x8c, 0x3f, 0xdd,	\
+	0x98, 0x1e, 0xea, 0x04, 0x3e, 0x10, 0x85, 0xd6, 0x10, 0xb9, 0x56, 0xb4, 0x9c, 0x2d, 0xe8, 0x38,	\
+	0x70, 0x72, 0x9c, 0x2e, 0xa2, 0x75, 0x57, 0x55, 0xdc, 0x38, 0xf9, 0x4e, 0x19, 0x78, 0x8e, 0x95,	\
+	0x7a, 0x4e, 0xab, 0xc3, 0x13, 0x95, 0xb1, 0x41, 0xc3, 0x66, 0xed, 0xcb, 0x6e, 0xf3, 0xd0, 0xb4,	\
+	0xdd, 0xa1, 0xbd, 0xaa, 0x9d, 0x6f, 0x73, 0xd3, 0xab, 0x7e, 0x4a, 0x18, 0x94, 0x92, 0xbb, 0x3e,	\
+	0x04, 0x5a, 0x93, 0x12, 0xbc, 0x7d, 0xa4, 0xaf, 0x47, 0x01, 0x17, 0xb6, 0x6a, 0x2d, 0xba, 0xe9,	\
+	0x5f, 0xf7, 0x51, 0x2a, 0x6e, 0xf3, 0x65, 0xa5, 0x9a, 0xb7, 0xbd, 0x89, 0x05, 0x42, 0x3e, 0x47,	\
+	0x63, 0xcf, 0x95, 0xeb, 0xa7, 0xf0, 0xcb, 0xf9, 0xce, 0xf9, 0xf0, 0x16, 0xd9, 0xb8, 0x9b, 0x53,	\
+	0x17, 0x71, 0xe6, 0xfc, 0x00
+
+#endif  //  TEXT_HUFF_H_INCLUDED
+
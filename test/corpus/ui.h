@@ -0,0 +1,1055 @@
+/*
+ *  ST7735 Command Set Encoded Image
+ *  Encoder by Tim Williams, 2018-12-29
+ *  Original: ui.png
+ */
+
+#ifndef UI_H_INCLUDED
+#define UI_H_INCLUDED
+
+#define UI_MAGIC_NUMBER	0x371e5453
+#define UI_WIDTH		160
+#define UI_HEIGHT		128
+#define UI_CMD_LEN		4527	/*  Number of command bytes  */
+#define UI_PALETTE_LEN		80	/*  Number of bytes (2 * colors)  */
+#define UI_TOTAL_LEN		4608	/*  Total array size  */
+
+#define UI_PAL		\
+	0xe2, 0x91,	0x71, 0x9a,	0x77, 0xee,	0x52, 0xd2,		\
+	0x20, 0xc9,	0xf5, 0x0e,	0x09, 0x82,	0x50, 0xfd,		\
+	0xac, 0xb4,	0xcb, 0xd4,	0xdf, 0x68,	0x49, 0x93,		\
+	0xef, 0x14,	0xce, 0x49,	0xef, 0xe9,	0x8e, 0x89,		\
+	0x82, 0x4b,	0xbf, 0xe5,	0x58, 0x02,	0xa4, 0x0a,		\
+	0x02, 0x37,	0x50, 0x66,	0x6c, 0xf8,	0x6b, 0xc3,		\
+	0xcf, 0x41,	0x93, 0x39,	0x09, 0xab,	0xa6, 0xf9,		\
+	0xfb, 0xb5,	0x15, 0x65,	0x95, 0x00,	0x42, 0xdf,		\
+	0xb7, 0xd6,	0x92, 0x44,	0xe0, 0xc2,	0x2e, 0x94,		\
+	0x7a, 0x71,	0xd3, 0xdc,	0x7b, 0xca,	0x83, 0xc1
+
+#define UI_CMDS		\
+	0x05, 10, 46, 1, 38, 2,		\
+	0x25, 93, 15, 11, 5,		\
+	0x05, 17, 94, 116, 30, 7,		\
+	0x25, 110, 124, 19, 4,		\
+	0x07, 4, 92, 123, 15, 5,		\
+	125, 119, 5, 5,		\
+	125, 116, 5, 2,		\
+	92, 119, 2, 4,		\
+	0x05, 28, 158, 17, 2, 12,		\
+	0x05, 18, 8, 46, 31, 4,		\
+	0x25, 33, 14, 6, 13,		\
+	0x07, 4, 157, 31, 3, 22,		\
+	40, 14, 5, 13,		\
+	33, 28, 13, 2,		\
+	157, 54, 3, 6,		\
+	0x05, 32, 135, 45, 5, 15,		\
+	0x05, 2, 118, 27, 17, 7,		\
+	0x25, 43, 30, 7, 16,		\
+	0x07, 17, 143, 100, 15, 6,		\
+	99, 83, 3, 15,		\
+	30, 43, 13, 3,		\
+	138, 96, 9, 4,		\
+	50, 28, 3, 11,		\
+	132, 34, 5, 5,		\
+	108, 83, 6, 4,		\
+	135, 21, 2, 12,		\
+	93, 92, 3, 7,		\
+	135, 11, 2, 9,		\
+	137, 100, 3, 6,		\
+	151, 66, 9, 2,		\
+	149, 98, 7, 2,		\
+	97, 93, 2, 6,		\
+	115, 83, 3, 4,		\
+	102, 85, 5, 2,		\
+	46, 28, 4, 2,		\
+	0x05, 5, 73, 101, 14, 10,		\
+	0x25, 96, 100, 7, 11,		\
+	0x07, 4, 67, 101, 5, 10,		\
+	92, 100, 2, 11,		\
+	94, 104, 2, 4,		\
+	103, 107, 2, 4,		\
+	0x05, 30, 137, 68, 23, 8,		\
+	0x25, 145, 76, 15, 4,		\
+	0x25, 137, 76, 7, 3,		\
+	0x05, 37, 119, 94, 18, 12,		\
+	0x25, 103, 94, 10, 9,		\
+	0x07, 7, 117, 88, 18, 5,		\
+	103, 87, 11, 6,		\
+	114, 94, 4, 13,		\
+	156, 90, 4, 9,		\
+	103, 104, 11, 3,		\
+	114, 88, 2, 6,		\
+	135, 89, 2, 5,		\
+	0x05, 25, 9, 17, 24, 8,		\
+	0x25, 59, 19, 12, 5,		\
+	0x25, 7, 17, 2, 5,		\
+	0x05, 33, 146, 47, 10, 19,		\
+	0x25, 141, 53, 4, 15,		\
+	0x07, 6, 140, 41, 15, 3,		\
+	140, 45, 6, 7,		\
+	156, 60, 4, 6,		\
+	147, 44, 4, 3,		\
+	145, 66, 6, 2,		\
+	152, 44, 4, 2,		\
+	0x05, 3, 71, 42, 23, 4,		\
+	0x25, 62, 42, 8, 4,		\
+	0x25, 95, 42, 3, 4,		\
+	0x05, 1, 45, 103, 20, 19,		\
+	0x25, 0, 55, 54, 6,		\
+	0x07, 166, 23, 123, 69, 4,		\
+	0, 73, 30, 9,		\
+	62, 25, 19, 13,		\
+	65, 57, 59, 4,		\
+	71, 6, 13, 18,		\
+	137, 0, 23, 10,		\
+	12, 83, 8, 28,		\
+	125, 46, 10, 20,		\
+	100, 67, 16, 12,		\
+	13, 112, 31, 6,		\
+	14, 1, 12, 15,		\
+	138, 24, 15, 12,		\
+	63, 74, 29, 6,		\
+	71, 111, 13, 12,		\
+	59, 66, 31, 5,		\
+	3, 120, 19, 8,		\
+	0, 51, 50, 3,		\
+	144, 80, 12, 12,		\
+	0, 82, 12, 11,		\
+	3, 8, 3, 43,		\
+	34, 2, 11, 11,		\
+	3, 97, 8, 15,		\
+	33, 90, 6, 20,		\
+	21, 82, 20, 6,		\
+	86, 13, 6, 20,		\
+	136, 122, 19, 6,		\
+	88, 63, 37, 3,		\
+	80, 88, 10, 11,		\
+	124, 66, 5, 21,		\
+	132, 110, 11, 9,		\
+	49, 8, 6, 16,		\
+	137, 10, 8, 12,		\
+	22, 119, 23, 4,		\
+	60, 4, 10, 9,		\
+	150, 13, 8, 11,		\
+	0, 61, 7, 12,		\
+	0, 1, 14, 6,		\
+	38, 76, 16, 5,		\
+	98, 26, 14, 5,		\
+	109, 108, 14, 5,		\
+	118, 70, 4, 17,		\
+	85, 0, 6, 11,		\
+	56, 14, 13, 5,		\
+	20, 104, 8, 8,		\
+	91, 66, 8, 8,		\
+	6, 25, 3, 21,		\
+	54, 26, 6, 10,		\
+	0, 22, 2, 29,		\
+	6, 9, 7, 8,		\
+	8, 66, 8, 7,		\
+	21, 88, 4, 14,		\
+	113, 46, 7, 8,		\
+	137, 106, 14, 4,		\
+	93, 21, 11, 5,		\
+	118, 40, 9, 6,		\
+	137, 80, 6, 9,		\
+	28, 0, 3, 17,		\
+	81, 34, 25, 2,		\
+	55, 73, 7, 7,		\
+	39, 98, 16, 3,		\
+	76, 81, 16, 3,		\
+	137, 37, 16, 3,		\
+	29, 89, 2, 23,		\
+	10, 25, 23, 2,		\
+	130, 119, 5, 9,		\
+	54, 55, 22, 2,		\
+	0, 7, 3, 14,		\
+	3, 113, 6, 7,		\
+	102, 79, 10, 4,		\
+	137, 92, 10, 4,		\
+	46, 4, 13, 3,		\
+	154, 24, 3, 13,		\
+	13, 27, 2, 19,		\
+	31, 73, 4, 9,		\
+	65, 111, 6, 6,		\
+	76, 88, 3, 12,		\
+	69, 63, 18, 2,		\
+	98, 61, 17, 2,		\
+	109, 114, 17, 2,		\
+	39, 73, 16, 2,		\
+	114, 26, 4, 8,		\
+	145, 10, 5, 6,		\
+	156, 121, 4, 7,		\
+	9, 27, 3, 9,		\
+	56, 98, 9, 3,		\
+	92, 29, 5, 5,		\
+	120, 52, 5, 5,		\
+	153, 111, 5, 5,		\
+	9, 40, 4, 6,		\
+	25, 96, 3, 8,		\
+	31, 0, 3, 8,		\
+	39, 105, 6, 4,		\
+	46, 25, 8, 3,		\
+	55, 7, 4, 6,		\
+	84, 85, 8, 3,		\
+	116, 66, 8, 3,		\
+	148, 93, 8, 3,		\
+	31, 101, 2, 11,		\
+	34, 110, 11, 2,		\
+	50, 101, 11, 2,		\
+	84, 18, 2, 11,		\
+	12, 63, 7, 3,		\
+	81, 36, 7, 3,		\
+	146, 17, 3, 7,		\
+	156, 82, 3, 7,		\
+	1, 94, 2, 10,		\
+	25, 88, 4, 5,		\
+	31, 88, 2, 10,		\
+	65, 118, 4, 5,		\
+	62, 72, 10, 2,		\
+	66, 98, 10, 2,		\
+	113, 79, 5, 4,		\
+	135, 1, 2, 10,		\
+	45, 7, 3, 6,		\
+	59, 63, 6, 3,		\
+	90, 93, 3, 6,		\
+	103, 32, 9, 2,		\
+	116, 61, 9, 2,		\
+	131, 40, 9, 2,		\
+	8, 93, 4, 4,		\
+	31, 9, 2, 8,		\
+	46, 47, 4, 4,		\
+	55, 20, 4, 4,		\
+	60, 57, 4, 4,		\
+	113, 41, 4, 4,		\
+	121, 47, 4, 4,		\
+	127, 42, 4, 4,		\
+	129, 71, 2, 8,		\
+	129, 67, 8, 2,		\
+	135, 120, 8, 2,		\
+	152, 10, 8, 2,		\
+	35, 73, 3, 5,		\
+	39, 101, 5, 3,		\
+	81, 25, 3, 5,		\
+	123, 107, 3, 5,		\
+	135, 61, 5, 3,		\
+	93, 75, 7, 2,		\
+	122, 69, 2, 7,		\
+	130, 107, 7, 2,		\
+	1, 122, 2, 6,		\
+	9, 112, 3, 4,		\
+	46, 14, 2, 6,		\
+	65, 100, 2, 6,		\
+	72, 4, 6, 2,		\
+	82, 31, 4, 3,		\
+	84, 120, 4, 3,		\
+	98, 31, 4, 3,		\
+	116, 69, 2, 6,		\
+	36, 88, 5, 2,		\
+	92, 26, 5, 2,		\
+	158, 12, 2, 5,		\
+	7, 63, 3, 3,		\
+	35, 79, 3, 3,		\
+	46, 21, 3, 3,		\
+	137, 89, 3, 3,		\
+	3, 93, 2, 4,		\
+	6, 7, 4, 2,		\
+	45, 101, 4, 2,		\
+	53, 36, 4, 2,		\
+	65, 107, 2, 4,		\
+	69, 117, 2, 4,		\
+	79, 4, 4, 2,		\
+	90, 88, 2, 4,		\
+	99, 79, 2, 4,		\
+	129, 83, 2, 4,		\
+	141, 22, 4, 2,		\
+	0x05, 21, 106, 34, 15, 6,		\
+	0x25, 91, 111, 15, 5,		\
+	0x07, 5, 122, 34, 10, 6,		\
+	84, 116, 8, 4,		\
+	84, 111, 7, 3,		\
+	107, 107, 2, 9,		\
+	105, 107, 2, 4,		\
+	0x05, 12, 108, 18, 22, 8,		\
+	0x25, 111, 2, 18, 9,		\
+	0x07, 23, 98, 40, 15, 8,		\
+	90, 51, 18, 5,		\
+	104, 11, 17, 4,		\
+	143, 111, 10, 5,		\
+	116, 15, 16, 3,		\
+	90, 37, 8, 5,		\
+	104, 2, 6, 6,		\
+	104, 15, 3, 11,		\
+	129, 2, 6, 5,		\
+	93, 48, 14, 2,		\
+	133, 12, 2, 14,		\
+	123, 11, 6, 4,		\
+	99, 36, 5, 4,		\
+	143, 120, 10, 2,		\
+	109, 15, 6, 3,		\
+	130, 9, 3, 6,		\
+	90, 46, 8, 2,		\
+	109, 52, 4, 4,		\
+	130, 18, 3, 5,		\
+	104, 9, 7, 2,		\
+	107, 49, 6, 2,		\
+	143, 116, 3, 4,		\
+	133, 7, 2, 4,		\
+	0x05, 14, 112, 26, 2, 8,		\
+	0x05, 13, 1, 108, 2, 14,		\
+	0x05, 35, 131, 70, 6, 15,		\
+	0x25, 87, 101, 5, 9,		\
+	0x25, 151, 106, 8, 5,		\
+	0x05, 22, 76, 84, 6, 4,		\
+	0x05, 11, 98, 1, 6, 14,		\
+	0x25, 93, 1, 4, 12,		\
+	0x05, 19, 25, 32, 17, 11,		\
+	0x25, 24, 27, 8, 5,		\
+	0x25, 33, 30, 10, 2,		\
+	0x25, 131, 43, 9, 2,		\
+	0x05, 39, 48, 91, 23, 7,		\
+	0x25, 57, 82, 19, 8,		\
+	0x07, 6, 41, 81, 16, 4,		\
+	41, 86, 12, 4,		\
+	42, 91, 5, 7,		\
+	74, 90, 2, 8,		\
+	54, 85, 2, 5,		\
+	71, 95, 3, 3,		\
+	0x05, 0, 126, 107, 4, 9,		\
+	0x05, 16, 50, 39, 11, 16,		\
+	0x25, 79, 46, 11, 9,		\
+	0x07, 7, 92, 79, 7, 10,		\
+	67, 46, 11, 6,		\
+	73, 39, 17, 3,		\
+	63, 53, 16, 2,		\
+	61, 46, 5, 5,		\
+	61, 40, 11, 2,		\
+	92, 90, 7, 2,		\
+	0x05, 31, 20, 63, 19, 7,		\
+	0x25, 27, 70, 32, 3,		\
+	0x07, 10, 15, 38, 9, 8,		\
+	40, 65, 9, 5,		\
+	15, 30, 6, 6,		\
+	50, 66, 9, 4,		\
+	16, 70, 10, 3,		\
+	46, 63, 12, 2,		\
+	22, 28, 2, 10,		\
+	41, 46, 5, 4,		\
+	24, 43, 5, 3,		\
+	16, 66, 3, 4,		\
+	0x05, 4, 146, 116, 14, 3,		\
+	0x05, 34, 153, 119, 7, 2,		\
+	0x02, 10, 54, 3, 23,		\
+	0x22, 46, 3, 7,		\
+	0x02, 17, 107, 123, 13,		\
+	0x02, 2, 118, 26, 11,		\
+	0x22, 147, 96, 9,		\
+	0x02, 5, 76, 100, 16,		\
+	0x22, 68, 100, 7,		\
+	0x02, 37, 120, 87, 17,		\
+	0x22, 117, 93, 11,		\
+	0x22, 118, 106, 10,		\
+	0x22, 129, 106, 8,		\
+	0x02, 1, 8, 62, 89,		\
+	0x22, 91, 0, 45,		\
+	0x07, 44, 31, 127, 44,		\
+	77, 56, 41,		\
+	7, 61, 37,		\
+	45, 61, 36,		\
+	38, 0, 35,		\
+	51, 24, 27,		\
+	61, 80, 25,		\
+	55, 38, 23,		\
+	69, 71, 22,		\
+	14, 54, 20,		\
+	9, 118, 17,		\
+	76, 127, 16,		\
+	82, 61, 16,		\
+	35, 54, 15,		\
+	45, 122, 15,		\
+	76, 73, 15,		\
+	0, 54, 13,		\
+	75, 65, 13,		\
+	15, 0, 12,		\
+	76, 55, 12,		\
+	142, 36, 12,		\
+	27, 118, 11,		\
+	74, 0, 11,		\
+	146, 40, 11,		\
+	125, 1, 10,		\
+	4, 0, 9,		\
+	6, 50, 9,		\
+	73, 72, 9,		\
+	99, 66, 9,		\
+	13, 82, 8,		\
+	22, 127, 8,		\
+	39, 13, 8,		\
+	60, 71, 8,		\
+	109, 113, 8,		\
+	118, 113, 8,		\
+	143, 110, 8,		\
+	11, 111, 7,		\
+	17, 27, 7,		\
+	19, 16, 7,		\
+	45, 75, 7,		\
+	67, 65, 7,		\
+	93, 20, 7,		\
+	109, 66, 7,		\
+	109, 107, 7,		\
+	0x02, 21, 84, 99, 19,		\
+	0x07, 3, 12, 90, 50, 10,		\
+	11, 104, 1, 21,		\
+	39, 57, 81, 12,		\
+	0x22, 63, 90, 11,		\
+	0x22, 44, 90, 8,		\
+	0x22, 47, 85, 7,		\
+	0x02, 16, 65, 39, 8,		\
+	0x22, 64, 52, 7,		\
+	0x02, 31, 15, 50, 31,		\
+	0x22, 15, 28, 7,		\
+	0x22, 39, 63, 7,		\
+	0x02, 4, 146, 119, 7,		\
+	0x03, 18, 45, 17, 11,		\
+	0x23, 39, 21, 7,		\
+	0x03, 2, 159, 99, 7,		\
+	0x03, 37, 113, 97, 7,		\
+	0x23, 118, 94, 7,		\
+	0x03, 33, 156, 41, 17,		\
+	0x23, 140, 58, 10,		\
+	0x23, 145, 57, 9,		\
+	0x03, 1, 0, 97, 31,		\
+	0x23, 2, 21, 15,		\
+	0x07, 17, 2, 37, 12,		\
+	26, 5, 12,		\
+	61, 27, 11,		\
+	70, 5, 11,		\
+	20, 87, 10,		\
+	92, 15, 10,		\
+	122, 77, 10,		\
+	130, 109, 10,		\
+	137, 22, 10,		\
+	27, 1, 9,		\
+	28, 93, 8,		\
+	153, 28, 8,		\
+	11, 98, 7,		\
+	60, 25, 7,		\
+	84, 5, 7,		\
+	85, 11, 7,		\
+	157, 24, 7,		\
+	0x03, 11, 92, 1, 9,		\
+	0x23, 97, 6, 9,		\
+	0x03, 19, 42, 35, 8,		\
+	0x23, 24, 32, 7,		\
+	0x15, 39, 90, 3, 8,		\
+		1, 1, 1, 1, 38, 1, 1, 1, 1, 39, 1, 1, 1, 1, 1, 1, 39, 39, 39, 39, 39, 16, 39, 39,		\
+	0x07, 54, 54, 57, 6, 4,		\
+		1, 1, 1, 30, 1, 1, 1, 1, 1, 1, 31, 1, 1, 7, 1, 1, 1, 1, 1, 1, 1, 37, 1, 1,		\
+	140, 100, 3, 6,		\
+		2, 2, 2, 8, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 7, 2, 2, 2,		\
+	9, 36, 4, 4,		\
+		36, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 10, 1, 11, 1, 1,		\
+	92, 77, 8, 2,		\
+		16, 16, 16, 16, 16, 21, 16, 16, 16, 16, 34, 16, 16, 16, 1, 1,		\
+	135, 64, 5, 3,		\
+		1, 1, 1, 1, 1, 1, 30, 3, 30, 30, 30, 20, 30, 30, 30,		\
+	15, 36, 7, 2,		\
+		31, 31, 31, 31, 31, 31, 5, 31, 31, 31, 31, 31, 31, 34,		\
+	84, 114, 7, 2,		\
+		21, 21, 21, 21, 21, 21, 21, 37, 14, 21, 21, 21, 21, 33,		\
+	86, 11, 7, 2,		\
+		1, 1, 1, 1, 26, 1, 1, 27, 1, 1, 1, 1, 11, 11,		\
+	113, 54, 7, 2,		\
+		20, 8, 1, 1, 1, 1, 39, 1, 1, 1, 1, 1, 1, 1,		\
+	5, 93, 3, 4,		\
+		1, 29, 1, 1, 1, 23, 1, 1, 1, 1, 1, 32,		\
+	71, 91, 3, 4,		\
+		39, 39, 39, 25, 39, 39, 10, 39, 39, 39, 39, 15,		\
+	88, 120, 4, 3,		\
+		9, 9, 1, 9, 9, 1, 9, 9, 1, 29, 9, 1,		\
+	102, 83, 6, 2,		\
+		2, 2, 2, 2, 2, 12, 2, 2, 2, 2, 15, 2,		\
+	107, 124, 3, 4,		\
+		1, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 28,		\
+	130, 23, 3, 4,		\
+		12, 24, 12, 2, 5, 12, 12, 2, 12, 12, 12, 2,		\
+	131, 85, 6, 2,		\
+		35, 35, 35, 35, 35, 35, 8, 35, 35, 35, 35, 35,		\
+	153, 37, 4, 3,		\
+		1, 1, 17, 1, 1, 1, 9, 1, 1, 1, 1, 1,		\
+	20, 102, 5, 2,		\
+		1, 1, 1, 1, 36, 1, 1, 35, 1, 1,		\
+	92, 13, 5, 2,		\
+		11, 11, 11, 11, 16, 11, 11, 11, 11, 2,		\
+	158, 111, 2, 5,		\
+		1, 1, 1, 1, 2, 21, 21, 21, 21, 1,		\
+	6, 22, 3, 3,		\
+		1, 1, 1, 25, 25, 25, 6, 25, 25,		\
+	25, 93, 3, 3,		\
+		1, 1, 33, 1, 1, 1, 15, 1, 1,		\
+	140, 89, 3, 3,		\
+		13, 1, 1, 1, 1, 33, 1, 1, 1,		\
+	1, 104, 2, 4,		\
+		1, 1, 1, 1, 36, 1, 1, 1,		\
+	6, 46, 2, 4,		\
+		18, 18, 18, 18, 18, 18, 18, 33,		\
+	9, 116, 4, 2,		\
+		20, 1, 1, 1, 1, 0, 1, 1,		\
+	39, 46, 2, 4,		\
+		31, 31, 31, 31, 31, 14, 31, 31,		\
+	57, 36, 4, 2,		\
+		26, 1, 1, 1, 1, 1, 1, 1,		\
+	61, 51, 2, 4,		\
+		16, 18, 16, 16, 16, 16, 32, 16,		\
+	61, 101, 4, 2,		\
+		30, 1, 1, 1, 1, 1, 1, 1,		\
+	65, 63, 4, 2,		\
+		1, 1, 1, 1, 1, 1, 1, 0,		\
+	94, 100, 2, 4,		\
+		5, 5, 5, 18, 5, 5, 5, 5,		\
+	104, 36, 2, 4,		\
+		12, 12, 1, 17, 12, 12, 12, 12,		\
+	116, 75, 2, 4,		\
+		4, 1, 1, 1, 1, 1, 1, 1,		\
+	121, 11, 2, 4,		\
+		27, 12, 12, 12, 12, 29, 12, 12,		\
+	127, 40, 4, 2,		\
+		1, 7, 1, 1, 1, 1, 30, 1,		\
+	129, 79, 2, 4,		\
+		9, 1, 1, 5, 1, 1, 1, 1,		\
+	10, 63, 2, 3,		\
+		8, 1, 1, 1, 1, 38,		\
+	10, 7, 3, 2,		\
+		1, 16, 1, 1, 1, 1,		\
+	31, 98, 2, 3,		\
+		21, 1, 1, 1, 1, 36,		\
+	33, 88, 3, 2,		\
+		1, 1, 1, 1, 1, 27,		\
+	69, 16, 2, 3,		\
+		4, 1, 1, 4, 1, 1,		\
+	82, 85, 2, 3,		\
+		22, 22, 15, 22, 22, 22,		\
+	90, 48, 3, 2,		\
+		12, 12, 12, 12, 12, 32,		\
+	92, 116, 2, 3,		\
+		17, 17, 17, 17, 17, 6,		\
+	94, 108, 2, 3,		\
+		29, 5, 5, 19, 5, 5,		\
+	130, 7, 3, 2,		\
+		12, 1, 12, 12, 21, 12,		\
+	138, 22, 3, 2,		\
+		1, 1, 1, 1, 14, 1,		\
+	156, 80, 3, 2,		\
+		1, 1, 1, 1, 1, 31,		\
+	69, 121, 2, 2,		\
+		1, 20, 30, 32,		\
+	88, 37, 2, 2,		\
+		12, 12, 12, 12,		\
+	147, 98, 2, 2,		\
+		2, 2, 2, 15,		\
+	150, 10, 2, 2,		\
+		1, 1, 25, 1,		\
+	158, 29, 2, 2,		\
+		28, 28, 25, 28,		\
+	0x12, 55, 13, 15,		\
+		1, 1, 16, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1,		\
+	0x07, 78, 9, 119, 13,		\
+		1, 1, 1, 1, 1, 1, 32, 1, 1, 1, 1, 1, 1,		\
+	34, 1, 12,		\
+		8, 1, 1, 9, 1, 1, 1, 5, 1, 1, 1, 1,		\
+	52, 90, 11,		\
+		29, 39, 39, 29, 39, 39, 39, 39, 39, 39, 11,		\
+	88, 36, 11,		\
+		12, 12, 12, 12, 12, 12, 13, 12, 12, 12, 12,		\
+	103, 93, 11,		\
+		37, 37, 37, 11, 37, 37, 10, 37, 37, 37, 37,		\
+	49, 65, 10,		\
+		31, 31, 31, 18, 31, 31, 31, 31, 31, 31,		\
+	82, 84, 10,		\
+		22, 22, 1, 1, 28, 1, 1, 1, 1, 1,		\
+	102, 31, 10,		\
+		1, 1, 1, 35, 1, 1, 1, 1, 1, 31,		\
+	103, 103, 10,		\
+		37, 37, 37, 37, 37, 34, 37, 37, 37, 37,		\
+	82, 72, 9,		\
+		22, 1, 1, 1, 1, 1, 1, 33, 1,		\
+	131, 42, 9,		\
+		19, 19, 19, 19, 19, 10, 39, 22, 5,		\
+	147, 92, 9,		\
+		1, 1, 1, 1, 36, 1, 1, 1, 1,		\
+	147, 97, 9,		\
+		7, 2, 2, 2, 2, 28, 2, 2, 2,		\
+	71, 52, 8,		\
+		3, 16, 16, 19, 16, 16, 16, 16,		\
+	77, 3, 8,		\
+		14, 10, 10, 15, 10, 10, 10, 1,		\
+	92, 74, 8,		\
+		1, 1, 1, 1, 19, 1, 1, 1,		\
+	129, 69, 8,		\
+		1, 1, 11, 35, 35, 35, 35, 35,		\
+	135, 119, 8,		\
+		1, 1, 38, 1, 10, 1, 1, 1,		\
+	150, 12, 8,		\
+		1, 1, 1, 1, 1, 1, 26, 1,		\
+	15, 29, 7,		\
+		31, 31, 31, 33, 31, 31, 31,		\
+	32, 27, 7,		\
+		19, 18, 18, 22, 18, 18, 18,		\
+	38, 75, 7,		\
+		1, 1, 1, 1, 1, 1, 25,		\
+	38, 118, 7,		\
+		25, 1, 1, 1, 1, 1, 1,		\
+	39, 64, 7,		\
+		31, 31, 3, 9, 31, 31, 30,		\
+	54, 80, 7,		\
+		1, 1, 1, 1, 1, 1, 21,		\
+	69, 81, 7,		\
+		17, 39, 39, 39, 39, 39, 39,		\
+	92, 89, 7,		\
+		16, 16, 16, 16, 9, 16, 16,		\
+	100, 50, 7,		\
+		1, 12, 12, 36, 12, 12, 12,		\
+	104, 8, 7,		\
+		12, 12, 22, 12, 12, 12, 12,		\
+	116, 107, 7,		\
+		11, 11, 1, 1, 1, 1, 1,		\
+	128, 93, 7,		\
+		2, 37, 37, 37, 37, 37, 37,		\
+	140, 44, 7,		\
+		33, 33, 20, 33, 33, 33, 21,		\
+	3, 112, 6,		\
+		1, 18, 1, 1, 1, 1,		\
+	39, 104, 6,		\
+		1, 1, 15, 1, 1, 1,		\
+	39, 109, 6,		\
+		1, 1, 7, 33, 1, 1,		\
+	41, 85, 6,		\
+		39, 39, 39, 39, 39, 8,		\
+	49, 7, 6,		\
+		1, 1, 1, 1, 2, 1,		\
+	54, 25, 6,		\
+		1, 1, 14, 1, 1, 1,		\
+	78, 24, 6,		\
+		30, 1, 1, 1, 8, 1,		\
+	86, 33, 6,		\
+		1, 1, 1, 11, 1, 1,		\
+	86, 80, 6,		\
+		27, 1, 1, 1, 1, 1,		\
+	107, 48, 6,		\
+		30, 12, 2, 12, 12, 13,		\
+	129, 66, 6,		\
+		1, 1, 11, 1, 1, 1,		\
+	137, 79, 6,		\
+		30, 30, 30, 35, 30, 30,		\
+	140, 40, 6,		\
+		1, 1, 1, 1, 1, 11,		\
+	14, 16, 5,		\
+		1, 1, 1, 1, 19,		\
+	34, 13, 5,		\
+		1, 1, 1, 1, 22,		\
+	40, 27, 5,		\
+		18, 18, 0, 18, 18,		\
+	46, 24, 5,		\
+		16, 1, 1, 1, 31,		\
+	60, 122, 5,		\
+		25, 1, 20, 1, 1,		\
+	81, 30, 5,		\
+		1, 34, 1, 1, 1,		\
+	87, 110, 5,		\
+		5, 5, 5, 5, 5,		\
+	92, 28, 5,		\
+		1, 1, 1, 17, 1,		\
+	125, 118, 5,		\
+		17, 6, 17, 17, 17,		\
+	132, 39, 5,		\
+		1, 1, 1, 1, 1,		\
+	132, 109, 5,		\
+		1, 1, 27, 1, 1,		\
+	135, 60, 5,		\
+		1, 15, 1, 1, 1,		\
+	141, 52, 5,		\
+		33, 33, 3, 33, 33,		\
+	151, 46, 5,		\
+		33, 33, 33, 2, 33,		\
+	0, 0, 4,		\
+		0, 1, 1, 2,		\
+	34, 0, 4,		\
+		1, 1, 1, 6,		\
+	46, 46, 4,		\
+		1, 1, 1, 0,		\
+	61, 39, 4,		\
+		16, 5, 16, 38,		\
+	65, 117, 4,		\
+		6, 1, 1, 17,		\
+	72, 73, 4,		\
+		1, 1, 1, 37,		\
+	80, 99, 4,		\
+		1, 1, 1, 1,		\
+	100, 20, 4,		\
+		2, 1, 1, 1,		\
+	109, 51, 4,		\
+		12, 2, 12, 12,		\
+	113, 40, 4,		\
+		24, 1, 1, 1,		\
+	113, 45, 4,		\
+		1, 12, 1, 1,		\
+	118, 69, 4,		\
+		1, 1, 39, 1,		\
+	120, 123, 4,		\
+		23, 17, 17, 17,		\
+	121, 46, 4,		\
+		21, 1, 1, 1,		\
+	121, 51, 4,		\
+		1, 1, 35, 1,		\
+	131, 45, 4,		\
+		19, 19, 19, 19,		\
+	138, 36, 4,		\
+		1, 1, 1, 31,		\
+	3, 7, 3,		\
+		1, 1, 9,		\
+	35, 78, 3,		\
+		30, 1, 31,		\
+	0x12, 38, 81, 3,		\
+		1, 1, 1,		\
+	0x12, 56, 19, 3,		\
+		3, 1, 1,		\
+	0x16, 0x0e, 0x00, 59, 72,		\
+	0x12, 63, 51, 3,		\
+		28, 16, 16,		\
+	0x07, 15, 78, 38, 3,		\
+		22, 1, 1,		\
+	90, 92, 3,		\
+		21, 1, 1,		\
+	99, 98, 3,		\
+		20, 2, 2,		\
+	117, 87, 3,		\
+		37, 37, 7,		\
+	123, 112, 3,		\
+		18, 1, 1,		\
+	137, 67, 3,		\
+		30, 30, 16,		\
+	146, 16, 3,		\
+		1, 1, 15,		\
+	156, 89, 3,		\
+		1, 1, 4,		\
+	157, 53, 3,		\
+		18, 26, 18,		\
+	0, 21, 2,		\
+		1, 19,		\
+	1, 93, 2,		\
+		8, 1,		\
+	13, 0, 2,		\
+		3, 4,		\
+	15, 27, 2,		\
+		1, 17,		\
+	18, 111, 2,		\
+		34, 1,		\
+	29, 88, 2,		\
+		1, 6,		\
+	0x12, 31, 8, 2,		\
+		2, 1,		\
+	0x12, 42, 90, 2,		\
+		39, 34,		\
+	0x12, 46, 20, 2,		\
+		1, 32,		\
+	0x07, 8, 52, 75, 2,		\
+		23, 1,		\
+	53, 38, 2,		\
+		1, 9,		\
+	65, 65, 2,		\
+		13, 31,		\
+	65, 106, 2,		\
+		0, 1,		\
+	70, 4, 2,		\
+		16, 11,		\
+	84, 29, 2,		\
+		1, 10,		\
+	88, 55, 2,		\
+		12, 12,		\
+	97, 92, 2,		\
+		2, 24,		\
+	0x16, 0x3c, 0x00, 118, 56,		\
+	0x16, 0x35, 0x00, 129, 70,		\
+	0x12, 133, 11, 2,		\
+		12, 16,		\
+	0x12, 133, 26, 2,		\
+		2, 2,		\
+	0x07, 4, 135, 20, 2,		\
+		2, 20,		\
+	135, 33, 2,		\
+		13, 2,		\
+	135, 88, 2,		\
+		25, 37,		\
+	153, 121, 2,		\
+		1, 1,		\
+	0x16, 0x1c, 0x00, 156, 99,		\
+	0x13, 48, 7, 14,		\
+		1, 1, 14, 1, 1, 1, 1, 1, 1, 7, 1, 1, 1, 1,		\
+	0x07, 103, 143, 79, 13,		\
+		30, 1, 1, 1, 1, 1, 16, 1, 1, 1, 1, 1, 1,		\
+	79, 88, 12,		\
+		1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1,		\
+	102, 87, 12,		\
+		2, 2, 2, 2, 2, 39, 2, 2, 2, 2, 2, 2,		\
+	28, 101, 11,		\
+		6, 1, 1, 1, 1, 1, 29, 1, 1, 1, 1,		\
+	107, 15, 11,		\
+		17, 12, 12, 12, 12, 12, 12, 21, 12, 12, 12,		\
+	123, 76, 11,		\
+		1, 1, 1, 1, 1, 5, 1, 1, 1, 1, 1,		\
+	13, 7, 10,		\
+		1, 1, 1, 9, 1, 1, 1, 1, 1, 1,		\
+	72, 101, 10,		\
+		5, 30, 5, 5, 5, 25, 5, 5, 5, 5,		\
+	91, 1, 10,		\
+		1, 1, 1, 1, 1, 1, 19, 1, 1, 1,		\
+	131, 109, 10,		\
+		1, 1, 1, 1, 0, 1, 11, 1, 1, 1,		\
+	159, 80, 10,		\
+		1, 1, 1, 1, 8, 1, 1, 1, 1, 1,		\
+	12, 27, 9,		\
+		1, 1, 1, 1, 1, 21, 1, 1, 1,		\
+	30, 73, 9,		\
+		1, 1, 1, 1, 29, 1, 1, 1, 1,		\
+	59, 4, 9,		\
+		1, 1, 18, 1, 1, 1, 1, 19, 1,		\
+	53, 28, 8,		\
+		1, 1, 1, 1, 1, 17, 1, 1,		\
+	97, 26, 8,		\
+		1, 8, 1, 1, 1, 9, 1, 1,		\
+	124, 116, 8,		\
+		4, 37, 17, 17, 17, 17, 16, 17,		\
+	129, 7, 8,		\
+		12, 23, 12, 12, 12, 12, 13, 12,		\
+	145, 16, 8,		\
+		1, 1, 6, 1, 1, 1, 1, 23,		\
+	149, 16, 8,		\
+		1, 1, 26, 1, 1, 2, 1, 1,		\
+	7, 66, 7,		\
+		1, 14, 1, 1, 1, 30, 1,		\
+	19, 63, 7,		\
+		31, 31, 31, 31, 11, 31, 31,		\
+	27, 10, 7,		\
+		12, 1, 1, 1, 1, 1, 1,		\
+	39, 14, 7,		\
+		18, 18, 18, 18, 18, 18, 25,		\
+	47, 91, 7,		\
+		39, 39, 39, 20, 39, 39, 39,		\
+	96, 92, 7,		\
+		2, 2, 2, 2, 20, 2, 2,		\
+	99, 67, 7,		\
+		1, 1, 1, 1, 1, 34, 1,		\
+	116, 87, 7,		\
+		37, 37, 37, 34, 37, 37, 21,		\
+	155, 121, 7,		\
+		1, 1, 0, 1, 1, 1, 1,		\
+	158, 99, 7,		\
+		2, 2, 2, 23, 2, 2, 2,		\
+	11, 105, 6,		\
+		37, 1, 1, 1, 1, 1,		\
+	21, 30, 6,		\
+		31, 31, 19, 31, 31, 31,		\
+	33, 8, 6,		\
+		1, 24, 1, 1, 1, 1,		\
+	44, 112, 6,		\
+		1, 1, 38, 1, 1, 1,		\
+	55, 14, 6,		\
+		24, 1, 1, 1, 1, 1,		\
+	62, 74, 6,		\
+		1, 1, 1, 1, 34, 1,		\
+	66, 46, 6,		\
+		37, 16, 16, 16, 23, 16,		\
+	78, 46, 6,		\
+		16, 16, 16, 16, 15, 16,		\
+	84, 12, 6,		\
+		28, 28, 28, 28, 28, 28,		\
+	110, 2, 6,		\
+		12, 12, 12, 12, 12, 20,		\
+	117, 40, 6,		\
+		1, 2, 33, 1, 1, 1,		\
+	120, 46, 6,		\
+		1, 1, 0, 1, 1, 1,		\
+	121, 34, 6,		\
+		21, 21, 33, 21, 21, 21,		\
+	135, 122, 6,		\
+		1, 1, 1, 11, 1, 1,		\
+	140, 52, 6,		\
+		33, 33, 33, 33, 33, 14,		\
+	6, 17, 5,		\
+		1, 1, 31, 1, 1,		\
+	20, 97, 5,		\
+		3, 1, 1, 1, 1,		\
+	39, 65, 5,		\
+		31, 31, 31, 38, 31,		\
+	45, 2, 5,		\
+		1, 7, 1, 11, 1,		\
+	54, 75, 5,		\
+		1, 1, 1, 36, 1,		\
+	56, 85, 5,		\
+		39, 39, 31, 39, 39,		\
+	90, 66, 5,		\
+		1, 1, 20, 1, 1,		\
+	97, 1, 5,		\
+		11, 11, 11, 11, 17,		\
+	106, 111, 5,		\
+		21, 12, 21, 21, 21,		\
+	108, 51, 5,		\
+		12, 4, 12, 12, 12,		\
+	114, 83, 5,		\
+		2, 38, 2, 17, 9,		\
+	118, 101, 5,		\
+		7, 37, 37, 37, 37,		\
+	137, 32, 5,		\
+		15, 1, 1, 1, 1,		\
+	159, 106, 5,		\
+		35, 35, 35, 35, 21,		\
+	0, 93, 4,		\
+		1, 1, 1, 39,		\
+	12, 112, 4,		\
+		17, 1, 1, 1,		\
+	20, 83, 4,		\
+		1, 1, 1, 38,		\
+	22, 123, 4,		\
+		1, 4, 1, 1,		\
+	24, 39, 4,		\
+		35, 19, 19, 19,		\
+	26, 1, 4,		\
+		1, 1, 1, 0,		\
+	32, 28, 4,		\
+		19, 19, 19, 29,		\
+	49, 66, 4,		\
+		31, 31, 34, 31,		\
+	53, 86, 4,		\
+		31, 39, 39, 39,		\
+	60, 32, 4,		\
+		26, 1, 1, 1,		\
+	61, 42, 4,		\
+		16, 16, 16, 16,		\
+	64, 57, 4,		\
+		30, 1, 1, 1,		\
+	70, 42, 4,		\
+		3, 3, 18, 3,		\
+	94, 42, 4,		\
+		3, 3, 2, 3,		\
+	101, 79, 4,		\
+		13, 1, 1, 3,		\
+	112, 79, 4,		\
+		1, 14, 1, 1,		\
+	124, 57, 4,		\
+		15, 1, 1, 1,		\
+	129, 124, 4,		\
+		17, 17, 17, 15,		\
+	137, 96, 4,		\
+		2, 2, 2, 10,		\
+	144, 76, 4,		\
+		8, 30, 30, 30,		\
+	145, 53, 4,		\
+		33, 33, 33, 11,		\
+	153, 24, 4,		\
+		1, 1, 1, 20,		\
+	26, 70, 3,		\
+		11, 31, 31,		\
+	29, 43, 3,		\
+		8, 2, 2,		\
+	42, 32, 3,		\
+		19, 19, 4,		\
+	44, 101, 3,		\
+		10, 1, 1,		\
+	45, 14, 3,		\
+		18, 18, 30,		\
+	55, 98, 3,		\
+		1, 10, 1,		\
+	81, 31, 3,		\
+		1, 1, 10,		\
+	98, 37, 3,		\
+		12, 37, 12,		\
+	108, 15, 3,		\
+		12, 4, 12,		\
+	113, 94, 3,		\
+		37, 37, 9,		\
+	115, 15, 3,		\
+		5, 12, 8,		\
+	132, 15, 3,		\
+		12, 12, 2,		\
+	147, 93, 3,		\
+		1, 15, 1,		\
+	155, 41, 3,		\
+		33, 38, 33,		\
+	2, 49, 2,		\
+		25, 1,		\
+	9, 25, 2,		\
+		31, 1,		\
+	33, 110, 2,		\
+		20, 1,		\
+	38, 73, 2,		\
+		30, 1,		\
+	49, 101, 2,		\
+		1, 19,		\
+	58, 63, 2,		\
+		31, 0,		\
+	61, 25, 2,		\
+		1, 6,		\
+	65, 98, 2,		\
+		1, 10,		\
+	0x13, 69, 14, 2,		\
+		1, 1,		\
+	0x07, 3, 72, 40, 2,		\
+		0, 33,		\
+	78, 4, 2,		\
+		1, 5,		\
+	83, 4, 2,		\
+		11, 1,		\
+	0x16, 0x17, 0x00, 84, 1,		\
+	0x13, 87, 63, 2,		\
+		1, 12,		\
+	0x07, 7, 92, 75, 2,		\
+		23, 1,		\
+	102, 32, 2,		\
+		13, 1,		\
+	107, 85, 2,		\
+		2, 35,		\
+	115, 61, 2,		\
+		35, 1,		\
+	146, 45, 2,		\
+		33, 33,		\
+	151, 44, 2,		\
+		33, 7,		\
+	156, 58, 2,		\
+		20, 33,		\
+	0x01, 0, 84, 4,		\
+	0x21, 129, 26,		\
+	0x01, 1, 71, 5,		\
+	0x01, 2, 122, 76,		\
+	0x01, 3, 2, 36,		\
+	0x21, 75, 127,		\
+	0x01, 5, 27, 0,		\
+	0x21, 97, 62,		\
+	0x01, 6, 136, 0,		\
+	0x01, 7, 73, 0,		\
+	0x01, 8, 34, 54,		\
+	0x21, 47, 13,		\
+	0x01, 12, 76, 56,		\
+	0x21, 128, 106,		\
+	0x01, 13, 53, 3,		\
+	0x01, 14, 11, 97,		\
+	0x21, 67, 100,		\
+	0x01, 15, 75, 100,		\
+	0x07, 10, 16, 44, 61,		\
+	17, 92, 25,		\
+	18, 72, 72,		\
+	21, 63, 52,		\
+	22, 117, 113,		\
+	23, 59, 71,		\
+	24, 92, 10,		\
+	26, 74, 65,		\
+	30, 7, 62,		\
+	32, 13, 54,		\
+	0x21, 26, 118,		\
+	0x21, 108, 66,		\
+	0x01, 33, 30, 127,		\
+	0x07, 4, 36, 81, 61,		\
+	37, 115, 87,		\
+	38, 68, 71,		\
+	39, 12, 82,		\
+	0xff
+
+#endif  //  UI_H_INCLUDED
+
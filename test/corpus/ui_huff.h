@@ -0,0 +1,230 @@
+/*
+ *  ST7735 Huffman Coded Image (draw with drawHuffImage())
+ *  Original: ui.png
+ *  Commands: 4508 bytes, coded: 3228 (code tables and bitstream); total 3309 vs. 4608 bytes
+ */
+
+#ifndef UI_HUFF_H_INCLUDED
+#define UI_HUFF_H_INCLUDED
+
+#define UI_WIDTH		160
+#define UI_HEIGHT		128
+#define UI_HUFF_LEN		3309	/*  Total array size  */
+
+#define UI_HUFF		\
+	40,		\
+	0xe2, 0x91,	0x71, 0x9a,	0x77, 0xee,	0x52, 0xd2,		\
+	0x20, 0xc9,	0xf5, 0x0e,	0x09, 0x82,	0x50, 0xfd,		\
+	0xac, 0xb4,	0xcb, 0xd4,	0xdf, 0x68,	0x49, 0x93,		\
+	0xef, 0x14,	0xce, 0x49,	0xef, 0xe9,	0x8e, 0x89,		\
+	0x82, 0x4b,	0xbf, 0xe5,	0x58, 0x02,	0xa4, 0x0a,		\
+	0x02, 0x37,	0x50, 0x66,	0x6c, 0xf8,	0x6b, 0xc3,		\
+	0xcf, 0x41,	0x93, 0x39,	0x09, 0xab,	0xa6, 0xf9,		\
+	0xfb, 0xb5,	0x15, 0x65,	0x95, 0x00,	0x42, 0xdf,		\
+	0xb7, 0xd6,	0x92, 0x44,	0xe0, 0xc2,	0x2e, 0x94,		\
+	0x7a, 0x71,	0xd3, 0xdc,	0x7b, 0xca,	0x83, 0xc1,		\
+	0x00, 0x01, 0x04, 0x03, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x01, 0x07, 0x22,	\
+	0x25, 0x02, 0x03, 0x21, 0x23, 0x12, 0x13, 0x15, 0xff, 0x00, 0x00, 0x00, 0x03, 0x04, 0x06, 0x21,	\
+	0x45, 0x1b, 0x0c, 0x03, 0x02, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c,	\
+	0x0d, 0x0f, 0x00, 0x01, 0x0e, 0x10, 0x11, 0x13, 0x14, 0x19, 0x1b, 0x1f, 0x27, 0x28, 0x2d, 0x2e,	\
+	0x36, 0x3d, 0x3f, 0x41, 0x42, 0x4c, 0x54, 0x58, 0x5a, 0x5c, 0x5d, 0x62, 0x64, 0x65, 0x6b, 0x74,	\
+	0x76, 0x87, 0x89, 0x12, 0x15, 0x16, 0x17, 0x18, 0x1a, 0x1c, 0x1d, 0x1e, 0x20, 0x21, 0x22, 0x24,	\
+	0x25, 0x26, 0x29, 0x2a, 0x2c, 0x32, 0x33, 0x34, 0x35, 0x37, 0x39, 0x3b, 0x3c, 0x3e, 0x43, 0x45,	\
+	0x46, 0x47, 0x48, 0x49, 0x4b, 0x4f, 0x50, 0x51, 0x52, 0x53, 0x55, 0x57, 0x59, 0x5b, 0x5e, 0x61,	\
+	0x63, 0x66, 0x67, 0x68, 0x6a, 0x6c, 0x6d, 0x6e, 0x6f, 0x70, 0x71, 0x75, 0x77, 0x78, 0x79, 0x7a,	\
+	0x7b, 0x7f, 0x81, 0x82, 0x83, 0x8c, 0x92, 0x9c, 0x23, 0x2b, 0x2f, 0x30, 0x31, 0x38, 0x3a, 0x40,	\
+	0x4a, 0x4d, 0x4e, 0x56, 0x60, 0x72, 0x73, 0x7c, 0x7d, 0x84, 0x85, 0x8a, 0x8f, 0x91, 0x93, 0x97,	\
+	0x99, 0x9d, 0x9e, 0x44, 0x5f, 0x69, 0x80, 0x88, 0x8d, 0x90, 0x95, 0x96, 0x98, 0x9b, 0x9f, 0x7e,	\
+	0x9a, 0xa6, 0x8e, 0x94, 0x01, 0x00, 0x00, 0x02, 0x03, 0x0a, 0x09, 0x0d, 0x02, 0x00, 0x00, 0x00,	\
+	0x01, 0x02, 0x0c, 0x10, 0x1f, 0x27, 0x05, 0x0b, 0x11, 0x12, 0x13, 0x15, 0x1e, 0x21, 0x23, 0x25,	\
+	0x00, 0x03, 0x08, 0x09, 0x0a, 0x0f, 0x14, 0x16, 0x19, 0x04, 0x06, 0x07, 0x0d, 0x0e, 0x17, 0x1a,	\
+	0x1c, 0x1d, 0x20, 0x22, 0x24, 0x26, 0x18, 0x1b, 0x3a, 0x41, 0x6b, 0x70, 0x16, 0x63, 0x2b, 0x18,	\
+	0xc3, 0x56, 0x8d, 0x92, 0x2e, 0xf7, 0xb5, 0xc9, 0x32, 0x97, 0xce, 0xc9, 0xbd, 0xdc, 0x66, 0x37,	\
+	0xba, 0x89, 0x82, 0x5f, 0x18, 0x11, 0xf3, 0xf8, 0x70, 0x0b, 0x98, 0xa6, 0x0b, 0xd2, 0xb6, 0x8d,	\
+	0x8e, 0xc3, 0x2f, 0xbb, 0xd1, 0xac, 0x7e, 0xd8, 0xcc, 0x5a, 0x58, 0x30, 0x1f, 0x78, 0x42, 0x73,	\
+	0xee, 0x9c, 0x03, 0x32, 0x45, 0x27, 0x8e, 0x11, 0x7b, 0xf6, 0x48, 0x6e, 0xdc, 0x7c, 0xa7, 0x32,	\
+	0x7d, 0x7d, 0x01, 0x66, 0xcb, 0xbe, 0xc0, 0xfc, 0x7d, 0x4a, 0x15, 0xe5, 0x80, 0xad, 0xef, 0xb5,	\
+	0x31, 0xb7, 0x34, 0x0e, 0x54, 0xea, 0xc1, 0x79, 0x92, 0xc5, 0x14, 0xd6, 0x05, 0x2a, 0x4e, 0x13,	\
+	0xfd, 0x63, 0x28, 0x1f, 0xcc, 0xd4, 0x06, 0xb4, 0xc0, 0x3f, 0xb3, 0x40, 0x4b, 0x63, 0x44, 0xc1,	\
+	0x06, 0xc0, 0x80, 0xbb, 0x2a, 0x7b, 0x65, 0x6f, 0xaa, 0x72, 0x16, 0x65, 0x8b, 0x3c, 0xca, 0xcb,	\
+	0x9c, 0x0b, 0x6a, 0xed, 0x01, 0x6c, 0xd0, 0x02, 0x34, 0xa9, 0xf9, 0x56, 0xa6, 0xfc, 0xe3, 0xb2,	\
+	0x56, 0xa4, 0x74, 0x09, 0xbf, 0x1e, 0xad, 0x52, 0xf7, 0x67, 0x55, 0x55, 0x1a, 0x38, 0xa4, 0xd5,	\
+	0x1b, 0x67, 0x49, 0x63, 0xfa, 0xf5, 0x49, 0x8e, 0xe9, 0x44, 0xa6, 0xce, 0xd2, 0xc3, 0xeb, 0x92,	\
+	0x07, 0xa7, 0xa6, 0x06, 0x3c, 0x28, 0xe2, 0xb9, 0x37, 0x09, 0xca, 0xe6, 0xa8, 0x70, 0x06, 0x35,	\
+	0xed, 0xf0, 0x2a, 0xe6, 0xfe, 0xf7, 0xe4, 0xcb, 0x3f, 0x65, 0xcb, 0x23, 0xd9, 0x00, 0xe8, 0xee,	\
+	0xc3, 0x23, 0xfd, 0x2e, 0xc8, 0x7e, 0x71, 0x8e, 0x1f, 0xdd, 0xd9, 0x01, 0xc7, 0x22, 0xea, 0xb4,	\
+	0xae, 0x25, 0xd2, 0x4a, 0xfe, 0x77, 0x42, 0x42, 0x06, 0xcb, 0xa7, 0x35, 0xa6, 0x04, 0x23, 0xbf,	\
+	0xfd, 0x5b, 0xcf, 0x8c, 0x4d, 0x32, 0xac, 0x94, 0xc4, 0x76, 0xe5, 0x88, 0xb8, 0x38, 0x45, 0x90,	\
+	0x76, 0x2a, 0xaa, 0x34, 0xad, 0x55, 0x7d, 0x04, 0xd8, 0x7b, 0xa0, 0xaa, 0xea, 0x76, 0x2b, 0x75,	\
+	0xd8, 0xe0, 0x7a, 0x76, 0xcd, 0x57, 0x67, 0xe3, 0x5c, 0xca, 0xf1, 0x3c, 0xd6, 0x27, 0xc8, 0xdf,	\
+	0x61, 0x7c, 0x28, 0xcf, 0x4c, 0x3c, 0x8e, 0x52, 0xd2, 0xf6, 0xf0, 0x7f, 0x8c, 0xd5, 0xd7, 0x69,	\
+	0x9e, 0xba, 0xc2, 0x91, 0xef, 0xda, 0x82, 0xcb, 0x0e, 0xb2, 0x59, 0xb4, 0x94, 0x77, 0x55, 0x79,	\
+	0xee, 0x8f, 0xe9, 0x60, 0xee, 0xbf, 0x6e, 0x67, 0x27, 0x93, 0x12, 0xdc, 0x73, 0x64, 0xaa, 0xb7,	\
+	0xb6, 0x31, 0xaa, 0xfd, 0xfb, 0xcb, 0x29, 0xe2, 0x49, 0xdb, 0xd4, 0x55, 0x2b, 0xd6, 0x71, 0xd6,	\
+	0x96, 0x19, 0x2a, 0xa7, 0xf4, 0xc2, 0x56, 0x69, 0x0d, 0x0b, 0xb4, 0x6a, 0xd8, 0xf7, 0x11, 0xdb,	\
+	0x9a, 0x6d, 0x7b, 0x63, 0x6e, 0xee, 0x36, 0x35, 0x2c, 0x72, 0x71, 0xa2, 0xd0, 0xeb, 0x78, 0xdb,	\
+	0x30, 0x67, 0x5b, 0x49, 0x4e, 0xa4, 0x64, 0xa4, 0xee, 0xc6, 0xae, 0x15, 0x79, 0xd5, 0x69, 0x58,	\
+	0x16, 0x27, 0x51, 0x09, 0x4c, 0x64, 0xa2, 0xae, 0x49, 0x36, 0xe1, 0x82, 0x84, 0xd4, 0xdb, 0x6c,	\
+	0x53, 0x2a, 0xd6, 0x35, 0x27, 0xea, 0x1e, 0xa6, 0x69, 0xd4, 0xb0, 0x68, 0x2e, 0x33, 0xad, 0x5d,	\
+	0x86, 0x06, 0x52, 0x10, 0xfa, 0x6b, 0x71, 0x8f, 0x9c, 0xdc, 0x6a, 0x5b, 0xb7, 0x1b, 0x1d, 0x30,	\
+	0xad, 0x55, 0xdd, 0x68, 0x75, 0x71, 0x99, 0x48, 0x58, 0x15, 0x80, 0xd1, 0x02, 0xd8, 0x78, 0x4e,	\
+	0x8d, 0x8c, 0xc5, 0x4a, 0xa4, 0xb5, 0x4a, 0x09, 0x30, 0x3f, 0xf6, 0xb8, 0x58, 0x61, 0xe0, 0x39,	\
+	0x7b, 0x94, 0x4a, 0x45, 0xdf, 0x39, 0xe3, 0xc9, 0x15, 0xf1, 0xa2, 0x55, 0x04, 0xd8, 0x6e, 0x03,	\
+	0x77, 0xd6, 0xe0, 0x1f, 0x65, 0x37, 0x0f, 0x5d, 0x79, 0x27, 0xe6, 0xa9, 0x8f, 0xdd, 0xca, 0x48,	\
+	0x51, 0xe0, 0xa9, 0xe3, 0x9a, 0xa0, 0xcb, 0xb1, 0x31, 0xb9, 0x2f, 0x8c, 0x6f, 0xb6, 0xf9, 0x8c,	\
+	0xa3, 0xf2, 0x3b, 0xbf, 0x50, 0xa5, 0xeb, 0x41, 0x4b, 0xef, 0xd0, 0xe5, 0x05, 0xda, 0x47, 0x01,	\
+	0x04, 0x79, 0x1a, 0x29, 0x1a, 0x31, 0x92, 0x3f, 0xff, 0x31, 0x22, 0xf6, 0x78, 0x2d, 0x6b, 0xbc,	\
+	0xb0, 0x5e, 0x4f, 0x58, 0x24, 0x55, 0x02, 0xcb, 0xc4, 0x40, 0xe7, 0x5b, 0x20, 0x7b, 0x5c, 0x0a,	\
+	0x3b, 0xb3, 0xc5, 0x0d, 0x75, 0x41, 0x57, 0x72, 0x48, 0xcf, 0x64, 0x82, 0xb1, 0x69, 0x11, 0xb1,	\
+	0x32, 0x55, 0x08, 0xd3, 0x55, 0x0e, 0x1c, 0xc3, 0x15, 0x36, 0xa0, 0xac, 0x04, 0x09, 0xf0, 0xa2,	\
+	0x1c, 0x65, 0x4c, 0x13, 0xec, 0xd9, 0xa8, 0x14, 0x61, 0xa8, 0x1d, 0x6f, 0xd4, 0x04, 0xcc, 0x22,	\
+	0x7a, 0xa0, 0x26, 0x0f, 0x80, 0x8b, 0x01, 0xd1, 0x16, 0x1e, 0x09, 0x17, 0x0d, 0xc9, 0x17, 0x2f,	\
+	0x80, 0x8b, 0xa2, 0xe8, 0x8b, 0xa7, 0x20, 0x13, 0xd3, 0x8a, 0x90, 0xa7, 0xc8, 0x90, 0xfe, 0xd5,	\
+	0x48, 0x77, 0xb2, 0x84, 0xcf, 0xa7, 0x98, 0x73, 0x9d, 0x89, 0xb9, 0xe8, 0x09, 0xa9, 0xc3, 0x30,	\
+	0xcc, 0xcb, 0x40, 0x73, 0x63, 0x02, 0x3a, 0xa8, 0x20, 0x1a, 0xf3, 0x01, 0xd4, 0xe0, 0x12, 0x82,	\
+	0xd8, 0x0f, 0x16, 0x70, 0x1f, 0x24, 0x8e, 0x19, 0xef, 0x48, 0x64, 0x72, 0x10, 0xcd, 0x7a, 0x43,	\
+	0x47, 0x18, 0x0f, 0x6d, 0x24, 0xc1, 0x2e, 0xbc, 0xc1, 0xf8, 0x5c, 0x0c, 0x88, 0x82, 0x3d, 0xec,	\
+	0xc1, 0x18, 0x35, 0x62, 0x35, 0x34, 0xc4, 0x46, 0x60, 0x11, 0xd0, 0x41, 0x02, 0x79, 0x05, 0xfd,	\
+	0xb1, 0x04, 0x5a, 0x00, 0x58, 0xdc, 0x40, 0x59, 0x84, 0x41, 0x2a, 0x48, 0x16, 0xbe, 0x60, 0x17,	\
+	0x4e, 0x80, 0x17, 0xef, 0x58, 0x40, 0x67, 0xb7, 0x6a, 0xc9, 0xee, 0xa6, 0xfb, 0x26, 0x66, 0xe6,	\
+	0xb5, 0x54, 0xf2, 0x28, 0xa4, 0xa4, 0x6f, 0xa0, 0x68, 0x50, 0x05, 0x3f, 0x4a, 0x00, 0x44, 0xee,	\
+	0x55, 0x56, 0x26, 0xef, 0x85, 0x52, 0x8e, 0xb6, 0x6b, 0xf6, 0x53, 0x2a, 0xf6, 0xa8, 0xdb, 0x4b,	\
+	0x38, 0x2f, 0x96, 0xfa, 0xa6, 0xa2, 0xcb, 0x71, 0x95, 0x6e, 0x93, 0x6d, 0x01, 0xcf, 0xb4, 0xc8,	\
+	0xad, 0xd2, 0x07, 0x34, 0xcf, 0x0b, 0x60, 0xf8, 0x2e, 0x0d, 0xb9, 0xd6, 0x39, 0x6b, 0xdb, 0x18,	\
+	0xbe, 0x5c, 0x8a, 0x86, 0xeb, 0x27, 0x1e, 0xa5, 0x04, 0xf2, 0xa0, 0xa4, 0x37, 0x6f, 0x88, 0xba,	\
+	0xaa, 0x84, 0xdb, 0x4a, 0x20, 0x28, 0x78, 0x8e, 0x1f, 0x2a, 0x22, 0x5f, 0x04, 0x01, 0x1e, 0xdc,	\
+	0x15, 0xe0, 0x93, 0xd5, 0xae, 0xe0, 0x36, 0x36, 0xeb, 0xc7, 0x3b, 0x37, 0x4a, 0x79, 0x94, 0xbf,	\
+	0x5d, 0xb4, 0x98, 0xef, 0x1e, 0x41, 0xc8, 0xbe, 0x6b, 0x53, 0xb6, 0xb3, 0x1a, 0x92, 0xe6, 0x4e,	\
+	0xec, 0xdc, 0x2d, 0x6b, 0x9e, 0x24, 0xd6, 0xd2, 0xc9, 0x50, 0xbd, 0x7d, 0xf5, 0x00, 0xb7, 0x87,	\
+	0x52, 0xb5, 0x17, 0x07, 0x3d, 0xca, 0x59, 0xee, 0x73, 0x9b, 0x95, 0xcf, 0xa5, 0x72, 0xba, 0xd4,	\
+	0x32, 0x3c, 0xd2, 0x81, 0x30, 0xb4, 0x40, 0xd9, 0x1f, 0x98, 0x89, 0xc3, 0xfe, 0x50, 0x25, 0x0a,	\
+	0x5e, 0x3e, 0x59, 0xbd, 0xcc, 0x82, 0xb2, 0x8d, 0x12, 0xf3, 0x10, 0xae, 0x2c, 0x15, 0x8f, 0x94,	\
+	0xf9, 0xc0, 0xc4, 0xbf, 0x6e, 0x10, 0xe0, 0x98, 0xd0, 0xdf, 0xac, 0x12, 0xe5, 0x20, 0x0a, 0xba,	\
+	0x88, 0xe5, 0x15, 0xe6, 0x3d, 0x98, 0xb5, 0x59, 0xb8, 0x51, 0x2f, 0xe2, 0xa8, 0x66, 0x6c, 0x8e,	\
+	0x7b, 0xc8, 0xca, 0x13, 0x7c, 0x75, 0x46, 0x0c, 0x45, 0xc2, 0xb2, 0xc0, 0x15, 0xb9, 0x82, 0x62,	\
+	0xae, 0xef, 0x98, 0x5b, 0xc6, 0x12, 0x3c, 0xbb, 0x68, 0xb6, 0x13, 0xf3, 0xed, 0xc6, 0x80, 0xce,	\
+	0x90, 0x86, 0xb6, 0x41, 0x14, 0x66, 0x14, 0x39, 0xd8, 0xc8, 0xa5, 0x5e, 0xb4, 0xfa, 0x7a, 0x94,	\
+	0xcb, 0xa3, 0xce, 0x6f, 0x3f, 0x29, 0xc8, 0xcd, 0xf9, 0x34, 0x9c, 0x4e, 0x29, 0x8b, 0x4a, 0x5b,	\
+	0x6a, 0xce, 0x9d, 0xb4, 0xe1, 0x38, 0x9a, 0x73, 0x51, 0xa4, 0x07, 0x76, 0xf7, 0xa2, 0xef, 0xcf,	\
+	0xe3, 0xb9, 0x44, 0x3b, 0x78, 0x10, 0xed, 0xae, 0x1a, 0x77, 0xaf, 0x6b, 0x9e, 0x43, 0xcd, 0x77,	\
+	0x81, 0x71, 0x5b, 0x8d, 0x91, 0x58, 0xda, 0x13, 0xa5, 0x29, 0x38, 0x8f, 0xd0, 0xdf, 0x3e, 0x1b,	\
+	0x7e, 0xf4, 0x26, 0x60, 0x73, 0x33, 0x1f, 0x29, 0x96, 0x90, 0x98, 0xcb, 0x8a, 0xc3, 0x2d, 0x17,	\
+	0x8f, 0x80, 0xbf, 0xff, 0x5b, 0x2e, 0xf2, 0x92, 0xde, 0x66, 0x8b, 0x76, 0xbf, 0x5b, 0xdc, 0xd5,	\
+	0x52, 0x68, 0xa1, 0xef, 0x14, 0xca, 0xc9, 0x53, 0x5e, 0x32, 0x8c, 0x67, 0xa6, 0xb3, 0xa1, 0x2f,	\
+	0x98, 0x4e, 0x1e, 0x42, 0x77, 0x78, 0x53, 0x4b, 0x85, 0x3f, 0x2d, 0xe4, 0xad, 0xbe, 0x87, 0x0f,	\
+	0x10, 0xe5, 0xba, 0x20, 0x65, 0xa3, 0x16, 0x2a, 0x26, 0x3a, 0x46, 0xec, 0x64, 0x6e, 0xd0, 0x46,	\
+	0x67, 0x23, 0x5d, 0xcb, 0x19, 0x95, 0x78, 0xad, 0xfb, 0x4d, 0x6a, 0xed, 0x83, 0x9c, 0xbc, 0x89,	\
+	0x29, 0x69, 0x77, 0x29, 0x33, 0xc1, 0xa2, 0x8c, 0xa4, 0x57, 0xc9, 0x9e, 0x5b, 0xe4, 0x65, 0x59,	\
+	0xbc, 0x7b, 0x19, 0xb0, 0x44, 0x7d, 0x11, 0x19, 0xe5, 0xdb, 0xc6, 0x8d, 0xc6, 0x03, 0x85, 0xbc,	\
+	0xfa, 0xad, 0x1b, 0x1f, 0xee, 0xba, 0x37, 0x7e, 0x1d, 0x64, 0x7a, 0x96, 0xaa, 0x37, 0x5e, 0xeb,	\
+	0x97, 0x1e, 0xec, 0xf2, 0x2b, 0xef, 0x9e, 0x0a, 0x9a, 0x69, 0xac, 0xf7, 0xc1, 0x56, 0xcb, 0x70,	\
+	0x16, 0xeb, 0xd7, 0x99, 0x78, 0x6f, 0x16, 0xc7, 0x32, 0xce, 0xb4, 0x95, 0x96, 0xca, 0xbc, 0xde,	\
+	0x75, 0x7a, 0xb7, 0x55, 0xa9, 0x58, 0xab, 0xc6, 0xaa, 0x58, 0x4c, 0x4f, 0xda, 0xc1, 0x2b, 0x4d,	\
+	0x46, 0x1b, 0xb4, 0x48, 0x32, 0x34, 0x56, 0x47, 0xde, 0xb9, 0x1b, 0x7c, 0xb6, 0xaa, 0x7b, 0x58,	\
+	0xea, 0x6e, 0x57, 0x5d, 0xe4, 0xfa, 0xba, 0xcd, 0x1f, 0x9f, 0x4a, 0x14, 0x87, 0xf0, 0x58, 0x0b,	\
+	0x5a, 0xd6, 0xb5, 0x2d, 0x67, 0x0a, 0x16, 0x09, 0xc8, 0x68, 0x05, 0x4f, 0x40, 0x1b, 0x9d, 0x93,	\
+	0x84, 0xf1, 0x11, 0xca, 0x22, 0x22, 0x22, 0x22, 0x23, 0xd2, 0x22, 0x14, 0xb6, 0x22, 0xfd, 0x00,	\
+	0x3a, 0x2f, 0x25, 0xf9, 0xd2, 0x14, 0xa5, 0x29, 0x4c, 0xe9, 0x4a, 0x53, 0xf2, 0x94, 0xa1, 0x4f,	\
+	0xca, 0x61, 0x03, 0x4e, 0x3a, 0x69, 0xa7, 0x6d, 0x34, 0xd1, 0x9b, 0x64, 0x05, 0x6b, 0x5a, 0xd6,	\
+	0xb7, 0x56, 0xb5, 0xad, 0x6b, 0xf9, 0x23, 0xd6, 0x80, 0xcf, 0x3c, 0xf3, 0xcf, 0x3c, 0xf7, 0xf6,	\
+	0xcf, 0x3c, 0xf3, 0xd7, 0xd2, 0xb2, 0x00, 0x3e, 0x0f, 0xf8, 0x5f, 0x7f, 0x0c, 0x24, 0x07, 0x6e,	\
+	0x41, 0x60, 0x06, 0x98, 0x24, 0xfa, 0x1e, 0xe0, 0xfb, 0xc8, 0xd4, 0x12, 0xb5, 0xad, 0xe2, 0xd6,	\
+	0xe9, 0x6b, 0x5a, 0xdd, 0x64, 0xf2, 0x10, 0xf3, 0xe6, 0xe7, 0xcd, 0xcf, 0x9b, 0xeb, 0x9b, 0x63,	\
+	0x40, 0xe1, 0x11, 0x11, 0x13, 0x11, 0x11, 0xd6, 0x28, 0x7b, 0x44, 0x98, 0x61, 0x86, 0x18, 0x61,	\
+	0x86, 0x18, 0x61, 0xf3, 0xd5, 0x5a, 0x25, 0x3f, 0xe9, 0x8b, 0xa6, 0x62, 0x66, 0x63, 0xaf, 0x44,	\
+	0xe1, 0xb6, 0xdb, 0x6d, 0xb6, 0xdc, 0xb6, 0xdb, 0x6d, 0xb6, 0xfb, 0x5b, 0x90, 0x98, 0x0e, 0x60,	\
+	0x75, 0xb0, 0x60, 0x0f, 0xd3, 0x62, 0x5b, 0x06, 0x0b, 0xef, 0xbe, 0xfa, 0x5f, 0x7d, 0xf7, 0xc7,	\
+	0xe3, 0x7c, 0x0c, 0x11, 0x9e, 0x79, 0xe6, 0x3d, 0x60, 0x88, 0xf1, 0xe3, 0xc7, 0x9f, 0x8f, 0x0e,	\
+	0xe6, 0x08, 0x9a, 0x8e, 0xa7, 0x66, 0x98, 0x8f, 0xa8, 0x6a, 0x1a, 0xed, 0x01, 0x07, 0xe8, 0x3c,	\
+	0x10, 0x2c, 0x71, 0xc7, 0x1c, 0x71, 0xc7, 0x55, 0x28, 0x90, 0x76, 0x0e, 0x03, 0xe8, 0x20, 0x55,	\
+	0xad, 0x6b, 0x5f, 0x6a, 0xd7, 0x06, 0xd8, 0x83, 0xe0, 0x04, 0x3b, 0xd0, 0x2a, 0x63, 0x4a, 0x52,	\
+	0x9f, 0x74, 0x87, 0x3c, 0x83, 0x40, 0x11, 0x62, 0x10, 0x00, 0xe1, 0xab, 0x38, 0x0a, 0xeb, 0xae,	\
+	0xc6, 0xeb, 0xae, 0xbb, 0x6a, 0xd8, 0x0a, 0x65, 0x84, 0xcc, 0xcd, 0x1c, 0xb0, 0x2f, 0x20, 0x1c,	\
+	0xab, 0x01, 0x7f, 0xe6, 0x66, 0x7e, 0xa6, 0x7a, 0x1f, 0x90, 0x3d, 0x03, 0x47, 0x4e, 0x60, 0x17,	\
+	0x32, 0xe0, 0x56, 0x20, 0x0f, 0x20, 0xfe, 0x55, 0x02, 0x0a, 0x03, 0xd9, 0xa0, 0x39, 0x87, 0xed,	\
+	0xa4, 0x91, 0x00, 0x7f, 0xf1, 0x9b, 0x80, 0xf9, 0x1e, 0x46, 0x7e, 0x88, 0x0f, 0x7e, 0xfd, 0x7b,	\
+	0xf7, 0xef, 0x2b, 0xc2, 0x21, 0x33, 0x33, 0x3f, 0x72, 0xe8, 0x80, 0xe1, 0x86, 0x18, 0x61, 0xe7,	\
+	0xab, 0xb8, 0x03, 0xf5, 0x75, 0xd9, 0x5d, 0x77, 0x52, 0x04, 0x25, 0x33, 0x9c, 0xfc, 0x6b, 0x04,	\
+	0x03, 0xd9, 0xdd, 0x9a, 0x20, 0x0a, 0xe3, 0x72, 0x80, 0x3b, 0x69, 0xf7, 0x26, 0xdc, 0x02, 0x66,	\
+	0x67, 0xe9, 0x34, 0x02, 0x22, 0x3a, 0xff, 0x4a, 0x80, 0x1e, 0x1f, 0x8b, 0x10, 0x0f, 0x9f, 0x9f,	\
+	0x1f, 0x3f, 0x30, 0x18, 0x64, 0xa0, 0x1c, 0x00, 0xf8, 0x94, 0xe3, 0x60, 0x0f, 0xb0, 0x2d, 0x5a,	\
+	0xaf, 0xc8, 0xe6, 0x2e, 0x0b, 0xe9, 0x4b, 0x7d, 0x5a, 0xdf, 0x56, 0xb5, 0xad, 0x6b, 0x5f, 0x26,	\
+	0xd9, 0x69, 0x99, 0x99, 0x9f, 0x59, 0x99, 0x9d, 0x99, 0x8b, 0x6f, 0xbe, 0xf7, 0xef, 0xbf, 0x4d,	\
+	0xf7, 0xdf, 0x7f, 0x14, 0x55, 0x6b, 0x5a, 0xe3, 0x5a, 0xd6, 0xb5, 0xae, 0x7c, 0x85, 0x7b, 0xf7,	\
+	0x3e, 0x41, 0xb0, 0xf5, 0x51, 0xb0, 0x2b, 0xb3, 0xb2, 0xae, 0xfb, 0xef, 0xbe, 0xff, 0x9b, 0xef,	\
+	0xbe, 0xf9, 0xf9, 0x2a, 0x77, 0x03, 0x57, 0x5d, 0xd2, 0x99, 0x65, 0x96, 0x59, 0x74, 0xb7, 0x7b,	\
+	0xbe, 0x92, 0xd4, 0x0f, 0xd0, 0xfa, 0x6b, 0x29, 0xe9, 0x11, 0x11, 0xf3, 0x11, 0x19, 0x17, 0xc9,	\
+	0xe3, 0x4a, 0x65, 0x4a, 0x52, 0x9e, 0x71, 0x4f, 0xb7, 0x4e, 0x9d, 0x7a, 0x74, 0xe8, 0x97, 0xe6,	\
+	0x48, 0x64, 0x3a, 0x71, 0x92, 0x5f, 0xb6, 0xdb, 0x6d, 0xb5, 0x3e, 0x34, 0x9f, 0xce, 0x83, 0xfa,	\
+	0x5d, 0x20, 0x7c, 0x19, 0xb1, 0x45, 0x6b, 0x5d, 0x6b, 0x5a, 0xd9, 0xbc, 0x46, 0x58, 0xe3, 0xdf,	\
+	0x1c, 0x71, 0xb8, 0xcb, 0x40, 0x1e, 0x2e, 0x29, 0x23, 0xc0, 0x0f, 0xbc, 0xa8, 0xad, 0x78, 0xf3,	\
+	0xad, 0x74, 0x85, 0x9a, 0x80, 0x33, 0xc6, 0xce, 0x46, 0x16, 0xb5, 0xad, 0x6b, 0x4b, 0xd3, 0x45,	\
+	0x29, 0x4a, 0x73, 0xa5, 0x27, 0x5e, 0x21, 0x33, 0xfb, 0x33, 0x3b, 0x49, 0x44, 0xcf, 0x79, 0x99,	\
+	0x9a, 0x34, 0x11, 0x7d, 0xe0, 0xfd, 0x66, 0x22, 0x37, 0xdf, 0x7d, 0xf7, 0xdf, 0xb2, 0xed, 0x1a,	\
+	0xeb, 0xdb, 0x5d, 0x75, 0xcc, 0x78, 0x0e, 0xc4, 0x1f, 0x6d, 0x1c, 0xea, 0x1f, 0x6e, 0x9c, 0xf4,	\
+	0xd4, 0xb9, 0xd1, 0x3d, 0xad, 0x6b, 0x5b, 0x97, 0x89, 0x07, 0x08, 0x42, 0x76, 0x73, 0xd8, 0x7a,	\
+	0x2b, 0x8f, 0xa0, 0xe4, 0xf4, 0xda, 0x1c, 0x5e, 0x7a, 0x73, 0x4f, 0xff, 0x05, 0x0f, 0x09, 0xf4,	\
+	0x98, 0x99, 0xf5, 0xe9, 0x8c, 0x72, 0xf1, 0x53, 0x30, 0xfa, 0x69, 0xa6, 0xda, 0x69, 0xd8, 0xfc,	\
+	0xe0, 0xbd, 0xb3, 0x73, 0x06, 0x56, 0xac, 0x18, 0x3b, 0xbf, 0x78, 0x6c, 0x71, 0xe1, 0x8e, 0x30,	\
+	0x6b, 0x8d, 0x41, 0x5c, 0x3e, 0x63, 0x78, 0x76, 0x33, 0xac, 0x8c, 0xfc, 0x1a, 0x5b, 0xc6, 0xba,	\
+	0xeb, 0xae, 0xba, 0x5d, 0x81, 0x86, 0x0f, 0x75, 0x23, 0x61, 0xe7, 0x86, 0x18, 0x7b, 0xdf, 0x18,	\
+	0x1e, 0xfd, 0xd3, 0x1f, 0xf2, 0x9e, 0x19, 0x9d, 0x47, 0xef, 0x7c, 0x6d, 0x75, 0xe3, 0xae, 0xbf,	\
+	0x58, 0x26, 0xd7, 0x5d, 0x63, 0x56, 0x8d, 0x0b, 0x81, 0x16, 0xad, 0x08, 0x79, 0xc1, 0x82, 0x43,	\
+	0x84, 0x37, 0xc5, 0x4b, 0xa9, 0xfd, 0x17, 0x88, 0xbc, 0xcc, 0x32, 0x72, 0x88, 0x6f, 0x9b, 0xae,	\
+	0x41, 0x39, 0xd1, 0x40, 0xdd, 0xbd, 0x29, 0x89, 0x9e, 0x17, 0xe5, 0xfe, 0x1c, 0x30, 0x09, 0x25,	\
+	0x2c, 0x62, 0x2c, 0xe4, 0xe7, 0x2f, 0x7c, 0x30, 0xc3, 0x96, 0x09, 0x66, 0x39, 0x6f, 0x48, 0xd9,	\
+	0xd7, 0x00, 0xb2, 0xcb, 0x2c, 0xbe, 0x36, 0xc4, 0x2a, 0x28, 0x13, 0x9f, 0x7b, 0xd0, 0x3a, 0x2b,	\
+	0x71, 0x9c, 0x23, 0xc6, 0xe4, 0x78, 0x98, 0x59, 0x22, 0x22, 0x5e, 0x8f, 0xcd, 0x29, 0xe8, 0xb8,	\
+	0x1e, 0xe4, 0xa9, 0x63, 0x99, 0xaf, 0x34, 0x7b, 0x44, 0x71, 0x69, 0x0e, 0xfb, 0xfa, 0x73, 0xf0,	\
+	0x0e, 0x25, 0x4c, 0x51, 0xd3, 0x4a, 0x76, 0xb7, 0x13, 0xaf, 0x76, 0x98, 0x9e, 0x5f, 0x7b, 0xf1,	\
+	0xc7, 0xe3, 0x16, 0x95, 0x60, 0xc9, 0xac, 0xc0, 0xe4, 0x61, 0xa0, 0x71, 0xf2, 0x65, 0xe0, 0x30,	\
+	0xaa, 0xdf, 0x0f, 0xc5, 0x8c, 0x90, 0x79, 0xbd, 0x48, 0x42, 0xea, 0x50, 0x5b, 0xf2, 0x0b, 0xa0,	\
+	0x7d, 0xdf, 0x65, 0x87, 0xba, 0xfe, 0xe0, 0x1c, 0xe2, 0xc5, 0x0f, 0x5a, 0xc5, 0xdb, 0x0e, 0x0c,	\
+	0x72, 0x0a, 0x5f, 0x22, 0xc4, 0x1d, 0x24, 0xe0, 0x04, 0xce, 0xb4, 0xb0, 0x8f, 0xf5, 0x2f, 0x18,	\
+	0x43, 0xa7, 0x1c, 0x1f, 0x7f, 0x05, 0x82, 0x69, 0xf0, 0xaf, 0x08, 0x8a, 0x6e, 0x82, 0x3b, 0x53,	\
+	0xb4, 0x0f, 0x58, 0xa7, 0x24, 0x3c, 0x6f, 0xf6, 0xe5, 0x03, 0xbb, 0x5c, 0x22, 0x3e, 0xf8, 0x50,	\
+	0xd8, 0xf6, 0x03, 0xd0, 0x1d, 0x1f, 0x96, 0x63, 0x1a, 0x02, 0x80, 0x66, 0x49, 0x5c, 0x08, 0x06,	\
+	0xc6, 0x92, 0xf1, 0x11, 0x11, 0x68, 0x88, 0x88, 0x8b, 0x09, 0xeb, 0x79, 0x83, 0xe8, 0x28, 0x32,	\
+	0xb6, 0x13, 0x33, 0x33, 0x39, 0xcc, 0xcf, 0x3c, 0x75, 0x81, 0x70, 0x18, 0x42, 0xa3, 0x98, 0x19,	\
+	0x33, 0xd5, 0xbb, 0x4b, 0xae, 0xbb, 0xc5, 0xd7, 0x5d, 0x76, 0xa3, 0x55, 0x40, 0xc8, 0x75, 0xee,	\
+	0xaa, 0x1c, 0x17, 0x8f, 0xf7, 0x35, 0x50, 0xe4, 0x05, 0xde, 0x28, 0x0c, 0xc5, 0x96, 0x52, 0x81,	\
+	0xf4, 0x18, 0x44, 0xa1, 0x88, 0x64, 0xbf, 0xb0, 0x48, 0x30, 0x35, 0xab, 0xd2, 0xe4, 0x39, 0x9e,	\
+	0xda, 0x29, 0xf2, 0xdf, 0x0c, 0x30, 0xc2, 0x98, 0x74, 0xa1, 0x33, 0xef, 0x33, 0x33, 0xeb, 0x3f,	\
+	0x36, 0xe9, 0x3c, 0xc3, 0xdf, 0xf9, 0x6e, 0x93, 0xe0, 0x81, 0x11, 0x90, 0xf6, 0x1a, 0x1c, 0xc4,	\
+	0x45, 0x6b, 0x5a, 0xdf, 0x5a, 0xbc, 0x55, 0x12, 0x03, 0xe6, 0xc8, 0xc7, 0x1c, 0x71, 0xc7, 0x1f,	\
+	0x1e, 0x0d, 0x44, 0x5a, 0xd6, 0xed, 0x6b, 0x5b, 0xd5, 0x2d, 0x11, 0x11, 0x1d, 0xa2, 0x35, 0xf1,	\
+	0x50, 0x0f, 0xc5, 0x1d, 0x24, 0x6f, 0xbe, 0xff, 0x9b, 0xef, 0x9f, 0xf9, 0xca, 0x83, 0x80, 0x7e,	\
+	0x35, 0xd1, 0x11, 0x1e, 0xf1, 0x10, 0xb7, 0xe8, 0x7d, 0xc1, 0x57, 0x64, 0x7a, 0xd7, 0x2a, 0xd6,	\
+	0xb6, 0x89, 0x3b, 0xfc, 0x17, 0x7c, 0x07, 0x3f, 0x86, 0x03, 0x63, 0xff, 0x81, 0x89, 0xe6, 0x38,	\
+	0x7e, 0x23, 0x41, 0x3e, 0xf4, 0xa5, 0x3d, 0xe9, 0xe8, 0x82, 0x7a, 0x52, 0x94, 0xeb, 0x49, 0x0b,	\
+	0x9f, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0x78, 0x0f, 0x33, 0x33, 0x3d, 0xb8, 0x9f, 0x9d, 0x1a,	\
+	0x8e, 0x48, 0x27, 0x38, 0x0e, 0x5b, 0x53, 0xe7, 0x9e, 0xb9, 0xe7, 0x9d, 0x3e, 0x63, 0x8b, 0xce,	\
+	0xcb, 0xe3, 0xeb, 0xae, 0xba, 0xeb, 0xec, 0x77, 0x06, 0x2a, 0x3a, 0xd6, 0x37, 0x10, 0x7d, 0x14,	\
+	0xd5, 0xad, 0x7f, 0xab, 0x00, 0x0c, 0xf4, 0x5e, 0x85, 0x96, 0x61, 0xfa, 0xf1, 0xe8, 0x9a, 0xd6,	\
+	0xad, 0xad, 0x2a, 0x31, 0x8e, 0xc6, 0xb3, 0x53, 0x5f, 0x7d, 0xf7, 0xe1, 0xb7, 0xbe, 0x6c, 0xe7,	\
+	0x3c, 0xf3, 0xdc, 0xbd, 0x34, 0xf9, 0x4c, 0xcf, 0xaf, 0x40, 0xd1, 0xfd, 0x18, 0x73, 0xa5, 0x3c,	\
+	0xde, 0x9b, 0xef, 0xbe, 0xf5, 0x2c, 0xcd, 0xd4, 0x3f, 0xdd, 0xb3, 0x6d, 0xb6, 0xdb, 0x66, 0xd2,	\
+	0x61, 0x0b, 0x2f, 0xc0, 0x58, 0x07, 0x5a, 0x04, 0x3f, 0xab, 0x39, 0xc9, 0xe4, 0x57, 0x3e, 0x2d,	\
+	0xb2, 0xcb, 0x2a, 0xf6, 0xa4, 0x38, 0x59, 0xd8, 0x16, 0x59, 0x65, 0xf5, 0xe2, 0x8c, 0x55, 0xaf,	\
+	0xe5, 0x6f, 0xfd, 0x25, 0x5b, 0x5a, 0xd8, 0x76, 0x65, 0xf0, 0x21, 0xdd, 0x15, 0x29, 0x4a, 0x79,	\
+	0x70, 0x4b, 0x41, 0x8f, 0x74, 0x5c, 0x78, 0xe3, 0xc7, 0x56, 0xe8, 0xb8, 0xf1, 0x8e, 0x33, 0xf3,	\
+	0x0b, 0xd4, 0xe3, 0xc1, 0x98, 0x4f, 0x63, 0xdb, 0x82, 0x5d, 0x47, 0x4f, 0xb4, 0xb0, 0xc3, 0x0e,	\
+	0xb5, 0x3d, 0x45, 0x11, 0x1d, 0x3f, 0x88, 0xe5, 0xcb, 0x4d, 0x34, 0xf9, 0xdf, 0x96, 0xba, 0xeb,	\
+	0x7f, 0xda, 0xb8, 0x87, 0x6a, 0xfc, 0x71, 0xbe, 0xb5, 0xb1, 0xef, 0x8f, 0x28, 0x8b, 0xab, 0x31,	\
+	0xcb, 0x2f, 0x2b, 0xb9, 0xe3, 0xd0, 0x80, 0xd8, 0x71, 0xc7, 0x4c, 0x09, 0xa2, 0xe8, 0xce, 0x7a,	\
+	0x27, 0x49, 0xb6, 0xe3, 0x3b, 0xce, 0xe3, 0x23, 0x3e, 0x53, 0xc3, 0xaa, 0x3b, 0xef, 0xcf, 0xd8,	\
+	0xc8, 0xdd, 0x3c, 0xbd, 0xec, 0x8c, 0xcc, 0x7d, 0x26, 0x0b, 0xab, 0xfc, 0xb9, 0x1d, 0x7f, 0xb5,	\
+	0x0f, 0x10, 0x78, 0x28, 0xec, 0x2a, 0xb4, 0xde, 0x0e, 0xcb, 0x8c, 0xa0, 0xd1, 0xe2, 0x9e, 0x0c,	\
+	0xbc, 0x91, 0x02, 0xbc, 0x21, 0xbb, 0x07, 0x9c, 0x59, 0xa0, 0xe9, 0x8c, 0xd8, 0x0c, 0x97, 0xe1,	\
+	0xc3, 0x5f, 0x41, 0x02, 0xed, 0x02, 0x0b, 0xd2, 0x1a, 0x81, 0xa5, 0x10, 0x13, 0x2f, 0x2c, 0x3d,	\
+	0xdb, 0x16, 0x61, 0xea, 0xa1, 0xa2, 0x11, 0xb7, 0xb2, 0x18, 0x6c, 0xed, 0x80, 0x1a, 0xeb, 0xf5,	\
+	0xbb, 0x0d, 0x7d, 0x3b, 0xbc, 0x81, 0xdb, 0x55, 0xc2, 0x41, 0x77, 0x4d, 0x7a, 0x64, 0x19, 0x47,	\
+	0x34, 0x75, 0xc4, 0x2d, 0xbb, 0x2f, 0xa1, 0x5c, 0xf1, 0xa7, 0x6b, 0x62, 0x2f, 0x3f, 0xd9, 0xa2,	\
+	0xf4, 0xca, 0x68, 0xb9, 0x5a, 0xc2, 0xef, 0x03, 0x0a, 0x63, 0xf8, 0xfb, 0xf5, 0xdb, 0x5e, 0xb7,	\
+	0xe2, 0xbd, 0x96, 0xd6, 0xec, 0x59, 0xcb, 0xae, 0x5c, 0xe6, 0xad, 0x2e, 0xe1, 0xe1, 0x2d, 0xde,	\
+	0x39, 0x39, 0x39, 0xc4, 0xbe, 0xef, 0xc5, 0xc3, 0xef, 0x85, 0x91, 0xfe, 0x96, 0xaf, 0xc7, 0x9a,	\
+	0x2e, 0x88, 0xc4, 0xfb, 0x62, 0x17, 0x57, 0xd2, 0xed, 0xc8, 0xcb, 0x5b, 0x2e, 0x86, 0x5f, 0xb9,	\
+	0xd0, 0xf7, 0xf6, 0x69, 0x7f, 0x7e, 0x59, 0x16, 0x5f, 0x3f, 0xf8, 0x00
+
+#endif  //  UI_HUFF_H_INCLUDED
+
@@ -0,0 +1,1108 @@
+/*
+ *  ST7735 Command Set Encoded Image
+ *  Encoder by Tim Williams, 2018-12-29
+ *  Original: uipat.png
+ */
+
+#ifndef UIPAT_H_INCLUDED
+#define UIPAT_H_INCLUDED
+
+#define UIPAT_MAGIC_NUMBER	0x371e5453
+#define UIPAT_WIDTH		160
+#define UIPAT_HEIGHT		128
+#define UIPAT_CMD_LEN		4715	/*  Number of command bytes  */
+#define UIPAT_PALETTE_LEN		80	/*  Number of bytes (2 * colors)  */
+#define UIPAT_TOTAL_LEN		4796	/*  Total array size  */
+
+#define UIPAT_PAL		\
+	0x1c, 0x92,	0x89, 0x00,	0x49, 0xb1,	0x41, 0x76,		\
+	0x1b, 0xf0,	0x93, 0x11,	0x3c, 0x17,	0x69, 0xa2,		\
+	0x2a, 0x5e,	0x7d, 0x7b,	0xd7, 0x5a,	0x64, 0x56,		\
+	0xbb, 0x1c,	0x20, 0x9d,	0x68, 0x7a,	0x6c, 0x46,		\
+	0x5a, 0x2b,	0x58, 0x8d,	0x37, 0x35,	0x3e, 0x10,		\
+	0x1b, 0xc6,	0xc3, 0xe9,	0xb3, 0xe1,	0x0e, 0x6f,		\
+	0xe7, 0x49,	0xb1, 0x3b,	0x3c, 0xee,	0x20, 0xc4,		\
+	0x0b, 0x24,	0x43, 0xb7,	0x38, 0xdc,	0xa6, 0xab,		\
+	0x88, 0x24,	0x3b, 0xa6,	0xf5, 0x74,	0x42, 0xb1,		\
+	0x16, 0x17,	0x6d, 0x7b,	0x12, 0xe4,	0xad, 0x39
+
+#define UIPAT_CMDS		\
+	0x05, 19, 19, 86, 21, 2,		\
+	0x25, 36, 89, 4, 8,		\
+	0x25, 28, 94, 8, 2,		\
+	0x05, 9, 0, 57, 4, 13,		\
+	0x05, 6, 115, 0, 17, 7,		\
+	0x25, 80, 72, 15, 6,		\
+	0x07, 11, 25, 69, 7, 11,		\
+	64, 71, 11, 5,		\
+	108, 0, 6, 9,		\
+	114, 8, 18, 2,		\
+	27, 62, 5, 6,		\
+	96, 72, 6, 5,		\
+	76, 71, 4, 5,		\
+	139, 0, 7, 2,		\
+	64, 76, 6, 2,		\
+	25, 62, 2, 4,		\
+	134, 0, 4, 2,		\
+	0x05, 0, 49, 39, 14, 33,		\
+	0x25, 67, 5, 29, 10,		\
+	0x07, 165, 22, 2, 32, 9,		\
+	131, 108, 19, 14,		\
+	0, 29, 8, 26,		\
+	64, 51, 26, 8,		\
+	2, 91, 12, 17,		\
+	87, 30, 10, 20,		\
+	80, 100, 18, 11,		\
+	1, 16, 21, 9,		\
+	106, 10, 8, 23,		\
+	123, 29, 7, 26,		\
+	122, 11, 10, 17,		\
+	5, 109, 33, 5,		\
+	45, 50, 4, 40,		\
+	60, 78, 10, 15,		\
+	54, 1, 49, 3,		\
+	69, 16, 8, 18,		\
+	72, 63, 18, 8,		\
+	153, 96, 7, 20,		\
+	3, 83, 42, 3,		\
+	84, 15, 21, 6,		\
+	154, 0, 6, 20,		\
+	27, 115, 9, 13,		\
+	55, 4, 5, 23,		\
+	67, 35, 11, 10,		\
+	62, 4, 3, 35,		\
+	125, 106, 5, 21,		\
+	51, 73, 6, 17,		\
+	121, 57, 5, 20,		\
+	33, 71, 11, 9,		\
+	132, 69, 9, 11,		\
+	63, 59, 8, 12,		\
+	0, 7, 13, 7,		\
+	40, 39, 9, 10,		\
+	26, 97, 8, 11,		\
+	0, 1, 21, 4,		\
+	134, 48, 13, 6,		\
+	82, 78, 4, 19,		\
+	77, 23, 24, 3,		\
+	0, 70, 2, 35,		\
+	86, 93, 10, 7,		\
+	54, 95, 16, 4,		\
+	107, 74, 9, 7,		\
+	128, 61, 3, 21,		\
+	37, 116, 5, 12,		\
+	79, 28, 5, 12,		\
+	130, 125, 20, 3,		\
+	141, 69, 19, 3,		\
+	101, 4, 5, 11,		\
+	32, 62, 6, 9,		\
+	15, 86, 4, 13,		\
+	13, 12, 13, 4,		\
+	97, 48, 26, 2,		\
+	22, 23, 17, 3,		\
+	86, 78, 17, 3,		\
+	131, 57, 6, 8,		\
+	115, 24, 5, 9,		\
+	50, 126, 22, 2,		\
+	149, 48, 11, 4,		\
+	57, 72, 7, 6,		\
+	77, 16, 6, 7,		\
+	0, 111, 5, 8,		\
+	14, 101, 5, 8,		\
+	116, 120, 5, 8,		\
+	14, 116, 13, 3,		\
+	65, 15, 3, 13,		\
+	77, 59, 13, 3,		\
+	63, 39, 3, 12,		\
+	119, 10, 3, 12,		\
+	39, 64, 5, 7,		\
+	2, 72, 3, 11,		\
+	95, 112, 11, 3,		\
+	95, 116, 11, 3,		\
+	0, 25, 16, 2,		\
+	53, 13, 2, 16,		\
+	79, 111, 15, 2,		\
+	130, 106, 15, 2,		\
+	154, 26, 6, 5,		\
+	18, 5, 4, 7,		\
+	21, 0, 14, 2,		\
+	97, 26, 4, 7,		\
+	114, 10, 4, 7,		\
+	130, 28, 2, 14,		\
+	147, 0, 7, 4,		\
+	147, 5, 7, 4,		\
+	25, 80, 9, 3,		\
+	53, 35, 9, 3,		\
+	84, 35, 3, 9,		\
+	121, 110, 3, 9,		\
+	2, 88, 13, 2,		\
+	36, 0, 13, 2,		\
+	150, 106, 2, 13,		\
+	5, 114, 8, 3,		\
+	13, 5, 4, 6,		\
+	54, 90, 6, 4,		\
+	72, 98, 6, 4,		\
+	94, 21, 12, 2,		\
+	103, 25, 3, 8,		\
+	23, 20, 11, 2,		\
+	132, 28, 11, 2,		\
+	130, 48, 3, 7,		\
+	40, 49, 5, 4,		\
+	40, 59, 5, 4,		\
+	35, 80, 10, 2,		\
+	40, 86, 5, 4,		\
+	49, 74, 2, 10,		\
+	65, 29, 2, 10,		\
+	98, 5, 2, 10,		\
+	98, 102, 2, 10,		\
+	130, 122, 10, 2,		\
+	58, 78, 2, 9,		\
+	56, 28, 6, 3,		\
+	65, 4, 2, 9,		\
+	95, 122, 3, 6,		\
+	103, 72, 3, 6,		\
+	22, 16, 4, 4,		\
+	35, 19, 4, 4,		\
+	39, 107, 2, 8,		\
+	80, 41, 4, 4,		\
+	96, 92, 4, 4,		\
+	113, 120, 2, 8,		\
+	111, 72, 8, 2,		\
+	122, 120, 2, 8,		\
+	131, 80, 8, 2,		\
+	152, 117, 8, 2,		\
+	71, 59, 5, 3,		\
+	116, 74, 5, 3,		\
+	126, 57, 5, 3,		\
+	154, 22, 5, 3,		\
+	19, 107, 7, 2,		\
+	34, 97, 7, 2,		\
+	42, 126, 7, 2,		\
+	106, 3, 2, 7,		\
+	143, 122, 7, 2,		\
+	147, 52, 7, 2,		\
+	0, 27, 6, 2,		\
+	35, 26, 3, 4,		\
+	40, 55, 4, 3,		\
+	60, 93, 6, 2,		\
+	66, 45, 2, 6,		\
+	84, 28, 2, 6,		\
+	87, 21, 6, 2,		\
+	114, 18, 2, 6,		\
+	120, 29, 3, 4,		\
+	121, 106, 4, 3,		\
+	131, 66, 4, 3,		\
+	151, 9, 3, 4,		\
+	2, 86, 5, 2,		\
+	49, 85, 2, 5,		\
+	73, 126, 5, 2,		\
+	117, 19, 2, 5,		\
+	120, 23, 2, 5,		\
+	121, 50, 2, 5,		\
+	155, 52, 5, 2,		\
+	97, 97, 3, 3,		\
+	104, 78, 3, 3,		\
+	147, 10, 3, 3,		\
+	10, 117, 4, 2,		\
+	60, 21, 2, 4,		\
+	77, 31, 2, 4,		\
+	78, 99, 2, 4,		\
+	95, 26, 2, 4,		\
+	106, 72, 4, 2,		\
+	130, 43, 2, 4,		\
+	146, 106, 4, 2,		\
+	156, 20, 4, 2,		\
+	0x05, 33, 101, 25, 2, 8,		\
+	0x05, 20, 146, 73, 12, 23,		\
+	0x25, 33, 30, 20, 4,		\
+	0x07, 6, 141, 77, 5, 11,		\
+	33, 36, 15, 3,		\
+	141, 89, 5, 6,		\
+	49, 36, 4, 3,		\
+	158, 90, 2, 6,		\
+	143, 73, 3, 3,		\
+	0x05, 16, 11, 55, 13, 15,		\
+	0x25, 42, 108, 16, 10,		\
+	0x07, 20, 14, 71, 10, 12,		\
+	62, 108, 6, 16,		\
+	2, 119, 10, 9,		\
+	18, 119, 9, 9,		\
+	71, 115, 7, 11,		\
+	8, 58, 3, 25,		\
+	68, 107, 11, 6,		\
+	42, 120, 20, 3,		\
+	13, 119, 3, 9,		\
+	58, 107, 3, 9,		\
+	11, 70, 2, 13,		\
+	73, 103, 6, 4,		\
+	5, 72, 2, 11,		\
+	68, 114, 2, 11,		\
+	42, 118, 10, 2,		\
+	6, 62, 2, 9,		\
+	48, 123, 8, 2,		\
+	6, 55, 2, 6,		\
+	42, 123, 5, 2,		\
+	56, 118, 5, 2,		\
+	0x05, 17, 84, 116, 9, 7,		\
+	0x25, 78, 124, 12, 4,		\
+	0x07, 4, 78, 113, 5, 9,		\
+	83, 113, 12, 2,		\
+	93, 118, 2, 7,		\
+	90, 126, 5, 2,		\
+	0x05, 30, 145, 20, 9, 10,		\
+	0x25, 146, 13, 6, 4,		\
+	0x07, 3, 143, 16, 2, 11,		\
+	151, 17, 3, 3,		\
+	145, 18, 4, 2,		\
+	0x05, 18, 26, 88, 10, 6,		\
+	0x25, 22, 88, 4, 2,		\
+	0x05, 36, 100, 33, 23, 6,		\
+	0x25, 97, 39, 12, 7,		\
+	0x07, 6, 117, 39, 6, 9,		\
+	110, 40, 4, 8,		\
+	97, 46, 8, 2,		\
+	97, 33, 2, 6,		\
+	115, 39, 2, 6,		\
+	106, 46, 4, 2,		\
+	0x05, 34, 121, 78, 6, 18,		\
+	0x25, 116, 77, 4, 19,		\
+	0x07, 3, 19, 96, 4, 11,		\
+	24, 90, 2, 17,		\
+	19, 90, 5, 4,		\
+	0x05, 22, 21, 35, 11, 14,		\
+	0x25, 8, 29, 12, 12,		\
+	0x07, 10, 70, 76, 10, 11,		\
+	8, 43, 11, 9,		\
+	70, 90, 10, 7,		\
+	27, 49, 7, 5,		\
+	8, 53, 16, 2,		\
+	20, 29, 13, 2,		\
+	72, 87, 8, 2,		\
+	21, 49, 3, 4,		\
+	32, 43, 2, 6,		\
+	20, 31, 2, 4,		\
+	0x05, 5, 158, 74, 2, 16,		\
+	0x05, 38, 113, 61, 6, 5,		\
+	0x25, 115, 59, 4, 2,		\
+	0x05, 25, 34, 39, 5, 16,		\
+	0x25, 23, 31, 10, 4,		\
+	0x07, 4, 26, 55, 10, 4,		\
+	54, 31, 7, 4,		\
+	25, 60, 13, 2,		\
+	36, 57, 4, 3,		\
+	0x05, 23, 150, 119, 9, 9,		\
+	0x05, 37, 34, 100, 38, 6,		\
+	0x05, 8, 127, 82, 14, 24,		\
+	0x25, 94, 52, 17, 14,		\
+	0x07, 9, 90, 67, 31, 5,		\
+	143, 96, 10, 9,		\
+	119, 96, 8, 10,		\
+	111, 52, 8, 7,		\
+	90, 56, 4, 11,		\
+	97, 50, 19, 2,		\
+	119, 54, 2, 13,		\
+	90, 50, 2, 6,		\
+	117, 50, 4, 2,		\
+	0x05, 2, 90, 83, 19, 9,		\
+	0x25, 39, 11, 9, 18,		\
+	0x07, 8, 49, 14, 4, 15,		\
+	86, 81, 3, 11,		\
+	110, 81, 3, 11,		\
+	89, 81, 11, 2,		\
+	101, 81, 9, 2,		\
+	113, 86, 2, 6,		\
+	48, 11, 5, 2,		\
+	113, 81, 2, 4,		\
+	0x05, 7, 127, 55, 7, 2,		\
+	0x25, 121, 55, 5, 2,		\
+	0x05, 1, 108, 92, 8, 5,		\
+	0x05, 14, 41, 90, 13, 9,		\
+	0x25, 100, 95, 4, 13,		\
+	0x25, 104, 92, 2, 11,		\
+	0x25, 100, 109, 6, 3,		\
+	0x05, 24, 68, 45, 12, 5,		\
+	0x25, 81, 45, 5, 6,		\
+	0x05, 11, 145, 37, 11, 11,		\
+	0x25, 138, 57, 21, 4,		\
+	0x07, 14, 139, 31, 18, 4,		\
+	138, 62, 14, 5,		\
+	132, 43, 10, 5,		\
+	139, 54, 21, 2,		\
+	154, 62, 6, 7,		\
+	135, 32, 4, 10,		\
+	141, 35, 4, 7,		\
+	137, 67, 9, 2,		\
+	157, 33, 3, 6,		\
+	132, 31, 2, 8,		\
+	147, 67, 7, 2,		\
+	148, 35, 7, 2,		\
+	158, 40, 2, 7,		\
+	143, 43, 2, 5,		\
+	0x05, 21, 77, 26, 18, 2,		\
+	0x25, 24, 50, 2, 6,		\
+	0x05, 35, 106, 119, 7, 9,		\
+	0x25, 99, 119, 5, 7,		\
+	0x25, 101, 126, 4, 2,		\
+	0x05, 13, 133, 5, 7, 16,		\
+	0x25, 106, 103, 9, 10,		\
+	0x07, 11, 26, 12, 13, 4,		\
+	116, 104, 3, 16,		\
+	141, 5, 2, 21,		\
+	106, 99, 13, 3,		\
+	143, 2, 4, 9,		\
+	106, 116, 10, 3,		\
+	135, 21, 4, 7,		\
+	132, 2, 11, 2,		\
+	33, 16, 6, 3,		\
+	26, 16, 4, 3,		\
+	109, 113, 6, 2,		\
+	0x02, 19, 26, 96, 7,		\
+	0x02, 6, 114, 7, 9,		\
+	0x22, 124, 7, 8,		\
+	0x02, 0, 62, 0, 27,		\
+	0x22, 90, 0, 18,		\
+	0x07, 22, 22, 11, 17,		\
+	82, 4, 17,		\
+	136, 30, 16,		\
+	17, 114, 14,		\
+	67, 4, 14,		\
+	0, 5, 12,		\
+	27, 108, 12,		\
+	49, 0, 12,		\
+	0, 108, 11,		\
+	123, 10, 9,		\
+	138, 124, 9,		\
+	0, 0, 8,		\
+	5, 15, 8,		\
+	74, 62, 8,		\
+	86, 28, 8,		\
+	1, 14, 7,		\
+	6, 6, 7,		\
+	13, 115, 7,		\
+	14, 0, 7,		\
+	22, 22, 7,		\
+	28, 19, 7,		\
+	83, 62, 7,		\
+	0x02, 20, 37, 35, 16,		\
+	0x22, 43, 29, 13,		\
+	0x22, 141, 72, 13,		\
+	0x22, 33, 34, 10,		\
+	0x02, 16, 42, 125, 29,		\
+	0x22, 47, 107, 11,		\
+	0x22, 18, 70, 7,		\
+	0x02, 17, 78, 123, 8,		\
+	0x02, 22, 8, 27, 26,		\
+	0x22, 8, 28, 8,		\
+	0x07, 5, 8, 42, 8,		\
+	12, 41, 8,		\
+	14, 52, 7,		\
+	17, 28, 7,		\
+	70, 89, 7,		\
+	0x02, 37, 45, 99, 27,		\
+	0x22, 51, 106, 18,		\
+	0x22, 34, 106, 16,		\
+	0x22, 34, 99, 10,		\
+	0x02, 8, 83, 115, 23,		\
+	0x22, 102, 66, 17,		\
+	0x22, 94, 66, 7,		\
+	0x22, 107, 115, 7,		\
+	0x02, 1, 108, 98, 9,		\
+	0x02, 24, 71, 50, 10,		\
+	0x02, 11, 144, 61, 12,		\
+	0x22, 148, 56, 12,		\
+	0x22, 137, 56, 10,		\
+	0x22, 136, 42, 8,		\
+	0x02, 3, 16, 26, 19,		\
+	0x03, 0, 80, 78, 22,		\
+	0x23, 126, 61, 16,		\
+	0x07, 22, 68, 20, 15,		\
+	4, 58, 13,		\
+	127, 70, 12,		\
+	81, 89, 11,		\
+	60, 7, 10,		\
+	81, 78, 10,		\
+	124, 114, 10,		\
+	0, 14, 9,		\
+	0, 119, 9,		\
+	119, 111, 9,		\
+	130, 113, 9,		\
+	36, 114, 8,		\
+	44, 70, 8,		\
+	61, 4, 8,		\
+	78, 37, 8,		\
+	127, 60, 8,		\
+	152, 106, 8,		\
+	40, 90, 7,		\
+	57, 83, 7,		\
+	61, 13, 7,		\
+	63, 51, 7,		\
+	107, 92, 7,		\
+	0x03, 16, 24, 56, 12,		\
+	0x23, 61, 110, 9,		\
+	0x07, 3, 5, 58, 8,		\
+	7, 71, 8,		\
+	70, 113, 8,		\
+	0x03, 34, 120, 77, 9,		\
+	0x23, 120, 87, 9,		\
+	0x23, 23, 94, 7,		\
+	0x03, 22, 20, 37, 14,		\
+	0x03, 25, 39, 44, 8,		\
+	0x03, 8, 141, 96, 10,		\
+	0x23, 112, 59, 7,		\
+	0x03, 2, 48, 18, 11,		\
+	0x03, 1, 115, 81, 11,		\
+	0x03, 14, 41, 107, 9,		\
+	0x23, 106, 92, 7,		\
+	0x03, 11, 156, 39, 9,		\
+	0x23, 134, 35, 8,		\
+	0x23, 137, 58, 8,		\
+	0x03, 13, 132, 8, 20,		\
+	0x23, 140, 15, 13,		\
+	0x23, 140, 4, 10,		\
+	0x15, 96, 5, 2, 10,		\
+		0, 0, 0, 0, 0, 0, 27, 0, 0, 0, 0, 21, 0, 0, 27, 0, 0, 0, 0, 0,		\
+	0x07, 67, 16, 119, 2, 9,		\
+		16, 16, 7, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 38, 16, 37,		\
+	7, 86, 8, 2,		\
+		34, 0, 0, 0, 0, 0, 0, 22, 0, 9, 8, 0, 0, 0, 0, 0,		\
+	143, 11, 3, 5,		\
+		13, 13, 30, 30, 26, 28, 13, 30, 30, 30, 13, 13, 30, 5, 30,		\
+	71, 113, 7, 2,		\
+		16, 16, 16, 16, 16, 3, 29, 16, 16, 16, 16, 16, 16, 16,		\
+	104, 119, 2, 7,		\
+		35, 6, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 6, 35,		\
+	133, 21, 2, 7,		\
+		13, 3, 13, 13, 13, 13, 13, 13, 13, 13, 3, 13, 13, 13,		\
+	139, 35, 2, 7,		\
+		11, 11, 11, 11, 11, 11, 27, 11, 11, 11, 7, 11, 11, 11,		\
+	0, 55, 6, 2,		\
+		9, 9, 9, 9, 9, 9, 9, 3, 0, 0, 16, 16,		\
+	39, 53, 6, 2,		\
+		25, 25, 35, 0, 0, 0, 0, 36, 0, 0, 0, 0,		\
+	56, 123, 6, 2,		\
+		16, 32, 16, 16, 16, 16, 16, 16, 16, 18, 16, 16,		\
+	82, 97, 4, 3,		\
+		0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 5,		\
+	92, 50, 2, 6,		\
+		24, 8, 8, 8, 8, 22, 8, 8, 23, 8, 8, 8,		\
+	95, 119, 4, 3,		\
+		0, 0, 18, 0, 0, 0, 0, 0, 0, 35, 35, 35,		\
+	100, 92, 4, 3,		\
+		14, 14, 14, 14, 14, 31, 14, 14, 14, 14, 7, 14,		\
+	104, 103, 2, 6,		\
+		22, 14, 14, 14, 14, 14, 14, 14, 36, 14, 14, 14,		\
+	0, 109, 5, 2,		\
+		0, 0, 0, 0, 0, 0, 12, 0, 0, 24,		\
+	5, 117, 5, 2,		\
+		0, 0, 0, 0, 18, 0, 0, 0, 0, 23,		\
+	101, 23, 5, 2,		\
+		0, 0, 0, 0, 0, 0, 0, 4, 0, 0,		\
+	103, 1, 5, 2,		\
+		10, 0, 0, 0, 0, 0, 0, 12, 0, 0,		\
+	134, 54, 5, 2,		\
+		0, 27, 0, 0, 0, 0, 11, 11, 11, 19,		\
+	152, 62, 2, 5,		\
+		11, 5, 11, 11, 11, 11, 11, 12, 11, 11,		\
+	8, 55, 3, 3,		\
+		16, 16, 16, 16, 16, 16, 16, 16, 33,		\
+	30, 16, 3, 3,		\
+		21, 13, 13, 13, 13, 13, 13, 13, 5,		\
+	90, 123, 3, 3,		\
+		17, 17, 15, 17, 17, 17, 17, 18, 17,		\
+	15, 99, 4, 2,		\
+		30, 0, 7, 0, 0, 0, 0, 0,		\
+	19, 94, 4, 2,		\
+		34, 34, 23, 34, 34, 34, 34, 7,		\
+	36, 55, 4, 2,		\
+		5, 25, 25, 21, 25, 25, 25, 38,		\
+	52, 118, 4, 2,		\
+		5, 16, 16, 16, 16, 16, 16, 19,		\
+	66, 93, 4, 2,		\
+		34, 0, 0, 0, 0, 0, 0, 0,		\
+	83, 21, 4, 2,		\
+		0, 0, 0, 0, 0, 0, 0, 34,		\
+	132, 39, 2, 4,		\
+		11, 11, 11, 11, 23, 11, 32, 11,		\
+	135, 65, 2, 4,		\
+		0, 0, 21, 0, 0, 0, 0, 0,		\
+	141, 73, 2, 4,		\
+		20, 20, 20, 20, 20, 33, 20, 20,		\
+	147, 48, 2, 4,		\
+		0, 0, 33, 0, 0, 18, 0, 0,		\
+	152, 13, 2, 4,		\
+		30, 30, 20, 30, 30, 30, 30, 30,		\
+	0, 105, 2, 3,		\
+		0, 0, 0, 2, 0, 0,		\
+	19, 88, 3, 2,		\
+		19, 19, 19, 19, 19, 19,		\
+	58, 87, 2, 3,		\
+		0, 0, 0, 18, 0, 0,		\
+	58, 116, 3, 2,		\
+		30, 16, 16, 16, 16, 16,		\
+	77, 28, 2, 3,		\
+		0, 0, 26, 0, 0, 0,		\
+	94, 50, 3, 2,		\
+		8, 8, 8, 8, 8, 33,		\
+	106, 113, 3, 2,		\
+		13, 13, 13, 13, 39, 13,		\
+	115, 45, 2, 3,		\
+		36, 36, 36, 35, 36, 36,		\
+	116, 102, 3, 2,		\
+		13, 13, 13, 16, 13, 13,		\
+	140, 122, 3, 2,		\
+		25, 0, 0, 0, 0, 18,		\
+	143, 27, 2, 3,		\
+		12, 30, 30, 30, 3, 30,		\
+	145, 35, 3, 2,		\
+		11, 11, 11, 11, 16, 11,		\
+	157, 31, 3, 2,		\
+		11, 3, 11, 11, 11, 11,		\
+	2, 70, 2, 2,		\
+		0, 0, 0, 0,		\
+	6, 27, 2, 2,		\
+		0, 25, 0, 0,		\
+	25, 66, 2, 2,		\
+		6, 6, 7, 6,		\
+	26, 94, 2, 2,		\
+		19, 19, 19, 34,		\
+	60, 25, 2, 2,		\
+		30, 0, 0, 0,		\
+	65, 13, 2, 2,		\
+		0, 0, 20, 0,		\
+	70, 87, 2, 2,		\
+		22, 22, 18, 22,		\
+	93, 116, 2, 2,		\
+		17, 30, 17, 17,		\
+	98, 100, 2, 2,		\
+		0, 21, 0, 0,		\
+	99, 126, 2, 2,		\
+		35, 35, 32, 35,		\
+	113, 59, 2, 2,		\
+		38, 38, 38, 20,		\
+	119, 52, 2, 2,		\
+		8, 33, 8, 8,		\
+	119, 72, 2, 2,		\
+		0, 11, 0, 0,		\
+	132, 0, 2, 2,		\
+		6, 6, 6, 11,		\
+	139, 80, 2, 2,		\
+		21, 0, 0, 0,		\
+	141, 26, 2, 2,		\
+		3, 13, 13, 13,		\
+	149, 18, 2, 2,		\
+		30, 0, 18, 30,		\
+	154, 20, 2, 2,		\
+		0, 31, 12, 9,		\
+	155, 35, 2, 2,		\
+		11, 36, 11, 11,		\
+	0x12, 68, 15, 16,		\
+		0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 30, 0, 0, 0, 0, 0,		\
+	0x07, 32, 2, 90, 13,		\
+		0, 0, 0, 17, 0, 0, 0, 0, 34, 0, 0, 0, 0,		\
+	24, 28, 11,		\
+		24, 22, 22, 22, 22, 22, 5, 22, 22, 22, 3,		\
+	25, 59, 11,		\
+		25, 25, 25, 25, 25, 25, 7, 25, 25, 25, 25,		\
+	34, 82, 11,		\
+		0, 0, 0, 0, 36, 3, 0, 0, 0, 0, 14,		\
+	43, 34, 11,		\
+		17, 20, 20, 20, 20, 20, 23, 20, 20, 20, 5,		\
+	108, 97, 11,		\
+		1, 1, 1, 1, 35, 1, 1, 1, 1, 8, 8,		\
+	70, 97, 10,		\
+		0, 6, 0, 0, 0, 6, 0, 0, 0, 0,		\
+	80, 71, 10,		\
+		6, 6, 6, 6, 6, 6, 29, 6, 6, 6,		\
+	120, 28, 10,		\
+		24, 0, 0, 0, 0, 0, 0, 12, 0, 0,		\
+	143, 105, 10,		\
+		8, 8, 8, 8, 8, 27, 8, 8, 8, 8,		\
+	53, 38, 9,		\
+		0, 0, 36, 0, 0, 0, 0, 0, 0,		\
+	86, 29, 9,		\
+		0, 0, 0, 32, 0, 0, 0, 0, 0,		\
+	106, 102, 9,		\
+		13, 13, 13, 13, 13, 13, 32, 13, 13,		\
+	24, 68, 8,		\
+		37, 6, 6, 6, 29, 6, 6, 6,		\
+	26, 54, 8,		\
+		22, 22, 22, 22, 22, 38, 22, 22,		\
+	49, 72, 8,		\
+		0, 0, 0, 0, 0, 24, 0, 0,		\
+	69, 34, 8,		\
+		0, 0, 0, 0, 8, 0, 0, 0,		\
+	95, 77, 8,		\
+		6, 6, 6, 31, 6, 6, 6, 0,		\
+	130, 124, 8,		\
+		0, 0, 0, 0, 21, 0, 0, 3,		\
+	132, 4, 8,		\
+		13, 13, 13, 13, 17, 13, 13, 13,		\
+	152, 116, 8,		\
+		0, 0, 9, 0, 0, 0, 0, 0,		\
+	20, 115, 7,		\
+		28, 0, 21, 0, 0, 0, 0,		\
+	55, 27, 7,		\
+		0, 0, 28, 0, 0, 0, 0,		\
+	61, 107, 7,		\
+		16, 16, 16, 16, 21, 16, 16,		\
+	147, 4, 7,		\
+		0, 0, 0, 18, 19, 0, 0,		\
+	0, 6, 6,		\
+		0, 0, 0, 0, 0, 22,		\
+	8, 0, 6,		\
+		1, 0, 0, 0, 0, 2,		\
+	8, 52, 6,		\
+		22, 22, 22, 22, 22, 25,		\
+	16, 25, 6,		\
+		17, 0, 0, 0, 0, 0,		\
+	29, 22, 6,		\
+		15, 0, 0, 0, 0, 0,		\
+	54, 94, 6,		\
+		0, 0, 0, 3, 15, 0,		\
+	62, 124, 6,		\
+		30, 16, 16, 16, 16, 16,		\
+	0x12, 72, 102, 6,		\
+		0, 0, 22, 0, 0, 0,		\
+	0x16, 0x0a, 0x00, 90, 92,		\
+	0x12, 108, 9, 6,		\
+		6, 3, 6, 6, 17, 6,		\
+	0x07, 8, 121, 77, 6,		\
+		34, 16, 34, 34, 34, 34,		\
+	124, 127, 6,		\
+		0, 25, 0, 0, 0, 0,		\
+	138, 61, 6,		\
+		19, 11, 11, 11, 11, 36,		\
+	145, 17, 6,		\
+		30, 3, 30, 30, 30, 9,		\
+	154, 25, 6,		\
+		0, 0, 0, 24, 0, 0,		\
+	154, 72, 6,		\
+		15, 20, 20, 20, 20, 20,		\
+	8, 14, 5,		\
+		7, 0, 0, 0, 0,		\
+	31, 114, 5,		\
+		3, 0, 0, 0, 0,		\
+	0x12, 34, 107, 5,		\
+		0, 0, 0, 0, 0,		\
+	0x16, 0x09, 0x00, 38, 29,		\
+	0x12, 39, 63, 5,		\
+		0, 0, 0, 19, 27,		\
+	0x07, 28, 40, 58, 5,		\
+		0, 7, 0, 0, 0,		\
+	42, 107, 5,		\
+		16, 16, 28, 16, 33,		\
+	49, 1, 5,		\
+		9, 0, 0, 0, 0,		\
+	78, 122, 5,		\
+		17, 17, 17, 2, 17,		\
+	141, 88, 5,		\
+		20, 5, 20, 20, 20,		\
+	1, 15, 4,		\
+		0, 0, 0, 31,		\
+	8, 41, 4,		\
+		22, 22, 22, 25,		\
+	13, 11, 4,		\
+		20, 0, 4, 0,		\
+	13, 114, 4,		\
+		0, 0, 0, 20,		\
+	14, 70, 4,		\
+		16, 16, 16, 12,		\
+	33, 35, 4,		\
+		20, 20, 11, 3,		\
+	36, 88, 4,		\
+		23, 19, 19, 19,		\
+	45, 49, 4,		\
+		0, 0, 0, 39,		\
+	49, 13, 4,		\
+		2, 20, 2, 2,		\
+	69, 106, 4,		\
+		3, 37, 37, 16,		\
+	80, 40, 4,		\
+		0, 0, 0, 23,		\
+	86, 123, 4,		\
+		0, 17, 17, 17,		\
+	94, 111, 4,		\
+		32, 23, 0, 0,		\
+	100, 108, 4,		\
+		14, 14, 27, 14,		\
+	110, 39, 4,		\
+		36, 36, 29, 36,		\
+	131, 65, 4,		\
+		0, 4, 0, 0,		\
+	135, 31, 4,		\
+		11, 11, 11, 24,		\
+	147, 9, 4,		\
+		0, 0, 24, 0,		\
+	11, 108, 3,		\
+		16, 0, 0,		\
+	16, 42, 3,		\
+		26, 22, 22,		\
+	33, 96, 3,		\
+		24, 19, 19,		\
+	68, 50, 3,		\
+		24, 24, 0,		\
+	77, 89, 3,		\
+		3, 22, 22,		\
+	0x12, 86, 92, 3,		\
+		0, 0, 0,		\
+	0x16, 0x07, 0x00, 87, 50,		\
+	0x12, 97, 96, 3,		\
+		0, 14, 0,		\
+	0x16, 0x13, 0x00, 103, 3,		\
+	0x12, 116, 96, 3,		\
+		1, 8, 8,		\
+	0x07, 19, 119, 22, 3,		\
+		0, 0, 7,		\
+	121, 109, 3,		\
+		0, 8, 0,		\
+	128, 60, 3,		\
+		0, 17, 0,		\
+	134, 56, 3,		\
+		7, 0, 0,		\
+	143, 76, 3,		\
+		20, 20, 39,		\
+	143, 95, 3,		\
+		20, 20, 17,		\
+	147, 124, 3,		\
+		13, 0, 0,		\
+	156, 61, 3,		\
+		1, 11, 11,		\
+	4, 57, 2,		\
+		6, 1,		\
+	6, 61, 2,		\
+		16, 32,		\
+	24, 49, 2,		\
+		22, 22,		\
+	26, 19, 2,		\
+		0, 32,		\
+	33, 29, 2,		\
+		22, 3,		\
+	39, 115, 2,		\
+		24, 0,		\
+	49, 73, 2,		\
+		0, 39,		\
+	49, 84, 2,		\
+		0, 38,		\
+	54, 30, 2,		\
+		20, 20,		\
+	65, 28, 2,		\
+		35, 0,		\
+	68, 113, 2,		\
+		6, 38,		\
+	0x12, 70, 98, 2,		\
+		0, 0,		\
+	0x07, 12, 72, 62, 2,		\
+		0, 14,		\
+	78, 98, 2,		\
+		36, 0,		\
+	84, 34, 2,		\
+		3, 0,		\
+	84, 44, 2,		\
+		0, 35,		\
+	93, 125, 2,		\
+		23, 17,		\
+	113, 85, 2,		\
+		12, 2,		\
+	113, 119, 2,		\
+		13, 13,		\
+	114, 17, 2,		\
+		10, 0,		\
+	117, 98, 2,		\
+		8, 8,		\
+	122, 119, 2,		\
+		14, 0,		\
+	130, 42, 2,		\
+		1, 0,		\
+	130, 47, 2,		\
+		23, 0,		\
+	0x16, 0x44, 0x00, 132, 30,		\
+	0x12, 141, 4, 2,		\
+		13, 4,		\
+	0x07, 4, 152, 30, 2,		\
+		8, 0,		\
+	158, 39, 2,		\
+		3, 11,		\
+	158, 47, 2,		\
+		8, 11,		\
+	158, 73, 2,		\
+		18, 20,		\
+	0x13, 115, 102, 14,		\
+		13, 13, 13, 13, 32, 13, 36, 33, 13, 13, 13, 13, 37, 13,		\
+	0x07, 92, 120, 106, 14,		\
+		1, 1, 2, 1, 1, 0, 0, 0, 0, 35, 0, 0, 0, 0,		\
+	13, 70, 13,		\
+		16, 16, 16, 16, 16, 16, 11, 16, 16, 16, 16, 16, 16,		\
+	24, 71, 12,		\
+		16, 16, 16, 16, 6, 16, 25, 16, 16, 16, 16, 16,		\
+	38, 60, 11,		\
+		1, 25, 0, 0, 0, 2, 0, 0, 0, 0, 12,		\
+	100, 4, 11,		\
+		0, 0, 0, 0, 25, 0, 0, 0, 5, 0, 0,		\
+	131, 69, 11,		\
+		2, 0, 0, 0, 0, 0, 12, 0, 0, 0, 0,		\
+	142, 95, 11,		\
+		27, 8, 8, 8, 8, 8, 4, 8, 8, 8, 8,		\
+	14, 91, 10,		\
+		0, 0, 0, 0, 0, 23, 0, 0, 0, 4,		\
+	19, 42, 10,		\
+		22, 22, 22, 22, 12, 22, 22, 22, 22, 22,		\
+	89, 83, 10,		\
+		2, 2, 2, 16, 2, 2, 2, 2, 2, 0,		\
+	1, 119, 9,		\
+		16, 16, 11, 16, 16, 16, 16, 16, 16,		\
+	12, 119, 9,		\
+		16, 16, 16, 17, 16, 16, 16, 16, 16,		\
+	32, 71, 9,		\
+		0, 0, 0, 0, 14, 0, 0, 0, 0,		\
+	54, 4, 9,		\
+		14, 0, 0, 0, 0, 26, 0, 0, 10,		\
+	71, 62, 9,		\
+		0, 0, 0, 0, 0, 16, 0, 0, 0,		\
+	109, 83, 9,		\
+		2, 2, 2, 2, 2, 2, 24, 2, 2,		\
+	114, 24, 9,		\
+		0, 0, 0, 7, 0, 0, 0, 0, 0,		\
+	114, 39, 9,		\
+		36, 36, 36, 21, 36, 36, 36, 36, 36,		\
+	115, 119, 9,		\
+		13, 0, 34, 0, 0, 33, 0, 0, 0,		\
+	118, 10, 9,		\
+		0, 0, 0, 29, 0, 0, 0, 0, 0,		\
+	121, 119, 9,		\
+		0, 31, 0, 0, 33, 0, 0, 0, 21,		\
+	157, 39, 9,		\
+		11, 11, 34, 11, 27, 11, 11, 11, 11,		\
+	159, 119, 9,		\
+		23, 23, 23, 23, 39, 39, 39, 39, 39,		\
+	32, 35, 8,		\
+		22, 22, 22, 22, 22, 17, 22, 2,		\
+	79, 103, 8,		\
+		0, 0, 9, 0, 0, 0, 0, 0,		\
+	17, 5, 7,		\
+		0, 0, 0, 15, 0, 0, 0,		\
+	38, 109, 7,		\
+		0, 0, 9, 0, 0, 0, 0,		\
+	44, 63, 7,		\
+		0, 0, 0, 0, 0, 0, 17,		\
+	67, 28, 7,		\
+		0, 33, 0, 0, 0, 0, 0,		\
+	83, 116, 7,		\
+		17, 17, 17, 12, 17, 17, 17,		\
+	86, 44, 7,		\
+		0, 0, 0, 36, 0, 0, 0,		\
+	109, 39, 7,		\
+		36, 36, 36, 36, 38, 36, 36,		\
+	111, 59, 7,		\
+		8, 8, 8, 29, 8, 8, 8,		\
+	114, 0, 7,		\
+		7, 6, 6, 6, 6, 21, 6,		\
+	116, 17, 7,		\
+		0, 0, 0, 0, 33, 0, 0,		\
+	133, 48, 7,		\
+		0, 0, 3, 0, 0, 0, 0,		\
+	139, 21, 7,		\
+		24, 13, 29, 13, 13, 13, 13,		\
+	5, 66, 6,		\
+		33, 16, 16, 16, 16, 16,		\
+	23, 101, 6,		\
+		7, 34, 34, 34, 34, 34,		\
+	36, 122, 6,		\
+		24, 0, 0, 0, 0, 0,		\
+	66, 39, 6,		\
+		0, 0, 7, 0, 0, 0,		\
+	98, 122, 6,		\
+		35, 35, 0, 35, 35, 35,		\
+	99, 33, 6,		\
+		36, 36, 36, 36, 15, 36,		\
+	105, 15, 6,		\
+		0, 1, 0, 0, 0, 0,		\
+	26, 49, 5,		\
+		2, 22, 22, 22, 22,		\
+	39, 39, 5,		\
+		25, 25, 25, 25, 33,		\
+	48, 13, 5,		\
+		2, 2, 2, 2, 24,		\
+	57, 78, 5,		\
+		0, 0, 0, 0, 11,		\
+	75, 71, 5,		\
+		6, 6, 39, 6, 6,		\
+	79, 40, 5,		\
+		0, 0, 17, 0, 0,		\
+	80, 45, 5,		\
+		24, 24, 7, 24, 24,		\
+	83, 16, 5,		\
+		0, 22, 0, 0, 0,		\
+	86, 30, 5,		\
+		33, 0, 0, 0, 0,		\
+	95, 72, 5,		\
+		6, 6, 36, 6, 6,		\
+	102, 72, 5,		\
+		15, 15, 15, 0, 0,		\
+	119, 106, 5,		\
+		1, 1, 1, 1, 1,		\
+	124, 109, 5,		\
+		0, 0, 0, 0, 22,		\
+	130, 108, 5,		\
+		0, 0, 0, 0, 25,		\
+	134, 30, 5,		\
+		0, 11, 11, 11, 3,		\
+	142, 43, 5,		\
+		11, 2, 11, 11, 11,		\
+	159, 57, 5,		\
+		9, 11, 11, 11, 11,		\
+	7, 79, 4,		\
+		28, 16, 16, 16,		\
+	22, 31, 4,		\
+		22, 22, 10, 22,		\
+	33, 39, 4,		\
+		22, 22, 22, 22,		\
+	53, 30, 4,		\
+		20, 25, 25, 25,		\
+	60, 17, 4,		\
+		3, 0, 0, 0,		\
+	61, 31, 4,		\
+		0, 0, 24, 0,		\
+	68, 16, 4,		\
+		0, 0, 0, 31,		\
+	70, 121, 4,		\
+		21, 16, 16, 16,		\
+	96, 96, 4,		\
+		0, 18, 0, 0,		\
+	106, 74, 4,		\
+		0, 38, 0, 0,		\
+	2, 83, 3,		\
+		29, 0, 0,		\
+	21, 2, 3,		\
+		0, 0, 10,		\
+	25, 56, 3,		\
+		34, 3, 25,		\
+	38, 26, 3,		\
+		0, 10, 0,		\
+	39, 60, 3,		\
+		25, 25, 0,		\
+	44, 55, 3,		\
+		0, 0, 35,		\
+	48, 36, 3,		\
+		36, 20, 20,		\
+	60, 4, 3,		\
+		0, 0, 23,		\
+	72, 103, 3,		\
+		16, 16, 22,		\
+	76, 59, 3,		\
+		8, 0, 0,		\
+	103, 78, 3,		\
+		5, 0, 0,		\
+	124, 124, 3,		\
+		11, 0, 0,		\
+	132, 5, 3,		\
+		13, 13, 24,		\
+	150, 10, 3,		\
+		0, 14, 0,		\
+	159, 22, 3,		\
+		0, 28, 0,		\
+	0, 23, 2,		\
+		18, 0,		\
+	20, 35, 2,		\
+		22, 4,		\
+	22, 20, 2,		\
+		8, 0,		\
+	34, 20, 2,		\
+		0, 25,		\
+	34, 80, 2,		\
+		13, 0,		\
+	35, 0, 2,		\
+		3, 0,		\
+	0x13, 37, 114, 2,		\
+		0, 0,		\
+	0x07, 3, 44, 78, 2,		\
+		35, 0,		\
+	47, 123, 2,		\
+		29, 16,		\
+	49, 126, 2,		\
+		34, 0,		\
+	0x16, 0x17, 0x00, 53, 11,		\
+	0x13, 61, 108, 2,		\
+		16, 6,		\
+	0x07, 13, 72, 126, 2,		\
+		10, 0,		\
+	78, 35, 2,		\
+		0, 21,		\
+	93, 21, 2,		\
+		30, 0,		\
+	100, 81, 2,		\
+		2, 4,		\
+	105, 46, 2,		\
+		8, 36,		\
+	105, 126, 2,		\
+		21, 35,		\
+	110, 72, 2,		\
+		0, 6,		\
+	116, 50, 2,		\
+		8, 28,		\
+	117, 17, 2,		\
+		0, 13,		\
+	126, 55, 2,		\
+		7, 19,		\
+	127, 68, 2,		\
+		36, 19,		\
+	138, 0, 2,		\
+		8, 6,		\
+	145, 106, 2,		\
+		0, 15,		\
+	0x16, 0x65, 0x00, 146, 0,		\
+	0x13, 146, 11, 2,		\
+		13, 13,		\
+	0x07, 4, 146, 67, 2,		\
+		0, 11,		\
+	152, 114, 2,		\
+		20, 0,		\
+	154, 52, 2,		\
+		1, 29,		\
+	156, 37, 2,		\
+		11, 8,		\
+	0x01, 0, 55, 28,		\
+	0x21, 63, 71,		\
+	0x21, 94, 112,		\
+	0x01, 1, 16, 28,		\
+	0x21, 50, 106,		\
+	0x01, 3, 13, 116,		\
+	0x21, 34, 27,		\
+	0x01, 4, 61, 0,		\
+	0x01, 5, 6, 71,		\
+	0x21, 26, 108,		\
+	0x21, 89, 0,		\
+	0x21, 122, 10,		\
+	0x01, 6, 44, 99,		\
+	0x07, 3, 7, 94, 28,		\
+	8, 119, 23,		\
+	12, 61, 12,		\
+	0x21, 135, 30,		\
+	0x21, 137, 66,		\
+	0x01, 13, 114, 115,		\
+	0x21, 137, 57,		\
+	0x01, 15, 20, 51,		\
+	0x21, 81, 4,		\
+	0x01, 16, 24, 69,		\
+	0x21, 99, 4,		\
+	0x01, 17, 4, 71,		\
+	0x21, 39, 52,		\
+	0x21, 144, 42,		\
+	0x01, 19, 101, 66,		\
+	0x21, 106, 115,		\
+	0x21, 140, 14,		\
+	0x01, 20, 12, 5,		\
+	0x21, 141, 95,		\
+	0x01, 22, 123, 7,		\
+	0x01, 24, 61, 20,		\
+	0x21, 120, 86,		\
+	0x01, 25, 82, 62,		\
+	0x07, 4, 29, 147, 56,		\
+	30, 145, 16,		\
+	31, 81, 88,		\
+	32, 61, 119,		\
+	0x21, 63, 58,		\
+	0x01, 37, 126, 60,		\
+	0x21, 135, 42,		\
+	0xff
+
+#endif  //  UIPAT_H_INCLUDED
+
@@ -0,0 +1,242 @@
+/*
+ *  ST7735 Huffman Coded Image (draw with drawHuffImage())
+ *  Original: uipat.png
+ *  Commands: 4696 bytes, coded: 3416 (code tables and bitstream); total 3497 vs. 4796 bytes
+ */
+
+#ifndef UIPAT_HUFF_H_INCLUDED
+#define UIPAT_HUFF_H_INCLUDED
+
+#define UIPAT_WIDTH		160
+#define UIPAT_HEIGHT		128
+#define UIPAT_HUFF_LEN		3497	/*  Total array size  */
+
+#define UIPAT_HUFF		\
+	40,		\
+	0x1c, 0x92,	0x89, 0x00,	0x49, 0xb1,	0x41, 0x76,		\
+	0x1b, 0xf0,	0x93, 0x11,	0x3c, 0x17,	0x69, 0xa2,		\
+	0x2a, 0x5e,	0x7d, 0x7b,	0xd7, 0x5a,	0x64, 0x56,		\
+	0xbb, 0x1c,	0x20, 0x9d,	0x68, 0x7a,	0x6c, 0x46,		\
+	0x5a, 0x2b,	0x58, 0x8d,	0x37, 0x35,	0x3e, 0x10,		\
+	0x1b, 0xc6,	0xc3, 0xe9,	0xb3, 0xe1,	0x0e, 0x6f,		\
+	0xe7, 0x49,	0xb1, 0x3b,	0x3c, 0xee,	0x20, 0xc4,		\
+	0x0b, 0x24,	0x43, 0xb7,	0x38, 0xdc,	0xa6, 0xab,		\
+	0x88, 0x24,	0x3b, 0xa6,	0xf5, 0x74,	0x42, 0xb1,		\
+	0x16, 0x17,	0x6d, 0x7b,	0x12, 0xe4,	0xad, 0x39,		\
+	0x00, 0x00, 0x06, 0x03, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x05, 0x07, 0x21,	\
+	0x22, 0x25, 0x02, 0x03, 0x23, 0x12, 0x13, 0x15, 0xff, 0x00, 0x00, 0x01, 0x02, 0x05, 0x04, 0x1a,	\
+	0x3a, 0x2b, 0x10, 0x03, 0x02, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x00, 0x0a, 0x0b,	\
+	0x0d, 0x0c, 0x0e, 0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x1a, 0x1c, 0x23, 0x27, 0x31,	\
+	0x3d, 0x47, 0x48, 0x4e, 0x56, 0x5a, 0x6a, 0x72, 0x73, 0x74, 0x77, 0x01, 0x17, 0x18, 0x19, 0x1b,	\
+	0x1d, 0x1e, 0x1f, 0x21, 0x22, 0x24, 0x28, 0x2a, 0x30, 0x32, 0x34, 0x36, 0x37, 0x38, 0x39, 0x3a,	\
+	0x3b, 0x3c, 0x3e, 0x42, 0x43, 0x44, 0x46, 0x4d, 0x50, 0x51, 0x53, 0x5c, 0x5e, 0x5f, 0x60, 0x61,	\
+	0x62, 0x63, 0x64, 0x67, 0x6b, 0x6c, 0x6d, 0x71, 0x75, 0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x82,	\
+	0x84, 0x8d, 0x8f, 0x93, 0x9a, 0x20, 0x25, 0x26, 0x29, 0x2b, 0x2c, 0x2d, 0x2f, 0x33, 0x35, 0x3f,	\
+	0x41, 0x45, 0x49, 0x4a, 0x4c, 0x4f, 0x52, 0x54, 0x57, 0x58, 0x59, 0x5d, 0x65, 0x66, 0x68, 0x69,	\
+	0x6e, 0x6f, 0x76, 0x7f, 0x83, 0x86, 0x87, 0x89, 0x8a, 0x8b, 0x8c, 0x91, 0x92, 0x98, 0x9c, 0x9e,	\
+	0x2e, 0x40, 0x70, 0x7d, 0x80, 0x85, 0x88, 0x8e, 0x90, 0x94, 0x95, 0x96, 0x97, 0x9b, 0x9d, 0x9f,	\
+	0x4b, 0x55, 0x5b, 0x99, 0xa5, 0x01, 0x00, 0x00, 0x01, 0x05, 0x0b, 0x08, 0x0a, 0x04, 0x00, 0x00,	\
+	0x00, 0x00, 0x10, 0x06, 0x08, 0x0b, 0x0d, 0x16, 0x01, 0x02, 0x03, 0x0e, 0x11, 0x14, 0x19, 0x1e,	\
+	0x22, 0x23, 0x24, 0x07, 0x09, 0x12, 0x13, 0x15, 0x17, 0x18, 0x21, 0x04, 0x05, 0x0c, 0x0f, 0x1b,	\
+	0x1d, 0x20, 0x25, 0x26, 0x27, 0x0a, 0x1a, 0x1c, 0x1f, 0x3d, 0x61, 0x4f, 0x88, 0x2d, 0xb7, 0x84,	\
+	0xd7, 0x63, 0xe6, 0xac, 0x1e, 0x6d, 0x5f, 0x9b, 0xa6, 0x54, 0xda, 0x80, 0xab, 0x93, 0x35, 0xf2,	\
+	0x53, 0x95, 0xfd, 0x85, 0x39, 0xf7, 0xcc, 0x71, 0x1a, 0xcd, 0x25, 0x94, 0x97, 0x04, 0x58, 0x61,	\
+	0xa1, 0x39, 0xf3, 0x52, 0x8e, 0xdc, 0xc3, 0x47, 0xc1, 0xa5, 0x0f, 0xbf, 0xb6, 0x91, 0x5f, 0x86,	\
+	0x0f, 0xd8, 0xd1, 0x82, 0x95, 0x25, 0xed, 0xa5, 0xc5, 0x45, 0x8b, 0x6b, 0xff, 0xe2, 0x8e, 0x63,	\
+	0x3d, 0x7a, 0xd0, 0x9e, 0xb5, 0x62, 0xb8, 0xdf, 0x7f, 0x52, 0x32, 0xc7, 0xfe, 0x79, 0x03, 0xbf,	\
+	0x64, 0xdc, 0x3c, 0x9d, 0x38, 0x2e, 0x56, 0x3f, 0x88, 0xca, 0x2d, 0xae, 0xb7, 0x76, 0xc5, 0x51,	\
+	0xb7, 0x1c, 0x6e, 0x02, 0x35, 0xed, 0x11, 0xd2, 0xba, 0x3b, 0x7c, 0x29, 0xcd, 0xbe, 0xbc, 0xac,	\
+	0x94, 0x5d, 0x87, 0xeb, 0x83, 0x37, 0xad, 0x05, 0x7f, 0xfd, 0x9e, 0xa8, 0x65, 0x97, 0x70, 0x5d,	\
+	0xe7, 0xd1, 0x13, 0xca, 0xd2, 0x61, 0xd8, 0x53, 0x63, 0xb7, 0xa6, 0x8a, 0xdc, 0x59, 0x0e, 0x37,	\
+	0x86, 0x65, 0x23, 0xf1, 0xa2, 0x88, 0x9d, 0x4e, 0xca, 0x60, 0x6d, 0xdf, 0xa2, 0x1d, 0xa4, 0xc7,	\
+	0x19, 0xc3, 0xd8, 0x63, 0x9d, 0x6c, 0x15, 0xbc, 0x69, 0x4e, 0xaa, 0xde, 0x4b, 0x1b, 0x8d, 0xa0,	\
+	0xb7, 0x1a, 0xac, 0x88, 0x7e, 0xcb, 0x97, 0x53, 0xdd, 0x9c, 0x70, 0xb2, 0x2b, 0x6b, 0x89, 0xac,	\
+	0x71, 0x22, 0x7f, 0x89, 0xb5, 0x5e, 0x67, 0x3f, 0x3d, 0x5e, 0xd3, 0x15, 0xf9, 0x4b, 0x28, 0x9c,	\
+	0xda, 0x88, 0x79, 0xdc, 0x8e, 0x87, 0x9c, 0x1f, 0x8c, 0x32, 0xe2, 0xec, 0x42, 0x2f, 0x19, 0xa1,	\
+	0xce, 0x66, 0x1a, 0x58, 0xfa, 0x79, 0xba, 0xeb, 0xc7, 0x4f, 0x42, 0xe6, 0x30, 0x8b, 0x5b, 0x00,	\
+	0xa7, 0xce, 0x80, 0x5e, 0xbb, 0xf4, 0xae, 0x9d, 0x72, 0x19, 0x75, 0xbf, 0x14, 0x7f, 0x17, 0x2e,	\
+	0x1d, 0xfc, 0xd5, 0x27, 0x21, 0xfa, 0x54, 0xd7, 0xa1, 0x0b, 0x7b, 0xe3, 0x42, 0xea, 0x6d, 0x21,	\
+	0x6f, 0x6a, 0x3a, 0x5d, 0x77, 0xc4, 0xee, 0x46, 0x0b, 0xa5, 0xd6, 0x92, 0x4f, 0x2a, 0xb6, 0x4f,	\
+	0x24, 0xfd, 0xe8, 0x50, 0x9a, 0x4e, 0x67, 0x7e, 0x0e, 0x16, 0x75, 0x47, 0x09, 0xaa, 0xf7, 0xe3,	\
+	0xaa, 0xe8, 0x7f, 0xdc, 0xf4, 0x3e, 0x1c, 0x14, 0x5f, 0x0e, 0x58, 0xc9, 0x44, 0x14, 0x1a, 0xa2,	\
+	0x34, 0xf4, 0x68, 0x46, 0x35, 0x52, 0x6c, 0xd5, 0xc1, 0x1c, 0x3d, 0xe4, 0x69, 0x47, 0xc8, 0x85,	\
+	0x1d, 0x7e, 0x4b, 0x0b, 0xab, 0x21, 0x85, 0xde, 0x90, 0x4c, 0xdb, 0xf3, 0x93, 0x07, 0x81, 0xd1,	\
+	0x6c, 0xd3, 0xa3, 0xf9, 0xa2, 0x1d, 0x45, 0x25, 0x93, 0xa8, 0x34, 0xde, 0x50, 0x49, 0xcd, 0xd1,	\
+	0x49, 0xe6, 0xc4, 0x78, 0x35, 0x2b, 0xc9, 0x75, 0xb0, 0xdc, 0x1c, 0x31, 0xdc, 0x1c, 0x17, 0x24,	\
+	0xab, 0x79, 0x48, 0x3b, 0x7c, 0x14, 0x1c, 0x8c, 0x96, 0xc5, 0xbc, 0xf4, 0x1c, 0xae, 0xd0, 0x6f,	\
+	0xaf, 0x62, 0x1b, 0xd1, 0x40, 0x6f, 0x47, 0xc8, 0x1b, 0xe0, 0xdc, 0x6c, 0x60, 0x4e, 0x0c, 0xbe,	\
+	0x8e, 0x92, 0xeb, 0x98, 0x66, 0x76, 0xe1, 0x27, 0x52, 0x69, 0x26, 0x2b, 0xf3, 0x39, 0x10, 0x8c,	\
+	0xe4, 0xea, 0x85, 0xe4, 0xf3, 0xcc, 0xf3, 0xf3, 0x0c, 0xf6, 0x36, 0x82, 0xfd, 0x13, 0x56, 0x37,	\
+	0x36, 0x82, 0xfd, 0x79, 0x2b, 0x1f, 0x4d, 0x95, 0x89, 0x98, 0x28, 0x2a, 0x9d, 0xa4, 0x16, 0xfd,	\
+	0xfa, 0x0b, 0x96, 0x2a, 0x0a, 0x16, 0xaa, 0x85, 0xae, 0x82, 0x85, 0xc6, 0xfa, 0x85, 0x12, 0x0a,	\
+	0xe3, 0xdc, 0x50, 0xe4, 0xbb, 0x50, 0x6a, 0xc1, 0x22, 0x44, 0x62, 0x3b, 0x7b, 0xd3, 0x2c, 0x2f,	\
+	0x12, 0x46, 0x27, 0x48, 0x27, 0xbd, 0x1c, 0x27, 0xbf, 0x11, 0x22, 0x94, 0x10, 0x9d, 0xab, 0x12,	\
+	0x3d, 0xba, 0x26, 0x5e, 0xbc, 0x43, 0x2f, 0xe9, 0x84, 0x62, 0x7a, 0x04, 0xaf, 0xfa, 0x11, 0xd9,	\
+	0xdf, 0x40, 0xd9, 0x84, 0x11, 0xb5, 0x5a, 0x11, 0xb7, 0x74, 0x11, 0xfd, 0xdd, 0xa0, 0x68, 0x68,	\
+	0x11, 0x79, 0x67, 0x11, 0x72, 0x36, 0x44, 0xde, 0xc9, 0x8c, 0x28, 0x80, 0xf2, 0x2c, 0xc1, 0xce,	\
+	0xd2, 0x07, 0x9d, 0x18, 0x1d, 0x19, 0xa6, 0x38, 0x3a, 0x00, 0xfe, 0x74, 0x4c, 0x7d, 0x61, 0x98,	\
+	0x3e, 0x7c, 0x75, 0xe1, 0x67, 0x3f, 0x9f, 0x65, 0xe5, 0x6d, 0xb4, 0xb2, 0x86, 0x69, 0x3c, 0x59,	\
+	0x08, 0x72, 0xd2, 0xd9, 0xf1, 0x71, 0x78, 0x50, 0x99, 0x56, 0xc6, 0x5f, 0x6a, 0x01, 0x3c, 0x7d,	\
+	0x92, 0x23, 0x0e, 0x5e, 0xba, 0xfa, 0xdc, 0x6b, 0x3f, 0x6d, 0x43, 0x7b, 0x31, 0xb7, 0x98, 0x7a,	\
+	0xc9, 0x7e, 0x2a, 0xb6, 0xc8, 0x35, 0x58, 0xc9, 0x94, 0xd4, 0xe2, 0xf0, 0x0a, 0xbf, 0x1b, 0x55,	\
+	0xc4, 0xdc, 0x6d, 0x43, 0x27, 0x6a, 0x93, 0x30, 0x35, 0x49, 0x8e, 0x63, 0x87, 0x7b, 0x3a, 0x89,	\
+	0x34, 0x4d, 0x0e, 0x63, 0x52, 0x0e, 0x5c, 0x7a, 0x5b, 0x09, 0xc3, 0x0c, 0xb9, 0xdd, 0x58, 0x4d,	\
+	0xe8, 0x4d, 0xc6, 0xea, 0x05, 0xf7, 0xa5, 0x00, 0xe5, 0xde, 0xa8, 0xc5, 0x59, 0xdb, 0xcf, 0x0d,	\
+	0x1c, 0xed, 0x84, 0x33, 0x2f, 0x61, 0xe0, 0xf1, 0x7a, 0x42, 0xa8, 0x6f, 0xa0, 0x1d, 0x7e, 0x50,	\
+	0xd8, 0xdd, 0xf9, 0xba, 0x93, 0x45, 0xc6, 0xfc, 0x39, 0xfd, 0x40, 0x22, 0xf9, 0x41, 0x30, 0x7a,	\
+	0x46, 0xf0, 0x36, 0x9b, 0x17, 0xc0, 0x60, 0xf1, 0xa7, 0x69, 0x5a, 0x9b, 0xa1, 0x25, 0xe2, 0x92,	\
+	0x76, 0x64, 0xa5, 0x9e, 0x7b, 0x73, 0x5e, 0x87, 0xdc, 0xb1, 0xa1, 0x68, 0x13, 0x4e, 0x48, 0x4d,	\
+	0x1f, 0xb8, 0xc1, 0xdb, 0x6e, 0x72, 0x60, 0xda, 0x99, 0x07, 0x09, 0x14, 0x2c, 0xf3, 0x72, 0xba,	\
+	0x80, 0x81, 0x0a, 0x82, 0x0c, 0xda, 0x24, 0x87, 0x1e, 0xd5, 0xd8, 0xbc, 0x78, 0x9b, 0xc7, 0xed,	\
+	0xb6, 0xe2, 0xfa, 0x0e, 0x33, 0x1e, 0x83, 0x6a, 0xb0, 0x94, 0xa4, 0x2f, 0xaa, 0xfc, 0x43, 0xb1,	\
+	0x74, 0x4d, 0xef, 0xac, 0x44, 0x94, 0x47, 0xcc, 0xe8, 0x04, 0xc3, 0xb3, 0x06, 0x7d, 0x7e, 0xdd,	\
+	0xa0, 0xfc, 0xfe, 0x6c, 0x4b, 0x4a, 0x2d, 0x3c, 0x13, 0x07, 0x4b, 0x59, 0x28, 0x7f, 0x6b, 0x6c,	\
+	0xdb, 0x34, 0x71, 0xaf, 0x5b, 0x3b, 0xcb, 0x35, 0x1d, 0x7e, 0x13, 0xa2, 0xda, 0xfc, 0xc8, 0xf7,	\
+	0xfe, 0x6a, 0xb1, 0x87, 0xee, 0xd7, 0x4f, 0x9c, 0x93, 0x3f, 0x57, 0x75, 0xed, 0x75, 0xcd, 0xbb,	\
+	0x80, 0xf5, 0x32, 0x86, 0x2d, 0x9a, 0x38, 0xf3, 0xdb, 0x65, 0x5c, 0xf5, 0xb7, 0xe8, 0xbb, 0x5a,	\
+	0xa8, 0x5f, 0x1b, 0x9a, 0x17, 0x50, 0x85, 0x5b, 0xc0, 0xed, 0x0b, 0xa0, 0x9d, 0x9b, 0xa3, 0x06,	\
+	0xfa, 0x19, 0x70, 0x99, 0x64, 0xb8, 0xc8, 0x29, 0x72, 0x9e, 0x9b, 0xe9, 0xf9, 0x44, 0xe7, 0x9f,	\
+	0x28, 0x9c, 0xf0, 0xe5, 0x38, 0x3c, 0x79, 0x4c, 0x1b, 0x13, 0xc2, 0x6e, 0x5c, 0x40, 0xd8, 0xca,	\
+	0x06, 0x79, 0x7a, 0xaf, 0x54, 0x2e, 0xdd, 0xea, 0x01, 0xbb, 0x5b, 0x31, 0x68, 0x38, 0xf3, 0xe8,	\
+	0x3a, 0xcb, 0xa7, 0x9c, 0x6e, 0xdf, 0x2e, 0x60, 0x72, 0xe9, 0xeb, 0xa4, 0x8f, 0x8c, 0x6e, 0x93,	\
+	0xc4, 0x5c, 0xae, 0x92, 0x12, 0x69, 0xf2, 0xe6, 0xb8, 0xe5, 0xf7, 0xdf, 0xc4, 0x34, 0xf7, 0xe1,	\
+	0x67, 0x04, 0xfd, 0xf8, 0x6f, 0x51, 0xc3, 0xd0, 0x6d, 0x1f, 0x0b, 0xc8, 0x83, 0x97, 0x0d, 0x2a,	\
+	0xf6, 0xf3, 0x0d, 0xbe, 0x29, 0x06, 0xaf, 0x76, 0x2b, 0x07, 0xf9, 0x68, 0x49, 0xe1, 0xb3, 0x0b,	\
+	0xe4, 0xc5, 0x50, 0xfd, 0xe4, 0x28, 0x7d, 0xad, 0xc2, 0xb8, 0xfa, 0x01, 0x07, 0xb6, 0x44, 0x68,	\
+	0x22, 0xd7, 0x5d, 0x04, 0x9d, 0xe8, 0xd5, 0x53, 0x2e, 0x95, 0x54, 0x2a, 0xf8, 0xf7, 0xcc, 0x1a,	\
+	0xfe, 0x68, 0x53, 0xfb, 0x47, 0x51, 0x8d, 0xa7, 0x23, 0x3c, 0x74, 0xea, 0x79, 0x49, 0xff, 0x12,	\
+	0x04, 0x4a, 0x3a, 0x4e, 0x97, 0x18, 0x36, 0x51, 0xa8, 0xd9, 0x7b, 0x62, 0x1a, 0xb8, 0x43, 0x82,	\
+	0xd1, 0xfa, 0x4a, 0x33, 0xf3, 0x2d, 0x7d, 0x84, 0x8c, 0xeb, 0x1b, 0x3d, 0x59, 0x2a, 0x4a, 0x64,	\
+	0xde, 0x52, 0xf1, 0x86, 0xd5, 0x84, 0xa0, 0xd4, 0x15, 0x16, 0x2b, 0x90, 0x3b, 0xa7, 0x03, 0xf4,	\
+	0xb2, 0x7f, 0x02, 0x93, 0xdc, 0x53, 0x7a, 0xd2, 0x1e, 0x58, 0x6b, 0x3c, 0x94, 0xd3, 0xc6, 0xb5,	\
+	0x9c, 0xdd, 0x6d, 0x9e, 0xfd, 0xe6, 0x34, 0xd2, 0xd0, 0xf9, 0x7d, 0xac, 0x35, 0xcf, 0x8e, 0xba,	\
+	0xc7, 0xaa, 0x4a, 0x54, 0xed, 0x35, 0x3d, 0x69, 0x51, 0x62, 0xaa, 0x3c, 0x25, 0x65, 0xe1, 0xab,	\
+	0x33, 0xe6, 0xc8, 0x7f, 0x3a, 0x16, 0x2e, 0xce, 0x29, 0xae, 0xcb, 0x4b, 0x56, 0xf2, 0x2e, 0x3f,	\
+	0x1b, 0x19, 0xd3, 0xd5, 0x72, 0x41, 0xc7, 0x56, 0x65, 0x3b, 0x75, 0x79, 0x65, 0xd8, 0x46, 0x8b,	\
+	0x8e, 0xb4, 0x85, 0xdc, 0x2d, 0xe7, 0x3d, 0x6f, 0x6e, 0xd5, 0x02, 0x3a, 0xb1, 0xfc, 0x2a, 0xcf,	\
+	0xbe, 0x96, 0x95, 0x84, 0xea, 0x51, 0x83, 0x2d, 0x68, 0xbf, 0x96, 0xba, 0x4d, 0xe4, 0xf2, 0xe9,	\
+	0xd6, 0xcf, 0x26, 0x24, 0x09, 0x9b, 0x88, 0xa9, 0xab, 0x4d, 0x59, 0x76, 0xb6, 0x8b, 0x33, 0xc4,	\
+	0xcb, 0xa6, 0xf2, 0x9f, 0xb4, 0xb7, 0x93, 0xf7, 0xbe, 0x79, 0x3d, 0xd7, 0xcd, 0xcf, 0xd2, 0xe1,	\
+	0x79, 0x83, 0xf8, 0xd0, 0xb5, 0x93, 0x3a, 0x2f, 0x6f, 0xcb, 0x7e, 0xa2, 0xe3, 0x43, 0x7c, 0x78,	\
+	0x0e, 0xfa, 0xb1, 0xde, 0x65, 0x78, 0x5c, 0xc2, 0x53, 0x79, 0x53, 0x9b, 0xde, 0xa4, 0xdb, 0x4f,	\
+	0x58, 0xd5, 0x56, 0x55, 0xf4, 0x33, 0x83, 0x61, 0x96, 0xd4, 0x97, 0xd1, 0xc7, 0x5c, 0xb3, 0x5c,	\
+	0xee, 0x6a, 0xfd, 0x58, 0x4b, 0xfa, 0x51, 0x5d, 0xbd, 0x05, 0x5f, 0xe5, 0xaa, 0x5b, 0xaa, 0xeb,	\
+	0x75, 0x15, 0xab, 0x98, 0xad, 0x8a, 0xeb, 0xe7, 0x9d, 0x2f, 0xce, 0xc4, 0x48, 0xc0, 0x5a, 0xa6,	\
+	0x2f, 0x1f, 0x61, 0x7b, 0xb6, 0xd6, 0x43, 0x3b, 0x6b, 0xbe, 0xce, 0xad, 0xcd, 0x56, 0xda, 0x1f,	\
+	0x35, 0xee, 0xe9, 0x27, 0xa2, 0xbd, 0x9f, 0x16, 0x7b, 0x7d, 0xf8, 0x60, 0xab, 0x6f, 0xb9, 0x82,	\
+	0xe6, 0xdd, 0x4f, 0x29, 0xcd, 0xc7, 0x9f, 0xaa, 0xce, 0xa3, 0x98, 0xad, 0xa7, 0xd6, 0x4b, 0x3b,	\
+	0xd9, 0x21, 0x7d, 0xee, 0xc0, 0x5e, 0xd7, 0x85, 0x70, 0xfb, 0xe2, 0xf9, 0xde, 0xf8, 0x9b, 0x7f,	\
+	0x67, 0xa0, 0x36, 0x07, 0xc0, 0x76, 0x3e, 0x00, 0xb1, 0x5f, 0xd5, 0x0c, 0x88, 0xe5, 0x11, 0x11,	\
+	0x11, 0x11, 0x11, 0x11, 0xf9, 0x1f, 0x6a, 0x9e, 0xb1, 0xb0, 0x16, 0x73, 0x98, 0x38, 0xdc, 0x24,	\
+	0x56, 0xba, 0xeb, 0xfd, 0xff, 0x57, 0x5d, 0x75, 0xad, 0x75, 0xf5, 0xd6, 0x66, 0xc2, 0x84, 0x44,	\
+	0x44, 0x61, 0xf3, 0x11, 0x11, 0x11, 0x1e, 0x5a, 0xa1, 0x5b, 0xcb, 0x7d, 0xf7, 0xdf, 0x7d, 0xf7,	\
+	0xdf, 0x7d, 0xe5, 0xbf, 0xe7, 0x10, 0x2a, 0xb8, 0x56, 0xb5, 0xad, 0x6b, 0x5a, 0xe1, 0x5a, 0xd7,	\
+	0xe1, 0x20, 0x2a, 0x94, 0xa5, 0x29, 0x4f, 0x8a, 0x52, 0x9c, 0xa9, 0x4a, 0x35, 0x7a, 0x91, 0xcf,	\
+	0x9f, 0x3e, 0x7c, 0xf9, 0xf3, 0xc0, 0x88, 0x93, 0xd5, 0x48, 0xd3, 0x4d, 0xc3, 0x80, 0xbe, 0xdd,	\
+	0x48, 0x8f, 0xa8, 0x88, 0x88, 0x88, 0xe9, 0x11, 0xdd, 0xd0, 0x32, 0x02, 0xe0, 0xf5, 0xcc, 0xba,	\
+	0x09, 0xf1, 0x39, 0xce, 0x76, 0x9c, 0xfb, 0xce, 0x73, 0xce, 0xaa, 0x64, 0x74, 0x03, 0x7d, 0xf7,	\
+	0xd3, 0xcc, 0x32, 0xc7, 0x1c, 0x71, 0xc7, 0xff, 0x8e, 0x38, 0xe3, 0xcb, 0x1f, 0x2e, 0xa0, 0x4d,	\
+	0xb1, 0xc7, 0x1c, 0x71, 0xc7, 0x1e, 0x31, 0xc7, 0x16, 0xb5, 0xd0, 0x00, 0xf6, 0x3c, 0x23, 0x65,	\
+	0x00, 0x3a, 0x07, 0x7f, 0x1d, 0x6a, 0x00, 0x0f, 0x43, 0x52, 0xb1, 0x03, 0xf8, 0x07, 0xb1, 0xec,	\
+	0xbc, 0x40, 0x7c, 0x05, 0x29, 0x4e, 0xbf, 0x4c, 0x30, 0x8a, 0x7a, 0xd2, 0x94, 0xa5, 0x3d, 0xa9,	\
+	0x45, 0xde, 0x91, 0x44, 0x44, 0x44, 0x44, 0x79, 0xb2, 0x7e, 0x45, 0xda, 0xb5, 0xad, 0x6b, 0x5a,	\
+	0xfa, 0xd0, 0xdd, 0x22, 0xcb, 0x2f, 0x7c, 0xb2, 0xcb, 0x2e, 0x99, 0x3e, 0xd2, 0x31, 0xab, 0x90,	\
+	0x21, 0x66, 0x98, 0xdb, 0x6e, 0xfb, 0x6d, 0xb6, 0xdc, 0xad, 0xaf, 0x4c, 0x7a, 0xe9, 0xa7, 0x6d,	\
+	0x34, 0xd3, 0xf2, 0xef, 0xd2, 0x63, 0xd6, 0x22, 0x22, 0x23, 0xae, 0x27, 0x88, 0xc6, 0xc0, 0x32,	\
+	0xe2, 0x18, 0x01, 0xb7, 0x0c, 0x90, 0x74, 0xa5, 0x29, 0xde, 0x9f, 0x54, 0xf6, 0xf5, 0xc1, 0x9d,	\
+	0x81, 0xc5, 0xd9, 0x07, 0x9e, 0x79, 0xe7, 0x9f, 0x9c, 0xf3, 0xe4, 0xb9, 0x06, 0x79, 0x3a, 0x1f,	\
+	0x47, 0x41, 0xeb, 0xae, 0x7a, 0xeb, 0xae, 0xba, 0xb5, 0xe6, 0x04, 0x2f, 0x21, 0x78, 0x08, 0x75,	\
+	0xeb, 0xd7, 0xaf, 0x5e, 0xb8, 0x1d, 0xf0, 0x43, 0xa1, 0x81, 0x50, 0x86, 0xb1, 0x11, 0x11, 0x91,	\
+	0x1c, 0x11, 0xfd, 0x19, 0xb7, 0x44, 0x27, 0x39, 0xce, 0x7e, 0x68, 0xec, 0x10, 0xad, 0x6b, 0x5f,	\
+	0xda, 0xd3, 0xe9, 0x02, 0xe3, 0x8e, 0x37, 0xe3, 0x8a, 0x9e, 0x42, 0x15, 0xad, 0x62, 0xb5, 0xf8,	\
+	0xee, 0x10, 0xd0, 0x3a, 0x71, 0xd8, 0x02, 0xf6, 0xd7, 0x5d, 0x70, 0xd7, 0xe5, 0x20, 0x85, 0x29,	\
+	0x4a, 0x45, 0x3f, 0xcb, 0x32, 0x14, 0xc2, 0x94, 0xa5, 0x06, 0x38, 0x00, 0x9b, 0x00, 0x1a, 0x15,	\
+	0xf8, 0x80, 0x4a, 0x5c, 0xa5, 0x1b, 0x34, 0x0e, 0xbd, 0x7a, 0xed, 0x85, 0x5e, 0x06, 0xa3, 0xae,	\
+	0xe8, 0x06, 0x6c, 0x7e, 0xf8, 0x16, 0xb7, 0x4b, 0x78, 0xaa, 0x01, 0x96, 0xb9, 0x65, 0xa3, 0xa6,	\
+	0x03, 0xb1, 0xa5, 0xbe, 0x06, 0xfb, 0xfd, 0x6f, 0xb1, 0x82, 0x07, 0xe7, 0xe7, 0xe6, 0x75, 0x6e,	\
+	0xc0, 0x9f, 0x99, 0xce, 0xac, 0xd0, 0x14, 0x38, 0x5a, 0x02, 0x52, 0x95, 0x3e, 0x19, 0x20, 0x76,	\
+	0x1c, 0x51, 0x80, 0xc2, 0xb5, 0xaf, 0xf1, 0x04, 0x0d, 0x5d, 0x35, 0xe5, 0x86, 0x03, 0xff, 0xed,	\
+	0xcf, 0xfb, 0x90, 0x05, 0x38, 0xa5, 0x3c, 0xc6, 0x7c, 0xfc, 0x5e, 0x06, 0xa0, 0x5b, 0x22, 0x83,	\
+	0xa3, 0x20, 0xd8, 0x2b, 0xa3, 0xb9, 0xe2, 0xd6, 0xb5, 0xad, 0xeb, 0x6b, 0x5b, 0x0a, 0xfc, 0x17,	\
+	0x34, 0xd3, 0x4d, 0x34, 0xd3, 0x96, 0x9a, 0x69, 0xa5, 0xaf, 0x75, 0xc0, 0xe3, 0x00, 0xc7, 0xa1,	\
+	0x6a, 0xe6, 0x59, 0xe7, 0x9e, 0x79, 0xf7, 0xcf, 0x3c, 0xfd, 0x75, 0xb4, 0x1c, 0xba, 0xeb, 0xae,	\
+	0xde, 0xeb, 0xae, 0xba, 0x73, 0xc7, 0xd0, 0x6d, 0x21, 0x20, 0xc9, 0x98, 0xdc, 0xa5, 0x29, 0x4a,	\
+	0x5f, 0x32, 0x94, 0xb6, 0xa3, 0xb7, 0xe0, 0x0f, 0x63, 0x8f, 0xcc, 0xdc, 0xe7, 0x39, 0xcf, 0xe2,	\
+	0x73, 0x9c, 0xfa, 0xbc, 0xe6, 0x1c, 0x01, 0x3e, 0xc5, 0x83, 0xe8, 0x14, 0x7c, 0x8c, 0xad, 0x6b,	\
+	0x5a, 0xd7, 0xea, 0xb5, 0xae, 0xc6, 0x5f, 0xdc, 0xa5, 0x2f, 0x99, 0x4a, 0x51, 0xaf, 0x17, 0x6b,	\
+	0x5a, 0xd6, 0xfc, 0xb5, 0xa5, 0x4d, 0x58, 0x3c, 0x1d, 0x8b, 0x55, 0x84, 0xc6, 0x76, 0x42, 0xe5,	\
+	0x29, 0x7f, 0xe5, 0x29, 0x38, 0x37, 0x96, 0x1d, 0x8c, 0x38, 0x4d, 0x75, 0xad, 0x6b, 0x95, 0x6b,	\
+	0x5f, 0xa5, 0x45, 0x9c, 0xc1, 0x0e, 0x9a, 0xbf, 0xce, 0xc1, 0x7b, 0x60, 0xa3, 0xfc, 0x12, 0xf5,	\
+	0x55, 0x11, 0x11, 0xda, 0x23, 0x90, 0xd4, 0x3a, 0x75, 0x1a, 0x4a, 0x41, 0x65, 0xb4, 0x9b, 0x82,	\
+	0xf5, 0xdd, 0xa6, 0xd6, 0xb5, 0xad, 0xa3, 0xfa, 0xf4, 0xe4, 0x0b, 0x18, 0xa9, 0xf7, 0x05, 0xe6,	\
+	0x6a, 0x46, 0x1e, 0xec, 0x3d, 0xe4, 0xeb, 0x11, 0x11, 0x13, 0x7c, 0x89, 0x2c, 0x28, 0x66, 0x24,	\
+	0xb0, 0xd6, 0x62, 0x65, 0x84, 0xa5, 0x94, 0xb6, 0xf2, 0x13, 0xb4, 0x6d, 0xb6, 0xdb, 0x6f, 0x7a,	\
+	0x92, 0xd0, 0x3d, 0xf2, 0xd3, 0xd6, 0x94, 0xa5, 0x38, 0xf9, 0x40, 0x4e, 0xb8, 0x6b, 0xae, 0xbc,	\
+	0xf9, 0x6b, 0xd2, 0x3c, 0x1c, 0xb3, 0x53, 0xef, 0x9e, 0x79, 0xe7, 0x9a, 0xde, 0xa3, 0x90, 0x59,	\
+	0xd2, 0x46, 0x01, 0x6b, 0xaa, 0x80, 0x73, 0xac, 0x50, 0x09, 0x3d, 0x64, 0x0e, 0xbf, 0x16, 0xf8,	\
+	0x08, 0x72, 0x17, 0x1a, 0xa8, 0x88, 0xff, 0x47, 0x99, 0x55, 0x88, 0xe6, 0x13, 0xb7, 0x11, 0x96,	\
+	0x59, 0x5f, 0x97, 0x17, 0x81, 0x19, 0xfa, 0xe7, 0x9e, 0x75, 0x8f, 0x8c, 0x7f, 0xd7, 0xcf, 0x3b,	\
+	0x5a, 0xda, 0x3a, 0xe1, 0xe6, 0xf4, 0x3b, 0x48, 0xc6, 0x6f, 0x71, 0xce, 0x22, 0x3d, 0xad, 0x24,	\
+	0x1e, 0x79, 0xd3, 0x0b, 0x6f, 0x01, 0xf7, 0xeb, 0xd7, 0xaf, 0x4a, 0x51, 0x8f, 0xd9, 0x4e, 0x9d,	\
+	0xf9, 0xdf, 0x7f, 0x62, 0x89, 0xe1, 0xf7, 0xf7, 0x19, 0x36, 0xe6, 0x3b, 0xcf, 0xdd, 0x36, 0x59,	\
+	0x65, 0x9b, 0xe8, 0x3f, 0xae, 0xe6, 0x9e, 0xb1, 0xe3, 0x8f, 0xc6, 0x3e, 0x79, 0x27, 0xc7, 0x1f,	\
+	0x3c, 0x7a, 0xfa, 0xe6, 0xf4, 0x3d, 0xb6, 0x67, 0x4a, 0x53, 0xc7, 0x23, 0x0c, 0xf0, 0x73, 0x58,	\
+	0xa0, 0x7f, 0x70, 0x5f, 0xdb, 0x5a, 0xd3, 0x3c, 0xbc, 0x75, 0xeb, 0x8d, 0x74, 0x5e, 0x3c, 0x32,	\
+	0x3c, 0x25, 0x85, 0xad, 0x3f, 0x30, 0x87, 0x7e, 0xe8, 0x86, 0x86, 0x79, 0x31, 0x6a, 0x11, 0x0a,	\
+	0x99, 0xe5, 0x74, 0xe7, 0x56, 0x29, 0x1c, 0xb6, 0xf5, 0xc9, 0x37, 0xe5, 0x84, 0x4c, 0x9e, 0xcb,	\
+	0xe2, 0xe4, 0x71, 0xf6, 0xcb, 0x3c, 0xff, 0x78, 0xf3, 0x8b, 0x3c, 0xf2, 0xe4, 0xde, 0x2a, 0x9f,	\
+	0x59, 0x65, 0x75, 0x28, 0x77, 0xe2, 0x57, 0x26, 0x58, 0x8f, 0xaa, 0xe9, 0x42, 0xd6, 0x8d, 0x08,	\
+	0x3e, 0xad, 0x2c, 0x45, 0xb0, 0x93, 0x4c, 0x78, 0x4a, 0xec, 0x87, 0xec, 0xae, 0xf0, 0x7e, 0x5e,	\
+	0x59, 0x0c, 0xf3, 0xeb, 0xc7, 0x1b, 0xb1, 0xb6, 0x04, 0xbf, 0x31, 0xf4, 0x41, 0x37, 0x0c, 0x31,	\
+	0x9d, 0xa2, 0x38, 0x77, 0xad, 0x46, 0x0e, 0xf7, 0x44, 0x37, 0xf1, 0x7e, 0x23, 0xbe, 0x5b, 0x1f,	\
+	0xf4, 0x7b, 0x5f, 0xb1, 0x54, 0x56, 0xb4, 0xa0, 0x0f, 0xe3, 0x67, 0x44, 0x4e, 0x7b, 0x95, 0x46,	\
+	0x2e, 0x0b, 0x81, 0x73, 0x83, 0xa6, 0x3b, 0xb8, 0x6c, 0x81, 0xc4, 0x62, 0xbe, 0x9f, 0x4b, 0x21,	\
+	0x37, 0xda, 0x48, 0xc2, 0x9f, 0x6e, 0x98, 0x9d, 0x3e, 0xdd, 0x91, 0xd3, 0x3f, 0x69, 0xf9, 0x1e,	\
+	0xd6, 0xb5, 0xaf, 0xd5, 0x78, 0xf3, 0x5a, 0xd6, 0xbf, 0x75, 0x5b, 0x3b, 0x54, 0x5e, 0xdd, 0x75,	\
+	0xf7, 0x5c, 0x1b, 0x83, 0xb8, 0xee, 0xc4, 0x44, 0x44, 0x52, 0x22, 0x22, 0x22, 0xba, 0x63, 0xc8,	\
+	0x88, 0x89, 0x46, 0x91, 0x11, 0x11, 0xce, 0xc2, 0x72, 0xed, 0x05, 0xe1, 0xed, 0xa6, 0x6e, 0x06,	\
+	0x83, 0xd4, 0xf5, 0xf6, 0x1c, 0xbc, 0x1e, 0xc1, 0xfa, 0xe7, 0x39, 0xf1, 0x39, 0xce, 0x73, 0xf4,	\
+	0x9c, 0xe7, 0x37, 0xbf, 0xf9, 0xb0, 0x77, 0x1e, 0x90, 0xae, 0x1b, 0xb5, 0xad, 0x6f, 0x6b, 0x5a,	\
+	0xd6, 0xb7, 0x87, 0x2d, 0xbb, 0xef, 0xbe, 0x2f, 0xbe, 0xfb, 0xef, 0x56, 0x55, 0x64, 0x45, 0x22,	\
+	0x22, 0x22, 0x1e, 0x55, 0x64, 0x44, 0x65, 0x11, 0x11, 0x1c, 0xc9, 0x8c, 0x0c, 0x42, 0xf0, 0xd9,	\
+	0x88, 0x7f, 0x4f, 0xe4, 0xcc, 0x36, 0x02, 0x06, 0xbe, 0x5b, 0x2f, 0xbe, 0xfb, 0xef, 0xbf, 0xc5,	\
+	0xf7, 0xd2, 0xae, 0x60, 0xe4, 0x0a, 0x52, 0x59, 0xc7, 0x1c, 0x76, 0xe3, 0x8e, 0x38, 0xe2, 0x9d,	\
+	0x56, 0x55, 0xb1, 0xe4, 0x7a, 0x5b, 0x60, 0xf9, 0x06, 0xdd, 0x56, 0x3f, 0xe7, 0x91, 0xdb, 0xfc,	\
+	0x92, 0xca, 0x53, 0x6a, 0x7c, 0x52, 0x94, 0xa7, 0xfb, 0x55, 0x9d, 0xfb, 0xf7, 0xef, 0xfb, 0xfb,	\
+	0xfb, 0xfb, 0xfb, 0xcc, 0x90, 0xbb, 0x5a, 0xd6, 0xb6, 0x56, 0xbf, 0xb9, 0xa8, 0xb3, 0x98, 0x20,	\
+	0x21, 0x43, 0xdc, 0x73, 0xb5, 0xd4, 0x73, 0x0e, 0x8f, 0x59, 0x40, 0x65, 0x8b, 0x1d, 0x4f, 0x20,	\
+	0xcb, 0xa8, 0xac, 0xb2, 0xcb, 0xdb, 0x2c, 0xb2, 0x9f, 0xd1, 0x50, 0xe0, 0x6b, 0xc9, 0x57, 0x1c,	\
+	0x71, 0xc7, 0xe7, 0x1c, 0x7a, 0x30, 0x55, 0x39, 0xcf, 0xe6, 0x73, 0x9d, 0x26, 0x95, 0xca, 0x52,	\
+	0x94, 0xbb, 0x4a, 0xa4, 0x05, 0x07, 0x93, 0xf3, 0xb9, 0x51, 0x80, 0x7c, 0x22, 0x2b, 0xc5, 0x7e,	\
+	0x6b, 0x5a, 0xd5, 0x18, 0x89, 0xf3, 0x11, 0x11, 0x15, 0xbe, 0x34, 0xf2, 0xdb, 0x6d, 0xb6, 0xda,	\
+	0xdb, 0x71, 0x3e, 0x01, 0x89, 0x25, 0x27, 0x21, 0xa3, 0xb8, 0x9d, 0xf7, 0x6f, 0xbe, 0xfa, 0x56,	\
+	0x89, 0xe3, 0x8e, 0x38, 0xf7, 0xe3, 0xcc, 0xf9, 0x2b, 0x82, 0x34, 0xa4, 0x5f, 0x6b, 0x5a, 0xd2,	\
+	0x64, 0xa3, 0x4d, 0x34, 0xd3, 0xcd, 0xcb, 0xa8, 0xbe, 0xfb, 0xef, 0xf1, 0x7f, 0x39, 0x01, 0x4f,	\
+	0xf9, 0x31, 0x12, 0x97, 0xec, 0xa5, 0xdc, 0xb7, 0x41, 0x91, 0x93, 0xd2, 0x47, 0x8f, 0x1c, 0xbc,	\
+	0x78, 0xcb, 0x7e, 0x85, 0x84, 0xfb, 0x24, 0x79, 0x0c, 0xe9, 0xa8, 0x94, 0xb8, 0x94, 0xbc, 0x93,	\
+	0x51, 0xef, 0xef, 0xee, 0x55, 0xa2, 0x8b, 0xae, 0xba, 0xeb, 0xb7, 0xb5, 0xd0, 0x16, 0xe0, 0xd6,	\
+	0x40, 0x69, 0xec, 0xb2, 0x42, 0x94, 0xa6, 0x1f, 0xaf, 0x41, 0x14, 0xbe, 0x94, 0xa7, 0xfb, 0x7e,	\
+	0x8e, 0x74, 0xa5, 0x28, 0xae, 0xe1, 0xff, 0xa2, 0x22, 0x2d, 0x99, 0xda, 0xdf, 0xcb, 0x5a, 0x49,	\
+	0x3b, 0x5a, 0xd6, 0xea, 0xd9, 0x1e, 0x7a, 0x69, 0xa6, 0x14, 0x03, 0xc0, 0x4b, 0xb3, 0x33, 0xc3,	\
+	0x19, 0xf9, 0x8f, 0xfe, 0x3e, 0xd9, 0xf6, 0x88, 0x8c, 0xfc, 0xf3, 0x74, 0x28, 0xf6, 0x8d, 0xf8,	\
+	0x0c, 0xb2, 0xf9, 0x22, 0x02, 0x3f, 0x95, 0xf7, 0xc5, 0xb6, 0x1a, 0x73, 0xa3, 0x13, 0xf8, 0x93,	\
+	0x84, 0x5a, 0x68, 0xe8, 0xde, 0x91, 0xbd, 0xcd, 0xb1, 0x71, 0x9e, 0x78, 0x46, 0x47, 0x79, 0xba,	\
+	0x85, 0x11, 0x6e, 0xde, 0x09, 0x4c, 0xd4, 0x9c, 0x5e, 0xa6, 0xf6, 0xf1, 0x50, 0xe1, 0x41, 0x56,	\
+	0xbe, 0x3f, 0x96, 0xc9, 0x8b, 0xfd, 0x8a, 0x4f, 0xf1, 0xaa, 0xd1, 0xd1, 0x0e, 0x40, 0xb7, 0xa4,	\
+	0x58, 0x62, 0x6b, 0x58, 0x61, 0xa5, 0xae, 0x48, 0xaa, 0x43, 0x43, 0x07, 0x36, 0x90, 0x3a, 0x33,	\
+	0x86, 0xee, 0x9e, 0xe8, 0xf9, 0x89, 0x5b, 0xe3, 0x67, 0x55, 0xc0, 0x4b, 0xd6, 0x11, 0x29, 0xbb,	\
+	0xe3, 0xf8, 0x9d, 0x20, 0x3b, 0x78, 0xa2, 0x0d, 0x5a, 0x79, 0x42, 0xff, 0x4f, 0x37, 0xdc, 0x27,	\
+	0xc7, 0x9b, 0x7c, 0x76, 0xdf, 0xcf, 0x34, 0x25, 0x52, 0xe8, 0x4f, 0xfd, 0xb3, 0x00, 0x2b, 0xbf,	\
+	0x7a, 0x39, 0x75, 0xf5, 0x63, 0x0e, 0x3a, 0xfb, 0xda, 0x13, 0x97, 0xca, 0x88, 0x7b, 0xfc, 0xda,	\
+	0x07, 0xcd, 0xc1, 0x5a, 0xfc, 0xf1, 0x42, 0x9f, 0x4a, 0x43, 0x37, 0x2d, 0xd8, 0xbb, 0xe7, 0xeb,	\
+	0xcd, 0x14, 0x98, 0x5e, 0xc7, 0x7d, 0x69, 0x8f, 0x37, 0xf0, 0x17, 0x3f, 0x8e, 0xee, 0xa8, 0x8c,	\
+	0x1d, 0xa8, 0xed, 0x6c, 0x07, 0xa4, 0xb6, 0x87, 0xaa, 0x66, 0x38, 0xda, 0xcf, 0xc2, 0xd3, 0xdc,	\
+	0x6c, 0x4b, 0xa3, 0xa4, 0x8b, 0x96, 0x6c, 0x79, 0xd5, 0xad, 0xf6, 0x96, 0xf1, 0xfb, 0x6c, 0x9f,	\
+	0xbb, 0x10, 0x56, 0x95, 0x37, 0xee, 0xbf, 0x1e, 0xf0, 0xfa, 0x8f, 0x28, 0xc4, 0x57, 0x76, 0x1e,	\
+	0x91, 0x8c, 0x8e, 0x63, 0x93, 0x76, 0xff, 0x6b, 0x81, 0xd7, 0xc7, 0x88, 0xe8, 0xd3, 0x7f, 0x17,	\
+	0xa3, 0x37, 0x88, 0x7c, 0x59, 0xc2, 0xdb, 0xaa, 0x1e, 0x25, 0xc3, 0x7b, 0x53, 0xc6, 0x9d, 0xdc,	\
+	0x34, 0x7f, 0x3c, 0x97, 0xda, 0xfc, 0x9f, 0xff, 0xf2, 0xbc, 0x1f, 0x52, 0xea, 0xbe, 0xb6, 0x00,	\
+	0xfb, 0xdf, 0xc2, 0x7e, 0xdb, 0x8f, 0xc0, 0x00
+
+#endif  //  UIPAT_HUFF_H_INCLUDED
+
@@ -0,0 +1 @@
+//	Stand-in for <avr/cpufunc.h> in host builds (nothing used)
@@ -0,0 +1,14 @@
+//	Stand-in for <avr/io.h> in host builds: just the port the
+//	driver's reset pin uses (see project.h)
+#ifndef HOST_AVR_IO_H
+#define HOST_AVR_IO_H
+
+#include <stdint.h>
+
+typedef struct {
+	volatile uint8_t OUT, OUTSET, OUTCLR;
+} PORT_t;
+
+extern PORT_t PORTD;
+
+#endif // HOST_AVR_IO_H
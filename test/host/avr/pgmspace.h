@@ -0,0 +1,35 @@
+//	Stand-in for <avr/pgmspace.h> in host builds: flash is ordinary
+//	memory, and the host is little-endian, like the AVR.  Words may be at
+//	odd addresses (palettes in images), so they're copied, not dereferenced.
+#ifndef HOST_AVR_PGMSPACE_H
+#define HOST_AVR_PGMSPACE_H
+
+#include <stdint.h>
+#include <string.h>
+
+#define PROGMEM
+#define pgm_read_byte(a)	(*(const uint8_t*)(a))
+#define pgm_read_word(a)	hostReadWord(a)
+#define pgm_read_dword(a)	hostReadDword(a)
+#define pgm_read_ptr(a)		(*(void* const*)(a))
+#define memcpy_P			memcpy
+
+static inline uint16_t hostReadWord(const void* a) {
+
+	uint16_t w;
+
+	memcpy(&w, a, sizeof(w));
+	return w;
+
+}
+
+static inline uint32_t hostReadDword(const void* a) {
+
+	uint32_t d;
+
+	memcpy(&d, a, sizeof(d));
+	return d;
+
+}
+
+#endif // HOST_AVR_PGMSPACE_H
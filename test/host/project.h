@@ -0,0 +1,22 @@
+//	Project header for host builds (see ../Makefile): the SPI macros
+//	drive a model of the panel (spi_model.c) rather than hardware.
+//	Reads work as on the real bus: SPI_DATA, read right after a write,
+//	returns the byte received during the previous transfer.
+#include <avr/io.h>
+#include "spi_model.h"
+
+#define BIT_SPI_RS		(1 << 6)
+#define PORT_SPI_RS		PORTD
+#define SPI_DATA		(*spiModelData())
+#define SPI_CSON()		spiModelCs(true)
+#define SPI_CSOFF()		spiModelCs(false)
+#define SPI_DC_DATA()	spiModelDc(true)
+#define SPI_DC_CMD()	spiModelDc(false)
+#define SPI_TXWAIT()	spiModelWait()
+#define ST7735_BENCH(tag)	spiModelMark(tag)
+
+//	Bus trace (make trace): ST7735_TRACE() events to a file, see trace.c
+#ifdef HOST_TRACE
+#include "trace.h"
+#define ST7735_TRACE(kind, value)	traceRecord(kind, value)
+#endif // HOST_TRACE
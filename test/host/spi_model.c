@@ -0,0 +1,379 @@
+/*
+ *	Host model of an ST7735 on the SPI bus; see spi_model.h.
+ */
+
+#include <string.h>
+#include "spi_model.h"
+#include "st7735.h"
+
+#define MISO_IDLE			0xff	//	Nothing driving MISO
+#define MISO_DUMMY			0xa5	//	Dummy byte clocked before read data
+#define REPLY_MAX			8
+#define REPLY_LEN			8
+
+typedef struct {
+	uint8_t cmd, len;
+	uint8_t data[REPLY_LEN];
+} Reply;
+
+SpiModel spiModel;
+PORT_t PORTD;
+
+static uint32_t gram[SPI_MODEL_GRAM][SPI_MODEL_GRAM];	//	[ra][ca]
+static Reply replies[REPLY_MAX];
+static uint8_t replyCount;
+static uint8_t dc;				//	D/C at data
+static uint8_t reg;				//	SPI data register
+static uint8_t rxPending;		//	Byte received during the last transfer
+static bool written;			//	reg written, waiting for the read back
+static bool waited;				//	SPI_TXWAIT() since the last byte
+static volatile uint8_t* csPort;	//	Pins sampled per byte (ST7735_MULTI_PANEL)
+static volatile uint8_t* dcPort;
+static uint8_t csMask, dcMask;
+static int16_t cmd = -1;		//	Current command, or -1 between
+static uint8_t argn;			//	Data bytes since the command
+static uint8_t args[4];
+static const Reply* reply;		//	Reply for the current (read) command
+static uint16_t ca, ra;			//	GRAM address counters
+static uint32_t pix;			//	Pixel assembly
+static uint8_t pixn;
+
+void spiModelReset(void) {
+
+	memset(&spiModel, 0, sizeof(spiModel));
+	spiModel.stream = 2166136261u;
+	memset(gram, 0, sizeof(gram));
+	replyCount = 0;
+	dc = 0; written = false; waited = false; cmd = -1;
+	csPort = dcPort = NULL;
+	reg = rxPending = MISO_IDLE;
+	spiModel.colmod = ST7735_COLMOD_18BIT;	//	Controller reset default
+	spiModel.caEnd = ST7735_COLS - 1;
+	spiModel.raEnd = ST7735_ROWS - 1;
+
+}
+
+/**
+ *	Sets the data phase response to a read command: a dummy byte, then
+ *	len bytes of data (MISO idles high after them).
+ */
+void spiModelReply(uint8_t c, const uint8_t* data, uint8_t len) {
+
+	Reply* r = &replies[replyCount < REPLY_MAX ? replyCount++ : REPLY_MAX - 1];
+
+	r->cmd = c;
+	r->len = len < REPLY_LEN ? len : REPLY_LEN;
+	memcpy(r->data, data, r->len);
+
+}
+
+/**
+ *	A pin change right after SPI_TXWAIT() is a drain: the bus idles
+ *	until the last byte is out, rather than the next one following it.
+ */
+static void pinChange(void) {
+
+	if (waited) {
+		spiModel.drains++;
+		waited = false;
+	}
+
+}
+
+void spiModelCs(bool on) {
+
+	pinChange();
+	if (on && !spiModel.cs) {
+		spiModel.transactions++;
+	}
+	if (!on) {
+		cmd = -1;
+	}
+	spiModel.cs = on;
+
+}
+
+void spiModelDc(bool data) {
+
+	pinChange();
+	if (dc != data) {
+		spiModel.dcEdges++;
+	}
+	dc = data;
+
+}
+
+void spiModelWait(void) {
+
+	spiModel.waits++;
+	waited = true;
+
+}
+
+void spiModelMark(uint8_t tag) {
+
+	if (tag < ST7735_BENCH_IDLE) {
+		spiModel.marks++;
+	}
+
+}
+
+/**
+ *	For ST7735_MULTI_PANEL builds, where the driver sets CS and D/C pins
+ *	through each panel's port pointers: the model follows the given
+ *	panel's pins, sampled at each byte.  (Drains aren't counted.)
+ */
+void spiModelBindPins(volatile uint8_t* cs, uint8_t csBit,
+		volatile uint8_t* dcp, uint8_t dcBit) {
+
+	csPort = cs; csMask = csBit;
+	dcPort = dcp; dcMask = dcBit;
+
+}
+
+/**
+ *	Advances the address counters: CA fastest, wrapping within the window.
+ */
+static void advance(void) {
+
+	if (ca++ >= spiModel.caEnd) {
+		ca = spiModel.caStart;
+		if (ra++ >= spiModel.raEnd) {
+			ra = spiModel.raStart;
+		}
+	}
+
+}
+
+/**
+ *	Stores a pixel at the address counters and advances them.  GRAM
+ *	holds 18 bits, kept as three bytes of 6 bits, left justified (as
+ *	sent in 18-bit mode, and as RAMRD returns them).
+ */
+static void storePixel(uint8_t r, uint8_t g, uint8_t b) {
+
+	gram[ra % SPI_MODEL_GRAM][ca % SPI_MODEL_GRAM] = ((uint32_t)(r & 0xfc) << 16)
+			| ((uint32_t)(g & 0xfc) << 8) | (b & 0xfc);
+	spiModel.pixels++;
+	advance();
+
+}
+
+//	Expand a 4 or 5-bit channel to 6 bits (left justified in a byte),
+//	replicating MSBs into the LSBs
+#define EXPAND4(x)	((uint8_t)(((x) << 4) | ((x) & 0x0c)))
+#define EXPAND5(x)	((uint8_t)(((x) << 3) | ((x) >> 2)))
+
+static void store444(uint16_t p) {
+
+	storePixel(EXPAND4(p >> 8), EXPAND4((p >> 4) & 0x0f), EXPAND4(p & 0x0f));
+
+}
+
+/**
+ *	Collects RAMWR data into pixels, per COLMOD: 12 bits (two pixels in
+ *	three bytes; each is stored once its 12 bits are in, so a padded odd
+ *	pixel lands), 16 bits (RGB565) or 18 bits (three bytes of 6 bits).
+ */
+static void ramData(uint8_t b) {
+
+	pix = (pix << 8) | b;
+	pixn++;
+	switch (spiModel.colmod & 0x07) {
+	case ST7735_COLMOD_12BIT:
+		if (pixn == 2) {			//	R1 G1, B1 R2
+			store444(pix >> 4);
+		} else if (pixn == 3) {		//	G2 B2
+			store444(pix & 0x0fff);
+			pix = pixn = 0;
+		}
+		break;
+	case ST7735_COLMOD_16BIT:
+		if (pixn == 2) {
+			storePixel(EXPAND5(pix >> 11), (pix >> 3) & 0xfc, EXPAND5(pix & 0x1f));
+			pix = pixn = 0;
+		}
+		break;
+	default:
+		if (pixn == 3) {
+			storePixel(pix >> 16, pix >> 8, pix);
+			pix = pixn = 0;
+		}
+		break;
+	}
+
+}
+
+/**
+ *	RAMRD data: the dummy byte, then three bytes per pixel from the
+ *	address counters.
+ *	@param n	data byte index
+ */
+static uint8_t ramRead(uint8_t n) {
+
+	if (n == 0) {
+		return MISO_DUMMY;
+	}
+	if (pixn == 0) {
+		pix = gram[ra % SPI_MODEL_GRAM][ca % SPI_MODEL_GRAM];
+		advance();
+	}
+	pixn = (pixn + 1) % 3;
+	return pix >> (8 * (pixn ? 3 - pixn : 0));
+
+}
+
+static void commandByte(uint8_t b) {
+
+	uint8_t i;
+
+	cmd = b;
+	argn = 0;
+	reply = NULL;
+	spiModel.commands[b]++;
+	switch (b) {
+	case ST7735_CASET:
+	case ST7735_RASET:
+		spiModel.windows++;
+		break;
+	case ST7735_RAMWR:
+	case ST7735_RAMRD:
+		ca = spiModel.caStart;
+		ra = spiModel.raStart;
+		pix = pixn = 0;
+		break;
+	default:
+		for (i = 0; i < replyCount; i++) {
+			if (replies[i].cmd == b) {
+				reply = &replies[i];
+			}
+		}
+		break;
+	}
+
+}
+
+/**
+ *	Handles a data byte; returns the byte on MISO during its transfer.
+ */
+static uint8_t dataByte(uint8_t b) {
+
+	uint8_t n = argn;
+
+	if (argn < 0xff) {
+		argn++;
+	}
+	if (n < sizeof(args)) {
+		args[n] = b;
+	}
+	switch (cmd) {
+	case ST7735_CASET:
+		if (n == 3) {
+			spiModel.caStart = (args[0] << 8) | args[1];
+			spiModel.caEnd = (args[2] << 8) | args[3];
+		}
+		break;
+	case ST7735_RASET:
+		if (n == 3) {
+			spiModel.raStart = (args[0] << 8) | args[1];
+			spiModel.raEnd = (args[2] << 8) | args[3];
+		}
+		break;
+	case ST7735_MADCTL:
+		spiModel.madctl = b;
+		break;
+	case ST7735_COLMOD:
+		spiModel.colmod = b;
+		break;
+	case ST7735_RAMWR:
+		ramData(b);
+		break;
+	case ST7735_RAMRD:
+		return ramRead(n);
+	default:
+		if (reply) {
+			if (n == 0) {
+				return MISO_DUMMY;
+			}
+			if (n <= reply->len) {
+				return reply->data[n - 1];
+			}
+		}
+		break;
+	}
+	return MISO_IDLE;
+
+}
+
+/**
+ *	The SPI data register.  The driver writes it, then reads it straight
+ *	back (see ST7735_sendByte()), so calls alternate: the first returns
+ *	the register for the write; the second completes the transfer and
+ *	returns the register, now holding the byte received during the
+ *	previous transfer, as on the real bus.
+ */
+volatile uint8_t* spiModelData(void) {
+
+	uint8_t miso = MISO_IDLE;
+
+	if (!written) {
+		written = true;
+		waited = false;
+		return &reg;
+	}
+	written = false;
+	if (csPort) {
+		spiModelCs(!(*csPort & csMask));
+		spiModelDc(*dcPort & dcMask);
+	}
+	if (!spiModel.cs) {
+		spiModel.strays++;
+	} else {
+		spiModel.bytes++;
+		spiModel.stream = ((spiModel.stream ^ reg) * 16777619u ^ dc) * 16777619u;
+		if (dc) {
+			if (cmd >= 0) {
+				miso = dataByte(reg);
+			}
+		} else {
+			commandByte(reg);
+		}
+	}
+	reg = rxPending;
+	rxPending = miso;
+	return &reg;
+
+}
+
+uint32_t spiModelPixel(uint16_t c, uint16_t r) {
+
+	return gram[r % SPI_MODEL_GRAM][c % SPI_MODEL_GRAM];
+
+}
+
+/**
+ *	GRAM pixel as 5-6-5, truncated as readPixels() does.
+ */
+uint16_t spiModelPixel565(uint16_t c, uint16_t r) {
+
+	uint32_t p = spiModelPixel(c, r);
+
+	return ((p >> 8) & 0xf800) | ((p >> 5) & 0x07e0) | ((p >> 3) & 0x001f);
+
+}
+
+/**
+ *	FNV-1a hash of the whole GRAM model.
+ */
+uint32_t spiModelScreenHash(void) {
+
+	const uint8_t* p = (const uint8_t*)gram;
+	uint32_t h = 2166136261u;
+	size_t i;
+
+	for (i = 0; i < sizeof(gram); i++) {
+		h = (h ^ p[i]) * 16777619u;
+	}
+	return h;
+
+}
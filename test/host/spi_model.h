@@ -0,0 +1,53 @@
+/*
+ *	Host model of an ST7735 on the SPI bus, for the tests in ../
+ *	The driver's SPI_ macros (project.h) call into it: it follows CS and
+ *	D/C, decodes commands, keeps the window and pixel format, writes RAMWR
+ *	data into a model of GRAM (18 bits per pixel, as the controller keeps
+ *	it), reads it back for RAMRD, and answers other reads with canned
+ *	replies.
+ */
+
+#ifndef SPI_MODEL_H
+#define SPI_MODEL_H
+
+#include <inttypes.h>
+#include <stdbool.h>
+
+//	GRAM model size (per axis, in the controller's own addressing)
+#define SPI_MODEL_GRAM		512
+
+typedef struct SpiModel_s {
+	uint32_t bytes;				//	Bytes sent with CS asserted
+	uint32_t strays;			//	Bytes sent with CS released (errors)
+	uint32_t transactions;		//	CS assertions
+	uint32_t stream;			//	FNV-1a of those bytes and their D/C
+	uint32_t dcEdges;			//	D/C changes
+	uint32_t waits;				//	SPI_TXWAIT() calls, and...
+	uint32_t drains;			//	  those followed by a pin change, not a byte
+	uint32_t marks;				//	Image commands run (ST7735_BENCH() tags)
+	uint32_t windows;			//	CASET and RASET commands
+	uint32_t pixels;			//	Pixels written by RAMWR
+	uint32_t commands[256];		//	Count by command byte
+	uint8_t cs;					//	CS asserted
+	uint8_t madctl;				//	Last MADCTL, COLMOD values
+	uint8_t colmod;
+	uint16_t caStart, caEnd;	//	Last CASET, RASET windows
+	uint16_t raStart, raEnd;
+} SpiModel;
+
+extern SpiModel spiModel;
+
+void spiModelReset(void);
+void spiModelReply(uint8_t cmd, const uint8_t* data, uint8_t len);
+volatile uint8_t* spiModelData(void);
+void spiModelCs(bool on);
+void spiModelDc(bool data);
+void spiModelWait(void);
+void spiModelMark(uint8_t tag);
+void spiModelBindPins(volatile uint8_t* csPort, uint8_t csMask,
+		volatile uint8_t* dcPort, uint8_t dcMask);
+uint32_t spiModelPixel(uint16_t ca, uint16_t ra);
+uint16_t spiModelPixel565(uint16_t ca, uint16_t ra);
+uint32_t spiModelScreenHash(void);
+
+#endif // SPI_MODEL_H
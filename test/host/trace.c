@@ -0,0 +1,61 @@
+/*
+ *	Bus trace writer for host builds: each ST7735_TRACE() event is a
+ *	record of kind (BYTE), value (BYTE) and the time since the last
+ *	record (WORD, little-endian), as trace.html expects.  The host has no
+ *	meaningful clock, so time is the model's: SCK periods, 8 per byte
+ *	that crossed the bus (sent with CS asserted or not).  Every byte is
+ *	a record, so the gaps fit in a word.
+ */
+
+#include <stdio.h>
+#include "trace.h"
+#include "spi_model.h"
+
+static FILE* traceFile;
+static uint32_t traceLast;		//	Model time of the last record
+static uint32_t traceCount;		//	Records written
+
+/**
+ *	Starts writing a trace; events before this (or after traceClose())
+ *	are dropped.
+ *	@return false if the file can't be opened
+ */
+bool traceOpen(const char* path) {
+
+	traceFile = fopen(path, "wb");
+	traceLast = 8 * (spiModel.bytes + spiModel.strays);
+	traceCount = 0;
+	return traceFile != NULL;
+
+}
+
+void traceRecord(uint8_t kind, uint8_t value) {
+
+	uint32_t now = 8 * (spiModel.bytes + spiModel.strays);
+	uint32_t dt = now - traceLast;
+	uint8_t rec[4];
+
+	if (!traceFile) {
+		return;
+	}
+	rec[0] = kind; rec[1] = value;
+	rec[2] = dt & 0xff; rec[3] = dt >> 8;
+	fwrite(rec, 1, 4, traceFile);
+	traceLast = now;
+	traceCount++;
+
+}
+
+/**
+ *	Finishes the trace.
+ *	@return records written
+ */
+uint32_t traceClose(void) {
+
+	if (traceFile) {
+		fclose(traceFile);
+		traceFile = NULL;
+	}
+	return traceCount;
+
+}
@@ -0,0 +1,16 @@
+/*
+ *	Bus trace writer for host builds (HOST_TRACE; see project.h): writes
+ *	ST7735_TRACE() events as the 4-byte records ../../trace.html reads.
+ */
+
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <inttypes.h>
+#include <stdbool.h>
+
+bool traceOpen(const char* path);
+void traceRecord(uint8_t kind, uint8_t value);
+uint32_t traceClose(void);
+
+#endif // TRACE_H
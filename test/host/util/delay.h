@@ -0,0 +1,7 @@
+//	Stand-in for <util/delay.h> in host builds: no waiting
+#ifndef HOST_UTIL_DELAY_H
+#define HOST_UTIL_DELAY_H
+
+#define _delay_ms(ms)		((void)(ms))
+
+#endif // HOST_UTIL_DELAY_H
@@ -0,0 +1,89 @@
+/*
+ *	Cycle count benchmark, for simavr on an ATmega1284p (make cycles).
+ *
+ *	simavr models the ATmega SPI, not the XMega's; project.h points the
+ *	SPI macros at it, with one panel on port B: CS on SS (PB4), D/C on
+ *	PB3, reset on PB2, SPI at F_CPU / 2.  This is the default (single
+ *	panel) build; make cycles SIM_OPTS=-DST7735_MULTI_PANEL measures the
+ *	multi-panel one, with the same pins bound through an ST7735_Panel.
+ *
+ *	GPIOR0, GPIOR1 (see project.h) and GPIOR2 are traced to bench.vcd.
+ *	GPIOR2 is the side of the square being filled, so cycles.py can fit
+ *	fill time against pixels; BENCH_HUFF while drawHuffImage() runs (the
+ *	Huffman coded corpus/ict, the same picture as Image_Compress_Test),
+ *	so its image commands are counted apart; 0 elsewhere.  Reads aren't exercised
+ *	(simavr's MISO isn't connected to anything).
+ */
+
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <avr/sleep.h>
+#include "avr_mcu_section.h"
+#include "st7735.h"
+#include "../corpus/ict_huff.h"
+
+#define BENCH_HUFF		0xff	//	GPIOR2 in drawHuffImage()
+
+AVR_MCU(F_CPU, "atmega1284p");
+AVR_MCU_VCD_FILE("bench.vcd", 1000);
+
+const struct avr_mmcu_vcd_trace_t _mytrace[] _MMCU_ = {
+	{ AVR_MCU_VCD_SYMBOL("GPIOR0"), .what = (void*)&GPIOR0, },
+	{ AVR_MCU_VCD_SYMBOL("GPIOR1"), .what = (void*)&GPIOR1, },
+	{ AVR_MCU_VCD_SYMBOL("GPIOR2"), .what = (void*)&GPIOR2, },
+};
+
+#ifdef ST7735_MULTI_PANEL
+static ST7735_Panel panel = {
+	.csPort = &PORTB, .csMask = (1 << PB4),
+	.dcPort = &PORTB, .dcMask = (1 << PB3),
+	.rsPort = &PORTB, .rsMask = (1 << PB2),
+	ST7735_PANEL_GREENTAB
+};
+#endif // ST7735_MULTI_PANEL
+
+const uint8_t IctHuff[] PROGMEM = { ICT_HUFF };
+
+//	Fill sizes (square), for the per-pixel fit
+static const uint8_t fillSides[] = { 1, 2, 4, 8, 16, 32, 64, 128 };
+
+int main(void) {
+
+	uint8_t i;
+
+	PORTB = (1 << PB4) | (1 << PB2);
+	DDRB = (1 << PB7) | (1 << PB5) | (1 << PB4) | (1 << PB3) | (1 << PB2);
+	SPCR = (1 << SPE) | (1 << MSTR);
+	SPSR = (1 << SPI2X);
+	SPDR = 0;				//	Sets SPIF, which SPI_TXWAIT() expects before the first byte
+
+#ifdef ST7735_MULTI_PANEL
+	ST7735_selectPanel(&panel);
+#else
+	ST7735_panel0 = (ST7735_Panel){ ST7735_PANEL_GREENTAB };
+#endif // ST7735_MULTI_PANEL
+	initLcd();
+
+	for (i = 0; i < sizeof(fillSides); i++) {
+		GPIOR2 = fillSides[i];
+		drawfillRectangle(0x07e0, 0, 0, fillSides[i], fillSides[i]);
+	}
+	GPIOR2 = 0;
+
+	setScreenRegion(0, 0, 159, 127);
+	setScreenRegion(10, 20, 30, 40);
+	setScreenRegion(10, 20, 30, 40);	//	Cached: nothing sent
+	setScreenRegion(10, 0, 30, 127);	//	One half sent
+
+	drawImage(ImageData, 0, 0);
+	GPIOR2 = BENCH_HUFF;
+	drawHuffImage(IctHuff, 0, 0);
+	GPIOR2 = 0;
+
+	cli();
+	set_sleep_mode(SLEEP_MODE_IDLE);
+	sleep_mode();			//	With interrupts off, simavr exits
+
+	return 0;
+
+}
@@ -0,0 +1,162 @@
+#!/usr/bin/env python3
+"""Cycle counts from a simavr VCD trace of the benchmark (see bench.c).
+
+Sections begin where the marker counter (GPIOR1) changes; each is tagged
+with the ST7735_BENCH() tag (GPIOR0) at that moment, and lasts until the
+next.  Time is converted to cycles at --f-cpu.  Prints JSON:
+
+  init, region, fill, pattern, sprite: calls, total cycles, per call
+  fill also: per_pixel and per_call (intercept) by least squares fit of
+      cycles against pixels (side in GPIOR2, squared), and the samples
+  commands: per image command byte: count, total cycles, per command
+  huff_commands: the same, for drawHuffImage() (GPIOR2 = 0xff)
+  images: total cycles of image commands, plain and huffman
+
+usage: cycles.py [--f-cpu HZ] [--tag SIG] [--seq SIG] [--param SIG] bench.vcd
+"""
+
+import argparse
+import bisect
+import json
+import re
+import sys
+
+IDLE = 0xf0
+HUFF = 0xff			# GPIOR2 while drawHuffImage() runs
+SECTIONS = {0xf1: "init", 0xf2: "region", 0xf3: "fill", 0xf4: "pattern",
+		0xf5: "sprite"}
+UNITS = {"s": 1, "ms": 1e-3, "us": 1e-6, "ns": 1e-9, "ps": 1e-12, "fs": 1e-15}
+
+
+def parseVcd(f, names):
+	"""Returns (seconds per time unit, {name: [(time, value)]}) for the
+	named signals (matched on the last component of the VCD name)."""
+
+	header = ""
+	for line in f:
+		header += line
+		if "$enddefinitions" in line:
+			break
+	timescale = 1e-9
+	m = re.search(r"\$timescale\s+(\d+)\s*(\w+)\s+\$end", header)
+	if m:
+		timescale = int(m.group(1)) * UNITS[m.group(2)]
+	ids = {}
+	for m in re.finditer(r"\$var\s+\S+\s+\d+\s+(\S+)\s+(\S+)", header):
+		name = m.group(2).split(".")[-1]
+		if name in names:
+			ids[m.group(1)] = name
+	missing = [n for n in names if n not in ids.values()]
+	if missing:
+		sys.exit("cycles.py: signal(s) not in trace: " + ", ".join(missing))
+
+	changes = {n: [] for n in names}
+	t = 0
+	for line in f:
+		line = line.strip()
+		if not line or line[0] == "$":
+			continue
+		if line[0] == "#":
+			t = int(line[1:])
+			continue
+		if line[0] in "bB":
+			value, ident = line[1:].split()
+		else:
+			value, ident = line[0], line[1:]
+		if ident in ids:
+			v = int(value, 2) if re.fullmatch(r"[01]+", value) else 0
+			changes[ids[ident]].append((t, v))
+	return timescale, changes
+
+
+def valueAt(changes, t):
+	"""Value of a signal at time t (latest change at or before t)."""
+
+	i = bisect.bisect_right(changes, (t, float("inf")))
+	return changes[i - 1][1] if i else 0
+
+
+def sections(timescale, changes, fcpu, tag, seq, param):
+	"""List of (tag, param, cycles) for each section."""
+
+	marks = changes[seq]
+	out = []
+	for i in range(len(marks) - 1):
+		t0, t1 = marks[i][0], marks[i + 1][0]
+		cycles = round((t1 - t0) * timescale * fcpu)
+		out.append((valueAt(changes[tag], t0), valueAt(changes[param], t0), cycles))
+	return out
+
+
+def fit(samples):
+	"""Least squares cycles = a + b * pixels; (a, b), or None if degenerate."""
+
+	n = len(samples)
+	if n < 2:
+		return None
+	sx = sum(p for p, c in samples)
+	sy = sum(c for p, c in samples)
+	sxx = sum(p * p for p, c in samples)
+	sxy = sum(p * c for p, c in samples)
+	d = n * sxx - sx * sx
+	if d == 0:
+		return None
+	b = (n * sxy - sx * sy) / d
+	return (sy - b * sx) / n, b
+
+
+def summarize(secs, fcpu):
+
+	result = {"f_cpu": fcpu}
+	commands = {}
+	huff = {}
+	fills = []
+	for tag, param, cycles in secs:
+		if tag == IDLE:
+			continue
+		if tag in SECTIONS:
+			s = result.setdefault(SECTIONS[tag], {"calls": 0, "cycles": 0})
+			s["calls"] += 1
+			s["cycles"] += cycles
+			if tag == 0xf3 and param:
+				fills.append((param * param, cycles))
+		else:
+			c = (huff if param == HUFF else commands).setdefault("0x%02x" % tag,
+					{"count": 0, "cycles": 0})
+			c["count"] += 1
+			c["cycles"] += cycles
+	for s in ([result[k] for k in SECTIONS.values() if k in result] + list(commands.values())
+			+ list(huff.values())):
+		n = s.get("calls", s.get("count"))
+		s["per_call" if "calls" in s else "per_command"] = round(s["cycles"] / n, 1)
+	if "fill" in result:
+		f = fit(fills)
+		result["fill"]["samples"] = [{"pixels": p, "cycles": c} for p, c in fills]
+		if f:
+			result["fill"]["per_call"] = round(f[0], 1)
+			result["fill"]["per_pixel"] = round(f[1], 2)
+	result["commands"] = dict(sorted(commands.items()))
+	result["huff_commands"] = dict(sorted(huff.items()))
+	result["images"] = {"plain": sum(c["cycles"] for c in commands.values()),
+			"huffman": sum(c["cycles"] for c in huff.values())}
+	return result
+
+
+def main():
+
+	ap = argparse.ArgumentParser(description="Cycle counts from a simavr VCD trace of bench.c")
+	ap.add_argument("vcd")
+	ap.add_argument("--f-cpu", type=float, default=16e6, help="CPU clock, Hz (default 16e6)")
+	ap.add_argument("--tag", default="GPIOR0", help="ST7735_BENCH() tag signal")
+	ap.add_argument("--seq", default="GPIOR1", help="marker counter signal")
+	ap.add_argument("--param", default="GPIOR2", help="fill side signal")
+	a = ap.parse_args()
+	with open(a.vcd) as f:
+		timescale, changes = parseVcd(f, [a.tag, a.seq, a.param])
+	secs = sections(timescale, changes, a.f_cpu, a.tag, a.seq, a.param)
+	json.dump(summarize(secs, int(a.f_cpu)), sys.stdout, indent="\t")
+	print()
+
+
+if __name__ == "__main__":
+	main()
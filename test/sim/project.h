@@ -0,0 +1,16 @@
+//	Project header for the simavr benchmark (see bench.c): ATmega SPI,
+//	the single panel's pins on port B (CS on SS, PB4; D/C on PB3; reset
+//	on PB2), and section markers traced to VCD.  GPIOR0 holds the ST7735_BENCH()
+//	tag, and GPIOR1 counts markers, so that a section entered twice in a
+//	row (two image commands of the same type, say) still shows a change.
+#include <avr/io.h>
+
+#define SPI_DATA		SPDR
+#define SPI_TXWAIT()	while (!(SPSR & (1 << SPIF)) && (SPCR & (1 << SPE)))
+#define SPI_CSON()		PORTB &= ~(1 << PB4)
+#define SPI_CSOFF()		PORTB |= (1 << PB4)
+#define SPI_DC_DATA()	PORTB |= (1 << PB3)
+#define SPI_DC_CMD()	PORTB &= ~(1 << PB3)
+#define SPI_RS_LOW()	PORTB &= ~(1 << PB2)
+#define SPI_RS_HIGH()	PORTB |= (1 << PB2)
+#define ST7735_BENCH(tag)	do { GPIOR0 = (tag); GPIOR1++; } while (0)
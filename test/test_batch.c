@@ -0,0 +1,80 @@
+/*
+ *	Host test of transactions and batches (single panel build): each
+ *	primitive is one CS assertion; inside ST7735_beginBatch() and
+ *	ST7735_endBatch(), ST7735_endTransaction() does nothing and CS stays
+ *	asserted across calls (and nested batches); reads release CS even
+ *	within a batch, and the next call asserts it again.
+ */
+
+#include <stdio.h>
+#include "st7735.h"
+
+static unsigned failures;
+
+#define CHECK(c, what) do { \
+	if (!(c)) { \
+		printf("FAIL %s: %s (transactions %lu, CS %u, strays %lu)\n", what, #c, \
+				(unsigned long)spiModel.transactions, spiModel.cs, \
+				(unsigned long)spiModel.strays); \
+		failures++; \
+	} \
+} while (0)
+
+static void reset(void) {
+
+	spiModelReset();
+	ST7735_panel0 = (ST7735_Panel){ ST7735_PANEL_RAW };
+	initLcd();
+	spiModel.transactions = 0;
+
+}
+
+int main(void) {
+
+	uint16_t buf[4];
+	uint32_t bytes;
+
+	reset();
+	drawfillRectangle(0xf800, 0, 0, 4, 4);
+	CHECK(spiModel.transactions == 1 && !spiModel.cs, "fill, unbatched");
+	drawfillRectangle(0x07e0, 4, 0, 4, 4);
+	CHECK(spiModel.transactions == 2 && !spiModel.cs, "second fill, unbatched");
+
+	reset();
+	ST7735_beginBatch();
+	drawfillRectangle(0xf800, 0, 0, 4, 4);
+	CHECK(spiModel.transactions == 1 && spiModel.cs, "fill in a batch leaves CS asserted");
+	ST7735_beginBatch();
+	drawfillRectangle(0x07e0, 4, 0, 4, 4);
+	writePixel(0x001f);
+	ST7735_endBatch();
+	CHECK(spiModel.transactions == 1 && spiModel.cs, "nested batch ends, outer holds CS");
+	setScreenRegion(0, 0, 9, 9);
+	ST7735_endBatch();
+	CHECK(spiModel.transactions == 1 && !spiModel.cs, "batch ends");
+	CHECK(spiModelPixel565(0, 4) == 0x001f && spiModelPixel565(1, 4) == 0x07e0
+			&& spiModelPixel565(0, 0) == 0xf800,
+			"pixels drawn in a batch");
+
+	reset();
+	ST7735_beginBatch();
+	drawfillRectangle(0xf800, 0, 0, 4, 4);
+	readPixels(buf, 0, 0, 2, 2);
+	CHECK(spiModel.transactions == 1 && !spiModel.cs, "read releases CS in a batch");
+	CHECK(buf[0] == 0xf800 && buf[3] == 0xf800, "read in a batch");
+	drawfillRectangle(0x001f, 0, 0, 2, 2);
+	CHECK(spiModel.transactions == 2 && spiModel.cs, "batch goes on after a read");
+	ST7735_endBatch();
+	CHECK(!spiModel.cs && spiModelPixel565(0, 0) == 0x001f, "batch ends after a read");
+
+	reset();
+	bytes = spiModel.bytes;
+	drawImage(ImageData, 0, 0);
+	CHECK(spiModel.transactions == 1 && !spiModel.cs, "drawImage() is one transaction");
+	CHECK(spiModel.bytes - bytes == 51901, "drawImage() bytes");
+
+	CHECK(spiModel.strays == 0, "no bytes outside CS");
+	printf("%s: %u failures\n", __FILE__, failures);
+	return failures != 0;
+
+}
@@ -0,0 +1,146 @@
+/*
+ *	Host test of display readback and blending: readPixels() against the
+ *	GRAM model, and blendRectangle() (uniform and masked, across strip
+ *	boundaries and screen edges, in each color mode) against a blend of
+ *	what was on screen, with the pixels around it left alone.
+ */
+
+#include <stdio.h>
+#include "st7735.h"
+
+#define SCREEN_W			160
+#define SCREEN_H			128
+
+typedef struct {
+	const char* name;
+	uint16_t x, y, w, h;
+	uint8_t alpha;
+	bool mask;
+} Case;
+
+static const Case cases[] = {
+	{ "10x10, half", 20, 30, 10, 10, 128, false },
+	{ "1x100, taller than a strip", 5, 10, 1, 100, 77, false },
+	{ "37x64, one strip high", 60, 2, 37, 64, 200, false },
+	{ "20x70, masked", 100, 40, 20, 70, 255, true },
+	{ "transparent", 0, 0, 16, 16, 0, false },
+	{ "opaque", 16, 0, 16, 16, 255, false },
+	{ "bottom right corner", SCREEN_W - 10, SCREEN_H - 10, 10, 10, 100, true },
+	{ "full screen", 0, 0, SCREEN_W, SCREEN_H, 64, false },
+};
+
+static const struct {
+	uint8_t mode;
+	uint16_t compare;			//	Bits that survive the mode (5-6-5 mask)
+} modes[] = {
+	{ ST7735_COLMOD_16BIT, 0xffff },
+	{ ST7735_COLMOD_18BIT, 0xffff },
+	{ ST7735_COLMOD_12BIT, 0xf79e },
+};
+
+static uint8_t mask[SCREEN_W * SCREEN_H];
+static uint16_t before[SCREEN_W][SCREEN_H];
+static uint16_t readBuf[SCREEN_W * SCREEN_H];
+static unsigned failures;
+
+//	GRAM as logical (x, y): raw addressing at ROT0 puts X on RASET
+#define SCREEN(x, y)		spiModelPixel565((y), (x))
+
+static uint16_t blend(uint16_t fg, uint16_t bg, uint8_t a) {
+
+	int16_t c[3], i;
+	static const uint8_t shift[3] = { 11, 5, 0 }, bits[3] = { 0x1f, 0x3f, 0x1f };
+	uint16_t out = 0;
+
+	for (i = 0; i < 3; i++) {
+		c[i] = (bg >> shift[i]) & bits[i];
+		c[i] += (((int16_t)((fg >> shift[i]) & bits[i]) - c[i]) * a) >> 8;
+		out |= c[i] << shift[i];
+	}
+	return out;
+
+}
+
+static void background(void) {
+
+	drawPatternRectangle(ST7735_PATTERN_HGRADIENT, 0xf800, 0x001f, 0, 0, SCREEN_W, SCREEN_H / 2);
+	drawPatternRectangle(ST7735_PATTERN_CHECKER_SIZE(3), 0x07e0, 0xffe0, 0, SCREEN_H / 2,
+			SCREEN_W, SCREEN_H / 2);
+
+}
+
+static void runCase(const Case* t, uint8_t mode, uint16_t compare) {
+
+	uint16_t x, y, expect, got, bad = 0;
+	uint8_t a;
+
+	spiModelReset();
+	ST7735_panel0 = (ST7735_Panel){ ST7735_PANEL_RAW };
+	initLcd();
+	setColorMode(mode);
+	background();
+	for (x = 0; x < SCREEN_W; x++) {
+		for (y = 0; y < SCREEN_H; y++) {
+			before[x][y] = SCREEN(x, y);
+		}
+	}
+
+	//	Readback matches GRAM
+	readPixels(readBuf, t->x, t->y, t->w, t->h);
+	for (x = 0; x < t->w; x++) {
+		for (y = 0; y < t->h; y++) {
+			bad += readBuf[x * t->h + y] != before[t->x + x][t->y + y];
+		}
+	}
+	if (bad) {
+		printf("FAIL %s, mode %u: %u pixels read back wrong\n", t->name, mode, bad);
+		failures++;
+	}
+
+	for (x = 0; x < t->w * t->h; x++) {
+		mask[x] = (x * 37) & 0xff;
+	}
+	blendRectangle(0x5aa5, t->alpha, t->mask ? mask : NULL, t->x, t->y, t->w, t->h);
+	bad = 0;
+	for (x = 0; x < SCREEN_W; x++) {
+		for (y = 0; y < SCREEN_H; y++) {
+			got = SCREEN(x, y);
+			expect = before[x][y];
+			if (x >= t->x && x < t->x + t->w && y >= t->y && y < t->y + t->h) {
+				a = t->alpha;
+				if (t->mask) {
+					a = (mask[(x - t->x) * t->h + y - t->y] * (t->alpha + 1u)) >> 8;
+				}
+				expect = blend(0x5aa5, expect, a);
+			}
+			if ((got & compare) != (expect & compare)) {
+				if (!bad) {
+					printf("FAIL %s, mode %u: (%u, %u) is %04x, expected %04x\n",
+							t->name, mode, x, y, got, expect);
+				}
+				bad++;
+			}
+		}
+	}
+	if (bad || spiModel.strays || spiModel.cs) {
+		printf("FAIL %s, mode %u: %u pixels wrong, %u bytes outside CS, CS %u\n",
+				t->name, mode, bad, (unsigned)spiModel.strays, spiModel.cs);
+		failures++;
+	}
+
+}
+
+int main(void) {
+
+	unsigned i, j, n = 0;
+
+	for (i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+		for (j = 0; j < sizeof(modes) / sizeof(modes[0]); j++) {
+			runCase(&cases[i], modes[j].mode, modes[j].compare);
+			n++;
+		}
+	}
+	printf("%s: %u cases, %u failures\n", __FILE__, n, failures);
+	return failures != 0;
+
+}
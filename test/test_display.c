@@ -0,0 +1,176 @@
+/*
+ *	Host test of display lists: drawDisplayList() must leave the screen
+ *	as drawing each item directly, in order, does, while sending only the
+ *	pixels no later opaque item covers (dl->drawn, checked against the
+ *	model's count and a per-pixel tally) -- or, past ST7735_DISPLAY_DEPTH
+ *	occluders, more pixels but the same screen.
+ */
+
+#include <stdio.h>
+#include "st7735.h"
+#include "corpus/uiband.h"
+#include "corpus/photo.h"
+
+#define SCREEN_W			160
+#define SCREEN_H			128
+#define ITEMS				40
+
+#define IMAGE(name, NAME)	const uint8_t name[] PROGMEM = { \
+		(NAME##_PALETTE_LEN / 2) & 0xff, NAME##_PAL, NAME##_CMDS }
+
+IMAGE(UiBand, UIBAND);
+IMAGE(Photo, PHOTO);
+
+static ST7735_DrawItem items[ITEMS];
+static ST7735_DisplayList dl;
+static uint16_t direct[SCREEN_W][SCREEN_H];
+static unsigned failures, cases;
+
+//	GRAM as logical (x, y): raw addressing at ROT0 puts X on RASET
+#define SCREEN(x, y)		spiModelPixel565((y), (x))
+
+static void reset(void) {
+
+	spiModelReset();
+	ST7735_panel0 = (ST7735_Panel){ ST7735_PANEL_RAW };
+	initLcd();
+
+}
+
+static bool covers(const ST7735_DrawItem* d, uint16_t x, uint16_t y) {
+
+	return x >= d->x && y >= d->y && x - d->x < d->width && y - d->y < d->height;
+
+}
+
+/**
+ *	Pixels on screen of each item that no later opaque item covers: what
+ *	drawDisplayList() sends when it can cut around every occluder.
+ */
+static uint32_t visible(void) {
+
+	uint16_t x, y;
+	uint8_t i, j;
+	uint32_t n = 0;
+
+	for (x = 0; x < SCREEN_W; x++) {
+		for (y = 0; y < SCREEN_H; y++) {
+			for (i = 0; i < dl.count; i++) {
+				if (!covers(items + i, x, y)) continue;
+				for (j = i + 1; j < dl.count; j++) {
+					if (items[j].opaque && covers(items + j, x, y)) break;
+				}
+				n += j >= dl.count;
+			}
+		}
+	}
+	return n;
+
+}
+
+/**
+ *	Draws the recorded list directly and as a list, and compares.
+ *	@param exact	drawn should equal visible() (depth not reached)
+ */
+static void check(const char* name, bool exact) {
+
+	uint8_t i;
+	uint16_t x, y, bad = 0;
+	uint32_t pixels, transactions, expect = visible();
+	const ST7735_DrawItem* d;
+
+	cases++;
+	reset();
+	for (i = 0; i < dl.count; i++) {
+		d = items + i;
+		if (d->width == 0 || d->height == 0) {
+			continue;				//	(drawfillRectangle() takes 0 as 1)
+		} else if (d->img) {
+			drawImage(d->img, d->x, d->y);
+		} else {
+			drawfillRectangle(d->colr, d->x, d->y, d->width, d->height);
+		}
+	}
+	for (x = 0; x < SCREEN_W; x++) {
+		for (y = 0; y < SCREEN_H; y++) {
+			direct[x][y] = SCREEN(x, y);
+		}
+	}
+
+	reset();
+	pixels = spiModel.pixels;
+	transactions = spiModel.transactions;
+	drawDisplayList(&dl);
+	pixels = spiModel.pixels - pixels;
+	transactions = spiModel.transactions - transactions;
+	for (x = 0; x < SCREEN_W; x++) {
+		for (y = 0; y < SCREEN_H; y++) {
+			if (SCREEN(x, y) != direct[x][y]) {
+				if (!bad) {
+					printf("FAIL %s: (%u, %u) is %04x, drawn directly %04x\n",
+							name, x, y, SCREEN(x, y), direct[x][y]);
+				}
+				bad++;
+			}
+		}
+	}
+	if (bad || pixels != dl.drawn || (exact ? dl.drawn != expect : dl.drawn < expect)
+			|| transactions != 1 || spiModel.strays || spiModel.cs) {
+		printf("FAIL %s: %u pixels wrong; drawn %lu, sent %lu, visible %lu, area %lu; "
+				"%lu transactions, %lu bytes outside CS\n", name, bad,
+				(unsigned long)dl.drawn, (unsigned long)pixels, (unsigned long)expect,
+				(unsigned long)dl.area, (unsigned long)transactions,
+				(unsigned long)spiModel.strays);
+		failures++;
+	}
+
+}
+
+int main(void) {
+
+	uint8_t i;
+
+	//	Background, panels, an image (banded, partly off screen) with a
+	//	fill over it, a transparent image, and items that draw nothing
+	startDisplayList(&dl, items, ITEMS);
+	addFillRectangle(&dl, 0x2104, 0, 0, SCREEN_W, SCREEN_H);
+	addFillRectangle(&dl, 0x001f, 10, 10, 60, 40);
+	addFillRectangle(&dl, 0xf800, 50, 30, 60, 40);
+	addImage(&dl, UiBand, 90, 60, UIBAND_WIDTH, UIBAND_HEIGHT, true);
+	addFillRectangle(&dl, 0x07e0, 100, 70, 20, 20);
+	addImage(&dl, Photo, 0, 80, PHOTO_WIDTH, PHOTO_HEIGHT, false);
+	addFillRectangle(&dl, 0xffe0, 20, 100, 30, 10);
+	addFillRectangle(&dl, 0xffff, 5, 5, 0, 10);
+	addFillRectangle(&dl, 0xffff, SCREEN_W, 0, 10, 10);
+	check("panels and images", true);
+
+	//	A background under a grid of small fills: each cut is another
+	//	level, past ST7735_DISPLAY_DEPTH
+	startDisplayList(&dl, items, ITEMS);
+	addFillRectangle(&dl, 0x8410, 0, 0, SCREEN_W, SCREEN_H);
+	for (i = 0; i < 24; i++) {
+		addFillRectangle(&dl, i * 0x0821, 4 + (i % 6) * 26, 4 + (i / 6) * 30, 12 + i % 5, 10 + i % 7);
+	}
+	check("deeper than ST7735_DISPLAY_DEPTH", false);
+	cases++;
+	if (dl.drawn <= visible()) {
+		printf("FAIL depth limit not reached: drawn %lu\n", (unsigned long)dl.drawn);
+		failures++;
+	}
+
+	//	Stacked, each over the last, until the list is full
+	startDisplayList(&dl, items, ITEMS);
+	for (i = 0; i < ITEMS; i++) {
+		addFillRectangle(&dl, 0xf800 - i * 0x0800 + i, i * 3, i * 2, 40, 30);
+	}
+	check("stacked", true);
+	cases++;
+	if (dl.count != ITEMS || addFillRectangle(&dl, 0, 0, 0, 1, 1)) {
+		printf("FAIL full list: %u items, or took one more\n", dl.count);
+		failures++;
+	}
+
+	printf("%s: %u cases, %u failures\n", __FILE__, cases, failures);
+	return failures != 0;
+
+}
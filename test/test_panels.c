@@ -0,0 +1,80 @@
+/*
+ *	Host test of two panels on one bus (ST7735_MULTI_PANEL): the model
+ *	samples panel A's pins at each byte, so it sees what A would (its CS
+ *	edges are checked on the pins themselves).  Selecting panel B
+ *	inside a batch must release A's CS first; otherwise B's bytes land
+ *	on A too.
+ */
+
+#include <stdio.h>
+#include "st7735.h"
+
+#define CS_A				(1 << 0)
+#define CS_B				(1 << 2)
+#define DC					(1 << 1)
+
+static volatile uint8_t pins = CS_A | CS_B;
+static ST7735_Panel panelA = { .csPort = &pins, .csMask = CS_A,
+		.dcPort = &pins, .dcMask = DC, ST7735_PANEL_RAW };
+static ST7735_Panel panelB = { .csPort = &pins, .csMask = CS_B,
+		.dcPort = &pins, .dcMask = DC, ST7735_PANEL_RAW };
+static unsigned failures;
+
+#define CHECK(c, what) do { \
+	if (!(c)) { \
+		printf("FAIL %s: %s (pins %02x, A: bytes %lu)\n", what, #c, \
+				pins, (unsigned long)spiModel.bytes); \
+		failures++; \
+	} \
+} while (0)
+
+int main(void) {
+
+	uint32_t bytesA;
+
+	spiModelReset();
+	spiModelBindPins(&pins, CS_A, &pins, DC);
+	ST7735_selectPanel(&panelB);
+	initLcd();
+	CHECK(spiModel.bytes == 0, "B's init not seen by A");
+	ST7735_selectPanel(&panelA);
+	initLcd();
+	CHECK((pins & (CS_A | CS_B)) == (CS_A | CS_B), "both released after init");
+
+	//	Unbatched: calls to either panel interleave freely
+	drawfillRectangle(0xf800, 0, 0, 4, 4);
+	bytesA = spiModel.bytes;
+	ST7735_selectPanel(&panelB);
+	drawfillRectangle(0x07e0, 0, 0, 4, 4);
+	CHECK(spiModel.bytes == bytesA, "B's fill not seen by A");
+	ST7735_selectPanel(&panelA);
+	drawfillRectangle(0x001f, 8, 0, 4, 4);
+	CHECK(pins & CS_A, "A released after its fill");
+
+	//	Batch on A, carried over to B
+	ST7735_beginBatch();
+	drawfillRectangle(0xffff, 0, 8, 4, 4);
+	CHECK(!(pins & CS_A), "A's CS held in a batch");
+	bytesA = spiModel.bytes;
+	ST7735_selectPanel(&panelB);
+	CHECK((pins & CS_A) && (pins & CS_B), "selectPanel() in a batch releases A's CS");
+	drawfillRectangle(0x07e0, 0, 8, 4, 4);
+	CHECK(!(pins & CS_B) && (pins & CS_A), "B's CS held in the batch, A's released");
+	CHECK(spiModel.bytes == bytesA, "B's fill in a batch not seen by A");
+	ST7735_endBatch();
+	CHECK((pins & (CS_A | CS_B)) == (CS_A | CS_B), "batch end releases B's CS");
+
+	//	Selecting the same panel inside a batch changes nothing
+	ST7735_selectPanel(&panelA);
+	ST7735_beginBatch();
+	drawfillRectangle(0xf800, 0, 0, 4, 4);
+	ST7735_selectPanel(&panelA);
+	CHECK(!(pins & CS_A), "reselecting A keeps its CS");
+	ST7735_endBatch();
+
+	CHECK(spiModelPixel565(8, 0) == 0xffff && spiModelPixel565(0, 8) == 0x001f
+			&& spiModelPixel565(0, 0) == 0xf800, "A's pixels");
+	printf("%s: %u failures\n", __FILE__, failures);
+	return failures != 0;
+
+}
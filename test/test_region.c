@@ -0,0 +1,207 @@
+/*
+ *	Host test of partial and scaled image draws: drawImageRegion() (crops
+ *	at the image's edges, past them, across band boundaries, and placed
+ *	partly off screen; with and without a band index) and
+ *	drawImageScaled() (up, down and fractional, clipped by the screen),
+ *	against the image as drawImage() leaves it, with the pixels around
+ *	them left alone.
+ */
+
+#include <stdio.h>
+#include "st7735.h"
+#include "corpus/ui.h"
+#include "corpus/uiband.h"
+#include "corpus/uipatband.h"
+
+#define SCREEN_W			160
+#define SCREEN_H			128
+#define BACKGROUND			0x39e7
+
+#define IMAGE(name, NAME)	const uint8_t name[] PROGMEM = { \
+		(NAME##_PALETTE_LEN / 2) & 0xff, NAME##_PAL, NAME##_CMDS }
+
+IMAGE(Ui, UI);
+IMAGE(UiBand, UIBAND);
+IMAGE(UiPatBand, UIPATBAND);
+
+static const struct {
+	const char* name;
+	const uint8_t* img;
+	const uint8_t* same;		//	Unbanded image that draws the same
+} images[] = {
+	{ "ui", Ui, Ui },
+	{ "uiband (16 rows)", UiBand, Ui },
+	{ "uipatband (10 rows)", UiPatBand, UiPatBand },
+};
+
+typedef struct {
+	const char* name;
+	uint16_t xSrc, ySrc, w, h, x, y;
+} Region;
+
+static const Region regions[] = {
+	{ "whole image", 0, 0, SCREEN_W, SCREEN_H, 0, 0 },
+	{ "top left pixel", 0, 0, 1, 1, 5, 5 },
+	{ "bottom right pixel", SCREEN_W - 1, SCREEN_H - 1, 1, 1, 0, 0 },
+	{ "right and bottom edges", 100, 90, 60, 38, 10, 20 },
+	{ "past the right and bottom edges", 150, 120, 40, 40, 0, 0 },
+	{ "wider than the image", 0, 40, 1000, 3, 0, 0 },
+	{ "one band", 0, 16, 30, 16, 50, 50 },
+	{ "across a band boundary", 20, 15, 30, 2, 50, 50 },
+	{ "last row of a band", 20, 31, 30, 1, 50, 50 },
+	{ "last band", 0, 112, 60, 16, 0, 0 },
+	{ "last row", 0, SCREEN_H - 1, SCREEN_W, 1, 0, 0 },
+	{ "below the image", 0, 200, 10, 10, 0, 0 },
+	{ "left of its source", 50, 50, 20, 20, 0, 0 },
+	{ "partly off screen", 0, 0, 40, 40, 140, 110 },
+};
+
+typedef struct {
+	const char* name;
+	uint16_t x, y;
+	uint8_t up, down;
+} Scale;
+
+static const Scale scales[] = {
+	{ "1/1, off the corner", 30, 20, 1, 1 },
+	{ "2/1", 0, 0, 2, 1 },
+	{ "3/1, off the corner", 150, 120, 3, 1 },
+	{ "1/2", 100, 90, 1, 2 },
+	{ "3/2", 40, 30, 3, 2 },
+	{ "2/3", 0, 0, 2, 3 },
+	{ "5/7, odd offset", 17, 3, 5, 7 },
+	{ "1/3, at the last column", SCREEN_W - 1, 0, 1, 3 },
+	{ "off screen", SCREEN_W, 0, 1, 1 },
+};
+
+static uint16_t ref[SCREEN_W][SCREEN_H];
+static unsigned failures, cases;
+
+//	GRAM as logical (x, y): raw addressing at ROT0 puts X on RASET
+#define SCREEN(x, y)		spiModelPixel565((y), (x))
+
+static void reset(void) {
+
+	spiModelReset();
+	ST7735_panel0 = (ST7735_Panel){ ST7735_PANEL_RAW };
+	initLcd();
+	drawfillRectangle(BACKGROUND, 0, 0, SCREEN_W, SCREEN_H);
+
+}
+
+/**
+ *	Compares the screen with expect(), which gives the reference pixel
+ *	shown at screen (x, y), or -1 for the background.
+ */
+static void compare(const char* image, const char* name, int32_t (*expect)(uint16_t, uint16_t)) {
+
+	uint16_t x, y, got, bad = 0;
+	int32_t e;
+
+	cases++;
+	for (x = 0; x < SCREEN_W; x++) {
+		for (y = 0; y < SCREEN_H; y++) {
+			got = SCREEN(x, y);
+			e = expect(x, y);
+			if (e < 0) e = BACKGROUND;
+			if (got != e) {
+				if (!bad) {
+					printf("FAIL %s, %s: (%u, %u) is %04x, expected %04x\n",
+							image, name, x, y, got, (unsigned)e);
+				}
+				bad++;
+			}
+		}
+	}
+	if (bad || spiModel.strays || spiModel.cs) {
+		printf("FAIL %s, %s: %u pixels wrong, %u bytes outside CS, CS %u\n",
+				image, name, bad, (unsigned)spiModel.strays, spiModel.cs);
+		failures++;
+	}
+
+}
+
+static const Region* region;
+
+static int32_t expectRegion(uint16_t x, uint16_t y) {
+
+	const Region* r = region;
+	uint16_t xs, ys;
+
+	if (x < r->x || y < r->y || x - r->x >= r->w || y - r->y >= r->h) {
+		return -1;
+	}
+	xs = r->xSrc + x - r->x; ys = r->ySrc + y - r->y;
+	if (xs >= SCREEN_W || ys >= SCREEN_H) {
+		return -1;
+	}
+	return ref[xs][ys];
+
+}
+
+static const Scale* scale;
+
+/**
+ *	Image pixel whose scaled span, i * up / down up to (i + 1) * up / down,
+ *	covers screen offset s; -1 past the image.
+ */
+static int32_t source(uint16_t s, uint16_t size) {
+
+	uint16_t i;
+
+	for (i = 0; i < size; i++) {
+		if ((i + 1u) * scale->up / scale->down > s) {
+			return ((uint32_t)i * scale->up / scale->down <= s) ? i : -1;
+		}
+	}
+	return -1;
+
+}
+
+static int32_t expectScaled(uint16_t x, uint16_t y) {
+
+	int32_t xs, ys;
+
+	if (x < scale->x || y < scale->y) {
+		return -1;
+	}
+	xs = source(x - scale->x, SCREEN_W);
+	ys = source(y - scale->y, SCREEN_H);
+	if (xs < 0 || ys < 0) {
+		return -1;
+	}
+	return ref[xs][ys];
+
+}
+
+int main(void) {
+
+	unsigned i, j;
+	uint16_t x, y;
+
+	for (i = 0; i < sizeof(images) / sizeof(images[0]); i++) {
+		reset();
+		drawImage(images[i].same, 0, 0);
+		for (x = 0; x < SCREEN_W; x++) {
+			for (y = 0; y < SCREEN_H; y++) {
+				ref[x][y] = SCREEN(x, y);
+			}
+		}
+		for (j = 0; j < sizeof(regions) / sizeof(regions[0]); j++) {
+			region = &regions[j];
+			reset();
+			drawImageRegion(images[i].img, region->xSrc, region->ySrc,
+					region->w, region->h, region->x, region->y);
+			compare(images[i].name, region->name, expectRegion);
+		}
+		for (j = 0; j < sizeof(scales) / sizeof(scales[0]); j++) {
+			scale = &scales[j];
+			reset();
+			drawImageScaled(images[i].img, scale->x, scale->y, scale->up, scale->down);
+			compare(images[i].name, scale->name, expectScaled);
+		}
+	}
+	printf("%s: %u cases, %u failures\n", __FILE__, cases, failures);
+	return failures != 0;
+
+}
@@ -0,0 +1,218 @@
+/*
+ *	Host test of the sprite cache (ST7735_SPRITES): a run of drawSprite()
+ *	calls must send what the same drawImage() calls do, byte for byte (the
+ *	model hashes the stream), and leave the same screen, whether each
+ *	draw records a sprite, plays one back from RAM, or goes to flash --
+ *	in each color mode (12-bit with odd pixel counts and odd flat runs,
+ *	whose last pixel is padded), through mode changes, eviction of the
+ *	least recently drawn, and sprites too large for the buffer.
+ */
+
+#include <stdio.h>
+#include "st7735.h"
+#include "corpus/photodither.h"
+
+#define IMAGE(name, NAME)	const uint8_t name[] PROGMEM = { \
+		(NAME##_PALETTE_LEN / 2) & 0xff, NAME##_PAL, NAME##_CMDS }
+
+IMAGE(PhotoDither, PHOTODITHER);
+
+//	5x3 bitmap (15 pixels), a 3x3 flat, a 7 pixel flat line and a pixel
+static const uint8_t SpriteA[] PROGMEM = {
+	4,	0x1f, 0x00,	0xe0, 0x07,	0x00, 0xf8,	0xff, 0xff,
+	0x15, 0, 0, 5, 3,
+		0, 1, 2,	3, 2, 1,	0, 0, 3,	1, 1, 1,	2, 3, 0,
+	0x05, 1, 5, 0, 3, 3,
+	0x02, 2, 0, 4, 7,
+	0x01, 3, 8, 1,
+	0xff
+};
+
+//	A flat 9x5 rectangle (45 pixels), a 1x7 bitmap column and a 4x6
+//	bitmap
+static const uint8_t SpriteB[] PROGMEM = {
+	2,	0x55, 0xad,	0x0f, 0x7b,
+	0x05, 0, 0, 0, 9, 5,
+	0x13, 9, 0, 7,
+		0, 1, 0, 1, 1, 0, 1,
+	0x15, 0, 5, 4, 6,
+		0, 1, 1, 0, 0, 1,	1, 1, 0, 0, 1, 0,	0, 0, 1, 1, 1, 1,	1, 0, 0, 0, 0, 1,
+	0xff
+};
+
+//	A 3x11 bitmap (33 pixels)
+static const uint8_t SpriteC[] PROGMEM = {
+	3,	0x00, 0x00,	0x18, 0xc6,	0xff, 0x07,
+	0x15, 0, 0, 3, 11,
+		0, 1, 2, 0, 1, 2, 0, 1, 2, 0, 1,
+		2, 2, 1, 1, 0, 0, 2, 2, 1, 1, 0,
+		1, 0, 2, 1, 0, 2, 1, 0, 2, 1, 0,
+	0xff
+};
+
+typedef struct {
+	const uint8_t* img;
+	uint16_t x, y;
+} Draw;
+
+static uint8_t buf[1024];
+static ST7735_SpriteCache cache;
+static unsigned failures, cases;
+
+static const struct {
+	uint8_t mode;
+	const char* name;
+} modes[] = {
+	{ ST7735_COLMOD_16BIT, "16-bit" },
+	{ ST7735_COLMOD_12BIT, "12-bit" },
+	{ ST7735_COLMOD_18BIT, "18-bit" },
+};
+
+static void reset(uint8_t mode) {
+
+	spiModelReset();
+	ST7735_panel0 = (ST7735_Panel){ ST7735_PANEL_RAW };
+	initLcd();
+	setColorMode(mode);
+
+}
+
+/**
+ *	Runs draws (through the cache, or drawImage()) in mode, switching to
+ *	modeAfter halfway through.
+ */
+static SpiModel run(const Draw* d, uint8_t n, uint8_t mode, uint8_t modeAfter, bool sprites) {
+
+	SpiModel before;
+	SpiModel after;
+	uint8_t i;
+
+	reset(mode);
+	before = spiModel;
+	for (i = 0; i < n; i++) {
+		if (i == n / 2) {
+			setColorMode(modeAfter);
+		}
+		if (sprites) {
+			drawSprite(&cache, d[i].img, d[i].x, d[i].y);
+		} else {
+			drawImage(d[i].img, d[i].x, d[i].y);
+		}
+	}
+	after = spiModel;
+	after.bytes -= before.bytes;
+	after.windows -= before.windows;
+	after.pixels -= before.pixels;
+	return after;
+
+}
+
+/**
+ *	Compares a run through the cache with the same draws from flash, and
+ *	the cache's hit and miss counts with those given.
+ */
+static void check(const char* name, const Draw* d, uint8_t n, uint8_t mode, uint8_t modeAfter,
+				uint16_t hits, uint16_t misses) {
+
+	SpiModel direct, sprites;
+	uint32_t hash;
+
+	cases++;
+	direct = run(d, n, mode, modeAfter, false);
+	hash = spiModelScreenHash();
+	cache.hits = 0; cache.misses = 0;
+	sprites = run(d, n, mode, modeAfter, true);
+	if (spiModelScreenHash() != hash || sprites.stream != direct.stream
+			|| sprites.bytes != direct.bytes
+			|| sprites.windows != direct.windows || sprites.pixels != direct.pixels
+			|| sprites.strays || sprites.cs || cache.hits != hits || cache.misses != misses) {
+		printf("FAIL %s: hash %08lx for %08lx, bytes %lu for %lu, windows %lu for %lu, "
+				"pixels %lu for %lu, %lu strays, CS %u, %u hits (%u), %u misses (%u)\n", name,
+				(unsigned long)spiModelScreenHash(), (unsigned long)hash,
+				(unsigned long)sprites.bytes, (unsigned long)direct.bytes,
+				(unsigned long)sprites.windows, (unsigned long)direct.windows,
+				(unsigned long)sprites.pixels, (unsigned long)direct.pixels,
+				(unsigned long)sprites.strays, sprites.cs, cache.hits, hits, cache.misses, misses);
+		failures++;
+	}
+
+}
+
+/**
+ *	Bytes a sprite takes in the cache, in mode.
+ */
+static uint16_t footprint(const uint8_t* img, uint8_t mode) {
+
+	reset(mode);
+	initSpriteCache(&cache, buf, sizeof(buf));
+	drawSprite(&cache, img, 0, 0);
+	return cache.used;
+
+}
+
+int main(void) {
+
+	static const Draw moves[] = {
+		{ SpriteA, 0, 0 }, { SpriteA, 7, 3 }, { SpriteB, 20, 20 },
+		{ SpriteA, 31, 1 }, { SpriteB, 41, 40 }, { SpriteA, 150, 120 },
+	};
+	static const Draw lru[] = {
+		{ SpriteA, 0, 0 }, { SpriteB, 10, 0 }, { SpriteA, 20, 0 },
+		{ SpriteC, 30, 0 }, { SpriteC, 40, 0 }, { SpriteC, 50, 0 },
+		{ SpriteA, 60, 0 }, { SpriteB, 70, 0 },
+	};
+	static const Draw big[] = {
+		{ SpriteA, 0, 0 }, { PhotoDither, 10, 10 }, { SpriteA, 5, 5 },
+		{ PhotoDither, 20, 20 }, { SpriteA, 130, 100 },
+	};
+	uint16_t a, b, c;
+	uint8_t m;
+	char name[64];
+
+	for (m = 0; m < sizeof(modes) / sizeof(modes[0]); m++) {
+		//	Recorded, then played back anywhere (odd positions too)
+		initSpriteCache(&cache, buf, sizeof(buf));
+		snprintf(name, sizeof(name), "moves, %s", modes[m].name);
+		check(name, moves, 6, modes[m].mode, modes[m].mode, 4, 2);
+
+		//	Room for A and B only: A is drawn again, so C drops B, the
+		//	least recently drawn (recorded the next time), and B misses
+		a = footprint(SpriteA, modes[m].mode);
+		b = footprint(SpriteB, modes[m].mode);
+		c = footprint(SpriteC, modes[m].mode);
+		if (c > b || a + b > sizeof(buf)) {
+			printf("FAIL %s: sprites of %u, %u and %u bytes don't suit the test\n",
+					modes[m].name, a, b, c);
+			failures++;
+		}
+		initSpriteCache(&cache, buf, a + b);
+		snprintf(name, sizeof(name), "eviction, %s", modes[m].name);
+		check(name, lru, 8, modes[m].mode, modes[m].mode, 3, 5);
+		cases++;
+		if (cache.used > a + b) {
+			printf("FAIL %s: %u bytes used of %u\n", name, cache.used, a + b);
+			failures++;
+		}
+
+		//	Larger than the whole buffer: drawn from flash, dropping nothing
+		initSpriteCache(&cache, buf, sizeof(buf));
+		snprintf(name, sizeof(name), "too large, %s", modes[m].name);
+		check(name, big, 5, modes[m].mode, modes[m].mode, 2, 3);
+		cases++;
+		if (cache.big != PhotoDither || cache.used != a) {
+			printf("FAIL %s: big %p, %u bytes used (%u)\n", name,
+					(const void*)cache.big, cache.used, a);
+			failures++;
+		}
+	}
+
+	//	Recorded in one mode, drawn in another: recorded again
+	initSpriteCache(&cache, buf, sizeof(buf));
+	check("16-bit, then 12-bit", moves, 6, ST7735_COLMOD_16BIT, ST7735_COLMOD_12BIT, 2, 4);
+	initSpriteCache(&cache, buf, sizeof(buf));
+	check("12-bit, then 18-bit", moves, 6, ST7735_COLMOD_12BIT, ST7735_COLMOD_18BIT, 2, 4);
+
+	printf("%s: %u cases, %u failures\n", __FILE__, cases, failures);
+	return failures != 0;
+
+}
@@ -0,0 +1,118 @@
+/*
+ *	Host test of panel variant detection: feeds canned RDDID replies to
+ *	initLcdAuto(), and checks the variant chosen, the geometry and GRAM
+ *	offsets that follow from it, and what reaches the (model) panel.
+ */
+
+#include <stdio.h>
+#include "st7735.h"
+
+#define NONE				0xff	//	No variant (detection fails)
+
+typedef struct {
+	const char* name;
+	uint8_t preset;				//	Variant set before initLcdAuto(), or NONE
+	uint8_t id[ST7735_RDDID_RDB];	//	RDDID reply
+	uint8_t orient;				//	Orientation checked
+	uint8_t detect;				//	Variant detected, or NONE
+	uint8_t expect;				//	Variant in effect after init
+	uint16_t width, height;
+	uint16_t caOffset, raOffset;
+	uint8_t madctl;				//	MADCTL expected on the wire
+} Case;
+
+static const Case cases[] = {
+	{ "7735R green tab", NONE, { ST7735_ID_7735 }, ST7735_ORIENT_ROT0,
+			ST7735_VARIANT_7735R_GREENTAB, ST7735_VARIANT_7735R_GREENTAB, 160, 128, 2, 1, 0x50 },
+	{ "7735R green tab, ROT90", NONE, { ST7735_ID_7735 }, ST7735_ORIENT_ROT90,
+			ST7735_VARIANT_7735R_GREENTAB, ST7735_VARIANT_7735R_GREENTAB, 128, 160, 1, 2, 0xf0 },
+	{ "7789 240x240", NONE, { ST7735_ID_7789 }, ST7735_ORIENT_ROT0,
+			ST7735_VARIANT_7789_240X240, ST7735_VARIANT_7789_240X240, 240, 240, 0, 0, 0x50 },
+	{ "7789 240x240, ROT180", NONE, { ST7735_ID_7789 }, ST7735_ORIENT_ROT180,
+			ST7735_VARIANT_7789_240X240, ST7735_VARIANT_7789_240X240, 240, 240, 0, 80, 0x90 },
+	{ "MISO not wired", NONE, { 0xff, 0xff, 0xff }, ST7735_ORIENT_ROT0,
+			NONE, NONE, 160, 128, 0, 0, 0x50 },
+	{ "all zeroes", NONE, { 0x00, 0x00, 0x00 }, ST7735_ORIENT_ROT0,
+			NONE, NONE, 160, 128, 0, 0, 0x50 },
+	{ "unknown ID", NONE, { 0x12, 0x34, 0x56 }, ST7735_ORIENT_ROT0,
+			NONE, NONE, 160, 128, 0, 0, 0x50 },
+	{ "unknown ID, mini preset", ST7735_VARIANT_7735S_MINI160X80,
+			{ 0x12, 0x34, 0x56 }, ST7735_ORIENT_ROT0,
+			NONE, ST7735_VARIANT_7735S_MINI160X80, 160, 80, 26, 1, 0x50 },
+	{ "unknown ID, ILI9163 preset", ST7735_VARIANT_ILI9163_128X128,
+			{ 0xff, 0xff, 0xff }, ST7735_ORIENT_ROT180,
+			NONE, ST7735_VARIANT_ILI9163_128X128, 128, 128, 0, 32, 0x98 },
+	{ "7735 ID over ILI9163 preset", ST7735_VARIANT_ILI9163_128X128,
+			{ ST7735_ID_7735 }, ST7735_ORIENT_ROT0,
+			ST7735_VARIANT_7735R_GREENTAB, ST7735_VARIANT_7735R_GREENTAB, 160, 128, 2, 1, 0x50 },
+};
+
+static unsigned failures;
+
+#define CHECK(c, fmt, ...) do { \
+	if (!(c)) { \
+		printf("FAIL %s: " fmt "\n", t->name, __VA_ARGS__); \
+		failures++; \
+	} \
+} while (0)
+
+static void runCase(const Case* t) {
+
+	const ST7735_Panel* p = ST7735_panel;
+	const ST7735_Variant* detect = t->detect == NONE ? NULL : &ST7735_variants[t->detect];
+	const ST7735_Variant* expect = t->expect == NONE ? NULL : &ST7735_variants[t->expect];
+	const ST7735_Variant* v;
+
+	ST7735_panel0 = (ST7735_Panel){ ST7735_PANEL_RAW };
+	if (t->preset != NONE) {
+		ST7735_panel0.variant = &ST7735_variants[t->preset];
+	}
+	spiModelReset();
+	spiModelReply(ST7735_RDDID, t->id, sizeof(t->id));
+
+	v = initLcdAuto();
+	CHECK(spiModel.commands[ST7735_RDDID] == 1, "%u RDDID reads",
+			(unsigned)spiModel.commands[ST7735_RDDID]);
+	CHECK(v == detect, "detected %d, expected %d",
+			v ? (int)(v - ST7735_variants) : -1, detect ? (int)t->detect : -1);
+	CHECK(p->variant == expect, "variant %d, expected %d",
+			p->variant ? (int)(p->variant - ST7735_variants) : -1,
+			expect ? (int)t->expect : -1);
+	CHECK((spiModel.colmod & 0x07) == ST7735_COLMOD_16BIT && p->colorMode == ST7735_COLMOD_16BIT,
+			"COLMOD %02x", spiModel.colmod);
+
+	setOrientation(t->orient);
+	CHECK(p->width == t->width && p->height == t->height, "size %ux%u, expected %ux%u",
+			p->width, p->height, t->width, t->height);
+	CHECK(p->caOffset == t->caOffset && p->raOffset == t->raOffset,
+			"offsets CA %u, RA %u, expected %u, %u",
+			p->caOffset, p->raOffset, t->caOffset, t->raOffset);
+	CHECK(spiModel.madctl == t->madctl, "MADCTL %02x, expected %02x",
+			spiModel.madctl, t->madctl);
+
+	//	A fill lands at the offset window, in the pixel format set
+	drawfillRectangle(0x1234, 3, 5, 2, 1);
+	CHECK(spiModel.raStart == 3 + t->raOffset && spiModel.raEnd == 4 + t->raOffset,
+			"RASET %u-%u", spiModel.raStart, spiModel.raEnd);
+	CHECK(spiModel.caStart == 5 + t->caOffset && spiModel.caEnd == 5 + t->caOffset,
+			"CASET %u-%u", spiModel.caStart, spiModel.caEnd);
+	CHECK(spiModelPixel565(5 + t->caOffset, 3 + t->raOffset) == 0x1234
+			&& spiModelPixel565(5 + t->caOffset, 4 + t->raOffset) == 0x1234,
+			"pixels %04x %04x", (unsigned)spiModelPixel565(5 + t->caOffset, 3 + t->raOffset),
+			(unsigned)spiModelPixel565(5 + t->caOffset, 4 + t->raOffset));
+	CHECK(spiModel.strays == 0 && !spiModel.cs, "%u bytes outside CS, CS %u",
+			(unsigned)spiModel.strays, spiModel.cs);
+
+}
+
+int main(void) {
+
+	unsigned i;
+
+	for (i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+		runCase(&cases[i]);
+	}
+	printf("%s: %u cases, %u failures\n", __FILE__, i, failures);
+	return failures != 0;
+
+}
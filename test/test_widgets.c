@@ -0,0 +1,140 @@
+/*
+ *	Host test of retained widgets: a first updateWidgets() paints every
+ *	cell and bar; after that, only what changed goes out.  Three numbers
+ *	and a bar changing cost 354 SPI bytes (a glyph per changed digit, the
+ *	bar's new span); setting the same values again costs nothing, and the
+ *	screen matches what was set.
+ */
+
+#include <stdio.h>
+#include "st7735.h"
+
+#define BACK				0x0000
+#define BAR					0xf800
+
+//	Digit glyphs: one 6x8 flat rectangle each, in color 0x1111 * c
+#define GLYPH(c)			const uint8_t glyph##c[] PROGMEM = { 1, \
+		(0x1111 * c) & 0xff, (0x1111 * c) >> 8, 0x05, 0, 0, 0, 6, 8, 0xff };
+GLYPH(0) GLYPH(1) GLYPH(2) GLYPH(3) GLYPH(4) GLYPH(5) GLYPH(6) GLYPH(7) GLYPH(8) GLYPH(9)
+
+static const uint8_t* const digits[] = {
+	glyph0, glyph1, glyph2, glyph3, glyph4, glyph5, glyph6, glyph7, glyph8, glyph9
+};
+static const ST7735_Font digitFont = { digits, '0', 10, 6, 8 };
+
+static ST7735_Widget w[5];
+static unsigned failures;
+
+//	GRAM as logical (x, y): raw addressing at ROT0 puts X on RASET
+#define SCREEN(x, y)		spiModelPixel565((y), (x))
+
+#define CHECK(c, what) do { \
+	if (!(c)) { \
+		printf("FAIL %s: %s\n", what, #c); \
+		failures++; \
+	} \
+} while (0)
+
+/**
+ *	Bytes sent by updateWidgets() for the widgets above.
+ */
+static uint32_t update(void) {
+
+	uint32_t bytes = spiModel.bytes;
+
+	updateWidgets(w, sizeof(w) / sizeof(w[0]));
+	return spiModel.bytes - bytes;
+
+}
+
+/**
+ *	Whether text widget t shows s: each cell its digit's color, else BACK.
+ */
+static bool shows(const ST7735_Widget* t, const char* s) {
+
+	uint8_t i;
+	uint16_t x, y, expect;
+
+	for (i = 0; i < t->len; i++) {
+		expect = (s[i] >= '0' && s[i] <= '9') ? 0x1111 * (s[i] - '0') : BACK;
+		for (x = 0; x < 6; x++) {
+			for (y = 0; y < 8; y++) {
+				if (SCREEN(t->x + 6 * i + x, t->y + y) != expect) {
+					printf("  (%u, %u) is %04x, expected %04x for '%c'\n",
+							t->x + 6 * i + x, t->y + y, SCREEN(t->x + 6 * i + x, t->y + y),
+							expect, s[i]);
+					return false;
+				}
+			}
+		}
+	}
+	return true;
+
+}
+
+/**
+ *	Whether the bar shows len pixels filled.
+ */
+static bool barShows(const ST7735_Widget* b, uint16_t len) {
+
+	uint16_t x, y;
+
+	for (x = 0; x < b->width; x++) {
+		for (y = 0; y < b->height; y++) {
+			if (SCREEN(b->x + x, b->y + y) != ((x < len) ? BAR : BACK)) {
+				return false;
+			}
+		}
+	}
+	return true;
+
+}
+
+int main(void) {
+
+	uint32_t bytes;
+
+	spiModelReset();
+	ST7735_panel0 = (ST7735_Panel){ ST7735_PANEL_RAW };
+	initLcd();
+
+	initIconWidget(&w[0], 0, 0, ImageData);		//	Under the rest
+	initTextWidget(&w[1], 10, 10, &digitFont, 5, BACK);
+	initTextWidget(&w[2], 10, 30, &digitFont, 5, BACK);
+	initTextWidget(&w[3], 10, 50, &digitFont, 5, BACK);
+	initBarWidget(&w[4], 10, 70, 100, 8, 1000, BAR, BACK);
+	setWidgetNumber(&w[1], 1234);
+	setWidgetNumber(&w[2], -56);
+	setWidgetNumber(&w[3], 32767);
+	setWidgetValue(&w[4], 500);
+	bytes = update();
+	printf("first paint: %lu bytes\n", (unsigned long)bytes);
+	CHECK(shows(&w[1], " 1234") && shows(&w[2], "  -56") && shows(&w[3], "32767"),
+			"first paint: numbers");
+	CHECK(barShows(&w[4], 50), "first paint: bar");
+
+	setWidgetNumber(&w[1], 1235);
+	setWidgetNumber(&w[2], -57);
+	setWidgetNumber(&w[3], 32760);
+	setWidgetValue(&w[4], 520);
+	bytes = update();
+	printf("three numbers and a bar: %lu bytes\n", (unsigned long)bytes);
+	CHECK(bytes == 354, "three numbers and a bar");
+	CHECK(shows(&w[1], " 1235") && shows(&w[2], "  -57") && shows(&w[3], "32760"),
+			"numbers after the change");
+	CHECK(barShows(&w[4], 52), "bar after the change");
+
+	setWidgetNumber(&w[1], 1235);
+	setWidgetValue(&w[4], 525);			//	Same length: no repaint
+	CHECK(update() == 0, "no change");
+
+	setWidgetValue(&w[4], 100);
+	setWidgetNumber(&w[2], -32768);		//	Doesn't fit: all '#', blank cells
+	update();
+	CHECK(barShows(&w[4], 10), "bar shrunk");
+	CHECK(shows(&w[2], "#####"), "too long for the widget");
+
+	printf("%s: %u failures\n", __FILE__, failures);
+	return failures != 0;
+
+}
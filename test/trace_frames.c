@@ -0,0 +1,55 @@
+/*
+ *	Writes a bus trace (HOST_TRACE) of a few frames for ../trace.html:
+ *	make trace, then load trace.bin in the page.  Frame 0 is the init;
+ *	1, Image_Compress_Test; 2, a display list of fills and an image
+ *	(each pixel sent once); 3, overlapping fills and a blend, unbatched,
+ *	so the page has transactions and overdraw to report.
+ */
+
+#include <stdio.h>
+#include "st7735.h"
+#include "corpus/uiband.h"
+
+#define IMAGE(name, NAME)	const uint8_t name[] PROGMEM = { \
+		(NAME##_PALETTE_LEN / 2) & 0xff, NAME##_PAL, NAME##_CMDS }
+
+IMAGE(UiBand, UIBAND);
+
+static ST7735_DrawItem items[8];
+
+int main(int argc, char** argv) {
+
+	ST7735_DisplayList dl;
+	uint32_t records;
+	uint8_t i;
+
+	spiModelReset();
+	if (!traceOpen(argc > 1 ? argv[1] : "trace.bin")) {
+		perror("trace_frames");
+		return 1;
+	}
+	ST7735_panel0 = (ST7735_Panel){ ST7735_PANEL_RAW };
+	initLcd();
+
+	ST7735_TRACE(ST7735_TRACE_FRAME, 0);
+	drawImage(ImageData, 0, 0);
+
+	ST7735_TRACE(ST7735_TRACE_FRAME, 0);
+	startDisplayList(&dl, items, 8);
+	addFillRectangle(&dl, 0x2104, 0, 0, 160, 128);
+	addImage(&dl, UiBand, 40, 30, UIBAND_WIDTH, UIBAND_HEIGHT, true);
+	addFillRectangle(&dl, 0xf800, 60, 50, 40, 30);
+	drawDisplayList(&dl);
+
+	ST7735_TRACE(ST7735_TRACE_FRAME, 0);
+	for (i = 0; i < 8; i++) {
+		drawfillRectangle(0x07e0 + i, 10 + 4 * i, 10, 20, 20);
+	}
+	blendRectangle(0xffff, 128, NULL, 20, 20, 32, 16);
+
+	records = traceClose();
+	printf("%lu records, %lu bytes, %lu transactions\n", (unsigned long)records,
+			(unsigned long)spiModel.bytes, (unsigned long)spiModel.transactions);
+	return 0;
+
+}